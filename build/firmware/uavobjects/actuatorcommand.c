@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup ActuatorCommand ActuatorCommand
+ * @brief Contains the pulse duration sent to each of the channels.  Set by @ref ActuatorModule
+ *
+ * Autogenerated files and functions for ActuatorCommand Object
+ * @{ 
+ *
+ * @file       actuatorcommand.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ActuatorCommand object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: actuatorcommand.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "actuatorcommand.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if ACTUATORCOMMAND_ISSINGLEINST
+UAVObjDirect *actuatorcommand_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ActuatorCommandInitialize(void)
+{
+    // Compile time assertion that the ActuatorCommandDataPacked and ActuatorCommandData structs
+    // have the same size (though instances of ActuatorCommandData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(ActuatorCommandDataPacked) == sizeof(ActuatorCommandData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ACTUATORCOMMAND_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(ACTUATORCOMMAND_OBJID,
+        ACTUATORCOMMAND_ISSINGLEINST, ACTUATORCOMMAND_ISSETTINGS, ACTUATORCOMMAND_ISPRIORITY, ACTUATORCOMMAND_NUMBYTES, &ActuatorCommandSetDefaults);
+#if ACTUATORCOMMAND_ISSINGLEINST
+    actuatorcommand_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ActuatorCommandSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    ActuatorCommandData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(ActuatorCommandData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ActuatorCommandHandle()
+{
+    return handle;
+}
+
+#if ACTUATORCOMMAND_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t ActuatorCommandGet(ActuatorCommandData *dataOut)
+{
+    return UAVObjDirectGet(actuatorcommand_direct, dataOut, 0, sizeof(ActuatorCommandData));
+}
+
+int32_t ActuatorCommandSet(const ActuatorCommandData *dataIn)
+{
+    return UAVObjDirectSet(actuatorcommand_direct, dataIn, 0, sizeof(ActuatorCommandData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void ActuatorCommandChannelSet(int16_t *NewChannel)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewChannel, offsetof(ActuatorCommandData, Channel), 12*sizeof(int16_t));
+}
+void ActuatorCommandChannelGet(int16_t *NewChannel)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewChannel, offsetof(ActuatorCommandData, Channel), 12*sizeof(int16_t));
+}
+void ActuatorCommandUpdateTimeSet(uint16_t *NewUpdateTime)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewUpdateTime, offsetof(ActuatorCommandData, UpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandUpdateTimeGet(uint16_t *NewUpdateTime)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewUpdateTime, offsetof(ActuatorCommandData, UpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandMaxUpdateTimeSet(uint16_t *NewMaxUpdateTime)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewMaxUpdateTime, offsetof(ActuatorCommandData, MaxUpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandMaxUpdateTimeGet(uint16_t *NewMaxUpdateTime)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewMaxUpdateTime, offsetof(ActuatorCommandData, MaxUpdateTime), sizeof(uint16_t));
+}
+void ActuatorCommandNumFailedUpdatesSet(uint8_t *NewNumFailedUpdates)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewNumFailedUpdates, offsetof(ActuatorCommandData, NumFailedUpdates), sizeof(uint8_t));
+}
+void ActuatorCommandNumFailedUpdatesGet(uint8_t *NewNumFailedUpdates)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewNumFailedUpdates, offsetof(ActuatorCommandData, NumFailedUpdates), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup ActuatorCommand ActuatorCommand
+ * @brief Contains the pulse duration sent to each of the channels.  Set by @ref ActuatorModule
+ *
+ * Autogenerated files and functions for ActuatorCommand Object
+ *
+ * @{
+ *
+ * @file       actuatorcommand.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ActuatorCommand object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: actuatorcommand.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef ACTUATORCOMMAND_H
+#define ACTUATORCOMMAND_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define ACTUATORCOMMAND_OBJID 0xB8229FE4
+#define ACTUATORCOMMAND_ISSINGLEINST 1
+#define ACTUATORCOMMAND_ISSETTINGS 0
+#define ACTUATORCOMMAND_ISPRIORITY 0
+#define ACTUATORCOMMAND_NUMBYTES sizeof(ActuatorCommandData)
+
+/* Generic interface functions */
+int32_t ActuatorCommandInitialize();
+UAVObjHandle ActuatorCommandHandle();
+void ActuatorCommandSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Channel information */
+
+// Number of elements for field Channel
+#define ACTUATORCOMMAND_CHANNEL_NUMELEM 12
+
+/* Field UpdateTime information */
+
+/* Field MaxUpdateTime information */
+
+/* Field NumFailedUpdates information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        int16_t Channel[12];
+    uint16_t UpdateTime;
+    uint16_t MaxUpdateTime;
+    uint8_t NumFailedUpdates;
+
+} __attribute__((packed)) ActuatorCommandDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef ActuatorCommandDataPacked __attribute__((aligned(4))) ActuatorCommandData;
+
+/* Typesafe Object access functions */
+#if ACTUATORCOMMAND_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *actuatorcommand_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t ActuatorCommandGet(ActuatorCommandData * dataOut) {
+    return UAVObjDirectGet(actuatorcommand_direct, dataOut, 0, sizeof(ActuatorCommandData));
+}
+static inline int32_t ActuatorCommandSet(const ActuatorCommandData * dataIn) {
+    return UAVObjDirectSet(actuatorcommand_direct, dataIn, 0, sizeof(ActuatorCommandData));
+}
+#else
+extern int32_t ActuatorCommandGet(ActuatorCommandData * dataOut);
+extern int32_t ActuatorCommandSet(const ActuatorCommandData * dataIn);
+#endif
+#else
+static inline int32_t ActuatorCommandGet(ActuatorCommandData * dataOut) {
+    return UAVObjGetData(ActuatorCommandHandle(), dataOut);
+}
+static inline int32_t ActuatorCommandSet(const ActuatorCommandData * dataIn) {
+    return UAVObjSetData(ActuatorCommandHandle(), dataIn);
+}
+#endif
+static inline int32_t ActuatorCommandInstGet(uint16_t instId, ActuatorCommandData * dataOut) {
+    return UAVObjGetInstanceData(ActuatorCommandHandle(), instId, dataOut);
+}
+static inline int32_t ActuatorCommandInstSet(uint16_t instId, const ActuatorCommandData * dataIn) {
+    return UAVObjSetInstanceData(ActuatorCommandHandle(), instId, dataIn);
+}
+static inline int32_t ActuatorCommandConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(ActuatorCommandHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t ActuatorCommandConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ActuatorCommandHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t ActuatorCommandConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ActuatorCommandHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t ActuatorCommandCreateInstance() {
+    return UAVObjCreateInstance(ActuatorCommandHandle(), &ActuatorCommandSetDefaults);
+}
+static inline void ActuatorCommandRequestUpdate() {
+    UAVObjRequestUpdate(ActuatorCommandHandle());
+}
+static inline void ActuatorCommandRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(ActuatorCommandHandle(), instId);
+}
+static inline void ActuatorCommandUpdated() {
+    UAVObjUpdated(ActuatorCommandHandle());
+}
+static inline void ActuatorCommandInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(ActuatorCommandHandle(), instId);
+}
+static inline void ActuatorCommandLogging() {
+    UAVObjLogging(ActuatorCommandHandle());
+}
+static inline void ActuatorCommandInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(ActuatorCommandHandle(), instId);
+}
+static inline int32_t ActuatorCommandGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(ActuatorCommandHandle(), dataOut);
+}
+static inline int32_t ActuatorCommandSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(ActuatorCommandHandle(), dataIn);
+}
+static inline int8_t ActuatorCommandReadOnly() {
+    return UAVObjReadOnly(ActuatorCommandHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void ActuatorCommandChannelSet(int16_t *NewChannel)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewChannel, offsetof(ActuatorCommandData, Channel), 12*sizeof(int16_t));
+}
+static inline void ActuatorCommandChannelGet(int16_t *NewChannel)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewChannel, offsetof(ActuatorCommandData, Channel), 12*sizeof(int16_t));
+}
+static inline void ActuatorCommandUpdateTimeSet(uint16_t *NewUpdateTime)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewUpdateTime, offsetof(ActuatorCommandData, UpdateTime), sizeof(uint16_t));
+}
+static inline void ActuatorCommandUpdateTimeGet(uint16_t *NewUpdateTime)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewUpdateTime, offsetof(ActuatorCommandData, UpdateTime), sizeof(uint16_t));
+}
+static inline void ActuatorCommandMaxUpdateTimeSet(uint16_t *NewMaxUpdateTime)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewMaxUpdateTime, offsetof(ActuatorCommandData, MaxUpdateTime), sizeof(uint16_t));
+}
+static inline void ActuatorCommandMaxUpdateTimeGet(uint16_t *NewMaxUpdateTime)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewMaxUpdateTime, offsetof(ActuatorCommandData, MaxUpdateTime), sizeof(uint16_t));
+}
+static inline void ActuatorCommandNumFailedUpdatesSet(uint8_t *NewNumFailedUpdates)
+{
+    UAVObjDirectSet(actuatorcommand_direct, (void *)NewNumFailedUpdates, offsetof(ActuatorCommandData, NumFailedUpdates), sizeof(uint8_t));
+}
+static inline void ActuatorCommandNumFailedUpdatesGet(uint8_t *NewNumFailedUpdates)
+{
+    UAVObjDirectGet(actuatorcommand_direct, (void *)NewNumFailedUpdates, offsetof(ActuatorCommandData, NumFailedUpdates), sizeof(uint8_t));
+}
+#else
+extern void ActuatorCommandChannelSet(int16_t *NewChannel);
+extern void ActuatorCommandChannelGet(int16_t *NewChannel);
+extern void ActuatorCommandUpdateTimeSet(uint16_t *NewUpdateTime);
+extern void ActuatorCommandUpdateTimeGet(uint16_t *NewUpdateTime);
+extern void ActuatorCommandMaxUpdateTimeSet(uint16_t *NewMaxUpdateTime);
+extern void ActuatorCommandMaxUpdateTimeGet(uint16_t *NewMaxUpdateTime);
+extern void ActuatorCommandNumFailedUpdatesSet(uint8_t *NewNumFailedUpdates);
+extern void ActuatorCommandNumFailedUpdatesGet(uint8_t *NewNumFailedUpdates);
+#endif
+
+
+#endif // ACTUATORCOMMAND_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup AirspeedSettings AirspeedSettings
+ * @brief Settings for the @ref BaroAirspeed module used on CopterControl or Revolution
+ *
+ * Autogenerated files and functions for AirspeedSettings Object
+ *
+ * @{
+ *
+ * @file       airspeedsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AirspeedSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: airspeedsettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef AIRSPEEDSETTINGS_H
+#define AIRSPEEDSETTINGS_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define AIRSPEEDSETTINGS_OBJID 0x69F4AD7A
+#define AIRSPEEDSETTINGS_ISSINGLEINST 1
+#define AIRSPEEDSETTINGS_ISSETTINGS 1
+#define AIRSPEEDSETTINGS_ISPRIORITY 0
+#define AIRSPEEDSETTINGS_NUMBYTES sizeof(AirspeedSettingsData)
+
+/* Generic interface functions */
+int32_t AirspeedSettingsInitialize();
+UAVObjHandle AirspeedSettingsHandle();
+void AirspeedSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Scale information */
+
+/* Field IMUBasedEstimationLowPassPeriod1 information */
+
+/* Field IMUBasedEstimationLowPassPeriod2 information */
+
+/* Field ZeroPoint information */
+
+/* Field SamplePeriod information */
+
+/* Field AirspeedSensorType information */
+
+// Enumeration options for field AirspeedSensorType
+typedef enum __attribute__ ((__packed__)) {
+    AIRSPEEDSETTINGS_AIRSPEEDSENSORTYPE_PIXHAWKAIRSPEEDMS4525DO=0,
+    AIRSPEEDSETTINGS_AIRSPEEDSENSORTYPE_EAGLETREEAIRSPEEDV3=1,
+    AIRSPEEDSETTINGS_AIRSPEEDSENSORTYPE_DIYDRONESMPXV5004=2,
+    AIRSPEEDSETTINGS_AIRSPEEDSENSORTYPE_DIYDRONESMPXV7002=3,
+    AIRSPEEDSETTINGS_AIRSPEEDSENSORTYPE_GROUNDSPEEDBASEDWINDESTIMATION=4,
+    AIRSPEEDSETTINGS_AIRSPEEDSENSORTYPE_NONE=5
+} AirspeedSettingsAirspeedSensorTypeOptions;
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float Scale;
+    float IMUBasedEstimationLowPassPeriod1;
+    float IMUBasedEstimationLowPassPeriod2;
+    uint16_t ZeroPoint;
+    uint8_t SamplePeriod;
+    AirspeedSettingsAirspeedSensorTypeOptions AirspeedSensorType;
+
+} __attribute__((packed)) AirspeedSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef AirspeedSettingsDataPacked __attribute__((aligned(4))) AirspeedSettingsData;
+
+/* Typesafe Object access functions */
+#if AIRSPEEDSETTINGS_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *airspeedsettings_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t AirspeedSettingsGet(AirspeedSettingsData * dataOut) {
+    return UAVObjDirectGet(airspeedsettings_direct, dataOut, 0, sizeof(AirspeedSettingsData));
+}
+static inline int32_t AirspeedSettingsSet(const AirspeedSettingsData * dataIn) {
+    return UAVObjDirectSet(airspeedsettings_direct, dataIn, 0, sizeof(AirspeedSettingsData));
+}
+#else
+extern int32_t AirspeedSettingsGet(AirspeedSettingsData * dataOut);
+extern int32_t AirspeedSettingsSet(const AirspeedSettingsData * dataIn);
+#endif
+#else
+static inline int32_t AirspeedSettingsGet(AirspeedSettingsData * dataOut) {
+    return UAVObjGetData(AirspeedSettingsHandle(), dataOut);
+}
+static inline int32_t AirspeedSettingsSet(const AirspeedSettingsData * dataIn) {
+    return UAVObjSetData(AirspeedSettingsHandle(), dataIn);
+}
+#endif
+static inline int32_t AirspeedSettingsInstGet(uint16_t instId, AirspeedSettingsData * dataOut) {
+    return UAVObjGetInstanceData(AirspeedSettingsHandle(), instId, dataOut);
+}
+static inline int32_t AirspeedSettingsInstSet(uint16_t instId, const AirspeedSettingsData * dataIn) {
+    return UAVObjSetInstanceData(AirspeedSettingsHandle(), instId, dataIn);
+}
+static inline int32_t AirspeedSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(AirspeedSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t AirspeedSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(AirspeedSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t AirspeedSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(AirspeedSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t AirspeedSettingsCreateInstance() {
+    return UAVObjCreateInstance(AirspeedSettingsHandle(), &AirspeedSettingsSetDefaults);
+}
+static inline void AirspeedSettingsRequestUpdate() {
+    UAVObjRequestUpdate(AirspeedSettingsHandle());
+}
+static inline void AirspeedSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(AirspeedSettingsHandle(), instId);
+}
+static inline void AirspeedSettingsUpdated() {
+    UAVObjUpdated(AirspeedSettingsHandle());
+}
+static inline void AirspeedSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(AirspeedSettingsHandle(), instId);
+}
+static inline void AirspeedSettingsLogging() {
+    UAVObjLogging(AirspeedSettingsHandle());
+}
+static inline void AirspeedSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(AirspeedSettingsHandle(), instId);
+}
+static inline int32_t AirspeedSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(AirspeedSettingsHandle(), dataOut);
+}
+static inline int32_t AirspeedSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(AirspeedSettingsHandle(), dataIn);
+}
+static inline int8_t AirspeedSettingsReadOnly() {
+    return UAVObjReadOnly(AirspeedSettingsHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void AirspeedSettingsScaleSet(float *NewScale)
+{
+    UAVObjDirectSet(airspeedsettings_direct, (void *)NewScale, offsetof(AirspeedSettingsData, Scale), sizeof(float));
+}
+static inline void AirspeedSettingsScaleGet(float *NewScale)
+{
+    UAVObjDirectGet(airspeedsettings_direct, (void *)NewScale, offsetof(AirspeedSettingsData, Scale), sizeof(float));
+}
+static inline void AirspeedSettingsIMUBasedEstimationLowPassPeriod1Set(float *NewIMUBasedEstimationLowPassPeriod1)
+{
+    UAVObjDirectSet(airspeedsettings_direct, (void *)NewIMUBasedEstimationLowPassPeriod1, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod1), sizeof(float));
+}
+static inline void AirspeedSettingsIMUBasedEstimationLowPassPeriod1Get(float *NewIMUBasedEstimationLowPassPeriod1)
+{
+    UAVObjDirectGet(airspeedsettings_direct, (void *)NewIMUBasedEstimationLowPassPeriod1, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod1), sizeof(float));
+}
+static inline void AirspeedSettingsIMUBasedEstimationLowPassPeriod2Set(float *NewIMUBasedEstimationLowPassPeriod2)
+{
+    UAVObjDirectSet(airspeedsettings_direct, (void *)NewIMUBasedEstimationLowPassPeriod2, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod2), sizeof(float));
+}
+static inline void AirspeedSettingsIMUBasedEstimationLowPassPeriod2Get(float *NewIMUBasedEstimationLowPassPeriod2)
+{
+    UAVObjDirectGet(airspeedsettings_direct, (void *)NewIMUBasedEstimationLowPassPeriod2, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod2), sizeof(float));
+}
+static inline void AirspeedSettingsZeroPointSet(uint16_t *NewZeroPoint)
+{
+    UAVObjDirectSet(airspeedsettings_direct, (void *)NewZeroPoint, offsetof(AirspeedSettingsData, ZeroPoint), sizeof(uint16_t));
+}
+static inline void AirspeedSettingsZeroPointGet(uint16_t *NewZeroPoint)
+{
+    UAVObjDirectGet(airspeedsettings_direct, (void *)NewZeroPoint, offsetof(AirspeedSettingsData, ZeroPoint), sizeof(uint16_t));
+}
+static inline void AirspeedSettingsSamplePeriodSet(uint8_t *NewSamplePeriod)
+{
+    UAVObjDirectSet(airspeedsettings_direct, (void *)NewSamplePeriod, offsetof(AirspeedSettingsData, SamplePeriod), sizeof(uint8_t));
+}
+static inline void AirspeedSettingsSamplePeriodGet(uint8_t *NewSamplePeriod)
+{
+    UAVObjDirectGet(airspeedsettings_direct, (void *)NewSamplePeriod, offsetof(AirspeedSettingsData, SamplePeriod), sizeof(uint8_t));
+}
+static inline void AirspeedSettingsAirspeedSensorTypeSet(AirspeedSettingsAirspeedSensorTypeOptions *NewAirspeedSensorType)
+{
+    UAVObjDirectSet(airspeedsettings_direct, (void *)NewAirspeedSensorType, offsetof(AirspeedSettingsData, AirspeedSensorType), sizeof(AirspeedSettingsAirspeedSensorTypeOptions));
+}
+static inline void AirspeedSettingsAirspeedSensorTypeGet(AirspeedSettingsAirspeedSensorTypeOptions *NewAirspeedSensorType)
+{
+    UAVObjDirectGet(airspeedsettings_direct, (void *)NewAirspeedSensorType, offsetof(AirspeedSettingsData, AirspeedSensorType), sizeof(AirspeedSettingsAirspeedSensorTypeOptions));
+}
+#else
+extern void AirspeedSettingsScaleSet(float *NewScale);
+extern void AirspeedSettingsScaleGet(float *NewScale);
+extern void AirspeedSettingsIMUBasedEstimationLowPassPeriod1Set(float *NewIMUBasedEstimationLowPassPeriod1);
+extern void AirspeedSettingsIMUBasedEstimationLowPassPeriod1Get(float *NewIMUBasedEstimationLowPassPeriod1);
+extern void AirspeedSettingsIMUBasedEstimationLowPassPeriod2Set(float *NewIMUBasedEstimationLowPassPeriod2);
+extern void AirspeedSettingsIMUBasedEstimationLowPassPeriod2Get(float *NewIMUBasedEstimationLowPassPeriod2);
+extern void AirspeedSettingsZeroPointSet(uint16_t *NewZeroPoint);
+extern void AirspeedSettingsZeroPointGet(uint16_t *NewZeroPoint);
+extern void AirspeedSettingsSamplePeriodSet(uint8_t *NewSamplePeriod);
+extern void AirspeedSettingsSamplePeriodGet(uint8_t *NewSamplePeriod);
+extern void AirspeedSettingsAirspeedSensorTypeSet(AirspeedSettingsAirspeedSensorTypeOptions *NewAirspeedSensorType);
+extern void AirspeedSettingsAirspeedSensorTypeGet(AirspeedSettingsAirspeedSensorTypeOptions *NewAirspeedSensorType);
+#endif
+
+
+#endif // AIRSPEEDSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,181 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AltitudeFilterSettings AltitudeFilterSettings
+ * @brief Settings for the @ref State Estimator module plugin altitudeFilter
+ *
+ * Autogenerated files and functions for AltitudeFilterSettings Object
+ * @{ 
+ *
+ * @file       altitudefiltersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AltitudeFilterSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: altitudefiltersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "altitudefiltersettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if ALTITUDEFILTERSETTINGS_ISSINGLEINST
+UAVObjDirect *altitudefiltersettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AltitudeFilterSettingsInitialize(void)
+{
+    // Compile time assertion that the AltitudeFilterSettingsDataPacked and AltitudeFilterSettingsData structs
+    // have the same size (though instances of AltitudeFilterSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AltitudeFilterSettingsDataPacked) == sizeof(AltitudeFilterSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ALTITUDEFILTERSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(ALTITUDEFILTERSETTINGS_OBJID,
+        ALTITUDEFILTERSETTINGS_ISSINGLEINST, ALTITUDEFILTERSETTINGS_ISSETTINGS, ALTITUDEFILTERSETTINGS_ISPRIORITY, ALTITUDEFILTERSETTINGS_NUMBYTES, &AltitudeFilterSettingsSetDefaults);
+#if ALTITUDEFILTERSETTINGS_ISSINGLEINST
+    altitudefiltersettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AltitudeFilterSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AltitudeFilterSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AltitudeFilterSettingsData));
+    data.AccelLowPassKp = 4.000000e-02f;
+    data.AccelDriftKi = 5.000000e-04f;
+    data.InitializationAccelDriftKi = 2.000000e-01f;
+    data.BaroKp = 2.000000e-02f;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AltitudeFilterSettingsHandle()
+{
+    return handle;
+}
+
+#if ALTITUDEFILTERSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t AltitudeFilterSettingsGet(AltitudeFilterSettingsData *dataOut)
+{
+    return UAVObjDirectGet(altitudefiltersettings_direct, dataOut, 0, sizeof(AltitudeFilterSettingsData));
+}
+
+int32_t AltitudeFilterSettingsSet(const AltitudeFilterSettingsData *dataIn)
+{
+    return UAVObjDirectSet(altitudefiltersettings_direct, dataIn, 0, sizeof(AltitudeFilterSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void AltitudeFilterSettingsAccelLowPassKpSet(float *NewAccelLowPassKp)
+{
+    UAVObjDirectSet(altitudefiltersettings_direct, (void *)NewAccelLowPassKp, offsetof(AltitudeFilterSettingsData, AccelLowPassKp), sizeof(float));
+}
+void AltitudeFilterSettingsAccelLowPassKpGet(float *NewAccelLowPassKp)
+{
+    UAVObjDirectGet(altitudefiltersettings_direct, (void *)NewAccelLowPassKp, offsetof(AltitudeFilterSettingsData, AccelLowPassKp), sizeof(float));
+}
+void AltitudeFilterSettingsAccelDriftKiSet(float *NewAccelDriftKi)
+{
+    UAVObjDirectSet(altitudefiltersettings_direct, (void *)NewAccelDriftKi, offsetof(AltitudeFilterSettingsData, AccelDriftKi), sizeof(float));
+}
+void AltitudeFilterSettingsAccelDriftKiGet(float *NewAccelDriftKi)
+{
+    UAVObjDirectGet(altitudefiltersettings_direct, (void *)NewAccelDriftKi, offsetof(AltitudeFilterSettingsData, AccelDriftKi), sizeof(float));
+}
+void AltitudeFilterSettingsInitializationAccelDriftKiSet(float *NewInitializationAccelDriftKi)
+{
+    UAVObjDirectSet(altitudefiltersettings_direct, (void *)NewInitializationAccelDriftKi, offsetof(AltitudeFilterSettingsData, InitializationAccelDriftKi), sizeof(float));
+}
+void AltitudeFilterSettingsInitializationAccelDriftKiGet(float *NewInitializationAccelDriftKi)
+{
+    UAVObjDirectGet(altitudefiltersettings_direct, (void *)NewInitializationAccelDriftKi, offsetof(AltitudeFilterSettingsData, InitializationAccelDriftKi), sizeof(float));
+}
+void AltitudeFilterSettingsBaroKpSet(float *NewBaroKp)
+{
+    UAVObjDirectSet(altitudefiltersettings_direct, (void *)NewBaroKp, offsetof(AltitudeFilterSettingsData, BaroKp), sizeof(float));
+}
+void AltitudeFilterSettingsBaroKpGet(float *NewBaroKp)
+{
+    UAVObjDirectGet(altitudefiltersettings_direct, (void *)NewBaroKp, offsetof(AltitudeFilterSettingsData, BaroKp), sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,201 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AttitudeState AttitudeState
+ * @brief The updated Attitude estimation from @ref StateEstimationModule.
+ *
+ * Autogenerated files and functions for AttitudeState Object
+ * @{ 
+ *
+ * @file       attitudestate.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AttitudeState object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudestate.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "attitudestate.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if ATTITUDESTATE_ISSINGLEINST
+UAVObjDirect *attitudestate_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AttitudeStateInitialize(void)
+{
+    // Compile time assertion that the AttitudeStateDataPacked and AttitudeStateData structs
+    // have the same size (though instances of AttitudeStateData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AttitudeStateDataPacked) == sizeof(AttitudeStateData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ATTITUDESTATE_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(ATTITUDESTATE_OBJID,
+        ATTITUDESTATE_ISSINGLEINST, ATTITUDESTATE_ISSETTINGS, ATTITUDESTATE_ISPRIORITY, ATTITUDESTATE_NUMBYTES, &AttitudeStateSetDefaults);
+#if ATTITUDESTATE_ISSINGLEINST
+    attitudestate_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AttitudeStateSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AttitudeStateData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AttitudeStateData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 130;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AttitudeStateHandle()
+{
+    return handle;
+}
+
+#if ATTITUDESTATE_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t AttitudeStateGet(AttitudeStateData *dataOut)
+{
+    return UAVObjDirectGet(attitudestate_direct, dataOut, 0, sizeof(AttitudeStateData));
+}
+
+int32_t AttitudeStateSet(const AttitudeStateData *dataIn)
+{
+    return UAVObjDirectSet(attitudestate_direct, dataIn, 0, sizeof(AttitudeStateData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void AttitudeStateq1Set(float *Newq1)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)Newq1, offsetof(AttitudeStateData, q1), sizeof(float));
+}
+void AttitudeStateq1Get(float *Newq1)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)Newq1, offsetof(AttitudeStateData, q1), sizeof(float));
+}
+void AttitudeStateq2Set(float *Newq2)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)Newq2, offsetof(AttitudeStateData, q2), sizeof(float));
+}
+void AttitudeStateq2Get(float *Newq2)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)Newq2, offsetof(AttitudeStateData, q2), sizeof(float));
+}
+void AttitudeStateq3Set(float *Newq3)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)Newq3, offsetof(AttitudeStateData, q3), sizeof(float));
+}
+void AttitudeStateq3Get(float *Newq3)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)Newq3, offsetof(AttitudeStateData, q3), sizeof(float));
+}
+void AttitudeStateq4Set(float *Newq4)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)Newq4, offsetof(AttitudeStateData, q4), sizeof(float));
+}
+void AttitudeStateq4Get(float *Newq4)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)Newq4, offsetof(AttitudeStateData, q4), sizeof(float));
+}
+void AttitudeStateRollSet(float *NewRoll)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)NewRoll, offsetof(AttitudeStateData, Roll), sizeof(float));
+}
+void AttitudeStateRollGet(float *NewRoll)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)NewRoll, offsetof(AttitudeStateData, Roll), sizeof(float));
+}
+void AttitudeStatePitchSet(float *NewPitch)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)NewPitch, offsetof(AttitudeStateData, Pitch), sizeof(float));
+}
+void AttitudeStatePitchGet(float *NewPitch)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)NewPitch, offsetof(AttitudeStateData, Pitch), sizeof(float));
+}
+void AttitudeStateYawSet(float *NewYaw)
+{
+    UAVObjDirectSet(attitudestate_direct, (void *)NewYaw, offsetof(AttitudeStateData, Yaw), sizeof(float));
+}
+void AttitudeStateYawGet(float *NewYaw)
+{
+    UAVObjDirectGet(attitudestate_direct, (void *)NewYaw, offsetof(AttitudeStateData, Yaw), sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
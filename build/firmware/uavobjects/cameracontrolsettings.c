@@ -0,0 +1,246 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup CameraControlSettings CameraControlSettings
+ * @brief Settings for the @ref CameraControl module
+ *
+ * Autogenerated files and functions for CameraControlSettings Object
+ * @{ 
+ *
+ * @file       cameracontrolsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the CameraControlSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: cameracontrolsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "cameracontrolsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if CAMERACONTROLSETTINGS_ISSINGLEINST
+UAVObjDirect *cameracontrolsettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t CameraControlSettingsInitialize(void)
+{
+    // Compile time assertion that the CameraControlSettingsDataPacked and CameraControlSettingsData structs
+    // have the same size (though instances of CameraControlSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(CameraControlSettingsDataPacked) == sizeof(CameraControlSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(CAMERACONTROLSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(CAMERACONTROLSETTINGS_OBJID,
+        CAMERACONTROLSETTINGS_ISSINGLEINST, CAMERACONTROLSETTINGS_ISSETTINGS, CAMERACONTROLSETTINGS_ISPRIORITY, CAMERACONTROLSETTINGS_NUMBYTES, &CameraControlSettingsSetDefaults);
+#if CAMERACONTROLSETTINGS_ISSINGLEINST
+    cameracontrolsettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void CameraControlSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    CameraControlSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(CameraControlSettingsData));
+    data.OutputValues.Idle = 0.000000e+00f;
+    data.OutputValues.Shot = -1.000000e+00f;
+    data.OutputValues.Video = 1.000000e+00f;
+    data.InputValues.Idle = 0.000000e+00f;
+    data.InputValues.Shot = -1.000000e+00f;
+    data.InputValues.Video = 1.000000e+00f;
+    data.TimeInterval = 5.000000e+00f;
+    data.SpaceInterval = 0.000000e+00f;
+    data.MinimumTimeInterval = 2.500000e+00f;
+    data.TriggerPulseWidth = 50;
+    data.AutoTriggerInput = 0;
+    data.ManualTriggerInput = 0;
+    data.AutoTriggerMode = 1;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle CameraControlSettingsHandle()
+{
+    return handle;
+}
+
+#if CAMERACONTROLSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t CameraControlSettingsGet(CameraControlSettingsData *dataOut)
+{
+    return UAVObjDirectGet(cameracontrolsettings_direct, dataOut, 0, sizeof(CameraControlSettingsData));
+}
+
+int32_t CameraControlSettingsSet(const CameraControlSettingsData *dataIn)
+{
+    return UAVObjDirectSet(cameracontrolsettings_direct, dataIn, 0, sizeof(CameraControlSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void CameraControlSettingsOutputValuesSet(CameraControlSettingsOutputValuesData *NewOutputValues)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsOutputValuesGet(CameraControlSettingsOutputValuesData *NewOutputValues)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsOutputValuesArraySet(float *NewOutputValues)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsOutputValuesArrayGet(float *NewOutputValues)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewOutputValues, offsetof(CameraControlSettingsData, OutputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesSet(CameraControlSettingsInputValuesData *NewInputValues)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesGet(CameraControlSettingsInputValuesData *NewInputValues)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesArraySet(float *NewInputValues)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsInputValuesArrayGet(float *NewInputValues)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewInputValues, offsetof(CameraControlSettingsData, InputValues), 3*sizeof(float));
+}
+void CameraControlSettingsTimeIntervalSet(float *NewTimeInterval)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewTimeInterval, offsetof(CameraControlSettingsData, TimeInterval), sizeof(float));
+}
+void CameraControlSettingsTimeIntervalGet(float *NewTimeInterval)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewTimeInterval, offsetof(CameraControlSettingsData, TimeInterval), sizeof(float));
+}
+void CameraControlSettingsSpaceIntervalSet(float *NewSpaceInterval)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewSpaceInterval, offsetof(CameraControlSettingsData, SpaceInterval), sizeof(float));
+}
+void CameraControlSettingsSpaceIntervalGet(float *NewSpaceInterval)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewSpaceInterval, offsetof(CameraControlSettingsData, SpaceInterval), sizeof(float));
+}
+void CameraControlSettingsMinimumTimeIntervalSet(float *NewMinimumTimeInterval)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewMinimumTimeInterval, offsetof(CameraControlSettingsData, MinimumTimeInterval), sizeof(float));
+}
+void CameraControlSettingsMinimumTimeIntervalGet(float *NewMinimumTimeInterval)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewMinimumTimeInterval, offsetof(CameraControlSettingsData, MinimumTimeInterval), sizeof(float));
+}
+void CameraControlSettingsTriggerPulseWidthSet(uint16_t *NewTriggerPulseWidth)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewTriggerPulseWidth, offsetof(CameraControlSettingsData, TriggerPulseWidth), sizeof(uint16_t));
+}
+void CameraControlSettingsTriggerPulseWidthGet(uint16_t *NewTriggerPulseWidth)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewTriggerPulseWidth, offsetof(CameraControlSettingsData, TriggerPulseWidth), sizeof(uint16_t));
+}
+void CameraControlSettingsAutoTriggerInputSet(CameraControlSettingsAutoTriggerInputOptions *NewAutoTriggerInput)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewAutoTriggerInput, offsetof(CameraControlSettingsData, AutoTriggerInput), sizeof(CameraControlSettingsAutoTriggerInputOptions));
+}
+void CameraControlSettingsAutoTriggerInputGet(CameraControlSettingsAutoTriggerInputOptions *NewAutoTriggerInput)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewAutoTriggerInput, offsetof(CameraControlSettingsData, AutoTriggerInput), sizeof(CameraControlSettingsAutoTriggerInputOptions));
+}
+void CameraControlSettingsManualTriggerInputSet(CameraControlSettingsManualTriggerInputOptions *NewManualTriggerInput)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewManualTriggerInput, offsetof(CameraControlSettingsData, ManualTriggerInput), sizeof(CameraControlSettingsManualTriggerInputOptions));
+}
+void CameraControlSettingsManualTriggerInputGet(CameraControlSettingsManualTriggerInputOptions *NewManualTriggerInput)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewManualTriggerInput, offsetof(CameraControlSettingsData, ManualTriggerInput), sizeof(CameraControlSettingsManualTriggerInputOptions));
+}
+void CameraControlSettingsAutoTriggerModeSet(CameraControlSettingsAutoTriggerModeOptions *NewAutoTriggerMode)
+{
+    UAVObjDirectSet(cameracontrolsettings_direct, (void *)NewAutoTriggerMode, offsetof(CameraControlSettingsData, AutoTriggerMode), sizeof(CameraControlSettingsAutoTriggerModeOptions));
+}
+void CameraControlSettingsAutoTriggerModeGet(CameraControlSettingsAutoTriggerModeOptions *NewAutoTriggerMode)
+{
+    UAVObjDirectGet(cameracontrolsettings_direct, (void *)NewAutoTriggerMode, offsetof(CameraControlSettingsData, AutoTriggerMode), sizeof(CameraControlSettingsAutoTriggerModeOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup CameraDesired CameraDesired
+ * @brief Desired camera outputs.  Comes from @ref CameraStabilization module.
+ *
+ * Autogenerated files and functions for CameraDesired Object
+ * @{ 
+ *
+ * @file       cameradesired.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the CameraDesired object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: cameradesired.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "cameradesired.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if CAMERADESIRED_ISSINGLEINST
+UAVObjDirect *cameradesired_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t CameraDesiredInitialize(void)
+{
+    // Compile time assertion that the CameraDesiredDataPacked and CameraDesiredData structs
+    // have the same size (though instances of CameraDesiredData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(CameraDesiredDataPacked) == sizeof(CameraDesiredData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(CAMERADESIRED_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(CAMERADESIRED_OBJID,
+        CAMERADESIRED_ISSINGLEINST, CAMERADESIRED_ISSETTINGS, CAMERADESIRED_ISPRIORITY, CAMERADESIRED_NUMBYTES, &CameraDesiredSetDefaults);
+#if CAMERADESIRED_ISSINGLEINST
+    cameradesired_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void CameraDesiredSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    CameraDesiredData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(CameraDesiredData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle CameraDesiredHandle()
+{
+    return handle;
+}
+
+#if CAMERADESIRED_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t CameraDesiredGet(CameraDesiredData *dataOut)
+{
+    return UAVObjDirectGet(cameradesired_direct, dataOut, 0, sizeof(CameraDesiredData));
+}
+
+int32_t CameraDesiredSet(const CameraDesiredData *dataIn)
+{
+    return UAVObjDirectSet(cameradesired_direct, dataIn, 0, sizeof(CameraDesiredData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void CameraDesiredRollOrServo1Set(float *NewRollOrServo1)
+{
+    UAVObjDirectSet(cameradesired_direct, (void *)NewRollOrServo1, offsetof(CameraDesiredData, RollOrServo1), sizeof(float));
+}
+void CameraDesiredRollOrServo1Get(float *NewRollOrServo1)
+{
+    UAVObjDirectGet(cameradesired_direct, (void *)NewRollOrServo1, offsetof(CameraDesiredData, RollOrServo1), sizeof(float));
+}
+void CameraDesiredPitchOrServo2Set(float *NewPitchOrServo2)
+{
+    UAVObjDirectSet(cameradesired_direct, (void *)NewPitchOrServo2, offsetof(CameraDesiredData, PitchOrServo2), sizeof(float));
+}
+void CameraDesiredPitchOrServo2Get(float *NewPitchOrServo2)
+{
+    UAVObjDirectGet(cameradesired_direct, (void *)NewPitchOrServo2, offsetof(CameraDesiredData, PitchOrServo2), sizeof(float));
+}
+void CameraDesiredYawSet(float *NewYaw)
+{
+    UAVObjDirectSet(cameradesired_direct, (void *)NewYaw, offsetof(CameraDesiredData, Yaw), sizeof(float));
+}
+void CameraDesiredYawGet(float *NewYaw)
+{
+    UAVObjDirectGet(cameradesired_direct, (void *)NewYaw, offsetof(CameraDesiredData, Yaw), sizeof(float));
+}
+void CameraDesiredTriggerSet(float *NewTrigger)
+{
+    UAVObjDirectSet(cameradesired_direct, (void *)NewTrigger, offsetof(CameraDesiredData, Trigger), sizeof(float));
+}
+void CameraDesiredTriggerGet(float *NewTrigger)
+{
+    UAVObjDirectGet(cameradesired_direct, (void *)NewTrigger, offsetof(CameraDesiredData, Trigger), sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
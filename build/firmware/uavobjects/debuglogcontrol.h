@@ -0,0 +1,229 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup DebugLogControl DebugLogControl
+ * @brief Log Control Object - Used to issue commands to the on board logging system
+ *
+ * Autogenerated files and functions for DebugLogControl Object
+ *
+ * @{
+ *
+ * @file       debuglogcontrol.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the DebugLogControl object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: debuglogcontrol.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef DEBUGLOGCONTROL_H
+#define DEBUGLOGCONTROL_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define DEBUGLOGCONTROL_OBJID 0xD5437E04
+#define DEBUGLOGCONTROL_ISSINGLEINST 1
+#define DEBUGLOGCONTROL_ISSETTINGS 0
+#define DEBUGLOGCONTROL_ISPRIORITY 0
+#define DEBUGLOGCONTROL_NUMBYTES sizeof(DebugLogControlData)
+
+/* Generic interface functions */
+int32_t DebugLogControlInitialize();
+UAVObjHandle DebugLogControlHandle();
+void DebugLogControlSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Flight information */
+
+/* Field Entry information */
+
+/* Field Count information */
+
+/* Field Operation information */
+
+// Enumeration options for field Operation
+typedef enum __attribute__ ((__packed__)) {
+    DEBUGLOGCONTROL_OPERATION_NONE=0,
+    DEBUGLOGCONTROL_OPERATION_RETRIEVE=1,
+    DEBUGLOGCONTROL_OPERATION_FORMATFLASH=2,
+    DEBUGLOGCONTROL_OPERATION_STREAM=3
+} DebugLogControlOperationOptions;
+
+/* Field Period information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint16_t Flight;
+    uint16_t Entry;
+    uint16_t Count;
+    DebugLogControlOperationOptions Operation;
+    uint8_t Period;
+
+} __attribute__((packed)) DebugLogControlDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef DebugLogControlDataPacked __attribute__((aligned(4))) DebugLogControlData;
+
+/* Typesafe Object access functions */
+#if DEBUGLOGCONTROL_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *debuglogcontrol_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t DebugLogControlGet(DebugLogControlData * dataOut) {
+    return UAVObjDirectGet(debuglogcontrol_direct, dataOut, 0, sizeof(DebugLogControlData));
+}
+static inline int32_t DebugLogControlSet(const DebugLogControlData * dataIn) {
+    return UAVObjDirectSet(debuglogcontrol_direct, dataIn, 0, sizeof(DebugLogControlData));
+}
+#else
+extern int32_t DebugLogControlGet(DebugLogControlData * dataOut);
+extern int32_t DebugLogControlSet(const DebugLogControlData * dataIn);
+#endif
+#else
+static inline int32_t DebugLogControlGet(DebugLogControlData * dataOut) {
+    return UAVObjGetData(DebugLogControlHandle(), dataOut);
+}
+static inline int32_t DebugLogControlSet(const DebugLogControlData * dataIn) {
+    return UAVObjSetData(DebugLogControlHandle(), dataIn);
+}
+#endif
+static inline int32_t DebugLogControlInstGet(uint16_t instId, DebugLogControlData * dataOut) {
+    return UAVObjGetInstanceData(DebugLogControlHandle(), instId, dataOut);
+}
+static inline int32_t DebugLogControlInstSet(uint16_t instId, const DebugLogControlData * dataIn) {
+    return UAVObjSetInstanceData(DebugLogControlHandle(), instId, dataIn);
+}
+static inline int32_t DebugLogControlConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(DebugLogControlHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t DebugLogControlConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(DebugLogControlHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t DebugLogControlConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(DebugLogControlHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t DebugLogControlCreateInstance() {
+    return UAVObjCreateInstance(DebugLogControlHandle(), &DebugLogControlSetDefaults);
+}
+static inline void DebugLogControlRequestUpdate() {
+    UAVObjRequestUpdate(DebugLogControlHandle());
+}
+static inline void DebugLogControlRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(DebugLogControlHandle(), instId);
+}
+static inline void DebugLogControlUpdated() {
+    UAVObjUpdated(DebugLogControlHandle());
+}
+static inline void DebugLogControlInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(DebugLogControlHandle(), instId);
+}
+static inline void DebugLogControlLogging() {
+    UAVObjLogging(DebugLogControlHandle());
+}
+static inline void DebugLogControlInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(DebugLogControlHandle(), instId);
+}
+static inline int32_t DebugLogControlGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(DebugLogControlHandle(), dataOut);
+}
+static inline int32_t DebugLogControlSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(DebugLogControlHandle(), dataIn);
+}
+static inline int8_t DebugLogControlReadOnly() {
+    return UAVObjReadOnly(DebugLogControlHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void DebugLogControlFlightSet(uint16_t *NewFlight)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewFlight, offsetof(DebugLogControlData, Flight), sizeof(uint16_t));
+}
+static inline void DebugLogControlFlightGet(uint16_t *NewFlight)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewFlight, offsetof(DebugLogControlData, Flight), sizeof(uint16_t));
+}
+static inline void DebugLogControlEntrySet(uint16_t *NewEntry)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewEntry, offsetof(DebugLogControlData, Entry), sizeof(uint16_t));
+}
+static inline void DebugLogControlEntryGet(uint16_t *NewEntry)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewEntry, offsetof(DebugLogControlData, Entry), sizeof(uint16_t));
+}
+static inline void DebugLogControlCountSet(uint16_t *NewCount)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewCount, offsetof(DebugLogControlData, Count), sizeof(uint16_t));
+}
+static inline void DebugLogControlCountGet(uint16_t *NewCount)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewCount, offsetof(DebugLogControlData, Count), sizeof(uint16_t));
+}
+static inline void DebugLogControlOperationSet(DebugLogControlOperationOptions *NewOperation)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewOperation, offsetof(DebugLogControlData, Operation), sizeof(DebugLogControlOperationOptions));
+}
+static inline void DebugLogControlOperationGet(DebugLogControlOperationOptions *NewOperation)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewOperation, offsetof(DebugLogControlData, Operation), sizeof(DebugLogControlOperationOptions));
+}
+static inline void DebugLogControlPeriodSet(uint8_t *NewPeriod)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewPeriod, offsetof(DebugLogControlData, Period), sizeof(uint8_t));
+}
+static inline void DebugLogControlPeriodGet(uint8_t *NewPeriod)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewPeriod, offsetof(DebugLogControlData, Period), sizeof(uint8_t));
+}
+#else
+extern void DebugLogControlFlightSet(uint16_t *NewFlight);
+extern void DebugLogControlFlightGet(uint16_t *NewFlight);
+extern void DebugLogControlEntrySet(uint16_t *NewEntry);
+extern void DebugLogControlEntryGet(uint16_t *NewEntry);
+extern void DebugLogControlCountSet(uint16_t *NewCount);
+extern void DebugLogControlCountGet(uint16_t *NewCount);
+extern void DebugLogControlOperationSet(DebugLogControlOperationOptions *NewOperation);
+extern void DebugLogControlOperationGet(DebugLogControlOperationOptions *NewOperation);
+extern void DebugLogControlPeriodSet(uint8_t *NewPeriod);
+extern void DebugLogControlPeriodGet(uint8_t *NewPeriod);
+#endif
+
+
+#endif // DEBUGLOGCONTROL_H
+
+/**
+ * @}
+ * @}
+ */
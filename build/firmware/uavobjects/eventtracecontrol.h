@@ -0,0 +1,204 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup EventTraceControl EventTraceControl
+ * @brief Event Trace Control Object - Used to run the on board event trace
+ *
+ * Autogenerated files and functions for EventTraceControl Object
+ *
+ * @{
+ *
+ * @file       eventtracecontrol.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTraceControl object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: eventtracecontrol.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACECONTROL_H
+#define EVENTTRACECONTROL_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define EVENTTRACECONTROL_OBJID 0xBB2D9BE0
+#define EVENTTRACECONTROL_ISSINGLEINST 1
+#define EVENTTRACECONTROL_ISSETTINGS 0
+#define EVENTTRACECONTROL_ISPRIORITY 0
+#define EVENTTRACECONTROL_NUMBYTES sizeof(EventTraceControlData)
+
+/* Generic interface functions */
+int32_t EventTraceControlInitialize();
+UAVObjHandle EventTraceControlHandle();
+void EventTraceControlSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Operation information */
+
+// Enumeration options for field Operation
+typedef enum __attribute__ ((__packed__)) {
+    EVENTTRACECONTROL_OPERATION_NONE=0,
+    EVENTTRACECONTROL_OPERATION_START=1,
+    EVENTTRACECONTROL_OPERATION_STOP=2,
+    EVENTTRACECONTROL_OPERATION_DUMP=3,
+    EVENTTRACECONTROL_OPERATION_LOG=4
+} EventTraceControlOperationOptions;
+
+/* Field Mask information */
+
+/* Field Period information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        EventTraceControlOperationOptions Operation;
+    uint8_t Mask;
+    uint8_t Period;
+
+} __attribute__((packed)) EventTraceControlDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef EventTraceControlDataPacked __attribute__((aligned(4))) EventTraceControlData;
+
+/* Typesafe Object access functions */
+#if EVENTTRACECONTROL_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *eventtracecontrol_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t EventTraceControlGet(EventTraceControlData * dataOut) {
+    return UAVObjDirectGet(eventtracecontrol_direct, dataOut, 0, sizeof(EventTraceControlData));
+}
+static inline int32_t EventTraceControlSet(const EventTraceControlData * dataIn) {
+    return UAVObjDirectSet(eventtracecontrol_direct, dataIn, 0, sizeof(EventTraceControlData));
+}
+#else
+extern int32_t EventTraceControlGet(EventTraceControlData * dataOut);
+extern int32_t EventTraceControlSet(const EventTraceControlData * dataIn);
+#endif
+#else
+static inline int32_t EventTraceControlGet(EventTraceControlData * dataOut) {
+    return UAVObjGetData(EventTraceControlHandle(), dataOut);
+}
+static inline int32_t EventTraceControlSet(const EventTraceControlData * dataIn) {
+    return UAVObjSetData(EventTraceControlHandle(), dataIn);
+}
+#endif
+static inline int32_t EventTraceControlInstGet(uint16_t instId, EventTraceControlData * dataOut) {
+    return UAVObjGetInstanceData(EventTraceControlHandle(), instId, dataOut);
+}
+static inline int32_t EventTraceControlInstSet(uint16_t instId, const EventTraceControlData * dataIn) {
+    return UAVObjSetInstanceData(EventTraceControlHandle(), instId, dataIn);
+}
+static inline int32_t EventTraceControlConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(EventTraceControlHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t EventTraceControlConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceControlHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t EventTraceControlConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceControlHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t EventTraceControlCreateInstance() {
+    return UAVObjCreateInstance(EventTraceControlHandle(), &EventTraceControlSetDefaults);
+}
+static inline void EventTraceControlRequestUpdate() {
+    UAVObjRequestUpdate(EventTraceControlHandle());
+}
+static inline void EventTraceControlRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(EventTraceControlHandle(), instId);
+}
+static inline void EventTraceControlUpdated() {
+    UAVObjUpdated(EventTraceControlHandle());
+}
+static inline void EventTraceControlInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(EventTraceControlHandle(), instId);
+}
+static inline void EventTraceControlLogging() {
+    UAVObjLogging(EventTraceControlHandle());
+}
+static inline void EventTraceControlInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(EventTraceControlHandle(), instId);
+}
+static inline int32_t EventTraceControlGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(EventTraceControlHandle(), dataOut);
+}
+static inline int32_t EventTraceControlSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(EventTraceControlHandle(), dataIn);
+}
+static inline int8_t EventTraceControlReadOnly() {
+    return UAVObjReadOnly(EventTraceControlHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void EventTraceControlOperationSet(EventTraceControlOperationOptions *NewOperation)
+{
+    UAVObjDirectSet(eventtracecontrol_direct, (void *)NewOperation, offsetof(EventTraceControlData, Operation), sizeof(EventTraceControlOperationOptions));
+}
+static inline void EventTraceControlOperationGet(EventTraceControlOperationOptions *NewOperation)
+{
+    UAVObjDirectGet(eventtracecontrol_direct, (void *)NewOperation, offsetof(EventTraceControlData, Operation), sizeof(EventTraceControlOperationOptions));
+}
+static inline void EventTraceControlMaskSet(uint8_t *NewMask)
+{
+    UAVObjDirectSet(eventtracecontrol_direct, (void *)NewMask, offsetof(EventTraceControlData, Mask), sizeof(uint8_t));
+}
+static inline void EventTraceControlMaskGet(uint8_t *NewMask)
+{
+    UAVObjDirectGet(eventtracecontrol_direct, (void *)NewMask, offsetof(EventTraceControlData, Mask), sizeof(uint8_t));
+}
+static inline void EventTraceControlPeriodSet(uint8_t *NewPeriod)
+{
+    UAVObjDirectSet(eventtracecontrol_direct, (void *)NewPeriod, offsetof(EventTraceControlData, Period), sizeof(uint8_t));
+}
+static inline void EventTraceControlPeriodGet(uint8_t *NewPeriod)
+{
+    UAVObjDirectGet(eventtracecontrol_direct, (void *)NewPeriod, offsetof(EventTraceControlData, Period), sizeof(uint8_t));
+}
+#else
+extern void EventTraceControlOperationSet(EventTraceControlOperationOptions *NewOperation);
+extern void EventTraceControlOperationGet(EventTraceControlOperationOptions *NewOperation);
+extern void EventTraceControlMaskSet(uint8_t *NewMask);
+extern void EventTraceControlMaskGet(uint8_t *NewMask);
+extern void EventTraceControlPeriodSet(uint8_t *NewPeriod);
+extern void EventTraceControlPeriodGet(uint8_t *NewPeriod);
+#endif
+
+
+#endif // EVENTTRACECONTROL_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup EventTraceData EventTraceData
+ * @brief Chunk of the on board event trace, see EventTraceControl
+ *
+ * Autogenerated files and functions for EventTraceData Object
+ * @{ 
+ *
+ * @file       eventtracedata.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTraceData object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: eventtracedata.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "eventtracedata.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if EVENTTRACEDATA_ISSINGLEINST
+UAVObjDirect *eventtracedata_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t EventTraceDataInitialize(void)
+{
+    // Compile time assertion that the EventTraceDataDataPacked and EventTraceDataData structs
+    // have the same size (though instances of EventTraceDataData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(EventTraceDataDataPacked) == sizeof(EventTraceDataData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(EVENTTRACEDATA_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(EVENTTRACEDATA_OBJID,
+        EVENTTRACEDATA_ISSINGLEINST, EVENTTRACEDATA_ISSETTINGS, EVENTTRACEDATA_ISPRIORITY, EVENTTRACEDATA_NUMBYTES, &EventTraceDataSetDefaults);
+#if EVENTTRACEDATA_ISSINGLEINST
+    eventtracedata_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void EventTraceDataSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    EventTraceDataData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(EventTraceDataData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle EventTraceDataHandle()
+{
+    return handle;
+}
+
+#if EVENTTRACEDATA_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t EventTraceDataGet(EventTraceDataData *dataOut)
+{
+    return UAVObjDirectGet(eventtracedata_direct, dataOut, 0, sizeof(EventTraceDataData));
+}
+
+int32_t EventTraceDataSet(const EventTraceDataData *dataIn)
+{
+    return UAVObjDirectSet(eventtracedata_direct, dataIn, 0, sizeof(EventTraceDataData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void EventTraceDataChunkSet(uint16_t *NewChunk)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewChunk, offsetof(EventTraceDataData, Chunk), sizeof(uint16_t));
+}
+void EventTraceDataChunkGet(uint16_t *NewChunk)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewChunk, offsetof(EventTraceDataData, Chunk), sizeof(uint16_t));
+}
+void EventTraceDataChunksSet(uint16_t *NewChunks)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewChunks, offsetof(EventTraceDataData, Chunks), sizeof(uint16_t));
+}
+void EventTraceDataChunksGet(uint16_t *NewChunks)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewChunks, offsetof(EventTraceDataData, Chunks), sizeof(uint16_t));
+}
+void EventTraceDataSizeSet(uint8_t *NewSize)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewSize, offsetof(EventTraceDataData, Size), sizeof(uint8_t));
+}
+void EventTraceDataSizeGet(uint8_t *NewSize)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewSize, offsetof(EventTraceDataData, Size), sizeof(uint8_t));
+}
+void EventTraceDataDataSet(uint8_t *NewData)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewData, offsetof(EventTraceDataData, Data), 200*sizeof(uint8_t));
+}
+void EventTraceDataDataGet(uint8_t *NewData)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewData, offsetof(EventTraceDataData, Data), 200*sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
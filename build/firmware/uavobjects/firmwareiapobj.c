@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FirmwareIAPObj FirmwareIAPObj
+ * @brief Queries board for SN, model, revision, and sends reset command
+ *
+ * Autogenerated files and functions for FirmwareIAPObj Object
+ * @{ 
+ *
+ * @file       firmwareiapobj.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FirmwareIAPObj object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: firmwareiapobj.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "firmwareiapobj.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if FIRMWAREIAPOBJ_ISSINGLEINST
+UAVObjDirect *firmwareiapobj_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FirmwareIAPObjInitialize(void)
+{
+    // Compile time assertion that the FirmwareIAPObjDataPacked and FirmwareIAPObjData structs
+    // have the same size (though instances of FirmwareIAPObjData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FirmwareIAPObjDataPacked) == sizeof(FirmwareIAPObjData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FIRMWAREIAPOBJ_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(FIRMWAREIAPOBJ_OBJID,
+        FIRMWAREIAPOBJ_ISSINGLEINST, FIRMWAREIAPOBJ_ISSETTINGS, FIRMWAREIAPOBJ_ISPRIORITY, FIRMWAREIAPOBJ_NUMBYTES, &FirmwareIAPObjSetDefaults);
+#if FIRMWAREIAPOBJ_ISSINGLEINST
+    firmwareiapobj_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FirmwareIAPObjSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FirmwareIAPObjData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FirmwareIAPObjData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FirmwareIAPObjHandle()
+{
+    return handle;
+}
+
+#if FIRMWAREIAPOBJ_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t FirmwareIAPObjGet(FirmwareIAPObjData *dataOut)
+{
+    return UAVObjDirectGet(firmwareiapobj_direct, dataOut, 0, sizeof(FirmwareIAPObjData));
+}
+
+int32_t FirmwareIAPObjSet(const FirmwareIAPObjData *dataIn)
+{
+    return UAVObjDirectSet(firmwareiapobj_direct, dataIn, 0, sizeof(FirmwareIAPObjData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void FirmwareIAPObjcrcSet(uint32_t *Newcrc)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)Newcrc, offsetof(FirmwareIAPObjData, crc), sizeof(uint32_t));
+}
+void FirmwareIAPObjcrcGet(uint32_t *Newcrc)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)Newcrc, offsetof(FirmwareIAPObjData, crc), sizeof(uint32_t));
+}
+void FirmwareIAPObjCommandSet(uint16_t *NewCommand)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewCommand, offsetof(FirmwareIAPObjData, Command), sizeof(uint16_t));
+}
+void FirmwareIAPObjCommandGet(uint16_t *NewCommand)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewCommand, offsetof(FirmwareIAPObjData, Command), sizeof(uint16_t));
+}
+void FirmwareIAPObjBoardRevisionSet(uint16_t *NewBoardRevision)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewBoardRevision, offsetof(FirmwareIAPObjData, BoardRevision), sizeof(uint16_t));
+}
+void FirmwareIAPObjBoardRevisionGet(uint16_t *NewBoardRevision)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewBoardRevision, offsetof(FirmwareIAPObjData, BoardRevision), sizeof(uint16_t));
+}
+void FirmwareIAPObjDescriptionSet(uint8_t *NewDescription)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewDescription, offsetof(FirmwareIAPObjData, Description), 100*sizeof(uint8_t));
+}
+void FirmwareIAPObjDescriptionGet(uint8_t *NewDescription)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewDescription, offsetof(FirmwareIAPObjData, Description), 100*sizeof(uint8_t));
+}
+void FirmwareIAPObjCPUSerialSet(uint8_t *NewCPUSerial)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewCPUSerial, offsetof(FirmwareIAPObjData, CPUSerial), 12*sizeof(uint8_t));
+}
+void FirmwareIAPObjCPUSerialGet(uint8_t *NewCPUSerial)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewCPUSerial, offsetof(FirmwareIAPObjData, CPUSerial), 12*sizeof(uint8_t));
+}
+void FirmwareIAPObjBoardTypeSet(uint8_t *NewBoardType)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewBoardType, offsetof(FirmwareIAPObjData, BoardType), sizeof(uint8_t));
+}
+void FirmwareIAPObjBoardTypeGet(uint8_t *NewBoardType)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewBoardType, offsetof(FirmwareIAPObjData, BoardType), sizeof(uint8_t));
+}
+void FirmwareIAPObjBootloaderRevisionSet(uint8_t *NewBootloaderRevision)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewBootloaderRevision, offsetof(FirmwareIAPObjData, BootloaderRevision), sizeof(uint8_t));
+}
+void FirmwareIAPObjBootloaderRevisionGet(uint8_t *NewBootloaderRevision)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewBootloaderRevision, offsetof(FirmwareIAPObjData, BootloaderRevision), sizeof(uint8_t));
+}
+void FirmwareIAPObjArmResetSet(uint8_t *NewArmReset)
+{
+    UAVObjDirectSet(firmwareiapobj_direct, (void *)NewArmReset, offsetof(FirmwareIAPObjData, ArmReset), sizeof(uint8_t));
+}
+void FirmwareIAPObjArmResetGet(uint8_t *NewArmReset)
+{
+    UAVObjDirectGet(firmwareiapobj_direct, (void *)NewArmReset, offsetof(FirmwareIAPObjData, ArmReset), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
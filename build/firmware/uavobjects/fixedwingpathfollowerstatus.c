@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FixedWingPathFollowerStatus FixedWingPathFollowerStatus
+ * @brief Object Storing Debugging Information on PID internals
+ *
+ * Autogenerated files and functions for FixedWingPathFollowerStatus Object
+ * @{ 
+ *
+ * @file       fixedwingpathfollowerstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FixedWingPathFollowerStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: fixedwingpathfollowerstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "fixedwingpathfollowerstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if FIXEDWINGPATHFOLLOWERSTATUS_ISSINGLEINST
+UAVObjDirect *fixedwingpathfollowerstatus_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FixedWingPathFollowerStatusInitialize(void)
+{
+    // Compile time assertion that the FixedWingPathFollowerStatusDataPacked and FixedWingPathFollowerStatusData structs
+    // have the same size (though instances of FixedWingPathFollowerStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FixedWingPathFollowerStatusDataPacked) == sizeof(FixedWingPathFollowerStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FIXEDWINGPATHFOLLOWERSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(FIXEDWINGPATHFOLLOWERSTATUS_OBJID,
+        FIXEDWINGPATHFOLLOWERSTATUS_ISSINGLEINST, FIXEDWINGPATHFOLLOWERSTATUS_ISSETTINGS, FIXEDWINGPATHFOLLOWERSTATUS_ISPRIORITY, FIXEDWINGPATHFOLLOWERSTATUS_NUMBYTES, &FixedWingPathFollowerStatusSetDefaults);
+#if FIXEDWINGPATHFOLLOWERSTATUS_ISSINGLEINST
+    fixedwingpathfollowerstatus_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FixedWingPathFollowerStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FixedWingPathFollowerStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FixedWingPathFollowerStatusData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 500;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FixedWingPathFollowerStatusHandle()
+{
+    return handle;
+}
+
+#if FIXEDWINGPATHFOLLOWERSTATUS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t FixedWingPathFollowerStatusGet(FixedWingPathFollowerStatusData *dataOut)
+{
+    return UAVObjDirectGet(fixedwingpathfollowerstatus_direct, dataOut, 0, sizeof(FixedWingPathFollowerStatusData));
+}
+
+int32_t FixedWingPathFollowerStatusSet(const FixedWingPathFollowerStatusData *dataIn)
+{
+    return UAVObjDirectSet(fixedwingpathfollowerstatus_direct, dataIn, 0, sizeof(FixedWingPathFollowerStatusData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void FixedWingPathFollowerStatusErrorSet(FixedWingPathFollowerStatusErrorData *NewError)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewError, offsetof(FixedWingPathFollowerStatusData, Error), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorGet(FixedWingPathFollowerStatusErrorData *NewError)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewError, offsetof(FixedWingPathFollowerStatusData, Error), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorArraySet(float *NewError)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewError, offsetof(FixedWingPathFollowerStatusData, Error), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorArrayGet(float *NewError)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewError, offsetof(FixedWingPathFollowerStatusData, Error), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorIntSet(FixedWingPathFollowerStatusErrorIntData *NewErrorInt)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewErrorInt, offsetof(FixedWingPathFollowerStatusData, ErrorInt), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorIntGet(FixedWingPathFollowerStatusErrorIntData *NewErrorInt)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewErrorInt, offsetof(FixedWingPathFollowerStatusData, ErrorInt), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorIntArraySet(float *NewErrorInt)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewErrorInt, offsetof(FixedWingPathFollowerStatusData, ErrorInt), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorIntArrayGet(float *NewErrorInt)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewErrorInt, offsetof(FixedWingPathFollowerStatusData, ErrorInt), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusCommandSet(FixedWingPathFollowerStatusCommandData *NewCommand)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewCommand, offsetof(FixedWingPathFollowerStatusData, Command), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusCommandGet(FixedWingPathFollowerStatusCommandData *NewCommand)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewCommand, offsetof(FixedWingPathFollowerStatusData, Command), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusCommandArraySet(float *NewCommand)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewCommand, offsetof(FixedWingPathFollowerStatusData, Command), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusCommandArrayGet(float *NewCommand)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewCommand, offsetof(FixedWingPathFollowerStatusData, Command), 3*sizeof(float));
+}
+void FixedWingPathFollowerStatusErrorsSet(FixedWingPathFollowerStatusErrorsData *NewErrors)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewErrors, offsetof(FixedWingPathFollowerStatusData, Errors), 10*sizeof(uint8_t));
+}
+void FixedWingPathFollowerStatusErrorsGet(FixedWingPathFollowerStatusErrorsData *NewErrors)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewErrors, offsetof(FixedWingPathFollowerStatusData, Errors), 10*sizeof(uint8_t));
+}
+void FixedWingPathFollowerStatusErrorsArraySet(uint8_t *NewErrors)
+{
+    UAVObjDirectSet(fixedwingpathfollowerstatus_direct, (void *)NewErrors, offsetof(FixedWingPathFollowerStatusData, Errors), 10*sizeof(uint8_t));
+}
+void FixedWingPathFollowerStatusErrorsArrayGet(uint8_t *NewErrors)
+{
+    UAVObjDirectGet(fixedwingpathfollowerstatus_direct, (void *)NewErrors, offsetof(FixedWingPathFollowerStatusData, Errors), 10*sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
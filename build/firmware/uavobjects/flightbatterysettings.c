@@ -0,0 +1,219 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FlightBatterySettings FlightBatterySettings
+ * @brief Flight Battery configuration.
+ *
+ * Autogenerated files and functions for FlightBatterySettings Object
+ * @{ 
+ *
+ * @file       flightbatterysettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightBatterySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flightbatterysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "flightbatterysettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if FLIGHTBATTERYSETTINGS_ISSINGLEINST
+UAVObjDirect *flightbatterysettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightBatterySettingsInitialize(void)
+{
+    // Compile time assertion that the FlightBatterySettingsDataPacked and FlightBatterySettingsData structs
+    // have the same size (though instances of FlightBatterySettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FlightBatterySettingsDataPacked) == sizeof(FlightBatterySettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FLIGHTBATTERYSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(FLIGHTBATTERYSETTINGS_OBJID,
+        FLIGHTBATTERYSETTINGS_ISSINGLEINST, FLIGHTBATTERYSETTINGS_ISSETTINGS, FLIGHTBATTERYSETTINGS_ISPRIORITY, FLIGHTBATTERYSETTINGS_NUMBYTES, &FlightBatterySettingsSetDefaults);
+#if FLIGHTBATTERYSETTINGS_ISSINGLEINST
+    flightbatterysettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightBatterySettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FlightBatterySettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FlightBatterySettingsData));
+    data.Capacity = 2200;
+    data.CellVoltageThresholds.Warning = 3.400000e+00f;
+    data.CellVoltageThresholds.Alarm = 3.100000e+00f;
+    data.SensorCalibrations.VoltageFactor = 1.000000e+00f;
+    data.SensorCalibrations.CurrentFactor = 1.000000e+00f;
+    data.SensorCalibrations.VoltageZero = 0.000000e+00f;
+    data.SensorCalibrations.CurrentZero = 0.000000e+00f;
+    data.Type = 0;
+    data.NbCells = 0;
+    data.ResetConsumedEnergy = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightBatterySettingsHandle()
+{
+    return handle;
+}
+
+#if FLIGHTBATTERYSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t FlightBatterySettingsGet(FlightBatterySettingsData *dataOut)
+{
+    return UAVObjDirectGet(flightbatterysettings_direct, dataOut, 0, sizeof(FlightBatterySettingsData));
+}
+
+int32_t FlightBatterySettingsSet(const FlightBatterySettingsData *dataIn)
+{
+    return UAVObjDirectSet(flightbatterysettings_direct, dataIn, 0, sizeof(FlightBatterySettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void FlightBatterySettingsCapacitySet(uint32_t *NewCapacity)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewCapacity, offsetof(FlightBatterySettingsData, Capacity), sizeof(uint32_t));
+}
+void FlightBatterySettingsCapacityGet(uint32_t *NewCapacity)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewCapacity, offsetof(FlightBatterySettingsData, Capacity), sizeof(uint32_t));
+}
+void FlightBatterySettingsCellVoltageThresholdsSet(FlightBatterySettingsCellVoltageThresholdsData *NewCellVoltageThresholds)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsGet(FlightBatterySettingsCellVoltageThresholdsData *NewCellVoltageThresholds)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsArraySet(float *NewCellVoltageThresholds)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsArrayGet(float *NewCellVoltageThresholds)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewCellVoltageThresholds, offsetof(FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsSet(FlightBatterySettingsSensorCalibrationsData *NewSensorCalibrations)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsGet(FlightBatterySettingsSensorCalibrationsData *NewSensorCalibrations)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsArraySet(float *NewSensorCalibrations)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationsArrayGet(float *NewSensorCalibrations)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewSensorCalibrations, offsetof(FlightBatterySettingsData, SensorCalibrations), 4*sizeof(float));
+}
+void FlightBatterySettingsTypeSet(FlightBatterySettingsTypeOptions *NewType)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewType, offsetof(FlightBatterySettingsData, Type), sizeof(FlightBatterySettingsTypeOptions));
+}
+void FlightBatterySettingsTypeGet(FlightBatterySettingsTypeOptions *NewType)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewType, offsetof(FlightBatterySettingsData, Type), sizeof(FlightBatterySettingsTypeOptions));
+}
+void FlightBatterySettingsNbCellsSet(uint8_t *NewNbCells)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewNbCells, offsetof(FlightBatterySettingsData, NbCells), sizeof(uint8_t));
+}
+void FlightBatterySettingsNbCellsGet(uint8_t *NewNbCells)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewNbCells, offsetof(FlightBatterySettingsData, NbCells), sizeof(uint8_t));
+}
+void FlightBatterySettingsResetConsumedEnergySet(FlightBatterySettingsResetConsumedEnergyOptions *NewResetConsumedEnergy)
+{
+    UAVObjDirectSet(flightbatterysettings_direct, (void *)NewResetConsumedEnergy, offsetof(FlightBatterySettingsData, ResetConsumedEnergy), sizeof(FlightBatterySettingsResetConsumedEnergyOptions));
+}
+void FlightBatterySettingsResetConsumedEnergyGet(FlightBatterySettingsResetConsumedEnergyOptions *NewResetConsumedEnergy)
+{
+    UAVObjDirectGet(flightbatterysettings_direct, (void *)NewResetConsumedEnergy, offsetof(FlightBatterySettingsData, ResetConsumedEnergy), sizeof(FlightBatterySettingsResetConsumedEnergyOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,423 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FlightModeSettings FlightModeSettings
+ * @brief Settings to control arming and flight mode
+ *
+ * Autogenerated files and functions for FlightModeSettings Object
+ * @{ 
+ *
+ * @file       flightmodesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightModeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flightmodesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "flightmodesettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if FLIGHTMODESETTINGS_ISSINGLEINST
+UAVObjDirect *flightmodesettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightModeSettingsInitialize(void)
+{
+    // Compile time assertion that the FlightModeSettingsDataPacked and FlightModeSettingsData structs
+    // have the same size (though instances of FlightModeSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FlightModeSettingsDataPacked) == sizeof(FlightModeSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FLIGHTMODESETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(FLIGHTMODESETTINGS_OBJID,
+        FLIGHTMODESETTINGS_ISSINGLEINST, FLIGHTMODESETTINGS_ISSETTINGS, FLIGHTMODESETTINGS_ISPRIORITY, FLIGHTMODESETTINGS_NUMBYTES, &FlightModeSettingsSetDefaults);
+#if FLIGHTMODESETTINGS_ISSINGLEINST
+    flightmodesettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightModeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FlightModeSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FlightModeSettingsData));
+    data.ReturnToBaseAltitudeOffset = 1.000000e+01f;
+    data.ReturnToBaseVelocity = 2.000000e+00f;
+    data.LandingVelocity = 6.000000e-01f;
+    data.AutoTakeOffVelocity = 6.000000e-01f;
+    data.AutoTakeOffHeight = 2.500000e+00f;
+    data.PositionHoldOffset.Horizontal = 3.000000e+01f;
+    data.PositionHoldOffset.Vertical = 1.500000e+01f;
+    data.VarioControlLowPassAlpha = 9.800000e-01f;
+    data.ArmedTimeout = 30000;
+    data.ArmingSequenceTime = 1000;
+    data.DisarmingSequenceTime = 1000;
+    data.Arming = 0;
+    data.Stabilization1Settings.Roll = 3;
+    data.Stabilization1Settings.Pitch = 3;
+    data.Stabilization1Settings.Yaw = 4;
+    data.Stabilization1Settings.Thrust = 0;
+    data.Stabilization2Settings.Roll = 3;
+    data.Stabilization2Settings.Pitch = 3;
+    data.Stabilization2Settings.Yaw = 1;
+    data.Stabilization2Settings.Thrust = 0;
+    data.Stabilization3Settings.Roll = 1;
+    data.Stabilization3Settings.Pitch = 1;
+    data.Stabilization3Settings.Yaw = 1;
+    data.Stabilization3Settings.Thrust = 0;
+    data.Stabilization4Settings.Roll = 3;
+    data.Stabilization4Settings.Pitch = 3;
+    data.Stabilization4Settings.Yaw = 4;
+    data.Stabilization4Settings.Thrust = 11;
+    data.Stabilization5Settings.Roll = 3;
+    data.Stabilization5Settings.Pitch = 3;
+    data.Stabilization5Settings.Yaw = 1;
+    data.Stabilization5Settings.Thrust = 11;
+    data.Stabilization6Settings.Roll = 1;
+    data.Stabilization6Settings.Pitch = 1;
+    data.Stabilization6Settings.Yaw = 1;
+    data.Stabilization6Settings.Thrust = 0;
+    data.FlightModePosition[0] = 1;
+    data.FlightModePosition[1] = 2;
+    data.FlightModePosition[2] = 3;
+    data.FlightModePosition[3] = 4;
+    data.FlightModePosition[4] = 5;
+    data.FlightModePosition[5] = 6;
+    data.AlwaysStabilizeWhenArmedSwitch = 0;
+    data.DisableSanityChecks = 0;
+    data.ReturnToBaseNextCommand = 0;
+    data.FlightModeChangeRestartsPathPlan = 1;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightModeSettingsHandle()
+{
+    return handle;
+}
+
+#if FLIGHTMODESETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t FlightModeSettingsGet(FlightModeSettingsData *dataOut)
+{
+    return UAVObjDirectGet(flightmodesettings_direct, dataOut, 0, sizeof(FlightModeSettingsData));
+}
+
+int32_t FlightModeSettingsSet(const FlightModeSettingsData *dataIn)
+{
+    return UAVObjDirectSet(flightmodesettings_direct, dataIn, 0, sizeof(FlightModeSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void FlightModeSettingsReturnToBaseAltitudeOffsetSet(float *NewReturnToBaseAltitudeOffset)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewReturnToBaseAltitudeOffset, offsetof(FlightModeSettingsData, ReturnToBaseAltitudeOffset), sizeof(float));
+}
+void FlightModeSettingsReturnToBaseAltitudeOffsetGet(float *NewReturnToBaseAltitudeOffset)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewReturnToBaseAltitudeOffset, offsetof(FlightModeSettingsData, ReturnToBaseAltitudeOffset), sizeof(float));
+}
+void FlightModeSettingsReturnToBaseVelocitySet(float *NewReturnToBaseVelocity)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewReturnToBaseVelocity, offsetof(FlightModeSettingsData, ReturnToBaseVelocity), sizeof(float));
+}
+void FlightModeSettingsReturnToBaseVelocityGet(float *NewReturnToBaseVelocity)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewReturnToBaseVelocity, offsetof(FlightModeSettingsData, ReturnToBaseVelocity), sizeof(float));
+}
+void FlightModeSettingsLandingVelocitySet(float *NewLandingVelocity)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewLandingVelocity, offsetof(FlightModeSettingsData, LandingVelocity), sizeof(float));
+}
+void FlightModeSettingsLandingVelocityGet(float *NewLandingVelocity)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewLandingVelocity, offsetof(FlightModeSettingsData, LandingVelocity), sizeof(float));
+}
+void FlightModeSettingsAutoTakeOffVelocitySet(float *NewAutoTakeOffVelocity)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewAutoTakeOffVelocity, offsetof(FlightModeSettingsData, AutoTakeOffVelocity), sizeof(float));
+}
+void FlightModeSettingsAutoTakeOffVelocityGet(float *NewAutoTakeOffVelocity)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewAutoTakeOffVelocity, offsetof(FlightModeSettingsData, AutoTakeOffVelocity), sizeof(float));
+}
+void FlightModeSettingsAutoTakeOffHeightSet(float *NewAutoTakeOffHeight)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewAutoTakeOffHeight, offsetof(FlightModeSettingsData, AutoTakeOffHeight), sizeof(float));
+}
+void FlightModeSettingsAutoTakeOffHeightGet(float *NewAutoTakeOffHeight)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewAutoTakeOffHeight, offsetof(FlightModeSettingsData, AutoTakeOffHeight), sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetSet(FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetGet(FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetArraySet(float *NewPositionHoldOffset)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetArrayGet(float *NewPositionHoldOffset)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsVarioControlLowPassAlphaSet(float *NewVarioControlLowPassAlpha)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewVarioControlLowPassAlpha, offsetof(FlightModeSettingsData, VarioControlLowPassAlpha), sizeof(float));
+}
+void FlightModeSettingsVarioControlLowPassAlphaGet(float *NewVarioControlLowPassAlpha)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewVarioControlLowPassAlpha, offsetof(FlightModeSettingsData, VarioControlLowPassAlpha), sizeof(float));
+}
+void FlightModeSettingsArmedTimeoutSet(uint16_t *NewArmedTimeout)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewArmedTimeout, offsetof(FlightModeSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+void FlightModeSettingsArmedTimeoutGet(uint16_t *NewArmedTimeout)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewArmedTimeout, offsetof(FlightModeSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+void FlightModeSettingsArmingSequenceTimeSet(uint16_t *NewArmingSequenceTime)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewArmingSequenceTime, offsetof(FlightModeSettingsData, ArmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsArmingSequenceTimeGet(uint16_t *NewArmingSequenceTime)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewArmingSequenceTime, offsetof(FlightModeSettingsData, ArmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsDisarmingSequenceTimeSet(uint16_t *NewDisarmingSequenceTime)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewDisarmingSequenceTime, offsetof(FlightModeSettingsData, DisarmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsDisarmingSequenceTimeGet(uint16_t *NewDisarmingSequenceTime)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewDisarmingSequenceTime, offsetof(FlightModeSettingsData, DisarmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsArmingSet(FlightModeSettingsArmingOptions *NewArming)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewArming, offsetof(FlightModeSettingsData, Arming), sizeof(FlightModeSettingsArmingOptions));
+}
+void FlightModeSettingsArmingGet(FlightModeSettingsArmingOptions *NewArming)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewArming, offsetof(FlightModeSettingsData, Arming), sizeof(FlightModeSettingsArmingOptions));
+}
+void FlightModeSettingsStabilization1SettingsSet(FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+void FlightModeSettingsStabilization1SettingsGet(FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+void FlightModeSettingsStabilization1SettingsArraySet(FlightModeSettingsStabilization1SettingsOptions *NewStabilization1Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+void FlightModeSettingsStabilization1SettingsArrayGet(FlightModeSettingsStabilization1SettingsOptions *NewStabilization1Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+void FlightModeSettingsStabilization2SettingsSet(FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+void FlightModeSettingsStabilization2SettingsGet(FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+void FlightModeSettingsStabilization2SettingsArraySet(FlightModeSettingsStabilization2SettingsOptions *NewStabilization2Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+void FlightModeSettingsStabilization2SettingsArrayGet(FlightModeSettingsStabilization2SettingsOptions *NewStabilization2Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+void FlightModeSettingsStabilization3SettingsSet(FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+void FlightModeSettingsStabilization3SettingsGet(FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+void FlightModeSettingsStabilization3SettingsArraySet(FlightModeSettingsStabilization3SettingsOptions *NewStabilization3Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+void FlightModeSettingsStabilization3SettingsArrayGet(FlightModeSettingsStabilization3SettingsOptions *NewStabilization3Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+void FlightModeSettingsStabilization4SettingsSet(FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+void FlightModeSettingsStabilization4SettingsGet(FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+void FlightModeSettingsStabilization4SettingsArraySet(FlightModeSettingsStabilization4SettingsOptions *NewStabilization4Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+void FlightModeSettingsStabilization4SettingsArrayGet(FlightModeSettingsStabilization4SettingsOptions *NewStabilization4Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+void FlightModeSettingsStabilization5SettingsSet(FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+void FlightModeSettingsStabilization5SettingsGet(FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+void FlightModeSettingsStabilization5SettingsArraySet(FlightModeSettingsStabilization5SettingsOptions *NewStabilization5Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+void FlightModeSettingsStabilization5SettingsArrayGet(FlightModeSettingsStabilization5SettingsOptions *NewStabilization5Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+void FlightModeSettingsStabilization6SettingsSet(FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+void FlightModeSettingsStabilization6SettingsGet(FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+void FlightModeSettingsStabilization6SettingsArraySet(FlightModeSettingsStabilization6SettingsOptions *NewStabilization6Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+void FlightModeSettingsStabilization6SettingsArrayGet(FlightModeSettingsStabilization6SettingsOptions *NewStabilization6Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+void FlightModeSettingsFlightModePositionSet(FlightModeSettingsFlightModePositionOptions *NewFlightModePosition)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewFlightModePosition, offsetof(FlightModeSettingsData, FlightModePosition), 6*sizeof(FlightModeSettingsFlightModePositionOptions));
+}
+void FlightModeSettingsFlightModePositionGet(FlightModeSettingsFlightModePositionOptions *NewFlightModePosition)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewFlightModePosition, offsetof(FlightModeSettingsData, FlightModePosition), 6*sizeof(FlightModeSettingsFlightModePositionOptions));
+}
+void FlightModeSettingsAlwaysStabilizeWhenArmedSwitchSet(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions *NewAlwaysStabilizeWhenArmedSwitch)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewAlwaysStabilizeWhenArmedSwitch, offsetof(FlightModeSettingsData, AlwaysStabilizeWhenArmedSwitch), sizeof(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions));
+}
+void FlightModeSettingsAlwaysStabilizeWhenArmedSwitchGet(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions *NewAlwaysStabilizeWhenArmedSwitch)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewAlwaysStabilizeWhenArmedSwitch, offsetof(FlightModeSettingsData, AlwaysStabilizeWhenArmedSwitch), sizeof(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions));
+}
+void FlightModeSettingsDisableSanityChecksSet(FlightModeSettingsDisableSanityChecksOptions *NewDisableSanityChecks)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewDisableSanityChecks, offsetof(FlightModeSettingsData, DisableSanityChecks), sizeof(FlightModeSettingsDisableSanityChecksOptions));
+}
+void FlightModeSettingsDisableSanityChecksGet(FlightModeSettingsDisableSanityChecksOptions *NewDisableSanityChecks)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewDisableSanityChecks, offsetof(FlightModeSettingsData, DisableSanityChecks), sizeof(FlightModeSettingsDisableSanityChecksOptions));
+}
+void FlightModeSettingsReturnToBaseNextCommandSet(FlightModeSettingsReturnToBaseNextCommandOptions *NewReturnToBaseNextCommand)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewReturnToBaseNextCommand, offsetof(FlightModeSettingsData, ReturnToBaseNextCommand), sizeof(FlightModeSettingsReturnToBaseNextCommandOptions));
+}
+void FlightModeSettingsReturnToBaseNextCommandGet(FlightModeSettingsReturnToBaseNextCommandOptions *NewReturnToBaseNextCommand)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewReturnToBaseNextCommand, offsetof(FlightModeSettingsData, ReturnToBaseNextCommand), sizeof(FlightModeSettingsReturnToBaseNextCommandOptions));
+}
+void FlightModeSettingsFlightModeChangeRestartsPathPlanSet(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions *NewFlightModeChangeRestartsPathPlan)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewFlightModeChangeRestartsPathPlan, offsetof(FlightModeSettingsData, FlightModeChangeRestartsPathPlan), sizeof(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions));
+}
+void FlightModeSettingsFlightModeChangeRestartsPathPlanGet(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions *NewFlightModeChangeRestartsPathPlan)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewFlightModeChangeRestartsPathPlan, offsetof(FlightModeSettingsData, FlightModeChangeRestartsPathPlan), sizeof(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
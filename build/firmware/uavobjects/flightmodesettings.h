@@ -0,0 +1,833 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup FlightModeSettings FlightModeSettings
+ * @brief Settings to control arming and flight mode
+ *
+ * Autogenerated files and functions for FlightModeSettings Object
+ *
+ * @{
+ *
+ * @file       flightmodesettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightModeSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: flightmodesettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTMODESETTINGS_H
+#define FLIGHTMODESETTINGS_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define FLIGHTMODESETTINGS_OBJID 0xDD935B0E
+#define FLIGHTMODESETTINGS_ISSINGLEINST 1
+#define FLIGHTMODESETTINGS_ISSETTINGS 1
+#define FLIGHTMODESETTINGS_ISPRIORITY 0
+#define FLIGHTMODESETTINGS_NUMBYTES sizeof(FlightModeSettingsData)
+
+/* Generic interface functions */
+int32_t FlightModeSettingsInitialize();
+UAVObjHandle FlightModeSettingsHandle();
+void FlightModeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field ReturnToBaseAltitudeOffset information */
+
+/* Field ReturnToBaseVelocity information */
+
+/* Field LandingVelocity information */
+
+/* Field AutoTakeOffVelocity information */
+
+/* Field AutoTakeOffHeight information */
+
+/* Field PositionHoldOffset information */
+
+// Array element names for field PositionHoldOffset
+typedef enum {
+    FLIGHTMODESETTINGS_POSITIONHOLDOFFSET_HORIZONTAL=0,
+    FLIGHTMODESETTINGS_POSITIONHOLDOFFSET_VERTICAL=1
+} FlightModeSettingsPositionHoldOffsetElem;
+
+// Number of elements for field PositionHoldOffset
+#define FLIGHTMODESETTINGS_POSITIONHOLDOFFSET_NUMELEM 2
+
+/* Field VarioControlLowPassAlpha information */
+
+/* Field ArmedTimeout information */
+
+/* Field ArmingSequenceTime information */
+
+/* Field DisarmingSequenceTime information */
+
+/* Field Arming information */
+
+// Enumeration options for field Arming
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_ARMING_ALWAYSDISARMED=0,
+    FLIGHTMODESETTINGS_ARMING_ALWAYSARMED=1,
+    FLIGHTMODESETTINGS_ARMING_ROLLLEFT=2,
+    FLIGHTMODESETTINGS_ARMING_ROLLRIGHT=3,
+    FLIGHTMODESETTINGS_ARMING_PITCHFORWARD=4,
+    FLIGHTMODESETTINGS_ARMING_PITCHAFT=5,
+    FLIGHTMODESETTINGS_ARMING_YAWLEFT=6,
+    FLIGHTMODESETTINGS_ARMING_YAWRIGHT=7,
+    FLIGHTMODESETTINGS_ARMING_ACCESSORY0=8,
+    FLIGHTMODESETTINGS_ARMING_ACCESSORY1=9,
+    FLIGHTMODESETTINGS_ARMING_ACCESSORY2=10,
+    FLIGHTMODESETTINGS_ARMING_ACCESSORY3=11
+} FlightModeSettingsArmingOptions;
+
+/* Field Stabilization1Settings information */
+
+// Enumeration options for field Stabilization1Settings
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_MANUAL=0,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_RATE=1,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_RATETRAINER=2,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_ATTITUDE=3,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_AXISLOCK=4,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_WEAKLEVELING=5,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_VIRTUALBAR=6,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_ACRO=7,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_RATTITUDE=8,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_ALTITUDEHOLD=9,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_ALTITUDEVARIO=10,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_CRUISECONTROL=11,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_SYSTEMIDENT=12
+} FlightModeSettingsStabilization1SettingsOptions;
+
+// Array element names for field Stabilization1Settings
+typedef enum {
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_ROLL=0,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_PITCH=1,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_YAW=2,
+    FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_THRUST=3
+} FlightModeSettingsStabilization1SettingsElem;
+
+// Number of elements for field Stabilization1Settings
+#define FLIGHTMODESETTINGS_STABILIZATION1SETTINGS_NUMELEM 4
+
+/* Field Stabilization2Settings information */
+
+// Enumeration options for field Stabilization2Settings
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_MANUAL=0,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_RATE=1,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_RATETRAINER=2,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_ATTITUDE=3,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_AXISLOCK=4,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_WEAKLEVELING=5,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_VIRTUALBAR=6,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_ACRO=7,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_RATTITUDE=8,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_ALTITUDEHOLD=9,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_ALTITUDEVARIO=10,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_CRUISECONTROL=11,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_SYSTEMIDENT=12
+} FlightModeSettingsStabilization2SettingsOptions;
+
+// Array element names for field Stabilization2Settings
+typedef enum {
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_ROLL=0,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_PITCH=1,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_YAW=2,
+    FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_THRUST=3
+} FlightModeSettingsStabilization2SettingsElem;
+
+// Number of elements for field Stabilization2Settings
+#define FLIGHTMODESETTINGS_STABILIZATION2SETTINGS_NUMELEM 4
+
+/* Field Stabilization3Settings information */
+
+// Enumeration options for field Stabilization3Settings
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_MANUAL=0,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_RATE=1,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_RATETRAINER=2,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_ATTITUDE=3,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_AXISLOCK=4,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_WEAKLEVELING=5,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_VIRTUALBAR=6,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_ACRO=7,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_RATTITUDE=8,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_ALTITUDEHOLD=9,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_ALTITUDEVARIO=10,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_CRUISECONTROL=11,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_SYSTEMIDENT=12
+} FlightModeSettingsStabilization3SettingsOptions;
+
+// Array element names for field Stabilization3Settings
+typedef enum {
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_ROLL=0,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_PITCH=1,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_YAW=2,
+    FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_THRUST=3
+} FlightModeSettingsStabilization3SettingsElem;
+
+// Number of elements for field Stabilization3Settings
+#define FLIGHTMODESETTINGS_STABILIZATION3SETTINGS_NUMELEM 4
+
+/* Field Stabilization4Settings information */
+
+// Enumeration options for field Stabilization4Settings
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_MANUAL=0,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_RATE=1,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_RATETRAINER=2,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_ATTITUDE=3,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_AXISLOCK=4,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_WEAKLEVELING=5,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_VIRTUALBAR=6,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_ACRO=7,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_RATTITUDE=8,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_ALTITUDEHOLD=9,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_ALTITUDEVARIO=10,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_CRUISECONTROL=11,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_SYSTEMIDENT=12
+} FlightModeSettingsStabilization4SettingsOptions;
+
+// Array element names for field Stabilization4Settings
+typedef enum {
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_ROLL=0,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_PITCH=1,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_YAW=2,
+    FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_THRUST=3
+} FlightModeSettingsStabilization4SettingsElem;
+
+// Number of elements for field Stabilization4Settings
+#define FLIGHTMODESETTINGS_STABILIZATION4SETTINGS_NUMELEM 4
+
+/* Field Stabilization5Settings information */
+
+// Enumeration options for field Stabilization5Settings
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_MANUAL=0,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_RATE=1,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_RATETRAINER=2,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_ATTITUDE=3,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_AXISLOCK=4,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_WEAKLEVELING=5,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_VIRTUALBAR=6,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_ACRO=7,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_RATTITUDE=8,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_ALTITUDEHOLD=9,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_ALTITUDEVARIO=10,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_CRUISECONTROL=11,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_SYSTEMIDENT=12
+} FlightModeSettingsStabilization5SettingsOptions;
+
+// Array element names for field Stabilization5Settings
+typedef enum {
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_ROLL=0,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_PITCH=1,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_YAW=2,
+    FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_THRUST=3
+} FlightModeSettingsStabilization5SettingsElem;
+
+// Number of elements for field Stabilization5Settings
+#define FLIGHTMODESETTINGS_STABILIZATION5SETTINGS_NUMELEM 4
+
+/* Field Stabilization6Settings information */
+
+// Enumeration options for field Stabilization6Settings
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_MANUAL=0,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_RATE=1,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_RATETRAINER=2,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_ATTITUDE=3,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_AXISLOCK=4,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_WEAKLEVELING=5,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_VIRTUALBAR=6,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_ACRO=7,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_RATTITUDE=8,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_ALTITUDEHOLD=9,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_ALTITUDEVARIO=10,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_CRUISECONTROL=11,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_SYSTEMIDENT=12
+} FlightModeSettingsStabilization6SettingsOptions;
+
+// Array element names for field Stabilization6Settings
+typedef enum {
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_ROLL=0,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_PITCH=1,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_YAW=2,
+    FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_THRUST=3
+} FlightModeSettingsStabilization6SettingsElem;
+
+// Number of elements for field Stabilization6Settings
+#define FLIGHTMODESETTINGS_STABILIZATION6SETTINGS_NUMELEM 4
+
+/* Field FlightModePosition information */
+
+// Enumeration options for field FlightModePosition
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_MANUAL=0,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_STABILIZED1=1,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_STABILIZED2=2,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_STABILIZED3=3,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_STABILIZED4=4,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_STABILIZED5=5,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_STABILIZED6=6,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_POSITIONHOLD=7,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_COURSELOCK=8,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_VELOCITYROAM=9,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_HOMELEASH=10,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_ABSOLUTEPOSITION=11,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_RETURNTOBASE=12,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_LAND=13,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_PATHPLANNER=14,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_POI=15,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_AUTOCRUISE=16,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_AUTOTAKEOFF=17,
+    FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_AUTOTUNE=18
+} FlightModeSettingsFlightModePositionOptions;
+
+// Number of elements for field FlightModePosition
+#define FLIGHTMODESETTINGS_FLIGHTMODEPOSITION_NUMELEM 6
+
+/* Field AlwaysStabilizeWhenArmedSwitch information */
+
+// Enumeration options for field AlwaysStabilizeWhenArmedSwitch
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_ALWAYSSTABILIZEWHENARMEDSWITCH_DISABLED=0,
+    FLIGHTMODESETTINGS_ALWAYSSTABILIZEWHENARMEDSWITCH_ACCESSORY0=1,
+    FLIGHTMODESETTINGS_ALWAYSSTABILIZEWHENARMEDSWITCH_ACCESSORY1=2,
+    FLIGHTMODESETTINGS_ALWAYSSTABILIZEWHENARMEDSWITCH_ACCESSORY2=3,
+    FLIGHTMODESETTINGS_ALWAYSSTABILIZEWHENARMEDSWITCH_ACCESSORY3=4
+} FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions;
+
+/* Field DisableSanityChecks information */
+
+// Enumeration options for field DisableSanityChecks
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_DISABLESANITYCHECKS_FALSE=0,
+    FLIGHTMODESETTINGS_DISABLESANITYCHECKS_TRUE=1
+} FlightModeSettingsDisableSanityChecksOptions;
+
+/* Field ReturnToBaseNextCommand information */
+
+// Enumeration options for field ReturnToBaseNextCommand
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_RETURNTOBASENEXTCOMMAND_HOLD=0,
+    FLIGHTMODESETTINGS_RETURNTOBASENEXTCOMMAND_LAND=1
+} FlightModeSettingsReturnToBaseNextCommandOptions;
+
+/* Field FlightModeChangeRestartsPathPlan information */
+
+// Enumeration options for field FlightModeChangeRestartsPathPlan
+typedef enum __attribute__ ((__packed__)) {
+    FLIGHTMODESETTINGS_FLIGHTMODECHANGERESTARTSPATHPLAN_FALSE=0,
+    FLIGHTMODESETTINGS_FLIGHTMODECHANGERESTARTSPATHPLAN_TRUE=1
+} FlightModeSettingsFlightModeChangeRestartsPathPlanOptions;
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float Horizontal;
+    float Vertical;
+}  FlightModeSettingsPositionHoldOffsetData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[2];
+}  FlightModeSettingsPositionHoldOffsetDataArray ;
+#define FlightModeSettingsPositionHoldOffsetToArray( var ) UAVObjectFieldToArray( FlightModeSettingsPositionHoldOffsetData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization1SettingsOptions Roll;
+    FlightModeSettingsStabilization1SettingsOptions Pitch;
+    FlightModeSettingsStabilization1SettingsOptions Yaw;
+    FlightModeSettingsStabilization1SettingsOptions Thrust;
+}  FlightModeSettingsStabilization1SettingsData ;
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization1SettingsOptions array[4];
+}  FlightModeSettingsStabilization1SettingsDataArray ;
+#define FlightModeSettingsStabilization1SettingsToArray( var ) UAVObjectFieldToArray( FlightModeSettingsStabilization1SettingsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization2SettingsOptions Roll;
+    FlightModeSettingsStabilization2SettingsOptions Pitch;
+    FlightModeSettingsStabilization2SettingsOptions Yaw;
+    FlightModeSettingsStabilization2SettingsOptions Thrust;
+}  FlightModeSettingsStabilization2SettingsData ;
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization2SettingsOptions array[4];
+}  FlightModeSettingsStabilization2SettingsDataArray ;
+#define FlightModeSettingsStabilization2SettingsToArray( var ) UAVObjectFieldToArray( FlightModeSettingsStabilization2SettingsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization3SettingsOptions Roll;
+    FlightModeSettingsStabilization3SettingsOptions Pitch;
+    FlightModeSettingsStabilization3SettingsOptions Yaw;
+    FlightModeSettingsStabilization3SettingsOptions Thrust;
+}  FlightModeSettingsStabilization3SettingsData ;
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization3SettingsOptions array[4];
+}  FlightModeSettingsStabilization3SettingsDataArray ;
+#define FlightModeSettingsStabilization3SettingsToArray( var ) UAVObjectFieldToArray( FlightModeSettingsStabilization3SettingsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization4SettingsOptions Roll;
+    FlightModeSettingsStabilization4SettingsOptions Pitch;
+    FlightModeSettingsStabilization4SettingsOptions Yaw;
+    FlightModeSettingsStabilization4SettingsOptions Thrust;
+}  FlightModeSettingsStabilization4SettingsData ;
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization4SettingsOptions array[4];
+}  FlightModeSettingsStabilization4SettingsDataArray ;
+#define FlightModeSettingsStabilization4SettingsToArray( var ) UAVObjectFieldToArray( FlightModeSettingsStabilization4SettingsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization5SettingsOptions Roll;
+    FlightModeSettingsStabilization5SettingsOptions Pitch;
+    FlightModeSettingsStabilization5SettingsOptions Yaw;
+    FlightModeSettingsStabilization5SettingsOptions Thrust;
+}  FlightModeSettingsStabilization5SettingsData ;
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization5SettingsOptions array[4];
+}  FlightModeSettingsStabilization5SettingsDataArray ;
+#define FlightModeSettingsStabilization5SettingsToArray( var ) UAVObjectFieldToArray( FlightModeSettingsStabilization5SettingsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization6SettingsOptions Roll;
+    FlightModeSettingsStabilization6SettingsOptions Pitch;
+    FlightModeSettingsStabilization6SettingsOptions Yaw;
+    FlightModeSettingsStabilization6SettingsOptions Thrust;
+}  FlightModeSettingsStabilization6SettingsData ;
+typedef struct __attribute__ ((__packed__)) {
+    FlightModeSettingsStabilization6SettingsOptions array[4];
+}  FlightModeSettingsStabilization6SettingsDataArray ;
+#define FlightModeSettingsStabilization6SettingsToArray( var ) UAVObjectFieldToArray( FlightModeSettingsStabilization6SettingsData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float ReturnToBaseAltitudeOffset;
+    float ReturnToBaseVelocity;
+    float LandingVelocity;
+    float AutoTakeOffVelocity;
+    float AutoTakeOffHeight;
+    FlightModeSettingsPositionHoldOffsetData PositionHoldOffset;
+    float VarioControlLowPassAlpha;
+    uint16_t ArmedTimeout;
+    uint16_t ArmingSequenceTime;
+    uint16_t DisarmingSequenceTime;
+    FlightModeSettingsArmingOptions Arming;
+    FlightModeSettingsStabilization1SettingsData Stabilization1Settings;
+    FlightModeSettingsStabilization2SettingsData Stabilization2Settings;
+    FlightModeSettingsStabilization3SettingsData Stabilization3Settings;
+    FlightModeSettingsStabilization4SettingsData Stabilization4Settings;
+    FlightModeSettingsStabilization5SettingsData Stabilization5Settings;
+    FlightModeSettingsStabilization6SettingsData Stabilization6Settings;
+    FlightModeSettingsFlightModePositionOptions FlightModePosition[6];
+    FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions AlwaysStabilizeWhenArmedSwitch;
+    FlightModeSettingsDisableSanityChecksOptions DisableSanityChecks;
+    FlightModeSettingsReturnToBaseNextCommandOptions ReturnToBaseNextCommand;
+    FlightModeSettingsFlightModeChangeRestartsPathPlanOptions FlightModeChangeRestartsPathPlan;
+
+} __attribute__((packed)) FlightModeSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef FlightModeSettingsDataPacked __attribute__((aligned(4))) FlightModeSettingsData;
+
+/* Typesafe Object access functions */
+#if FLIGHTMODESETTINGS_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *flightmodesettings_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t FlightModeSettingsGet(FlightModeSettingsData * dataOut) {
+    return UAVObjDirectGet(flightmodesettings_direct, dataOut, 0, sizeof(FlightModeSettingsData));
+}
+static inline int32_t FlightModeSettingsSet(const FlightModeSettingsData * dataIn) {
+    return UAVObjDirectSet(flightmodesettings_direct, dataIn, 0, sizeof(FlightModeSettingsData));
+}
+#else
+extern int32_t FlightModeSettingsGet(FlightModeSettingsData * dataOut);
+extern int32_t FlightModeSettingsSet(const FlightModeSettingsData * dataIn);
+#endif
+#else
+static inline int32_t FlightModeSettingsGet(FlightModeSettingsData * dataOut) {
+    return UAVObjGetData(FlightModeSettingsHandle(), dataOut);
+}
+static inline int32_t FlightModeSettingsSet(const FlightModeSettingsData * dataIn) {
+    return UAVObjSetData(FlightModeSettingsHandle(), dataIn);
+}
+#endif
+static inline int32_t FlightModeSettingsInstGet(uint16_t instId, FlightModeSettingsData * dataOut) {
+    return UAVObjGetInstanceData(FlightModeSettingsHandle(), instId, dataOut);
+}
+static inline int32_t FlightModeSettingsInstSet(uint16_t instId, const FlightModeSettingsData * dataIn) {
+    return UAVObjSetInstanceData(FlightModeSettingsHandle(), instId, dataIn);
+}
+static inline int32_t FlightModeSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(FlightModeSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t FlightModeSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(FlightModeSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t FlightModeSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(FlightModeSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t FlightModeSettingsCreateInstance() {
+    return UAVObjCreateInstance(FlightModeSettingsHandle(), &FlightModeSettingsSetDefaults);
+}
+static inline void FlightModeSettingsRequestUpdate() {
+    UAVObjRequestUpdate(FlightModeSettingsHandle());
+}
+static inline void FlightModeSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(FlightModeSettingsHandle(), instId);
+}
+static inline void FlightModeSettingsUpdated() {
+    UAVObjUpdated(FlightModeSettingsHandle());
+}
+static inline void FlightModeSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(FlightModeSettingsHandle(), instId);
+}
+static inline void FlightModeSettingsLogging() {
+    UAVObjLogging(FlightModeSettingsHandle());
+}
+static inline void FlightModeSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(FlightModeSettingsHandle(), instId);
+}
+static inline int32_t FlightModeSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(FlightModeSettingsHandle(), dataOut);
+}
+static inline int32_t FlightModeSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(FlightModeSettingsHandle(), dataIn);
+}
+static inline int8_t FlightModeSettingsReadOnly() {
+    return UAVObjReadOnly(FlightModeSettingsHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void FlightModeSettingsReturnToBaseAltitudeOffsetSet(float *NewReturnToBaseAltitudeOffset)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewReturnToBaseAltitudeOffset, offsetof(FlightModeSettingsData, ReturnToBaseAltitudeOffset), sizeof(float));
+}
+static inline void FlightModeSettingsReturnToBaseAltitudeOffsetGet(float *NewReturnToBaseAltitudeOffset)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewReturnToBaseAltitudeOffset, offsetof(FlightModeSettingsData, ReturnToBaseAltitudeOffset), sizeof(float));
+}
+static inline void FlightModeSettingsReturnToBaseVelocitySet(float *NewReturnToBaseVelocity)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewReturnToBaseVelocity, offsetof(FlightModeSettingsData, ReturnToBaseVelocity), sizeof(float));
+}
+static inline void FlightModeSettingsReturnToBaseVelocityGet(float *NewReturnToBaseVelocity)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewReturnToBaseVelocity, offsetof(FlightModeSettingsData, ReturnToBaseVelocity), sizeof(float));
+}
+static inline void FlightModeSettingsLandingVelocitySet(float *NewLandingVelocity)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewLandingVelocity, offsetof(FlightModeSettingsData, LandingVelocity), sizeof(float));
+}
+static inline void FlightModeSettingsLandingVelocityGet(float *NewLandingVelocity)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewLandingVelocity, offsetof(FlightModeSettingsData, LandingVelocity), sizeof(float));
+}
+static inline void FlightModeSettingsAutoTakeOffVelocitySet(float *NewAutoTakeOffVelocity)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewAutoTakeOffVelocity, offsetof(FlightModeSettingsData, AutoTakeOffVelocity), sizeof(float));
+}
+static inline void FlightModeSettingsAutoTakeOffVelocityGet(float *NewAutoTakeOffVelocity)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewAutoTakeOffVelocity, offsetof(FlightModeSettingsData, AutoTakeOffVelocity), sizeof(float));
+}
+static inline void FlightModeSettingsAutoTakeOffHeightSet(float *NewAutoTakeOffHeight)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewAutoTakeOffHeight, offsetof(FlightModeSettingsData, AutoTakeOffHeight), sizeof(float));
+}
+static inline void FlightModeSettingsAutoTakeOffHeightGet(float *NewAutoTakeOffHeight)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewAutoTakeOffHeight, offsetof(FlightModeSettingsData, AutoTakeOffHeight), sizeof(float));
+}
+static inline void FlightModeSettingsPositionHoldOffsetSet(FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+static inline void FlightModeSettingsPositionHoldOffsetGet(FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+static inline void FlightModeSettingsPositionHoldOffsetArraySet(float *NewPositionHoldOffset)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+static inline void FlightModeSettingsPositionHoldOffsetArrayGet(float *NewPositionHoldOffset)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+static inline void FlightModeSettingsVarioControlLowPassAlphaSet(float *NewVarioControlLowPassAlpha)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewVarioControlLowPassAlpha, offsetof(FlightModeSettingsData, VarioControlLowPassAlpha), sizeof(float));
+}
+static inline void FlightModeSettingsVarioControlLowPassAlphaGet(float *NewVarioControlLowPassAlpha)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewVarioControlLowPassAlpha, offsetof(FlightModeSettingsData, VarioControlLowPassAlpha), sizeof(float));
+}
+static inline void FlightModeSettingsArmedTimeoutSet(uint16_t *NewArmedTimeout)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewArmedTimeout, offsetof(FlightModeSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+static inline void FlightModeSettingsArmedTimeoutGet(uint16_t *NewArmedTimeout)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewArmedTimeout, offsetof(FlightModeSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+static inline void FlightModeSettingsArmingSequenceTimeSet(uint16_t *NewArmingSequenceTime)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewArmingSequenceTime, offsetof(FlightModeSettingsData, ArmingSequenceTime), sizeof(uint16_t));
+}
+static inline void FlightModeSettingsArmingSequenceTimeGet(uint16_t *NewArmingSequenceTime)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewArmingSequenceTime, offsetof(FlightModeSettingsData, ArmingSequenceTime), sizeof(uint16_t));
+}
+static inline void FlightModeSettingsDisarmingSequenceTimeSet(uint16_t *NewDisarmingSequenceTime)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewDisarmingSequenceTime, offsetof(FlightModeSettingsData, DisarmingSequenceTime), sizeof(uint16_t));
+}
+static inline void FlightModeSettingsDisarmingSequenceTimeGet(uint16_t *NewDisarmingSequenceTime)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewDisarmingSequenceTime, offsetof(FlightModeSettingsData, DisarmingSequenceTime), sizeof(uint16_t));
+}
+static inline void FlightModeSettingsArmingSet(FlightModeSettingsArmingOptions *NewArming)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewArming, offsetof(FlightModeSettingsData, Arming), sizeof(FlightModeSettingsArmingOptions));
+}
+static inline void FlightModeSettingsArmingGet(FlightModeSettingsArmingOptions *NewArming)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewArming, offsetof(FlightModeSettingsData, Arming), sizeof(FlightModeSettingsArmingOptions));
+}
+static inline void FlightModeSettingsStabilization1SettingsSet(FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization1SettingsGet(FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization1SettingsArraySet(FlightModeSettingsStabilization1SettingsOptions *NewStabilization1Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization1SettingsArrayGet(FlightModeSettingsStabilization1SettingsOptions *NewStabilization1Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(FlightModeSettingsStabilization1SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization2SettingsSet(FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization2SettingsGet(FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization2SettingsArraySet(FlightModeSettingsStabilization2SettingsOptions *NewStabilization2Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization2SettingsArrayGet(FlightModeSettingsStabilization2SettingsOptions *NewStabilization2Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(FlightModeSettingsStabilization2SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization3SettingsSet(FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization3SettingsGet(FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization3SettingsArraySet(FlightModeSettingsStabilization3SettingsOptions *NewStabilization3Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization3SettingsArrayGet(FlightModeSettingsStabilization3SettingsOptions *NewStabilization3Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(FlightModeSettingsStabilization3SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization4SettingsSet(FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization4SettingsGet(FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization4SettingsArraySet(FlightModeSettingsStabilization4SettingsOptions *NewStabilization4Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization4SettingsArrayGet(FlightModeSettingsStabilization4SettingsOptions *NewStabilization4Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(FlightModeSettingsStabilization4SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization5SettingsSet(FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization5SettingsGet(FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization5SettingsArraySet(FlightModeSettingsStabilization5SettingsOptions *NewStabilization5Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization5SettingsArrayGet(FlightModeSettingsStabilization5SettingsOptions *NewStabilization5Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(FlightModeSettingsStabilization5SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization6SettingsSet(FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization6SettingsGet(FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization6SettingsArraySet(FlightModeSettingsStabilization6SettingsOptions *NewStabilization6Settings)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+static inline void FlightModeSettingsStabilization6SettingsArrayGet(FlightModeSettingsStabilization6SettingsOptions *NewStabilization6Settings)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(FlightModeSettingsStabilization6SettingsOptions));
+}
+static inline void FlightModeSettingsFlightModePositionSet(FlightModeSettingsFlightModePositionOptions *NewFlightModePosition)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewFlightModePosition, offsetof(FlightModeSettingsData, FlightModePosition), 6*sizeof(FlightModeSettingsFlightModePositionOptions));
+}
+static inline void FlightModeSettingsFlightModePositionGet(FlightModeSettingsFlightModePositionOptions *NewFlightModePosition)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewFlightModePosition, offsetof(FlightModeSettingsData, FlightModePosition), 6*sizeof(FlightModeSettingsFlightModePositionOptions));
+}
+static inline void FlightModeSettingsAlwaysStabilizeWhenArmedSwitchSet(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions *NewAlwaysStabilizeWhenArmedSwitch)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewAlwaysStabilizeWhenArmedSwitch, offsetof(FlightModeSettingsData, AlwaysStabilizeWhenArmedSwitch), sizeof(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions));
+}
+static inline void FlightModeSettingsAlwaysStabilizeWhenArmedSwitchGet(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions *NewAlwaysStabilizeWhenArmedSwitch)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewAlwaysStabilizeWhenArmedSwitch, offsetof(FlightModeSettingsData, AlwaysStabilizeWhenArmedSwitch), sizeof(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions));
+}
+static inline void FlightModeSettingsDisableSanityChecksSet(FlightModeSettingsDisableSanityChecksOptions *NewDisableSanityChecks)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewDisableSanityChecks, offsetof(FlightModeSettingsData, DisableSanityChecks), sizeof(FlightModeSettingsDisableSanityChecksOptions));
+}
+static inline void FlightModeSettingsDisableSanityChecksGet(FlightModeSettingsDisableSanityChecksOptions *NewDisableSanityChecks)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewDisableSanityChecks, offsetof(FlightModeSettingsData, DisableSanityChecks), sizeof(FlightModeSettingsDisableSanityChecksOptions));
+}
+static inline void FlightModeSettingsReturnToBaseNextCommandSet(FlightModeSettingsReturnToBaseNextCommandOptions *NewReturnToBaseNextCommand)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewReturnToBaseNextCommand, offsetof(FlightModeSettingsData, ReturnToBaseNextCommand), sizeof(FlightModeSettingsReturnToBaseNextCommandOptions));
+}
+static inline void FlightModeSettingsReturnToBaseNextCommandGet(FlightModeSettingsReturnToBaseNextCommandOptions *NewReturnToBaseNextCommand)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewReturnToBaseNextCommand, offsetof(FlightModeSettingsData, ReturnToBaseNextCommand), sizeof(FlightModeSettingsReturnToBaseNextCommandOptions));
+}
+static inline void FlightModeSettingsFlightModeChangeRestartsPathPlanSet(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions *NewFlightModeChangeRestartsPathPlan)
+{
+    UAVObjDirectSet(flightmodesettings_direct, (void *)NewFlightModeChangeRestartsPathPlan, offsetof(FlightModeSettingsData, FlightModeChangeRestartsPathPlan), sizeof(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions));
+}
+static inline void FlightModeSettingsFlightModeChangeRestartsPathPlanGet(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions *NewFlightModeChangeRestartsPathPlan)
+{
+    UAVObjDirectGet(flightmodesettings_direct, (void *)NewFlightModeChangeRestartsPathPlan, offsetof(FlightModeSettingsData, FlightModeChangeRestartsPathPlan), sizeof(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions));
+}
+#else
+extern void FlightModeSettingsReturnToBaseAltitudeOffsetSet(float *NewReturnToBaseAltitudeOffset);
+extern void FlightModeSettingsReturnToBaseAltitudeOffsetGet(float *NewReturnToBaseAltitudeOffset);
+extern void FlightModeSettingsReturnToBaseVelocitySet(float *NewReturnToBaseVelocity);
+extern void FlightModeSettingsReturnToBaseVelocityGet(float *NewReturnToBaseVelocity);
+extern void FlightModeSettingsLandingVelocitySet(float *NewLandingVelocity);
+extern void FlightModeSettingsLandingVelocityGet(float *NewLandingVelocity);
+extern void FlightModeSettingsAutoTakeOffVelocitySet(float *NewAutoTakeOffVelocity);
+extern void FlightModeSettingsAutoTakeOffVelocityGet(float *NewAutoTakeOffVelocity);
+extern void FlightModeSettingsAutoTakeOffHeightSet(float *NewAutoTakeOffHeight);
+extern void FlightModeSettingsAutoTakeOffHeightGet(float *NewAutoTakeOffHeight);
+extern void FlightModeSettingsPositionHoldOffsetSet(FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset);
+extern void FlightModeSettingsPositionHoldOffsetGet(FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset);
+extern void FlightModeSettingsPositionHoldOffsetArraySet(float *NewPositionHoldOffset);
+extern void FlightModeSettingsPositionHoldOffsetArrayGet(float *NewPositionHoldOffset);
+extern void FlightModeSettingsVarioControlLowPassAlphaSet(float *NewVarioControlLowPassAlpha);
+extern void FlightModeSettingsVarioControlLowPassAlphaGet(float *NewVarioControlLowPassAlpha);
+extern void FlightModeSettingsArmedTimeoutSet(uint16_t *NewArmedTimeout);
+extern void FlightModeSettingsArmedTimeoutGet(uint16_t *NewArmedTimeout);
+extern void FlightModeSettingsArmingSequenceTimeSet(uint16_t *NewArmingSequenceTime);
+extern void FlightModeSettingsArmingSequenceTimeGet(uint16_t *NewArmingSequenceTime);
+extern void FlightModeSettingsDisarmingSequenceTimeSet(uint16_t *NewDisarmingSequenceTime);
+extern void FlightModeSettingsDisarmingSequenceTimeGet(uint16_t *NewDisarmingSequenceTime);
+extern void FlightModeSettingsArmingSet(FlightModeSettingsArmingOptions *NewArming);
+extern void FlightModeSettingsArmingGet(FlightModeSettingsArmingOptions *NewArming);
+extern void FlightModeSettingsStabilization1SettingsSet(FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings);
+extern void FlightModeSettingsStabilization1SettingsGet(FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings);
+extern void FlightModeSettingsStabilization1SettingsArraySet(FlightModeSettingsStabilization1SettingsOptions *NewStabilization1Settings);
+extern void FlightModeSettingsStabilization1SettingsArrayGet(FlightModeSettingsStabilization1SettingsOptions *NewStabilization1Settings);
+extern void FlightModeSettingsStabilization2SettingsSet(FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings);
+extern void FlightModeSettingsStabilization2SettingsGet(FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings);
+extern void FlightModeSettingsStabilization2SettingsArraySet(FlightModeSettingsStabilization2SettingsOptions *NewStabilization2Settings);
+extern void FlightModeSettingsStabilization2SettingsArrayGet(FlightModeSettingsStabilization2SettingsOptions *NewStabilization2Settings);
+extern void FlightModeSettingsStabilization3SettingsSet(FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings);
+extern void FlightModeSettingsStabilization3SettingsGet(FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings);
+extern void FlightModeSettingsStabilization3SettingsArraySet(FlightModeSettingsStabilization3SettingsOptions *NewStabilization3Settings);
+extern void FlightModeSettingsStabilization3SettingsArrayGet(FlightModeSettingsStabilization3SettingsOptions *NewStabilization3Settings);
+extern void FlightModeSettingsStabilization4SettingsSet(FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings);
+extern void FlightModeSettingsStabilization4SettingsGet(FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings);
+extern void FlightModeSettingsStabilization4SettingsArraySet(FlightModeSettingsStabilization4SettingsOptions *NewStabilization4Settings);
+extern void FlightModeSettingsStabilization4SettingsArrayGet(FlightModeSettingsStabilization4SettingsOptions *NewStabilization4Settings);
+extern void FlightModeSettingsStabilization5SettingsSet(FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings);
+extern void FlightModeSettingsStabilization5SettingsGet(FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings);
+extern void FlightModeSettingsStabilization5SettingsArraySet(FlightModeSettingsStabilization5SettingsOptions *NewStabilization5Settings);
+extern void FlightModeSettingsStabilization5SettingsArrayGet(FlightModeSettingsStabilization5SettingsOptions *NewStabilization5Settings);
+extern void FlightModeSettingsStabilization6SettingsSet(FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings);
+extern void FlightModeSettingsStabilization6SettingsGet(FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings);
+extern void FlightModeSettingsStabilization6SettingsArraySet(FlightModeSettingsStabilization6SettingsOptions *NewStabilization6Settings);
+extern void FlightModeSettingsStabilization6SettingsArrayGet(FlightModeSettingsStabilization6SettingsOptions *NewStabilization6Settings);
+extern void FlightModeSettingsFlightModePositionSet(FlightModeSettingsFlightModePositionOptions *NewFlightModePosition);
+extern void FlightModeSettingsFlightModePositionGet(FlightModeSettingsFlightModePositionOptions *NewFlightModePosition);
+extern void FlightModeSettingsAlwaysStabilizeWhenArmedSwitchSet(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions *NewAlwaysStabilizeWhenArmedSwitch);
+extern void FlightModeSettingsAlwaysStabilizeWhenArmedSwitchGet(FlightModeSettingsAlwaysStabilizeWhenArmedSwitchOptions *NewAlwaysStabilizeWhenArmedSwitch);
+extern void FlightModeSettingsDisableSanityChecksSet(FlightModeSettingsDisableSanityChecksOptions *NewDisableSanityChecks);
+extern void FlightModeSettingsDisableSanityChecksGet(FlightModeSettingsDisableSanityChecksOptions *NewDisableSanityChecks);
+extern void FlightModeSettingsReturnToBaseNextCommandSet(FlightModeSettingsReturnToBaseNextCommandOptions *NewReturnToBaseNextCommand);
+extern void FlightModeSettingsReturnToBaseNextCommandGet(FlightModeSettingsReturnToBaseNextCommandOptions *NewReturnToBaseNextCommand);
+extern void FlightModeSettingsFlightModeChangeRestartsPathPlanSet(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions *NewFlightModeChangeRestartsPathPlan);
+extern void FlightModeSettingsFlightModeChangeRestartsPathPlanGet(FlightModeSettingsFlightModeChangeRestartsPathPlanOptions *NewFlightModeChangeRestartsPathPlan);
+#endif
+
+
+#endif // FLIGHTMODESETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
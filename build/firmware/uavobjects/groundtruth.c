@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GroundTruth GroundTruth
+ * @brief Ground truth data output by a simulator.
+ *
+ * Autogenerated files and functions for GroundTruth Object
+ * @{ 
+ *
+ * @file       groundtruth.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GroundTruth object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: groundtruth.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "groundtruth.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if GROUNDTRUTH_ISSINGLEINST
+UAVObjDirect *groundtruth_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GroundTruthInitialize(void)
+{
+    // Compile time assertion that the GroundTruthDataPacked and GroundTruthData structs
+    // have the same size (though instances of GroundTruthData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GroundTruthDataPacked) == sizeof(GroundTruthData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GROUNDTRUTH_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GROUNDTRUTH_OBJID,
+        GROUNDTRUTH_ISSINGLEINST, GROUNDTRUTH_ISSETTINGS, GROUNDTRUTH_ISPRIORITY, GROUNDTRUTH_NUMBYTES, &GroundTruthSetDefaults);
+#if GROUNDTRUTH_ISSINGLEINST
+    groundtruth_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GroundTruthSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GroundTruthData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GroundTruthData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READONLY << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GroundTruthHandle()
+{
+    return handle;
+}
+
+#if GROUNDTRUTH_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t GroundTruthGet(GroundTruthData *dataOut)
+{
+    return UAVObjDirectGet(groundtruth_direct, dataOut, 0, sizeof(GroundTruthData));
+}
+
+int32_t GroundTruthSet(const GroundTruthData *dataIn)
+{
+    return UAVObjDirectSet(groundtruth_direct, dataIn, 0, sizeof(GroundTruthData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void GroundTruthAccelerationXYZSet(float *NewAccelerationXYZ)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewAccelerationXYZ, offsetof(GroundTruthData, AccelerationXYZ), 3*sizeof(float));
+}
+void GroundTruthAccelerationXYZGet(float *NewAccelerationXYZ)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewAccelerationXYZ, offsetof(GroundTruthData, AccelerationXYZ), 3*sizeof(float));
+}
+void GroundTruthPositionNEDSet(float *NewPositionNED)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewPositionNED, offsetof(GroundTruthData, PositionNED), 3*sizeof(float));
+}
+void GroundTruthPositionNEDGet(float *NewPositionNED)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewPositionNED, offsetof(GroundTruthData, PositionNED), 3*sizeof(float));
+}
+void GroundTruthVelocityNEDSet(float *NewVelocityNED)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewVelocityNED, offsetof(GroundTruthData, VelocityNED), 3*sizeof(float));
+}
+void GroundTruthVelocityNEDGet(float *NewVelocityNED)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewVelocityNED, offsetof(GroundTruthData, VelocityNED), 3*sizeof(float));
+}
+void GroundTruthRPYSet(float *NewRPY)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewRPY, offsetof(GroundTruthData, RPY), 3*sizeof(float));
+}
+void GroundTruthRPYGet(float *NewRPY)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewRPY, offsetof(GroundTruthData, RPY), 3*sizeof(float));
+}
+void GroundTruthAngularRatesSet(float *NewAngularRates)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewAngularRates, offsetof(GroundTruthData, AngularRates), 3*sizeof(float));
+}
+void GroundTruthAngularRatesGet(float *NewAngularRates)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewAngularRates, offsetof(GroundTruthData, AngularRates), 3*sizeof(float));
+}
+void GroundTruthTrueAirspeedSet(float *NewTrueAirspeed)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewTrueAirspeed, offsetof(GroundTruthData, TrueAirspeed), sizeof(float));
+}
+void GroundTruthTrueAirspeedGet(float *NewTrueAirspeed)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewTrueAirspeed, offsetof(GroundTruthData, TrueAirspeed), sizeof(float));
+}
+void GroundTruthCalibratedAirspeedSet(float *NewCalibratedAirspeed)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewCalibratedAirspeed, offsetof(GroundTruthData, CalibratedAirspeed), sizeof(float));
+}
+void GroundTruthCalibratedAirspeedGet(float *NewCalibratedAirspeed)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewCalibratedAirspeed, offsetof(GroundTruthData, CalibratedAirspeed), sizeof(float));
+}
+void GroundTruthAngleOfAttackSet(float *NewAngleOfAttack)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewAngleOfAttack, offsetof(GroundTruthData, AngleOfAttack), sizeof(float));
+}
+void GroundTruthAngleOfAttackGet(float *NewAngleOfAttack)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewAngleOfAttack, offsetof(GroundTruthData, AngleOfAttack), sizeof(float));
+}
+void GroundTruthAngleOfSlipSet(float *NewAngleOfSlip)
+{
+    UAVObjDirectSet(groundtruth_direct, (void *)NewAngleOfSlip, offsetof(GroundTruthData, AngleOfSlip), sizeof(float));
+}
+void GroundTruthAngleOfSlipGet(float *NewAngleOfSlip)
+{
+    UAVObjDirectGet(groundtruth_direct, (void *)NewAngleOfSlip, offsetof(GroundTruthData, AngleOfSlip), sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GyroSensor GyroSensor
+ * @brief Calibrated sensor data from 3 axis gyroscope in deg/s.
+ *
+ * Autogenerated files and functions for GyroSensor Object
+ * @{ 
+ *
+ * @file       gyrosensor.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GyroSensor object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gyrosensor.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gyrosensor.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if GYROSENSOR_ISSINGLEINST
+UAVObjDirect *gyrosensor_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GyroSensorInitialize(void)
+{
+    // Compile time assertion that the GyroSensorDataPacked and GyroSensorData structs
+    // have the same size (though instances of GyroSensorData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GyroSensorDataPacked) == sizeof(GyroSensorData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GYROSENSOR_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GYROSENSOR_OBJID,
+        GYROSENSOR_ISSINGLEINST, GYROSENSOR_ISSETTINGS, GYROSENSOR_ISPRIORITY, GYROSENSOR_NUMBYTES, &GyroSensorSetDefaults);
+#if GYROSENSOR_ISSINGLEINST
+    gyrosensor_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GyroSensorSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GyroSensorData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GyroSensorData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GyroSensorHandle()
+{
+    return handle;
+}
+
+#if GYROSENSOR_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t GyroSensorGet(GyroSensorData *dataOut)
+{
+    return UAVObjDirectGet(gyrosensor_direct, dataOut, 0, sizeof(GyroSensorData));
+}
+
+int32_t GyroSensorSet(const GyroSensorData *dataIn)
+{
+    return UAVObjDirectSet(gyrosensor_direct, dataIn, 0, sizeof(GyroSensorData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void GyroSensorxSet(float *Newx)
+{
+    UAVObjDirectSet(gyrosensor_direct, (void *)Newx, offsetof(GyroSensorData, x), sizeof(float));
+}
+void GyroSensorxGet(float *Newx)
+{
+    UAVObjDirectGet(gyrosensor_direct, (void *)Newx, offsetof(GyroSensorData, x), sizeof(float));
+}
+void GyroSensorySet(float *Newy)
+{
+    UAVObjDirectSet(gyrosensor_direct, (void *)Newy, offsetof(GyroSensorData, y), sizeof(float));
+}
+void GyroSensoryGet(float *Newy)
+{
+    UAVObjDirectGet(gyrosensor_direct, (void *)Newy, offsetof(GyroSensorData, y), sizeof(float));
+}
+void GyroSensorzSet(float *Newz)
+{
+    UAVObjDirectSet(gyrosensor_direct, (void *)Newz, offsetof(GyroSensorData, z), sizeof(float));
+}
+void GyroSensorzGet(float *Newz)
+{
+    UAVObjDirectGet(gyrosensor_direct, (void *)Newz, offsetof(GyroSensorData, z), sizeof(float));
+}
+void GyroSensortemperatureSet(float *Newtemperature)
+{
+    UAVObjDirectSet(gyrosensor_direct, (void *)Newtemperature, offsetof(GyroSensorData, temperature), sizeof(float));
+}
+void GyroSensortemperatureGet(float *Newtemperature)
+{
+    UAVObjDirectGet(gyrosensor_direct, (void *)Newtemperature, offsetof(GyroSensorData, temperature), sizeof(float));
+}
+void GyroSensorSensorReadTimestampSet(uint32_t *NewSensorReadTimestamp)
+{
+    UAVObjDirectSet(gyrosensor_direct, (void *)NewSensorReadTimestamp, offsetof(GyroSensorData, SensorReadTimestamp), sizeof(uint32_t));
+}
+void GyroSensorSensorReadTimestampGet(uint32_t *NewSensorReadTimestamp)
+{
+    UAVObjDirectGet(gyrosensor_direct, (void *)NewSensorReadTimestamp, offsetof(GyroSensorData, SensorReadTimestamp), sizeof(uint32_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,159 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup ObjectDigest ObjectDigest
+ * @brief CRC32 of the data of each settings object, refreshed by the @ref Telemetry module when a GCS connects. The GCS only requests the settings that differ from its cache.
+ *
+ * Autogenerated files and functions for ObjectDigest Object
+ * @{ 
+ *
+ * @file       objectdigest.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ObjectDigest object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: objectdigest.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "objectdigest.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if OBJECTDIGEST_ISSINGLEINST
+UAVObjDirect *objectdigest_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ObjectDigestInitialize(void)
+{
+    // Compile time assertion that the ObjectDigestDataPacked and ObjectDigestData structs
+    // have the same size (though instances of ObjectDigestData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(ObjectDigestDataPacked) == sizeof(ObjectDigestData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OBJECTDIGEST_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(OBJECTDIGEST_OBJID,
+        OBJECTDIGEST_ISSINGLEINST, OBJECTDIGEST_ISSETTINGS, OBJECTDIGEST_ISPRIORITY, OBJECTDIGEST_NUMBYTES, &ObjectDigestSetDefaults);
+#if OBJECTDIGEST_ISSINGLEINST
+    objectdigest_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ObjectDigestSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    ObjectDigestData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(ObjectDigestData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ObjectDigestHandle()
+{
+    return handle;
+}
+
+#if OBJECTDIGEST_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t ObjectDigestGet(ObjectDigestData *dataOut)
+{
+    return UAVObjDirectGet(objectdigest_direct, dataOut, 0, sizeof(ObjectDigestData));
+}
+
+int32_t ObjectDigestSet(const ObjectDigestData *dataIn)
+{
+    return UAVObjDirectSet(objectdigest_direct, dataIn, 0, sizeof(ObjectDigestData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+void ObjectDigestObjectIDSet(uint32_t *NewObjectID)
+{
+    UAVObjSetDataField(ObjectDigestHandle(), (void *)NewObjectID, offsetof(ObjectDigestData, ObjectID), 16*sizeof(uint32_t));
+}
+void ObjectDigestObjectIDGet(uint32_t *NewObjectID)
+{
+    UAVObjGetDataField(ObjectDigestHandle(), (void *)NewObjectID, offsetof(ObjectDigestData, ObjectID), 16*sizeof(uint32_t));
+}
+void ObjectDigestDigestSet(uint32_t *NewDigest)
+{
+    UAVObjSetDataField(ObjectDigestHandle(), (void *)NewDigest, offsetof(ObjectDigestData, Digest), 16*sizeof(uint32_t));
+}
+void ObjectDigestDigestGet(uint32_t *NewDigest)
+{
+    UAVObjGetDataField(ObjectDigestHandle(), (void *)NewDigest, offsetof(ObjectDigestData, Digest), 16*sizeof(uint32_t));
+}
+
+
+/**
+ * @}
+ */
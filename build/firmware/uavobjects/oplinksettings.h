@@ -0,0 +1,595 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup OPLinkSettings OPLinkSettings
+ * @brief OPLink configurations options.
+ *
+ * Autogenerated files and functions for OPLinkSettings Object
+ *
+ * @{
+ *
+ * @file       oplinksettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OPLinkSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: oplinksettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPLINKSETTINGS_H
+#define OPLINKSETTINGS_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define OPLINKSETTINGS_OBJID 0x951D5ABC
+#define OPLINKSETTINGS_ISSINGLEINST 1
+#define OPLINKSETTINGS_ISSETTINGS 1
+#define OPLINKSETTINGS_ISPRIORITY 0
+#define OPLINKSETTINGS_NUMBYTES sizeof(OPLinkSettingsData)
+
+/* Generic interface functions */
+int32_t OPLinkSettingsInitialize();
+UAVObjHandle OPLinkSettingsHandle();
+void OPLinkSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field CoordID information */
+
+/* Field CustomDeviceID information */
+
+/* Field SerialBaudrate information */
+
+/* Field RFFrequency information */
+
+/* Field FailsafeDelay information */
+
+/* Field BeaconFrequency information */
+
+/* Field Protocol information */
+
+// Enumeration options for field Protocol
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_PROTOCOL_DISABLED=0,
+    OPLINKSETTINGS_PROTOCOL_OPLINKRECEIVER=1,
+    OPLINKSETTINGS_PROTOCOL_OPLINKCOORDINATOR=2,
+    OPLINKSETTINGS_PROTOCOL_OPENLRS=3
+} OPLinkSettingsProtocolOptions;
+
+/* Field LinkType information */
+
+// Enumeration options for field LinkType
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_LINKTYPE_DATA=0,
+    OPLINKSETTINGS_LINKTYPE_CONTROL=1,
+    OPLINKSETTINGS_LINKTYPE_DATAANDCONTROL=2
+} OPLinkSettingsLinkTypeOptions;
+
+/* Field MainPort information */
+
+// Enumeration options for field MainPort
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_MAINPORT_DISABLED=0,
+    OPLINKSETTINGS_MAINPORT_TELEMETRY=1,
+    OPLINKSETTINGS_MAINPORT_SERIAL=2,
+    OPLINKSETTINGS_MAINPORT_COMBRIDGE=3,
+    OPLINKSETTINGS_MAINPORT_PPM=4,
+    OPLINKSETTINGS_MAINPORT_PWM=5
+} OPLinkSettingsMainPortOptions;
+
+/* Field FlexiPort information */
+
+// Enumeration options for field FlexiPort
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_FLEXIPORT_DISABLED=0,
+    OPLINKSETTINGS_FLEXIPORT_TELEMETRY=1,
+    OPLINKSETTINGS_FLEXIPORT_SERIAL=2,
+    OPLINKSETTINGS_FLEXIPORT_COMBRIDGE=3,
+    OPLINKSETTINGS_FLEXIPORT_PPM=4,
+    OPLINKSETTINGS_FLEXIPORT_PWM=5
+} OPLinkSettingsFlexiPortOptions;
+
+/* Field VCPPort information */
+
+// Enumeration options for field VCPPort
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_VCPPORT_DISABLED=0,
+    OPLINKSETTINGS_VCPPORT_SERIAL=1,
+    OPLINKSETTINGS_VCPPORT_COMBRIDGE=2
+} OPLinkSettingsVCPPortOptions;
+
+/* Field ComSpeed information */
+
+// Enumeration options for field ComSpeed
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_COMSPEED_4800=0,
+    OPLINKSETTINGS_COMSPEED_9600=1,
+    OPLINKSETTINGS_COMSPEED_19200=2,
+    OPLINKSETTINGS_COMSPEED_38400=3,
+    OPLINKSETTINGS_COMSPEED_57600=4,
+    OPLINKSETTINGS_COMSPEED_115200=5
+} OPLinkSettingsComSpeedOptions;
+
+/* Field LinkAdaptation information */
+
+// Enumeration options for field LinkAdaptation
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_LINKADAPTATION_DISABLED=0,
+    OPLINKSETTINGS_LINKADAPTATION_ENABLED=1
+} OPLinkSettingsLinkAdaptationOptions;
+
+/* Field MaxRFPower information */
+
+// Enumeration options for field MaxRFPower
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_MAXRFPOWER_0=0,
+    OPLINKSETTINGS_MAXRFPOWER_125=1,
+    OPLINKSETTINGS_MAXRFPOWER_16=2,
+    OPLINKSETTINGS_MAXRFPOWER_316=3,
+    OPLINKSETTINGS_MAXRFPOWER_63=4,
+    OPLINKSETTINGS_MAXRFPOWER_126=5,
+    OPLINKSETTINGS_MAXRFPOWER_25=6,
+    OPLINKSETTINGS_MAXRFPOWER_50=7,
+    OPLINKSETTINGS_MAXRFPOWER_100=8
+} OPLinkSettingsMaxRFPowerOptions;
+
+/* Field RFBand information */
+
+// Enumeration options for field RFBand
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_RFBAND_433MHZ=0,
+    OPLINKSETTINGS_RFBAND_868MHZ=1,
+    OPLINKSETTINGS_RFBAND_915MHZ=2
+} OPLinkSettingsRFBandOptions;
+
+/* Field MinChannel information */
+
+/* Field MaxChannel information */
+
+/* Field RFXtalCap information */
+
+/* Field Version information */
+
+/* Field RSSIType information */
+
+// Enumeration options for field RSSIType
+typedef enum __attribute__ ((__packed__)) {
+    OPLINKSETTINGS_RSSITYPE_COMBINED=0,
+    OPLINKSETTINGS_RSSITYPE_RSSI=1,
+    OPLINKSETTINGS_RSSITYPE_LINKQUALITY=2
+} OPLinkSettingsRSSITypeOptions;
+
+/* Field RFPower information */
+
+/* Field RFChannelSpacing information */
+
+/* Field HopChannel information */
+
+// Number of elements for field HopChannel
+#define OPLINKSETTINGS_HOPCHANNEL_NUMELEM 24
+
+/* Field ModemParams information */
+
+/* Field Flags information */
+
+/* Field BeaconDelay information */
+
+/* Field BeaconPeriod information */
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint32_t CoordID;
+    uint32_t CustomDeviceID;
+    uint32_t SerialBaudrate;
+    uint32_t RFFrequency;
+    uint32_t FailsafeDelay;
+    uint32_t BeaconFrequency;
+    OPLinkSettingsProtocolOptions Protocol;
+    OPLinkSettingsLinkTypeOptions LinkType;
+    OPLinkSettingsMainPortOptions MainPort;
+    OPLinkSettingsFlexiPortOptions FlexiPort;
+    OPLinkSettingsVCPPortOptions VCPPort;
+    OPLinkSettingsComSpeedOptions ComSpeed;
+    OPLinkSettingsLinkAdaptationOptions LinkAdaptation;
+    OPLinkSettingsMaxRFPowerOptions MaxRFPower;
+    OPLinkSettingsRFBandOptions RFBand;
+    uint8_t MinChannel;
+    uint8_t MaxChannel;
+    uint8_t RFXtalCap;
+    uint8_t Version;
+    OPLinkSettingsRSSITypeOptions RSSIType;
+    uint8_t RFPower;
+    uint8_t RFChannelSpacing;
+    uint8_t HopChannel[24];
+    uint8_t ModemParams;
+    uint8_t Flags;
+    uint8_t BeaconDelay;
+    uint8_t BeaconPeriod;
+
+} __attribute__((packed)) OPLinkSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef OPLinkSettingsDataPacked __attribute__((aligned(4))) OPLinkSettingsData;
+
+/* Typesafe Object access functions */
+#if OPLINKSETTINGS_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *oplinksettings_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t OPLinkSettingsGet(OPLinkSettingsData * dataOut) {
+    return UAVObjDirectGet(oplinksettings_direct, dataOut, 0, sizeof(OPLinkSettingsData));
+}
+static inline int32_t OPLinkSettingsSet(const OPLinkSettingsData * dataIn) {
+    return UAVObjDirectSet(oplinksettings_direct, dataIn, 0, sizeof(OPLinkSettingsData));
+}
+#else
+extern int32_t OPLinkSettingsGet(OPLinkSettingsData * dataOut);
+extern int32_t OPLinkSettingsSet(const OPLinkSettingsData * dataIn);
+#endif
+#else
+static inline int32_t OPLinkSettingsGet(OPLinkSettingsData * dataOut) {
+    return UAVObjGetData(OPLinkSettingsHandle(), dataOut);
+}
+static inline int32_t OPLinkSettingsSet(const OPLinkSettingsData * dataIn) {
+    return UAVObjSetData(OPLinkSettingsHandle(), dataIn);
+}
+#endif
+static inline int32_t OPLinkSettingsInstGet(uint16_t instId, OPLinkSettingsData * dataOut) {
+    return UAVObjGetInstanceData(OPLinkSettingsHandle(), instId, dataOut);
+}
+static inline int32_t OPLinkSettingsInstSet(uint16_t instId, const OPLinkSettingsData * dataIn) {
+    return UAVObjSetInstanceData(OPLinkSettingsHandle(), instId, dataIn);
+}
+static inline int32_t OPLinkSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(OPLinkSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t OPLinkSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OPLinkSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t OPLinkSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(OPLinkSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t OPLinkSettingsCreateInstance() {
+    return UAVObjCreateInstance(OPLinkSettingsHandle(), &OPLinkSettingsSetDefaults);
+}
+static inline void OPLinkSettingsRequestUpdate() {
+    UAVObjRequestUpdate(OPLinkSettingsHandle());
+}
+static inline void OPLinkSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(OPLinkSettingsHandle(), instId);
+}
+static inline void OPLinkSettingsUpdated() {
+    UAVObjUpdated(OPLinkSettingsHandle());
+}
+static inline void OPLinkSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(OPLinkSettingsHandle(), instId);
+}
+static inline void OPLinkSettingsLogging() {
+    UAVObjLogging(OPLinkSettingsHandle());
+}
+static inline void OPLinkSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(OPLinkSettingsHandle(), instId);
+}
+static inline int32_t OPLinkSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(OPLinkSettingsHandle(), dataOut);
+}
+static inline int32_t OPLinkSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(OPLinkSettingsHandle(), dataIn);
+}
+static inline int8_t OPLinkSettingsReadOnly() {
+    return UAVObjReadOnly(OPLinkSettingsHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void OPLinkSettingsCoordIDSet(uint32_t *NewCoordID)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewCoordID, offsetof(OPLinkSettingsData, CoordID), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsCoordIDGet(uint32_t *NewCoordID)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewCoordID, offsetof(OPLinkSettingsData, CoordID), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsCustomDeviceIDSet(uint32_t *NewCustomDeviceID)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewCustomDeviceID, offsetof(OPLinkSettingsData, CustomDeviceID), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsCustomDeviceIDGet(uint32_t *NewCustomDeviceID)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewCustomDeviceID, offsetof(OPLinkSettingsData, CustomDeviceID), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsSerialBaudrateSet(uint32_t *NewSerialBaudrate)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewSerialBaudrate, offsetof(OPLinkSettingsData, SerialBaudrate), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsSerialBaudrateGet(uint32_t *NewSerialBaudrate)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewSerialBaudrate, offsetof(OPLinkSettingsData, SerialBaudrate), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsRFFrequencySet(uint32_t *NewRFFrequency)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFFrequency, offsetof(OPLinkSettingsData, RFFrequency), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsRFFrequencyGet(uint32_t *NewRFFrequency)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFFrequency, offsetof(OPLinkSettingsData, RFFrequency), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsFailsafeDelaySet(uint32_t *NewFailsafeDelay)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewFailsafeDelay, offsetof(OPLinkSettingsData, FailsafeDelay), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsFailsafeDelayGet(uint32_t *NewFailsafeDelay)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewFailsafeDelay, offsetof(OPLinkSettingsData, FailsafeDelay), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsBeaconFrequencySet(uint32_t *NewBeaconFrequency)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewBeaconFrequency, offsetof(OPLinkSettingsData, BeaconFrequency), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsBeaconFrequencyGet(uint32_t *NewBeaconFrequency)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewBeaconFrequency, offsetof(OPLinkSettingsData, BeaconFrequency), sizeof(uint32_t));
+}
+static inline void OPLinkSettingsProtocolSet(OPLinkSettingsProtocolOptions *NewProtocol)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewProtocol, offsetof(OPLinkSettingsData, Protocol), sizeof(OPLinkSettingsProtocolOptions));
+}
+static inline void OPLinkSettingsProtocolGet(OPLinkSettingsProtocolOptions *NewProtocol)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewProtocol, offsetof(OPLinkSettingsData, Protocol), sizeof(OPLinkSettingsProtocolOptions));
+}
+static inline void OPLinkSettingsLinkTypeSet(OPLinkSettingsLinkTypeOptions *NewLinkType)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewLinkType, offsetof(OPLinkSettingsData, LinkType), sizeof(OPLinkSettingsLinkTypeOptions));
+}
+static inline void OPLinkSettingsLinkTypeGet(OPLinkSettingsLinkTypeOptions *NewLinkType)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewLinkType, offsetof(OPLinkSettingsData, LinkType), sizeof(OPLinkSettingsLinkTypeOptions));
+}
+static inline void OPLinkSettingsMainPortSet(OPLinkSettingsMainPortOptions *NewMainPort)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMainPort, offsetof(OPLinkSettingsData, MainPort), sizeof(OPLinkSettingsMainPortOptions));
+}
+static inline void OPLinkSettingsMainPortGet(OPLinkSettingsMainPortOptions *NewMainPort)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMainPort, offsetof(OPLinkSettingsData, MainPort), sizeof(OPLinkSettingsMainPortOptions));
+}
+static inline void OPLinkSettingsFlexiPortSet(OPLinkSettingsFlexiPortOptions *NewFlexiPort)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewFlexiPort, offsetof(OPLinkSettingsData, FlexiPort), sizeof(OPLinkSettingsFlexiPortOptions));
+}
+static inline void OPLinkSettingsFlexiPortGet(OPLinkSettingsFlexiPortOptions *NewFlexiPort)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewFlexiPort, offsetof(OPLinkSettingsData, FlexiPort), sizeof(OPLinkSettingsFlexiPortOptions));
+}
+static inline void OPLinkSettingsVCPPortSet(OPLinkSettingsVCPPortOptions *NewVCPPort)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewVCPPort, offsetof(OPLinkSettingsData, VCPPort), sizeof(OPLinkSettingsVCPPortOptions));
+}
+static inline void OPLinkSettingsVCPPortGet(OPLinkSettingsVCPPortOptions *NewVCPPort)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewVCPPort, offsetof(OPLinkSettingsData, VCPPort), sizeof(OPLinkSettingsVCPPortOptions));
+}
+static inline void OPLinkSettingsComSpeedSet(OPLinkSettingsComSpeedOptions *NewComSpeed)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewComSpeed, offsetof(OPLinkSettingsData, ComSpeed), sizeof(OPLinkSettingsComSpeedOptions));
+}
+static inline void OPLinkSettingsComSpeedGet(OPLinkSettingsComSpeedOptions *NewComSpeed)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewComSpeed, offsetof(OPLinkSettingsData, ComSpeed), sizeof(OPLinkSettingsComSpeedOptions));
+}
+static inline void OPLinkSettingsLinkAdaptationSet(OPLinkSettingsLinkAdaptationOptions *NewLinkAdaptation)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewLinkAdaptation, offsetof(OPLinkSettingsData, LinkAdaptation), sizeof(OPLinkSettingsLinkAdaptationOptions));
+}
+static inline void OPLinkSettingsLinkAdaptationGet(OPLinkSettingsLinkAdaptationOptions *NewLinkAdaptation)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewLinkAdaptation, offsetof(OPLinkSettingsData, LinkAdaptation), sizeof(OPLinkSettingsLinkAdaptationOptions));
+}
+static inline void OPLinkSettingsMaxRFPowerSet(OPLinkSettingsMaxRFPowerOptions *NewMaxRFPower)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMaxRFPower, offsetof(OPLinkSettingsData, MaxRFPower), sizeof(OPLinkSettingsMaxRFPowerOptions));
+}
+static inline void OPLinkSettingsMaxRFPowerGet(OPLinkSettingsMaxRFPowerOptions *NewMaxRFPower)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMaxRFPower, offsetof(OPLinkSettingsData, MaxRFPower), sizeof(OPLinkSettingsMaxRFPowerOptions));
+}
+static inline void OPLinkSettingsRFBandSet(OPLinkSettingsRFBandOptions *NewRFBand)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFBand, offsetof(OPLinkSettingsData, RFBand), sizeof(OPLinkSettingsRFBandOptions));
+}
+static inline void OPLinkSettingsRFBandGet(OPLinkSettingsRFBandOptions *NewRFBand)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFBand, offsetof(OPLinkSettingsData, RFBand), sizeof(OPLinkSettingsRFBandOptions));
+}
+static inline void OPLinkSettingsMinChannelSet(uint8_t *NewMinChannel)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMinChannel, offsetof(OPLinkSettingsData, MinChannel), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsMinChannelGet(uint8_t *NewMinChannel)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMinChannel, offsetof(OPLinkSettingsData, MinChannel), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsMaxChannelSet(uint8_t *NewMaxChannel)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMaxChannel, offsetof(OPLinkSettingsData, MaxChannel), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsMaxChannelGet(uint8_t *NewMaxChannel)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMaxChannel, offsetof(OPLinkSettingsData, MaxChannel), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsRFXtalCapSet(uint8_t *NewRFXtalCap)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFXtalCap, offsetof(OPLinkSettingsData, RFXtalCap), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsRFXtalCapGet(uint8_t *NewRFXtalCap)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFXtalCap, offsetof(OPLinkSettingsData, RFXtalCap), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsVersionSet(uint8_t *NewVersion)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewVersion, offsetof(OPLinkSettingsData, Version), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsVersionGet(uint8_t *NewVersion)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewVersion, offsetof(OPLinkSettingsData, Version), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsRSSITypeSet(OPLinkSettingsRSSITypeOptions *NewRSSIType)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRSSIType, offsetof(OPLinkSettingsData, RSSIType), sizeof(OPLinkSettingsRSSITypeOptions));
+}
+static inline void OPLinkSettingsRSSITypeGet(OPLinkSettingsRSSITypeOptions *NewRSSIType)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRSSIType, offsetof(OPLinkSettingsData, RSSIType), sizeof(OPLinkSettingsRSSITypeOptions));
+}
+static inline void OPLinkSettingsRFPowerSet(uint8_t *NewRFPower)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFPower, offsetof(OPLinkSettingsData, RFPower), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsRFPowerGet(uint8_t *NewRFPower)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFPower, offsetof(OPLinkSettingsData, RFPower), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsRFChannelSpacingSet(uint8_t *NewRFChannelSpacing)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFChannelSpacing, offsetof(OPLinkSettingsData, RFChannelSpacing), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsRFChannelSpacingGet(uint8_t *NewRFChannelSpacing)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFChannelSpacing, offsetof(OPLinkSettingsData, RFChannelSpacing), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsHopChannelSet(uint8_t *NewHopChannel)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewHopChannel, offsetof(OPLinkSettingsData, HopChannel), 24*sizeof(uint8_t));
+}
+static inline void OPLinkSettingsHopChannelGet(uint8_t *NewHopChannel)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewHopChannel, offsetof(OPLinkSettingsData, HopChannel), 24*sizeof(uint8_t));
+}
+static inline void OPLinkSettingsModemParamsSet(uint8_t *NewModemParams)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewModemParams, offsetof(OPLinkSettingsData, ModemParams), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsModemParamsGet(uint8_t *NewModemParams)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewModemParams, offsetof(OPLinkSettingsData, ModemParams), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsFlagsSet(uint8_t *NewFlags)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewFlags, offsetof(OPLinkSettingsData, Flags), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsFlagsGet(uint8_t *NewFlags)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewFlags, offsetof(OPLinkSettingsData, Flags), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsBeaconDelaySet(uint8_t *NewBeaconDelay)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewBeaconDelay, offsetof(OPLinkSettingsData, BeaconDelay), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsBeaconDelayGet(uint8_t *NewBeaconDelay)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewBeaconDelay, offsetof(OPLinkSettingsData, BeaconDelay), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsBeaconPeriodSet(uint8_t *NewBeaconPeriod)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewBeaconPeriod, offsetof(OPLinkSettingsData, BeaconPeriod), sizeof(uint8_t));
+}
+static inline void OPLinkSettingsBeaconPeriodGet(uint8_t *NewBeaconPeriod)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewBeaconPeriod, offsetof(OPLinkSettingsData, BeaconPeriod), sizeof(uint8_t));
+}
+#else
+extern void OPLinkSettingsCoordIDSet(uint32_t *NewCoordID);
+extern void OPLinkSettingsCoordIDGet(uint32_t *NewCoordID);
+extern void OPLinkSettingsCustomDeviceIDSet(uint32_t *NewCustomDeviceID);
+extern void OPLinkSettingsCustomDeviceIDGet(uint32_t *NewCustomDeviceID);
+extern void OPLinkSettingsSerialBaudrateSet(uint32_t *NewSerialBaudrate);
+extern void OPLinkSettingsSerialBaudrateGet(uint32_t *NewSerialBaudrate);
+extern void OPLinkSettingsRFFrequencySet(uint32_t *NewRFFrequency);
+extern void OPLinkSettingsRFFrequencyGet(uint32_t *NewRFFrequency);
+extern void OPLinkSettingsFailsafeDelaySet(uint32_t *NewFailsafeDelay);
+extern void OPLinkSettingsFailsafeDelayGet(uint32_t *NewFailsafeDelay);
+extern void OPLinkSettingsBeaconFrequencySet(uint32_t *NewBeaconFrequency);
+extern void OPLinkSettingsBeaconFrequencyGet(uint32_t *NewBeaconFrequency);
+extern void OPLinkSettingsProtocolSet(OPLinkSettingsProtocolOptions *NewProtocol);
+extern void OPLinkSettingsProtocolGet(OPLinkSettingsProtocolOptions *NewProtocol);
+extern void OPLinkSettingsLinkTypeSet(OPLinkSettingsLinkTypeOptions *NewLinkType);
+extern void OPLinkSettingsLinkTypeGet(OPLinkSettingsLinkTypeOptions *NewLinkType);
+extern void OPLinkSettingsMainPortSet(OPLinkSettingsMainPortOptions *NewMainPort);
+extern void OPLinkSettingsMainPortGet(OPLinkSettingsMainPortOptions *NewMainPort);
+extern void OPLinkSettingsFlexiPortSet(OPLinkSettingsFlexiPortOptions *NewFlexiPort);
+extern void OPLinkSettingsFlexiPortGet(OPLinkSettingsFlexiPortOptions *NewFlexiPort);
+extern void OPLinkSettingsVCPPortSet(OPLinkSettingsVCPPortOptions *NewVCPPort);
+extern void OPLinkSettingsVCPPortGet(OPLinkSettingsVCPPortOptions *NewVCPPort);
+extern void OPLinkSettingsComSpeedSet(OPLinkSettingsComSpeedOptions *NewComSpeed);
+extern void OPLinkSettingsComSpeedGet(OPLinkSettingsComSpeedOptions *NewComSpeed);
+extern void OPLinkSettingsLinkAdaptationSet(OPLinkSettingsLinkAdaptationOptions *NewLinkAdaptation);
+extern void OPLinkSettingsLinkAdaptationGet(OPLinkSettingsLinkAdaptationOptions *NewLinkAdaptation);
+extern void OPLinkSettingsMaxRFPowerSet(OPLinkSettingsMaxRFPowerOptions *NewMaxRFPower);
+extern void OPLinkSettingsMaxRFPowerGet(OPLinkSettingsMaxRFPowerOptions *NewMaxRFPower);
+extern void OPLinkSettingsRFBandSet(OPLinkSettingsRFBandOptions *NewRFBand);
+extern void OPLinkSettingsRFBandGet(OPLinkSettingsRFBandOptions *NewRFBand);
+extern void OPLinkSettingsMinChannelSet(uint8_t *NewMinChannel);
+extern void OPLinkSettingsMinChannelGet(uint8_t *NewMinChannel);
+extern void OPLinkSettingsMaxChannelSet(uint8_t *NewMaxChannel);
+extern void OPLinkSettingsMaxChannelGet(uint8_t *NewMaxChannel);
+extern void OPLinkSettingsRFXtalCapSet(uint8_t *NewRFXtalCap);
+extern void OPLinkSettingsRFXtalCapGet(uint8_t *NewRFXtalCap);
+extern void OPLinkSettingsVersionSet(uint8_t *NewVersion);
+extern void OPLinkSettingsVersionGet(uint8_t *NewVersion);
+extern void OPLinkSettingsRSSITypeSet(OPLinkSettingsRSSITypeOptions *NewRSSIType);
+extern void OPLinkSettingsRSSITypeGet(OPLinkSettingsRSSITypeOptions *NewRSSIType);
+extern void OPLinkSettingsRFPowerSet(uint8_t *NewRFPower);
+extern void OPLinkSettingsRFPowerGet(uint8_t *NewRFPower);
+extern void OPLinkSettingsRFChannelSpacingSet(uint8_t *NewRFChannelSpacing);
+extern void OPLinkSettingsRFChannelSpacingGet(uint8_t *NewRFChannelSpacing);
+extern void OPLinkSettingsHopChannelSet(uint8_t *NewHopChannel);
+extern void OPLinkSettingsHopChannelGet(uint8_t *NewHopChannel);
+extern void OPLinkSettingsModemParamsSet(uint8_t *NewModemParams);
+extern void OPLinkSettingsModemParamsGet(uint8_t *NewModemParams);
+extern void OPLinkSettingsFlagsSet(uint8_t *NewFlags);
+extern void OPLinkSettingsFlagsGet(uint8_t *NewFlags);
+extern void OPLinkSettingsBeaconDelaySet(uint8_t *NewBeaconDelay);
+extern void OPLinkSettingsBeaconDelayGet(uint8_t *NewBeaconDelay);
+extern void OPLinkSettingsBeaconPeriodSet(uint8_t *NewBeaconPeriod);
+extern void OPLinkSettingsBeaconPeriodGet(uint8_t *NewBeaconPeriod);
+#endif
+
+
+#endif // OPLINKSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PathDesired PathDesired
+ * @brief The endpoint or path the craft is trying to achieve.  Can come from @ref ManualControl or @ref PathPlanner 
+ *
+ * Autogenerated files and functions for PathDesired Object
+ * @{ 
+ *
+ * @file       pathdesired.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PathDesired object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pathdesired.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "pathdesired.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if PATHDESIRED_ISSINGLEINST
+UAVObjDirect *pathdesired_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PathDesiredInitialize(void)
+{
+    // Compile time assertion that the PathDesiredDataPacked and PathDesiredData structs
+    // have the same size (though instances of PathDesiredData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PathDesiredDataPacked) == sizeof(PathDesiredData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PATHDESIRED_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(PATHDESIRED_OBJID,
+        PATHDESIRED_ISSINGLEINST, PATHDESIRED_ISSETTINGS, PATHDESIRED_ISPRIORITY, PATHDESIRED_NUMBYTES, &PathDesiredSetDefaults);
+#if PATHDESIRED_ISSINGLEINST
+    pathdesired_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PathDesiredSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PathDesiredData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PathDesiredData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PathDesiredHandle()
+{
+    return handle;
+}
+
+#if PATHDESIRED_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t PathDesiredGet(PathDesiredData *dataOut)
+{
+    return UAVObjDirectGet(pathdesired_direct, dataOut, 0, sizeof(PathDesiredData));
+}
+
+int32_t PathDesiredSet(const PathDesiredData *dataIn)
+{
+    return UAVObjDirectSet(pathdesired_direct, dataIn, 0, sizeof(PathDesiredData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void PathDesiredStartSet(PathDesiredStartData *NewStart)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewStart, offsetof(PathDesiredData, Start), 3*sizeof(float));
+}
+void PathDesiredStartGet(PathDesiredStartData *NewStart)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewStart, offsetof(PathDesiredData, Start), 3*sizeof(float));
+}
+void PathDesiredStartArraySet(float *NewStart)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewStart, offsetof(PathDesiredData, Start), 3*sizeof(float));
+}
+void PathDesiredStartArrayGet(float *NewStart)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewStart, offsetof(PathDesiredData, Start), 3*sizeof(float));
+}
+void PathDesiredEndSet(PathDesiredEndData *NewEnd)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewEnd, offsetof(PathDesiredData, End), 3*sizeof(float));
+}
+void PathDesiredEndGet(PathDesiredEndData *NewEnd)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewEnd, offsetof(PathDesiredData, End), 3*sizeof(float));
+}
+void PathDesiredEndArraySet(float *NewEnd)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewEnd, offsetof(PathDesiredData, End), 3*sizeof(float));
+}
+void PathDesiredEndArrayGet(float *NewEnd)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewEnd, offsetof(PathDesiredData, End), 3*sizeof(float));
+}
+void PathDesiredStartingVelocitySet(float *NewStartingVelocity)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewStartingVelocity, offsetof(PathDesiredData, StartingVelocity), sizeof(float));
+}
+void PathDesiredStartingVelocityGet(float *NewStartingVelocity)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewStartingVelocity, offsetof(PathDesiredData, StartingVelocity), sizeof(float));
+}
+void PathDesiredEndingVelocitySet(float *NewEndingVelocity)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewEndingVelocity, offsetof(PathDesiredData, EndingVelocity), sizeof(float));
+}
+void PathDesiredEndingVelocityGet(float *NewEndingVelocity)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewEndingVelocity, offsetof(PathDesiredData, EndingVelocity), sizeof(float));
+}
+void PathDesiredModeParametersSet(float *NewModeParameters)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewModeParameters, offsetof(PathDesiredData, ModeParameters), 4*sizeof(float));
+}
+void PathDesiredModeParametersGet(float *NewModeParameters)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewModeParameters, offsetof(PathDesiredData, ModeParameters), 4*sizeof(float));
+}
+void PathDesiredUIDSet(int16_t *NewUID)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewUID, offsetof(PathDesiredData, UID), sizeof(int16_t));
+}
+void PathDesiredUIDGet(int16_t *NewUID)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewUID, offsetof(PathDesiredData, UID), sizeof(int16_t));
+}
+void PathDesiredModeSet(PathDesiredModeOptions *NewMode)
+{
+    UAVObjDirectSet(pathdesired_direct, (void *)NewMode, offsetof(PathDesiredData, Mode), sizeof(PathDesiredModeOptions));
+}
+void PathDesiredModeGet(PathDesiredModeOptions *NewMode)
+{
+    UAVObjDirectGet(pathdesired_direct, (void *)NewMode, offsetof(PathDesiredData, Mode), sizeof(PathDesiredModeOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,233 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PathStatus PathStatus
+ * @brief Status of the current path mode  Can come from any @ref PathFollower module
+ *
+ * Autogenerated files and functions for PathStatus Object
+ * @{ 
+ *
+ * @file       pathstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PathStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pathstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "pathstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if PATHSTATUS_ISSINGLEINST
+UAVObjDirect *pathstatus_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PathStatusInitialize(void)
+{
+    // Compile time assertion that the PathStatusDataPacked and PathStatusData structs
+    // have the same size (though instances of PathStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PathStatusDataPacked) == sizeof(PathStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PATHSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(PATHSTATUS_OBJID,
+        PATHSTATUS_ISSINGLEINST, PATHSTATUS_ISSETTINGS, PATHSTATUS_ISPRIORITY, PATHSTATUS_NUMBYTES, &PathStatusSetDefaults);
+#if PATHSTATUS_ISSINGLEINST
+    pathstatus_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PathStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PathStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PathStatusData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PathStatusHandle()
+{
+    return handle;
+}
+
+#if PATHSTATUS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t PathStatusGet(PathStatusData *dataOut)
+{
+    return UAVObjDirectGet(pathstatus_direct, dataOut, 0, sizeof(PathStatusData));
+}
+
+int32_t PathStatusSet(const PathStatusData *dataIn)
+{
+    return UAVObjDirectSet(pathstatus_direct, dataIn, 0, sizeof(PathStatusData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void PathStatusfractional_progressSet(float *Newfractional_progress)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newfractional_progress, offsetof(PathStatusData, fractional_progress), sizeof(float));
+}
+void PathStatusfractional_progressGet(float *Newfractional_progress)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newfractional_progress, offsetof(PathStatusData, fractional_progress), sizeof(float));
+}
+void PathStatuserrorSet(float *Newerror)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newerror, offsetof(PathStatusData, error), sizeof(float));
+}
+void PathStatuserrorGet(float *Newerror)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newerror, offsetof(PathStatusData, error), sizeof(float));
+}
+void PathStatuspath_direction_northSet(float *Newpath_direction_north)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newpath_direction_north, offsetof(PathStatusData, path_direction_north), sizeof(float));
+}
+void PathStatuspath_direction_northGet(float *Newpath_direction_north)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newpath_direction_north, offsetof(PathStatusData, path_direction_north), sizeof(float));
+}
+void PathStatuspath_direction_eastSet(float *Newpath_direction_east)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newpath_direction_east, offsetof(PathStatusData, path_direction_east), sizeof(float));
+}
+void PathStatuspath_direction_eastGet(float *Newpath_direction_east)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newpath_direction_east, offsetof(PathStatusData, path_direction_east), sizeof(float));
+}
+void PathStatuspath_direction_downSet(float *Newpath_direction_down)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newpath_direction_down, offsetof(PathStatusData, path_direction_down), sizeof(float));
+}
+void PathStatuspath_direction_downGet(float *Newpath_direction_down)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newpath_direction_down, offsetof(PathStatusData, path_direction_down), sizeof(float));
+}
+void PathStatuscorrection_direction_northSet(float *Newcorrection_direction_north)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newcorrection_direction_north, offsetof(PathStatusData, correction_direction_north), sizeof(float));
+}
+void PathStatuscorrection_direction_northGet(float *Newcorrection_direction_north)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newcorrection_direction_north, offsetof(PathStatusData, correction_direction_north), sizeof(float));
+}
+void PathStatuscorrection_direction_eastSet(float *Newcorrection_direction_east)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newcorrection_direction_east, offsetof(PathStatusData, correction_direction_east), sizeof(float));
+}
+void PathStatuscorrection_direction_eastGet(float *Newcorrection_direction_east)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newcorrection_direction_east, offsetof(PathStatusData, correction_direction_east), sizeof(float));
+}
+void PathStatuscorrection_direction_downSet(float *Newcorrection_direction_down)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newcorrection_direction_down, offsetof(PathStatusData, correction_direction_down), sizeof(float));
+}
+void PathStatuscorrection_direction_downGet(float *Newcorrection_direction_down)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newcorrection_direction_down, offsetof(PathStatusData, correction_direction_down), sizeof(float));
+}
+void PathStatuspath_timeSet(float *Newpath_time)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)Newpath_time, offsetof(PathStatusData, path_time), sizeof(float));
+}
+void PathStatuspath_timeGet(float *Newpath_time)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)Newpath_time, offsetof(PathStatusData, path_time), sizeof(float));
+}
+void PathStatusUIDSet(int16_t *NewUID)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)NewUID, offsetof(PathStatusData, UID), sizeof(int16_t));
+}
+void PathStatusUIDGet(int16_t *NewUID)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)NewUID, offsetof(PathStatusData, UID), sizeof(int16_t));
+}
+void PathStatusStatusSet(PathStatusStatusOptions *NewStatus)
+{
+    UAVObjDirectSet(pathstatus_direct, (void *)NewStatus, offsetof(PathStatusData, Status), sizeof(PathStatusStatusOptions));
+}
+void PathStatusStatusGet(PathStatusStatusOptions *NewStatus)
+{
+    UAVObjDirectGet(pathstatus_direct, (void *)NewStatus, offsetof(PathStatusData, Status), sizeof(PathStatusStatusOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
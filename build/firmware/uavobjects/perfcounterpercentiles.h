@@ -0,0 +1,192 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup PerfCounterPercentiles PerfCounterPercentiles
+ * @brief Tail of a performance counter since the previous update, instances match PerfCounter. Percentiles are bucket upper bounds, at most 25% above the actual value
+ *
+ * Autogenerated files and functions for PerfCounterPercentiles Object
+ *
+ * @{
+ *
+ * @file       perfcounterpercentiles.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PerfCounterPercentiles object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: perfcounterpercentiles.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PERFCOUNTERPERCENTILES_H
+#define PERFCOUNTERPERCENTILES_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define PERFCOUNTERPERCENTILES_OBJID 0x5EA4B9F2
+#define PERFCOUNTERPERCENTILES_ISSINGLEINST 0
+#define PERFCOUNTERPERCENTILES_ISSETTINGS 0
+#define PERFCOUNTERPERCENTILES_ISPRIORITY 0
+#define PERFCOUNTERPERCENTILES_NUMBYTES sizeof(PerfCounterPercentilesData)
+
+/* Generic interface functions */
+int32_t PerfCounterPercentilesInitialize();
+UAVObjHandle PerfCounterPercentilesHandle();
+void PerfCounterPercentilesSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Id information */
+
+/* Field Samples information */
+
+/* Field Percentile information */
+
+// Array element names for field Percentile
+typedef enum {
+    PERFCOUNTERPERCENTILES_PERCENTILE_P50=0,
+    PERFCOUNTERPERCENTILES_PERCENTILE_P99=1,
+    PERFCOUNTERPERCENTILES_PERCENTILE_P999=2,
+    PERFCOUNTERPERCENTILES_PERCENTILE_MAX=3
+} PerfCounterPercentilesPercentileElem;
+
+// Number of elements for field Percentile
+#define PERFCOUNTERPERCENTILES_PERCENTILE_NUMELEM 4
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    int32_t P50;
+    int32_t P99;
+    int32_t P999;
+    int32_t Max;
+}  PerfCounterPercentilesPercentileData ;
+typedef struct __attribute__ ((__packed__)) {
+    int32_t array[4];
+}  PerfCounterPercentilesPercentileDataArray ;
+#define PerfCounterPercentilesPercentileToArray( var ) UAVObjectFieldToArray( PerfCounterPercentilesPercentileData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint32_t Id;
+    uint32_t Samples;
+    PerfCounterPercentilesPercentileData Percentile;
+
+} __attribute__((packed)) PerfCounterPercentilesDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef PerfCounterPercentilesDataPacked __attribute__((aligned(4))) PerfCounterPercentilesData;
+
+/* Typesafe Object access functions */
+#if PERFCOUNTERPERCENTILES_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *perfcounterpercentiles_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t PerfCounterPercentilesGet(PerfCounterPercentilesData * dataOut) {
+    return UAVObjDirectGet(perfcounterpercentiles_direct, dataOut, 0, sizeof(PerfCounterPercentilesData));
+}
+static inline int32_t PerfCounterPercentilesSet(const PerfCounterPercentilesData * dataIn) {
+    return UAVObjDirectSet(perfcounterpercentiles_direct, dataIn, 0, sizeof(PerfCounterPercentilesData));
+}
+#else
+extern int32_t PerfCounterPercentilesGet(PerfCounterPercentilesData * dataOut);
+extern int32_t PerfCounterPercentilesSet(const PerfCounterPercentilesData * dataIn);
+#endif
+#else
+static inline int32_t PerfCounterPercentilesGet(PerfCounterPercentilesData * dataOut) {
+    return UAVObjGetData(PerfCounterPercentilesHandle(), dataOut);
+}
+static inline int32_t PerfCounterPercentilesSet(const PerfCounterPercentilesData * dataIn) {
+    return UAVObjSetData(PerfCounterPercentilesHandle(), dataIn);
+}
+#endif
+static inline int32_t PerfCounterPercentilesInstGet(uint16_t instId, PerfCounterPercentilesData * dataOut) {
+    return UAVObjGetInstanceData(PerfCounterPercentilesHandle(), instId, dataOut);
+}
+static inline int32_t PerfCounterPercentilesInstSet(uint16_t instId, const PerfCounterPercentilesData * dataIn) {
+    return UAVObjSetInstanceData(PerfCounterPercentilesHandle(), instId, dataIn);
+}
+static inline int32_t PerfCounterPercentilesConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(PerfCounterPercentilesHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t PerfCounterPercentilesConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(PerfCounterPercentilesHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t PerfCounterPercentilesConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(PerfCounterPercentilesHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t PerfCounterPercentilesCreateInstance() {
+    return UAVObjCreateInstance(PerfCounterPercentilesHandle(), &PerfCounterPercentilesSetDefaults);
+}
+static inline void PerfCounterPercentilesRequestUpdate() {
+    UAVObjRequestUpdate(PerfCounterPercentilesHandle());
+}
+static inline void PerfCounterPercentilesRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(PerfCounterPercentilesHandle(), instId);
+}
+static inline void PerfCounterPercentilesUpdated() {
+    UAVObjUpdated(PerfCounterPercentilesHandle());
+}
+static inline void PerfCounterPercentilesInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(PerfCounterPercentilesHandle(), instId);
+}
+static inline void PerfCounterPercentilesLogging() {
+    UAVObjLogging(PerfCounterPercentilesHandle());
+}
+static inline void PerfCounterPercentilesInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(PerfCounterPercentilesHandle(), instId);
+}
+static inline int32_t PerfCounterPercentilesGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(PerfCounterPercentilesHandle(), dataOut);
+}
+static inline int32_t PerfCounterPercentilesSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(PerfCounterPercentilesHandle(), dataIn);
+}
+static inline int8_t PerfCounterPercentilesReadOnly() {
+    return UAVObjReadOnly(PerfCounterPercentilesHandle());
+}
+
+/* Set/Get functions */
+extern void PerfCounterPercentilesIdSet(uint32_t *NewId);
+extern void PerfCounterPercentilesIdGet(uint32_t *NewId);
+extern void PerfCounterPercentilesSamplesSet(uint32_t *NewSamples);
+extern void PerfCounterPercentilesSamplesGet(uint32_t *NewSamples);
+extern void PerfCounterPercentilesPercentileSet(PerfCounterPercentilesPercentileData *NewPercentile);
+extern void PerfCounterPercentilesPercentileGet(PerfCounterPercentilesPercentileData *NewPercentile);
+extern void PerfCounterPercentilesPercentileArraySet(int32_t *NewPercentile);
+extern void PerfCounterPercentilesPercentileArrayGet(int32_t *NewPercentile);
+
+
+#endif // PERFCOUNTERPERCENTILES_H
+
+/**
+ * @}
+ * @}
+ */
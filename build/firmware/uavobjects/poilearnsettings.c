@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PoiLearnSettings PoiLearnSettings
+ * @brief Settings for the @ref Point of Interest feature
+ *
+ * Autogenerated files and functions for PoiLearnSettings Object
+ * @{ 
+ *
+ * @file       poilearnsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PoiLearnSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: poilearnsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "poilearnsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if POILEARNSETTINGS_ISSINGLEINST
+UAVObjDirect *poilearnsettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PoiLearnSettingsInitialize(void)
+{
+    // Compile time assertion that the PoiLearnSettingsDataPacked and PoiLearnSettingsData structs
+    // have the same size (though instances of PoiLearnSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PoiLearnSettingsDataPacked) == sizeof(PoiLearnSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(POILEARNSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(POILEARNSETTINGS_OBJID,
+        POILEARNSETTINGS_ISSINGLEINST, POILEARNSETTINGS_ISSETTINGS, POILEARNSETTINGS_ISPRIORITY, POILEARNSETTINGS_NUMBYTES, &PoiLearnSettingsSetDefaults);
+#if POILEARNSETTINGS_ISSINGLEINST
+    poilearnsettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PoiLearnSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PoiLearnSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PoiLearnSettingsData));
+    data.Input = 6;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PoiLearnSettingsHandle()
+{
+    return handle;
+}
+
+#if POILEARNSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t PoiLearnSettingsGet(PoiLearnSettingsData *dataOut)
+{
+    return UAVObjDirectGet(poilearnsettings_direct, dataOut, 0, sizeof(PoiLearnSettingsData));
+}
+
+int32_t PoiLearnSettingsSet(const PoiLearnSettingsData *dataIn)
+{
+    return UAVObjDirectSet(poilearnsettings_direct, dataIn, 0, sizeof(PoiLearnSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void PoiLearnSettingsInputSet(PoiLearnSettingsInputOptions *NewInput)
+{
+    UAVObjDirectSet(poilearnsettings_direct, (void *)NewInput, offsetof(PoiLearnSettingsData, Input), sizeof(PoiLearnSettingsInputOptions));
+}
+void PoiLearnSettingsInputGet(PoiLearnSettingsInputOptions *NewInput)
+{
+    UAVObjDirectGet(poilearnsettings_direct, (void *)NewInput, offsetof(PoiLearnSettingsData, Input), sizeof(PoiLearnSettingsInputOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
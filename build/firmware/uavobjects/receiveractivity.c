@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup ReceiverActivity ReceiverActivity
+ * @brief Monitors which receiver channels have been active within the last second.
+ *
+ * Autogenerated files and functions for ReceiverActivity Object
+ * @{ 
+ *
+ * @file       receiveractivity.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ReceiverActivity object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: receiveractivity.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "receiveractivity.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if RECEIVERACTIVITY_ISSINGLEINST
+UAVObjDirect *receiveractivity_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ReceiverActivityInitialize(void)
+{
+    // Compile time assertion that the ReceiverActivityDataPacked and ReceiverActivityData structs
+    // have the same size (though instances of ReceiverActivityData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(ReceiverActivityDataPacked) == sizeof(ReceiverActivityData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(RECEIVERACTIVITY_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(RECEIVERACTIVITY_OBJID,
+        RECEIVERACTIVITY_ISSINGLEINST, RECEIVERACTIVITY_ISSETTINGS, RECEIVERACTIVITY_ISPRIORITY, RECEIVERACTIVITY_NUMBYTES, &ReceiverActivitySetDefaults);
+#if RECEIVERACTIVITY_ISSINGLEINST
+    receiveractivity_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ReceiverActivitySetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    ReceiverActivityData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(ReceiverActivityData));
+    data.ActiveGroup = 13;
+    data.ActiveChannel = 255;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ReceiverActivityHandle()
+{
+    return handle;
+}
+
+#if RECEIVERACTIVITY_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t ReceiverActivityGet(ReceiverActivityData *dataOut)
+{
+    return UAVObjDirectGet(receiveractivity_direct, dataOut, 0, sizeof(ReceiverActivityData));
+}
+
+int32_t ReceiverActivitySet(const ReceiverActivityData *dataIn)
+{
+    return UAVObjDirectSet(receiveractivity_direct, dataIn, 0, sizeof(ReceiverActivityData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void ReceiverActivityActiveGroupSet(ReceiverActivityActiveGroupOptions *NewActiveGroup)
+{
+    UAVObjDirectSet(receiveractivity_direct, (void *)NewActiveGroup, offsetof(ReceiverActivityData, ActiveGroup), sizeof(ReceiverActivityActiveGroupOptions));
+}
+void ReceiverActivityActiveGroupGet(ReceiverActivityActiveGroupOptions *NewActiveGroup)
+{
+    UAVObjDirectGet(receiveractivity_direct, (void *)NewActiveGroup, offsetof(ReceiverActivityData, ActiveGroup), sizeof(ReceiverActivityActiveGroupOptions));
+}
+void ReceiverActivityActiveChannelSet(uint8_t *NewActiveChannel)
+{
+    UAVObjDirectSet(receiveractivity_direct, (void *)NewActiveChannel, offsetof(ReceiverActivityData, ActiveChannel), sizeof(uint8_t));
+}
+void ReceiverActivityActiveChannelGet(uint8_t *NewActiveChannel)
+{
+    UAVObjDirectGet(receiveractivity_direct, (void *)NewActiveChannel, offsetof(ReceiverActivityData, ActiveChannel), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup SonarAltitude SonarAltitude
+ * @brief The raw data from the ultrasound sonar sensor with altitude estimate.
+ *
+ * Autogenerated files and functions for SonarAltitude Object
+ * @{ 
+ *
+ * @file       sonaraltitude.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the SonarAltitude object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: sonaraltitude.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "sonaraltitude.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if SONARALTITUDE_ISSINGLEINST
+UAVObjDirect *sonaraltitude_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SonarAltitudeInitialize(void)
+{
+    // Compile time assertion that the SonarAltitudeDataPacked and SonarAltitudeData structs
+    // have the same size (though instances of SonarAltitudeData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(SonarAltitudeDataPacked) == sizeof(SonarAltitudeData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(SONARALTITUDE_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(SONARALTITUDE_OBJID,
+        SONARALTITUDE_ISSINGLEINST, SONARALTITUDE_ISSETTINGS, SONARALTITUDE_ISPRIORITY, SONARALTITUDE_NUMBYTES, &SonarAltitudeSetDefaults);
+#if SONARALTITUDE_ISSINGLEINST
+    sonaraltitude_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SonarAltitudeSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    SonarAltitudeData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(SonarAltitudeData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SonarAltitudeHandle()
+{
+    return handle;
+}
+
+#if SONARALTITUDE_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t SonarAltitudeGet(SonarAltitudeData *dataOut)
+{
+    return UAVObjDirectGet(sonaraltitude_direct, dataOut, 0, sizeof(SonarAltitudeData));
+}
+
+int32_t SonarAltitudeSet(const SonarAltitudeData *dataIn)
+{
+    return UAVObjDirectSet(sonaraltitude_direct, dataIn, 0, sizeof(SonarAltitudeData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void SonarAltitudeAltitudeSet(float *NewAltitude)
+{
+    UAVObjDirectSet(sonaraltitude_direct, (void *)NewAltitude, offsetof(SonarAltitudeData, Altitude), sizeof(float));
+}
+void SonarAltitudeAltitudeGet(float *NewAltitude)
+{
+    UAVObjDirectGet(sonaraltitude_direct, (void *)NewAltitude, offsetof(SonarAltitudeData, Altitude), sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,473 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup VtolPathFollowerSettings VtolPathFollowerSettings
+ * @brief Settings for the @ref VtolPathFollowerModule
+ *
+ * Autogenerated files and functions for VtolPathFollowerSettings Object
+ * @{ 
+ *
+ * @file       vtolpathfollowersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the VtolPathFollowerSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vtolpathfollowersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "vtolpathfollowersettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST
+UAVObjDirect *vtolpathfollowersettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VtolPathFollowerSettingsInitialize(void)
+{
+    // Compile time assertion that the VtolPathFollowerSettingsDataPacked and VtolPathFollowerSettingsData structs
+    // have the same size (though instances of VtolPathFollowerSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(VtolPathFollowerSettingsDataPacked) == sizeof(VtolPathFollowerSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(VTOLPATHFOLLOWERSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(VTOLPATHFOLLOWERSETTINGS_OBJID,
+        VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST, VTOLPATHFOLLOWERSETTINGS_ISSETTINGS, VTOLPATHFOLLOWERSETTINGS_ISPRIORITY, VTOLPATHFOLLOWERSETTINGS_NUMBYTES, &VtolPathFollowerSettingsSetDefaults);
+#if VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST
+    vtolpathfollowersettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VtolPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    VtolPathFollowerSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(VtolPathFollowerSettingsData));
+    data.HorizontalVelMax = 1.000000e+01f;
+    data.VerticalVelMax = 4.000000e+00f;
+    data.CourseFeedForward = 1.000000e+00f;
+    data.HorizontalPosP = 2.500000e-01f;
+    data.VerticalPosP = 3.000000e-01f;
+    data.HorizontalVelPID.Kp = 8.000000e+00f;
+    data.HorizontalVelPID.Ki = 5.000000e-01f;
+    data.HorizontalVelPID.Kd = 1.000000e-03f;
+    data.HorizontalVelPID.Beta = 9.500000e-01f;
+    data.VerticalVelPID.Kp = 1.500000e-01f;
+    data.VerticalVelPID.Ki = 2.500000e-01f;
+    data.VerticalVelPID.Kd = 5.000000e-03f;
+    data.VerticalVelPID.Beta = 9.500000e-01f;
+    data.ThrustLimits.Min = 2.000000e-01f;
+    data.ThrustLimits.Neutral = 5.000000e-01f;
+    data.ThrustLimits.Max = 9.000000e-01f;
+    data.VelocityFeedforward = 2.000000e+00f;
+    data.FlyawayEmergencyFallbackTriggerTime = 1.000000e+01f;
+    data.EmergencyFallbackAttitude.Roll = 0.000000e+00f;
+    data.EmergencyFallbackAttitude.Pitch = -2.000000e+01f;
+    data.EmergencyFallbackYawRate.kP = 2.000000e+00f;
+    data.EmergencyFallbackYawRate.Max = 3.000000e+01f;
+    data.MaxRollPitch = 2.500000e+01f;
+    data.BrakeRate = 2.500000e+00f;
+    data.BrakeMaxPitch = 2.500000e+01f;
+    data.BrakeHorizontalVelPID.Kp = 1.800000e+01f;
+    data.BrakeHorizontalVelPID.Ki = 0.000000e+00f;
+    data.BrakeHorizontalVelPID.Kd = 1.000000e-03f;
+    data.BrakeHorizontalVelPID.Beta = 9.500000e-01f;
+    data.BrakeVelocityFeedforward = 0.000000e+00f;
+    data.LandVerticalVelPID.Kp = 4.200000e-01f;
+    data.LandVerticalVelPID.Ki = 3.000000e+00f;
+    data.LandVerticalVelPID.Kd = 2.000000e-02f;
+    data.LandVerticalVelPID.Beta = 9.500000e-01f;
+    data.AutoTakeoffVerticalVelPID.Kp = 4.200000e-01f;
+    data.AutoTakeoffVerticalVelPID.Ki = 3.000000e+00f;
+    data.AutoTakeoffVerticalVelPID.Kd = 2.000000e-02f;
+    data.AutoTakeoffVerticalVelPID.Beta = 9.500000e-01f;
+    data.VelocityRoamMaxRollPitch = 2.000000e+01f;
+    data.VelocityRoamHorizontalVelPID.Kp = 1.200000e+01f;
+    data.VelocityRoamHorizontalVelPID.Ki = 5.000000e-01f;
+    data.VelocityRoamHorizontalVelPID.Kd = 1.000000e-03f;
+    data.VelocityRoamHorizontalVelPID.Beta = 9.500000e-01f;
+    data.UpdatePeriod = 20;
+    data.TreatCustomCraftAs = 0;
+    data.ThrustControl = 1;
+    data.YawControl = 0;
+    data.FlyawayEmergencyFallback = 1;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VtolPathFollowerSettingsHandle()
+{
+    return handle;
+}
+
+#if VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t VtolPathFollowerSettingsGet(VtolPathFollowerSettingsData *dataOut)
+{
+    return UAVObjDirectGet(vtolpathfollowersettings_direct, dataOut, 0, sizeof(VtolPathFollowerSettingsData));
+}
+
+int32_t VtolPathFollowerSettingsSet(const VtolPathFollowerSettingsData *dataIn)
+{
+    return UAVObjDirectSet(vtolpathfollowersettings_direct, dataIn, 0, sizeof(VtolPathFollowerSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void VtolPathFollowerSettingsHorizontalVelMaxSet(float *NewHorizontalVelMax)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelMax, offsetof(VtolPathFollowerSettingsData, HorizontalVelMax), sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelMaxGet(float *NewHorizontalVelMax)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelMax, offsetof(VtolPathFollowerSettingsData, HorizontalVelMax), sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalVelMaxSet(float *NewVerticalVelMax)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalVelMax, offsetof(VtolPathFollowerSettingsData, VerticalVelMax), sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalVelMaxGet(float *NewVerticalVelMax)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalVelMax, offsetof(VtolPathFollowerSettingsData, VerticalVelMax), sizeof(float));
+}
+void VtolPathFollowerSettingsCourseFeedForwardSet(float *NewCourseFeedForward)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewCourseFeedForward, offsetof(VtolPathFollowerSettingsData, CourseFeedForward), sizeof(float));
+}
+void VtolPathFollowerSettingsCourseFeedForwardGet(float *NewCourseFeedForward)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewCourseFeedForward, offsetof(VtolPathFollowerSettingsData, CourseFeedForward), sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalPosPSet(float *NewHorizontalPosP)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalPosP, offsetof(VtolPathFollowerSettingsData, HorizontalPosP), sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalPosPGet(float *NewHorizontalPosP)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalPosP, offsetof(VtolPathFollowerSettingsData, HorizontalPosP), sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalPosPSet(float *NewVerticalPosP)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalPosP, offsetof(VtolPathFollowerSettingsData, VerticalPosP), sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalPosPGet(float *NewVerticalPosP)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalPosP, offsetof(VtolPathFollowerSettingsData, VerticalPosP), sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelPIDSet(VtolPathFollowerSettingsHorizontalVelPIDData *NewHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelPIDGet(VtolPathFollowerSettingsHorizontalVelPIDData *NewHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelPIDArraySet(float *NewHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelPIDArrayGet(float *NewHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalVelPIDSet(VtolPathFollowerSettingsVerticalVelPIDData *NewVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalVelPIDGet(VtolPathFollowerSettingsVerticalVelPIDData *NewVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalVelPIDArraySet(float *NewVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVerticalVelPIDArrayGet(float *NewVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsThrustLimitsSet(VtolPathFollowerSettingsThrustLimitsData *NewThrustLimits)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void VtolPathFollowerSettingsThrustLimitsGet(VtolPathFollowerSettingsThrustLimitsData *NewThrustLimits)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void VtolPathFollowerSettingsThrustLimitsArraySet(float *NewThrustLimits)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void VtolPathFollowerSettingsThrustLimitsArrayGet(float *NewThrustLimits)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityFeedforwardSet(float *NewVelocityFeedforward)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityFeedforwardGet(float *NewVelocityFeedforward)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsFlyawayEmergencyFallbackTriggerTimeSet(float *NewFlyawayEmergencyFallbackTriggerTime)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallbackTriggerTime, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallbackTriggerTime), sizeof(float));
+}
+void VtolPathFollowerSettingsFlyawayEmergencyFallbackTriggerTimeGet(float *NewFlyawayEmergencyFallbackTriggerTime)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallbackTriggerTime, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallbackTriggerTime), sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackAttitudeSet(VtolPathFollowerSettingsEmergencyFallbackAttitudeData *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackAttitudeGet(VtolPathFollowerSettingsEmergencyFallbackAttitudeData *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackAttitudeArraySet(float *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackAttitudeArrayGet(float *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackYawRateSet(VtolPathFollowerSettingsEmergencyFallbackYawRateData *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackYawRateGet(VtolPathFollowerSettingsEmergencyFallbackYawRateData *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackYawRateArraySet(float *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsEmergencyFallbackYawRateArrayGet(float *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+void VtolPathFollowerSettingsMaxRollPitchSet(float *NewMaxRollPitch)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewMaxRollPitch, offsetof(VtolPathFollowerSettingsData, MaxRollPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsMaxRollPitchGet(float *NewMaxRollPitch)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewMaxRollPitch, offsetof(VtolPathFollowerSettingsData, MaxRollPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeRateSet(float *NewBrakeRate)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeRate, offsetof(VtolPathFollowerSettingsData, BrakeRate), sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeRateGet(float *NewBrakeRate)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeRate, offsetof(VtolPathFollowerSettingsData, BrakeRate), sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeMaxPitchSet(float *NewBrakeMaxPitch)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeMaxPitch, offsetof(VtolPathFollowerSettingsData, BrakeMaxPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeMaxPitchGet(float *NewBrakeMaxPitch)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeMaxPitch, offsetof(VtolPathFollowerSettingsData, BrakeMaxPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeHorizontalVelPIDSet(VtolPathFollowerSettingsBrakeHorizontalVelPIDData *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeHorizontalVelPIDGet(VtolPathFollowerSettingsBrakeHorizontalVelPIDData *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeHorizontalVelPIDArraySet(float *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeHorizontalVelPIDArrayGet(float *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeVelocityFeedforwardSet(float *NewBrakeVelocityFeedforward)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, BrakeVelocityFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsBrakeVelocityFeedforwardGet(float *NewBrakeVelocityFeedforward)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, BrakeVelocityFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsLandVerticalVelPIDSet(VtolPathFollowerSettingsLandVerticalVelPIDData *NewLandVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsLandVerticalVelPIDGet(VtolPathFollowerSettingsLandVerticalVelPIDData *NewLandVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsLandVerticalVelPIDArraySet(float *NewLandVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsLandVerticalVelPIDArrayGet(float *NewLandVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDSet(VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDGet(VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDArraySet(float *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDArrayGet(float *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityRoamMaxRollPitchSet(float *NewVelocityRoamMaxRollPitch)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamMaxRollPitch, offsetof(VtolPathFollowerSettingsData, VelocityRoamMaxRollPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityRoamMaxRollPitchGet(float *NewVelocityRoamMaxRollPitch)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamMaxRollPitch, offsetof(VtolPathFollowerSettingsData, VelocityRoamMaxRollPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDSet(VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDGet(VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDArraySet(float *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDArrayGet(float *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsUpdatePeriodSet(uint16_t *NewUpdatePeriod)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewUpdatePeriod, offsetof(VtolPathFollowerSettingsData, UpdatePeriod), sizeof(uint16_t));
+}
+void VtolPathFollowerSettingsUpdatePeriodGet(uint16_t *NewUpdatePeriod)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewUpdatePeriod, offsetof(VtolPathFollowerSettingsData, UpdatePeriod), sizeof(uint16_t));
+}
+void VtolPathFollowerSettingsTreatCustomCraftAsSet(VtolPathFollowerSettingsTreatCustomCraftAsOptions *NewTreatCustomCraftAs)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewTreatCustomCraftAs, offsetof(VtolPathFollowerSettingsData, TreatCustomCraftAs), sizeof(VtolPathFollowerSettingsTreatCustomCraftAsOptions));
+}
+void VtolPathFollowerSettingsTreatCustomCraftAsGet(VtolPathFollowerSettingsTreatCustomCraftAsOptions *NewTreatCustomCraftAs)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewTreatCustomCraftAs, offsetof(VtolPathFollowerSettingsData, TreatCustomCraftAs), sizeof(VtolPathFollowerSettingsTreatCustomCraftAsOptions));
+}
+void VtolPathFollowerSettingsThrustControlSet(VtolPathFollowerSettingsThrustControlOptions *NewThrustControl)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewThrustControl, offsetof(VtolPathFollowerSettingsData, ThrustControl), sizeof(VtolPathFollowerSettingsThrustControlOptions));
+}
+void VtolPathFollowerSettingsThrustControlGet(VtolPathFollowerSettingsThrustControlOptions *NewThrustControl)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewThrustControl, offsetof(VtolPathFollowerSettingsData, ThrustControl), sizeof(VtolPathFollowerSettingsThrustControlOptions));
+}
+void VtolPathFollowerSettingsYawControlSet(VtolPathFollowerSettingsYawControlOptions *NewYawControl)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewYawControl, offsetof(VtolPathFollowerSettingsData, YawControl), sizeof(VtolPathFollowerSettingsYawControlOptions));
+}
+void VtolPathFollowerSettingsYawControlGet(VtolPathFollowerSettingsYawControlOptions *NewYawControl)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewYawControl, offsetof(VtolPathFollowerSettingsData, YawControl), sizeof(VtolPathFollowerSettingsYawControlOptions));
+}
+void VtolPathFollowerSettingsFlyawayEmergencyFallbackSet(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions *NewFlyawayEmergencyFallback)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallback, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallback), sizeof(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions));
+}
+void VtolPathFollowerSettingsFlyawayEmergencyFallbackGet(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions *NewFlyawayEmergencyFallback)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallback, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallback), sizeof(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,802 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup VtolPathFollowerSettings VtolPathFollowerSettings
+ * @brief Settings for the @ref VtolPathFollowerModule
+ *
+ * Autogenerated files and functions for VtolPathFollowerSettings Object
+ *
+ * @{
+ *
+ * @file       vtolpathfollowersettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the VtolPathFollowerSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: vtolpathfollowersettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef VTOLPATHFOLLOWERSETTINGS_H
+#define VTOLPATHFOLLOWERSETTINGS_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define VTOLPATHFOLLOWERSETTINGS_OBJID 0x49B0AEBA
+#define VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST 1
+#define VTOLPATHFOLLOWERSETTINGS_ISSETTINGS 1
+#define VTOLPATHFOLLOWERSETTINGS_ISPRIORITY 0
+#define VTOLPATHFOLLOWERSETTINGS_NUMBYTES sizeof(VtolPathFollowerSettingsData)
+
+/* Generic interface functions */
+int32_t VtolPathFollowerSettingsInitialize();
+UAVObjHandle VtolPathFollowerSettingsHandle();
+void VtolPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field HorizontalVelMax information */
+
+/* Field VerticalVelMax information */
+
+/* Field CourseFeedForward information */
+
+/* Field HorizontalPosP information */
+
+/* Field VerticalPosP information */
+
+/* Field HorizontalVelPID information */
+
+// Array element names for field HorizontalVelPID
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_HORIZONTALVELPID_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_HORIZONTALVELPID_KI=1,
+    VTOLPATHFOLLOWERSETTINGS_HORIZONTALVELPID_KD=2,
+    VTOLPATHFOLLOWERSETTINGS_HORIZONTALVELPID_BETA=3
+} VtolPathFollowerSettingsHorizontalVelPIDElem;
+
+// Number of elements for field HorizontalVelPID
+#define VTOLPATHFOLLOWERSETTINGS_HORIZONTALVELPID_NUMELEM 4
+
+/* Field VerticalVelPID information */
+
+// Array element names for field VerticalVelPID
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_VERTICALVELPID_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_VERTICALVELPID_KI=1,
+    VTOLPATHFOLLOWERSETTINGS_VERTICALVELPID_KD=2,
+    VTOLPATHFOLLOWERSETTINGS_VERTICALVELPID_BETA=3
+} VtolPathFollowerSettingsVerticalVelPIDElem;
+
+// Number of elements for field VerticalVelPID
+#define VTOLPATHFOLLOWERSETTINGS_VERTICALVELPID_NUMELEM 4
+
+/* Field ThrustLimits information */
+
+// Array element names for field ThrustLimits
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_THRUSTLIMITS_MIN=0,
+    VTOLPATHFOLLOWERSETTINGS_THRUSTLIMITS_NEUTRAL=1,
+    VTOLPATHFOLLOWERSETTINGS_THRUSTLIMITS_MAX=2
+} VtolPathFollowerSettingsThrustLimitsElem;
+
+// Number of elements for field ThrustLimits
+#define VTOLPATHFOLLOWERSETTINGS_THRUSTLIMITS_NUMELEM 3
+
+/* Field VelocityFeedforward information */
+
+/* Field FlyawayEmergencyFallbackTriggerTime information */
+
+/* Field EmergencyFallbackAttitude information */
+
+// Array element names for field EmergencyFallbackAttitude
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_EMERGENCYFALLBACKATTITUDE_ROLL=0,
+    VTOLPATHFOLLOWERSETTINGS_EMERGENCYFALLBACKATTITUDE_PITCH=1
+} VtolPathFollowerSettingsEmergencyFallbackAttitudeElem;
+
+// Number of elements for field EmergencyFallbackAttitude
+#define VTOLPATHFOLLOWERSETTINGS_EMERGENCYFALLBACKATTITUDE_NUMELEM 2
+
+/* Field EmergencyFallbackYawRate information */
+
+// Array element names for field EmergencyFallbackYawRate
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_EMERGENCYFALLBACKYAWRATE_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_EMERGENCYFALLBACKYAWRATE_MAX=1
+} VtolPathFollowerSettingsEmergencyFallbackYawRateElem;
+
+// Number of elements for field EmergencyFallbackYawRate
+#define VTOLPATHFOLLOWERSETTINGS_EMERGENCYFALLBACKYAWRATE_NUMELEM 2
+
+/* Field MaxRollPitch information */
+
+/* Field BrakeRate information */
+
+/* Field BrakeMaxPitch information */
+
+/* Field BrakeHorizontalVelPID information */
+
+// Array element names for field BrakeHorizontalVelPID
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_BRAKEHORIZONTALVELPID_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_BRAKEHORIZONTALVELPID_KI=1,
+    VTOLPATHFOLLOWERSETTINGS_BRAKEHORIZONTALVELPID_KD=2,
+    VTOLPATHFOLLOWERSETTINGS_BRAKEHORIZONTALVELPID_BETA=3
+} VtolPathFollowerSettingsBrakeHorizontalVelPIDElem;
+
+// Number of elements for field BrakeHorizontalVelPID
+#define VTOLPATHFOLLOWERSETTINGS_BRAKEHORIZONTALVELPID_NUMELEM 4
+
+/* Field BrakeVelocityFeedforward information */
+
+/* Field LandVerticalVelPID information */
+
+// Array element names for field LandVerticalVelPID
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_LANDVERTICALVELPID_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_LANDVERTICALVELPID_KI=1,
+    VTOLPATHFOLLOWERSETTINGS_LANDVERTICALVELPID_KD=2,
+    VTOLPATHFOLLOWERSETTINGS_LANDVERTICALVELPID_BETA=3
+} VtolPathFollowerSettingsLandVerticalVelPIDElem;
+
+// Number of elements for field LandVerticalVelPID
+#define VTOLPATHFOLLOWERSETTINGS_LANDVERTICALVELPID_NUMELEM 4
+
+/* Field AutoTakeoffVerticalVelPID information */
+
+// Array element names for field AutoTakeoffVerticalVelPID
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_AUTOTAKEOFFVERTICALVELPID_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_AUTOTAKEOFFVERTICALVELPID_KI=1,
+    VTOLPATHFOLLOWERSETTINGS_AUTOTAKEOFFVERTICALVELPID_KD=2,
+    VTOLPATHFOLLOWERSETTINGS_AUTOTAKEOFFVERTICALVELPID_BETA=3
+} VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDElem;
+
+// Number of elements for field AutoTakeoffVerticalVelPID
+#define VTOLPATHFOLLOWERSETTINGS_AUTOTAKEOFFVERTICALVELPID_NUMELEM 4
+
+/* Field VelocityRoamMaxRollPitch information */
+
+/* Field VelocityRoamHorizontalVelPID information */
+
+// Array element names for field VelocityRoamHorizontalVelPID
+typedef enum {
+    VTOLPATHFOLLOWERSETTINGS_VELOCITYROAMHORIZONTALVELPID_KP=0,
+    VTOLPATHFOLLOWERSETTINGS_VELOCITYROAMHORIZONTALVELPID_KI=1,
+    VTOLPATHFOLLOWERSETTINGS_VELOCITYROAMHORIZONTALVELPID_KD=2,
+    VTOLPATHFOLLOWERSETTINGS_VELOCITYROAMHORIZONTALVELPID_BETA=3
+} VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDElem;
+
+// Number of elements for field VelocityRoamHorizontalVelPID
+#define VTOLPATHFOLLOWERSETTINGS_VELOCITYROAMHORIZONTALVELPID_NUMELEM 4
+
+/* Field UpdatePeriod information */
+
+/* Field TreatCustomCraftAs information */
+
+// Enumeration options for field TreatCustomCraftAs
+typedef enum __attribute__ ((__packed__)) {
+    VTOLPATHFOLLOWERSETTINGS_TREATCUSTOMCRAFTAS_FIXEDWING=0,
+    VTOLPATHFOLLOWERSETTINGS_TREATCUSTOMCRAFTAS_VTOL=1,
+    VTOLPATHFOLLOWERSETTINGS_TREATCUSTOMCRAFTAS_GROUND=2
+} VtolPathFollowerSettingsTreatCustomCraftAsOptions;
+
+/* Field ThrustControl information */
+
+// Enumeration options for field ThrustControl
+typedef enum __attribute__ ((__packed__)) {
+    VTOLPATHFOLLOWERSETTINGS_THRUSTCONTROL_MANUAL=0,
+    VTOLPATHFOLLOWERSETTINGS_THRUSTCONTROL_AUTO=1
+} VtolPathFollowerSettingsThrustControlOptions;
+
+/* Field YawControl information */
+
+// Enumeration options for field YawControl
+typedef enum __attribute__ ((__packed__)) {
+    VTOLPATHFOLLOWERSETTINGS_YAWCONTROL_MANUAL=0,
+    VTOLPATHFOLLOWERSETTINGS_YAWCONTROL_TAILIN=1,
+    VTOLPATHFOLLOWERSETTINGS_YAWCONTROL_MOVEMENTDIRECTION=2,
+    VTOLPATHFOLLOWERSETTINGS_YAWCONTROL_PATHDIRECTION=3,
+    VTOLPATHFOLLOWERSETTINGS_YAWCONTROL_POI=4
+} VtolPathFollowerSettingsYawControlOptions;
+
+/* Field FlyawayEmergencyFallback information */
+
+// Enumeration options for field FlyawayEmergencyFallback
+typedef enum __attribute__ ((__packed__)) {
+    VTOLPATHFOLLOWERSETTINGS_FLYAWAYEMERGENCYFALLBACK_DISABLED=0,
+    VTOLPATHFOLLOWERSETTINGS_FLYAWAYEMERGENCYFALLBACK_ENABLED=1,
+    VTOLPATHFOLLOWERSETTINGS_FLYAWAYEMERGENCYFALLBACK_ALWAYS=2,
+    VTOLPATHFOLLOWERSETTINGS_FLYAWAYEMERGENCYFALLBACK_DEBUGTEST=3
+} VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions;
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  VtolPathFollowerSettingsHorizontalVelPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  VtolPathFollowerSettingsHorizontalVelPIDDataArray ;
+#define VtolPathFollowerSettingsHorizontalVelPIDToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsHorizontalVelPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  VtolPathFollowerSettingsVerticalVelPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  VtolPathFollowerSettingsVerticalVelPIDDataArray ;
+#define VtolPathFollowerSettingsVerticalVelPIDToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsVerticalVelPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Min;
+    float Neutral;
+    float Max;
+}  VtolPathFollowerSettingsThrustLimitsData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  VtolPathFollowerSettingsThrustLimitsDataArray ;
+#define VtolPathFollowerSettingsThrustLimitsToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsThrustLimitsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Roll;
+    float Pitch;
+}  VtolPathFollowerSettingsEmergencyFallbackAttitudeData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[2];
+}  VtolPathFollowerSettingsEmergencyFallbackAttitudeDataArray ;
+#define VtolPathFollowerSettingsEmergencyFallbackAttitudeToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsEmergencyFallbackAttitudeData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float kP;
+    float Max;
+}  VtolPathFollowerSettingsEmergencyFallbackYawRateData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[2];
+}  VtolPathFollowerSettingsEmergencyFallbackYawRateDataArray ;
+#define VtolPathFollowerSettingsEmergencyFallbackYawRateToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsEmergencyFallbackYawRateData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  VtolPathFollowerSettingsBrakeHorizontalVelPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  VtolPathFollowerSettingsBrakeHorizontalVelPIDDataArray ;
+#define VtolPathFollowerSettingsBrakeHorizontalVelPIDToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsBrakeHorizontalVelPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  VtolPathFollowerSettingsLandVerticalVelPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  VtolPathFollowerSettingsLandVerticalVelPIDDataArray ;
+#define VtolPathFollowerSettingsLandVerticalVelPIDToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsLandVerticalVelPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDDataArray ;
+#define VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Kp;
+    float Ki;
+    float Kd;
+    float Beta;
+}  VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[4];
+}  VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDDataArray ;
+#define VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDToArray( var ) UAVObjectFieldToArray( VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float HorizontalVelMax;
+    float VerticalVelMax;
+    float CourseFeedForward;
+    float HorizontalPosP;
+    float VerticalPosP;
+    VtolPathFollowerSettingsHorizontalVelPIDData HorizontalVelPID;
+    VtolPathFollowerSettingsVerticalVelPIDData VerticalVelPID;
+    VtolPathFollowerSettingsThrustLimitsData ThrustLimits;
+    float VelocityFeedforward;
+    float FlyawayEmergencyFallbackTriggerTime;
+    VtolPathFollowerSettingsEmergencyFallbackAttitudeData EmergencyFallbackAttitude;
+    VtolPathFollowerSettingsEmergencyFallbackYawRateData EmergencyFallbackYawRate;
+    float MaxRollPitch;
+    float BrakeRate;
+    float BrakeMaxPitch;
+    VtolPathFollowerSettingsBrakeHorizontalVelPIDData BrakeHorizontalVelPID;
+    float BrakeVelocityFeedforward;
+    VtolPathFollowerSettingsLandVerticalVelPIDData LandVerticalVelPID;
+    VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData AutoTakeoffVerticalVelPID;
+    float VelocityRoamMaxRollPitch;
+    VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData VelocityRoamHorizontalVelPID;
+    uint16_t UpdatePeriod;
+    VtolPathFollowerSettingsTreatCustomCraftAsOptions TreatCustomCraftAs;
+    VtolPathFollowerSettingsThrustControlOptions ThrustControl;
+    VtolPathFollowerSettingsYawControlOptions YawControl;
+    VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions FlyawayEmergencyFallback;
+
+} __attribute__((packed)) VtolPathFollowerSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef VtolPathFollowerSettingsDataPacked __attribute__((aligned(4))) VtolPathFollowerSettingsData;
+
+/* Typesafe Object access functions */
+#if VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *vtolpathfollowersettings_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t VtolPathFollowerSettingsGet(VtolPathFollowerSettingsData * dataOut) {
+    return UAVObjDirectGet(vtolpathfollowersettings_direct, dataOut, 0, sizeof(VtolPathFollowerSettingsData));
+}
+static inline int32_t VtolPathFollowerSettingsSet(const VtolPathFollowerSettingsData * dataIn) {
+    return UAVObjDirectSet(vtolpathfollowersettings_direct, dataIn, 0, sizeof(VtolPathFollowerSettingsData));
+}
+#else
+extern int32_t VtolPathFollowerSettingsGet(VtolPathFollowerSettingsData * dataOut);
+extern int32_t VtolPathFollowerSettingsSet(const VtolPathFollowerSettingsData * dataIn);
+#endif
+#else
+static inline int32_t VtolPathFollowerSettingsGet(VtolPathFollowerSettingsData * dataOut) {
+    return UAVObjGetData(VtolPathFollowerSettingsHandle(), dataOut);
+}
+static inline int32_t VtolPathFollowerSettingsSet(const VtolPathFollowerSettingsData * dataIn) {
+    return UAVObjSetData(VtolPathFollowerSettingsHandle(), dataIn);
+}
+#endif
+static inline int32_t VtolPathFollowerSettingsInstGet(uint16_t instId, VtolPathFollowerSettingsData * dataOut) {
+    return UAVObjGetInstanceData(VtolPathFollowerSettingsHandle(), instId, dataOut);
+}
+static inline int32_t VtolPathFollowerSettingsInstSet(uint16_t instId, const VtolPathFollowerSettingsData * dataIn) {
+    return UAVObjSetInstanceData(VtolPathFollowerSettingsHandle(), instId, dataIn);
+}
+static inline int32_t VtolPathFollowerSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(VtolPathFollowerSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t VtolPathFollowerSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(VtolPathFollowerSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t VtolPathFollowerSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(VtolPathFollowerSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t VtolPathFollowerSettingsCreateInstance() {
+    return UAVObjCreateInstance(VtolPathFollowerSettingsHandle(), &VtolPathFollowerSettingsSetDefaults);
+}
+static inline void VtolPathFollowerSettingsRequestUpdate() {
+    UAVObjRequestUpdate(VtolPathFollowerSettingsHandle());
+}
+static inline void VtolPathFollowerSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(VtolPathFollowerSettingsHandle(), instId);
+}
+static inline void VtolPathFollowerSettingsUpdated() {
+    UAVObjUpdated(VtolPathFollowerSettingsHandle());
+}
+static inline void VtolPathFollowerSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(VtolPathFollowerSettingsHandle(), instId);
+}
+static inline void VtolPathFollowerSettingsLogging() {
+    UAVObjLogging(VtolPathFollowerSettingsHandle());
+}
+static inline void VtolPathFollowerSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(VtolPathFollowerSettingsHandle(), instId);
+}
+static inline int32_t VtolPathFollowerSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(VtolPathFollowerSettingsHandle(), dataOut);
+}
+static inline int32_t VtolPathFollowerSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(VtolPathFollowerSettingsHandle(), dataIn);
+}
+static inline int8_t VtolPathFollowerSettingsReadOnly() {
+    return UAVObjReadOnly(VtolPathFollowerSettingsHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void VtolPathFollowerSettingsHorizontalVelMaxSet(float *NewHorizontalVelMax)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelMax, offsetof(VtolPathFollowerSettingsData, HorizontalVelMax), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalVelMaxGet(float *NewHorizontalVelMax)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelMax, offsetof(VtolPathFollowerSettingsData, HorizontalVelMax), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalVelMaxSet(float *NewVerticalVelMax)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalVelMax, offsetof(VtolPathFollowerSettingsData, VerticalVelMax), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalVelMaxGet(float *NewVerticalVelMax)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalVelMax, offsetof(VtolPathFollowerSettingsData, VerticalVelMax), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsCourseFeedForwardSet(float *NewCourseFeedForward)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewCourseFeedForward, offsetof(VtolPathFollowerSettingsData, CourseFeedForward), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsCourseFeedForwardGet(float *NewCourseFeedForward)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewCourseFeedForward, offsetof(VtolPathFollowerSettingsData, CourseFeedForward), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalPosPSet(float *NewHorizontalPosP)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalPosP, offsetof(VtolPathFollowerSettingsData, HorizontalPosP), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalPosPGet(float *NewHorizontalPosP)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalPosP, offsetof(VtolPathFollowerSettingsData, HorizontalPosP), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalPosPSet(float *NewVerticalPosP)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalPosP, offsetof(VtolPathFollowerSettingsData, VerticalPosP), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalPosPGet(float *NewVerticalPosP)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalPosP, offsetof(VtolPathFollowerSettingsData, VerticalPosP), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalVelPIDSet(VtolPathFollowerSettingsHorizontalVelPIDData *NewHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalVelPIDGet(VtolPathFollowerSettingsHorizontalVelPIDData *NewHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalVelPIDArraySet(float *NewHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsHorizontalVelPIDArrayGet(float *NewHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalVelPIDSet(VtolPathFollowerSettingsVerticalVelPIDData *NewVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalVelPIDGet(VtolPathFollowerSettingsVerticalVelPIDData *NewVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalVelPIDArraySet(float *NewVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVerticalVelPIDArrayGet(float *NewVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVerticalVelPID, offsetof(VtolPathFollowerSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsThrustLimitsSet(VtolPathFollowerSettingsThrustLimitsData *NewThrustLimits)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsThrustLimitsGet(VtolPathFollowerSettingsThrustLimitsData *NewThrustLimits)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsThrustLimitsArraySet(float *NewThrustLimits)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsThrustLimitsArrayGet(float *NewThrustLimits)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewThrustLimits, offsetof(VtolPathFollowerSettingsData, ThrustLimits), 3*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityFeedforwardSet(float *NewVelocityFeedforward)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityFeedforwardGet(float *NewVelocityFeedforward)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsFlyawayEmergencyFallbackTriggerTimeSet(float *NewFlyawayEmergencyFallbackTriggerTime)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallbackTriggerTime, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallbackTriggerTime), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsFlyawayEmergencyFallbackTriggerTimeGet(float *NewFlyawayEmergencyFallbackTriggerTime)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallbackTriggerTime, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallbackTriggerTime), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackAttitudeSet(VtolPathFollowerSettingsEmergencyFallbackAttitudeData *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackAttitudeGet(VtolPathFollowerSettingsEmergencyFallbackAttitudeData *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackAttitudeArraySet(float *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackAttitudeArrayGet(float *NewEmergencyFallbackAttitude)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackAttitude, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackAttitude), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackYawRateSet(VtolPathFollowerSettingsEmergencyFallbackYawRateData *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackYawRateGet(VtolPathFollowerSettingsEmergencyFallbackYawRateData *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackYawRateArraySet(float *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsEmergencyFallbackYawRateArrayGet(float *NewEmergencyFallbackYawRate)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewEmergencyFallbackYawRate, offsetof(VtolPathFollowerSettingsData, EmergencyFallbackYawRate), 2*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsMaxRollPitchSet(float *NewMaxRollPitch)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewMaxRollPitch, offsetof(VtolPathFollowerSettingsData, MaxRollPitch), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsMaxRollPitchGet(float *NewMaxRollPitch)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewMaxRollPitch, offsetof(VtolPathFollowerSettingsData, MaxRollPitch), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeRateSet(float *NewBrakeRate)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeRate, offsetof(VtolPathFollowerSettingsData, BrakeRate), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeRateGet(float *NewBrakeRate)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeRate, offsetof(VtolPathFollowerSettingsData, BrakeRate), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeMaxPitchSet(float *NewBrakeMaxPitch)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeMaxPitch, offsetof(VtolPathFollowerSettingsData, BrakeMaxPitch), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeMaxPitchGet(float *NewBrakeMaxPitch)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeMaxPitch, offsetof(VtolPathFollowerSettingsData, BrakeMaxPitch), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeHorizontalVelPIDSet(VtolPathFollowerSettingsBrakeHorizontalVelPIDData *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeHorizontalVelPIDGet(VtolPathFollowerSettingsBrakeHorizontalVelPIDData *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeHorizontalVelPIDArraySet(float *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeHorizontalVelPIDArrayGet(float *NewBrakeHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, BrakeHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeVelocityFeedforwardSet(float *NewBrakeVelocityFeedforward)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewBrakeVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, BrakeVelocityFeedforward), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsBrakeVelocityFeedforwardGet(float *NewBrakeVelocityFeedforward)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewBrakeVelocityFeedforward, offsetof(VtolPathFollowerSettingsData, BrakeVelocityFeedforward), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsLandVerticalVelPIDSet(VtolPathFollowerSettingsLandVerticalVelPIDData *NewLandVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsLandVerticalVelPIDGet(VtolPathFollowerSettingsLandVerticalVelPIDData *NewLandVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsLandVerticalVelPIDArraySet(float *NewLandVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsLandVerticalVelPIDArrayGet(float *NewLandVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewLandVerticalVelPID, offsetof(VtolPathFollowerSettingsData, LandVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDSet(VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDGet(VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDArraySet(float *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDArrayGet(float *NewAutoTakeoffVerticalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewAutoTakeoffVerticalVelPID, offsetof(VtolPathFollowerSettingsData, AutoTakeoffVerticalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityRoamMaxRollPitchSet(float *NewVelocityRoamMaxRollPitch)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamMaxRollPitch, offsetof(VtolPathFollowerSettingsData, VelocityRoamMaxRollPitch), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityRoamMaxRollPitchGet(float *NewVelocityRoamMaxRollPitch)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamMaxRollPitch, offsetof(VtolPathFollowerSettingsData, VelocityRoamMaxRollPitch), sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDSet(VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDGet(VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDArraySet(float *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDArrayGet(float *NewVelocityRoamHorizontalVelPID)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewVelocityRoamHorizontalVelPID, offsetof(VtolPathFollowerSettingsData, VelocityRoamHorizontalVelPID), 4*sizeof(float));
+}
+static inline void VtolPathFollowerSettingsUpdatePeriodSet(uint16_t *NewUpdatePeriod)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewUpdatePeriod, offsetof(VtolPathFollowerSettingsData, UpdatePeriod), sizeof(uint16_t));
+}
+static inline void VtolPathFollowerSettingsUpdatePeriodGet(uint16_t *NewUpdatePeriod)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewUpdatePeriod, offsetof(VtolPathFollowerSettingsData, UpdatePeriod), sizeof(uint16_t));
+}
+static inline void VtolPathFollowerSettingsTreatCustomCraftAsSet(VtolPathFollowerSettingsTreatCustomCraftAsOptions *NewTreatCustomCraftAs)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewTreatCustomCraftAs, offsetof(VtolPathFollowerSettingsData, TreatCustomCraftAs), sizeof(VtolPathFollowerSettingsTreatCustomCraftAsOptions));
+}
+static inline void VtolPathFollowerSettingsTreatCustomCraftAsGet(VtolPathFollowerSettingsTreatCustomCraftAsOptions *NewTreatCustomCraftAs)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewTreatCustomCraftAs, offsetof(VtolPathFollowerSettingsData, TreatCustomCraftAs), sizeof(VtolPathFollowerSettingsTreatCustomCraftAsOptions));
+}
+static inline void VtolPathFollowerSettingsThrustControlSet(VtolPathFollowerSettingsThrustControlOptions *NewThrustControl)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewThrustControl, offsetof(VtolPathFollowerSettingsData, ThrustControl), sizeof(VtolPathFollowerSettingsThrustControlOptions));
+}
+static inline void VtolPathFollowerSettingsThrustControlGet(VtolPathFollowerSettingsThrustControlOptions *NewThrustControl)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewThrustControl, offsetof(VtolPathFollowerSettingsData, ThrustControl), sizeof(VtolPathFollowerSettingsThrustControlOptions));
+}
+static inline void VtolPathFollowerSettingsYawControlSet(VtolPathFollowerSettingsYawControlOptions *NewYawControl)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewYawControl, offsetof(VtolPathFollowerSettingsData, YawControl), sizeof(VtolPathFollowerSettingsYawControlOptions));
+}
+static inline void VtolPathFollowerSettingsYawControlGet(VtolPathFollowerSettingsYawControlOptions *NewYawControl)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewYawControl, offsetof(VtolPathFollowerSettingsData, YawControl), sizeof(VtolPathFollowerSettingsYawControlOptions));
+}
+static inline void VtolPathFollowerSettingsFlyawayEmergencyFallbackSet(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions *NewFlyawayEmergencyFallback)
+{
+    UAVObjDirectSet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallback, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallback), sizeof(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions));
+}
+static inline void VtolPathFollowerSettingsFlyawayEmergencyFallbackGet(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions *NewFlyawayEmergencyFallback)
+{
+    UAVObjDirectGet(vtolpathfollowersettings_direct, (void *)NewFlyawayEmergencyFallback, offsetof(VtolPathFollowerSettingsData, FlyawayEmergencyFallback), sizeof(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions));
+}
+#else
+extern void VtolPathFollowerSettingsHorizontalVelMaxSet(float *NewHorizontalVelMax);
+extern void VtolPathFollowerSettingsHorizontalVelMaxGet(float *NewHorizontalVelMax);
+extern void VtolPathFollowerSettingsVerticalVelMaxSet(float *NewVerticalVelMax);
+extern void VtolPathFollowerSettingsVerticalVelMaxGet(float *NewVerticalVelMax);
+extern void VtolPathFollowerSettingsCourseFeedForwardSet(float *NewCourseFeedForward);
+extern void VtolPathFollowerSettingsCourseFeedForwardGet(float *NewCourseFeedForward);
+extern void VtolPathFollowerSettingsHorizontalPosPSet(float *NewHorizontalPosP);
+extern void VtolPathFollowerSettingsHorizontalPosPGet(float *NewHorizontalPosP);
+extern void VtolPathFollowerSettingsVerticalPosPSet(float *NewVerticalPosP);
+extern void VtolPathFollowerSettingsVerticalPosPGet(float *NewVerticalPosP);
+extern void VtolPathFollowerSettingsHorizontalVelPIDSet(VtolPathFollowerSettingsHorizontalVelPIDData *NewHorizontalVelPID);
+extern void VtolPathFollowerSettingsHorizontalVelPIDGet(VtolPathFollowerSettingsHorizontalVelPIDData *NewHorizontalVelPID);
+extern void VtolPathFollowerSettingsHorizontalVelPIDArraySet(float *NewHorizontalVelPID);
+extern void VtolPathFollowerSettingsHorizontalVelPIDArrayGet(float *NewHorizontalVelPID);
+extern void VtolPathFollowerSettingsVerticalVelPIDSet(VtolPathFollowerSettingsVerticalVelPIDData *NewVerticalVelPID);
+extern void VtolPathFollowerSettingsVerticalVelPIDGet(VtolPathFollowerSettingsVerticalVelPIDData *NewVerticalVelPID);
+extern void VtolPathFollowerSettingsVerticalVelPIDArraySet(float *NewVerticalVelPID);
+extern void VtolPathFollowerSettingsVerticalVelPIDArrayGet(float *NewVerticalVelPID);
+extern void VtolPathFollowerSettingsThrustLimitsSet(VtolPathFollowerSettingsThrustLimitsData *NewThrustLimits);
+extern void VtolPathFollowerSettingsThrustLimitsGet(VtolPathFollowerSettingsThrustLimitsData *NewThrustLimits);
+extern void VtolPathFollowerSettingsThrustLimitsArraySet(float *NewThrustLimits);
+extern void VtolPathFollowerSettingsThrustLimitsArrayGet(float *NewThrustLimits);
+extern void VtolPathFollowerSettingsVelocityFeedforwardSet(float *NewVelocityFeedforward);
+extern void VtolPathFollowerSettingsVelocityFeedforwardGet(float *NewVelocityFeedforward);
+extern void VtolPathFollowerSettingsFlyawayEmergencyFallbackTriggerTimeSet(float *NewFlyawayEmergencyFallbackTriggerTime);
+extern void VtolPathFollowerSettingsFlyawayEmergencyFallbackTriggerTimeGet(float *NewFlyawayEmergencyFallbackTriggerTime);
+extern void VtolPathFollowerSettingsEmergencyFallbackAttitudeSet(VtolPathFollowerSettingsEmergencyFallbackAttitudeData *NewEmergencyFallbackAttitude);
+extern void VtolPathFollowerSettingsEmergencyFallbackAttitudeGet(VtolPathFollowerSettingsEmergencyFallbackAttitudeData *NewEmergencyFallbackAttitude);
+extern void VtolPathFollowerSettingsEmergencyFallbackAttitudeArraySet(float *NewEmergencyFallbackAttitude);
+extern void VtolPathFollowerSettingsEmergencyFallbackAttitudeArrayGet(float *NewEmergencyFallbackAttitude);
+extern void VtolPathFollowerSettingsEmergencyFallbackYawRateSet(VtolPathFollowerSettingsEmergencyFallbackYawRateData *NewEmergencyFallbackYawRate);
+extern void VtolPathFollowerSettingsEmergencyFallbackYawRateGet(VtolPathFollowerSettingsEmergencyFallbackYawRateData *NewEmergencyFallbackYawRate);
+extern void VtolPathFollowerSettingsEmergencyFallbackYawRateArraySet(float *NewEmergencyFallbackYawRate);
+extern void VtolPathFollowerSettingsEmergencyFallbackYawRateArrayGet(float *NewEmergencyFallbackYawRate);
+extern void VtolPathFollowerSettingsMaxRollPitchSet(float *NewMaxRollPitch);
+extern void VtolPathFollowerSettingsMaxRollPitchGet(float *NewMaxRollPitch);
+extern void VtolPathFollowerSettingsBrakeRateSet(float *NewBrakeRate);
+extern void VtolPathFollowerSettingsBrakeRateGet(float *NewBrakeRate);
+extern void VtolPathFollowerSettingsBrakeMaxPitchSet(float *NewBrakeMaxPitch);
+extern void VtolPathFollowerSettingsBrakeMaxPitchGet(float *NewBrakeMaxPitch);
+extern void VtolPathFollowerSettingsBrakeHorizontalVelPIDSet(VtolPathFollowerSettingsBrakeHorizontalVelPIDData *NewBrakeHorizontalVelPID);
+extern void VtolPathFollowerSettingsBrakeHorizontalVelPIDGet(VtolPathFollowerSettingsBrakeHorizontalVelPIDData *NewBrakeHorizontalVelPID);
+extern void VtolPathFollowerSettingsBrakeHorizontalVelPIDArraySet(float *NewBrakeHorizontalVelPID);
+extern void VtolPathFollowerSettingsBrakeHorizontalVelPIDArrayGet(float *NewBrakeHorizontalVelPID);
+extern void VtolPathFollowerSettingsBrakeVelocityFeedforwardSet(float *NewBrakeVelocityFeedforward);
+extern void VtolPathFollowerSettingsBrakeVelocityFeedforwardGet(float *NewBrakeVelocityFeedforward);
+extern void VtolPathFollowerSettingsLandVerticalVelPIDSet(VtolPathFollowerSettingsLandVerticalVelPIDData *NewLandVerticalVelPID);
+extern void VtolPathFollowerSettingsLandVerticalVelPIDGet(VtolPathFollowerSettingsLandVerticalVelPIDData *NewLandVerticalVelPID);
+extern void VtolPathFollowerSettingsLandVerticalVelPIDArraySet(float *NewLandVerticalVelPID);
+extern void VtolPathFollowerSettingsLandVerticalVelPIDArrayGet(float *NewLandVerticalVelPID);
+extern void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDSet(VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData *NewAutoTakeoffVerticalVelPID);
+extern void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDGet(VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDData *NewAutoTakeoffVerticalVelPID);
+extern void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDArraySet(float *NewAutoTakeoffVerticalVelPID);
+extern void VtolPathFollowerSettingsAutoTakeoffVerticalVelPIDArrayGet(float *NewAutoTakeoffVerticalVelPID);
+extern void VtolPathFollowerSettingsVelocityRoamMaxRollPitchSet(float *NewVelocityRoamMaxRollPitch);
+extern void VtolPathFollowerSettingsVelocityRoamMaxRollPitchGet(float *NewVelocityRoamMaxRollPitch);
+extern void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDSet(VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData *NewVelocityRoamHorizontalVelPID);
+extern void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDGet(VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDData *NewVelocityRoamHorizontalVelPID);
+extern void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDArraySet(float *NewVelocityRoamHorizontalVelPID);
+extern void VtolPathFollowerSettingsVelocityRoamHorizontalVelPIDArrayGet(float *NewVelocityRoamHorizontalVelPID);
+extern void VtolPathFollowerSettingsUpdatePeriodSet(uint16_t *NewUpdatePeriod);
+extern void VtolPathFollowerSettingsUpdatePeriodGet(uint16_t *NewUpdatePeriod);
+extern void VtolPathFollowerSettingsTreatCustomCraftAsSet(VtolPathFollowerSettingsTreatCustomCraftAsOptions *NewTreatCustomCraftAs);
+extern void VtolPathFollowerSettingsTreatCustomCraftAsGet(VtolPathFollowerSettingsTreatCustomCraftAsOptions *NewTreatCustomCraftAs);
+extern void VtolPathFollowerSettingsThrustControlSet(VtolPathFollowerSettingsThrustControlOptions *NewThrustControl);
+extern void VtolPathFollowerSettingsThrustControlGet(VtolPathFollowerSettingsThrustControlOptions *NewThrustControl);
+extern void VtolPathFollowerSettingsYawControlSet(VtolPathFollowerSettingsYawControlOptions *NewYawControl);
+extern void VtolPathFollowerSettingsYawControlGet(VtolPathFollowerSettingsYawControlOptions *NewYawControl);
+extern void VtolPathFollowerSettingsFlyawayEmergencyFallbackSet(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions *NewFlyawayEmergencyFallback);
+extern void VtolPathFollowerSettingsFlyawayEmergencyFallbackGet(VtolPathFollowerSettingsFlyawayEmergencyFallbackOptions *NewFlyawayEmergencyFallback);
+#endif
+
+
+#endif // VTOLPATHFOLLOWERSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,301 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup ActuatorSettings ActuatorSettings
+ * @brief Settings for the @ref ActuatorModule that controls the channel assignments for the mixer based on AircraftType
+ *
+ * Autogenerated files and functions for ActuatorSettings Object
+ * @{ 
+ *
+ * @file       actuatorsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ActuatorSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: actuatorsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "actuatorsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if ACTUATORSETTINGS_ISSINGLEINST
+UAVObjDirect *actuatorsettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ActuatorSettingsInitialize(void)
+{
+    // Compile time assertion that the ActuatorSettingsDataPacked and ActuatorSettingsData structs
+    // have the same size (though instances of ActuatorSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(ActuatorSettingsDataPacked) == sizeof(ActuatorSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ACTUATORSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(ACTUATORSETTINGS_OBJID,
+        ACTUATORSETTINGS_ISSINGLEINST, ACTUATORSETTINGS_ISSETTINGS, ACTUATORSETTINGS_ISPRIORITY, ACTUATORSETTINGS_NUMBYTES, &ActuatorSettingsSetDefaults);
+#if ACTUATORSETTINGS_ISSINGLEINST
+    actuatorsettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ActuatorSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    ActuatorSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(ActuatorSettingsData));
+    data.BankUpdateFreq[0] = 50;
+    data.BankUpdateFreq[1] = 50;
+    data.BankUpdateFreq[2] = 50;
+    data.BankUpdateFreq[3] = 50;
+    data.BankUpdateFreq[4] = 50;
+    data.BankUpdateFreq[5] = 50;
+    data.ChannelMax[0] = 1000;
+    data.ChannelMax[1] = 1000;
+    data.ChannelMax[2] = 1000;
+    data.ChannelMax[3] = 1000;
+    data.ChannelMax[4] = 1000;
+    data.ChannelMax[5] = 1000;
+    data.ChannelMax[6] = 1000;
+    data.ChannelMax[7] = 1000;
+    data.ChannelMax[8] = 1000;
+    data.ChannelMax[9] = 1000;
+    data.ChannelMax[10] = 1000;
+    data.ChannelMax[11] = 1000;
+    data.ChannelNeutral[0] = 1000;
+    data.ChannelNeutral[1] = 1000;
+    data.ChannelNeutral[2] = 1000;
+    data.ChannelNeutral[3] = 1000;
+    data.ChannelNeutral[4] = 1000;
+    data.ChannelNeutral[5] = 1000;
+    data.ChannelNeutral[6] = 1000;
+    data.ChannelNeutral[7] = 1000;
+    data.ChannelNeutral[8] = 1000;
+    data.ChannelNeutral[9] = 1000;
+    data.ChannelNeutral[10] = 1000;
+    data.ChannelNeutral[11] = 1000;
+    data.ChannelMin[0] = 1000;
+    data.ChannelMin[1] = 1000;
+    data.ChannelMin[2] = 1000;
+    data.ChannelMin[3] = 1000;
+    data.ChannelMin[4] = 1000;
+    data.ChannelMin[5] = 1000;
+    data.ChannelMin[6] = 1000;
+    data.ChannelMin[7] = 1000;
+    data.ChannelMin[8] = 1000;
+    data.ChannelMin[9] = 1000;
+    data.ChannelMin[10] = 1000;
+    data.ChannelMin[11] = 1000;
+    data.BankMode[0] = 0;
+    data.BankMode[1] = 0;
+    data.BankMode[2] = 0;
+    data.BankMode[3] = 0;
+    data.BankMode[4] = 0;
+    data.BankMode[5] = 0;
+    data.ChannelType[0] = 0;
+    data.ChannelType[1] = 0;
+    data.ChannelType[2] = 0;
+    data.ChannelType[3] = 0;
+    data.ChannelType[4] = 0;
+    data.ChannelType[5] = 0;
+    data.ChannelType[6] = 0;
+    data.ChannelType[7] = 0;
+    data.ChannelType[8] = 0;
+    data.ChannelType[9] = 0;
+    data.ChannelType[10] = 0;
+    data.ChannelType[11] = 0;
+    data.ChannelAddr[0] = 0;
+    data.ChannelAddr[1] = 1;
+    data.ChannelAddr[2] = 2;
+    data.ChannelAddr[3] = 3;
+    data.ChannelAddr[4] = 4;
+    data.ChannelAddr[5] = 5;
+    data.ChannelAddr[6] = 6;
+    data.ChannelAddr[7] = 7;
+    data.ChannelAddr[8] = 8;
+    data.ChannelAddr[9] = 9;
+    data.ChannelAddr[10] = 10;
+    data.ChannelAddr[11] = 11;
+    data.MotorsSpinWhileArmed = 0;
+    data.LowThrottleZeroAxis.Roll = 0;
+    data.LowThrottleZeroAxis.Pitch = 0;
+    data.LowThrottleZeroAxis.Yaw = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ActuatorSettingsHandle()
+{
+    return handle;
+}
+
+#if ACTUATORSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t ActuatorSettingsGet(ActuatorSettingsData *dataOut)
+{
+    return UAVObjDirectGet(actuatorsettings_direct, dataOut, 0, sizeof(ActuatorSettingsData));
+}
+
+int32_t ActuatorSettingsSet(const ActuatorSettingsData *dataIn)
+{
+    return UAVObjDirectSet(actuatorsettings_direct, dataIn, 0, sizeof(ActuatorSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void ActuatorSettingsBankUpdateFreqSet(uint16_t *NewBankUpdateFreq)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewBankUpdateFreq, offsetof(ActuatorSettingsData, BankUpdateFreq), 6*sizeof(uint16_t));
+}
+void ActuatorSettingsBankUpdateFreqGet(uint16_t *NewBankUpdateFreq)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewBankUpdateFreq, offsetof(ActuatorSettingsData, BankUpdateFreq), 6*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMaxSet(int16_t *NewChannelMax)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewChannelMax, offsetof(ActuatorSettingsData, ChannelMax), 12*sizeof(int16_t));
+}
+void ActuatorSettingsChannelMaxGet(int16_t *NewChannelMax)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewChannelMax, offsetof(ActuatorSettingsData, ChannelMax), 12*sizeof(int16_t));
+}
+void ActuatorSettingsChannelNeutralSet(int16_t *NewChannelNeutral)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewChannelNeutral, offsetof(ActuatorSettingsData, ChannelNeutral), 12*sizeof(int16_t));
+}
+void ActuatorSettingsChannelNeutralGet(int16_t *NewChannelNeutral)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewChannelNeutral, offsetof(ActuatorSettingsData, ChannelNeutral), 12*sizeof(int16_t));
+}
+void ActuatorSettingsChannelMinSet(int16_t *NewChannelMin)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewChannelMin, offsetof(ActuatorSettingsData, ChannelMin), 12*sizeof(int16_t));
+}
+void ActuatorSettingsChannelMinGet(int16_t *NewChannelMin)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewChannelMin, offsetof(ActuatorSettingsData, ChannelMin), 12*sizeof(int16_t));
+}
+void ActuatorSettingsBankModeSet(ActuatorSettingsBankModeOptions *NewBankMode)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewBankMode, offsetof(ActuatorSettingsData, BankMode), 6*sizeof(ActuatorSettingsBankModeOptions));
+}
+void ActuatorSettingsBankModeGet(ActuatorSettingsBankModeOptions *NewBankMode)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewBankMode, offsetof(ActuatorSettingsData, BankMode), 6*sizeof(ActuatorSettingsBankModeOptions));
+}
+void ActuatorSettingsChannelTypeSet(ActuatorSettingsChannelTypeOptions *NewChannelType)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewChannelType, offsetof(ActuatorSettingsData, ChannelType), 12*sizeof(ActuatorSettingsChannelTypeOptions));
+}
+void ActuatorSettingsChannelTypeGet(ActuatorSettingsChannelTypeOptions *NewChannelType)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewChannelType, offsetof(ActuatorSettingsData, ChannelType), 12*sizeof(ActuatorSettingsChannelTypeOptions));
+}
+void ActuatorSettingsChannelAddrSet(uint8_t *NewChannelAddr)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewChannelAddr, offsetof(ActuatorSettingsData, ChannelAddr), 12*sizeof(uint8_t));
+}
+void ActuatorSettingsChannelAddrGet(uint8_t *NewChannelAddr)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewChannelAddr, offsetof(ActuatorSettingsData, ChannelAddr), 12*sizeof(uint8_t));
+}
+void ActuatorSettingsMotorsSpinWhileArmedSet(ActuatorSettingsMotorsSpinWhileArmedOptions *NewMotorsSpinWhileArmed)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewMotorsSpinWhileArmed, offsetof(ActuatorSettingsData, MotorsSpinWhileArmed), sizeof(ActuatorSettingsMotorsSpinWhileArmedOptions));
+}
+void ActuatorSettingsMotorsSpinWhileArmedGet(ActuatorSettingsMotorsSpinWhileArmedOptions *NewMotorsSpinWhileArmed)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewMotorsSpinWhileArmed, offsetof(ActuatorSettingsData, MotorsSpinWhileArmed), sizeof(ActuatorSettingsMotorsSpinWhileArmedOptions));
+}
+void ActuatorSettingsLowThrottleZeroAxisSet(ActuatorSettingsLowThrottleZeroAxisData *NewLowThrottleZeroAxis)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewLowThrottleZeroAxis, offsetof(ActuatorSettingsData, LowThrottleZeroAxis), 3*sizeof(ActuatorSettingsLowThrottleZeroAxisOptions));
+}
+void ActuatorSettingsLowThrottleZeroAxisGet(ActuatorSettingsLowThrottleZeroAxisData *NewLowThrottleZeroAxis)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewLowThrottleZeroAxis, offsetof(ActuatorSettingsData, LowThrottleZeroAxis), 3*sizeof(ActuatorSettingsLowThrottleZeroAxisOptions));
+}
+void ActuatorSettingsLowThrottleZeroAxisArraySet(ActuatorSettingsLowThrottleZeroAxisOptions *NewLowThrottleZeroAxis)
+{
+    UAVObjDirectSet(actuatorsettings_direct, (void *)NewLowThrottleZeroAxis, offsetof(ActuatorSettingsData, LowThrottleZeroAxis), 3*sizeof(ActuatorSettingsLowThrottleZeroAxisOptions));
+}
+void ActuatorSettingsLowThrottleZeroAxisArrayGet(ActuatorSettingsLowThrottleZeroAxisOptions *NewLowThrottleZeroAxis)
+{
+    UAVObjDirectGet(actuatorsettings_direct, (void *)NewLowThrottleZeroAxis, offsetof(ActuatorSettingsData, LowThrottleZeroAxis), 3*sizeof(ActuatorSettingsLowThrottleZeroAxisOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AltitudeHoldSettings AltitudeHoldSettings
+ * @brief Settings for the @ref AltitudeHold module
+ *
+ * Autogenerated files and functions for AltitudeHoldSettings Object
+ * @{ 
+ *
+ * @file       altitudeholdsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AltitudeHoldSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: altitudeholdsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "altitudeholdsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if ALTITUDEHOLDSETTINGS_ISSINGLEINST
+UAVObjDirect *altitudeholdsettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AltitudeHoldSettingsInitialize(void)
+{
+    // Compile time assertion that the AltitudeHoldSettingsDataPacked and AltitudeHoldSettingsData structs
+    // have the same size (though instances of AltitudeHoldSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AltitudeHoldSettingsDataPacked) == sizeof(AltitudeHoldSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(ALTITUDEHOLDSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(ALTITUDEHOLDSETTINGS_OBJID,
+        ALTITUDEHOLDSETTINGS_ISSINGLEINST, ALTITUDEHOLDSETTINGS_ISSETTINGS, ALTITUDEHOLDSETTINGS_ISPRIORITY, ALTITUDEHOLDSETTINGS_NUMBYTES, &AltitudeHoldSettingsSetDefaults);
+#if ALTITUDEHOLDSETTINGS_ISSINGLEINST
+    altitudeholdsettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AltitudeHoldSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AltitudeHoldSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AltitudeHoldSettingsData));
+    data.ThrustRate = 5.000000e+00f;
+    data.ThrustLimits.Min = 2.000000e-01f;
+    data.ThrustLimits.Neutral = 5.000000e-01f;
+    data.ThrustLimits.Max = 9.000000e-01f;
+    data.VerticalPosP = 7.000000e-01f;
+    data.VerticalVelPID.Kp = 3.000000e-01f;
+    data.VerticalVelPID.Ki = 4.000000e-01f;
+    data.VerticalVelPID.Kd = 1.000000e-04f;
+    data.VerticalVelPID.Beta = 9.000000e-01f;
+    data.CutThrustWhenZero = 1;
+    data.ThrustExp = 128;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AltitudeHoldSettingsHandle()
+{
+    return handle;
+}
+
+#if ALTITUDEHOLDSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t AltitudeHoldSettingsGet(AltitudeHoldSettingsData *dataOut)
+{
+    return UAVObjDirectGet(altitudeholdsettings_direct, dataOut, 0, sizeof(AltitudeHoldSettingsData));
+}
+
+int32_t AltitudeHoldSettingsSet(const AltitudeHoldSettingsData *dataIn)
+{
+    return UAVObjDirectSet(altitudeholdsettings_direct, dataIn, 0, sizeof(AltitudeHoldSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void AltitudeHoldSettingsThrustRateSet(float *NewThrustRate)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewThrustRate, offsetof(AltitudeHoldSettingsData, ThrustRate), sizeof(float));
+}
+void AltitudeHoldSettingsThrustRateGet(float *NewThrustRate)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewThrustRate, offsetof(AltitudeHoldSettingsData, ThrustRate), sizeof(float));
+}
+void AltitudeHoldSettingsThrustLimitsSet(AltitudeHoldSettingsThrustLimitsData *NewThrustLimits)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewThrustLimits, offsetof(AltitudeHoldSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void AltitudeHoldSettingsThrustLimitsGet(AltitudeHoldSettingsThrustLimitsData *NewThrustLimits)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewThrustLimits, offsetof(AltitudeHoldSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void AltitudeHoldSettingsThrustLimitsArraySet(float *NewThrustLimits)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewThrustLimits, offsetof(AltitudeHoldSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void AltitudeHoldSettingsThrustLimitsArrayGet(float *NewThrustLimits)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewThrustLimits, offsetof(AltitudeHoldSettingsData, ThrustLimits), 3*sizeof(float));
+}
+void AltitudeHoldSettingsVerticalPosPSet(float *NewVerticalPosP)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewVerticalPosP, offsetof(AltitudeHoldSettingsData, VerticalPosP), sizeof(float));
+}
+void AltitudeHoldSettingsVerticalPosPGet(float *NewVerticalPosP)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewVerticalPosP, offsetof(AltitudeHoldSettingsData, VerticalPosP), sizeof(float));
+}
+void AltitudeHoldSettingsVerticalVelPIDSet(AltitudeHoldSettingsVerticalVelPIDData *NewVerticalVelPID)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewVerticalVelPID, offsetof(AltitudeHoldSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void AltitudeHoldSettingsVerticalVelPIDGet(AltitudeHoldSettingsVerticalVelPIDData *NewVerticalVelPID)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewVerticalVelPID, offsetof(AltitudeHoldSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void AltitudeHoldSettingsVerticalVelPIDArraySet(float *NewVerticalVelPID)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewVerticalVelPID, offsetof(AltitudeHoldSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void AltitudeHoldSettingsVerticalVelPIDArrayGet(float *NewVerticalVelPID)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewVerticalVelPID, offsetof(AltitudeHoldSettingsData, VerticalVelPID), 4*sizeof(float));
+}
+void AltitudeHoldSettingsCutThrustWhenZeroSet(AltitudeHoldSettingsCutThrustWhenZeroOptions *NewCutThrustWhenZero)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewCutThrustWhenZero, offsetof(AltitudeHoldSettingsData, CutThrustWhenZero), sizeof(AltitudeHoldSettingsCutThrustWhenZeroOptions));
+}
+void AltitudeHoldSettingsCutThrustWhenZeroGet(AltitudeHoldSettingsCutThrustWhenZeroOptions *NewCutThrustWhenZero)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewCutThrustWhenZero, offsetof(AltitudeHoldSettingsData, CutThrustWhenZero), sizeof(AltitudeHoldSettingsCutThrustWhenZeroOptions));
+}
+void AltitudeHoldSettingsThrustExpSet(uint8_t *NewThrustExp)
+{
+    UAVObjDirectSet(altitudeholdsettings_direct, (void *)NewThrustExp, offsetof(AltitudeHoldSettingsData, ThrustExp), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsThrustExpGet(uint8_t *NewThrustExp)
+{
+    UAVObjDirectGet(altitudeholdsettings_direct, (void *)NewThrustExp, offsetof(AltitudeHoldSettingsData, ThrustExp), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,361 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup CameraStabSettings CameraStabSettings
+ * @brief Settings for the @ref CameraStab module
+ *
+ * Autogenerated files and functions for CameraStabSettings Object
+ * @{ 
+ *
+ * @file       camerastabsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the CameraStabSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: camerastabsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "camerastabsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if CAMERASTABSETTINGS_ISSINGLEINST
+UAVObjDirect *camerastabsettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t CameraStabSettingsInitialize(void)
+{
+    // Compile time assertion that the CameraStabSettingsDataPacked and CameraStabSettingsData structs
+    // have the same size (though instances of CameraStabSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(CameraStabSettingsDataPacked) == sizeof(CameraStabSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(CAMERASTABSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(CAMERASTABSETTINGS_OBJID,
+        CAMERASTABSETTINGS_ISSINGLEINST, CAMERASTABSETTINGS_ISSETTINGS, CAMERASTABSETTINGS_ISPRIORITY, CAMERASTABSETTINGS_NUMBYTES, &CameraStabSettingsSetDefaults);
+#if CAMERASTABSETTINGS_ISSINGLEINST
+    camerastabsettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void CameraStabSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    CameraStabSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(CameraStabSettingsData));
+    data.MaxAxisLockRate = 1.000000e+00f;
+    data.MaxAccel = 500;
+    data.Input.Roll = 6;
+    data.Input.Pitch = 6;
+    data.Input.Yaw = 6;
+    data.InputRange.Roll = 20;
+    data.InputRange.Pitch = 20;
+    data.InputRange.Yaw = 20;
+    data.InputRate.Roll = 50;
+    data.InputRate.Pitch = 50;
+    data.InputRate.Yaw = 50;
+    data.StabilizationMode.Roll = 0;
+    data.StabilizationMode.Pitch = 0;
+    data.StabilizationMode.Yaw = 0;
+    data.OutputRange.Roll = 20;
+    data.OutputRange.Pitch = 20;
+    data.OutputRange.Yaw = 20;
+    data.ResponseTime.Roll = 0;
+    data.ResponseTime.Pitch = 0;
+    data.ResponseTime.Yaw = 0;
+    data.GimbalType = 0;
+    data.FeedForward.Roll = 0;
+    data.FeedForward.Pitch = 0;
+    data.FeedForward.Yaw = 0;
+    data.AccelTime.Roll = 5;
+    data.AccelTime.Pitch = 5;
+    data.AccelTime.Yaw = 5;
+    data.DecelTime.Roll = 5;
+    data.DecelTime.Pitch = 5;
+    data.DecelTime.Yaw = 5;
+    data.Servo1PitchReverse = 0;
+    data.Servo2PitchReverse = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle CameraStabSettingsHandle()
+{
+    return handle;
+}
+
+#if CAMERASTABSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t CameraStabSettingsGet(CameraStabSettingsData *dataOut)
+{
+    return UAVObjDirectGet(camerastabsettings_direct, dataOut, 0, sizeof(CameraStabSettingsData));
+}
+
+int32_t CameraStabSettingsSet(const CameraStabSettingsData *dataIn)
+{
+    return UAVObjDirectSet(camerastabsettings_direct, dataIn, 0, sizeof(CameraStabSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void CameraStabSettingsMaxAxisLockRateSet(float *NewMaxAxisLockRate)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewMaxAxisLockRate, offsetof(CameraStabSettingsData, MaxAxisLockRate), sizeof(float));
+}
+void CameraStabSettingsMaxAxisLockRateGet(float *NewMaxAxisLockRate)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewMaxAxisLockRate, offsetof(CameraStabSettingsData, MaxAxisLockRate), sizeof(float));
+}
+void CameraStabSettingsMaxAccelSet(uint16_t *NewMaxAccel)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewMaxAccel, offsetof(CameraStabSettingsData, MaxAccel), sizeof(uint16_t));
+}
+void CameraStabSettingsMaxAccelGet(uint16_t *NewMaxAccel)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewMaxAccel, offsetof(CameraStabSettingsData, MaxAccel), sizeof(uint16_t));
+}
+void CameraStabSettingsInputSet(CameraStabSettingsInputData *NewInput)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputGet(CameraStabSettingsInputData *NewInput)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputArraySet(CameraStabSettingsInputOptions *NewInput)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputArrayGet(CameraStabSettingsInputOptions *NewInput)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewInput, offsetof(CameraStabSettingsData, Input), 3*sizeof(CameraStabSettingsInputOptions));
+}
+void CameraStabSettingsInputRangeSet(CameraStabSettingsInputRangeData *NewInputRange)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRangeGet(CameraStabSettingsInputRangeData *NewInputRange)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRangeArraySet(uint8_t *NewInputRange)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRangeArrayGet(uint8_t *NewInputRange)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewInputRange, offsetof(CameraStabSettingsData, InputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateSet(CameraStabSettingsInputRateData *NewInputRate)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateGet(CameraStabSettingsInputRateData *NewInputRate)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateArraySet(uint8_t *NewInputRate)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsInputRateArrayGet(uint8_t *NewInputRate)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewInputRate, offsetof(CameraStabSettingsData, InputRate), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsStabilizationModeSet(CameraStabSettingsStabilizationModeData *NewStabilizationMode)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsStabilizationModeGet(CameraStabSettingsStabilizationModeData *NewStabilizationMode)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsStabilizationModeArraySet(CameraStabSettingsStabilizationModeOptions *NewStabilizationMode)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsStabilizationModeArrayGet(CameraStabSettingsStabilizationModeOptions *NewStabilizationMode)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewStabilizationMode, offsetof(CameraStabSettingsData, StabilizationMode), 3*sizeof(CameraStabSettingsStabilizationModeOptions));
+}
+void CameraStabSettingsOutputRangeSet(CameraStabSettingsOutputRangeData *NewOutputRange)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsOutputRangeGet(CameraStabSettingsOutputRangeData *NewOutputRange)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsOutputRangeArraySet(uint8_t *NewOutputRange)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsOutputRangeArrayGet(uint8_t *NewOutputRange)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewOutputRange, offsetof(CameraStabSettingsData, OutputRange), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeSet(CameraStabSettingsResponseTimeData *NewResponseTime)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeGet(CameraStabSettingsResponseTimeData *NewResponseTime)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeArraySet(uint8_t *NewResponseTime)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsResponseTimeArrayGet(uint8_t *NewResponseTime)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewResponseTime, offsetof(CameraStabSettingsData, ResponseTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsGimbalTypeSet(CameraStabSettingsGimbalTypeOptions *NewGimbalType)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewGimbalType, offsetof(CameraStabSettingsData, GimbalType), sizeof(CameraStabSettingsGimbalTypeOptions));
+}
+void CameraStabSettingsGimbalTypeGet(CameraStabSettingsGimbalTypeOptions *NewGimbalType)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewGimbalType, offsetof(CameraStabSettingsData, GimbalType), sizeof(CameraStabSettingsGimbalTypeOptions));
+}
+void CameraStabSettingsFeedForwardSet(CameraStabSettingsFeedForwardData *NewFeedForward)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsFeedForwardGet(CameraStabSettingsFeedForwardData *NewFeedForward)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsFeedForwardArraySet(uint8_t *NewFeedForward)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsFeedForwardArrayGet(uint8_t *NewFeedForward)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewFeedForward, offsetof(CameraStabSettingsData, FeedForward), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeSet(CameraStabSettingsAccelTimeData *NewAccelTime)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeGet(CameraStabSettingsAccelTimeData *NewAccelTime)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeArraySet(uint8_t *NewAccelTime)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsAccelTimeArrayGet(uint8_t *NewAccelTime)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewAccelTime, offsetof(CameraStabSettingsData, AccelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeSet(CameraStabSettingsDecelTimeData *NewDecelTime)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeGet(CameraStabSettingsDecelTimeData *NewDecelTime)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeArraySet(uint8_t *NewDecelTime)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsDecelTimeArrayGet(uint8_t *NewDecelTime)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewDecelTime, offsetof(CameraStabSettingsData, DecelTime), 3*sizeof(uint8_t));
+}
+void CameraStabSettingsServo1PitchReverseSet(CameraStabSettingsServo1PitchReverseOptions *NewServo1PitchReverse)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewServo1PitchReverse, offsetof(CameraStabSettingsData, Servo1PitchReverse), sizeof(CameraStabSettingsServo1PitchReverseOptions));
+}
+void CameraStabSettingsServo1PitchReverseGet(CameraStabSettingsServo1PitchReverseOptions *NewServo1PitchReverse)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewServo1PitchReverse, offsetof(CameraStabSettingsData, Servo1PitchReverse), sizeof(CameraStabSettingsServo1PitchReverseOptions));
+}
+void CameraStabSettingsServo2PitchReverseSet(CameraStabSettingsServo2PitchReverseOptions *NewServo2PitchReverse)
+{
+    UAVObjDirectSet(camerastabsettings_direct, (void *)NewServo2PitchReverse, offsetof(CameraStabSettingsData, Servo2PitchReverse), sizeof(CameraStabSettingsServo2PitchReverseOptions));
+}
+void CameraStabSettingsServo2PitchReverseGet(CameraStabSettingsServo2PitchReverseOptions *NewServo2PitchReverse)
+{
+    UAVObjDirectGet(camerastabsettings_direct, (void *)NewServo2PitchReverse, offsetof(CameraStabSettingsData, Servo2PitchReverse), sizeof(CameraStabSettingsServo2PitchReverseOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup DebugLogControl DebugLogControl
+ * @brief Log Control Object - Used to issue commands to the on board logging system
+ *
+ * Autogenerated files and functions for DebugLogControl Object
+ * @{ 
+ *
+ * @file       debuglogcontrol.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the DebugLogControl object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: debuglogcontrol.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "debuglogcontrol.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if DEBUGLOGCONTROL_ISSINGLEINST
+UAVObjDirect *debuglogcontrol_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t DebugLogControlInitialize(void)
+{
+    // Compile time assertion that the DebugLogControlDataPacked and DebugLogControlData structs
+    // have the same size (though instances of DebugLogControlData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(DebugLogControlDataPacked) == sizeof(DebugLogControlData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(DEBUGLOGCONTROL_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(DEBUGLOGCONTROL_OBJID,
+        DEBUGLOGCONTROL_ISSINGLEINST, DEBUGLOGCONTROL_ISSETTINGS, DEBUGLOGCONTROL_ISPRIORITY, DEBUGLOGCONTROL_NUMBYTES, &DebugLogControlSetDefaults);
+#if DEBUGLOGCONTROL_ISSINGLEINST
+    debuglogcontrol_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void DebugLogControlSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    DebugLogControlData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(DebugLogControlData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle DebugLogControlHandle()
+{
+    return handle;
+}
+
+#if DEBUGLOGCONTROL_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t DebugLogControlGet(DebugLogControlData *dataOut)
+{
+    return UAVObjDirectGet(debuglogcontrol_direct, dataOut, 0, sizeof(DebugLogControlData));
+}
+
+int32_t DebugLogControlSet(const DebugLogControlData *dataIn)
+{
+    return UAVObjDirectSet(debuglogcontrol_direct, dataIn, 0, sizeof(DebugLogControlData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void DebugLogControlFlightSet(uint16_t *NewFlight)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewFlight, offsetof(DebugLogControlData, Flight), sizeof(uint16_t));
+}
+void DebugLogControlFlightGet(uint16_t *NewFlight)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewFlight, offsetof(DebugLogControlData, Flight), sizeof(uint16_t));
+}
+void DebugLogControlEntrySet(uint16_t *NewEntry)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewEntry, offsetof(DebugLogControlData, Entry), sizeof(uint16_t));
+}
+void DebugLogControlEntryGet(uint16_t *NewEntry)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewEntry, offsetof(DebugLogControlData, Entry), sizeof(uint16_t));
+}
+void DebugLogControlCountSet(uint16_t *NewCount)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewCount, offsetof(DebugLogControlData, Count), sizeof(uint16_t));
+}
+void DebugLogControlCountGet(uint16_t *NewCount)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewCount, offsetof(DebugLogControlData, Count), sizeof(uint16_t));
+}
+void DebugLogControlOperationSet(DebugLogControlOperationOptions *NewOperation)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewOperation, offsetof(DebugLogControlData, Operation), sizeof(DebugLogControlOperationOptions));
+}
+void DebugLogControlOperationGet(DebugLogControlOperationOptions *NewOperation)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewOperation, offsetof(DebugLogControlData, Operation), sizeof(DebugLogControlOperationOptions));
+}
+void DebugLogControlPeriodSet(uint8_t *NewPeriod)
+{
+    UAVObjDirectSet(debuglogcontrol_direct, (void *)NewPeriod, offsetof(DebugLogControlData, Period), sizeof(uint8_t));
+}
+void DebugLogControlPeriodGet(uint8_t *NewPeriod)
+{
+    UAVObjDirectGet(debuglogcontrol_direct, (void *)NewPeriod, offsetof(DebugLogControlData, Period), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
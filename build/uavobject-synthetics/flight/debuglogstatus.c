@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup DebugLogStatus DebugLogStatus
+ * @brief Log Status Object, contains log partition status information
+ *
+ * Autogenerated files and functions for DebugLogStatus Object
+ * @{ 
+ *
+ * @file       debuglogstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the DebugLogStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: debuglogstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "debuglogstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if DEBUGLOGSTATUS_ISSINGLEINST
+UAVObjDirect *debuglogstatus_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t DebugLogStatusInitialize(void)
+{
+    // Compile time assertion that the DebugLogStatusDataPacked and DebugLogStatusData structs
+    // have the same size (though instances of DebugLogStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(DebugLogStatusDataPacked) == sizeof(DebugLogStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(DEBUGLOGSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(DEBUGLOGSTATUS_OBJID,
+        DEBUGLOGSTATUS_ISSINGLEINST, DEBUGLOGSTATUS_ISSETTINGS, DEBUGLOGSTATUS_ISPRIORITY, DEBUGLOGSTATUS_NUMBYTES, &DebugLogStatusSetDefaults);
+#if DEBUGLOGSTATUS_ISSINGLEINST
+    debuglogstatus_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void DebugLogStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    DebugLogStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(DebugLogStatusData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle DebugLogStatusHandle()
+{
+    return handle;
+}
+
+#if DEBUGLOGSTATUS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t DebugLogStatusGet(DebugLogStatusData *dataOut)
+{
+    return UAVObjDirectGet(debuglogstatus_direct, dataOut, 0, sizeof(DebugLogStatusData));
+}
+
+int32_t DebugLogStatusSet(const DebugLogStatusData *dataIn)
+{
+    return UAVObjDirectSet(debuglogstatus_direct, dataIn, 0, sizeof(DebugLogStatusData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void DebugLogStatusFlightSet(uint16_t *NewFlight)
+{
+    UAVObjDirectSet(debuglogstatus_direct, (void *)NewFlight, offsetof(DebugLogStatusData, Flight), sizeof(uint16_t));
+}
+void DebugLogStatusFlightGet(uint16_t *NewFlight)
+{
+    UAVObjDirectGet(debuglogstatus_direct, (void *)NewFlight, offsetof(DebugLogStatusData, Flight), sizeof(uint16_t));
+}
+void DebugLogStatusEntrySet(uint16_t *NewEntry)
+{
+    UAVObjDirectSet(debuglogstatus_direct, (void *)NewEntry, offsetof(DebugLogStatusData, Entry), sizeof(uint16_t));
+}
+void DebugLogStatusEntryGet(uint16_t *NewEntry)
+{
+    UAVObjDirectGet(debuglogstatus_direct, (void *)NewEntry, offsetof(DebugLogStatusData, Entry), sizeof(uint16_t));
+}
+void DebugLogStatusUsedSlotsSet(uint16_t *NewUsedSlots)
+{
+    UAVObjDirectSet(debuglogstatus_direct, (void *)NewUsedSlots, offsetof(DebugLogStatusData, UsedSlots), sizeof(uint16_t));
+}
+void DebugLogStatusUsedSlotsGet(uint16_t *NewUsedSlots)
+{
+    UAVObjDirectGet(debuglogstatus_direct, (void *)NewUsedSlots, offsetof(DebugLogStatusData, UsedSlots), sizeof(uint16_t));
+}
+void DebugLogStatusFreeSlotsSet(uint16_t *NewFreeSlots)
+{
+    UAVObjDirectSet(debuglogstatus_direct, (void *)NewFreeSlots, offsetof(DebugLogStatusData, FreeSlots), sizeof(uint16_t));
+}
+void DebugLogStatusFreeSlotsGet(uint16_t *NewFreeSlots)
+{
+    UAVObjDirectGet(debuglogstatus_direct, (void *)NewFreeSlots, offsetof(DebugLogStatusData, FreeSlots), sizeof(uint16_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
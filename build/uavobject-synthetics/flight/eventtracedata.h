@@ -0,0 +1,211 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup EventTraceData EventTraceData
+ * @brief Chunk of the on board event trace, see EventTraceControl
+ *
+ * Autogenerated files and functions for EventTraceData Object
+ *
+ * @{
+ *
+ * @file       eventtracedata.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EventTraceData object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: eventtracedata.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACEDATA_H
+#define EVENTTRACEDATA_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define EVENTTRACEDATA_OBJID 0xCB913FEA
+#define EVENTTRACEDATA_ISSINGLEINST 1
+#define EVENTTRACEDATA_ISSETTINGS 0
+#define EVENTTRACEDATA_ISPRIORITY 0
+#define EVENTTRACEDATA_NUMBYTES sizeof(EventTraceDataData)
+
+/* Generic interface functions */
+int32_t EventTraceDataInitialize();
+UAVObjHandle EventTraceDataHandle();
+void EventTraceDataSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Chunk information */
+
+/* Field Chunks information */
+
+/* Field Size information */
+
+/* Field Data information */
+
+// Number of elements for field Data
+#define EVENTTRACEDATA_DATA_NUMELEM 200
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint16_t Chunk;
+    uint16_t Chunks;
+    uint8_t Size;
+    uint8_t Data[200];
+
+} __attribute__((packed)) EventTraceDataDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef EventTraceDataDataPacked __attribute__((aligned(4))) EventTraceDataData;
+
+/* Typesafe Object access functions */
+#if EVENTTRACEDATA_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *eventtracedata_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t EventTraceDataGet(EventTraceDataData * dataOut) {
+    return UAVObjDirectGet(eventtracedata_direct, dataOut, 0, sizeof(EventTraceDataData));
+}
+static inline int32_t EventTraceDataSet(const EventTraceDataData * dataIn) {
+    return UAVObjDirectSet(eventtracedata_direct, dataIn, 0, sizeof(EventTraceDataData));
+}
+#else
+extern int32_t EventTraceDataGet(EventTraceDataData * dataOut);
+extern int32_t EventTraceDataSet(const EventTraceDataData * dataIn);
+#endif
+#else
+static inline int32_t EventTraceDataGet(EventTraceDataData * dataOut) {
+    return UAVObjGetData(EventTraceDataHandle(), dataOut);
+}
+static inline int32_t EventTraceDataSet(const EventTraceDataData * dataIn) {
+    return UAVObjSetData(EventTraceDataHandle(), dataIn);
+}
+#endif
+static inline int32_t EventTraceDataInstGet(uint16_t instId, EventTraceDataData * dataOut) {
+    return UAVObjGetInstanceData(EventTraceDataHandle(), instId, dataOut);
+}
+static inline int32_t EventTraceDataInstSet(uint16_t instId, const EventTraceDataData * dataIn) {
+    return UAVObjSetInstanceData(EventTraceDataHandle(), instId, dataIn);
+}
+static inline int32_t EventTraceDataConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(EventTraceDataHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t EventTraceDataConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceDataHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t EventTraceDataConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(EventTraceDataHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t EventTraceDataCreateInstance() {
+    return UAVObjCreateInstance(EventTraceDataHandle(), &EventTraceDataSetDefaults);
+}
+static inline void EventTraceDataRequestUpdate() {
+    UAVObjRequestUpdate(EventTraceDataHandle());
+}
+static inline void EventTraceDataRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(EventTraceDataHandle(), instId);
+}
+static inline void EventTraceDataUpdated() {
+    UAVObjUpdated(EventTraceDataHandle());
+}
+static inline void EventTraceDataInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(EventTraceDataHandle(), instId);
+}
+static inline void EventTraceDataLogging() {
+    UAVObjLogging(EventTraceDataHandle());
+}
+static inline void EventTraceDataInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(EventTraceDataHandle(), instId);
+}
+static inline int32_t EventTraceDataGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(EventTraceDataHandle(), dataOut);
+}
+static inline int32_t EventTraceDataSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(EventTraceDataHandle(), dataIn);
+}
+static inline int8_t EventTraceDataReadOnly() {
+    return UAVObjReadOnly(EventTraceDataHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void EventTraceDataChunkSet(uint16_t *NewChunk)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewChunk, offsetof(EventTraceDataData, Chunk), sizeof(uint16_t));
+}
+static inline void EventTraceDataChunkGet(uint16_t *NewChunk)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewChunk, offsetof(EventTraceDataData, Chunk), sizeof(uint16_t));
+}
+static inline void EventTraceDataChunksSet(uint16_t *NewChunks)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewChunks, offsetof(EventTraceDataData, Chunks), sizeof(uint16_t));
+}
+static inline void EventTraceDataChunksGet(uint16_t *NewChunks)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewChunks, offsetof(EventTraceDataData, Chunks), sizeof(uint16_t));
+}
+static inline void EventTraceDataSizeSet(uint8_t *NewSize)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewSize, offsetof(EventTraceDataData, Size), sizeof(uint8_t));
+}
+static inline void EventTraceDataSizeGet(uint8_t *NewSize)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewSize, offsetof(EventTraceDataData, Size), sizeof(uint8_t));
+}
+static inline void EventTraceDataDataSet(uint8_t *NewData)
+{
+    UAVObjDirectSet(eventtracedata_direct, (void *)NewData, offsetof(EventTraceDataData, Data), 200*sizeof(uint8_t));
+}
+static inline void EventTraceDataDataGet(uint8_t *NewData)
+{
+    UAVObjDirectGet(eventtracedata_direct, (void *)NewData, offsetof(EventTraceDataData, Data), 200*sizeof(uint8_t));
+}
+#else
+extern void EventTraceDataChunkSet(uint16_t *NewChunk);
+extern void EventTraceDataChunkGet(uint16_t *NewChunk);
+extern void EventTraceDataChunksSet(uint16_t *NewChunks);
+extern void EventTraceDataChunksGet(uint16_t *NewChunks);
+extern void EventTraceDataSizeSet(uint8_t *NewSize);
+extern void EventTraceDataSizeGet(uint8_t *NewSize);
+extern void EventTraceDataDataSet(uint8_t *NewData);
+extern void EventTraceDataDataGet(uint8_t *NewData);
+#endif
+
+
+#endif // EVENTTRACEDATA_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,194 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GPSExtendedStatus GPSExtendedStatus
+ * @brief Extended GPS status.
+ *
+ * Autogenerated files and functions for GPSExtendedStatus Object
+ * @{ 
+ *
+ * @file       gpsextendedstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSExtendedStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gpsextendedstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gpsextendedstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if GPSEXTENDEDSTATUS_ISSINGLEINST
+UAVObjDirect *gpsextendedstatus_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GPSExtendedStatusInitialize(void)
+{
+    // Compile time assertion that the GPSExtendedStatusDataPacked and GPSExtendedStatusData structs
+    // have the same size (though instances of GPSExtendedStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GPSExtendedStatusDataPacked) == sizeof(GPSExtendedStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GPSEXTENDEDSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GPSEXTENDEDSTATUS_OBJID,
+        GPSEXTENDEDSTATUS_ISSINGLEINST, GPSEXTENDEDSTATUS_ISSETTINGS, GPSEXTENDEDSTATUS_ISPRIORITY, GPSEXTENDEDSTATUS_NUMBYTES, &GPSExtendedStatusSetDefaults);
+#if GPSEXTENDEDSTATUS_ISSINGLEINST
+    gpsextendedstatus_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GPSExtendedStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GPSExtendedStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GPSExtendedStatusData));
+    data.Status = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GPSExtendedStatusHandle()
+{
+    return handle;
+}
+
+#if GPSEXTENDEDSTATUS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t GPSExtendedStatusGet(GPSExtendedStatusData *dataOut)
+{
+    return UAVObjDirectGet(gpsextendedstatus_direct, dataOut, 0, sizeof(GPSExtendedStatusData));
+}
+
+int32_t GPSExtendedStatusSet(const GPSExtendedStatusData *dataIn)
+{
+    return UAVObjDirectSet(gpsextendedstatus_direct, dataIn, 0, sizeof(GPSExtendedStatusData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void GPSExtendedStatusFlightTimeSet(uint32_t *NewFlightTime)
+{
+    UAVObjDirectSet(gpsextendedstatus_direct, (void *)NewFlightTime, offsetof(GPSExtendedStatusData, FlightTime), sizeof(uint32_t));
+}
+void GPSExtendedStatusFlightTimeGet(uint32_t *NewFlightTime)
+{
+    UAVObjDirectGet(gpsextendedstatus_direct, (void *)NewFlightTime, offsetof(GPSExtendedStatusData, FlightTime), sizeof(uint32_t));
+}
+void GPSExtendedStatusOptionsSet(uint16_t *NewOptions)
+{
+    UAVObjDirectSet(gpsextendedstatus_direct, (void *)NewOptions, offsetof(GPSExtendedStatusData, Options), sizeof(uint16_t));
+}
+void GPSExtendedStatusOptionsGet(uint16_t *NewOptions)
+{
+    UAVObjDirectGet(gpsextendedstatus_direct, (void *)NewOptions, offsetof(GPSExtendedStatusData, Options), sizeof(uint16_t));
+}
+void GPSExtendedStatusStatusSet(GPSExtendedStatusStatusOptions *NewStatus)
+{
+    UAVObjDirectSet(gpsextendedstatus_direct, (void *)NewStatus, offsetof(GPSExtendedStatusData, Status), sizeof(GPSExtendedStatusStatusOptions));
+}
+void GPSExtendedStatusStatusGet(GPSExtendedStatusStatusOptions *NewStatus)
+{
+    UAVObjDirectGet(gpsextendedstatus_direct, (void *)NewStatus, offsetof(GPSExtendedStatusData, Status), sizeof(GPSExtendedStatusStatusOptions));
+}
+void GPSExtendedStatusBoardTypeSet(uint8_t *NewBoardType)
+{
+    UAVObjDirectSet(gpsextendedstatus_direct, (void *)NewBoardType, offsetof(GPSExtendedStatusData, BoardType), 2*sizeof(uint8_t));
+}
+void GPSExtendedStatusBoardTypeGet(uint8_t *NewBoardType)
+{
+    UAVObjDirectGet(gpsextendedstatus_direct, (void *)NewBoardType, offsetof(GPSExtendedStatusData, BoardType), 2*sizeof(uint8_t));
+}
+void GPSExtendedStatusFirmwareHashSet(uint8_t *NewFirmwareHash)
+{
+    UAVObjDirectSet(gpsextendedstatus_direct, (void *)NewFirmwareHash, offsetof(GPSExtendedStatusData, FirmwareHash), 8*sizeof(uint8_t));
+}
+void GPSExtendedStatusFirmwareHashGet(uint8_t *NewFirmwareHash)
+{
+    UAVObjDirectGet(gpsextendedstatus_direct, (void *)NewFirmwareHash, offsetof(GPSExtendedStatusData, FirmwareHash), 8*sizeof(uint8_t));
+}
+void GPSExtendedStatusFirmwareTagSet(uint8_t *NewFirmwareTag)
+{
+    UAVObjDirectSet(gpsextendedstatus_direct, (void *)NewFirmwareTag, offsetof(GPSExtendedStatusData, FirmwareTag), 26*sizeof(uint8_t));
+}
+void GPSExtendedStatusFirmwareTagGet(uint8_t *NewFirmwareTag)
+{
+    UAVObjDirectGet(gpsextendedstatus_direct, (void *)NewFirmwareTag, offsetof(GPSExtendedStatusData, FirmwareTag), 26*sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
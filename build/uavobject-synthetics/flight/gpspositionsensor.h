@@ -0,0 +1,377 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup GPSPositionSensor GPSPositionSensor
+ * @brief Raw GPS data from @ref GPSModule.
+ *
+ * Autogenerated files and functions for GPSPositionSensor Object
+ *
+ * @{
+ *
+ * @file       gpspositionsensor.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSPositionSensor object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: gpspositionsensor.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef GPSPOSITIONSENSOR_H
+#define GPSPOSITIONSENSOR_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define GPSPOSITIONSENSOR_OBJID 0x9DF1F67A
+#define GPSPOSITIONSENSOR_ISSINGLEINST 1
+#define GPSPOSITIONSENSOR_ISSETTINGS 0
+#define GPSPOSITIONSENSOR_ISPRIORITY 0
+#define GPSPOSITIONSENSOR_NUMBYTES sizeof(GPSPositionSensorData)
+
+/* Generic interface functions */
+int32_t GPSPositionSensorInitialize();
+UAVObjHandle GPSPositionSensorHandle();
+void GPSPositionSensorSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Latitude information */
+
+/* Field Longitude information */
+
+/* Field Altitude information */
+
+/* Field GeoidSeparation information */
+
+/* Field Heading information */
+
+/* Field Groundspeed information */
+
+/* Field PDOP information */
+
+/* Field HDOP information */
+
+/* Field VDOP information */
+
+/* Field Status information */
+
+// Enumeration options for field Status
+typedef enum __attribute__ ((__packed__)) {
+    GPSPOSITIONSENSOR_STATUS_NOGPS=0,
+    GPSPOSITIONSENSOR_STATUS_NOFIX=1,
+    GPSPOSITIONSENSOR_STATUS_FIX2D=2,
+    GPSPOSITIONSENSOR_STATUS_FIX3D=3
+} GPSPositionSensorStatusOptions;
+
+/* Field Satellites information */
+
+/* Field SensorType information */
+
+// Enumeration options for field SensorType
+typedef enum __attribute__ ((__packed__)) {
+    GPSPOSITIONSENSOR_SENSORTYPE_UNKNOWN=0,
+    GPSPOSITIONSENSOR_SENSORTYPE_NMEA=1,
+    GPSPOSITIONSENSOR_SENSORTYPE_UBX=2,
+    GPSPOSITIONSENSOR_SENSORTYPE_UBX7=3,
+    GPSPOSITIONSENSOR_SENSORTYPE_UBX8=4,
+    GPSPOSITIONSENSOR_SENSORTYPE_DJI=5
+} GPSPositionSensorSensorTypeOptions;
+
+/* Field AutoConfigStatus information */
+
+// Enumeration options for field AutoConfigStatus
+typedef enum __attribute__ ((__packed__)) {
+    GPSPOSITIONSENSOR_AUTOCONFIGSTATUS_DISABLED=0,
+    GPSPOSITIONSENSOR_AUTOCONFIGSTATUS_RUNNING=1,
+    GPSPOSITIONSENSOR_AUTOCONFIGSTATUS_DONE=2,
+    GPSPOSITIONSENSOR_AUTOCONFIGSTATUS_ERROR=3
+} GPSPositionSensorAutoConfigStatusOptions;
+
+/* Field BaudRate information */
+
+// Enumeration options for field BaudRate
+typedef enum __attribute__ ((__packed__)) {
+    GPSPOSITIONSENSOR_BAUDRATE_2400=0,
+    GPSPOSITIONSENSOR_BAUDRATE_4800=1,
+    GPSPOSITIONSENSOR_BAUDRATE_9600=2,
+    GPSPOSITIONSENSOR_BAUDRATE_19200=3,
+    GPSPOSITIONSENSOR_BAUDRATE_38400=4,
+    GPSPOSITIONSENSOR_BAUDRATE_57600=5,
+    GPSPOSITIONSENSOR_BAUDRATE_115200=6,
+    GPSPOSITIONSENSOR_BAUDRATE_230400=7,
+    GPSPOSITIONSENSOR_BAUDRATE_UNKNOWN=8
+} GPSPositionSensorBaudRateOptions;
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        int32_t Latitude;
+    int32_t Longitude;
+    float Altitude;
+    float GeoidSeparation;
+    float Heading;
+    float Groundspeed;
+    float PDOP;
+    float HDOP;
+    float VDOP;
+    GPSPositionSensorStatusOptions Status;
+    int8_t Satellites;
+    GPSPositionSensorSensorTypeOptions SensorType;
+    GPSPositionSensorAutoConfigStatusOptions AutoConfigStatus;
+    GPSPositionSensorBaudRateOptions BaudRate;
+
+} __attribute__((packed)) GPSPositionSensorDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef GPSPositionSensorDataPacked __attribute__((aligned(4))) GPSPositionSensorData;
+
+/* Typesafe Object access functions */
+#if GPSPOSITIONSENSOR_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *gpspositionsensor_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t GPSPositionSensorGet(GPSPositionSensorData * dataOut) {
+    return UAVObjDirectGet(gpspositionsensor_direct, dataOut, 0, sizeof(GPSPositionSensorData));
+}
+static inline int32_t GPSPositionSensorSet(const GPSPositionSensorData * dataIn) {
+    return UAVObjDirectSet(gpspositionsensor_direct, dataIn, 0, sizeof(GPSPositionSensorData));
+}
+#else
+extern int32_t GPSPositionSensorGet(GPSPositionSensorData * dataOut);
+extern int32_t GPSPositionSensorSet(const GPSPositionSensorData * dataIn);
+#endif
+#else
+static inline int32_t GPSPositionSensorGet(GPSPositionSensorData * dataOut) {
+    return UAVObjGetData(GPSPositionSensorHandle(), dataOut);
+}
+static inline int32_t GPSPositionSensorSet(const GPSPositionSensorData * dataIn) {
+    return UAVObjSetData(GPSPositionSensorHandle(), dataIn);
+}
+#endif
+static inline int32_t GPSPositionSensorInstGet(uint16_t instId, GPSPositionSensorData * dataOut) {
+    return UAVObjGetInstanceData(GPSPositionSensorHandle(), instId, dataOut);
+}
+static inline int32_t GPSPositionSensorInstSet(uint16_t instId, const GPSPositionSensorData * dataIn) {
+    return UAVObjSetInstanceData(GPSPositionSensorHandle(), instId, dataIn);
+}
+static inline int32_t GPSPositionSensorConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(GPSPositionSensorHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t GPSPositionSensorConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GPSPositionSensorHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t GPSPositionSensorConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(GPSPositionSensorHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t GPSPositionSensorCreateInstance() {
+    return UAVObjCreateInstance(GPSPositionSensorHandle(), &GPSPositionSensorSetDefaults);
+}
+static inline void GPSPositionSensorRequestUpdate() {
+    UAVObjRequestUpdate(GPSPositionSensorHandle());
+}
+static inline void GPSPositionSensorRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(GPSPositionSensorHandle(), instId);
+}
+static inline void GPSPositionSensorUpdated() {
+    UAVObjUpdated(GPSPositionSensorHandle());
+}
+static inline void GPSPositionSensorInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(GPSPositionSensorHandle(), instId);
+}
+static inline void GPSPositionSensorLogging() {
+    UAVObjLogging(GPSPositionSensorHandle());
+}
+static inline void GPSPositionSensorInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(GPSPositionSensorHandle(), instId);
+}
+static inline int32_t GPSPositionSensorGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(GPSPositionSensorHandle(), dataOut);
+}
+static inline int32_t GPSPositionSensorSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(GPSPositionSensorHandle(), dataIn);
+}
+static inline int8_t GPSPositionSensorReadOnly() {
+    return UAVObjReadOnly(GPSPositionSensorHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void GPSPositionSensorLatitudeSet(int32_t *NewLatitude)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewLatitude, offsetof(GPSPositionSensorData, Latitude), sizeof(int32_t));
+}
+static inline void GPSPositionSensorLatitudeGet(int32_t *NewLatitude)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewLatitude, offsetof(GPSPositionSensorData, Latitude), sizeof(int32_t));
+}
+static inline void GPSPositionSensorLongitudeSet(int32_t *NewLongitude)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewLongitude, offsetof(GPSPositionSensorData, Longitude), sizeof(int32_t));
+}
+static inline void GPSPositionSensorLongitudeGet(int32_t *NewLongitude)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewLongitude, offsetof(GPSPositionSensorData, Longitude), sizeof(int32_t));
+}
+static inline void GPSPositionSensorAltitudeSet(float *NewAltitude)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewAltitude, offsetof(GPSPositionSensorData, Altitude), sizeof(float));
+}
+static inline void GPSPositionSensorAltitudeGet(float *NewAltitude)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewAltitude, offsetof(GPSPositionSensorData, Altitude), sizeof(float));
+}
+static inline void GPSPositionSensorGeoidSeparationSet(float *NewGeoidSeparation)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewGeoidSeparation, offsetof(GPSPositionSensorData, GeoidSeparation), sizeof(float));
+}
+static inline void GPSPositionSensorGeoidSeparationGet(float *NewGeoidSeparation)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewGeoidSeparation, offsetof(GPSPositionSensorData, GeoidSeparation), sizeof(float));
+}
+static inline void GPSPositionSensorHeadingSet(float *NewHeading)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewHeading, offsetof(GPSPositionSensorData, Heading), sizeof(float));
+}
+static inline void GPSPositionSensorHeadingGet(float *NewHeading)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewHeading, offsetof(GPSPositionSensorData, Heading), sizeof(float));
+}
+static inline void GPSPositionSensorGroundspeedSet(float *NewGroundspeed)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewGroundspeed, offsetof(GPSPositionSensorData, Groundspeed), sizeof(float));
+}
+static inline void GPSPositionSensorGroundspeedGet(float *NewGroundspeed)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewGroundspeed, offsetof(GPSPositionSensorData, Groundspeed), sizeof(float));
+}
+static inline void GPSPositionSensorPDOPSet(float *NewPDOP)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewPDOP, offsetof(GPSPositionSensorData, PDOP), sizeof(float));
+}
+static inline void GPSPositionSensorPDOPGet(float *NewPDOP)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewPDOP, offsetof(GPSPositionSensorData, PDOP), sizeof(float));
+}
+static inline void GPSPositionSensorHDOPSet(float *NewHDOP)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewHDOP, offsetof(GPSPositionSensorData, HDOP), sizeof(float));
+}
+static inline void GPSPositionSensorHDOPGet(float *NewHDOP)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewHDOP, offsetof(GPSPositionSensorData, HDOP), sizeof(float));
+}
+static inline void GPSPositionSensorVDOPSet(float *NewVDOP)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewVDOP, offsetof(GPSPositionSensorData, VDOP), sizeof(float));
+}
+static inline void GPSPositionSensorVDOPGet(float *NewVDOP)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewVDOP, offsetof(GPSPositionSensorData, VDOP), sizeof(float));
+}
+static inline void GPSPositionSensorStatusSet(GPSPositionSensorStatusOptions *NewStatus)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewStatus, offsetof(GPSPositionSensorData, Status), sizeof(GPSPositionSensorStatusOptions));
+}
+static inline void GPSPositionSensorStatusGet(GPSPositionSensorStatusOptions *NewStatus)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewStatus, offsetof(GPSPositionSensorData, Status), sizeof(GPSPositionSensorStatusOptions));
+}
+static inline void GPSPositionSensorSatellitesSet(int8_t *NewSatellites)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewSatellites, offsetof(GPSPositionSensorData, Satellites), sizeof(int8_t));
+}
+static inline void GPSPositionSensorSatellitesGet(int8_t *NewSatellites)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewSatellites, offsetof(GPSPositionSensorData, Satellites), sizeof(int8_t));
+}
+static inline void GPSPositionSensorSensorTypeSet(GPSPositionSensorSensorTypeOptions *NewSensorType)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewSensorType, offsetof(GPSPositionSensorData, SensorType), sizeof(GPSPositionSensorSensorTypeOptions));
+}
+static inline void GPSPositionSensorSensorTypeGet(GPSPositionSensorSensorTypeOptions *NewSensorType)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewSensorType, offsetof(GPSPositionSensorData, SensorType), sizeof(GPSPositionSensorSensorTypeOptions));
+}
+static inline void GPSPositionSensorAutoConfigStatusSet(GPSPositionSensorAutoConfigStatusOptions *NewAutoConfigStatus)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewAutoConfigStatus, offsetof(GPSPositionSensorData, AutoConfigStatus), sizeof(GPSPositionSensorAutoConfigStatusOptions));
+}
+static inline void GPSPositionSensorAutoConfigStatusGet(GPSPositionSensorAutoConfigStatusOptions *NewAutoConfigStatus)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewAutoConfigStatus, offsetof(GPSPositionSensorData, AutoConfigStatus), sizeof(GPSPositionSensorAutoConfigStatusOptions));
+}
+static inline void GPSPositionSensorBaudRateSet(GPSPositionSensorBaudRateOptions *NewBaudRate)
+{
+    UAVObjDirectSet(gpspositionsensor_direct, (void *)NewBaudRate, offsetof(GPSPositionSensorData, BaudRate), sizeof(GPSPositionSensorBaudRateOptions));
+}
+static inline void GPSPositionSensorBaudRateGet(GPSPositionSensorBaudRateOptions *NewBaudRate)
+{
+    UAVObjDirectGet(gpspositionsensor_direct, (void *)NewBaudRate, offsetof(GPSPositionSensorData, BaudRate), sizeof(GPSPositionSensorBaudRateOptions));
+}
+#else
+extern void GPSPositionSensorLatitudeSet(int32_t *NewLatitude);
+extern void GPSPositionSensorLatitudeGet(int32_t *NewLatitude);
+extern void GPSPositionSensorLongitudeSet(int32_t *NewLongitude);
+extern void GPSPositionSensorLongitudeGet(int32_t *NewLongitude);
+extern void GPSPositionSensorAltitudeSet(float *NewAltitude);
+extern void GPSPositionSensorAltitudeGet(float *NewAltitude);
+extern void GPSPositionSensorGeoidSeparationSet(float *NewGeoidSeparation);
+extern void GPSPositionSensorGeoidSeparationGet(float *NewGeoidSeparation);
+extern void GPSPositionSensorHeadingSet(float *NewHeading);
+extern void GPSPositionSensorHeadingGet(float *NewHeading);
+extern void GPSPositionSensorGroundspeedSet(float *NewGroundspeed);
+extern void GPSPositionSensorGroundspeedGet(float *NewGroundspeed);
+extern void GPSPositionSensorPDOPSet(float *NewPDOP);
+extern void GPSPositionSensorPDOPGet(float *NewPDOP);
+extern void GPSPositionSensorHDOPSet(float *NewHDOP);
+extern void GPSPositionSensorHDOPGet(float *NewHDOP);
+extern void GPSPositionSensorVDOPSet(float *NewVDOP);
+extern void GPSPositionSensorVDOPGet(float *NewVDOP);
+extern void GPSPositionSensorStatusSet(GPSPositionSensorStatusOptions *NewStatus);
+extern void GPSPositionSensorStatusGet(GPSPositionSensorStatusOptions *NewStatus);
+extern void GPSPositionSensorSatellitesSet(int8_t *NewSatellites);
+extern void GPSPositionSensorSatellitesGet(int8_t *NewSatellites);
+extern void GPSPositionSensorSensorTypeSet(GPSPositionSensorSensorTypeOptions *NewSensorType);
+extern void GPSPositionSensorSensorTypeGet(GPSPositionSensorSensorTypeOptions *NewSensorType);
+extern void GPSPositionSensorAutoConfigStatusSet(GPSPositionSensorAutoConfigStatusOptions *NewAutoConfigStatus);
+extern void GPSPositionSensorAutoConfigStatusGet(GPSPositionSensorAutoConfigStatusOptions *NewAutoConfigStatus);
+extern void GPSPositionSensorBaudRateSet(GPSPositionSensorBaudRateOptions *NewBaudRate);
+extern void GPSPositionSensorBaudRateGet(GPSPositionSensorBaudRateOptions *NewBaudRate);
+#endif
+
+
+#endif // GPSPOSITIONSENSOR_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,201 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GPSTime GPSTime
+ * @brief Contains the GPS time from @ref GPSModule.  Required to compute the world magnetic model correctly when setting the home location.
+ *
+ * Autogenerated files and functions for GPSTime Object
+ * @{ 
+ *
+ * @file       gpstime.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSTime object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gpstime.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gpstime.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if GPSTIME_ISSINGLEINST
+UAVObjDirect *gpstime_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GPSTimeInitialize(void)
+{
+    // Compile time assertion that the GPSTimeDataPacked and GPSTimeData structs
+    // have the same size (though instances of GPSTimeData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GPSTimeDataPacked) == sizeof(GPSTimeData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GPSTIME_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GPSTIME_OBJID,
+        GPSTIME_ISSINGLEINST, GPSTIME_ISSETTINGS, GPSTIME_ISPRIORITY, GPSTIME_NUMBYTES, &GPSTimeSetDefaults);
+#if GPSTIME_ISSINGLEINST
+    gpstime_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GPSTimeSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GPSTimeData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GPSTimeData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 10000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GPSTimeHandle()
+{
+    return handle;
+}
+
+#if GPSTIME_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t GPSTimeGet(GPSTimeData *dataOut)
+{
+    return UAVObjDirectGet(gpstime_direct, dataOut, 0, sizeof(GPSTimeData));
+}
+
+int32_t GPSTimeSet(const GPSTimeData *dataIn)
+{
+    return UAVObjDirectSet(gpstime_direct, dataIn, 0, sizeof(GPSTimeData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void GPSTimeYearSet(int16_t *NewYear)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewYear, offsetof(GPSTimeData, Year), sizeof(int16_t));
+}
+void GPSTimeYearGet(int16_t *NewYear)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewYear, offsetof(GPSTimeData, Year), sizeof(int16_t));
+}
+void GPSTimeMillisecondSet(int16_t *NewMillisecond)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewMillisecond, offsetof(GPSTimeData, Millisecond), sizeof(int16_t));
+}
+void GPSTimeMillisecondGet(int16_t *NewMillisecond)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewMillisecond, offsetof(GPSTimeData, Millisecond), sizeof(int16_t));
+}
+void GPSTimeMonthSet(int8_t *NewMonth)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewMonth, offsetof(GPSTimeData, Month), sizeof(int8_t));
+}
+void GPSTimeMonthGet(int8_t *NewMonth)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewMonth, offsetof(GPSTimeData, Month), sizeof(int8_t));
+}
+void GPSTimeDaySet(int8_t *NewDay)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewDay, offsetof(GPSTimeData, Day), sizeof(int8_t));
+}
+void GPSTimeDayGet(int8_t *NewDay)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewDay, offsetof(GPSTimeData, Day), sizeof(int8_t));
+}
+void GPSTimeHourSet(int8_t *NewHour)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewHour, offsetof(GPSTimeData, Hour), sizeof(int8_t));
+}
+void GPSTimeHourGet(int8_t *NewHour)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewHour, offsetof(GPSTimeData, Hour), sizeof(int8_t));
+}
+void GPSTimeMinuteSet(int8_t *NewMinute)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewMinute, offsetof(GPSTimeData, Minute), sizeof(int8_t));
+}
+void GPSTimeMinuteGet(int8_t *NewMinute)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewMinute, offsetof(GPSTimeData, Minute), sizeof(int8_t));
+}
+void GPSTimeSecondSet(int8_t *NewSecond)
+{
+    UAVObjDirectSet(gpstime_direct, (void *)NewSecond, offsetof(GPSTimeData, Second), sizeof(int8_t));
+}
+void GPSTimeSecondGet(int8_t *NewSecond)
+{
+    UAVObjDirectGet(gpstime_direct, (void *)NewSecond, offsetof(GPSTimeData, Second), sizeof(int8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
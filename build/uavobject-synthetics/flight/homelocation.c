@@ -0,0 +1,201 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HomeLocation HomeLocation
+ * @brief HomeLocation setting which contains the constants to translate from longitude and latitude to NED reference frame.  Automatically set by @ref GPSModule after acquiring a 3D lock.  Used by @ref AHRSCommsModule.
+ *
+ * Autogenerated files and functions for HomeLocation Object
+ * @{ 
+ *
+ * @file       homelocation.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HomeLocation object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: homelocation.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "homelocation.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if HOMELOCATION_ISSINGLEINST
+UAVObjDirect *homelocation_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HomeLocationInitialize(void)
+{
+    // Compile time assertion that the HomeLocationDataPacked and HomeLocationData structs
+    // have the same size (though instances of HomeLocationData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HomeLocationDataPacked) == sizeof(HomeLocationData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HOMELOCATION_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(HOMELOCATION_OBJID,
+        HOMELOCATION_ISSINGLEINST, HOMELOCATION_ISSETTINGS, HOMELOCATION_ISPRIORITY, HOMELOCATION_NUMBYTES, &HomeLocationSetDefaults);
+#if HOMELOCATION_ISSINGLEINST
+    homelocation_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HomeLocationSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HomeLocationData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HomeLocationData));
+    data.Latitude = 0;
+    data.Longitude = 0;
+    data.Altitude = 0.000000e+00f;
+    data.Be[0] = 0.000000e+00f;
+    data.Be[1] = 0.000000e+00f;
+    data.Be[2] = 0.000000e+00f;
+    data.g_e = 9.810000e+00f;
+    data.Set = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HomeLocationHandle()
+{
+    return handle;
+}
+
+#if HOMELOCATION_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t HomeLocationGet(HomeLocationData *dataOut)
+{
+    return UAVObjDirectGet(homelocation_direct, dataOut, 0, sizeof(HomeLocationData));
+}
+
+int32_t HomeLocationSet(const HomeLocationData *dataIn)
+{
+    return UAVObjDirectSet(homelocation_direct, dataIn, 0, sizeof(HomeLocationData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void HomeLocationLatitudeSet(int32_t *NewLatitude)
+{
+    UAVObjDirectSet(homelocation_direct, (void *)NewLatitude, offsetof(HomeLocationData, Latitude), sizeof(int32_t));
+}
+void HomeLocationLatitudeGet(int32_t *NewLatitude)
+{
+    UAVObjDirectGet(homelocation_direct, (void *)NewLatitude, offsetof(HomeLocationData, Latitude), sizeof(int32_t));
+}
+void HomeLocationLongitudeSet(int32_t *NewLongitude)
+{
+    UAVObjDirectSet(homelocation_direct, (void *)NewLongitude, offsetof(HomeLocationData, Longitude), sizeof(int32_t));
+}
+void HomeLocationLongitudeGet(int32_t *NewLongitude)
+{
+    UAVObjDirectGet(homelocation_direct, (void *)NewLongitude, offsetof(HomeLocationData, Longitude), sizeof(int32_t));
+}
+void HomeLocationAltitudeSet(float *NewAltitude)
+{
+    UAVObjDirectSet(homelocation_direct, (void *)NewAltitude, offsetof(HomeLocationData, Altitude), sizeof(float));
+}
+void HomeLocationAltitudeGet(float *NewAltitude)
+{
+    UAVObjDirectGet(homelocation_direct, (void *)NewAltitude, offsetof(HomeLocationData, Altitude), sizeof(float));
+}
+void HomeLocationBeSet(float *NewBe)
+{
+    UAVObjDirectSet(homelocation_direct, (void *)NewBe, offsetof(HomeLocationData, Be), 3*sizeof(float));
+}
+void HomeLocationBeGet(float *NewBe)
+{
+    UAVObjDirectGet(homelocation_direct, (void *)NewBe, offsetof(HomeLocationData, Be), 3*sizeof(float));
+}
+void HomeLocationg_eSet(float *Newg_e)
+{
+    UAVObjDirectSet(homelocation_direct, (void *)Newg_e, offsetof(HomeLocationData, g_e), sizeof(float));
+}
+void HomeLocationg_eGet(float *Newg_e)
+{
+    UAVObjDirectGet(homelocation_direct, (void *)Newg_e, offsetof(HomeLocationData, g_e), sizeof(float));
+}
+void HomeLocationSetSet(HomeLocationSetOptions *NewSet)
+{
+    UAVObjDirectSet(homelocation_direct, (void *)NewSet, offsetof(HomeLocationData, Set), sizeof(HomeLocationSetOptions));
+}
+void HomeLocationSetGet(HomeLocationSetOptions *NewSet)
+{
+    UAVObjDirectGet(homelocation_direct, (void *)NewSet, offsetof(HomeLocationData, Set), sizeof(HomeLocationSetOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
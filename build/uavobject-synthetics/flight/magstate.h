@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup MagState MagState
+ * @brief The filtered magnet vector.
+ *
+ * Autogenerated files and functions for MagState Object
+ *
+ * @{
+ *
+ * @file       magstate.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the MagState object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: magstate.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MAGSTATE_H
+#define MAGSTATE_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define MAGSTATE_OBJID 0x9FFEAA0C
+#define MAGSTATE_ISSINGLEINST 1
+#define MAGSTATE_ISSETTINGS 0
+#define MAGSTATE_ISPRIORITY 0
+#define MAGSTATE_NUMBYTES sizeof(MagStateData)
+
+/* Generic interface functions */
+int32_t MagStateInitialize();
+UAVObjHandle MagStateHandle();
+void MagStateSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field x information */
+
+/* Field y information */
+
+/* Field z information */
+
+/* Field Source information */
+
+// Enumeration options for field Source
+typedef enum __attribute__ ((__packed__)) {
+    MAGSTATE_SOURCE_INVALID=0,
+    MAGSTATE_SOURCE_ONBOARD=1,
+    MAGSTATE_SOURCE_AUX=2
+} MagStateSourceOptions;
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float x;
+    float y;
+    float z;
+    MagStateSourceOptions Source;
+
+} __attribute__((packed)) MagStateDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef MagStateDataPacked __attribute__((aligned(4))) MagStateData;
+
+/* Typesafe Object access functions */
+#if MAGSTATE_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *magstate_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t MagStateGet(MagStateData * dataOut) {
+    return UAVObjDirectGet(magstate_direct, dataOut, 0, sizeof(MagStateData));
+}
+static inline int32_t MagStateSet(const MagStateData * dataIn) {
+    return UAVObjDirectSet(magstate_direct, dataIn, 0, sizeof(MagStateData));
+}
+#else
+extern int32_t MagStateGet(MagStateData * dataOut);
+extern int32_t MagStateSet(const MagStateData * dataIn);
+#endif
+#else
+static inline int32_t MagStateGet(MagStateData * dataOut) {
+    return UAVObjGetData(MagStateHandle(), dataOut);
+}
+static inline int32_t MagStateSet(const MagStateData * dataIn) {
+    return UAVObjSetData(MagStateHandle(), dataIn);
+}
+#endif
+static inline int32_t MagStateInstGet(uint16_t instId, MagStateData * dataOut) {
+    return UAVObjGetInstanceData(MagStateHandle(), instId, dataOut);
+}
+static inline int32_t MagStateInstSet(uint16_t instId, const MagStateData * dataIn) {
+    return UAVObjSetInstanceData(MagStateHandle(), instId, dataIn);
+}
+static inline int32_t MagStateConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(MagStateHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t MagStateConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(MagStateHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t MagStateConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(MagStateHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t MagStateCreateInstance() {
+    return UAVObjCreateInstance(MagStateHandle(), &MagStateSetDefaults);
+}
+static inline void MagStateRequestUpdate() {
+    UAVObjRequestUpdate(MagStateHandle());
+}
+static inline void MagStateRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(MagStateHandle(), instId);
+}
+static inline void MagStateUpdated() {
+    UAVObjUpdated(MagStateHandle());
+}
+static inline void MagStateInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(MagStateHandle(), instId);
+}
+static inline void MagStateLogging() {
+    UAVObjLogging(MagStateHandle());
+}
+static inline void MagStateInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(MagStateHandle(), instId);
+}
+static inline int32_t MagStateGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(MagStateHandle(), dataOut);
+}
+static inline int32_t MagStateSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(MagStateHandle(), dataIn);
+}
+static inline int8_t MagStateReadOnly() {
+    return UAVObjReadOnly(MagStateHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void MagStatexSet(float *Newx)
+{
+    UAVObjDirectSet(magstate_direct, (void *)Newx, offsetof(MagStateData, x), sizeof(float));
+}
+static inline void MagStatexGet(float *Newx)
+{
+    UAVObjDirectGet(magstate_direct, (void *)Newx, offsetof(MagStateData, x), sizeof(float));
+}
+static inline void MagStateySet(float *Newy)
+{
+    UAVObjDirectSet(magstate_direct, (void *)Newy, offsetof(MagStateData, y), sizeof(float));
+}
+static inline void MagStateyGet(float *Newy)
+{
+    UAVObjDirectGet(magstate_direct, (void *)Newy, offsetof(MagStateData, y), sizeof(float));
+}
+static inline void MagStatezSet(float *Newz)
+{
+    UAVObjDirectSet(magstate_direct, (void *)Newz, offsetof(MagStateData, z), sizeof(float));
+}
+static inline void MagStatezGet(float *Newz)
+{
+    UAVObjDirectGet(magstate_direct, (void *)Newz, offsetof(MagStateData, z), sizeof(float));
+}
+static inline void MagStateSourceSet(MagStateSourceOptions *NewSource)
+{
+    UAVObjDirectSet(magstate_direct, (void *)NewSource, offsetof(MagStateData, Source), sizeof(MagStateSourceOptions));
+}
+static inline void MagStateSourceGet(MagStateSourceOptions *NewSource)
+{
+    UAVObjDirectGet(magstate_direct, (void *)NewSource, offsetof(MagStateData, Source), sizeof(MagStateSourceOptions));
+}
+#else
+extern void MagStatexSet(float *Newx);
+extern void MagStatexGet(float *Newx);
+extern void MagStateySet(float *Newy);
+extern void MagStateyGet(float *Newy);
+extern void MagStatezSet(float *Newz);
+extern void MagStatezGet(float *Newz);
+extern void MagStateSourceSet(MagStateSourceOptions *NewSource);
+extern void MagStateSourceGet(MagStateSourceOptions *NewSource);
+#endif
+
+
+#endif // MAGSTATE_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,631 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup ManualControlSettings ManualControlSettings
+ * @brief Settings to indicate how to decode receiver input by @ref ManualControlModule.
+ *
+ * Autogenerated files and functions for ManualControlSettings Object
+ *
+ * @{
+ *
+ * @file       manualcontrolsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ManualControlSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: manualcontrolsettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MANUALCONTROLSETTINGS_H
+#define MANUALCONTROLSETTINGS_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define MANUALCONTROLSETTINGS_OBJID 0xC2C59876
+#define MANUALCONTROLSETTINGS_ISSINGLEINST 1
+#define MANUALCONTROLSETTINGS_ISSETTINGS 1
+#define MANUALCONTROLSETTINGS_ISPRIORITY 0
+#define MANUALCONTROLSETTINGS_NUMBYTES sizeof(ManualControlSettingsData)
+
+/* Generic interface functions */
+int32_t ManualControlSettingsInitialize();
+UAVObjHandle ManualControlSettingsHandle();
+void ManualControlSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field FailsafeChannel information */
+
+// Array element names for field FailsafeChannel
+typedef enum {
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_THROTTLE=0,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_ROLL=1,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_PITCH=2,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_YAW=3,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_COLLECTIVE=4,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_ACCESSORY0=5,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_ACCESSORY1=6,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_ACCESSORY2=7,
+    MANUALCONTROLSETTINGS_FAILSAFECHANNEL_ACCESSORY3=8
+} ManualControlSettingsFailsafeChannelElem;
+
+// Number of elements for field FailsafeChannel
+#define MANUALCONTROLSETTINGS_FAILSAFECHANNEL_NUMELEM 9
+
+/* Field ChannelMin information */
+
+// Array element names for field ChannelMin
+typedef enum {
+    MANUALCONTROLSETTINGS_CHANNELMIN_THROTTLE=0,
+    MANUALCONTROLSETTINGS_CHANNELMIN_ROLL=1,
+    MANUALCONTROLSETTINGS_CHANNELMIN_PITCH=2,
+    MANUALCONTROLSETTINGS_CHANNELMIN_YAW=3,
+    MANUALCONTROLSETTINGS_CHANNELMIN_FLIGHTMODE=4,
+    MANUALCONTROLSETTINGS_CHANNELMIN_COLLECTIVE=5,
+    MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY0=6,
+    MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY1=7,
+    MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY2=8,
+    MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY3=9,
+    MANUALCONTROLSETTINGS_CHANNELMIN_RSSI=10
+} ManualControlSettingsChannelMinElem;
+
+// Number of elements for field ChannelMin
+#define MANUALCONTROLSETTINGS_CHANNELMIN_NUMELEM 11
+
+/* Field ChannelNeutral information */
+
+// Array element names for field ChannelNeutral
+typedef enum {
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_THROTTLE=0,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ROLL=1,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_PITCH=2,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_YAW=3,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_FLIGHTMODE=4,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_COLLECTIVE=5,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY0=6,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY1=7,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY2=8,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY3=9,
+    MANUALCONTROLSETTINGS_CHANNELNEUTRAL_RSSI=10
+} ManualControlSettingsChannelNeutralElem;
+
+// Number of elements for field ChannelNeutral
+#define MANUALCONTROLSETTINGS_CHANNELNEUTRAL_NUMELEM 11
+
+/* Field ChannelMax information */
+
+// Array element names for field ChannelMax
+typedef enum {
+    MANUALCONTROLSETTINGS_CHANNELMAX_THROTTLE=0,
+    MANUALCONTROLSETTINGS_CHANNELMAX_ROLL=1,
+    MANUALCONTROLSETTINGS_CHANNELMAX_PITCH=2,
+    MANUALCONTROLSETTINGS_CHANNELMAX_YAW=3,
+    MANUALCONTROLSETTINGS_CHANNELMAX_FLIGHTMODE=4,
+    MANUALCONTROLSETTINGS_CHANNELMAX_COLLECTIVE=5,
+    MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY0=6,
+    MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY1=7,
+    MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY2=8,
+    MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY3=9,
+    MANUALCONTROLSETTINGS_CHANNELMAX_RSSI=10
+} ManualControlSettingsChannelMaxElem;
+
+// Number of elements for field ChannelMax
+#define MANUALCONTROLSETTINGS_CHANNELMAX_NUMELEM 11
+
+/* Field ResponseTime information */
+
+// Array element names for field ResponseTime
+typedef enum {
+    MANUALCONTROLSETTINGS_RESPONSETIME_ROLL=0,
+    MANUALCONTROLSETTINGS_RESPONSETIME_PITCH=1,
+    MANUALCONTROLSETTINGS_RESPONSETIME_YAW=2,
+    MANUALCONTROLSETTINGS_RESPONSETIME_COLLECTIVE=3,
+    MANUALCONTROLSETTINGS_RESPONSETIME_ACCESSORY0=4,
+    MANUALCONTROLSETTINGS_RESPONSETIME_ACCESSORY1=5,
+    MANUALCONTROLSETTINGS_RESPONSETIME_ACCESSORY2=6,
+    MANUALCONTROLSETTINGS_RESPONSETIME_ACCESSORY3=7,
+    MANUALCONTROLSETTINGS_RESPONSETIME_RSSI=8
+} ManualControlSettingsResponseTimeElem;
+
+// Number of elements for field ResponseTime
+#define MANUALCONTROLSETTINGS_RESPONSETIME_NUMELEM 9
+
+/* Field ChannelGroups information */
+
+// Enumeration options for field ChannelGroups
+typedef enum __attribute__ ((__packed__)) {
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_PWM=0,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_PPM=1,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_DSMMAINPORT=2,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_DSMFLEXIPORT=3,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_DSMRCVRPORT=4,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_SBUS=5,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_EXBUS=6,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_HOTT=7,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_SRXL=8,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_IBUS=9,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_GCS=10,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_OPLINK=11,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_OPENLRS=12,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_NONE=13
+} ManualControlSettingsChannelGroupsOptions;
+
+// Array element names for field ChannelGroups
+typedef enum {
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_THROTTLE=0,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_ROLL=1,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_PITCH=2,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_YAW=3,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_FLIGHTMODE=4,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_COLLECTIVE=5,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY0=6,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY1=7,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY2=8,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY3=9,
+    MANUALCONTROLSETTINGS_CHANNELGROUPS_RSSI=10
+} ManualControlSettingsChannelGroupsElem;
+
+// Number of elements for field ChannelGroups
+#define MANUALCONTROLSETTINGS_CHANNELGROUPS_NUMELEM 11
+
+/* Field ChannelNumber information */
+
+// Array element names for field ChannelNumber
+typedef enum {
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_THROTTLE=0,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_ROLL=1,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_PITCH=2,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_YAW=3,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_FLIGHTMODE=4,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_COLLECTIVE=5,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY0=6,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY1=7,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY2=8,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY3=9,
+    MANUALCONTROLSETTINGS_CHANNELNUMBER_RSSI=10
+} ManualControlSettingsChannelNumberElem;
+
+// Number of elements for field ChannelNumber
+#define MANUALCONTROLSETTINGS_CHANNELNUMBER_NUMELEM 11
+
+/* Field Deadband information */
+
+/* Field DeadbandAssistedControl information */
+
+/* Field FlightModeNumber information */
+
+/* Field FailsafeFlightModeSwitchPosition information */
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    float Throttle;
+    float Roll;
+    float Pitch;
+    float Yaw;
+    float Collective;
+    float Accessory0;
+    float Accessory1;
+    float Accessory2;
+    float Accessory3;
+}  ManualControlSettingsFailsafeChannelData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[9];
+}  ManualControlSettingsFailsafeChannelDataArray ;
+#define ManualControlSettingsFailsafeChannelToArray( var ) UAVObjectFieldToArray( ManualControlSettingsFailsafeChannelData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    int16_t Throttle;
+    int16_t Roll;
+    int16_t Pitch;
+    int16_t Yaw;
+    int16_t FlightMode;
+    int16_t Collective;
+    int16_t Accessory0;
+    int16_t Accessory1;
+    int16_t Accessory2;
+    int16_t Accessory3;
+    int16_t Rssi;
+}  ManualControlSettingsChannelMinData ;
+typedef struct __attribute__ ((__packed__)) {
+    int16_t array[11];
+}  ManualControlSettingsChannelMinDataArray ;
+#define ManualControlSettingsChannelMinToArray( var ) UAVObjectFieldToArray( ManualControlSettingsChannelMinData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    int16_t Throttle;
+    int16_t Roll;
+    int16_t Pitch;
+    int16_t Yaw;
+    int16_t FlightMode;
+    int16_t Collective;
+    int16_t Accessory0;
+    int16_t Accessory1;
+    int16_t Accessory2;
+    int16_t Accessory3;
+    int16_t Rssi;
+}  ManualControlSettingsChannelNeutralData ;
+typedef struct __attribute__ ((__packed__)) {
+    int16_t array[11];
+}  ManualControlSettingsChannelNeutralDataArray ;
+#define ManualControlSettingsChannelNeutralToArray( var ) UAVObjectFieldToArray( ManualControlSettingsChannelNeutralData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    int16_t Throttle;
+    int16_t Roll;
+    int16_t Pitch;
+    int16_t Yaw;
+    int16_t FlightMode;
+    int16_t Collective;
+    int16_t Accessory0;
+    int16_t Accessory1;
+    int16_t Accessory2;
+    int16_t Accessory3;
+    int16_t Rssi;
+}  ManualControlSettingsChannelMaxData ;
+typedef struct __attribute__ ((__packed__)) {
+    int16_t array[11];
+}  ManualControlSettingsChannelMaxDataArray ;
+#define ManualControlSettingsChannelMaxToArray( var ) UAVObjectFieldToArray( ManualControlSettingsChannelMaxData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t Roll;
+    uint16_t Pitch;
+    uint16_t Yaw;
+    uint16_t Collective;
+    uint16_t Accessory0;
+    uint16_t Accessory1;
+    uint16_t Accessory2;
+    uint16_t Accessory3;
+    uint16_t Rssi;
+}  ManualControlSettingsResponseTimeData ;
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t array[9];
+}  ManualControlSettingsResponseTimeDataArray ;
+#define ManualControlSettingsResponseTimeToArray( var ) UAVObjectFieldToArray( ManualControlSettingsResponseTimeData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    ManualControlSettingsChannelGroupsOptions Throttle;
+    ManualControlSettingsChannelGroupsOptions Roll;
+    ManualControlSettingsChannelGroupsOptions Pitch;
+    ManualControlSettingsChannelGroupsOptions Yaw;
+    ManualControlSettingsChannelGroupsOptions FlightMode;
+    ManualControlSettingsChannelGroupsOptions Collective;
+    ManualControlSettingsChannelGroupsOptions Accessory0;
+    ManualControlSettingsChannelGroupsOptions Accessory1;
+    ManualControlSettingsChannelGroupsOptions Accessory2;
+    ManualControlSettingsChannelGroupsOptions Accessory3;
+    ManualControlSettingsChannelGroupsOptions Rssi;
+}  ManualControlSettingsChannelGroupsData ;
+typedef struct __attribute__ ((__packed__)) {
+    ManualControlSettingsChannelGroupsOptions array[11];
+}  ManualControlSettingsChannelGroupsDataArray ;
+#define ManualControlSettingsChannelGroupsToArray( var ) UAVObjectFieldToArray( ManualControlSettingsChannelGroupsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t Throttle;
+    uint8_t Roll;
+    uint8_t Pitch;
+    uint8_t Yaw;
+    uint8_t FlightMode;
+    uint8_t Collective;
+    uint8_t Accessory0;
+    uint8_t Accessory1;
+    uint8_t Accessory2;
+    uint8_t Accessory3;
+    uint8_t Rssi;
+}  ManualControlSettingsChannelNumberData ;
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t array[11];
+}  ManualControlSettingsChannelNumberDataArray ;
+#define ManualControlSettingsChannelNumberToArray( var ) UAVObjectFieldToArray( ManualControlSettingsChannelNumberData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        ManualControlSettingsFailsafeChannelData FailsafeChannel;
+    ManualControlSettingsChannelMinData ChannelMin;
+    ManualControlSettingsChannelNeutralData ChannelNeutral;
+    ManualControlSettingsChannelMaxData ChannelMax;
+    ManualControlSettingsResponseTimeData ResponseTime;
+    ManualControlSettingsChannelGroupsData ChannelGroups;
+    ManualControlSettingsChannelNumberData ChannelNumber;
+    uint8_t Deadband;
+    uint8_t DeadbandAssistedControl;
+    uint8_t FlightModeNumber;
+    int8_t FailsafeFlightModeSwitchPosition;
+
+} __attribute__((packed)) ManualControlSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef ManualControlSettingsDataPacked __attribute__((aligned(4))) ManualControlSettingsData;
+
+/* Typesafe Object access functions */
+#if MANUALCONTROLSETTINGS_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *manualcontrolsettings_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t ManualControlSettingsGet(ManualControlSettingsData * dataOut) {
+    return UAVObjDirectGet(manualcontrolsettings_direct, dataOut, 0, sizeof(ManualControlSettingsData));
+}
+static inline int32_t ManualControlSettingsSet(const ManualControlSettingsData * dataIn) {
+    return UAVObjDirectSet(manualcontrolsettings_direct, dataIn, 0, sizeof(ManualControlSettingsData));
+}
+#else
+extern int32_t ManualControlSettingsGet(ManualControlSettingsData * dataOut);
+extern int32_t ManualControlSettingsSet(const ManualControlSettingsData * dataIn);
+#endif
+#else
+static inline int32_t ManualControlSettingsGet(ManualControlSettingsData * dataOut) {
+    return UAVObjGetData(ManualControlSettingsHandle(), dataOut);
+}
+static inline int32_t ManualControlSettingsSet(const ManualControlSettingsData * dataIn) {
+    return UAVObjSetData(ManualControlSettingsHandle(), dataIn);
+}
+#endif
+static inline int32_t ManualControlSettingsInstGet(uint16_t instId, ManualControlSettingsData * dataOut) {
+    return UAVObjGetInstanceData(ManualControlSettingsHandle(), instId, dataOut);
+}
+static inline int32_t ManualControlSettingsInstSet(uint16_t instId, const ManualControlSettingsData * dataIn) {
+    return UAVObjSetInstanceData(ManualControlSettingsHandle(), instId, dataIn);
+}
+static inline int32_t ManualControlSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(ManualControlSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t ManualControlSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ManualControlSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t ManualControlSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ManualControlSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t ManualControlSettingsCreateInstance() {
+    return UAVObjCreateInstance(ManualControlSettingsHandle(), &ManualControlSettingsSetDefaults);
+}
+static inline void ManualControlSettingsRequestUpdate() {
+    UAVObjRequestUpdate(ManualControlSettingsHandle());
+}
+static inline void ManualControlSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(ManualControlSettingsHandle(), instId);
+}
+static inline void ManualControlSettingsUpdated() {
+    UAVObjUpdated(ManualControlSettingsHandle());
+}
+static inline void ManualControlSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(ManualControlSettingsHandle(), instId);
+}
+static inline void ManualControlSettingsLogging() {
+    UAVObjLogging(ManualControlSettingsHandle());
+}
+static inline void ManualControlSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(ManualControlSettingsHandle(), instId);
+}
+static inline int32_t ManualControlSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(ManualControlSettingsHandle(), dataOut);
+}
+static inline int32_t ManualControlSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(ManualControlSettingsHandle(), dataIn);
+}
+static inline int8_t ManualControlSettingsReadOnly() {
+    return UAVObjReadOnly(ManualControlSettingsHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void ManualControlSettingsFailsafeChannelSet(ManualControlSettingsFailsafeChannelData *NewFailsafeChannel)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewFailsafeChannel, offsetof(ManualControlSettingsData, FailsafeChannel), 9*sizeof(float));
+}
+static inline void ManualControlSettingsFailsafeChannelGet(ManualControlSettingsFailsafeChannelData *NewFailsafeChannel)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewFailsafeChannel, offsetof(ManualControlSettingsData, FailsafeChannel), 9*sizeof(float));
+}
+static inline void ManualControlSettingsFailsafeChannelArraySet(float *NewFailsafeChannel)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewFailsafeChannel, offsetof(ManualControlSettingsData, FailsafeChannel), 9*sizeof(float));
+}
+static inline void ManualControlSettingsFailsafeChannelArrayGet(float *NewFailsafeChannel)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewFailsafeChannel, offsetof(ManualControlSettingsData, FailsafeChannel), 9*sizeof(float));
+}
+static inline void ManualControlSettingsChannelMinSet(ManualControlSettingsChannelMinData *NewChannelMin)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelMin, offsetof(ManualControlSettingsData, ChannelMin), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMinGet(ManualControlSettingsChannelMinData *NewChannelMin)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelMin, offsetof(ManualControlSettingsData, ChannelMin), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMinArraySet(int16_t *NewChannelMin)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelMin, offsetof(ManualControlSettingsData, ChannelMin), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMinArrayGet(int16_t *NewChannelMin)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelMin, offsetof(ManualControlSettingsData, ChannelMin), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelNeutralSet(ManualControlSettingsChannelNeutralData *NewChannelNeutral)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelNeutral, offsetof(ManualControlSettingsData, ChannelNeutral), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelNeutralGet(ManualControlSettingsChannelNeutralData *NewChannelNeutral)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelNeutral, offsetof(ManualControlSettingsData, ChannelNeutral), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelNeutralArraySet(int16_t *NewChannelNeutral)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelNeutral, offsetof(ManualControlSettingsData, ChannelNeutral), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelNeutralArrayGet(int16_t *NewChannelNeutral)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelNeutral, offsetof(ManualControlSettingsData, ChannelNeutral), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMaxSet(ManualControlSettingsChannelMaxData *NewChannelMax)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelMax, offsetof(ManualControlSettingsData, ChannelMax), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMaxGet(ManualControlSettingsChannelMaxData *NewChannelMax)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelMax, offsetof(ManualControlSettingsData, ChannelMax), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMaxArraySet(int16_t *NewChannelMax)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelMax, offsetof(ManualControlSettingsData, ChannelMax), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsChannelMaxArrayGet(int16_t *NewChannelMax)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelMax, offsetof(ManualControlSettingsData, ChannelMax), 11*sizeof(int16_t));
+}
+static inline void ManualControlSettingsResponseTimeSet(ManualControlSettingsResponseTimeData *NewResponseTime)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewResponseTime, offsetof(ManualControlSettingsData, ResponseTime), 9*sizeof(uint16_t));
+}
+static inline void ManualControlSettingsResponseTimeGet(ManualControlSettingsResponseTimeData *NewResponseTime)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewResponseTime, offsetof(ManualControlSettingsData, ResponseTime), 9*sizeof(uint16_t));
+}
+static inline void ManualControlSettingsResponseTimeArraySet(uint16_t *NewResponseTime)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewResponseTime, offsetof(ManualControlSettingsData, ResponseTime), 9*sizeof(uint16_t));
+}
+static inline void ManualControlSettingsResponseTimeArrayGet(uint16_t *NewResponseTime)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewResponseTime, offsetof(ManualControlSettingsData, ResponseTime), 9*sizeof(uint16_t));
+}
+static inline void ManualControlSettingsChannelGroupsSet(ManualControlSettingsChannelGroupsData *NewChannelGroups)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelGroups, offsetof(ManualControlSettingsData, ChannelGroups), 11*sizeof(ManualControlSettingsChannelGroupsOptions));
+}
+static inline void ManualControlSettingsChannelGroupsGet(ManualControlSettingsChannelGroupsData *NewChannelGroups)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelGroups, offsetof(ManualControlSettingsData, ChannelGroups), 11*sizeof(ManualControlSettingsChannelGroupsOptions));
+}
+static inline void ManualControlSettingsChannelGroupsArraySet(ManualControlSettingsChannelGroupsOptions *NewChannelGroups)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelGroups, offsetof(ManualControlSettingsData, ChannelGroups), 11*sizeof(ManualControlSettingsChannelGroupsOptions));
+}
+static inline void ManualControlSettingsChannelGroupsArrayGet(ManualControlSettingsChannelGroupsOptions *NewChannelGroups)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelGroups, offsetof(ManualControlSettingsData, ChannelGroups), 11*sizeof(ManualControlSettingsChannelGroupsOptions));
+}
+static inline void ManualControlSettingsChannelNumberSet(ManualControlSettingsChannelNumberData *NewChannelNumber)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelNumber, offsetof(ManualControlSettingsData, ChannelNumber), 11*sizeof(uint8_t));
+}
+static inline void ManualControlSettingsChannelNumberGet(ManualControlSettingsChannelNumberData *NewChannelNumber)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelNumber, offsetof(ManualControlSettingsData, ChannelNumber), 11*sizeof(uint8_t));
+}
+static inline void ManualControlSettingsChannelNumberArraySet(uint8_t *NewChannelNumber)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewChannelNumber, offsetof(ManualControlSettingsData, ChannelNumber), 11*sizeof(uint8_t));
+}
+static inline void ManualControlSettingsChannelNumberArrayGet(uint8_t *NewChannelNumber)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewChannelNumber, offsetof(ManualControlSettingsData, ChannelNumber), 11*sizeof(uint8_t));
+}
+static inline void ManualControlSettingsDeadbandSet(uint8_t *NewDeadband)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewDeadband, offsetof(ManualControlSettingsData, Deadband), sizeof(uint8_t));
+}
+static inline void ManualControlSettingsDeadbandGet(uint8_t *NewDeadband)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewDeadband, offsetof(ManualControlSettingsData, Deadband), sizeof(uint8_t));
+}
+static inline void ManualControlSettingsDeadbandAssistedControlSet(uint8_t *NewDeadbandAssistedControl)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewDeadbandAssistedControl, offsetof(ManualControlSettingsData, DeadbandAssistedControl), sizeof(uint8_t));
+}
+static inline void ManualControlSettingsDeadbandAssistedControlGet(uint8_t *NewDeadbandAssistedControl)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewDeadbandAssistedControl, offsetof(ManualControlSettingsData, DeadbandAssistedControl), sizeof(uint8_t));
+}
+static inline void ManualControlSettingsFlightModeNumberSet(uint8_t *NewFlightModeNumber)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewFlightModeNumber, offsetof(ManualControlSettingsData, FlightModeNumber), sizeof(uint8_t));
+}
+static inline void ManualControlSettingsFlightModeNumberGet(uint8_t *NewFlightModeNumber)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewFlightModeNumber, offsetof(ManualControlSettingsData, FlightModeNumber), sizeof(uint8_t));
+}
+static inline void ManualControlSettingsFailsafeFlightModeSwitchPositionSet(int8_t *NewFailsafeFlightModeSwitchPosition)
+{
+    UAVObjDirectSet(manualcontrolsettings_direct, (void *)NewFailsafeFlightModeSwitchPosition, offsetof(ManualControlSettingsData, FailsafeFlightModeSwitchPosition), sizeof(int8_t));
+}
+static inline void ManualControlSettingsFailsafeFlightModeSwitchPositionGet(int8_t *NewFailsafeFlightModeSwitchPosition)
+{
+    UAVObjDirectGet(manualcontrolsettings_direct, (void *)NewFailsafeFlightModeSwitchPosition, offsetof(ManualControlSettingsData, FailsafeFlightModeSwitchPosition), sizeof(int8_t));
+}
+#else
+extern void ManualControlSettingsFailsafeChannelSet(ManualControlSettingsFailsafeChannelData *NewFailsafeChannel);
+extern void ManualControlSettingsFailsafeChannelGet(ManualControlSettingsFailsafeChannelData *NewFailsafeChannel);
+extern void ManualControlSettingsFailsafeChannelArraySet(float *NewFailsafeChannel);
+extern void ManualControlSettingsFailsafeChannelArrayGet(float *NewFailsafeChannel);
+extern void ManualControlSettingsChannelMinSet(ManualControlSettingsChannelMinData *NewChannelMin);
+extern void ManualControlSettingsChannelMinGet(ManualControlSettingsChannelMinData *NewChannelMin);
+extern void ManualControlSettingsChannelMinArraySet(int16_t *NewChannelMin);
+extern void ManualControlSettingsChannelMinArrayGet(int16_t *NewChannelMin);
+extern void ManualControlSettingsChannelNeutralSet(ManualControlSettingsChannelNeutralData *NewChannelNeutral);
+extern void ManualControlSettingsChannelNeutralGet(ManualControlSettingsChannelNeutralData *NewChannelNeutral);
+extern void ManualControlSettingsChannelNeutralArraySet(int16_t *NewChannelNeutral);
+extern void ManualControlSettingsChannelNeutralArrayGet(int16_t *NewChannelNeutral);
+extern void ManualControlSettingsChannelMaxSet(ManualControlSettingsChannelMaxData *NewChannelMax);
+extern void ManualControlSettingsChannelMaxGet(ManualControlSettingsChannelMaxData *NewChannelMax);
+extern void ManualControlSettingsChannelMaxArraySet(int16_t *NewChannelMax);
+extern void ManualControlSettingsChannelMaxArrayGet(int16_t *NewChannelMax);
+extern void ManualControlSettingsResponseTimeSet(ManualControlSettingsResponseTimeData *NewResponseTime);
+extern void ManualControlSettingsResponseTimeGet(ManualControlSettingsResponseTimeData *NewResponseTime);
+extern void ManualControlSettingsResponseTimeArraySet(uint16_t *NewResponseTime);
+extern void ManualControlSettingsResponseTimeArrayGet(uint16_t *NewResponseTime);
+extern void ManualControlSettingsChannelGroupsSet(ManualControlSettingsChannelGroupsData *NewChannelGroups);
+extern void ManualControlSettingsChannelGroupsGet(ManualControlSettingsChannelGroupsData *NewChannelGroups);
+extern void ManualControlSettingsChannelGroupsArraySet(ManualControlSettingsChannelGroupsOptions *NewChannelGroups);
+extern void ManualControlSettingsChannelGroupsArrayGet(ManualControlSettingsChannelGroupsOptions *NewChannelGroups);
+extern void ManualControlSettingsChannelNumberSet(ManualControlSettingsChannelNumberData *NewChannelNumber);
+extern void ManualControlSettingsChannelNumberGet(ManualControlSettingsChannelNumberData *NewChannelNumber);
+extern void ManualControlSettingsChannelNumberArraySet(uint8_t *NewChannelNumber);
+extern void ManualControlSettingsChannelNumberArrayGet(uint8_t *NewChannelNumber);
+extern void ManualControlSettingsDeadbandSet(uint8_t *NewDeadband);
+extern void ManualControlSettingsDeadbandGet(uint8_t *NewDeadband);
+extern void ManualControlSettingsDeadbandAssistedControlSet(uint8_t *NewDeadbandAssistedControl);
+extern void ManualControlSettingsDeadbandAssistedControlGet(uint8_t *NewDeadbandAssistedControl);
+extern void ManualControlSettingsFlightModeNumberSet(uint8_t *NewFlightModeNumber);
+extern void ManualControlSettingsFlightModeNumberGet(uint8_t *NewFlightModeNumber);
+extern void ManualControlSettingsFailsafeFlightModeSwitchPositionSet(int8_t *NewFailsafeFlightModeSwitchPosition);
+extern void ManualControlSettingsFailsafeFlightModeSwitchPositionGet(int8_t *NewFailsafeFlightModeSwitchPosition);
+#endif
+
+
+#endif // MANUALCONTROLSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
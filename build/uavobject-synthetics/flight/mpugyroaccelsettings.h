@@ -0,0 +1,222 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup MPUGyroAccelSettings MPUGyroAccelSettings
+ * @brief Settings for the @ref MPU6000 and MPU9000 sensor series. Used in CC3D, Revolution and RevoBone. Reboot the board for this to takes effect
+ *
+ * Autogenerated files and functions for MPUGyroAccelSettings Object
+ *
+ * @{
+ *
+ * @file       mpugyroaccelsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the MPUGyroAccelSettings object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: mpugyroaccelsettings.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MPUGYROACCELSETTINGS_H
+#define MPUGYROACCELSETTINGS_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define MPUGYROACCELSETTINGS_OBJID 0x7E2826C8
+#define MPUGYROACCELSETTINGS_ISSINGLEINST 1
+#define MPUGYROACCELSETTINGS_ISSETTINGS 1
+#define MPUGYROACCELSETTINGS_ISPRIORITY 0
+#define MPUGYROACCELSETTINGS_NUMBYTES sizeof(MPUGyroAccelSettingsData)
+
+/* Generic interface functions */
+int32_t MPUGyroAccelSettingsInitialize();
+UAVObjHandle MPUGyroAccelSettingsHandle();
+void MPUGyroAccelSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field GyroScale information */
+
+// Enumeration options for field GyroScale
+typedef enum __attribute__ ((__packed__)) {
+    MPUGYROACCELSETTINGS_GYROSCALE_SCALE_250=0,
+    MPUGYROACCELSETTINGS_GYROSCALE_SCALE_500=1,
+    MPUGYROACCELSETTINGS_GYROSCALE_SCALE_1000=2,
+    MPUGYROACCELSETTINGS_GYROSCALE_SCALE_2000=3
+} MPUGyroAccelSettingsGyroScaleOptions;
+
+/* Field AccelScale information */
+
+// Enumeration options for field AccelScale
+typedef enum __attribute__ ((__packed__)) {
+    MPUGYROACCELSETTINGS_ACCELSCALE_SCALE_2G=0,
+    MPUGYROACCELSETTINGS_ACCELSCALE_SCALE_4G=1,
+    MPUGYROACCELSETTINGS_ACCELSCALE_SCALE_8G=2,
+    MPUGYROACCELSETTINGS_ACCELSCALE_SCALE_16G=3
+} MPUGyroAccelSettingsAccelScaleOptions;
+
+/* Field FilterSetting information */
+
+// Enumeration options for field FilterSetting
+typedef enum __attribute__ ((__packed__)) {
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_256_HZ=0,
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_188_HZ=1,
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_98_HZ=2,
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_42_HZ=3,
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_20_HZ=4,
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_10_HZ=5,
+    MPUGYROACCELSETTINGS_FILTERSETTING_LOWPASS_5_HZ=6
+} MPUGyroAccelSettingsFilterSettingOptions;
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        MPUGyroAccelSettingsGyroScaleOptions GyroScale;
+    MPUGyroAccelSettingsAccelScaleOptions AccelScale;
+    MPUGyroAccelSettingsFilterSettingOptions FilterSetting;
+
+} __attribute__((packed)) MPUGyroAccelSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef MPUGyroAccelSettingsDataPacked __attribute__((aligned(4))) MPUGyroAccelSettingsData;
+
+/* Typesafe Object access functions */
+#if MPUGYROACCELSETTINGS_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *mpugyroaccelsettings_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t MPUGyroAccelSettingsGet(MPUGyroAccelSettingsData * dataOut) {
+    return UAVObjDirectGet(mpugyroaccelsettings_direct, dataOut, 0, sizeof(MPUGyroAccelSettingsData));
+}
+static inline int32_t MPUGyroAccelSettingsSet(const MPUGyroAccelSettingsData * dataIn) {
+    return UAVObjDirectSet(mpugyroaccelsettings_direct, dataIn, 0, sizeof(MPUGyroAccelSettingsData));
+}
+#else
+extern int32_t MPUGyroAccelSettingsGet(MPUGyroAccelSettingsData * dataOut);
+extern int32_t MPUGyroAccelSettingsSet(const MPUGyroAccelSettingsData * dataIn);
+#endif
+#else
+static inline int32_t MPUGyroAccelSettingsGet(MPUGyroAccelSettingsData * dataOut) {
+    return UAVObjGetData(MPUGyroAccelSettingsHandle(), dataOut);
+}
+static inline int32_t MPUGyroAccelSettingsSet(const MPUGyroAccelSettingsData * dataIn) {
+    return UAVObjSetData(MPUGyroAccelSettingsHandle(), dataIn);
+}
+#endif
+static inline int32_t MPUGyroAccelSettingsInstGet(uint16_t instId, MPUGyroAccelSettingsData * dataOut) {
+    return UAVObjGetInstanceData(MPUGyroAccelSettingsHandle(), instId, dataOut);
+}
+static inline int32_t MPUGyroAccelSettingsInstSet(uint16_t instId, const MPUGyroAccelSettingsData * dataIn) {
+    return UAVObjSetInstanceData(MPUGyroAccelSettingsHandle(), instId, dataIn);
+}
+static inline int32_t MPUGyroAccelSettingsConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(MPUGyroAccelSettingsHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t MPUGyroAccelSettingsConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(MPUGyroAccelSettingsHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t MPUGyroAccelSettingsConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(MPUGyroAccelSettingsHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t MPUGyroAccelSettingsCreateInstance() {
+    return UAVObjCreateInstance(MPUGyroAccelSettingsHandle(), &MPUGyroAccelSettingsSetDefaults);
+}
+static inline void MPUGyroAccelSettingsRequestUpdate() {
+    UAVObjRequestUpdate(MPUGyroAccelSettingsHandle());
+}
+static inline void MPUGyroAccelSettingsRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(MPUGyroAccelSettingsHandle(), instId);
+}
+static inline void MPUGyroAccelSettingsUpdated() {
+    UAVObjUpdated(MPUGyroAccelSettingsHandle());
+}
+static inline void MPUGyroAccelSettingsInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(MPUGyroAccelSettingsHandle(), instId);
+}
+static inline void MPUGyroAccelSettingsLogging() {
+    UAVObjLogging(MPUGyroAccelSettingsHandle());
+}
+static inline void MPUGyroAccelSettingsInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(MPUGyroAccelSettingsHandle(), instId);
+}
+static inline int32_t MPUGyroAccelSettingsGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(MPUGyroAccelSettingsHandle(), dataOut);
+}
+static inline int32_t MPUGyroAccelSettingsSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(MPUGyroAccelSettingsHandle(), dataIn);
+}
+static inline int8_t MPUGyroAccelSettingsReadOnly() {
+    return UAVObjReadOnly(MPUGyroAccelSettingsHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void MPUGyroAccelSettingsGyroScaleSet(MPUGyroAccelSettingsGyroScaleOptions *NewGyroScale)
+{
+    UAVObjDirectSet(mpugyroaccelsettings_direct, (void *)NewGyroScale, offsetof(MPUGyroAccelSettingsData, GyroScale), sizeof(MPUGyroAccelSettingsGyroScaleOptions));
+}
+static inline void MPUGyroAccelSettingsGyroScaleGet(MPUGyroAccelSettingsGyroScaleOptions *NewGyroScale)
+{
+    UAVObjDirectGet(mpugyroaccelsettings_direct, (void *)NewGyroScale, offsetof(MPUGyroAccelSettingsData, GyroScale), sizeof(MPUGyroAccelSettingsGyroScaleOptions));
+}
+static inline void MPUGyroAccelSettingsAccelScaleSet(MPUGyroAccelSettingsAccelScaleOptions *NewAccelScale)
+{
+    UAVObjDirectSet(mpugyroaccelsettings_direct, (void *)NewAccelScale, offsetof(MPUGyroAccelSettingsData, AccelScale), sizeof(MPUGyroAccelSettingsAccelScaleOptions));
+}
+static inline void MPUGyroAccelSettingsAccelScaleGet(MPUGyroAccelSettingsAccelScaleOptions *NewAccelScale)
+{
+    UAVObjDirectGet(mpugyroaccelsettings_direct, (void *)NewAccelScale, offsetof(MPUGyroAccelSettingsData, AccelScale), sizeof(MPUGyroAccelSettingsAccelScaleOptions));
+}
+static inline void MPUGyroAccelSettingsFilterSettingSet(MPUGyroAccelSettingsFilterSettingOptions *NewFilterSetting)
+{
+    UAVObjDirectSet(mpugyroaccelsettings_direct, (void *)NewFilterSetting, offsetof(MPUGyroAccelSettingsData, FilterSetting), sizeof(MPUGyroAccelSettingsFilterSettingOptions));
+}
+static inline void MPUGyroAccelSettingsFilterSettingGet(MPUGyroAccelSettingsFilterSettingOptions *NewFilterSetting)
+{
+    UAVObjDirectGet(mpugyroaccelsettings_direct, (void *)NewFilterSetting, offsetof(MPUGyroAccelSettingsData, FilterSetting), sizeof(MPUGyroAccelSettingsFilterSettingOptions));
+}
+#else
+extern void MPUGyroAccelSettingsGyroScaleSet(MPUGyroAccelSettingsGyroScaleOptions *NewGyroScale);
+extern void MPUGyroAccelSettingsGyroScaleGet(MPUGyroAccelSettingsGyroScaleOptions *NewGyroScale);
+extern void MPUGyroAccelSettingsAccelScaleSet(MPUGyroAccelSettingsAccelScaleOptions *NewAccelScale);
+extern void MPUGyroAccelSettingsAccelScaleGet(MPUGyroAccelSettingsAccelScaleOptions *NewAccelScale);
+extern void MPUGyroAccelSettingsFilterSettingSet(MPUGyroAccelSettingsFilterSettingOptions *NewFilterSetting);
+extern void MPUGyroAccelSettingsFilterSettingGet(MPUGyroAccelSettingsFilterSettingOptions *NewFilterSetting);
+#endif
+
+
+#endif // MPUGYROACCELSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
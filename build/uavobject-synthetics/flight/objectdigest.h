@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup ObjectDigest ObjectDigest
+ * @brief CRC32 of the data of each settings object, refreshed by the @ref Telemetry module when a GCS connects. The GCS only requests the settings that differ from its cache.
+ *
+ * Autogenerated files and functions for ObjectDigest Object
+ *
+ * @{
+ *
+ * @file       objectdigest.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the ObjectDigest object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: objectdigest.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OBJECTDIGEST_H
+#define OBJECTDIGEST_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define OBJECTDIGEST_OBJID 0x5B160CD0
+#define OBJECTDIGEST_ISSINGLEINST 0
+#define OBJECTDIGEST_ISSETTINGS 0
+#define OBJECTDIGEST_ISPRIORITY 0
+#define OBJECTDIGEST_NUMBYTES sizeof(ObjectDigestData)
+
+/* Generic interface functions */
+int32_t ObjectDigestInitialize();
+UAVObjHandle ObjectDigestHandle();
+void ObjectDigestSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field ObjectID information */
+
+// Number of elements for field ObjectID
+#define OBJECTDIGEST_OBJECTID_NUMELEM 16
+
+/* Field Digest information */
+
+// Number of elements for field Digest
+#define OBJECTDIGEST_DIGEST_NUMELEM 16
+
+
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        uint32_t ObjectID[16];
+    uint32_t Digest[16];
+
+} __attribute__((packed)) ObjectDigestDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef ObjectDigestDataPacked __attribute__((aligned(4))) ObjectDigestData;
+
+/* Typesafe Object access functions */
+#if OBJECTDIGEST_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *objectdigest_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t ObjectDigestGet(ObjectDigestData * dataOut) {
+    return UAVObjDirectGet(objectdigest_direct, dataOut, 0, sizeof(ObjectDigestData));
+}
+static inline int32_t ObjectDigestSet(const ObjectDigestData * dataIn) {
+    return UAVObjDirectSet(objectdigest_direct, dataIn, 0, sizeof(ObjectDigestData));
+}
+#else
+extern int32_t ObjectDigestGet(ObjectDigestData * dataOut);
+extern int32_t ObjectDigestSet(const ObjectDigestData * dataIn);
+#endif
+#else
+static inline int32_t ObjectDigestGet(ObjectDigestData * dataOut) {
+    return UAVObjGetData(ObjectDigestHandle(), dataOut);
+}
+static inline int32_t ObjectDigestSet(const ObjectDigestData * dataIn) {
+    return UAVObjSetData(ObjectDigestHandle(), dataIn);
+}
+#endif
+static inline int32_t ObjectDigestInstGet(uint16_t instId, ObjectDigestData * dataOut) {
+    return UAVObjGetInstanceData(ObjectDigestHandle(), instId, dataOut);
+}
+static inline int32_t ObjectDigestInstSet(uint16_t instId, const ObjectDigestData * dataIn) {
+    return UAVObjSetInstanceData(ObjectDigestHandle(), instId, dataIn);
+}
+static inline int32_t ObjectDigestConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(ObjectDigestHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t ObjectDigestConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ObjectDigestHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t ObjectDigestConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(ObjectDigestHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t ObjectDigestCreateInstance() {
+    return UAVObjCreateInstance(ObjectDigestHandle(), &ObjectDigestSetDefaults);
+}
+static inline void ObjectDigestRequestUpdate() {
+    UAVObjRequestUpdate(ObjectDigestHandle());
+}
+static inline void ObjectDigestRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(ObjectDigestHandle(), instId);
+}
+static inline void ObjectDigestUpdated() {
+    UAVObjUpdated(ObjectDigestHandle());
+}
+static inline void ObjectDigestInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(ObjectDigestHandle(), instId);
+}
+static inline void ObjectDigestLogging() {
+    UAVObjLogging(ObjectDigestHandle());
+}
+static inline void ObjectDigestInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(ObjectDigestHandle(), instId);
+}
+static inline int32_t ObjectDigestGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(ObjectDigestHandle(), dataOut);
+}
+static inline int32_t ObjectDigestSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(ObjectDigestHandle(), dataIn);
+}
+static inline int8_t ObjectDigestReadOnly() {
+    return UAVObjReadOnly(ObjectDigestHandle());
+}
+
+/* Set/Get functions */
+extern void ObjectDigestObjectIDSet(uint32_t *NewObjectID);
+extern void ObjectDigestObjectIDGet(uint32_t *NewObjectID);
+extern void ObjectDigestDigestSet(uint32_t *NewDigest);
+extern void ObjectDigestDigestGet(uint32_t *NewDigest);
+
+
+#endif // OBJECTDIGEST_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,411 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OPLinkSettings OPLinkSettings
+ * @brief OPLink configurations options.
+ *
+ * Autogenerated files and functions for OPLinkSettings Object
+ * @{ 
+ *
+ * @file       oplinksettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OPLinkSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: oplinksettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "oplinksettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if OPLINKSETTINGS_ISSINGLEINST
+UAVObjDirect *oplinksettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OPLinkSettingsInitialize(void)
+{
+    // Compile time assertion that the OPLinkSettingsDataPacked and OPLinkSettingsData structs
+    // have the same size (though instances of OPLinkSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OPLinkSettingsDataPacked) == sizeof(OPLinkSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OPLINKSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(OPLINKSETTINGS_OBJID,
+        OPLINKSETTINGS_ISSINGLEINST, OPLINKSETTINGS_ISSETTINGS, OPLINKSETTINGS_ISPRIORITY, OPLINKSETTINGS_NUMBYTES, &OPLinkSettingsSetDefaults);
+#if OPLINKSETTINGS_ISSINGLEINST
+    oplinksettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OPLinkSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OPLinkSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OPLinkSettingsData));
+    data.CoordID = 0;
+    data.CustomDeviceID = 0;
+    data.SerialBaudrate = 0;
+    data.RFFrequency = 0;
+    data.FailsafeDelay = 1000;
+    data.BeaconFrequency = 462712500;
+    data.Protocol = 0;
+    data.LinkType = 0;
+    data.MainPort = 0;
+    data.FlexiPort = 0;
+    data.VCPPort = 0;
+    data.ComSpeed = 3;
+    data.LinkAdaptation = 0;
+    data.MaxRFPower = 0;
+    data.RFBand = 0;
+    data.MinChannel = 0;
+    data.MaxChannel = 250;
+    data.RFXtalCap = 127;
+    data.Version = 0;
+    data.RSSIType = 0;
+    data.RFPower = 0;
+    data.RFChannelSpacing = 0;
+    data.HopChannel[0] = 0;
+    data.HopChannel[1] = 0;
+    data.HopChannel[2] = 0;
+    data.HopChannel[3] = 0;
+    data.HopChannel[4] = 0;
+    data.HopChannel[5] = 0;
+    data.HopChannel[6] = 0;
+    data.HopChannel[7] = 0;
+    data.HopChannel[8] = 0;
+    data.HopChannel[9] = 0;
+    data.HopChannel[10] = 0;
+    data.HopChannel[11] = 0;
+    data.HopChannel[12] = 0;
+    data.HopChannel[13] = 0;
+    data.HopChannel[14] = 0;
+    data.HopChannel[15] = 0;
+    data.HopChannel[16] = 0;
+    data.HopChannel[17] = 0;
+    data.HopChannel[18] = 0;
+    data.HopChannel[19] = 0;
+    data.HopChannel[20] = 0;
+    data.HopChannel[21] = 0;
+    data.HopChannel[22] = 0;
+    data.HopChannel[23] = 0;
+    data.ModemParams = 0;
+    data.Flags = 0;
+    data.BeaconDelay = 30;
+    data.BeaconPeriod = 15;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OPLinkSettingsHandle()
+{
+    return handle;
+}
+
+#if OPLINKSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t OPLinkSettingsGet(OPLinkSettingsData *dataOut)
+{
+    return UAVObjDirectGet(oplinksettings_direct, dataOut, 0, sizeof(OPLinkSettingsData));
+}
+
+int32_t OPLinkSettingsSet(const OPLinkSettingsData *dataIn)
+{
+    return UAVObjDirectSet(oplinksettings_direct, dataIn, 0, sizeof(OPLinkSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void OPLinkSettingsCoordIDSet(uint32_t *NewCoordID)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewCoordID, offsetof(OPLinkSettingsData, CoordID), sizeof(uint32_t));
+}
+void OPLinkSettingsCoordIDGet(uint32_t *NewCoordID)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewCoordID, offsetof(OPLinkSettingsData, CoordID), sizeof(uint32_t));
+}
+void OPLinkSettingsCustomDeviceIDSet(uint32_t *NewCustomDeviceID)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewCustomDeviceID, offsetof(OPLinkSettingsData, CustomDeviceID), sizeof(uint32_t));
+}
+void OPLinkSettingsCustomDeviceIDGet(uint32_t *NewCustomDeviceID)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewCustomDeviceID, offsetof(OPLinkSettingsData, CustomDeviceID), sizeof(uint32_t));
+}
+void OPLinkSettingsSerialBaudrateSet(uint32_t *NewSerialBaudrate)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewSerialBaudrate, offsetof(OPLinkSettingsData, SerialBaudrate), sizeof(uint32_t));
+}
+void OPLinkSettingsSerialBaudrateGet(uint32_t *NewSerialBaudrate)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewSerialBaudrate, offsetof(OPLinkSettingsData, SerialBaudrate), sizeof(uint32_t));
+}
+void OPLinkSettingsRFFrequencySet(uint32_t *NewRFFrequency)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFFrequency, offsetof(OPLinkSettingsData, RFFrequency), sizeof(uint32_t));
+}
+void OPLinkSettingsRFFrequencyGet(uint32_t *NewRFFrequency)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFFrequency, offsetof(OPLinkSettingsData, RFFrequency), sizeof(uint32_t));
+}
+void OPLinkSettingsFailsafeDelaySet(uint32_t *NewFailsafeDelay)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewFailsafeDelay, offsetof(OPLinkSettingsData, FailsafeDelay), sizeof(uint32_t));
+}
+void OPLinkSettingsFailsafeDelayGet(uint32_t *NewFailsafeDelay)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewFailsafeDelay, offsetof(OPLinkSettingsData, FailsafeDelay), sizeof(uint32_t));
+}
+void OPLinkSettingsBeaconFrequencySet(uint32_t *NewBeaconFrequency)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewBeaconFrequency, offsetof(OPLinkSettingsData, BeaconFrequency), sizeof(uint32_t));
+}
+void OPLinkSettingsBeaconFrequencyGet(uint32_t *NewBeaconFrequency)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewBeaconFrequency, offsetof(OPLinkSettingsData, BeaconFrequency), sizeof(uint32_t));
+}
+void OPLinkSettingsProtocolSet(OPLinkSettingsProtocolOptions *NewProtocol)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewProtocol, offsetof(OPLinkSettingsData, Protocol), sizeof(OPLinkSettingsProtocolOptions));
+}
+void OPLinkSettingsProtocolGet(OPLinkSettingsProtocolOptions *NewProtocol)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewProtocol, offsetof(OPLinkSettingsData, Protocol), sizeof(OPLinkSettingsProtocolOptions));
+}
+void OPLinkSettingsLinkTypeSet(OPLinkSettingsLinkTypeOptions *NewLinkType)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewLinkType, offsetof(OPLinkSettingsData, LinkType), sizeof(OPLinkSettingsLinkTypeOptions));
+}
+void OPLinkSettingsLinkTypeGet(OPLinkSettingsLinkTypeOptions *NewLinkType)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewLinkType, offsetof(OPLinkSettingsData, LinkType), sizeof(OPLinkSettingsLinkTypeOptions));
+}
+void OPLinkSettingsMainPortSet(OPLinkSettingsMainPortOptions *NewMainPort)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMainPort, offsetof(OPLinkSettingsData, MainPort), sizeof(OPLinkSettingsMainPortOptions));
+}
+void OPLinkSettingsMainPortGet(OPLinkSettingsMainPortOptions *NewMainPort)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMainPort, offsetof(OPLinkSettingsData, MainPort), sizeof(OPLinkSettingsMainPortOptions));
+}
+void OPLinkSettingsFlexiPortSet(OPLinkSettingsFlexiPortOptions *NewFlexiPort)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewFlexiPort, offsetof(OPLinkSettingsData, FlexiPort), sizeof(OPLinkSettingsFlexiPortOptions));
+}
+void OPLinkSettingsFlexiPortGet(OPLinkSettingsFlexiPortOptions *NewFlexiPort)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewFlexiPort, offsetof(OPLinkSettingsData, FlexiPort), sizeof(OPLinkSettingsFlexiPortOptions));
+}
+void OPLinkSettingsVCPPortSet(OPLinkSettingsVCPPortOptions *NewVCPPort)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewVCPPort, offsetof(OPLinkSettingsData, VCPPort), sizeof(OPLinkSettingsVCPPortOptions));
+}
+void OPLinkSettingsVCPPortGet(OPLinkSettingsVCPPortOptions *NewVCPPort)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewVCPPort, offsetof(OPLinkSettingsData, VCPPort), sizeof(OPLinkSettingsVCPPortOptions));
+}
+void OPLinkSettingsComSpeedSet(OPLinkSettingsComSpeedOptions *NewComSpeed)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewComSpeed, offsetof(OPLinkSettingsData, ComSpeed), sizeof(OPLinkSettingsComSpeedOptions));
+}
+void OPLinkSettingsComSpeedGet(OPLinkSettingsComSpeedOptions *NewComSpeed)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewComSpeed, offsetof(OPLinkSettingsData, ComSpeed), sizeof(OPLinkSettingsComSpeedOptions));
+}
+void OPLinkSettingsLinkAdaptationSet(OPLinkSettingsLinkAdaptationOptions *NewLinkAdaptation)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewLinkAdaptation, offsetof(OPLinkSettingsData, LinkAdaptation), sizeof(OPLinkSettingsLinkAdaptationOptions));
+}
+void OPLinkSettingsLinkAdaptationGet(OPLinkSettingsLinkAdaptationOptions *NewLinkAdaptation)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewLinkAdaptation, offsetof(OPLinkSettingsData, LinkAdaptation), sizeof(OPLinkSettingsLinkAdaptationOptions));
+}
+void OPLinkSettingsMaxRFPowerSet(OPLinkSettingsMaxRFPowerOptions *NewMaxRFPower)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMaxRFPower, offsetof(OPLinkSettingsData, MaxRFPower), sizeof(OPLinkSettingsMaxRFPowerOptions));
+}
+void OPLinkSettingsMaxRFPowerGet(OPLinkSettingsMaxRFPowerOptions *NewMaxRFPower)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMaxRFPower, offsetof(OPLinkSettingsData, MaxRFPower), sizeof(OPLinkSettingsMaxRFPowerOptions));
+}
+void OPLinkSettingsRFBandSet(OPLinkSettingsRFBandOptions *NewRFBand)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFBand, offsetof(OPLinkSettingsData, RFBand), sizeof(OPLinkSettingsRFBandOptions));
+}
+void OPLinkSettingsRFBandGet(OPLinkSettingsRFBandOptions *NewRFBand)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFBand, offsetof(OPLinkSettingsData, RFBand), sizeof(OPLinkSettingsRFBandOptions));
+}
+void OPLinkSettingsMinChannelSet(uint8_t *NewMinChannel)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMinChannel, offsetof(OPLinkSettingsData, MinChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsMinChannelGet(uint8_t *NewMinChannel)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMinChannel, offsetof(OPLinkSettingsData, MinChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsMaxChannelSet(uint8_t *NewMaxChannel)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewMaxChannel, offsetof(OPLinkSettingsData, MaxChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsMaxChannelGet(uint8_t *NewMaxChannel)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewMaxChannel, offsetof(OPLinkSettingsData, MaxChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsRFXtalCapSet(uint8_t *NewRFXtalCap)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFXtalCap, offsetof(OPLinkSettingsData, RFXtalCap), sizeof(uint8_t));
+}
+void OPLinkSettingsRFXtalCapGet(uint8_t *NewRFXtalCap)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFXtalCap, offsetof(OPLinkSettingsData, RFXtalCap), sizeof(uint8_t));
+}
+void OPLinkSettingsVersionSet(uint8_t *NewVersion)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewVersion, offsetof(OPLinkSettingsData, Version), sizeof(uint8_t));
+}
+void OPLinkSettingsVersionGet(uint8_t *NewVersion)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewVersion, offsetof(OPLinkSettingsData, Version), sizeof(uint8_t));
+}
+void OPLinkSettingsRSSITypeSet(OPLinkSettingsRSSITypeOptions *NewRSSIType)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRSSIType, offsetof(OPLinkSettingsData, RSSIType), sizeof(OPLinkSettingsRSSITypeOptions));
+}
+void OPLinkSettingsRSSITypeGet(OPLinkSettingsRSSITypeOptions *NewRSSIType)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRSSIType, offsetof(OPLinkSettingsData, RSSIType), sizeof(OPLinkSettingsRSSITypeOptions));
+}
+void OPLinkSettingsRFPowerSet(uint8_t *NewRFPower)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFPower, offsetof(OPLinkSettingsData, RFPower), sizeof(uint8_t));
+}
+void OPLinkSettingsRFPowerGet(uint8_t *NewRFPower)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFPower, offsetof(OPLinkSettingsData, RFPower), sizeof(uint8_t));
+}
+void OPLinkSettingsRFChannelSpacingSet(uint8_t *NewRFChannelSpacing)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewRFChannelSpacing, offsetof(OPLinkSettingsData, RFChannelSpacing), sizeof(uint8_t));
+}
+void OPLinkSettingsRFChannelSpacingGet(uint8_t *NewRFChannelSpacing)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewRFChannelSpacing, offsetof(OPLinkSettingsData, RFChannelSpacing), sizeof(uint8_t));
+}
+void OPLinkSettingsHopChannelSet(uint8_t *NewHopChannel)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewHopChannel, offsetof(OPLinkSettingsData, HopChannel), 24*sizeof(uint8_t));
+}
+void OPLinkSettingsHopChannelGet(uint8_t *NewHopChannel)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewHopChannel, offsetof(OPLinkSettingsData, HopChannel), 24*sizeof(uint8_t));
+}
+void OPLinkSettingsModemParamsSet(uint8_t *NewModemParams)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewModemParams, offsetof(OPLinkSettingsData, ModemParams), sizeof(uint8_t));
+}
+void OPLinkSettingsModemParamsGet(uint8_t *NewModemParams)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewModemParams, offsetof(OPLinkSettingsData, ModemParams), sizeof(uint8_t));
+}
+void OPLinkSettingsFlagsSet(uint8_t *NewFlags)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewFlags, offsetof(OPLinkSettingsData, Flags), sizeof(uint8_t));
+}
+void OPLinkSettingsFlagsGet(uint8_t *NewFlags)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewFlags, offsetof(OPLinkSettingsData, Flags), sizeof(uint8_t));
+}
+void OPLinkSettingsBeaconDelaySet(uint8_t *NewBeaconDelay)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewBeaconDelay, offsetof(OPLinkSettingsData, BeaconDelay), sizeof(uint8_t));
+}
+void OPLinkSettingsBeaconDelayGet(uint8_t *NewBeaconDelay)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewBeaconDelay, offsetof(OPLinkSettingsData, BeaconDelay), sizeof(uint8_t));
+}
+void OPLinkSettingsBeaconPeriodSet(uint8_t *NewBeaconPeriod)
+{
+    UAVObjDirectSet(oplinksettings_direct, (void *)NewBeaconPeriod, offsetof(OPLinkSettingsData, BeaconPeriod), sizeof(uint8_t));
+}
+void OPLinkSettingsBeaconPeriodGet(uint8_t *NewBeaconPeriod)
+{
+    UAVObjDirectGet(oplinksettings_direct, (void *)NewBeaconPeriod, offsetof(OPLinkSettingsData, BeaconPeriod), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
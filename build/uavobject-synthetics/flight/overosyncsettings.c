@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OveroSyncSettings OveroSyncSettings
+ * @brief Settings to control the behavior of the overo sync module
+ *
+ * Autogenerated files and functions for OveroSyncSettings Object
+ * @{ 
+ *
+ * @file       overosyncsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OveroSyncSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: overosyncsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "overosyncsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if OVEROSYNCSETTINGS_ISSINGLEINST
+UAVObjDirect *overosyncsettings_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OveroSyncSettingsInitialize(void)
+{
+    // Compile time assertion that the OveroSyncSettingsDataPacked and OveroSyncSettingsData structs
+    // have the same size (though instances of OveroSyncSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OveroSyncSettingsDataPacked) == sizeof(OveroSyncSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OVEROSYNCSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(OVEROSYNCSETTINGS_OBJID,
+        OVEROSYNCSETTINGS_ISSINGLEINST, OVEROSYNCSETTINGS_ISSETTINGS, OVEROSYNCSETTINGS_ISPRIORITY, OVEROSYNCSETTINGS_NUMBYTES, &OveroSyncSettingsSetDefaults);
+#if OVEROSYNCSETTINGS_ISSINGLEINST
+    overosyncsettings_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OveroSyncSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OveroSyncSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OveroSyncSettingsData));
+    data.LogOn = 2;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OveroSyncSettingsHandle()
+{
+    return handle;
+}
+
+#if OVEROSYNCSETTINGS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t OveroSyncSettingsGet(OveroSyncSettingsData *dataOut)
+{
+    return UAVObjDirectGet(overosyncsettings_direct, dataOut, 0, sizeof(OveroSyncSettingsData));
+}
+
+int32_t OveroSyncSettingsSet(const OveroSyncSettingsData *dataIn)
+{
+    return UAVObjDirectSet(overosyncsettings_direct, dataIn, 0, sizeof(OveroSyncSettingsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void OveroSyncSettingsLogOnSet(OveroSyncSettingsLogOnOptions *NewLogOn)
+{
+    UAVObjDirectSet(overosyncsettings_direct, (void *)NewLogOn, offsetof(OveroSyncSettingsData, LogOn), sizeof(OveroSyncSettingsLogOnOptions));
+}
+void OveroSyncSettingsLogOnGet(OveroSyncSettingsLogOnOptions *NewLogOn)
+{
+    UAVObjDirectGet(overosyncsettings_direct, (void *)NewLogOn, offsetof(OveroSyncSettingsData, LogOn), sizeof(OveroSyncSettingsLogOnOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PathPlan PathPlan
+ * @brief Flight plan informations
+ *
+ * Autogenerated files and functions for PathPlan Object
+ * @{ 
+ *
+ * @file       pathplan.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PathPlan object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pathplan.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "pathplan.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if PATHPLAN_ISSINGLEINST
+UAVObjDirect *pathplan_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PathPlanInitialize(void)
+{
+    // Compile time assertion that the PathPlanDataPacked and PathPlanData structs
+    // have the same size (though instances of PathPlanData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PathPlanDataPacked) == sizeof(PathPlanData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PATHPLAN_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(PATHPLAN_OBJID,
+        PATHPLAN_ISSINGLEINST, PATHPLAN_ISSETTINGS, PATHPLAN_ISPRIORITY, PATHPLAN_NUMBYTES, &PathPlanSetDefaults);
+#if PATHPLAN_ISSINGLEINST
+    pathplan_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PathPlanSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PathPlanData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PathPlanData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READONLY << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PathPlanHandle()
+{
+    return handle;
+}
+
+#if PATHPLAN_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t PathPlanGet(PathPlanData *dataOut)
+{
+    return UAVObjDirectGet(pathplan_direct, dataOut, 0, sizeof(PathPlanData));
+}
+
+int32_t PathPlanSet(const PathPlanData *dataIn)
+{
+    return UAVObjDirectSet(pathplan_direct, dataIn, 0, sizeof(PathPlanData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void PathPlanWaypointCountSet(uint16_t *NewWaypointCount)
+{
+    UAVObjDirectSet(pathplan_direct, (void *)NewWaypointCount, offsetof(PathPlanData, WaypointCount), sizeof(uint16_t));
+}
+void PathPlanWaypointCountGet(uint16_t *NewWaypointCount)
+{
+    UAVObjDirectGet(pathplan_direct, (void *)NewWaypointCount, offsetof(PathPlanData, WaypointCount), sizeof(uint16_t));
+}
+void PathPlanPathActionCountSet(uint16_t *NewPathActionCount)
+{
+    UAVObjDirectSet(pathplan_direct, (void *)NewPathActionCount, offsetof(PathPlanData, PathActionCount), sizeof(uint16_t));
+}
+void PathPlanPathActionCountGet(uint16_t *NewPathActionCount)
+{
+    UAVObjDirectGet(pathplan_direct, (void *)NewPathActionCount, offsetof(PathPlanData, PathActionCount), sizeof(uint16_t));
+}
+void PathPlanCrcSet(uint8_t *NewCrc)
+{
+    UAVObjDirectSet(pathplan_direct, (void *)NewCrc, offsetof(PathPlanData, Crc), sizeof(uint8_t));
+}
+void PathPlanCrcGet(uint8_t *NewCrc)
+{
+    UAVObjDirectGet(pathplan_direct, (void *)NewCrc, offsetof(PathPlanData, Crc), sizeof(uint8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PerfCounterPercentiles PerfCounterPercentiles
+ * @brief Tail of a performance counter since the previous update, instances match PerfCounter. Percentiles are bucket upper bounds, at most 25% above the actual value
+ *
+ * Autogenerated files and functions for PerfCounterPercentiles Object
+ * @{ 
+ *
+ * @file       perfcounterpercentiles.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PerfCounterPercentiles object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: perfcounterpercentiles.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "perfcounterpercentiles.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if PERFCOUNTERPERCENTILES_ISSINGLEINST
+UAVObjDirect *perfcounterpercentiles_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PerfCounterPercentilesInitialize(void)
+{
+    // Compile time assertion that the PerfCounterPercentilesDataPacked and PerfCounterPercentilesData structs
+    // have the same size (though instances of PerfCounterPercentilesData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PerfCounterPercentilesDataPacked) == sizeof(PerfCounterPercentilesData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PERFCOUNTERPERCENTILES_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(PERFCOUNTERPERCENTILES_OBJID,
+        PERFCOUNTERPERCENTILES_ISSINGLEINST, PERFCOUNTERPERCENTILES_ISSETTINGS, PERFCOUNTERPERCENTILES_ISPRIORITY, PERFCOUNTERPERCENTILES_NUMBYTES, &PerfCounterPercentilesSetDefaults);
+#if PERFCOUNTERPERCENTILES_ISSINGLEINST
+    perfcounterpercentiles_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PerfCounterPercentilesSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PerfCounterPercentilesData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PerfCounterPercentilesData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PerfCounterPercentilesHandle()
+{
+    return handle;
+}
+
+#if PERFCOUNTERPERCENTILES_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t PerfCounterPercentilesGet(PerfCounterPercentilesData *dataOut)
+{
+    return UAVObjDirectGet(perfcounterpercentiles_direct, dataOut, 0, sizeof(PerfCounterPercentilesData));
+}
+
+int32_t PerfCounterPercentilesSet(const PerfCounterPercentilesData *dataIn)
+{
+    return UAVObjDirectSet(perfcounterpercentiles_direct, dataIn, 0, sizeof(PerfCounterPercentilesData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+void PerfCounterPercentilesIdSet(uint32_t *NewId)
+{
+    UAVObjSetDataField(PerfCounterPercentilesHandle(), (void *)NewId, offsetof(PerfCounterPercentilesData, Id), sizeof(uint32_t));
+}
+void PerfCounterPercentilesIdGet(uint32_t *NewId)
+{
+    UAVObjGetDataField(PerfCounterPercentilesHandle(), (void *)NewId, offsetof(PerfCounterPercentilesData, Id), sizeof(uint32_t));
+}
+void PerfCounterPercentilesSamplesSet(uint32_t *NewSamples)
+{
+    UAVObjSetDataField(PerfCounterPercentilesHandle(), (void *)NewSamples, offsetof(PerfCounterPercentilesData, Samples), sizeof(uint32_t));
+}
+void PerfCounterPercentilesSamplesGet(uint32_t *NewSamples)
+{
+    UAVObjGetDataField(PerfCounterPercentilesHandle(), (void *)NewSamples, offsetof(PerfCounterPercentilesData, Samples), sizeof(uint32_t));
+}
+void PerfCounterPercentilesPercentileSet(PerfCounterPercentilesPercentileData *NewPercentile)
+{
+    UAVObjSetDataField(PerfCounterPercentilesHandle(), (void *)NewPercentile, offsetof(PerfCounterPercentilesData, Percentile), 4*sizeof(int32_t));
+}
+void PerfCounterPercentilesPercentileGet(PerfCounterPercentilesPercentileData *NewPercentile)
+{
+    UAVObjGetDataField(PerfCounterPercentilesHandle(), (void *)NewPercentile, offsetof(PerfCounterPercentilesData, Percentile), 4*sizeof(int32_t));
+}
+void PerfCounterPercentilesPercentileArraySet(int32_t *NewPercentile)
+{
+    UAVObjSetDataField(PerfCounterPercentilesHandle(), (void *)NewPercentile, offsetof(PerfCounterPercentilesData, Percentile), 4*sizeof(int32_t));
+}
+void PerfCounterPercentilesPercentileArrayGet(int32_t *NewPercentile)
+{
+    UAVObjGetDataField(PerfCounterPercentilesHandle(), (void *)NewPercentile, offsetof(PerfCounterPercentilesData, Percentile), 4*sizeof(int32_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PIDStatus PIDStatus
+ * @brief Status of a PID loop for debugging
+ *
+ * Autogenerated files and functions for PIDStatus Object
+ * @{ 
+ *
+ * @file       pidstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PIDStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pidstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "pidstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if PIDSTATUS_ISSINGLEINST
+UAVObjDirect *pidstatus_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PIDStatusInitialize(void)
+{
+    // Compile time assertion that the PIDStatusDataPacked and PIDStatusData structs
+    // have the same size (though instances of PIDStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PIDStatusDataPacked) == sizeof(PIDStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(PIDSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(PIDSTATUS_OBJID,
+        PIDSTATUS_ISSINGLEINST, PIDSTATUS_ISSETTINGS, PIDSTATUS_ISPRIORITY, PIDSTATUS_NUMBYTES, &PIDStatusSetDefaults);
+#if PIDSTATUS_ISSINGLEINST
+    pidstatus_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PIDStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PIDStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PIDStatusData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PIDStatusHandle()
+{
+    return handle;
+}
+
+#if PIDSTATUS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t PIDStatusGet(PIDStatusData *dataOut)
+{
+    return UAVObjDirectGet(pidstatus_direct, dataOut, 0, sizeof(PIDStatusData));
+}
+
+int32_t PIDStatusSet(const PIDStatusData *dataIn)
+{
+    return UAVObjDirectSet(pidstatus_direct, dataIn, 0, sizeof(PIDStatusData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void PIDStatussetpointSet(float *Newsetpoint)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)Newsetpoint, offsetof(PIDStatusData, setpoint), sizeof(float));
+}
+void PIDStatussetpointGet(float *Newsetpoint)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)Newsetpoint, offsetof(PIDStatusData, setpoint), sizeof(float));
+}
+void PIDStatusactualSet(float *Newactual)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)Newactual, offsetof(PIDStatusData, actual), sizeof(float));
+}
+void PIDStatusactualGet(float *Newactual)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)Newactual, offsetof(PIDStatusData, actual), sizeof(float));
+}
+void PIDStatuserrorSet(float *Newerror)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)Newerror, offsetof(PIDStatusData, error), sizeof(float));
+}
+void PIDStatuserrorGet(float *Newerror)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)Newerror, offsetof(PIDStatusData, error), sizeof(float));
+}
+void PIDStatusulowSet(float *Newulow)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)Newulow, offsetof(PIDStatusData, ulow), sizeof(float));
+}
+void PIDStatusulowGet(float *Newulow)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)Newulow, offsetof(PIDStatusData, ulow), sizeof(float));
+}
+void PIDStatusuhighSet(float *Newuhigh)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)Newuhigh, offsetof(PIDStatusData, uhigh), sizeof(float));
+}
+void PIDStatusuhighGet(float *Newuhigh)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)Newuhigh, offsetof(PIDStatusData, uhigh), sizeof(float));
+}
+void PIDStatuscommandSet(float *Newcommand)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)Newcommand, offsetof(PIDStatusData, command), sizeof(float));
+}
+void PIDStatuscommandGet(float *Newcommand)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)Newcommand, offsetof(PIDStatusData, command), sizeof(float));
+}
+void PIDStatusPSet(float *NewP)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)NewP, offsetof(PIDStatusData, P), sizeof(float));
+}
+void PIDStatusPGet(float *NewP)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)NewP, offsetof(PIDStatusData, P), sizeof(float));
+}
+void PIDStatusISet(float *NewI)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)NewI, offsetof(PIDStatusData, I), sizeof(float));
+}
+void PIDStatusIGet(float *NewI)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)NewI, offsetof(PIDStatusData, I), sizeof(float));
+}
+void PIDStatusDSet(float *NewD)
+{
+    UAVObjDirectSet(pidstatus_direct, (void *)NewD, offsetof(PIDStatusData, D), sizeof(float));
+}
+void PIDStatusDGet(float *NewD)
+{
+    UAVObjDirectGet(pidstatus_direct, (void *)NewD, offsetof(PIDStatusData, D), sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,270 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{
+ * @addtogroup StabilizationDesired StabilizationDesired
+ * @brief The desired attitude that @ref StabilizationModule will try and achieve if FlightMode is Stabilized.  Comes from @ref ManaulControlModule.
+ *
+ * Autogenerated files and functions for StabilizationDesired Object
+ *
+ * @{
+ *
+ * @file       stabilizationdesired.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the StabilizationDesired object. This file has been
+ *             automatically generated by the UAVObjectGenerator.
+ *
+ * @note       Object definition file: stabilizationdesired.xml.
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef STABILIZATIONDESIRED_H
+#define STABILIZATIONDESIRED_H
+#include <stdbool.h>
+#include <stddef.h>
+/* Object constants */
+#define STABILIZATIONDESIRED_OBJID 0x5146807C
+#define STABILIZATIONDESIRED_ISSINGLEINST 1
+#define STABILIZATIONDESIRED_ISSETTINGS 0
+#define STABILIZATIONDESIRED_ISPRIORITY 0
+#define STABILIZATIONDESIRED_NUMBYTES sizeof(StabilizationDesiredData)
+
+/* Generic interface functions */
+int32_t StabilizationDesiredInitialize();
+UAVObjHandle StabilizationDesiredHandle();
+void StabilizationDesiredSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+/* Field Roll information */
+
+/* Field Pitch information */
+
+/* Field Yaw information */
+
+/* Field Thrust information */
+
+/* Field StabilizationMode information */
+
+// Enumeration options for field StabilizationMode
+typedef enum __attribute__ ((__packed__)) {
+    STABILIZATIONDESIRED_STABILIZATIONMODE_MANUAL=0,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_RATE=1,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_RATETRAINER=2,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_ATTITUDE=3,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_AXISLOCK=4,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_WEAKLEVELING=5,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_VIRTUALBAR=6,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_ACRO=7,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_RATTITUDE=8,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_ALTITUDEHOLD=9,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_ALTITUDEVARIO=10,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_CRUISECONTROL=11,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_SYSTEMIDENT=12
+} StabilizationDesiredStabilizationModeOptions;
+
+// Array element names for field StabilizationMode
+typedef enum {
+    STABILIZATIONDESIRED_STABILIZATIONMODE_ROLL=0,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_PITCH=1,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_YAW=2,
+    STABILIZATIONDESIRED_STABILIZATIONMODE_THRUST=3
+} StabilizationDesiredStabilizationModeElem;
+
+// Number of elements for field StabilizationMode
+#define STABILIZATIONDESIRED_STABILIZATIONMODE_NUMELEM 4
+
+
+
+typedef struct __attribute__ ((__packed__)) {
+    StabilizationDesiredStabilizationModeOptions Roll;
+    StabilizationDesiredStabilizationModeOptions Pitch;
+    StabilizationDesiredStabilizationModeOptions Yaw;
+    StabilizationDesiredStabilizationModeOptions Thrust;
+}  StabilizationDesiredStabilizationModeData ;
+typedef struct __attribute__ ((__packed__)) {
+    StabilizationDesiredStabilizationModeOptions array[4];
+}  StabilizationDesiredStabilizationModeDataArray ;
+#define StabilizationDesiredStabilizationModeToArray( var ) UAVObjectFieldToArray( StabilizationDesiredStabilizationModeData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+        float Roll;
+    float Pitch;
+    float Yaw;
+    float Thrust;
+    StabilizationDesiredStabilizationModeData StabilizationMode;
+
+} __attribute__((packed)) StabilizationDesiredDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef StabilizationDesiredDataPacked __attribute__((aligned(4))) StabilizationDesiredData;
+
+/* Typesafe Object access functions */
+#if STABILIZATIONDESIRED_ISSINGLEINST
+/* Single instance objects are accessed in place, see UAVObjDirect */
+extern UAVObjDirect *stabilizationdesired_direct;
+
+#if UAVOBJ_INLINE_ACCESSORS
+static inline int32_t StabilizationDesiredGet(StabilizationDesiredData * dataOut) {
+    return UAVObjDirectGet(stabilizationdesired_direct, dataOut, 0, sizeof(StabilizationDesiredData));
+}
+static inline int32_t StabilizationDesiredSet(const StabilizationDesiredData * dataIn) {
+    return UAVObjDirectSet(stabilizationdesired_direct, dataIn, 0, sizeof(StabilizationDesiredData));
+}
+#else
+extern int32_t StabilizationDesiredGet(StabilizationDesiredData * dataOut);
+extern int32_t StabilizationDesiredSet(const StabilizationDesiredData * dataIn);
+#endif
+#else
+static inline int32_t StabilizationDesiredGet(StabilizationDesiredData * dataOut) {
+    return UAVObjGetData(StabilizationDesiredHandle(), dataOut);
+}
+static inline int32_t StabilizationDesiredSet(const StabilizationDesiredData * dataIn) {
+    return UAVObjSetData(StabilizationDesiredHandle(), dataIn);
+}
+#endif
+static inline int32_t StabilizationDesiredInstGet(uint16_t instId, StabilizationDesiredData * dataOut) {
+    return UAVObjGetInstanceData(StabilizationDesiredHandle(), instId, dataOut);
+}
+static inline int32_t StabilizationDesiredInstSet(uint16_t instId, const StabilizationDesiredData * dataIn) {
+    return UAVObjSetInstanceData(StabilizationDesiredHandle(), instId, dataIn);
+}
+static inline int32_t StabilizationDesiredConnectQueue(xQueueHandle queue) {
+    return UAVObjConnectQueue(StabilizationDesiredHandle(), queue, EV_MASK_ALL_UPDATES);
+}
+static inline int32_t StabilizationDesiredConnectCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(StabilizationDesiredHandle(), cb, EV_MASK_ALL_UPDATES, false);
+}
+static inline int32_t StabilizationDesiredConnectFastCallback(UAVObjEventCallback cb) {
+    return UAVObjConnectCallback(StabilizationDesiredHandle(), cb, EV_MASK_ALL_UPDATES, true);
+}
+static inline uint16_t StabilizationDesiredCreateInstance() {
+    return UAVObjCreateInstance(StabilizationDesiredHandle(), &StabilizationDesiredSetDefaults);
+}
+static inline void StabilizationDesiredRequestUpdate() {
+    UAVObjRequestUpdate(StabilizationDesiredHandle());
+}
+static inline void StabilizationDesiredRequestInstUpdate(uint16_t instId) {
+    UAVObjRequestInstanceUpdate(StabilizationDesiredHandle(), instId);
+}
+static inline void StabilizationDesiredUpdated() {
+    UAVObjUpdated(StabilizationDesiredHandle());
+}
+static inline void StabilizationDesiredInstUpdated(uint16_t instId) {
+    UAVObjInstanceUpdated(StabilizationDesiredHandle(), instId);
+}
+static inline void StabilizationDesiredLogging() {
+    UAVObjLogging(StabilizationDesiredHandle());
+}
+static inline void StabilizationDesiredInstLogging(uint16_t instId) {
+    UAVObjInstanceLogging(StabilizationDesiredHandle(), instId);
+}
+static inline int32_t StabilizationDesiredGetMetadata(UAVObjMetadata * dataOut) {
+    return UAVObjGetMetadata(StabilizationDesiredHandle(), dataOut);
+}
+static inline int32_t StabilizationDesiredSetMetadata(const UAVObjMetadata * dataIn) {
+    return UAVObjSetMetadata(StabilizationDesiredHandle(), dataIn);
+}
+static inline int8_t StabilizationDesiredReadOnly() {
+    return UAVObjReadOnly(StabilizationDesiredHandle());
+}
+
+/* Set/Get functions */
+#if UAVOBJ_INLINE_ACCESSORS
+static inline void StabilizationDesiredRollSet(float *NewRoll)
+{
+    UAVObjDirectSet(stabilizationdesired_direct, (void *)NewRoll, offsetof(StabilizationDesiredData, Roll), sizeof(float));
+}
+static inline void StabilizationDesiredRollGet(float *NewRoll)
+{
+    UAVObjDirectGet(stabilizationdesired_direct, (void *)NewRoll, offsetof(StabilizationDesiredData, Roll), sizeof(float));
+}
+static inline void StabilizationDesiredPitchSet(float *NewPitch)
+{
+    UAVObjDirectSet(stabilizationdesired_direct, (void *)NewPitch, offsetof(StabilizationDesiredData, Pitch), sizeof(float));
+}
+static inline void StabilizationDesiredPitchGet(float *NewPitch)
+{
+    UAVObjDirectGet(stabilizationdesired_direct, (void *)NewPitch, offsetof(StabilizationDesiredData, Pitch), sizeof(float));
+}
+static inline void StabilizationDesiredYawSet(float *NewYaw)
+{
+    UAVObjDirectSet(stabilizationdesired_direct, (void *)NewYaw, offsetof(StabilizationDesiredData, Yaw), sizeof(float));
+}
+static inline void StabilizationDesiredYawGet(float *NewYaw)
+{
+    UAVObjDirectGet(stabilizationdesired_direct, (void *)NewYaw, offsetof(StabilizationDesiredData, Yaw), sizeof(float));
+}
+static inline void StabilizationDesiredThrustSet(float *NewThrust)
+{
+    UAVObjDirectSet(stabilizationdesired_direct, (void *)NewThrust, offsetof(StabilizationDesiredData, Thrust), sizeof(float));
+}
+static inline void StabilizationDesiredThrustGet(float *NewThrust)
+{
+    UAVObjDirectGet(stabilizationdesired_direct, (void *)NewThrust, offsetof(StabilizationDesiredData, Thrust), sizeof(float));
+}
+static inline void StabilizationDesiredStabilizationModeSet(StabilizationDesiredStabilizationModeData *NewStabilizationMode)
+{
+    UAVObjDirectSet(stabilizationdesired_direct, (void *)NewStabilizationMode, offsetof(StabilizationDesiredData, StabilizationMode), 4*sizeof(StabilizationDesiredStabilizationModeOptions));
+}
+static inline void StabilizationDesiredStabilizationModeGet(StabilizationDesiredStabilizationModeData *NewStabilizationMode)
+{
+    UAVObjDirectGet(stabilizationdesired_direct, (void *)NewStabilizationMode, offsetof(StabilizationDesiredData, StabilizationMode), 4*sizeof(StabilizationDesiredStabilizationModeOptions));
+}
+static inline void StabilizationDesiredStabilizationModeArraySet(StabilizationDesiredStabilizationModeOptions *NewStabilizationMode)
+{
+    UAVObjDirectSet(stabilizationdesired_direct, (void *)NewStabilizationMode, offsetof(StabilizationDesiredData, StabilizationMode), 4*sizeof(StabilizationDesiredStabilizationModeOptions));
+}
+static inline void StabilizationDesiredStabilizationModeArrayGet(StabilizationDesiredStabilizationModeOptions *NewStabilizationMode)
+{
+    UAVObjDirectGet(stabilizationdesired_direct, (void *)NewStabilizationMode, offsetof(StabilizationDesiredData, StabilizationMode), 4*sizeof(StabilizationDesiredStabilizationModeOptions));
+}
+#else
+extern void StabilizationDesiredRollSet(float *NewRoll);
+extern void StabilizationDesiredRollGet(float *NewRoll);
+extern void StabilizationDesiredPitchSet(float *NewPitch);
+extern void StabilizationDesiredPitchGet(float *NewPitch);
+extern void StabilizationDesiredYawSet(float *NewYaw);
+extern void StabilizationDesiredYawGet(float *NewYaw);
+extern void StabilizationDesiredThrustSet(float *NewThrust);
+extern void StabilizationDesiredThrustGet(float *NewThrust);
+extern void StabilizationDesiredStabilizationModeSet(StabilizationDesiredStabilizationModeData *NewStabilizationMode);
+extern void StabilizationDesiredStabilizationModeGet(StabilizationDesiredStabilizationModeData *NewStabilizationMode);
+extern void StabilizationDesiredStabilizationModeArraySet(StabilizationDesiredStabilizationModeOptions *NewStabilizationMode);
+extern void StabilizationDesiredStabilizationModeArrayGet(StabilizationDesiredStabilizationModeOptions *NewStabilizationMode);
+#endif
+
+
+#endif // STABILIZATIONDESIRED_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup StatusVtolAutoTakeoff StatusVtolAutoTakeoff
+ * @brief Status of a AutoTakeoff autopilot
+ *
+ * Autogenerated files and functions for StatusVtolAutoTakeoff Object
+ * @{ 
+ *
+ * @file       statusvtolautotakeoff.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the StatusVtolAutoTakeoff object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: statusvtolautotakeoff.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "statusvtolautotakeoff.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if STATUSVTOLAUTOTAKEOFF_ISSINGLEINST
+UAVObjDirect *statusvtolautotakeoff_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t StatusVtolAutoTakeoffInitialize(void)
+{
+    // Compile time assertion that the StatusVtolAutoTakeoffDataPacked and StatusVtolAutoTakeoffData structs
+    // have the same size (though instances of StatusVtolAutoTakeoffData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(StatusVtolAutoTakeoffDataPacked) == sizeof(StatusVtolAutoTakeoffData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(STATUSVTOLAUTOTAKEOFF_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(STATUSVTOLAUTOTAKEOFF_OBJID,
+        STATUSVTOLAUTOTAKEOFF_ISSINGLEINST, STATUSVTOLAUTOTAKEOFF_ISSETTINGS, STATUSVTOLAUTOTAKEOFF_ISPRIORITY, STATUSVTOLAUTOTAKEOFF_NUMBYTES, &StatusVtolAutoTakeoffSetDefaults);
+#if STATUSVTOLAUTOTAKEOFF_ISSINGLEINST
+    statusvtolautotakeoff_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void StatusVtolAutoTakeoffSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    StatusVtolAutoTakeoffData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(StatusVtolAutoTakeoffData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 500;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle StatusVtolAutoTakeoffHandle()
+{
+    return handle;
+}
+
+#if STATUSVTOLAUTOTAKEOFF_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t StatusVtolAutoTakeoffGet(StatusVtolAutoTakeoffData *dataOut)
+{
+    return UAVObjDirectGet(statusvtolautotakeoff_direct, dataOut, 0, sizeof(StatusVtolAutoTakeoffData));
+}
+
+int32_t StatusVtolAutoTakeoffSet(const StatusVtolAutoTakeoffData *dataIn)
+{
+    return UAVObjDirectSet(statusvtolautotakeoff_direct, dataIn, 0, sizeof(StatusVtolAutoTakeoffData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void StatusVtolAutoTakeoffAltitudeAtStateSet(float *NewAltitudeAtState)
+{
+    UAVObjDirectSet(statusvtolautotakeoff_direct, (void *)NewAltitudeAtState, offsetof(StatusVtolAutoTakeoffData, AltitudeAtState), 10*sizeof(float));
+}
+void StatusVtolAutoTakeoffAltitudeAtStateGet(float *NewAltitudeAtState)
+{
+    UAVObjDirectGet(statusvtolautotakeoff_direct, (void *)NewAltitudeAtState, offsetof(StatusVtolAutoTakeoffData, AltitudeAtState), 10*sizeof(float));
+}
+void StatusVtolAutoTakeoffStateSet(StatusVtolAutoTakeoffStateOptions *NewState)
+{
+    UAVObjDirectSet(statusvtolautotakeoff_direct, (void *)NewState, offsetof(StatusVtolAutoTakeoffData, State), sizeof(StatusVtolAutoTakeoffStateOptions));
+}
+void StatusVtolAutoTakeoffStateGet(StatusVtolAutoTakeoffStateOptions *NewState)
+{
+    UAVObjDirectGet(statusvtolautotakeoff_direct, (void *)NewState, offsetof(StatusVtolAutoTakeoffData, State), sizeof(StatusVtolAutoTakeoffStateOptions));
+}
+void StatusVtolAutoTakeoffStateExitReasonSet(StatusVtolAutoTakeoffStateExitReasonOptions *NewStateExitReason)
+{
+    UAVObjDirectSet(statusvtolautotakeoff_direct, (void *)NewStateExitReason, offsetof(StatusVtolAutoTakeoffData, StateExitReason), 10*sizeof(StatusVtolAutoTakeoffStateExitReasonOptions));
+}
+void StatusVtolAutoTakeoffStateExitReasonGet(StatusVtolAutoTakeoffStateExitReasonOptions *NewStateExitReason)
+{
+    UAVObjDirectGet(statusvtolautotakeoff_direct, (void *)NewStateExitReason, offsetof(StatusVtolAutoTakeoffData, StateExitReason), 10*sizeof(StatusVtolAutoTakeoffStateExitReasonOptions));
+}
+void StatusVtolAutoTakeoffAltitudeStateSet(StatusVtolAutoTakeoffAltitudeStateOptions *NewAltitudeState)
+{
+    UAVObjDirectSet(statusvtolautotakeoff_direct, (void *)NewAltitudeState, offsetof(StatusVtolAutoTakeoffData, AltitudeState), sizeof(StatusVtolAutoTakeoffAltitudeStateOptions));
+}
+void StatusVtolAutoTakeoffAltitudeStateGet(StatusVtolAutoTakeoffAltitudeStateOptions *NewAltitudeState)
+{
+    UAVObjDirectGet(statusvtolautotakeoff_direct, (void *)NewAltitudeState, offsetof(StatusVtolAutoTakeoffData, AltitudeState), sizeof(StatusVtolAutoTakeoffAltitudeStateOptions));
+}
+void StatusVtolAutoTakeoffControlStateSet(StatusVtolAutoTakeoffControlStateOptions *NewControlState)
+{
+    UAVObjDirectSet(statusvtolautotakeoff_direct, (void *)NewControlState, offsetof(StatusVtolAutoTakeoffData, ControlState), sizeof(StatusVtolAutoTakeoffControlStateOptions));
+}
+void StatusVtolAutoTakeoffControlStateGet(StatusVtolAutoTakeoffControlStateOptions *NewControlState)
+{
+    UAVObjDirectGet(statusvtolautotakeoff_direct, (void *)NewControlState, offsetof(StatusVtolAutoTakeoffData, ControlState), sizeof(StatusVtolAutoTakeoffControlStateOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
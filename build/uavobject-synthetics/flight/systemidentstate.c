@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup SystemIdentState SystemIdentState
+ * @brief Used for logging PID tuning.
+ *
+ * Autogenerated files and functions for SystemIdentState Object
+ * @{ 
+ *
+ * @file       systemidentstate.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the SystemIdentState object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemidentstate.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "systemidentstate.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if SYSTEMIDENTSTATE_ISSINGLEINST
+UAVObjDirect *systemidentstate_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemIdentStateInitialize(void)
+{
+    // Compile time assertion that the SystemIdentStateDataPacked and SystemIdentStateData structs
+    // have the same size (though instances of SystemIdentStateData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(SystemIdentStateDataPacked) == sizeof(SystemIdentStateData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(SYSTEMIDENTSTATE_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(SYSTEMIDENTSTATE_OBJID,
+        SYSTEMIDENTSTATE_ISSINGLEINST, SYSTEMIDENTSTATE_ISSETTINGS, SYSTEMIDENTSTATE_ISPRIORITY, SYSTEMIDENTSTATE_NUMBYTES, &SystemIdentStateSetDefaults);
+#if SYSTEMIDENTSTATE_ISSINGLEINST
+    systemidentstate_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemIdentStateSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    SystemIdentStateData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(SystemIdentStateData));
+    data.Tau = -4.000000e+00f;
+    data.Beta.Roll = 1.000000e+01f;
+    data.Beta.Pitch = 1.000000e+01f;
+    data.Beta.Yaw = 7.000000e+00f;
+    data.Bias.Roll = 0.000000e+00f;
+    data.Bias.Pitch = 0.000000e+00f;
+    data.Bias.Yaw = 0.000000e+00f;
+    data.Noise.Roll = 0.000000e+00f;
+    data.Noise.Pitch = 0.000000e+00f;
+    data.Noise.Yaw = 0.000000e+00f;
+    data.Period = 0.000000e+00f;
+    data.NumAfPredicts = 0;
+    data.NumSpilledPts = 0;
+    data.HoverThrottle = 0.000000e+00f;
+    data.GyroReadTimeAverage = 1.000000e-03f;
+    data.Complete = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemIdentStateHandle()
+{
+    return handle;
+}
+
+#if SYSTEMIDENTSTATE_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t SystemIdentStateGet(SystemIdentStateData *dataOut)
+{
+    return UAVObjDirectGet(systemidentstate_direct, dataOut, 0, sizeof(SystemIdentStateData));
+}
+
+int32_t SystemIdentStateSet(const SystemIdentStateData *dataIn)
+{
+    return UAVObjDirectSet(systemidentstate_direct, dataIn, 0, sizeof(SystemIdentStateData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void SystemIdentStateTauSet(float *NewTau)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewTau, offsetof(SystemIdentStateData, Tau), sizeof(float));
+}
+void SystemIdentStateTauGet(float *NewTau)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewTau, offsetof(SystemIdentStateData, Tau), sizeof(float));
+}
+void SystemIdentStateBetaSet(SystemIdentStateBetaData *NewBeta)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewBeta, offsetof(SystemIdentStateData, Beta), 3*sizeof(float));
+}
+void SystemIdentStateBetaGet(SystemIdentStateBetaData *NewBeta)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewBeta, offsetof(SystemIdentStateData, Beta), 3*sizeof(float));
+}
+void SystemIdentStateBetaArraySet(float *NewBeta)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewBeta, offsetof(SystemIdentStateData, Beta), 3*sizeof(float));
+}
+void SystemIdentStateBetaArrayGet(float *NewBeta)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewBeta, offsetof(SystemIdentStateData, Beta), 3*sizeof(float));
+}
+void SystemIdentStateBiasSet(SystemIdentStateBiasData *NewBias)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewBias, offsetof(SystemIdentStateData, Bias), 3*sizeof(float));
+}
+void SystemIdentStateBiasGet(SystemIdentStateBiasData *NewBias)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewBias, offsetof(SystemIdentStateData, Bias), 3*sizeof(float));
+}
+void SystemIdentStateBiasArraySet(float *NewBias)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewBias, offsetof(SystemIdentStateData, Bias), 3*sizeof(float));
+}
+void SystemIdentStateBiasArrayGet(float *NewBias)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewBias, offsetof(SystemIdentStateData, Bias), 3*sizeof(float));
+}
+void SystemIdentStateNoiseSet(SystemIdentStateNoiseData *NewNoise)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewNoise, offsetof(SystemIdentStateData, Noise), 3*sizeof(float));
+}
+void SystemIdentStateNoiseGet(SystemIdentStateNoiseData *NewNoise)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewNoise, offsetof(SystemIdentStateData, Noise), 3*sizeof(float));
+}
+void SystemIdentStateNoiseArraySet(float *NewNoise)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewNoise, offsetof(SystemIdentStateData, Noise), 3*sizeof(float));
+}
+void SystemIdentStateNoiseArrayGet(float *NewNoise)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewNoise, offsetof(SystemIdentStateData, Noise), 3*sizeof(float));
+}
+void SystemIdentStatePeriodSet(float *NewPeriod)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewPeriod, offsetof(SystemIdentStateData, Period), sizeof(float));
+}
+void SystemIdentStatePeriodGet(float *NewPeriod)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewPeriod, offsetof(SystemIdentStateData, Period), sizeof(float));
+}
+void SystemIdentStateNumAfPredictsSet(uint32_t *NewNumAfPredicts)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewNumAfPredicts, offsetof(SystemIdentStateData, NumAfPredicts), sizeof(uint32_t));
+}
+void SystemIdentStateNumAfPredictsGet(uint32_t *NewNumAfPredicts)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewNumAfPredicts, offsetof(SystemIdentStateData, NumAfPredicts), sizeof(uint32_t));
+}
+void SystemIdentStateNumSpilledPtsSet(uint32_t *NewNumSpilledPts)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewNumSpilledPts, offsetof(SystemIdentStateData, NumSpilledPts), sizeof(uint32_t));
+}
+void SystemIdentStateNumSpilledPtsGet(uint32_t *NewNumSpilledPts)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewNumSpilledPts, offsetof(SystemIdentStateData, NumSpilledPts), sizeof(uint32_t));
+}
+void SystemIdentStateHoverThrottleSet(float *NewHoverThrottle)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewHoverThrottle, offsetof(SystemIdentStateData, HoverThrottle), sizeof(float));
+}
+void SystemIdentStateHoverThrottleGet(float *NewHoverThrottle)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewHoverThrottle, offsetof(SystemIdentStateData, HoverThrottle), sizeof(float));
+}
+void SystemIdentStateGyroReadTimeAverageSet(float *NewGyroReadTimeAverage)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewGyroReadTimeAverage, offsetof(SystemIdentStateData, GyroReadTimeAverage), sizeof(float));
+}
+void SystemIdentStateGyroReadTimeAverageGet(float *NewGyroReadTimeAverage)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewGyroReadTimeAverage, offsetof(SystemIdentStateData, GyroReadTimeAverage), sizeof(float));
+}
+void SystemIdentStateCompleteSet(SystemIdentStateCompleteOptions *NewComplete)
+{
+    UAVObjDirectSet(systemidentstate_direct, (void *)NewComplete, offsetof(SystemIdentStateData, Complete), sizeof(SystemIdentStateCompleteOptions));
+}
+void SystemIdentStateCompleteGet(SystemIdentStateCompleteOptions *NewComplete)
+{
+    UAVObjDirectGet(systemidentstate_direct, (void *)NewComplete, offsetof(SystemIdentStateData, Complete), sizeof(SystemIdentStateCompleteOptions));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup SystemStats SystemStats
+ * @brief CPU and memory usage from OpenPilot computer. 
+ *
+ * Autogenerated files and functions for SystemStats Object
+ * @{ 
+ *
+ * @file       systemstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the SystemStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "systemstats.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if SYSTEMSTATS_ISSINGLEINST
+UAVObjDirect *systemstats_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemStatsInitialize(void)
+{
+    // Compile time assertion that the SystemStatsDataPacked and SystemStatsData structs
+    // have the same size (though instances of SystemStatsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(SystemStatsDataPacked) == sizeof(SystemStatsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(SYSTEMSTATS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(SYSTEMSTATS_OBJID,
+        SYSTEMSTATS_ISSINGLEINST, SYSTEMSTATS_ISSETTINGS, SYSTEMSTATS_ISPRIORITY, SYSTEMSTATS_NUMBYTES, &SystemStatsSetDefaults);
+#if SYSTEMSTATS_ISSINGLEINST
+    systemstats_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    SystemStatsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(SystemStatsData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemStatsHandle()
+{
+    return handle;
+}
+
+#if SYSTEMSTATS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t SystemStatsGet(SystemStatsData *dataOut)
+{
+    return UAVObjDirectGet(systemstats_direct, dataOut, 0, sizeof(SystemStatsData));
+}
+
+int32_t SystemStatsSet(const SystemStatsData *dataIn)
+{
+    return UAVObjDirectSet(systemstats_direct, dataIn, 0, sizeof(SystemStatsData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void SystemStatsFlightTimeSet(uint32_t *NewFlightTime)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewFlightTime, offsetof(SystemStatsData, FlightTime), sizeof(uint32_t));
+}
+void SystemStatsFlightTimeGet(uint32_t *NewFlightTime)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewFlightTime, offsetof(SystemStatsData, FlightTime), sizeof(uint32_t));
+}
+void SystemStatsHeapRemainingSet(uint32_t *NewHeapRemaining)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewHeapRemaining, offsetof(SystemStatsData, HeapRemaining), sizeof(uint32_t));
+}
+void SystemStatsHeapRemainingGet(uint32_t *NewHeapRemaining)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewHeapRemaining, offsetof(SystemStatsData, HeapRemaining), sizeof(uint32_t));
+}
+void SystemStatsCPUIdleTicksSet(uint32_t *NewCPUIdleTicks)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewCPUIdleTicks, offsetof(SystemStatsData, CPUIdleTicks), sizeof(uint32_t));
+}
+void SystemStatsCPUIdleTicksGet(uint32_t *NewCPUIdleTicks)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewCPUIdleTicks, offsetof(SystemStatsData, CPUIdleTicks), sizeof(uint32_t));
+}
+void SystemStatsCPUZeroLoadTicksSet(uint32_t *NewCPUZeroLoadTicks)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewCPUZeroLoadTicks, offsetof(SystemStatsData, CPUZeroLoadTicks), sizeof(uint32_t));
+}
+void SystemStatsCPUZeroLoadTicksGet(uint32_t *NewCPUZeroLoadTicks)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewCPUZeroLoadTicks, offsetof(SystemStatsData, CPUZeroLoadTicks), sizeof(uint32_t));
+}
+void SystemStatsEventSystemWarningIDSet(uint32_t *NewEventSystemWarningID)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewEventSystemWarningID, offsetof(SystemStatsData, EventSystemWarningID), sizeof(uint32_t));
+}
+void SystemStatsEventSystemWarningIDGet(uint32_t *NewEventSystemWarningID)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewEventSystemWarningID, offsetof(SystemStatsData, EventSystemWarningID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerCallbackIDSet(uint32_t *NewObjectManagerCallbackID)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewObjectManagerCallbackID, offsetof(SystemStatsData, ObjectManagerCallbackID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerCallbackIDGet(uint32_t *NewObjectManagerCallbackID)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewObjectManagerCallbackID, offsetof(SystemStatsData, ObjectManagerCallbackID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerQueueIDSet(uint32_t *NewObjectManagerQueueID)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewObjectManagerQueueID, offsetof(SystemStatsData, ObjectManagerQueueID), sizeof(uint32_t));
+}
+void SystemStatsObjectManagerQueueIDGet(uint32_t *NewObjectManagerQueueID)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewObjectManagerQueueID, offsetof(SystemStatsData, ObjectManagerQueueID), sizeof(uint32_t));
+}
+void SystemStatsIRQStackRemainingSet(uint16_t *NewIRQStackRemaining)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewIRQStackRemaining, offsetof(SystemStatsData, IRQStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsIRQStackRemainingGet(uint16_t *NewIRQStackRemaining)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewIRQStackRemaining, offsetof(SystemStatsData, IRQStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsSystemModStackRemainingSet(uint16_t *NewSystemModStackRemaining)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewSystemModStackRemaining, offsetof(SystemStatsData, SystemModStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsSystemModStackRemainingGet(uint16_t *NewSystemModStackRemaining)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewSystemModStackRemaining, offsetof(SystemStatsData, SystemModStackRemaining), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsFreeSet(uint16_t *NewSysSlotsFree)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewSysSlotsFree, offsetof(SystemStatsData, SysSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsFreeGet(uint16_t *NewSysSlotsFree)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewSysSlotsFree, offsetof(SystemStatsData, SysSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsActiveSet(uint16_t *NewSysSlotsActive)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewSysSlotsActive, offsetof(SystemStatsData, SysSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsSysSlotsActiveGet(uint16_t *NewSysSlotsActive)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewSysSlotsActive, offsetof(SystemStatsData, SysSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsFreeSet(uint16_t *NewUsrSlotsFree)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewUsrSlotsFree, offsetof(SystemStatsData, UsrSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsFreeGet(uint16_t *NewUsrSlotsFree)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewUsrSlotsFree, offsetof(SystemStatsData, UsrSlotsFree), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsActiveSet(uint16_t *NewUsrSlotsActive)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewUsrSlotsActive, offsetof(SystemStatsData, UsrSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsUsrSlotsActiveGet(uint16_t *NewUsrSlotsActive)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewUsrSlotsActive, offsetof(SystemStatsData, UsrSlotsActive), sizeof(uint16_t));
+}
+void SystemStatsCPULoadSet(uint8_t *NewCPULoad)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewCPULoad, offsetof(SystemStatsData, CPULoad), sizeof(uint8_t));
+}
+void SystemStatsCPULoadGet(uint8_t *NewCPULoad)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewCPULoad, offsetof(SystemStatsData, CPULoad), sizeof(uint8_t));
+}
+void SystemStatsCPUTempSet(int8_t *NewCPUTemp)
+{
+    UAVObjDirectSet(systemstats_direct, (void *)NewCPUTemp, offsetof(SystemStatsData, CPUTemp), sizeof(int8_t));
+}
+void SystemStatsCPUTempGet(int8_t *NewCPUTemp)
+{
+    UAVObjDirectGet(systemstats_direct, (void *)NewCPUTemp, offsetof(SystemStatsData, CPUTemp), sizeof(int8_t));
+}
+#endif
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup TxPIDStatus TxPIDStatus
+ * @brief Status of @ref TxPID optional module used to tune PID settings using R/C transmitter.
+ *
+ * Autogenerated files and functions for TxPIDStatus Object
+ * @{ 
+ *
+ * @file       txpidstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the TxPIDStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: txpidstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "txpidstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+#if TXPIDSTATUS_ISSINGLEINST
+UAVObjDirect *txpidstatus_direct;
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t TxPIDStatusInitialize(void)
+{
+    // Compile time assertion that the TxPIDStatusDataPacked and TxPIDStatusData structs
+    // have the same size (though instances of TxPIDStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(TxPIDStatusDataPacked) == sizeof(TxPIDStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(TXPIDSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(TXPIDSTATUS_OBJID,
+        TXPIDSTATUS_ISSINGLEINST, TXPIDSTATUS_ISSETTINGS, TXPIDSTATUS_ISPRIORITY, TXPIDSTATUS_NUMBYTES, &TxPIDStatusSetDefaults);
+#if TXPIDSTATUS_ISSINGLEINST
+    txpidstatus_direct = handle ? UAVObjGetDirect(handle) : NULL;
+#endif
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void TxPIDStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    TxPIDStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(TxPIDStatusData));
+    data.CurPID.Instance1 = 0.000000e+00f;
+    data.CurPID.Instance2 = 0.000000e+00f;
+    data.CurPID.Instance3 = 0.000000e+00f;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READONLY << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 2000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle TxPIDStatusHandle()
+{
+    return handle;
+}
+
+#if TXPIDSTATUS_ISSINGLEINST && !UAVOBJ_INLINE_ACCESSORS
+/**
+ * Get/Set object data, kept out of line on this target
+ */
+int32_t TxPIDStatusGet(TxPIDStatusData *dataOut)
+{
+    return UAVObjDirectGet(txpidstatus_direct, dataOut, 0, sizeof(TxPIDStatusData));
+}
+
+int32_t TxPIDStatusSet(const TxPIDStatusData *dataIn)
+{
+    return UAVObjDirectSet(txpidstatus_direct, dataIn, 0, sizeof(TxPIDStatusData));
+}
+#endif
+
+/**
+ * Get/Set object Functions
+ */
+#if !UAVOBJ_INLINE_ACCESSORS
+void TxPIDStatusCurPIDSet(TxPIDStatusCurPIDData *NewCurPID)
+{
+    UAVObjDirectSet(txpidstatus_direct, (void *)NewCurPID, offsetof(TxPIDStatusData, CurPID), 3*sizeof(float));
+}
+void TxPIDStatusCurPIDGet(TxPIDStatusCurPIDData *NewCurPID)
+{
+    UAVObjDirectGet(txpidstatus_direct, (void *)NewCurPID, offsetof(TxPIDStatusData, CurPID), 3*sizeof(float));
+}
+void TxPIDStatusCurPIDArraySet(float *NewCurPID)
+{
+    UAVObjDirectSet(txpidstatus_direct, (void *)NewCurPID, offsetof(TxPIDStatusData, CurPID), 3*sizeof(float));
+}
+void TxPIDStatusCurPIDArrayGet(float *NewCurPID)
+{
+    UAVObjDirectGet(txpidstatus_direct, (void *)NewCurPID, offsetof(TxPIDStatusData, CurPID), 3*sizeof(float));
+}
+#endif
+
+
+/**
+ * @}
+ */
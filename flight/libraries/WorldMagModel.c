@@ -153,8 +153,47 @@ static const float CoeffFile[91][6] = {
     { 12.0f, 12.0f, 0.0f,      0.7f,     0.0f,   0.0f   }
 };
 
+/*
+ * Schmidt quasi-normalisation factors of the Gauss-normalised associated
+ * Legendre functions, sqrt((m==0?1:2)*(n-m)!/(n+m)!)*(2n-1)!!/(n-m)!, and the
+ * ((n-1)^2-m^2)/((2n-1)(2n-3)) recursion factors used by WMM_PcupLow.
+ * They only depend on (n, m) so they are kept in flash instead of being
+ * recomputed (and allocated) on every evaluation.
+ */
+static const float SchmidtQuasiNorm[NUMTERMS] = {
+    1.0f, // n = 0
+    1.0f, 1.0f, // n = 1
+    1.5f, 1.73205081f, 0.866025404f, // n = 2
+    2.5f, 3.06186218f, 1.93649167f, 0.790569415f, // n = 3
+    4.375f, 5.53398591f, 3.91311896f, 2.09165007f, 0.739509973f, // n = 4
+    7.875f, 10.1665813f, 7.68521307f, 4.70621265f, 2.21852992f, 0.70156076f, // n = 5
+    14.4375f, 18.9031247f, 14.9442323f, 9.96282151f, 5.45686208f, 2.32681381f, 0.671693289f, // n = 6
+    26.8125f, 35.4696035f, 28.96081f, 20.4783851f, 12.3489309f, 6.17446544f, 2.4218246f, 0.647259849f, // n = 7
+    50.2734375f, 67.03125f, 56.0823674f, 41.4195733f, 26.7362196f, 14.8305863f, 6.86522743f, 2.50682662f, 0.626706654f, // n = 8
+    94.9609375f, 127.403467f, 108.650042f, 82.98284f, 56.3757384f, 33.6909477f, 17.3979306f, 7.53352493f, 2.58397773f, 0.609049392f, // n = 9
+    180.425781f, 243.286074f, 210.69192f, 165.28034f, 116.87085f, 73.9156153f, 41.3200851f, 20.0431853f, 8.18259615f, 2.65478475f, 0.593627917f, // n = 10
+    344.449219f, 466.386447f, 409.047973f, 327.968008f, 239.513968f, 158.423599f, 94.1176423f, 49.6043529f, 22.7600381f, 8.81492484f, 2.72034486f, 0.579979474f, // n = 11
+    660.194336f, 897.027462f, 795.129861f, 649.220813f, 486.915609f, 334.021352f, 208.29891f, 117.053882f, 58.5269411f, 25.5432512f, 9.43247064f, 2.78148384f, 0.567768012f // n = 12
+};
+static const float LegendreRecursionK[NUMTERMS] = {
+    0.0f, // n = 0
+    0.0f, 0.0f, // n = 1
+    0.333333333f, 0.0f, 0.0f, // n = 2
+    0.266666667f, 0.2f, 0.0f, 0.0f, // n = 3
+    0.257142857f, 0.228571429f, 0.142857143f, 0.0f, 0.0f, // n = 4
+    0.253968254f, 0.238095238f, 0.19047619f, 0.111111111f, 0.0f, 0.0f, // n = 5
+    0.252525253f, 0.242424242f, 0.212121212f, 0.161616162f, 0.0909090909f, 0.0f, 0.0f, // n = 6
+    0.251748252f, 0.244755245f, 0.223776224f, 0.188811189f, 0.13986014f, 0.0769230769f, 0.0f, 0.0f, // n = 7
+    0.251282051f, 0.246153846f, 0.230769231f, 0.205128205f, 0.169230769f, 0.123076923f, 0.0666666667f, 0.0f, 0.0f, // n = 8
+    0.250980392f, 0.247058824f, 0.235294118f, 0.215686275f, 0.188235294f, 0.152941176f, 0.109803922f, 0.0588235294f, 0.0f, 0.0f, // n = 9
+    0.250773994f, 0.247678019f, 0.238390093f, 0.222910217f, 0.20123839f, 0.173374613f, 0.139318885f, 0.0990712074f, 0.0526315789f, 0.0f, 0.0f, // n = 10
+    0.250626566f, 0.248120301f, 0.240601504f, 0.228070175f, 0.210526316f, 0.187969925f, 0.160401003f, 0.127819549f, 0.0902255639f, 0.0476190476f, 0.0f, 0.0f, // n = 11
+    0.250517598f, 0.248447205f, 0.242236025f, 0.231884058f, 0.217391304f, 0.198757764f, 0.175983437f, 0.149068323f, 0.118012422f, 0.082815735f, 0.0434782609f, 0.0f, 0.0f // n = 12
+};
+
 static WMMtype_Ellipsoid *Ellip = NULL;
 static WMMtype_MagneticModel *MagneticModel = NULL;
+static WMMtype_Cache *Cache = NULL;
 static float decimal_date;
 
 /**************************************************************************************
@@ -166,18 +205,28 @@ static float decimal_date;
 *	e.g. Iceland in may of 2012 = WMM_GetMagVector(65.0, -20.0, 0.0, 5, 5, 2012, B);
 *	Alt is above the WGS-84 Ellipsoid
 *	B is the NED (XYZ) magnetic vector in nTesla
+*
+*	Results of the spherical harmonic expansion are cached between calls: the
+*	date resolved coefficients only change with the date, the Legendre functions
+*	only with the (geocentric) latitude and the radius/longitude terms only with
+*	the position, so moving along a parallel does not recompute the Legendre
+*	functions and a new date does not recompute any position dependent term.
 **************************************************************************************/
 
 int WMM_Initialize()
 // Sets default values for WMM subroutines.
-// UPDATES : Ellip and MagneticModel
+// UPDATES : Ellip, MagneticModel and invalidates Cache
 {
-    if (!Ellip) {
-        return -1; // invalid pointer
-    }
-    if (!MagneticModel) {
-        return -2; // invalid pointer
+    if (!Cache) {
+        Cache = (WMMtype_Cache *)MALLOC(sizeof(WMMtype_Cache));
+        if (!Cache) {
+            return -1; // memory allocation error
+        }
+        Ellip = &Cache->Ellip;
+        MagneticModel = &Cache->MagneticModel;
     }
+    Cache->valid = 0;
+
     // Sets WGS-84 parameters
     Ellip->a     = 6378.137f;   // semi-major axis of the ellipsoid in km
     Ellip->b     = 6356.7523142f;       // semi-minor axis of the ellipsoid in km
@@ -204,7 +253,9 @@ int WMM_GetMagVector(float Lat, float Lon, float AltEllipsoid, uint16_t Month, u
     // return '0' if all appears to be OK
     // return < 0 if error
 
-    int returned = 0; // default to OK
+    WMMtype_CoordSpherical CoordSpherical;
+    WMMtype_CoordGeodetic CoordGeodetic;
+    WMMtype_GeoMagneticElements GeoMagneticElements;
 
     // ***********
     // range check supplied params
@@ -222,101 +273,49 @@ int WMM_GetMagVector(float Lat, float Lon, float AltEllipsoid, uint16_t Month, u
         return -4; // error
     }
     // ***********
-    // allocated required memory
-
-// Ellip = NULL;
-// MagneticModel = NULL;
-
-// MagneticModel = NULL;
-// CoordGeodetic = NULL;
-// GeoMagneticElements = NULL;
-
-    Ellip = (WMMtype_Ellipsoid *)MALLOC(sizeof(WMMtype_Ellipsoid));
-    MagneticModel = (WMMtype_MagneticModel *)MALLOC(sizeof(WMMtype_MagneticModel));
 
-    WMMtype_CoordSpherical *CoordSpherical = (WMMtype_CoordSpherical *)MALLOC(sizeof(WMMtype_CoordSpherical));
-    WMMtype_CoordGeodetic *CoordGeodetic   = (WMMtype_CoordGeodetic *)MALLOC(sizeof(WMMtype_CoordGeodetic));
-    WMMtype_GeoMagneticElements *GeoMagneticElements = (WMMtype_GeoMagneticElements *)MALLOC(sizeof(WMMtype_GeoMagneticElements));
-
-    if (!Ellip || !MagneticModel || !CoordSpherical || !CoordGeodetic || !GeoMagneticElements) {
-        returned = -5; // error
-    }
-    // ***********
-
-    if (returned >= 0) {
+    if (!Cache) {
         if (WMM_Initialize() < 0) {
-            returned = -6; // error
-        }
-    }
-
-    if (returned >= 0) {
-        CoordGeodetic->lambda = Lon;
-        CoordGeodetic->phi    = Lat;
-        CoordGeodetic->HeightAboveEllipsoid = AltEllipsoid / 1000.0f; // convert to km
-
-        // Convert from geodetic to Spherical Equations: 17-18, WMM Technical report
-        if (WMM_GeodeticToSpherical(CoordGeodetic, CoordSpherical) < 0) {
-            returned = -7; // error
-        }
-    }
-
-
-    if (returned >= 0) {
-        if (WMM_DateToYear(Month, Day, Year) < 0) {
-            returned = -8; // error
-        }
-    }
-
-    if (returned >= 0) {
-        // Compute the geoMagnetic field elements and their time change
-        if (WMM_Geomag(CoordSpherical, CoordGeodetic, GeoMagneticElements) < 0) {
-            returned = -9; // error
-        } else { // set the returned values
-            B[0] = GeoMagneticElements->X;
-            B[1] = GeoMagneticElements->Y;
-            B[2] = GeoMagneticElements->Z;
+            return -5; // error
         }
     }
 
-    // ***********
-    // free allocated memory
-
-    if (GeoMagneticElements) {
-        FREE(GeoMagneticElements);
-    }
-
-    if (CoordGeodetic) {
-        FREE(CoordGeodetic);
-    }
+    CoordGeodetic.lambda = Lon;
+    CoordGeodetic.phi    = Lat;
+    CoordGeodetic.HeightAboveEllipsoid = AltEllipsoid / 1000.0f; // convert to km
 
-    if (CoordSpherical) {
-        FREE(CoordSpherical);
+    // Convert from geodetic to Spherical Equations: 17-18, WMM Technical report
+    if (WMM_GeodeticToSpherical(&CoordGeodetic, &CoordSpherical) < 0) {
+        return -7; // error
     }
 
-    if (MagneticModel) {
-        FREE(MagneticModel);
-        MagneticModel = NULL;
+    if (WMM_DateToYear(Month, Day, Year) < 0) {
+        return -8; // error
     }
 
-    if (Ellip) {
-        FREE(Ellip);
-        Ellip = NULL;
+    // Compute the geoMagnetic field elements
+    if (WMM_Geomag(&CoordSpherical, &CoordGeodetic, &GeoMagneticElements) < 0) {
+        return -9; // error
     }
 
-    B[0] = GeoMagneticElements->X * 1e-2f;
-    B[1] = GeoMagneticElements->Y * 1e-2f;
-    B[2] = GeoMagneticElements->Z * 1e-2f;
+    B[0] = GeoMagneticElements.X * 1e-2f;
+    B[1] = GeoMagneticElements.Y * 1e-2f;
+    B[2] = GeoMagneticElements.Z * 1e-2f;
 
-    return returned;
+    return 0; // OK
 }
 
 int WMM_Geomag(WMMtype_CoordSpherical *CoordSpherical, WMMtype_CoordGeodetic *CoordGeodetic, WMMtype_GeoMagneticElements *GeoMagneticElements)
 /*
    The main subroutine that calls a sequence of WMM sub-functions to calculate the magnetic field elements for a single point.
-   The function expects the model coefficients and point coordinates as input and returns the magnetic field elements and
-   their rate of change. Though, this subroutine can be called successively to calculate a time series, profile or grid
+   The function expects the model coefficients and point coordinates as input and returns the magnetic field elements.
+   Though, this subroutine can be called successively to calculate a time series, profile or grid
    of magnetic field, these are better achieved by the subroutine WMM_Grid.
 
+   Only the intermediate results that depend on a changed input are recomputed, see WMM_UpdateCache.
+   The secular variation of the elements is not needed by the flight code and is not evaluated,
+   WMM_SecVarSummation and WMM_CalculateSecularVariation can be used for that.
+
    INPUT: Ellip
    CoordSpherical
    CoordGeodetic
@@ -324,97 +323,87 @@ int WMM_Geomag(WMMtype_CoordSpherical *CoordSpherical, WMMtype_CoordGeodetic *Co
 
    OUTPUT : GeoMagneticElements
 
-   CALLS:    WMM_ComputeSphericalHarmonicVariables( Ellip, CoordSpherical, TimedMagneticModel->nMax, &SphVariables); (Compute Spherical Harmonic variables  )
-   WMM_AssociatedLegendreFunction(CoordSpherical, TimedMagneticModel->nMax, LegendreFunction);       Compute ALF
+   CALLS:    WMM_UpdateCache(CoordSpherical); (Compute date resolved coefficients, Spherical Harmonic variables and ALF if needed)
    WMM_Summation(LegendreFunction, TimedMagneticModel, SphVariables, CoordSpherical, &MagneticResultsSph);  Accumulate the spherical harmonic coefficients
-   WMM_SecVarSummation(LegendreFunction, TimedMagneticModel, SphVariables, CoordSpherical, &MagneticResultsSphVar); Sum the Secular Variation Coefficients
    WMM_RotateMagneticVector(CoordSpherical, CoordGeodetic, MagneticResultsSph, &MagneticResultsGeo); Map the computed Magnetic fields to Geodeitic coordinates
-   WMM_RotateMagneticVector(CoordSpherical, CoordGeodetic, MagneticResultsSphVar, &MagneticResultsGeoVar);  Map the secular variation field components to Geodetic coordinates
    WMM_CalculateGeoMagneticElements(&MagneticResultsGeo, GeoMagneticElements);   Calculate the Geomagnetic elements
-   WMM_CalculateSecularVariation(MagneticResultsGeoVar, GeoMagneticElements); Calculate the secular variation of each of the Geomagnetic elements
 
  */
 {
-    int returned = 0; // default to OK
-
     WMMtype_MagneticResults MagneticResultsSph;
     WMMtype_MagneticResults MagneticResultsGeo;
-    WMMtype_MagneticResults MagneticResultsSphVar;
-    WMMtype_MagneticResults MagneticResultsGeoVar;
-
-    // ********
-    // allocate required memory
-
-    WMMtype_LegendreFunction *LegendreFunction = (WMMtype_LegendreFunction *)MALLOC(sizeof(WMMtype_LegendreFunction));
-    WMMtype_SphericalHarmonicVariables *SphVariables = (WMMtype_SphericalHarmonicVariables *)MALLOC(sizeof(WMMtype_SphericalHarmonicVariables));
 
-    if (!LegendreFunction || !SphVariables) {
-        returned = -1; // memory allocation error
+    if (WMM_UpdateCache(CoordSpherical) < 0) {
+        return -2; // error
     }
-    // ********
 
-    if (returned >= 0) { // Compute Spherical Harmonic variables
-        if (WMM_ComputeSphericalHarmonicVariables(CoordSpherical, MagneticModel->nMax, SphVariables) < 0) {
-            returned = -2; // error
-        }
+    // Accumulate the spherical harmonic coefficients
+    if (WMM_Summation(&Cache->LegendreFunction, &Cache->SphVariables, CoordSpherical, &MagneticResultsSph) < 0) {
+        return -4; // error
     }
 
-    if (returned >= 0) { // Compute ALF
-        if (WMM_AssociatedLegendreFunction(CoordSpherical, MagneticModel->nMax, LegendreFunction) < 0) {
-            returned = -3; // error
-        }
+    // Map the computed Magnetic fields to Geodeitic coordinates
+    if (WMM_RotateMagneticVector(CoordSpherical, CoordGeodetic, &MagneticResultsSph, &MagneticResultsGeo) < 0) {
+        return -6; // error
     }
 
-    if (returned >= 0) { // Accumulate the spherical harmonic coefficients
-        if (WMM_Summation(LegendreFunction, SphVariables, CoordSpherical, &MagneticResultsSph) < 0) {
-            returned = -4; // error
-        }
+    // Calculate the Geomagnetic elements, Equation 18 , WMM Technical report
+    if (WMM_CalculateGeoMagneticElements(&MagneticResultsGeo, GeoMagneticElements) < 0) {
+        return -8; // error
     }
 
-    if (returned >= 0) { // Sum the Secular Variation Coefficients
-        if (WMM_SecVarSummation(LegendreFunction, SphVariables, CoordSpherical, &MagneticResultsSphVar) < 0) {
-            returned = -5; // error
-        }
-    }
+    return 0; // OK
+}
 
-    if (returned >= 0) { // Map the computed Magnetic fields to Geodeitic coordinates
-        if (WMM_RotateMagneticVector(CoordSpherical, CoordGeodetic, &MagneticResultsSph, &MagneticResultsGeo) < 0) {
-            returned = -6; // error
-        }
-    }
+int WMM_UpdateCache(WMMtype_CoordSpherical *CoordSpherical)
+/* Brings the cached intermediate results up to date for decimal_date and CoordSpherical.
+   Exact float comparisons are intended here: a term is reused only when it was computed
+   from the very same input.
 
-    if (returned >= 0) { // Map the secular variation field components to Geodetic coordinates
-        if (WMM_RotateMagneticVector(CoordSpherical, CoordGeodetic, &MagneticResultsSphVar, &MagneticResultsGeoVar) < 0) {
-            returned = -7; // error
-        }
+   UPDATES : Cache->Main_Field_Coeff_G/H       when decimal_date changed
+   Cache->LegendreFunction               when the geocentric latitude changed
+   Cache->SphVariables                   when the radius or the longitude changed
+ */
+{
+    if (!(Cache->valid & WMM_CACHE_COEFFS) || Cache->decimal_date != decimal_date) {
+        WMM_ResolveCoefficients();
+        Cache->decimal_date = decimal_date;
+        Cache->valid |= WMM_CACHE_COEFFS;
     }
 
-    if (returned >= 0) { // Calculate the Geomagnetic elements, Equation 18 , WMM Technical report
-        if (WMM_CalculateGeoMagneticElements(&MagneticResultsGeo, GeoMagneticElements) < 0) {
-            returned = -8; // error
+    if (!(Cache->valid & WMM_CACHE_LEGENDRE) || Cache->phig != CoordSpherical->phig) {
+        Cache->valid &= ~WMM_CACHE_LEGENDRE;
+        if (WMM_AssociatedLegendreFunction(CoordSpherical, MagneticModel->nMax, &Cache->LegendreFunction) < 0) {
+            return -1; // error
         }
+        Cache->phig   = CoordSpherical->phig;
+        Cache->valid |= WMM_CACHE_LEGENDRE;
     }
 
-    if (returned >= 0) { // Calculate the secular variation of each of the Geomagnetic elements
-        if (WMM_CalculateSecularVariation(&MagneticResultsGeoVar, GeoMagneticElements) < 0) {
-            returned = -9; // error
+    if (!(Cache->valid & WMM_CACHE_SPHVARS) || Cache->r != CoordSpherical->r || Cache->lambda != CoordSpherical->lambda) {
+        Cache->valid &= ~WMM_CACHE_SPHVARS;
+        if (WMM_ComputeSphericalHarmonicVariables(CoordSpherical, MagneticModel->nMax, &Cache->SphVariables) < 0) {
+            return -2; // error
         }
+        Cache->r      = CoordSpherical->r;
+        Cache->lambda = CoordSpherical->lambda;
+        Cache->valid |= WMM_CACHE_SPHVARS;
     }
 
-    // ********
-    // free allocated memory
+    return 0; // OK
+}
 
-    if (SphVariables) {
-        FREE(SphVariables);
-    }
+void WMM_ResolveCoefficients()
+/* Resolves the main field Gauss coefficients for decimal_date into the cached table
+   so the summations do not need to go through the accessor functions for every term.
+ */
+{
+    uint16_t index;
 
-    if (LegendreFunction) {
-        FREE(LegendreFunction);
+    for (index = 0; index < NUMTERMS; index++) {
+        Cache->Main_Field_Coeff_G[index] = WMM_get_main_field_coeff_g(index);
+        Cache->Main_Field_Coeff_H[index] = WMM_get_main_field_coeff_h(index);
     }
-
-    // ********
-
-    return returned;
 }
 
 int WMM_ComputeSphericalHarmonicVariables(WMMtype_CoordSpherical *CoordSpherical, uint16_t nMax, WMMtype_SphericalHarmonicVariables *SphVariables)
@@ -547,8 +536,8 @@ int WMM_Summation(WMMtype_LegendreFunction *LegendreFunction,
 /* Equation 12 in the WMM Technical report.  Derivative with respect to radius.*/
             MagneticResults->Bz -=
                 SphVariables->RelativeRadiusPower[n] *
-                (WMM_get_main_field_coeff_g(index) *
-                 SphVariables->cos_mlambda[m] + WMM_get_main_field_coeff_h(index) * SphVariables->sin_mlambda[m])
+                (Cache->Main_Field_Coeff_G[index] *
+                 SphVariables->cos_mlambda[m] + Cache->Main_Field_Coeff_H[index] * SphVariables->sin_mlambda[m])
                 * (float)(n + 1) * LegendreFunction->Pcup[index];
 
 /*		  1 nMax  (n+2)    n     m            m           m
@@ -557,8 +546,8 @@ int WMM_Summation(WMMtype_LegendreFunction *LegendreFunction,
 /* Equation 11 in the WMM Technical report. Derivative with respect to longitude, divided by radius. */
             MagneticResults->By +=
                 SphVariables->RelativeRadiusPower[n] *
-                (WMM_get_main_field_coeff_g(index) *
-                 SphVariables->sin_mlambda[m] - WMM_get_main_field_coeff_h(index) * SphVariables->cos_mlambda[m])
+                (Cache->Main_Field_Coeff_G[index] *
+                 SphVariables->sin_mlambda[m] - Cache->Main_Field_Coeff_H[index] * SphVariables->cos_mlambda[m])
                 * (float)(m) * LegendreFunction->Pcup[index];
 /*		   nMax  (n+2) n     m            m           m
         Bx = - SUM (a/r)   SUM  [g cosf(m p) + h sinf(m p)] dP (sinf(phi))
@@ -567,8 +556,8 @@ int WMM_Summation(WMMtype_LegendreFunction *LegendreFunction,
 
             MagneticResults->Bx -=
                 SphVariables->RelativeRadiusPower[n] *
-                (WMM_get_main_field_coeff_g(index) *
-                 SphVariables->cos_mlambda[m] + WMM_get_main_field_coeff_h(index) * SphVariables->sin_mlambda[m])
+                (Cache->Main_Field_Coeff_G[index] *
+                 SphVariables->cos_mlambda[m] + Cache->Main_Field_Coeff_H[index] * SphVariables->sin_mlambda[m])
                 * LegendreFunction->dPcup[index];
         }
     }
@@ -955,7 +944,8 @@ int WMM_PcupLow(float *Pcup, float *dPcup, float x, uint16_t nMax)
                    dPcup: Derivative of Pcup(x) with respect to latitude
 
         Notes: Overflow may occur if nMax > 20 , especially for high-latitudes.
-        Use WMM_PcupHigh for large nMax.
+        Use WMM_PcupHigh for large nMax. The normalisation and recursion factors
+        are taken from tables limited to WMM_MAX_MODEL_DEGREES.
 
    Writted by Manoj Nair, June, 2009 . Manoj.C.Nair@Noaa.Gov.
 
@@ -966,11 +956,9 @@ int WMM_PcupLow(float *Pcup, float *dPcup, float x, uint16_t nMax)
  */
 {
     uint16_t n, m, index, index1, index2;
-    float k, z;
-
-    float *schmidtQuasiNorm = (float *)MALLOC(sizeof(float) * NUMPCUP);
+    float z;
 
-    if (!schmidtQuasiNorm) { // memory allocation error
+    if (nMax > WMM_MAX_MODEL_DEGREES) { // normalisation tables only cover the model degree
         return -1;
     }
 
@@ -999,48 +987,27 @@ int WMM_PcupLow(float *Pcup, float *dPcup, float x, uint16_t nMax)
                     Pcup[index]  = x * Pcup[index2];
                     dPcup[index] = x * dPcup[index2] - z * Pcup[index2];
                 } else {
-                    k = (float)(((n - 1) * (n - 1)) - (m * m)) / (float)((2 * n - 1)
-                                                                         * (2 * n - 3));
-                    Pcup[index]  = x * Pcup[index2] - k * Pcup[index1];
-                    dPcup[index] = x * dPcup[index2] - z * Pcup[index2] - k * dPcup[index1];
+                    Pcup[index]  = x * Pcup[index2] - LegendreRecursionK[index] * Pcup[index1];
+                    dPcup[index] = x * dPcup[index2] - z * Pcup[index2] - LegendreRecursionK[index] * dPcup[index1];
                 }
             }
         }
     }
-/*Compute the ration between the Gauss-normalized associated Legendre
-   functions and the Schmidt quasi-normalized version. This is equivalent to
-   sqrt((m==0?1:2)*(n-m)!/(n+m!))*(2n-1)!!/(n-m)!  */
-
-    schmidtQuasiNorm[0] = 1.0f;
-    for (n = 1; n <= nMax; n++) {
-        index  = (n * (n + 1) / 2);
-        index1 = (n - 1) * n / 2;
-        /* for m = 0 */
-        schmidtQuasiNorm[index] = schmidtQuasiNorm[index1] * (float)(2 * n - 1) / (float)n;
-
-        for (m = 1; m <= n; m++) {
-            index  = (n * (n + 1) / 2 + m);
-            index1 = (n * (n + 1) / 2 + m - 1);
-            schmidtQuasiNorm[index] = schmidtQuasiNorm[index1] * sqrtf((float)((n - m + 1) * (m == 1 ? 2 : 1)) / (float)(n + m));
-        }
-    }
 
 /* Converts the  Gauss-normalized associated Legendre
-          functions to the Schmidt quasi-normalized version using pre-computed
-          relation stored in the variable schmidtQuasiNorm */
+          functions to the Schmidt quasi-normalized version using the pre-computed
+          relation stored in the table SchmidtQuasiNorm */
 
     for (n = 1; n <= nMax; n++) {
         for (m = 0; m <= n; m++) {
             index = (n * (n + 1) / 2 + m);
-            Pcup[index]  = Pcup[index] * schmidtQuasiNorm[index];
-            dPcup[index] = -dPcup[index] * schmidtQuasiNorm[index];
+            Pcup[index]  = Pcup[index] * SchmidtQuasiNorm[index];
+            dPcup[index] = -dPcup[index] * SchmidtQuasiNorm[index];
             /* The sign is changed since the new WMM routines use derivative with respect to latitude
                insted of co-latitude */
         }
     }
 
-    FREE(schmidtQuasiNorm);
-
     return 0; // OK
 }
 
@@ -1097,8 +1064,8 @@ int WMM_SummationSpecial(WMMtype_SphericalHarmonicVariables *
 
         MagneticResults->By +=
             SphVariables->RelativeRadiusPower[n] *
-            (WMM_get_main_field_coeff_g(index) *
-             SphVariables->sin_mlambda[1] - WMM_get_main_field_coeff_h(index) * SphVariables->cos_mlambda[1])
+            (Cache->Main_Field_Coeff_G[index] *
+             SphVariables->sin_mlambda[1] - Cache->Main_Field_Coeff_H[index] * SphVariables->cos_mlambda[1])
             * PcupS[n] * schmidtQuasiNorm3;
     }
 
@@ -1166,7 +1133,7 @@ int WMM_SecVarSummationSpecial(WMMtype_SphericalHarmonicVariables *
 }
 
 /**
- * @brief Comput the MainFieldCoeffH accounting for the date
+ * @brief Compute the MainFieldCoeffG accounting for the date
  */
 float WMM_get_main_field_coeff_g(uint16_t index)
 {
@@ -1174,57 +1141,20 @@ float WMM_get_main_field_coeff_g(uint16_t index)
         return 0;
     }
 
-    uint16_t n, m, sum_index, a, b;
-
-    float coeff = CoeffFile[index][2];
-
-    a = MagneticModel->nMaxSecVar;
-    b = (a * (a + 1) / 2 + a);
-    for (n = 1; n <= MagneticModel->nMax; n++) {
-        for (m = 0; m <= n; m++) {
-            sum_index = (n * (n + 1) / 2 + m);
-
-            /* Hacky for now, will solve for which conditions need summing analytically */
-            if (sum_index != index) {
-                continue;
-            }
-
-            if (index <= b) {
-                coeff += (decimal_date - MagneticModel->epoch) * WMM_get_secular_var_coeff_g(sum_index);
-            }
-        }
-    }
-
-    return coeff;
+    /* all terms up to nMaxSecVar have a secular variation, and nMaxSecVar == nMax */
+    return CoeffFile[index][2] + (decimal_date - MagneticModel->epoch) * WMM_get_secular_var_coeff_g(index);
 }
 
+/**
+ * @brief Compute the MainFieldCoeffH accounting for the date
+ */
 float WMM_get_main_field_coeff_h(uint16_t index)
 {
     if (index >= NUMTERMS) {
         return 0;
     }
 
-    uint16_t n, m, sum_index, a, b;
-    float coeff = CoeffFile[index][3];
-
-    a = MagneticModel->nMaxSecVar;
-    b = (a * (a + 1) / 2 + a);
-    for (n = 1; n <= MagneticModel->nMax; n++) {
-        for (m = 0; m <= n; m++) {
-            sum_index = (n * (n + 1) / 2 + m);
-
-            /* Hacky for now, will solve for which conditions need summing analytically */
-            if (sum_index != index) {
-                continue;
-            }
-
-            if (index <= b) {
-                coeff += (decimal_date - MagneticModel->epoch) * WMM_get_secular_var_coeff_h(sum_index);
-            }
-        }
-    }
-
-    return coeff;
+    return CoeffFile[index][3] + (decimal_date - MagneticModel->epoch) * WMM_get_secular_var_coeff_h(index);
 }
 
 float WMM_get_secular_var_coeff_g(uint16_t index)
@@ -27,6 +27,11 @@
 
 #include "fifo_buffer.h"
 
+// order the data accesses against the index updates of the other side, which
+// may run in an interrupt or on another core (host builds)
+#define FIFO_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define FIFO_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+
 // *****************************************************************************
 // circular buffer functions
 
@@ -72,9 +77,6 @@ void fifoBuf_clearData(t_fifo_buffer *buf)
 
 void fifoBuf_removeData(t_fifo_buffer *buf, uint16_t len)
 { // remove a number of bytes from the buffer
-    uint16_t rd = buf->rd;
-    uint16_t buf_size  = buf->buf_size;
-
     // get number of bytes available
     uint16_t num_bytes = fifoBuf_getUsed(buf);
 
@@ -85,192 +87,175 @@ void fifoBuf_removeData(t_fifo_buffer *buf, uint16_t len)
     if (num_bytes < 1) {
         return; // nothing to remove
     }
-    rd += num_bytes;
-    if (rd >= buf_size) {
-        rd -= buf_size;
-    }
 
-    buf->rd = rd;
+    fifoBuf_commitRead(buf, num_bytes);
 }
 
 int16_t fifoBuf_getBytePeek(t_fifo_buffer *buf)
 { // get a data byte from the buffer without removing it
-    uint16_t rd = buf->rd;
-
-    // get number of bytes available
-    uint16_t num_bytes = fifoBuf_getUsed(buf);
+    uint8_t *span;
 
-    if (num_bytes < 1) {
+    if (fifoBuf_acquireRead(buf, &span) < 1) {
         return -1; // no byte retuened
     }
-    return buf->buf_ptr[rd]; // return the byte
+    return *span; // return the byte
 }
 
 int16_t fifoBuf_getByte(t_fifo_buffer *buf)
 { // get a data byte from the buffer
-    uint16_t rd        = buf->rd;
-    uint16_t buf_size  = buf->buf_size;
-    uint8_t *buff      = buf->buf_ptr;
+    uint8_t *span;
 
-    // get number of bytes available
-    uint16_t num_bytes = fifoBuf_getUsed(buf);
-
-    if (num_bytes < 1) {
+    if (fifoBuf_acquireRead(buf, &span) < 1) {
         return -1; // no byte returned
     }
-    uint8_t b = buff[rd];
-    if (++rd >= buf_size) {
-        rd = 0;
-    }
-
-    buf->rd = rd;
+    uint8_t b = *span;
+    fifoBuf_commitRead(buf, 1);
 
     return b; // return the byte
 }
 
 uint16_t fifoBuf_getDataPeek(t_fifo_buffer *buf, void *data, uint16_t len)
 { // get data from the buffer without removing it
-    uint16_t rd        = buf->rd;
-    uint16_t buf_size  = buf->buf_size;
-    uint8_t *buff      = buf->buf_ptr;
+    uint8_t *span;
+    uint8_t *p = (uint8_t *)data;
 
-    // get number of bytes available
+    // get number of bytes available, at most two blocks when wrapping around
     uint16_t num_bytes = fifoBuf_getUsed(buf);
+    uint16_t block_len = fifoBuf_acquireRead(buf, &span);
 
     if (num_bytes > len) {
         num_bytes = len;
     }
-
-    if (num_bytes < 1) {
-        return 0; // return number of bytes copied
+    if (block_len > num_bytes) {
+        block_len = num_bytes;
     }
-    uint8_t *p = (uint8_t *)data;
-    uint16_t i = 0;
 
-    while (num_bytes > 0) {
-        uint16_t block_len = buf_size - rd;
-        if (block_len > num_bytes) {
-            block_len = num_bytes;
-        }
-        if (block_len == 1) {
-            *((uint8_t *)(p + i)) = *((uint8_t *)(buff + rd));
-        } else {
-            memcpy(p + i, buff + rd, block_len);
-        }
-        i  += block_len;
-        num_bytes -= block_len;
-        rd += block_len;
-        if (rd >= buf_size) {
-            rd = 0;
-        }
+    memcpy(p, span, block_len);
+    if (num_bytes > block_len) {
+        memcpy(p + block_len, buf->buf_ptr, num_bytes - block_len);
     }
 
-    return i; // return number of bytes copied
+    return num_bytes; // return number of bytes copied
 }
 
 uint16_t fifoBuf_getData(t_fifo_buffer *buf, void *data, uint16_t len)
 { // get data from our rx buffer
-    uint16_t rd        = buf->rd;
-    uint16_t buf_size  = buf->buf_size;
-    uint8_t *buff      = buf->buf_ptr;
-
-    // get number of bytes available
-    uint16_t num_bytes = fifoBuf_getUsed(buf);
+    uint16_t num_bytes = fifoBuf_getDataPeek(buf, data, len);
 
-    if (num_bytes > len) {
-        num_bytes = len;
+    if (num_bytes > 0) {
+        fifoBuf_commitRead(buf, num_bytes);
     }
 
-    if (num_bytes < 1) {
-        return 0; // return number of bytes copied
+    return num_bytes; // return number of bytes copied
+}
+
+uint16_t fifoBuf_putByte(t_fifo_buffer *buf, const uint8_t b)
+{ // add a data byte to the buffer
+    uint8_t *span;
+
+    if (fifoBuf_acquireWrite(buf, &span) < 1) {
+        return 0;
     }
-    uint8_t *p = (uint8_t *)data;
+
+    *span = b;
+    fifoBuf_commitWrite(buf, 1);
+
+    return 1; // return number of bytes copied
+}
+
+uint16_t fifoBuf_putData(t_fifo_buffer *buf, const void *data, uint16_t len)
+{ // add data to the buffer
+    const uint8_t *p = (const uint8_t *)data;
     uint16_t i = 0;
 
-    while (num_bytes > 0) {
-        uint16_t block_len = buf_size - rd;
-        if (block_len > num_bytes) {
-            block_len = num_bytes;
+    // at most two blocks when wrapping around
+    while (i < len) {
+        uint8_t *span;
+        uint16_t block_len = fifoBuf_acquireWrite(buf, &span);
+        if (block_len < 1) {
+            break;
         }
-        if (block_len == 1) {
-            *((uint8_t *)(p + i)) = *((uint8_t *)(buff + rd));
-        } else {
-            memcpy(p + i, buff + rd, block_len);
-        }
-        i  += block_len;
-        num_bytes -= block_len;
-        rd += block_len;
-        if (rd >= buf_size) {
-            rd = 0;
+        if (block_len > len - i) {
+            block_len = len - i;
         }
+        memcpy(span, p + i, block_len);
+        fifoBuf_commitWrite(buf, block_len);
+        i += block_len;
     }
 
-    buf->rd = rd;
-
     return i; // return number of bytes copied
 }
 
-uint16_t fifoBuf_putByte(t_fifo_buffer *buf, const uint8_t b)
-{ // add a data byte to the buffer
-    uint16_t wr        = buf->wr;
-    uint16_t buf_size  = buf->buf_size;
-    uint8_t *buff      = buf->buf_ptr;
+uint16_t fifoBuf_acquireWrite(t_fifo_buffer *buf, uint8_t **span)
+{ // return the contiguous free space at the write position, to be filled in place
+    uint16_t rd = buf->rd;
 
-    uint16_t num_bytes = fifoBuf_getFree(buf);
+    // the consumer is done with the space before rd
+    FIFO_ACQUIRE();
 
-    if (num_bytes < 1) {
-        return 0;
+    uint16_t wr = buf->wr;
+    uint16_t buf_size  = buf->buf_size;
+    uint16_t num_bytes = 0;
+
+    if (wr < rd) {
+        num_bytes = rd - wr - 1;
+    } else if (buf_size > 0) {
+        // up to the end of the buffer, keeping one byte free before rd
+        num_bytes = buf_size - wr - (rd == 0 ? 1 : 0);
     }
 
-    buff[wr] = b;
-    if (++wr >= buf_size) {
-        wr = 0;
+    *span = buf->buf_ptr + wr;
+
+    return num_bytes;
+}
+
+void fifoBuf_commitWrite(t_fifo_buffer *buf, uint16_t len)
+{ // hand len bytes of the span returned by fifoBuf_acquireWrite() to the consumer
+    uint16_t wr = buf->wr + len;
+
+    if (wr >= buf->buf_size) {
+        wr -= buf->buf_size;
     }
 
-    buf->wr = wr;
+    // the data must be visible before the consumer sees the new wr
+    FIFO_RELEASE();
 
-    return 1; // return number of bytes copied
+    buf->wr = wr;
 }
 
-uint16_t fifoBuf_putData(t_fifo_buffer *buf, const void *data, uint16_t len)
-{ // add data to the buffer
-    uint16_t wr        = buf->wr;
-    uint16_t buf_size  = buf->buf_size;
-    uint8_t *buff      = buf->buf_ptr;
+uint16_t fifoBuf_acquireRead(t_fifo_buffer *buf, uint8_t **span)
+{ // return the contiguous data at the read position, to be used in place
+    uint16_t wr = buf->wr;
 
-    uint16_t num_bytes = fifoBuf_getFree(buf);
+    // the producer has written the data before wr
+    FIFO_ACQUIRE();
 
-    if (num_bytes > len) {
-        num_bytes = len;
-    }
+    uint16_t rd = buf->rd;
+    uint16_t num_bytes;
 
-    if (num_bytes < 1) {
-        return 0; // return number of bytes copied
+    if (rd <= wr) {
+        num_bytes = wr - rd;
+    } else {
+        num_bytes = buf->buf_size - rd;
     }
-    uint8_t *p = (uint8_t *)data;
-    uint16_t i = 0;
 
-    while (num_bytes > 0) {
-        uint16_t block_len = buf_size - wr;
-        if (block_len > num_bytes) {
-            block_len = num_bytes;
-        }
-        if (block_len == 1) {
-            *((uint8_t *)(buff + wr)) = *((uint8_t *)(p + i));
-        } else {
-            memcpy(buff + wr, p + i, block_len);
-        }
-        i  += block_len;
-        num_bytes -= block_len;
-        wr += block_len;
-        if (wr >= buf_size) {
-            wr = 0;
-        }
+    *span = buf->buf_ptr + rd;
+
+    return num_bytes;
+}
+
+void fifoBuf_commitRead(t_fifo_buffer *buf, uint16_t len)
+{ // hand len bytes of the span returned by fifoBuf_acquireRead() back to the producer
+    uint16_t rd = buf->rd + len;
+
+    if (rd >= buf->buf_size) {
+        rd -= buf->buf_size;
     }
 
-    buf->wr = wr;
+    // the data must have been read before the producer may overwrite it
+    FIFO_RELEASE();
 
-    return i; // return number of bytes copied
+    buf->rd = rd;
 }
 
 void fifoBuf_init(t_fifo_buffer *buf, const void *buffer, const uint16_t buffer_size)
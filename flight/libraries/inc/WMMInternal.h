@@ -115,6 +115,25 @@ typedef struct {
     float GVdot; /*16. Yearly rate of chnage in grid variation */
 } WMMtype_GeoMagneticElements;
 
+// cached evaluation state, see WMM_UpdateCache()
+#define WMM_CACHE_COEFFS        0x01  // Main_Field_Coeff_G/H resolved for decimal_date
+#define WMM_CACHE_LEGENDRE      0x02  // LegendreFunction valid for phig
+#define WMM_CACHE_SPHVARS       0x04  // SphVariables valid for r and lambda
+
+typedef struct {
+    WMMtype_Ellipsoid     Ellip;
+    WMMtype_MagneticModel MagneticModel;
+    uint8_t valid; // WMM_CACHE_* bitmask
+    float   decimal_date; // date Main_Field_Coeff_G/H are resolved for
+    float   phig; // geocentric latitude LegendreFunction is valid for
+    float   r; // spherical radius SphVariables is valid for
+    float   lambda; // longitude SphVariables is valid for
+    float   Main_Field_Coeff_G[NUMTERMS]; // C - Gauss coefficients of main geomagnetic model at decimal_date (nT)
+    float   Main_Field_Coeff_H[NUMTERMS]; // C - Gauss coefficients of main geomagnetic model at decimal_date (nT)
+    WMMtype_LegendreFunction LegendreFunction;
+    WMMtype_SphericalHarmonicVariables SphVariables;
+} WMMtype_Cache;
+
 // Internal Function Prototypes
 void WMM_Set_Coeff_Array();
 int WMM_GeodeticToSpherical(WMMtype_CoordGeodetic *CoordGeodetic, WMMtype_CoordSpherical *CoordSpherical);
@@ -122,6 +141,9 @@ int WMM_DateToYear(uint16_t month, uint16_t day, uint16_t year);
 int WMM_Geomag(WMMtype_CoordSpherical *CoordSpherical,
                WMMtype_CoordGeodetic *CoordGeodetic, WMMtype_GeoMagneticElements *GeoMagneticElements);
 
+int WMM_UpdateCache(WMMtype_CoordSpherical *CoordSpherical);
+void WMM_ResolveCoefficients();
+
 int WMM_AssociatedLegendreFunction(WMMtype_CoordSpherical *CoordSpherical, uint16_t nMax, WMMtype_LegendreFunction *LegendreFunction);
 
 int WMM_CalculateGeoMagneticElements(WMMtype_MagneticResults *MagneticResultsGeo, WMMtype_GeoMagneticElements *GeoMagneticElements);
@@ -57,6 +57,15 @@ uint16_t fifoBuf_putByte(t_fifo_buffer *buf, const uint8_t b);
 
 uint16_t fifoBuf_putData(t_fifo_buffer *buf, const void *data, uint16_t len);
 
+// single producer/single consumer in place access: the producer only moves wr,
+// the consumer only moves rd, so one side may run in an interrupt without locking
+
+uint16_t fifoBuf_acquireWrite(t_fifo_buffer *buf, uint8_t **span);
+void fifoBuf_commitWrite(t_fifo_buffer *buf, uint16_t len);
+
+uint16_t fifoBuf_acquireRead(t_fifo_buffer *buf, uint8_t **span);
+void fifoBuf_commitRead(t_fifo_buffer *buf, uint16_t len);
+
 void fifoBuf_init(t_fifo_buffer *buf, const void *buffer, const uint16_t buffer_size);
 
 // *********************
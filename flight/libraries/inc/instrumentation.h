@@ -26,6 +26,7 @@
 #ifndef INSTRUMENTATION_H
 #define INSTRUMENTATION_H
 #include <perfcounter.h>
+#include <perfcounterpercentiles.h>
 /**
  * Initialize the instrumentationUAVObject wrapper
  */
@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotSystem OpenPilot System
+ * @{
+ * @addtogroup OpenPilotLibraries OpenPilot System Libraries
+ * @{
+ * @file       linkadapt.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Datarate and packet length selection for a packet radio link
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef LINKADAPT_H
+#define LINKADAPT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LINKADAPT_MAX_MODES 9
+
+/**
+ * A mode is one datarate of the radio, ordered from the most robust (index 0)
+ * to the fastest. Packets carry at most max_len bytes including parity and
+ * each direction gets one packet per two slots.
+ */
+struct linkadapt_mode {
+    uint32_t bitrate; // bits/s on air
+    uint16_t slot_ms; // time per packet slot
+    uint8_t  max_len; // maximum packet length including parity
+};
+
+/**
+ * Reception statistics of one direction over one adaptation window.
+ * Packets neither good nor corrected were lost or uncorrectable.
+ */
+struct linkadapt_window {
+    uint8_t expected; // packets the peer sent in the window
+    uint8_t good; // received without errors
+    uint8_t corrected; // received with corrected errors
+};
+
+struct linkadapt {
+    const struct linkadapt_mode *modes;
+    uint8_t num_modes;
+    uint8_t parity; // parity bytes per packet, corrects parity / 2 byte errors
+    uint8_t overhead; // bytes on air not protected by the parity (sync, header)
+    uint8_t mode; // current mode
+    uint8_t len; // packet length to send, including parity
+    uint8_t hold; // windows to wait before probing a faster mode
+    uint8_t backoff; // hold after a failed probe, doubles on each failure
+    bool    probing; // the current mode is being tried
+    float   probe_goodput; // goodput before the probe (bytes/s)
+    float   ebn0; // estimated Eb/N0 at the current mode, 0 if unknown
+    float   success; // fraction of packets received at the current mode
+};
+
+void LinkAdaptInit(struct linkadapt *la, const struct linkadapt_mode *modes, uint8_t num_modes, uint8_t parity, uint8_t overhead);
+void LinkAdaptSetMode(struct linkadapt *la, uint8_t mode);
+uint8_t LinkAdaptUpdate(struct linkadapt *la, const struct linkadapt_window *rx, const struct linkadapt_window *peer, bool select_mode);
+float LinkAdaptGoodput(const struct linkadapt *la, uint8_t mode, uint8_t len, float ebn0);
+
+#endif // LINKADAPT_H
+
+/**
+ * @}
+ * @}
+ */
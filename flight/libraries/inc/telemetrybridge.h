@@ -0,0 +1,60 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotSystem OpenPilot System
+ * @{
+ * @addtogroup OpenPilotLibraries OpenPilot System Libraries
+ * @{
+ * @file       telemetrybridge.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Stream scheduling and change detection for UAVO telemetry bridges
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef TELEMETRYBRIDGE_H
+#define TELEMETRYBRIDGE_H
+
+struct telemetrybridge;
+
+typedef void (*TelemetryBridgeHandler)(void);
+
+/**
+ * A stream is a group of messages built by one handler from a set of watched UAVObjects.
+ * Streams with a rate are sent periodically by TelemetryBridgeTick() but only if one of
+ * their watched objects was updated since the last send, or when keepalive periods passed
+ * without sending. Streams without watched objects are always sent when due.
+ * Streams with a zero rate are polled, see TelemetryBridgeChanged().
+ */
+struct telemetrybridge_stream {
+    uint8_t rate; // Hz, 0 for polled streams
+    uint8_t keepalive; // resend unchanged data after this many periods, 0 to always send when due
+    TelemetryBridgeHandler handler;
+};
+
+struct telemetrybridge *TelemetryBridgeCreate(uint32_t com, uint8_t tick_rate, const struct telemetrybridge_stream *streams, uint8_t num_streams, uint8_t max_watches);
+int32_t TelemetryBridgeWatch(struct telemetrybridge *bridge, uint8_t stream, UAVObjHandle obj);
+void TelemetryBridgeTick(struct telemetrybridge *bridge);
+bool TelemetryBridgeChanged(struct telemetrybridge *bridge, uint8_t stream);
+int32_t TelemetryBridgeSend(struct telemetrybridge *bridge, const uint8_t *buf, uint16_t len);
+uint32_t TelemetryBridgeDropped(struct telemetrybridge *bridge);
+
+#endif // TELEMETRYBRIDGE_H
+
+/**
+ * @}
+ * @}
+ */
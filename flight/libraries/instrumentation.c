@@ -34,6 +34,7 @@ static xSemaphoreHandle sem;
 void InstrumentationInit()
 {
     PerfCounterInitialize();
+    PerfCounterPercentilesInitialize();
     publishedCountersInstances = 1;
     vSemaphoreCreateBinary(sem);
 }
@@ -51,6 +52,7 @@ void counterCallback(const pios_perf_counter_t *counter, const int8_t index, __a
 {
     if (publishedCountersInstances < index + 1) {
         PerfCounterCreateInstance();
+        PerfCounterPercentilesCreateInstance();
         publishedCountersInstances++;
     }
     PerfCounterData data;
@@ -59,4 +61,23 @@ void counterCallback(const pios_perf_counter_t *counter, const int8_t index, __a
     data.Counter.Min   = counter->min;
     data.Counter.Value = counter->value;
     PerfCounterInstSet(index, &data);
+
+    // only counters created with a histogram have percentiles, the instance of the others stays empty
+    if (!counter->histogram) {
+        return;
+    }
+
+    // the histogram restarts at each publish, the percentiles cover the last period.
+    // Writers may run at any priority, they record each value atomically
+    pios_perf_percentiles_t percentiles;
+    PIOS_Instrumentation_TakePercentiles((pios_counter_t)counter, &percentiles);
+    PerfCounterPercentilesData tail;
+    tail.Id = counter->id;
+    tail.Samples = percentiles.samples;
+    tail.Percentile.P50  = percentiles.p50;
+    tail.Percentile.P99  = percentiles.p99;
+    tail.Percentile.P999 = percentiles.p999;
+    tail.Percentile.Max  = percentiles.max;
+    PerfCounterPercentilesInstSet(index, &tail);
+    PerfCounterPercentilesInstUpdated(index);
 }
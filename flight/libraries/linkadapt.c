@@ -0,0 +1,326 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotSystem OpenPilot System
+ * @{
+ * @addtogroup OpenPilotLibraries OpenPilot System Libraries
+ * @{
+ * @file       linkadapt.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Datarate and packet length selection for a packet radio link.
+ *             The channel quality is estimated from the fraction of error free
+ *             packets and mapped to the other datarates with a noncoherent FSK
+ *             error model. Faster modes are probed and kept only if the measured
+ *             goodput improved, unless the model already predicts them to be
+ *             worse, slower modes are chosen from the model.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <math.h>
+#include "inc/linkadapt.h"
+
+// Private constants
+
+// Weight of a new window in the smoothed estimate
+#define LINKADAPT_SMOOTHING    0.25f
+// Step down only if the slower mode is predicted to be this much better
+#define LINKADAPT_DOWN_GAIN    1.4f
+// Above this fraction of received packets the estimate is too pessimistic to skip a probe
+#define LINKADAPT_PROBE_SUCCESS 0.98f
+// Windows to wait after a mode change before probing again
+#define LINKADAPT_MIN_HOLD     2
+#define LINKADAPT_MAX_HOLD     16
+// Shortest payload worth sending
+#define LINKADAPT_MIN_PAYLOAD  8
+// Packet lengths tried, in 1/4 of the maximum length of the mode
+#define LINKADAPT_LEN_STEPS    4
+// Bit error probability limits of the model
+#define LINKADAPT_MIN_BER      1e-7f
+#define LINKADAPT_MAX_BER      0.49f
+
+// Private functions
+static float byteErrorRate(float ebn0);
+static float packetSuccess(float q, uint8_t len, uint8_t overhead, uint8_t correctable);
+static float estimateEbN0(const struct linkadapt *la, const struct linkadapt_window *w);
+static float scaledEbN0(const struct linkadapt *la, uint8_t mode, float ebn0);
+static uint8_t bestLength(const struct linkadapt *la, uint8_t mode, float ebn0);
+static bool probeWorthwhile(const struct linkadapt *la, float goodput);
+
+/**
+ * Initialize the adaptation, starting at the most robust mode.
+ * \param[in] la state
+ * \param[in] modes mode table ordered by bitrate, must stay valid
+ * \param[in] num_modes number of entries in modes, at most LINKADAPT_MAX_MODES
+ * \param[in] parity Reed Solomon parity bytes per packet
+ * \param[in] overhead unprotected bytes per packet that have to arrive error free
+ */
+void LinkAdaptInit(struct linkadapt *la, const struct linkadapt_mode *modes, uint8_t num_modes, uint8_t parity, uint8_t overhead)
+{
+    la->modes     = modes;
+    la->num_modes = num_modes;
+    la->parity    = parity;
+    la->overhead  = overhead;
+    la->backoff   = LINKADAPT_MIN_HOLD;
+    LinkAdaptSetMode(la, 0);
+    la->hold      = 0;
+}
+
+/**
+ * Force a mode, e.g. after the link was lost or the peer announced a change.
+ * The quality estimate is discarded.
+ */
+void LinkAdaptSetMode(struct linkadapt *la, uint8_t mode)
+{
+    if (mode >= la->num_modes) {
+        mode = la->num_modes - 1;
+    }
+    la->mode    = mode;
+    la->len     = la->modes[mode].max_len;
+    la->hold    = la->backoff;
+    la->probing = false;
+    la->ebn0    = 0.0f;
+}
+
+/**
+ * Process the statistics of one window, measured in the current mode.
+ * The worse of both directions decides. The packet length is updated in
+ * any case, the mode only if select_mode is set (the end of the link that
+ * announces mode changes).
+ * \param[in] la state
+ * \param[in] rx own reception statistics, NULL if not available
+ * \param[in] peer reception statistics reported by the peer, NULL if not available
+ * \param[in] select_mode choose the mode as well
+ * \return the mode to use for the next window
+ */
+uint8_t LinkAdaptUpdate(struct linkadapt *la, const struct linkadapt_window *rx, const struct linkadapt_window *peer, bool select_mode)
+{
+    const struct linkadapt_window *windows[2] = { rx, peer };
+    float ebn0    = INFINITY;
+    float success = 1.0f;
+    bool valid    = false;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        const struct linkadapt_window *w = windows[i];
+        if (!w || !w->expected) {
+            continue;
+        }
+        float e = estimateEbN0(la, w);
+        float s = (float)(w->good + w->corrected) / w->expected;
+        if (e < ebn0) {
+            ebn0 = e;
+        }
+        if (s < success) {
+            success = s;
+        }
+        valid = true;
+    }
+
+    if (!valid) {
+        return la->mode;
+    }
+
+    // smooth over windows, a single window holds few packets
+    if (la->ebn0 > 0.0f) {
+        la->ebn0    += LINKADAPT_SMOOTHING * (ebn0 - la->ebn0);
+        la->success += LINKADAPT_SMOOTHING * (success - la->success);
+    } else {
+        la->ebn0    = ebn0;
+        la->success = success;
+    }
+
+    const struct linkadapt_mode *m = &la->modes[la->mode];
+    float goodput = la->success * (la->len - la->parity) * 500.0f / m->slot_ms;
+
+    if (select_mode) {
+        if (la->probing) {
+            la->probing = false;
+            if (goodput < la->probe_goodput) {
+                // faster was worse, go back and wait longer before the next try
+                la->backoff = (la->backoff < LINKADAPT_MAX_HOLD / 2) ? la->backoff * 2 : LINKADAPT_MAX_HOLD;
+                LinkAdaptSetMode(la, la->mode - 1);
+                return la->mode;
+            }
+            // keep climbing while it pays off
+            la->backoff = LINKADAPT_MIN_HOLD;
+            la->hold    = 0;
+        }
+
+        // the slower modes are predicted from the estimate, which is pessimistic
+        // when few packets are lost, so stepping down needs a clear gain
+        uint8_t best = la->mode;
+        float best_goodput = LINKADAPT_DOWN_GAIN * goodput;
+        for (uint8_t i = 0; i < la->mode; i++) {
+            float e = scaledEbN0(la, i, la->ebn0);
+            float g = LinkAdaptGoodput(la, i, bestLength(la, i, e), e);
+            if (g > best_goodput) {
+                best_goodput = g;
+                best = i;
+            }
+        }
+
+        if (best != la->mode) {
+            // the channel changed, earlier failed probes say nothing about it
+            float e = scaledEbN0(la, best, la->ebn0);
+            la->backoff = LINKADAPT_MIN_HOLD;
+            LinkAdaptSetMode(la, best);
+            la->len     = bestLength(la, best, e);
+            la->ebn0    = e;
+            la->success = best_goodput * la->modes[best].slot_ms / (500.0f * (la->len - la->parity));
+            return la->mode;
+        } else if (la->hold) {
+            la->hold--;
+        } else if (la->mode + 1 < la->num_modes && probeWorthwhile(la, goodput)) {
+            // the estimate cannot tell exactly how a faster mode does, find out by trying
+            LinkAdaptSetMode(la, la->mode + 1);
+            la->probing = true;
+            la->probe_goodput = goodput;
+            return la->mode;
+        }
+    }
+
+    la->len = bestLength(la, la->mode, la->ebn0);
+
+    return la->mode;
+}
+
+/**
+ * Predicted goodput of one direction.
+ * \param[in] la state
+ * \param[in] mode mode index
+ * \param[in] len packet length including parity
+ * \param[in] ebn0 Eb/N0 (linear) in that mode
+ * \return payload bytes per second
+ */
+float LinkAdaptGoodput(const struct linkadapt *la, uint8_t mode, uint8_t len, float ebn0)
+{
+    const struct linkadapt_mode *m = &la->modes[mode];
+    float q = byteErrorRate(ebn0);
+
+    return packetSuccess(q, len, la->overhead, la->parity / 2) * (len - la->parity) * 500.0f / m->slot_ms;
+}
+
+/**
+ * Byte error probability of noncoherent binary FSK.
+ */
+static float byteErrorRate(float ebn0)
+{
+    float p = 0.5f * expf(-0.5f * ebn0);
+
+    return 1.0f - powf(1.0f - p, 8.0f);
+}
+
+/**
+ * Probability that the unprotected bytes arrive intact and at most
+ * correctable of the len protected bytes are wrong.
+ */
+static float packetSuccess(float q, uint8_t len, uint8_t overhead, uint8_t correctable)
+{
+    if (q >= 1.0f) {
+        return 0.0f;
+    }
+
+    float term = powf(1.0f - q, len);
+    float sum  = term;
+    for (uint8_t k = 1; k <= correctable && k <= len; k++) {
+        term *= (float)(len - k + 1) / k * q / (1.0f - q);
+        sum  += term;
+    }
+
+    return powf(1.0f - q, overhead) * sum;
+}
+
+/**
+ * Estimate Eb/N0 in the current mode from the fraction of error free packets.
+ * The fraction is biased towards 1/2 so that a clean window gives a finite
+ * (pessimistic) estimate.
+ */
+static float estimateEbN0(const struct linkadapt *la, const struct linkadapt_window *w)
+{
+    float clean = (w->good + 0.5f) / (w->expected + 1.0f);
+    float q     = 1.0f - powf(clean, 1.0f / (la->len + la->overhead));
+    float p     = 1.0f - powf(1.0f - q, 0.125f);
+
+    if (p < LINKADAPT_MIN_BER) {
+        p = LINKADAPT_MIN_BER;
+    } else if (p > LINKADAPT_MAX_BER) {
+        p = LINKADAPT_MAX_BER;
+    }
+
+    return -2.0f * logf(2.0f * p);
+}
+
+/**
+ * Eb/N0 in another mode, at constant receive power the energy per bit is
+ * inversely proportional to the bitrate.
+ */
+static float scaledEbN0(const struct linkadapt *la, uint8_t mode, float ebn0)
+{
+    return ebn0 * la->modes[la->mode].bitrate / la->modes[mode].bitrate;
+}
+
+/**
+ * Packet length with the best predicted goodput. Without an estimate the
+ * longest packets are used.
+ */
+static uint8_t bestLength(const struct linkadapt *la, uint8_t mode, float ebn0)
+{
+    uint8_t max_len = la->modes[mode].max_len;
+    uint8_t best    = max_len;
+
+    if (ebn0 <= 0.0f) {
+        return best;
+    }
+
+    float best_goodput = LinkAdaptGoodput(la, mode, max_len, ebn0);
+    for (uint8_t i = 1; i < LINKADAPT_LEN_STEPS; i++) {
+        uint8_t len = max_len * (LINKADAPT_LEN_STEPS - i) / LINKADAPT_LEN_STEPS;
+        if (len < la->parity + LINKADAPT_MIN_PAYLOAD) {
+            break;
+        }
+        float g = LinkAdaptGoodput(la, mode, len, ebn0);
+        if (g > best_goodput) {
+            best_goodput = g;
+            best = len;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * A probe costs the windows spent in the faster mode, skip it when the
+ * estimate already predicts that mode to be worse. Without losses the
+ * estimate is only a lower bound and says nothing.
+ */
+static bool probeWorthwhile(const struct linkadapt *la, float goodput)
+{
+    uint8_t mode = la->mode + 1;
+
+    if (la->success >= LINKADAPT_PROBE_SUCCESS) {
+        return true;
+    }
+
+    float e = scaledEbN0(la, mode, la->ebn0);
+
+    return LinkAdaptGoodput(la, mode, bestLength(la, mode, e), e) > goodput;
+}
+
+/**
+ * @}
+ * @}
+ */
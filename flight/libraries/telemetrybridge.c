@@ -0,0 +1,277 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotSystem OpenPilot System
+ * @{
+ * @addtogroup OpenPilotLibraries OpenPilot System Libraries
+ * @{
+ * @file       telemetrybridge.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Stream scheduling and change detection for UAVO telemetry bridges
+ *             (MAVLink, MSP). Messages are only rebuilt when the objects they are
+ *             made of were updated and are queued without blocking on the port.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "inc/telemetrybridge.h"
+
+// Private types
+
+struct telemetrybridge_watch {
+    UAVObjHandle     obj;
+    uint8_t          stream;
+    volatile uint8_t updated; // written from the updating task, byte access needs no lock
+};
+
+struct telemetrybridge_stream_state {
+    uint8_t ticks; // ticks until the stream is due
+    uint8_t idle; // periods since the stream was last sent
+    bool    retry; // last send did not fit into the tx buffer
+};
+
+struct telemetrybridge {
+    struct telemetrybridge *next;
+    uint32_t com;
+    uint8_t  tick_rate;
+    uint8_t  num_streams;
+    uint8_t  num_watches;
+    uint8_t  max_watches;
+    uint8_t  current; // stream whose handler is running
+    uint32_t dropped;
+    const struct telemetrybridge_stream *streams;
+    struct telemetrybridge_stream_state *state;
+    struct telemetrybridge_watch *watches;
+};
+
+// Private variables
+static struct telemetrybridge *bridges;
+
+// Private functions
+static void objectUpdatedCb(UAVObjEvent *ev);
+static bool streamChanged(struct telemetrybridge *bridge, uint8_t stream, bool *watched);
+
+/**
+ * Create a bridge sending on a com port.
+ * \param[in] com port the messages are queued on
+ * \param[in] tick_rate rate TelemetryBridgeTick() is called at (Hz)
+ * \param[in] streams stream table, must stay valid
+ * \param[in] num_streams number of entries in streams
+ * \param[in] max_watches maximum number of (stream, object) pairs
+ * \return the bridge or NULL if out of memory
+ */
+struct telemetrybridge *TelemetryBridgeCreate(uint32_t com, uint8_t tick_rate, const struct telemetrybridge_stream *streams, uint8_t num_streams, uint8_t max_watches)
+{
+    PIOS_Assert(tick_rate);
+
+    struct telemetrybridge *bridge = pios_malloc(sizeof(*bridge));
+    if (!bridge) {
+        return NULL;
+    }
+    memset(bridge, 0, sizeof(*bridge));
+
+    bridge->state   = pios_malloc(sizeof(*bridge->state) * num_streams);
+    bridge->watches = pios_malloc(sizeof(*bridge->watches) * max_watches);
+    if (!bridge->state || !bridge->watches) {
+        if (bridge->state) {
+            pios_free(bridge->state);
+        }
+        if (bridge->watches) {
+            pios_free(bridge->watches);
+        }
+        pios_free(bridge);
+        return NULL;
+    }
+
+    bridge->com         = com;
+    bridge->tick_rate   = tick_rate;
+    bridge->streams     = streams;
+    bridge->num_streams = num_streams;
+    bridge->max_watches = max_watches;
+    bridge->current     = num_streams;
+
+    for (uint8_t i = 0; i < num_streams; i++) {
+        // spread the streams so they do not all become due on the same tick
+        bridge->state[i].ticks = i % tick_rate;
+        bridge->state[i].idle  = 0;
+        bridge->state[i].retry = false;
+    }
+
+    bridge->next = bridges;
+    bridges = bridge;
+
+    return bridge;
+}
+
+/**
+ * Mark a stream as depending on an object. Bridges are set up at init, watches
+ * cannot be removed.
+ * \param[in] bridge the bridge
+ * \param[in] stream index into the stream table
+ * \param[in] obj object handle, NULL for optional objects that are not present
+ * \return 0 if success or -1 if failure
+ */
+int32_t TelemetryBridgeWatch(struct telemetrybridge *bridge, uint8_t stream, UAVObjHandle obj)
+{
+    if (!obj || stream >= bridge->num_streams || bridge->num_watches >= bridge->max_watches) {
+        return -1;
+    }
+
+    // fast callback: it only flags the watch, cheaper than a dispatch through the event task
+    if (UAVObjConnectCallback(obj, objectUpdatedCb, EV_MASK_ALL_UPDATES, true) < 0) {
+        return -1;
+    }
+
+    // updates before the watch is counted are covered by the initial send
+    struct telemetrybridge_watch *watch = &bridge->watches[bridge->num_watches];
+    watch->obj     = obj;
+    watch->stream  = stream;
+    watch->updated = true; // send once initially
+    bridge->num_watches++;
+
+    return 0;
+}
+
+/**
+ * Run the handlers of the streams that are due and have changed.
+ * Must be called at the tick_rate passed to TelemetryBridgeCreate().
+ * \param[in] bridge the bridge
+ */
+void TelemetryBridgeTick(struct telemetrybridge *bridge)
+{
+    for (uint8_t i = 0; i < bridge->num_streams; i++) {
+        const struct telemetrybridge_stream *stream = &bridge->streams[i];
+        struct telemetrybridge_stream_state *state  = &bridge->state[i];
+
+        if (!stream->rate || !stream->handler) {
+            continue;
+        }
+
+        if (state->ticks && !state->retry) {
+            --state->ticks;
+            continue;
+        }
+
+        uint8_t rate = stream->rate;
+        if (rate > bridge->tick_rate) {
+            rate = bridge->tick_rate;
+        }
+        state->ticks = bridge->tick_rate / rate - 1;
+
+        bool watched;
+        bool changed = streamChanged(bridge, i, &watched);
+
+        if (!state->retry && watched && !changed && (!stream->keepalive || state->idle < stream->keepalive)) {
+            if (state->idle < UINT8_MAX) {
+                state->idle++;
+            }
+            continue;
+        }
+
+        state->idle     = 0;
+        state->retry    = false;
+        bridge->current = i;
+        stream->handler();
+        bridge->current = bridge->num_streams;
+    }
+}
+
+/**
+ * Check whether any object watched by a stream was updated since the last check.
+ * Used for polled streams, e.g. to reuse the last reply to a request.
+ * \param[in] bridge the bridge
+ * \param[in] stream index into the stream table
+ * \return true if the stream needs to be rebuilt
+ */
+bool TelemetryBridgeChanged(struct telemetrybridge *bridge, uint8_t stream)
+{
+    bool watched;
+
+    return streamChanged(bridge, stream, &watched) || !watched;
+}
+
+/**
+ * Queue a message without blocking. If the tx buffer is full the message is
+ * dropped and the stream being sent is retried on the next tick.
+ * \param[in] bridge the bridge
+ * \param[in] buf message
+ * \param[in] len message length
+ * \return number of bytes queued or negative if dropped
+ */
+int32_t TelemetryBridgeSend(struct telemetrybridge *bridge, const uint8_t *buf, uint16_t len)
+{
+    int32_t ret = PIOS_COM_SendBufferNonBlocking(bridge->com, buf, len);
+
+    if (ret < 0) {
+        bridge->dropped++;
+        if (bridge->current < bridge->num_streams) {
+            bridge->state[bridge->current].retry = true;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * \return number of messages dropped because the tx buffer was full
+ */
+uint32_t TelemetryBridgeDropped(struct telemetrybridge *bridge)
+{
+    return bridge->dropped;
+}
+
+/**
+ * Read and clear the update flags of a stream.
+ */
+static bool streamChanged(struct telemetrybridge *bridge, uint8_t stream, bool *watched)
+{
+    bool changed = false;
+
+    *watched = false;
+    for (uint8_t i = 0; i < bridge->num_watches; i++) {
+        struct telemetrybridge_watch *watch = &bridge->watches[i];
+        if (watch->stream == stream) {
+            *watched = true;
+            if (watch->updated) {
+                watch->updated = false;
+                changed = true;
+            }
+        }
+    }
+
+    return changed;
+}
+
+/**
+ * Called in the context of the task updating a watched object.
+ */
+static void objectUpdatedCb(UAVObjEvent *ev)
+{
+    for (struct telemetrybridge *bridge = bridges; bridge; bridge = bridge->next) {
+        for (uint8_t i = 0; i < bridge->num_watches; i++) {
+            if (bridge->watches[i].obj == ev->obj) {
+                bridge->watches[i].updated = true;
+            }
+        }
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
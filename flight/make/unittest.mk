@@ -32,7 +32,7 @@ GTEST_SRC_DIR := $(GTEST_DIR)/src
 
 # Unit test source files
 ALLSRC     := $(SRC) $(wildcard ./*.c)
-ALLCPPSRC  := $(wildcard ./*.cpp) $(GTEST_SRC_DIR)/gtest_main.cc
+ALLCPPSRC  := $(CPPSRC) $(wildcard ./*.cpp) $(GTEST_SRC_DIR)/gtest_main.cc
 ALLSRCBASE := $(notdir $(basename $(ALLSRC) $(ALLCPPSRC)))
 ALLOBJ     := $(addprefix $(OUTDIR)/, $(addsuffix .o, $(ALLSRCBASE)))
 
@@ -216,7 +216,7 @@ static void actuatorTask(__attribute__((unused)) void *parameters)
     float collectiveDesired;
 
 #ifdef PIOS_INCLUDE_INSTRUMENTATION
-    counter = PIOS_Instrumentation_CreateCounter(0xAC700001);
+    counter = PIOS_Instrumentation_CreateHistogramCounter(0xAC700001);
 #endif
     /* Read initial values of ActuatorSettings */
 
@@ -40,8 +40,6 @@
 #include <manualcontrolcommand.h>
 #include <manualcontrolsettings.h>
 #include <flightmodesettings.h>
-#include <gyrostate.h>
-#include <actuatordesired.h>
 #include <stabilizationdesired.h>
 #include <stabilizationsettings.h>
 #include <systemidentsettings.h>
@@ -50,6 +48,7 @@
 #include <systemsettings.h>
 #include <taskinfo.h>
 #include <stabilization.h>
+#include <innerloop.h>
 #include <hwsettings.h>
 #include <stabilizationsettingsbank1.h>
 #include <stabilizationsettingsbank2.h>
@@ -75,8 +74,8 @@
 #define AF_NUMX                     13
 #define AF_NUMP                     43
 
-#if !defined(AT_QUEUE_NUMELEM)
-#define AT_QUEUE_NUMELEM            18
+#if !defined(AT_SAMPLES_NUMELEM)
+#define AT_SAMPLES_NUMELEM          32
 #endif
 
 #define TASK_STARTUP_DELAY_MS       250                                           /* delay task startup this much, waiting on accessory valid */
@@ -85,11 +84,11 @@
 #define SMOOTH_QUICK_FLUSH_DELAY    0.5f                                          /* wait this long after last change to flush to permanent storage */
 #define SMOOTH_QUICK_FLUSH_TICKS    (SMOOTH_QUICK_FLUSH_DELAY * NOT_AT_MODE_RATE) /* this many ticks after last change to flush to permanent storage */
 
-#define MAX_PTS_PER_CYCLE           4    /* max gyro updates to process per loop see YIELD_MS and consider gyro rate */
+#define AT_BLOCK_NUMELEM            8    /* max gyro updates to process per AfPredictBlock() see YIELD_MS and consider gyro rate */
 #define INIT_TIME_DELAY_MS          100  /* delay to allow stab bank, etc. to be populated after flight mode switch change detection */
 #define SYSTEMIDENT_TIME_DELAY_MS   2000 /* delay before starting systemident (shaking) flight mode */
 #define INIT_TIME_DELAY2_MS         2500 /* delay before starting to capture data */
-#define YIELD_MS                    2    /* delay this long between processing sessions see MAX_PTS_PER_CYCLE and consider gyro rate */
+#define YIELD_MS                    2    /* delay this long between processing sessions see AT_BLOCK_NUMELEM and consider gyro rate */
 
 // CheckSettings() returned error bits
 #define TAU_NAN                     1
@@ -109,13 +108,6 @@
 
 // Private types
 enum AUTOTUNE_STATE { AT_INIT, AT_INIT_DELAY, AT_INIT_DELAY2, AT_START, AT_RUN, AT_FINISHED, AT_WAITING };
-struct at_queued_data {
-    float    y[3];                       /* Gyro measurements */
-    float    u[3];                       /* Actuator desired */
-    float    throttle;                   /* Throttle desired */
-    uint32_t gyroStateCallbackTimestamp; /* PIOS_DELAY_GetRaw() time of GyroState callback */
-    uint32_t sensorReadTimestamp; /* PIOS_DELAY_GetRaw() time of sensor read */
-};
 
 
 // Private variables
@@ -128,7 +120,8 @@ static union {
 } u;
 static StabilizationBankManualRateData manualRate;
 static xTaskHandle taskHandle;
-static xQueueHandle atQueue;
+static StabilizationInnerloopCapture atCapture;
+static StabilizationInnerloopSample *atBlock;
 static float gX[AF_NUMX] = { 0 };
 static float gP[AF_NUMP] = { 0 };
 static float gyroReadTimeAverage;
@@ -136,7 +129,6 @@ static float gyroReadTimeAverageAlpha;
 static float gyroReadTimeAverageAlphaAlpha;
 static float alpha;
 static float smoothQuickValue;
-static volatile uint32_t atPointsSpilled;
 static uint32_t throttleAccumulator;
 static uint8_t rollMax, pitchMax;
 static int8_t accessoryToUse;
@@ -145,11 +137,11 @@ static bool moduleEnabled;
 
 
 // Private functions
-static void AtNewGyroData(UAVObjEvent *ev);
 static bool AutoTuneFoundInFMS();
 static void AutoTuneTask(void *parameters);
 static void AfInit(float X[AF_NUMX], float P[AF_NUMP]);
 static void AfPredict(float X[AF_NUMX], float P[AF_NUMP], const float u_in[3], const float gyro[3], const float dT_s, const float t_in);
+static float AfPredictBlock(float X[AF_NUMX], float P[AF_NUMP], const StabilizationInnerloopSample *pts, uint16_t count, uint32_t *lastTime, float noise[3]);
 static bool CheckFlightModeSwitchForPidRequest(uint8_t flightMode);
 static uint8_t CheckSettings();
 static uint8_t CheckSettingsRaw();
@@ -193,9 +185,7 @@ int32_t AutoTuneInitialize(void)
 
     if (moduleEnabled) {
         AccessoryDesiredInitialize();
-        ActuatorDesiredInitialize();
         FlightStatusInitialize();
-        GyroStateInitialize();
         ManualControlCommandInitialize();
         StabilizationBankInitialize();
         StabilizationSettingsBank1Initialize();
@@ -204,9 +194,14 @@ int32_t AutoTuneInitialize(void)
         SystemIdentSettingsInitialize();
         SystemIdentStateInitialize();
 
-        atQueue = xQueueCreate(AT_QUEUE_NUMELEM, sizeof(struct at_queued_data));
-        if (!atQueue) {
+        // the fifo holds whole samples, plus the byte a fifo always keeps free
+        uint16_t fifoSize = AT_SAMPLES_NUMELEM * sizeof(StabilizationInnerloopSample) + 1;
+        uint8_t *fifoBuffer = (uint8_t *)pios_malloc(fifoSize);
+        atBlock = (StabilizationInnerloopSample *)pios_malloc(AT_BLOCK_NUMELEM * sizeof(StabilizationInnerloopSample));
+        if (!fifoBuffer || !atBlock) {
             moduleEnabled = false;
+        } else {
+            fifoBuf_init(&atCapture.fifo, fifoBuffer, fifoSize);
         }
     }
     if (!moduleEnabled) {
@@ -226,7 +221,6 @@ int32_t AutoTuneStart(void)
 {
     // Start main task if it is enabled
     if (moduleEnabled) {
-        GyroStateConnectCallback(AtNewGyroData);
         xTaskCreate(AutoTuneTask, "AutoTune", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &taskHandle);
         PIOS_TASK_MONITOR_RegisterTask(TASKINFO_RUNNING_AUTOTUNE, taskHandle);
     }
@@ -380,6 +374,7 @@ static void AutoTuneTask(__attribute__((unused)) void *parameters)
             } else {
                 savePidDelay = 0;
             }
+            stabilizationInnerloopSetCapture(NULL);
             state = AT_INIT;
             vTaskDelay(NOT_AT_MODE_DELAY_MS / portTICK_RATE_MS);
             continue;
@@ -459,13 +454,14 @@ static void AutoTuneTask(__attribute__((unused)) void *parameters)
                 measureTime   = (uint32_t)systemIdentSettings.TuningDuration * (uint32_t)1000;
                 // init the "previous packet timestamp"
                 lastTime = PIOS_DELAY_GetRaw();
-                /* Drain the queue of all current data */
-                xQueueReset(atQueue);
+                /* Drain the fifo of any earlier run, the capture is stopped */
+                fifoBuf_clearData(&atCapture.fifo);
                 /* And reset the point spill counter */
                 updateCounter       = 0;
-                atPointsSpilled     = 0;
+                atCapture.spilled   = 0;
                 throttleAccumulator = 0;
                 alpha = 0.0f;
+                stabilizationInnerloopSetCapture(&atCapture);
                 state = AT_RUN;
                 lastUpdateTime      = xTaskGetTickCount();
             }
@@ -475,43 +471,25 @@ static void AutoTuneTask(__attribute__((unused)) void *parameters)
             diffTime   = xTaskGetTickCount() - lastUpdateTime;
             doingIdent = true;
             canSleep   = false;
-            // 4 gyro samples per cycle
-            // 2ms cycle time
-            // that is 500 gyro samples per second if it sleeps each time
-            // actually less than 500 because it cycle time is processing time + 2ms
-            for (int i = 0; i < MAX_PTS_PER_CYCLE; i++) {
-                struct at_queued_data pt;
-                /* Grab an autotune point */
-                if (xQueueReceive(atQueue, &pt, 0) != pdTRUE) {
+            // up to AT_BLOCK_NUMELEM gyro samples per cycle
+            // 2ms cycle time when the fifo is drained, no sleep while it is not
+            {
+                uint16_t count = fifoBuf_getData(&atCapture.fifo, atBlock, AT_BLOCK_NUMELEM * sizeof(StabilizationInnerloopSample))
+                                 / sizeof(StabilizationInnerloopSample);
+                if (count < AT_BLOCK_NUMELEM) {
                     /* We've drained the buffer fully */
                     canSleep = true;
-                    break;
-                }
-                /* calculate time between successive points */
-                dT_s = PIOS_DELAY_DiffuS2(lastTime, pt.gyroStateCallbackTimestamp) * 1.0e-6f;
-                /* This is for the first point, but
-                * also if we have extended drops */
-                if (dT_s > 5.0f / PIOS_SENSOR_RATE) {
-                    dT_s = 5.0f / PIOS_SENSOR_RATE;
-                }
-                lastTime = pt.gyroStateCallbackTimestamp;
-                // original algorithm handles time from GyroStateGet() to detected motion
-                // this algorithm also includes the time from raw gyro read to GyroStateGet()
-                gyroReadTimeAverage = gyroReadTimeAverage * alpha
-                                      + PIOS_DELAY_DiffuS2(pt.sensorReadTimestamp, pt.gyroStateCallbackTimestamp) * 1.0e-6f * (1.0f - alpha);
-                alpha = alpha * gyroReadTimeAverageAlphaAlpha + gyroReadTimeAverageAlpha * (1.0f - gyroReadTimeAverageAlphaAlpha);
-                AfPredict(gX, gP, pt.u, pt.y, dT_s, pt.throttle);
-                for (int j = 0; j < 3; ++j) {
-                    const float NOISE_ALPHA = 0.9997f; // 10 second time constant at 300 Hz
-                    noise[j] = NOISE_ALPHA * noise[j] + (1 - NOISE_ALPHA) * (pt.y[j] - gX[j]) * (pt.y[j] - gX[j]);
                 }
-                // This will work up to 8kHz with an 89% throttle position before overflow
-                throttleAccumulator += 10000 * pt.throttle;
-                // Update uavo every 256 cycles to avoid
-                // telemetry spam
-                if (((++updateCounter) & 0xff) == 0) {
-                    float hoverThrottle = ((float)(throttleAccumulator / updateCounter)) / 10000.0f;
-                    UpdateSystemIdentState(gX, noise, dT_s, updateCounter, atPointsSpilled, hoverThrottle);
+                if (count > 0) {
+                    dT_s = AfPredictBlock(gX, gP, atBlock, count, &lastTime, noise);
+                    // Update uavo every 256 predicts to avoid
+                    // telemetry spam
+                    bool publish = ((updateCounter + count) >> 8) != (updateCounter >> 8);
+                    updateCounter += count;
+                    if (publish) {
+                        float hoverThrottle = ((float)(throttleAccumulator / updateCounter)) / 10000.0f;
+                        UpdateSystemIdentState(gX, noise, dT_s, updateCounter, atCapture.spilled, hoverThrottle);
+                    }
                 }
             }
             if (diffTime > measureTime) { // Move on to next state
@@ -521,10 +499,11 @@ static void AutoTuneTask(__attribute__((unused)) void *parameters)
             break;
 
         case AT_FINISHED:
+            stabilizationInnerloopSetCapture(NULL);
             // update with info from the last few data points
             if ((updateCounter & 0xff) != 0) {
                 float hoverThrottle = ((float)(throttleAccumulator / updateCounter)) / 10000.0f;
-                UpdateSystemIdentState(gX, noise, dT_s, updateCounter, atPointsSpilled, hoverThrottle);
+                UpdateSystemIdentState(gX, noise, dT_s, updateCounter, atCapture.spilled, hoverThrottle);
             }
             // data is automatically considered bad if FC was disarmed at the time AT completed
             if (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) {
@@ -592,53 +571,6 @@ static bool AutoTuneFoundInFMS()
 }
 
 
-// gyro sensor callback
-// get gyro data and actuatordesired into a packet
-// and put it in the queue for later processing
-static void AtNewGyroData(UAVObjEvent *ev)
-{
-    static struct at_queued_data q_item;
-    static bool last_sample_unpushed = false;
-    GyroStateData gyro;
-    ActuatorDesiredData actuators;
-    uint32_t timestamp;
-
-    if (!ev || !ev->obj || ev->instId != 0 || ev->event != EV_UPDATED) {
-        return;
-    }
-
-    // object will at times change asynchronously so must copy data here, with locking
-    // and do it as soon as possible
-    timestamp = PIOS_DELAY_GetRaw();
-    GyroStateGet(&gyro);
-    ActuatorDesiredGet(&actuators);
-
-    if (last_sample_unpushed) {
-        /* Last time we were unable to queue up the gyro data.
-         * Try again, last chance! */
-        if (xQueueSend(atQueue, &q_item, 0) != pdTRUE) {
-            atPointsSpilled++;
-        }
-    }
-
-    q_item.gyroStateCallbackTimestamp = timestamp;
-    q_item.y[0]     = q_item.y[0] * stabSettings.gyro_alpha + gyro.x * (1 - stabSettings.gyro_alpha);
-    q_item.y[1]     = q_item.y[1] * stabSettings.gyro_alpha + gyro.y * (1 - stabSettings.gyro_alpha);
-    q_item.y[2]     = q_item.y[2] * stabSettings.gyro_alpha + gyro.z * (1 - stabSettings.gyro_alpha);
-    q_item.u[0]     = actuators.Roll;
-    q_item.u[1]     = actuators.Pitch;
-    q_item.u[2]     = actuators.Yaw;
-    q_item.throttle = actuators.Thrust;
-    q_item.sensorReadTimestamp = gyro.SensorReadTimestamp;
-
-    if (xQueueSend(atQueue, &q_item, 0) != pdTRUE) {
-        last_sample_unpushed = true;
-    } else {
-        last_sample_unpushed = false;
-    }
-}
-
-
 // this callback is only enabled if the AutoTune module is not running
 // if it sees that AutoTune was added to the FMS it issues BOOT and ? alarms
 static void FlightModeSettingsUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
@@ -1429,6 +1361,46 @@ __attribute__((always_inline)) static inline void AfPredict(float X[AF_NUMX], fl
 }
 
 
+/**
+ * Run the filter over a block of captured samples
+ *
+ * The filter is a recursion, each sample needs the state of the previous one,
+ * so this is still one predict and update per sample. Taking the block in one
+ * call keeps the per sample bookkeeping next to the inlined AfPredict() instead
+ * of around a queue receive for each sample.
+ * \returns dT of the last sample
+ */
+static float AfPredictBlock(float X[AF_NUMX], float P[AF_NUMP], const StabilizationInnerloopSample *pts, uint16_t count, uint32_t *lastTime, float noise[3])
+{
+    const float NOISE_ALPHA = 0.9997f; // 10 second time constant at 300 Hz
+    float dT_s = 0.0f;
+
+    for (uint16_t i = 0; i < count; i++) {
+        const StabilizationInnerloopSample *pt = &pts[i];
+        /* calculate time between successive points */
+        dT_s = PIOS_DELAY_DiffuS2(*lastTime, pt->gyroStateCallbackTimestamp) * 1.0e-6f;
+        /* This is for the first point, but
+         * also if we have extended drops */
+        if (dT_s > 5.0f / PIOS_SENSOR_RATE) {
+            dT_s = 5.0f / PIOS_SENSOR_RATE;
+        }
+        *lastTime = pt->gyroStateCallbackTimestamp;
+        // original algorithm handles time from GyroStateGet() to detected motion
+        // this algorithm also includes the time from raw gyro read to GyroStateGet()
+        gyroReadTimeAverage = gyroReadTimeAverage * alpha
+                              + PIOS_DELAY_DiffuS2(pt->sensorReadTimestamp, pt->gyroStateCallbackTimestamp) * 1.0e-6f * (1.0f - alpha);
+        alpha = alpha * gyroReadTimeAverageAlphaAlpha + gyroReadTimeAverageAlpha * (1.0f - gyroReadTimeAverageAlphaAlpha);
+        AfPredict(X, P, pt->u, pt->y, dT_s, pt->throttle);
+        for (int j = 0; j < 3; ++j) {
+            noise[j] = NOISE_ALPHA * noise[j] + (1 - NOISE_ALPHA) * (pt->y[j] - X[j]) * (pt->y[j] - X[j]);
+        }
+        // This will work up to 8kHz with an 89% throttle position before overflow
+        throttleAccumulator += 10000 * pt->throttle;
+    }
+    return dT_s;
+}
+
+
 /**
  * Initialize the state variable and covariance matrix
  * for the system identification EKF
@@ -36,6 +36,19 @@
 #include "debuglogstatus.h"
 #include "debuglogentry.h"
 #include "flightstatus.h"
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+#include "eventtracecontrol.h"
+#include "eventtracedata.h"
+#endif
+
+// private constants
+#define STREAM_STACK_SIZE     512
+#define STREAM_TASK_PRIORITY  CALLBACK_TASK_AUXILIARY
+#define STREAM_PRIORITY       CALLBACK_PRIORITY_LOW
+#define STREAM_MIN_PERIOD_MS  1
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+#define TRACE_CHUNK_SIZE      (sizeof(((EventTraceDataData *)0)->Data))
+#endif
 
 // private variables
 static DebugLogSettingsData settings;
@@ -43,12 +56,35 @@ static DebugLogControlData control;
 static DebugLogStatusData status;
 static FlightStatusData flightstatus;
 static DebugLogEntryData *entry; // would be better on stack but event dispatcher stack might be insufficient
+static DebugLogEntryData *stream_entry;
+static DelayedCallbackInfo *stream_callback;
+static volatile bool stream_start;
+static uint16_t stream_flight;
+static uint16_t stream_next;
+static uint16_t stream_remaining;
+static uint8_t stream_period;
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+static EventTraceDataData *trace_chunk;
+static DelayedCallbackInfo *trace_callback;
+static volatile bool trace_start;
+static volatile bool trace_dumping;
+static volatile uint8_t trace_mask; // classes recorded, resumed after a dump
+static bool trace_log;
+static uint16_t trace_next;
+static uint16_t trace_chunks;
+static uint8_t trace_period;
+#endif
 
 // private functions
 static void SettingsUpdatedCb(UAVObjEvent *ev);
 static void ControlUpdatedCb(UAVObjEvent *ev);
 static void StatusUpdatedCb(UAVObjEvent *ev);
 static void FlightStatusUpdatedCb(UAVObjEvent *ev);
+static void StreamCb(void);
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+static void TraceControlUpdatedCb(UAVObjEvent *ev);
+static void TraceCb(void);
+#endif
 
 int32_t LoggingInitialize(void)
 {
@@ -58,11 +94,29 @@ int32_t LoggingInitialize(void)
     DebugLogEntryInitialize();
     FlightStatusInitialize();
     PIOS_DEBUGLOG_Initialize();
-    entry = pios_malloc(sizeof(DebugLogEntryData));
-    if (!entry) {
+    entry        = pios_malloc(sizeof(DebugLogEntryData));
+    stream_entry = pios_malloc(sizeof(DebugLogEntryData));
+    if (!entry || !stream_entry) {
+        return -1;
+    }
+    stream_callback = PIOS_CALLBACKSCHEDULER_Create(&StreamCb, STREAM_PRIORITY, STREAM_TASK_PRIORITY, -1, STREAM_STACK_SIZE);
+    if (!stream_callback) {
         return -1;
     }
 
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+    EventTraceControlInitialize();
+    EventTraceDataInitialize();
+    trace_chunk = pios_malloc(sizeof(EventTraceDataData));
+    if (!trace_chunk) {
+        return -1;
+    }
+    trace_callback = PIOS_CALLBACKSCHEDULER_Create(&TraceCb, STREAM_PRIORITY, STREAM_TASK_PRIORITY, -1, STREAM_STACK_SIZE);
+    if (!trace_callback) {
+        return -1;
+    }
+#endif
+
     return 0;
 }
 
@@ -71,6 +125,9 @@ int32_t LoggingStart(void)
     DebugLogSettingsConnectCallback(SettingsUpdatedCb);
     DebugLogControlConnectCallback(ControlUpdatedCb);
     FlightStatusConnectCallback(FlightStatusUpdatedCb);
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+    EventTraceControlConnectCallback(TraceControlUpdatedCb);
+#endif
     SettingsUpdatedCb(DebugLogSettingsHandle());
 
     UAVObjEvent ev = {
@@ -139,10 +196,133 @@ static void ControlUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
         if (armed == FLIGHTSTATUS_ARMED_DISARMED) {
             PIOS_DEBUGLOG_Format();
         }
+    } else if (control.Operation == DEBUGLOGCONTROL_OPERATION_STREAM) {
+        // the request is picked up by the stream callback, replacing the current one
+        stream_start = true;
+        PIOS_CALLBACKSCHEDULER_Schedule(stream_callback, 0, CALLBACK_UPDATEMODE_OVERRIDE);
     }
     StatusUpdatedCb(ev);
 }
 
+/**
+ * Push one entry of a Stream request and schedule the next one.
+ * Entries carry their Flight and Entry numbers, the GCS acknowledges a
+ * window by requesting the next one and requests the entries it missed again.
+ */
+static void StreamCb(void)
+{
+    if (stream_start) {
+        DebugLogControlData request;
+        DebugLogControlGet(&request);
+        stream_start     = false;
+        stream_flight    = request.Flight;
+        stream_next      = request.Entry;
+        stream_remaining = request.Count;
+        stream_period    = (request.Period > STREAM_MIN_PERIOD_MS) ? request.Period : STREAM_MIN_PERIOD_MS;
+    }
+
+    if (!stream_remaining) {
+        return;
+    }
+
+    memset(stream_entry, 0, sizeof(DebugLogEntryData));
+    if (PIOS_DEBUGLOG_Read(stream_entry, stream_flight, stream_next) != 0) {
+        // end of the flight, the empty entry tells the GCS
+        stream_entry->Flight = stream_flight;
+        stream_entry->Entry  = stream_next;
+        stream_entry->Type   = DEBUGLOGENTRY_TYPE_EMPTY;
+        stream_remaining     = 0;
+    } else {
+        stream_next++;
+        stream_remaining--;
+    }
+    DebugLogEntrySet(stream_entry);
+    // DebugLogEntry is updated manually, the GCS does not request streamed entries
+    DebugLogEntryUpdated();
+
+    if (stream_remaining) {
+        PIOS_CALLBACKSCHEDULER_Schedule(stream_callback, stream_period, CALLBACK_UPDATEMODE_OVERRIDE);
+    }
+}
+
+
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+static void TraceControlUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    EventTraceControlData request;
+
+    EventTraceControlGet(&request);
+    switch (request.Operation) {
+    case EVENTTRACECONTROL_OPERATION_START:
+        trace_mask = request.Mask;
+        if (!trace_dumping) {
+            PIOS_EVENTTRACE_Start(trace_mask);
+        }
+        break;
+    case EVENTTRACECONTROL_OPERATION_STOP:
+        trace_mask = 0;
+        if (!trace_dumping) {
+            PIOS_EVENTTRACE_Stop();
+        }
+        break;
+    case EVENTTRACECONTROL_OPERATION_DUMP:
+    case EVENTTRACECONTROL_OPERATION_LOG:
+        // the trace is frozen until the last chunk is out
+        if (!trace_dumping) {
+            PIOS_EVENTTRACE_Stop();
+            trace_dumping = true;
+        }
+        trace_start = true;
+        PIOS_CALLBACKSCHEDULER_Schedule(trace_callback, 0, CALLBACK_UPDATEMODE_OVERRIDE);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Push one chunk of the trace dump and schedule the next one.
+ * Chunks carry their number and the total so the GCS can put the dump back
+ * together. Missing chunks are not sent again, the GCS has to request a new
+ * dump, which is the same trace as long as recording is stopped.
+ */
+static void TraceCb(void)
+{
+    if (trace_start) {
+        EventTraceControlData request;
+        EventTraceControlGet(&request);
+        trace_start  = false;
+        trace_log    = (request.Operation == EVENTTRACECONTROL_OPERATION_LOG);
+        trace_next   = 0;
+        trace_chunks = (PIOS_EVENTTRACE_DumpSize() + TRACE_CHUNK_SIZE - 1) / TRACE_CHUNK_SIZE;
+        trace_period = (request.Period > STREAM_MIN_PERIOD_MS) ? request.Period : STREAM_MIN_PERIOD_MS;
+    }
+
+    if (trace_next < trace_chunks) {
+        memset(trace_chunk, 0, sizeof(EventTraceDataData));
+        trace_chunk->Chunk  = trace_next;
+        trace_chunk->Chunks = trace_chunks;
+        trace_chunk->Size   = PIOS_EVENTTRACE_Read(trace_next * TRACE_CHUNK_SIZE, trace_chunk->Data, TRACE_CHUNK_SIZE);
+        if (trace_log) {
+            PIOS_DEBUGLOG_UAVObject(EVENTTRACEDATA_OBJID, 0, sizeof(EventTraceDataData), (uint8_t *)trace_chunk);
+        } else {
+            EventTraceDataSet(trace_chunk);
+            // EventTraceData is updated manually, the GCS does not request the chunks
+            EventTraceDataUpdated();
+        }
+        trace_next++;
+    }
+
+    if (trace_next < trace_chunks) {
+        PIOS_CALLBACKSCHEDULER_Schedule(trace_callback, trace_period, CALLBACK_UPDATEMODE_OVERRIDE);
+    } else {
+        trace_dumping = false;
+        if (trace_mask) {
+            PIOS_EVENTTRACE_Start(trace_mask);
+        }
+    }
+}
+#endif /* PIOS_INCLUDE_EVENTTRACE */
 
 /**
  * @}
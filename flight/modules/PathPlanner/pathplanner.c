@@ -347,12 +347,43 @@ void updatePathDesired()
 
 
 // safety checks for path plan integrity
+struct pathPlanCheck {
+    uint8_t  crc;
+    uint16_t waypointCount;
+    uint16_t actionCount;
+    bool     consistent;
+};
+
+static bool checkWaypoint(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, const void *data, void *context)
+{
+    struct pathPlanCheck *check = (struct pathPlanCheck *)context;
+    const WaypointData *wp = (const WaypointData *)data;
+
+    check->crc = PIOS_CRC_updateCRC(check->crc, (const uint8_t *)data, sizeof(WaypointData));
+    if (wp->Action >= check->actionCount) {
+        // path action id is out of range
+        check->consistent = false;
+    }
+    return true;
+}
+
+static bool checkPathAction(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, const void *data, void *context)
+{
+    struct pathPlanCheck *check = (struct pathPlanCheck *)context;
+    const PathActionData *action = (const PathActionData *)data;
+
+    check->crc = PIOS_CRC_updateCRC(check->crc, (const uint8_t *)data, sizeof(PathActionData));
+    if (action->ErrorDestination >= check->waypointCount || action->JumpDestination >= check->waypointCount) {
+        // waypoint id is out of range
+        check->consistent = false;
+    }
+    return true;
+}
+
 static uint8_t checkPathPlan()
 {
-    uint16_t i;
     uint16_t waypointCount;
     uint16_t actionCount;
-    uint8_t pathCrc;
     PathPlanData pathPlan;
 
     // WaypointData waypoint; // using global instead (?)
@@ -377,40 +408,23 @@ static uint8_t checkPathPlan()
         return false;
     }
 
-    // check CRC
-    pathCrc = 0;
-    for (i = 0; i < waypointCount; i++) {
-        pathCrc = UAVObjUpdateCRC(WaypointHandle(), i, pathCrc);
-    }
-    for (i = 0; i < actionCount; i++) {
-        pathCrc = UAVObjUpdateCRC(PathActionHandle(), i, pathCrc);
-    }
-    if (pathCrc != pathPlan.Crc) {
+    // check CRC and consistency, in one walk over the instances
+    struct pathPlanCheck check = {
+        .crc = 0,
+        .waypointCount = waypointCount,
+        .actionCount   = actionCount,
+        .consistent    = true,
+    };
+    UAVObjIterateInstances(WaypointHandle(), waypointCount, &checkWaypoint, &check);
+    UAVObjIterateInstances(PathActionHandle(), actionCount, &checkPathAction, &check);
+    if (check.crc != pathPlan.Crc) {
         // failed crc check
-        // PIOS_DEBUGLOG_Printf("PathPlan : bad CRC (%d / %d)!", pathCrc, pathPlan.Crc);
+        // PIOS_DEBUGLOG_Printf("PathPlan : bad CRC (%d / %d)!", check.crc, pathPlan.Crc);
         return false;
     }
-
-    // waypoint consistency
-    for (i = 0; i < waypointCount; i++) {
-        WaypointInstGet(i, &waypoint);
-        if (waypoint.Action >= actionCount) {
-            // path action id is out of range
-            return false;
-        }
-    }
-
-    // path action consistency
-    for (i = 0; i < actionCount; i++) {
-        PathActionInstGet(i, &pathAction);
-        if (pathAction.ErrorDestination >= waypointCount) {
-            // waypoint id is out of range
-            return false;
-        }
-        if (pathAction.JumpDestination >= waypointCount) {
-            // waypoint id is out of range
-            return false;
-        }
+    if (!check.consistent) {
+        // path action or waypoint id is out of range
+        return false;
     }
 
     // path plan passed checks
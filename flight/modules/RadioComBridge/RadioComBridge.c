@@ -63,6 +63,18 @@
 // ****************
 // Private types
 
+// A UAVTalk frame relayed from one port to the other.
+// Frames are received straight into buf, only delimited and checksummed,
+// and sent on as they are. Only locally addressed objects are parsed.
+typedef struct {
+    uint8_t     *buf; // UAVTALK_MAX_PACKET_LENGTH bytes
+    uint16_t    count; // bytes in buf
+    uint16_t    size; // frame length including the checksum, 0 until the header is received
+    uint32_t    port; // port the frame is received from
+    UAVTalkStats stats; // only written by the task receiving the frame, never reset
+    UAVTalkStats reported; // stats already added to RadioComBridgeStats
+} RelayFrame;
+
 typedef struct {
     // The task handles.
     xTaskHandle telemetryTxTaskHandle;
@@ -83,6 +95,10 @@ typedef struct {
     // The raw serial Rx buffer
     uint8_t  serialRxBuf[SERIAL_RX_BUF_LEN];
 
+    // Frames relayed from the telemetry port to the radio and back.
+    RelayFrame telemetryFrame;
+    RelayFrame radioFrame;
+
     // Error statistics.
     uint32_t telemetryTxRetries;
     uint32_t radioTxRetries;
@@ -108,8 +124,11 @@ static void radioRxTask(void *parameters);
 static void PPMInputTask(void *parameters);
 static int32_t UAVTalkSendHandler(uint8_t *buf, int32_t length);
 static int32_t RadioSendHandler(uint8_t *buf, int32_t length);
-static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t *rxbuffer, uint8_t count);
-static void ProcessRadioStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t *rxbuffer, uint8_t count);
+static int32_t RelayFrameAllocate(RelayFrame *frame);
+static void RelayFrameTakeStats(RelayFrame *frame, UAVTalkStats *stats);
+static void RelayFrameStream(RelayFrame *frame, uint32_t port, UAVTalkConnection inConnectionHandle, void (*process)(UAVTalkConnection, RelayFrame *));
+static void ProcessTelemetryFrame(UAVTalkConnection inConnectionHandle, RelayFrame *frame);
+static void ProcessRadioFrame(UAVTalkConnection inConnectionHandle, RelayFrame *frame);
 static void objectPersistenceUpdatedCb(UAVObjEvent *objEv);
 static void registerObject(UAVObjHandle obj);
 
@@ -169,6 +188,12 @@ static int32_t RadioComBridgeStart(void)
             break;
         }
 
+        // The telemetry frame also carries UAVTalk from USB HID when the ports are raw serial,
+        // the radio frame is only needed when the radio relays UAVTalk.
+        if (RelayFrameAllocate(&data->telemetryFrame) || (data->parseUAVTalk && RelayFrameAllocate(&data->radioFrame))) {
+            return -1;
+        }
+
         // Configure our UAVObjects for updates.
         UAVObjConnectQueue(UAVObjGetByID(OBJECTPERSISTENCE_OBJID), data->uavtalkEventQueue, EV_UPDATED | EV_UPDATED_MANUAL);
         if (data->isCoordinator) {
@@ -248,6 +273,9 @@ static int32_t RadioComBridgeInitialize(void)
     data->telemetryTxRetries = 0;
     data->radioTxRetries     = 0;
 
+    memset(&data->telemetryFrame, 0, sizeof(data->telemetryFrame));
+    memset(&data->radioFrame, 0, sizeof(data->radioFrame));
+
     data->parseUAVTalk = true;
     data->comSpeed     = OPLINKSETTINGS_COMSPEED_9600;
     PIOS_COM_RADIO     = PIOS_COM_RFM22B;
@@ -289,12 +317,37 @@ static void updateRadioComBridgeStats()
     UAVTalkStats radioUAVTalkStats;
     RadioComBridgeStatsData radioComBridgeStats;
 
+    UAVTalkStats telemetryFrameStats;
+    UAVTalkStats radioFrameStats;
+
+    // The rx tasks keep counting while this runs
+    RelayFrameTakeStats(&data->telemetryFrame, &telemetryFrameStats);
+    RelayFrameTakeStats(&data->radioFrame, &radioFrameStats);
+
     // Get telemetry stats
     UAVTalkGetStats(data->telemUAVTalkCon, &telemetryUAVTalkStats, true);
 
     // Get radio stats
     UAVTalkGetStats(data->radioUAVTalkCon, &radioUAVTalkStats, true);
 
+    // Every received byte passes the relay, only locally addressed frames reach the
+    // UAVTalk parsers. Relayed frames are sent on the other port.
+    if (data->parseUAVTalk) {
+        telemetryUAVTalkStats.rxBytes       = telemetryFrameStats.rxBytes;
+        telemetryUAVTalkStats.rxErrors     += telemetryFrameStats.rxErrors;
+        telemetryUAVTalkStats.rxSyncErrors += telemetryFrameStats.rxSyncErrors;
+        telemetryUAVTalkStats.rxCrcErrors  += telemetryFrameStats.rxCrcErrors;
+        telemetryUAVTalkStats.txBytes      += radioFrameStats.txBytes;
+        telemetryUAVTalkStats.txErrors     += radioFrameStats.txErrors;
+
+        radioUAVTalkStats.rxBytes       = radioFrameStats.rxBytes;
+        radioUAVTalkStats.rxErrors     += radioFrameStats.rxErrors;
+        radioUAVTalkStats.rxSyncErrors += radioFrameStats.rxSyncErrors;
+        radioUAVTalkStats.rxCrcErrors  += radioFrameStats.rxCrcErrors;
+        radioUAVTalkStats.txBytes      += telemetryFrameStats.txBytes;
+        radioUAVTalkStats.txErrors     += telemetryFrameStats.txErrors;
+    }
+
     // Get stats object data
     RadioComBridgeStatsGet(&radioComBridgeStats);
 
@@ -402,14 +455,14 @@ static void radioRxTask(__attribute__((unused)) void *parameters)
 #ifdef PIOS_INCLUDE_WDG
         PIOS_WDG_UpdateFlag(PIOS_WDG_RADIORX);
 #endif
-        if (PIOS_COM_RADIO) {
+        if (PIOS_COM_RADIO && data->parseUAVTalk) {
+            // Relay complete frames to the telemetry port.
+            RelayFrameStream(&data->radioFrame, PIOS_COM_RADIO, data->radioUAVTalkCon, ProcessRadioFrame);
+        } else if (PIOS_COM_RADIO) {
             uint8_t serial_data[16];
             uint16_t bytes_to_process = PIOS_COM_ReceiveBuffer(PIOS_COM_RADIO, serial_data, sizeof(serial_data), MAX_PORT_DELAY);
             if (bytes_to_process > 0) {
-                if (data->parseUAVTalk) {
-                    // Pass the data through the UAVTalk parser.
-                    ProcessRadioStream(data->radioUAVTalkCon, data->telemUAVTalkCon, serial_data, bytes_to_process);
-                } else if (PIOS_COM_TELEMETRY) {
+                if (PIOS_COM_TELEMETRY) {
                     // Send the data straight to the telemetry port.
                     // Following call can fail with -2 error code (buffer full) or -3 error code (could not acquire send mutex)
                     // It is the caller responsibility to retry in such cases...
@@ -446,11 +499,8 @@ static void telemetryRxTask(__attribute__((unused)) void *parameters)
         }
 #endif /* PIOS_INCLUDE_USB */
         if (inputPort) {
-            uint8_t serial_data[16];
-            uint16_t bytes_to_process = PIOS_COM_ReceiveBuffer(inputPort, serial_data, sizeof(serial_data), MAX_PORT_DELAY);
-            if (bytes_to_process > 0) {
-                ProcessTelemetryStream(data->telemUAVTalkCon, data->radioUAVTalkCon, serial_data, bytes_to_process);
-            }
+            // Relay complete frames to the radio.
+            RelayFrameStream(&data->telemetryFrame, inputPort, data->telemUAVTalkCon, ProcessTelemetryFrame);
         } else {
             vTaskDelay(5);
         }
@@ -587,98 +637,260 @@ static int32_t RadioSendHandler(uint8_t *buf, int32_t length)
 }
 
 /**
- * @brief Process a byte of data received on the telemetry stream
+ * @brief Allocate the buffer of a relayed frame.
  *
- * @param[in] inConnectionHandle  The UAVTalk connection handle on the telemetry port
- * @param[in] outConnectionHandle  The UAVTalk connection handle on the radio port.
- * @param[in] rxbyte  The received byte.
+ * @param[in] frame  The frame
+ * @return -1 on failure, 0 on success
+ */
+static int32_t RelayFrameAllocate(RelayFrame *frame)
+{
+    if (!frame->buf) {
+        frame->buf = (uint8_t *)pios_malloc(UAVTALK_MAX_PACKET_LENGTH);
+    }
+    return frame->buf ? 0 : -1;
+}
+
+/**
+ * @brief Get what a frame counted since the last call.
+ * The counters belong to the task receiving the frame, they are not reset but read
+ * one 32 bit word at a time, which that task can not tear, and reported as differences.
+ *
+ * @param[in] frame  The frame
+ * @param[out] stats  Counted since the last call
+ */
+static void RelayFrameTakeStats(RelayFrame *frame, UAVTalkStats *stats)
+{
+    const volatile uint32_t *counter = (const volatile uint32_t *)&frame->stats;
+    uint32_t *reported = (uint32_t *)&frame->reported;
+    uint32_t *delta    = (uint32_t *)stats;
+
+    for (uint8_t i = 0; i < sizeof(UAVTalkStats) / sizeof(uint32_t); i++) {
+        uint32_t now = counter[i];
+        delta[i]    = now - reported[i];
+        reported[i] = now;
+    }
+}
+
+/**
+ * @brief Drop bytes up to the next sync byte at or after position from.
+ *
+ * @param[in] frame  The frame
+ * @param[in] from  First position to look for a sync byte
  */
-static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t *rxbuffer, uint8_t length)
+static void RelayFrameResync(RelayFrame *frame, uint16_t from)
 {
-    uint8_t position = 0;
-
-    // Keep reading until we receive a completed packet.
-    while (position < length) {
-        UAVTalkRxState state = UAVTalkProcessInputStreamQuiet(inConnectionHandle, rxbuffer, length, &position);
-        if (state == UAVTALK_STATE_COMPLETE) {
-            // We only want to unpack certain telemetry objects
-            uint32_t objId = UAVTalkGetPacketObjId(inConnectionHandle);
-            switch (objId) {
-            case OPLINKSTATUS_OBJID:
-            case OPLINKSETTINGS_OBJID:
-            case OPLINKRECEIVER_OBJID:
-            case MetaObjectId(OPLINKSTATUS_OBJID):
-            case MetaObjectId(OPLINKSETTINGS_OBJID):
-            case MetaObjectId(OPLINKRECEIVER_OBJID):
-                UAVTalkReceiveObject(inConnectionHandle);
-                break;
-            case OBJECTPERSISTENCE_OBJID:
-            case MetaObjectId(OBJECTPERSISTENCE_OBJID):
-                // receive object locally
-                // some objects will send back a response to telemetry
-                // FIXME:
-                // OPLM will ack or nack all objects requests and acked object sends
-                // Receiver will probably also ack / nack the same messages
-                // This has some consequences like :
-                // Second ack/nack will not match an open transaction or will apply to wrong transaction
-                // Question : how does GCS handle receiving the same object twice
-                // The OBJECTPERSISTENCE logic can be broken too if for example OPLM nacks and then REVO acks...
-                UAVTalkReceiveObject(inConnectionHandle);
-                // relay packet to remote modem
-                UAVTalkRelayPacket(inConnectionHandle, outConnectionHandle);
-                break;
-            default:
-                // all other packets are relayed to the remote modem
-                UAVTalkRelayPacket(inConnectionHandle, outConnectionHandle);
-                break;
+    uint16_t i = from;
+
+    while (i < frame->count && frame->buf[i] != UAVTALK_SYNC_VAL) {
+        ++i;
+    }
+    frame->stats.rxSyncErrors += i;
+    frame->count -= i;
+    memmove(frame->buf, frame->buf + i, frame->count);
+    frame->size   = 0;
+}
+
+/**
+ * @brief Delimit and check the frame received so far.
+ *
+ * @param[in] frame  The frame
+ * @return true if buf starts with a complete frame with a valid checksum
+ */
+static bool RelayFrameComplete(RelayFrame *frame)
+{
+    while (frame->count) {
+        if (frame->buf[0] != UAVTALK_SYNC_VAL) {
+            RelayFrameResync(frame, 0);
+            continue;
+        }
+
+        if (!frame->size) {
+            if (frame->count < UAVTALK_MIN_HEADER_LENGTH) {
+                return false;
             }
+
+            uint8_t type = frame->buf[1];
+            uint16_t packet_size = frame->buf[2] | (frame->buf[3] << 8);
+            if ((type & UAVTALK_TYPE_MASK) != UAVTALK_TYPE_VER
+                || packet_size < UAVTALK_MIN_HEADER_LENGTH
+                || packet_size > UAVTALK_MAX_HEADER_LENGTH + UAVTALK_MAX_PAYLOAD_LENGTH) {
+                frame->stats.rxErrors++;
+                RelayFrameResync(frame, 1);
+                continue;
+            }
+            frame->size = packet_size + UAVTALK_CHECKSUM_LENGTH;
         }
+
+        if (frame->count < frame->size) {
+            return false;
+        }
+
+        if (PIOS_CRC_updateCRC(0, frame->buf, frame->size - UAVTALK_CHECKSUM_LENGTH) != frame->buf[frame->size - UAVTALK_CHECKSUM_LENGTH]) {
+            frame->stats.rxCrcErrors++;
+            frame->stats.rxErrors++;
+            RelayFrameResync(frame, 1);
+            continue;
+        }
+
+        return true;
     }
+
+    return false;
 }
 
 /**
- * @brief Process a byte of data received on the radio data stream.
+ * @brief Get the object ID of a complete frame.
+ */
+static uint32_t RelayFrameObjId(RelayFrame *frame)
+{
+    return frame->buf[4] | (frame->buf[5] << 8) | (frame->buf[6] << 16) | ((uint32_t)frame->buf[7] << 24);
+}
+
+/**
+ * @brief Send a complete frame as it was received.
  *
- * @param[in] inConnectionHandle  The UAVTalk connection handle on the radio port.
- * @param[in] outConnectionHandle  The UAVTalk connection handle on the telemetry port.
- * @param[in] rxbuffer  The received buffer.
- * @param[in] length  buffer length
+ * @param[in] frame  The frame
+ * @param[in] outputStream  The send handler of the other port
  */
-static void ProcessRadioStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t *rxbuffer, uint8_t length)
+static void RelayFrameSend(RelayFrame *frame, UAVTalkOutputStream outputStream)
 {
-    uint8_t position = 0;
-
-    // Keep reading until we receive a completed packet.
-    while (position < length) {
-        UAVTalkRxState state = UAVTalkProcessInputStreamQuiet(inConnectionHandle, rxbuffer, length, &position);
-        if (state == UAVTALK_STATE_COMPLETE) {
-            // We only want to unpack certain objects from the remote modem
-            // Similarly we only want to relay certain objects to the telemetry port
-            uint32_t objId = UAVTalkGetPacketObjId(inConnectionHandle);
-            switch (objId) {
-            case OPLINKSTATUS_OBJID:
-            case OPLINKSETTINGS_OBJID:
-            case MetaObjectId(OPLINKSTATUS_OBJID):
-            case MetaObjectId(OPLINKSETTINGS_OBJID):
-                // Ignore object...
-                // These objects are shadowed by the modem and are not transmitted to the telemetry port
-                // - OPLINKSTATUS_OBJID : ground station will receive the OPLM link status instead
-                // - OPLINKSETTINGS_OBJID : ground station will read and write the OPLM settings instead
-                break;
-            case OPLINKRECEIVER_OBJID:
-            case MetaObjectId(OPLINKRECEIVER_OBJID):
-                // Receive object locally
-                // These objects are received by the modem and are not transmitted to the telemetry port
-                // - OPLINKRECEIVER_OBJID : not sure why
-                // some objects will send back a response to the remote modem
-                UAVTalkReceiveObject(inConnectionHandle);
-                break;
-            default:
-                // all other packets are relayed to the telemetry port
-                UAVTalkRelayPacket(inConnectionHandle, outConnectionHandle);
-                break;
-            }
+    int32_t rc = outputStream(frame->buf, frame->size);
+
+    if (rc == frame->size) {
+        frame->stats.txBytes += rc;
+    } else {
+        frame->stats.txErrors++;
+    }
+}
+
+/**
+ * @brief Unpack a complete frame addressed to this modem.
+ *
+ * @param[in] inConnectionHandle  The UAVTalk connection of the port the frame was received from
+ * @param[in] frame  The frame
+ */
+static void RelayFrameReceiveObject(UAVTalkConnection inConnectionHandle, RelayFrame *frame)
+{
+    uint16_t position = 0;
+
+    // the parser takes at most 255 bytes at a time
+    while (position < frame->size) {
+        uint16_t length = frame->size - position;
+        if (length > 255) {
+            length = 255;
         }
+        UAVTalkProcessInputStream(inConnectionHandle, frame->buf + position, length);
+        position += length;
+    }
+}
+
+/**
+ * @brief Receive from a port into a frame and process every complete frame.
+ * Only as many bytes as needed to complete the header or the frame are read,
+ * so complete frames are never split or copied around.
+ *
+ * @param[in] frame  The frame
+ * @param[in] port  The port to receive from
+ * @param[in] inConnectionHandle  The UAVTalk connection of that port
+ * @param[in] process  Called for each complete frame
+ */
+static void RelayFrameStream(RelayFrame *frame, uint32_t port, UAVTalkConnection inConnectionHandle, void (*process)(UAVTalkConnection, RelayFrame *))
+{
+    if (frame->port != port) {
+        // Do not glue a partial frame from the previous port to data from this one.
+        frame->port  = port;
+        frame->count = 0;
+        frame->size  = 0;
+    }
+
+    uint16_t wanted = (frame->size ? frame->size : UAVTALK_MIN_HEADER_LENGTH) - frame->count;
+    uint16_t count  = PIOS_COM_ReceiveBuffer(port, frame->buf + frame->count, wanted, MAX_PORT_DELAY);
+
+    frame->count += count;
+    frame->stats.rxBytes += count;
+
+    while (RelayFrameComplete(frame)) {
+        process(inConnectionHandle, frame);
+
+        // a resync can leave the start of the next frame behind this one
+        frame->count -= frame->size;
+        memmove(frame->buf, frame->buf + frame->size, frame->count);
+        frame->size   = 0;
+    }
+}
+
+/**
+ * @brief Process a complete frame received on the telemetry port.
+ *
+ * @param[in] inConnectionHandle  The UAVTalk connection handle on the telemetry port
+ * @param[in] frame  The frame
+ */
+static void ProcessTelemetryFrame(UAVTalkConnection inConnectionHandle, RelayFrame *frame)
+{
+    // We only want to unpack certain telemetry objects
+    switch (RelayFrameObjId(frame)) {
+    case OPLINKSTATUS_OBJID:
+    case OPLINKSETTINGS_OBJID:
+    case OPLINKRECEIVER_OBJID:
+    case MetaObjectId(OPLINKSTATUS_OBJID):
+    case MetaObjectId(OPLINKSETTINGS_OBJID):
+    case MetaObjectId(OPLINKRECEIVER_OBJID):
+        RelayFrameReceiveObject(inConnectionHandle, frame);
+        break;
+    case OBJECTPERSISTENCE_OBJID:
+    case MetaObjectId(OBJECTPERSISTENCE_OBJID):
+        // receive object locally
+        // some objects will send back a response to telemetry
+        // FIXME:
+        // OPLM will ack or nack all objects requests and acked object sends
+        // Receiver will probably also ack / nack the same messages
+        // This has some consequences like :
+        // Second ack/nack will not match an open transaction or will apply to wrong transaction
+        // Question : how does GCS handle receiving the same object twice
+        // The OBJECTPERSISTENCE logic can be broken too if for example OPLM nacks and then REVO acks...
+        RelayFrameReceiveObject(inConnectionHandle, frame);
+        // relay packet to remote modem
+        RelayFrameSend(frame, RadioSendHandler);
+        break;
+    default:
+        // all other packets are relayed to the remote modem
+        RelayFrameSend(frame, RadioSendHandler);
+        break;
+    }
+}
+
+/**
+ * @brief Process a complete frame received on the radio port.
+ *
+ * @param[in] inConnectionHandle  The UAVTalk connection handle on the radio port.
+ * @param[in] frame  The frame
+ */
+static void ProcessRadioFrame(UAVTalkConnection inConnectionHandle, RelayFrame *frame)
+{
+    // We only want to unpack certain objects from the remote modem
+    // Similarly we only want to relay certain objects to the telemetry port
+    switch (RelayFrameObjId(frame)) {
+    case OPLINKSTATUS_OBJID:
+    case OPLINKSETTINGS_OBJID:
+    case MetaObjectId(OPLINKSTATUS_OBJID):
+    case MetaObjectId(OPLINKSETTINGS_OBJID):
+        // Ignore object...
+        // These objects are shadowed by the modem and are not transmitted to the telemetry port
+        // - OPLINKSTATUS_OBJID : ground station will receive the OPLM link status instead
+        // - OPLINKSETTINGS_OBJID : ground station will read and write the OPLM settings instead
+        break;
+    case OPLINKRECEIVER_OBJID:
+    case MetaObjectId(OPLINKRECEIVER_OBJID):
+        // Receive object locally
+        // These objects are received by the modem and are not transmitted to the telemetry port
+        // - OPLINKRECEIVER_OBJID : not sure why
+        // some objects will send back a response to the remote modem
+        RelayFrameReceiveObject(inConnectionHandle, frame);
+        break;
+    default:
+        // all other packets are relayed to the telemetry port
+        RelayFrameSend(frame, UAVTalkSendHandler);
+        break;
     }
 }
 
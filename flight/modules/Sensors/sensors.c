@@ -269,10 +269,10 @@ static void SensorsTask(__attribute__((unused)) void *parameters)
 
     // Performance counters
     PERF_INIT_COUNTER(counterAccelSamples, 0x53000001);
-    PERF_INIT_COUNTER(counterAccelPeriod, 0x53000002);
+    PERF_INIT_HISTOGRAM_COUNTER(counterAccelPeriod, 0x53000002);
     PERF_INIT_COUNTER(counterMagPeriod, 0x53000003);
     PERF_INIT_COUNTER(counterBaroPeriod, 0x53000004);
-    PERF_INIT_COUNTER(counterSensorPeriod, 0x53000005);
+    PERF_INIT_HISTOGRAM_COUNTER(counterSensorPeriod, 0x53000005);
     PERF_INIT_COUNTER(counterSensorResets, 0x53000006);
 
     // Test sensors
@@ -50,6 +50,7 @@
 
 #include "attitudestate.h"
 #include "accelsensor.h"
+#include "actuatorcommand.h"
 #include "actuatordesired.h"
 #include "attitudestate.h"
 #include "attitudesimulated.h"
@@ -88,6 +89,11 @@ static void simulateConstant();
 static void simulateModelAgnostic();
 static void simulateModelQuadcopter();
 static void simulateModelAirplane();
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+static void SensorsBridgeLoop();
+static void bridgePublishSample(const struct simbridge_sample *sample);
+static void bridgeUpdateOutput();
+#endif
 
 static float accel_bias[3];
 
@@ -107,6 +113,7 @@ int32_t SensorsInitialize(void)
     accel_bias[2] = rand_gauss() / 10;
 
     AccelSensorInitialize();
+    ActuatorCommandInitialize();
     AttitudeSimulatedInitialize();
     BaroSensorInitialize();
     AirspeedSensorInitialize();
@@ -126,8 +133,16 @@ int32_t SensorsInitialize(void)
  */
 int32_t SensorsStart(void)
 {
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+    // Without an external simulator the sensors come from the GCS (HITL),
+    // the internal models would overwrite them
+    if (!PIOS_SIMBRIDGE_IsEnabled()) {
+        return 0;
+    }
+#endif
+
     // Start main task
-    xTaskCreate(SensorsTask, (signed char *)"Sensors", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &sensorsTaskHandle);
+    xTaskCreate(SensorsTask, "Sensors", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &sensorsTaskHandle);
     PIOS_TASK_MONITOR_RegisterTask(TASKINFO_RUNNING_SENSORS, sensorsTaskHandle);
     PIOS_WDG_RegisterFlag(PIOS_WDG_SENSORS);
 
@@ -142,8 +157,6 @@ MODULE_INITCALL(SensorsInitialize, SensorsStart);
 int sensors_count;
 static void SensorsTask(__attribute__((unused)) void *parameters)
 {
-    portTickType lastSysTime;
-
     AlarmsClear(SYSTEMALARMS_ALARM_SENSORS);
 
 // HomeLocationData homeLocation;
@@ -158,9 +171,14 @@ static void SensorsTask(__attribute__((unused)) void *parameters)
 // HomeLocationSet(&homeLocation);
 
 
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+    if (PIOS_SIMBRIDGE_IsEnabled()) {
+        // The external simulator provides the sensors
+        SensorsBridgeLoop();
+    }
+#endif
+
     // Main task loop
-    lastSysTime = xTaskGetTickCount();
-    uint32_t last_time = PIOS_DELAY_GetRaw();
     while (1) {
         PIOS_WDG_UpdateFlag(PIOS_WDG_SENSORS);
 
@@ -184,14 +202,6 @@ static void SensorsTask(__attribute__((unused)) void *parameters)
             sensor_sim_type = MODEL_AGNOSTIC;
         }
 
-        static int i;
-        i++;
-        if (i % 5000 == 0) {
-            // float dT = PIOS_DELAY_DiffuS(last_time) / 10.0e6;
-            // fprintf(stderr, "Sensor relative timing: %f\n", dT);
-            last_time = PIOS_DELAY_GetRaw();
-        }
-
         sensors_count++;
 
         switch (sensor_sim_type) {
@@ -354,7 +364,7 @@ static void simulateModelQuadcopter()
     ActuatorDesiredData actuatorDesired;
     ActuatorDesiredGet(&actuatorDesired);
 
-    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Throttle * MAX_THRUST : 0;
+    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Thrust * MAX_THRUST : 0;
     if (thrust < 0) {
         thrust = 0;
     }
@@ -543,13 +553,17 @@ static void simulateModelQuadcopter()
     attitudeSimulated.q2 = q[1];
     attitudeSimulated.q3 = q[2];
     attitudeSimulated.q4 = q[3];
-    Quaternion2RPY(q, &attitudeSimulated.Roll);
-    attitudeSimulated.Position[0] = pos[0];
-    attitudeSimulated.Position[1] = pos[1];
-    attitudeSimulated.Position[2] = pos[2];
-    attitudeSimulated.Velocity[0] = vel[0];
-    attitudeSimulated.Velocity[1] = vel[1];
-    attitudeSimulated.Velocity[2] = vel[2];
+    float attitude_rpy[3];
+    Quaternion2RPY(q, attitude_rpy);
+    attitudeSimulated.Roll  = attitude_rpy[0];
+    attitudeSimulated.Pitch = attitude_rpy[1];
+    attitudeSimulated.Yaw   = attitude_rpy[2];
+    attitudeSimulated.Position.North = pos[0];
+    attitudeSimulated.Position.East = pos[1];
+    attitudeSimulated.Position.Down = pos[2];
+    attitudeSimulated.Velocity.North = vel[0];
+    attitudeSimulated.Velocity.East = vel[1];
+    attitudeSimulated.Velocity.Down = vel[2];
     AttitudeSimulatedSet(&attitudeSimulated);
 }
 
@@ -597,7 +611,7 @@ static void simulateModelAirplane()
     ActuatorDesiredData actuatorDesired;
     ActuatorDesiredGet(&actuatorDesired);
 
-    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Throttle * MAX_THRUST : 0;
+    float thrust = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED) ? actuatorDesired.Thrust * MAX_THRUST : 0;
     if (thrust < 0) {
         thrust = 0;
     }
@@ -825,16 +839,141 @@ static void simulateModelAirplane()
     attitudeSimulated.q2 = q[1];
     attitudeSimulated.q3 = q[2];
     attitudeSimulated.q4 = q[3];
-    Quaternion2RPY(q, &attitudeSimulated.Roll);
-    attitudeSimulated.Position[0] = pos[0];
-    attitudeSimulated.Position[1] = pos[1];
-    attitudeSimulated.Position[2] = pos[2];
-    attitudeSimulated.Velocity[0] = vel[0];
-    attitudeSimulated.Velocity[1] = vel[1];
-    attitudeSimulated.Velocity[2] = vel[2];
+    float attitude_rpy[3];
+    Quaternion2RPY(q, attitude_rpy);
+    attitudeSimulated.Roll  = attitude_rpy[0];
+    attitudeSimulated.Pitch = attitude_rpy[1];
+    attitudeSimulated.Yaw   = attitude_rpy[2];
+    attitudeSimulated.Position.North = pos[0];
+    attitudeSimulated.Position.East = pos[1];
+    attitudeSimulated.Position.Down = pos[2];
+    attitudeSimulated.Velocity.North = vel[0];
+    attitudeSimulated.Velocity.East = vel[1];
+    attitudeSimulated.Velocity.Down = vel[2];
     AttitudeSimulatedSet(&attitudeSimulated);
 }
 
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+/**
+ * Publishes the samples of the external simulator as their time comes,
+ * and hands it back the actuator outputs. The simulator steps in lockstep
+ * with the flight code, so the samples of a tick are always queued by the
+ * time this task runs.
+ */
+static void SensorsBridgeLoop()
+{
+    struct pios_simbridge_sample sample;
+
+    while (1) {
+        PIOS_WDG_UpdateFlag(PIOS_WDG_SENSORS);
+
+        uint64_t now = PIOS_SIMCLOCK_GetuS();
+        while (PIOS_SIMBRIDGE_GetSample(&sample, now)) {
+            bridgePublishSample(&sample.data);
+            sensors_count++;
+        }
+
+        bridgeUpdateOutput();
+
+        vTaskDelay(1);
+    }
+}
+
+static void bridgePublishSample(const struct simbridge_sample *sample)
+{
+    if (sample->valid & SIMBRIDGE_ACCEL) {
+        AccelSensorData accelSensorData; // Skip get as we set all the fields
+        accelSensorData.x = sample->accel[0];
+        accelSensorData.y = sample->accel[1];
+        accelSensorData.z = sample->accel[2];
+        accelSensorData.temperature = sample->temperature;
+        AccelSensorSet(&accelSensorData);
+    }
+
+    if (sample->valid & SIMBRIDGE_GYRO) {
+        GyroSensorData gyroSensorData; // Skip get as we set all the fields
+        gyroSensorData.x = sample->gyro[0];
+        gyroSensorData.y = sample->gyro[1];
+        gyroSensorData.z = sample->gyro[2];
+        gyroSensorData.temperature = sample->temperature;
+        gyroSensorData.SensorReadTimestamp = PIOS_DELAY_GetRaw();
+        GyroSensorSet(&gyroSensorData);
+    }
+
+    if (sample->valid & SIMBRIDGE_MAG) {
+        MagSensorData mag; // Skip get as we set all the fields
+        mag.x = sample->mag[0];
+        mag.y = sample->mag[1];
+        mag.z = sample->mag[2];
+        mag.temperature = sample->temperature;
+        MagSensorSet(&mag);
+    }
+
+    if (sample->valid & SIMBRIDGE_BARO) {
+        BaroSensorData baroSensor; // Skip get as we set all the fields
+        baroSensor.Altitude    = sample->baro_altitude;
+        baroSensor.Temperature = sample->temperature;
+        // kPa, standard atmosphere
+        baroSensor.Pressure    = 101.325f * powf(1.0f - 2.25577e-5f * sample->baro_altitude, 5.25588f);
+        BaroSensorSet(&baroSensor);
+    }
+
+    if (sample->valid & SIMBRIDGE_AIRSPEED) {
+        AirspeedSensorData airspeedSensor;
+        AirspeedSensorGet(&airspeedSensor);
+        airspeedSensor.SensorConnected    = AIRSPEEDSENSOR_SENSORCONNECTED_TRUE;
+        airspeedSensor.CalibratedAirspeed = sample->airspeed;
+        airspeedSensor.TrueAirspeed = sample->airspeed;
+        AirspeedSensorSet(&airspeedSensor);
+    }
+
+    if (sample->valid & SIMBRIDGE_GPS) {
+        GPSPositionSensorData gpsPosition;
+        GPSPositionSensorGet(&gpsPosition);
+        gpsPosition.Status      = GPSPOSITIONSENSOR_STATUS_FIX3D;
+        gpsPosition.Latitude    = sample->latitude;
+        gpsPosition.Longitude   = sample->longitude;
+        gpsPosition.Altitude    = sample->altitude;
+        gpsPosition.Groundspeed = sqrtf(sample->velocity[0] * sample->velocity[0] + sample->velocity[1] * sample->velocity[1]);
+        gpsPosition.Heading     = 180 / M_PI * atan2f(sample->velocity[1], sample->velocity[0]);
+        gpsPosition.Satellites  = 7;
+        gpsPosition.PDOP = 1;
+        gpsPosition.HDOP = 1;
+        gpsPosition.VDOP = 1;
+        GPSPositionSensorSet(&gpsPosition);
+
+        GPSVelocitySensorData gpsVelocity;
+        gpsVelocity.North = sample->velocity[0];
+        gpsVelocity.East  = sample->velocity[1];
+        gpsVelocity.Down  = sample->velocity[2];
+        GPSVelocitySensorSet(&gpsVelocity);
+    }
+}
+
+static void bridgeUpdateOutput()
+{
+    struct simbridge_output output;
+    FlightStatusData flightStatus;
+    ActuatorDesiredData actuatorDesired;
+    ActuatorCommandData actuatorCommand;
+
+    FlightStatusGet(&flightStatus);
+    ActuatorDesiredGet(&actuatorDesired);
+    ActuatorCommandGet(&actuatorCommand);
+
+    output.armed      = (flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED);
+    output.desired[0] = actuatorDesired.Roll;
+    output.desired[1] = actuatorDesired.Pitch;
+    output.desired[2] = actuatorDesired.Yaw;
+    output.desired[3] = actuatorDesired.Thrust;
+    for (int i = 0; i < SIMBRIDGE_MAX_CHANNELS; i++) {
+        output.channel[i] = (i < ACTUATORCOMMAND_CHANNEL_NUMELEM) ? actuatorCommand.Channel[i] : 0;
+    }
+
+    PIOS_SIMBRIDGE_SetOutput(&output);
+}
+#endif /* PIOS_INCLUDE_SIMBRIDGE */
+
 static float rand_gauss(void)
 {
     float v1, v2, s;
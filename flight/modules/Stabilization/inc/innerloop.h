@@ -33,6 +33,28 @@
 #ifndef INNERLOOP_H
 #define INNERLOOP_H
 
+#include <fifo_buffer.h>
+
+// one inner loop iteration, as seen by the AutoTune system identification
+typedef struct {
+    float    y[3];                       /* Filtered gyro, the one the PIDs act on */
+    float    u[3];                       /* Actuator desired of the previous iteration */
+    float    throttle;                   /* Throttle desired */
+    uint32_t gyroStateCallbackTimestamp; /* PIOS_DELAY_GetRaw() time of GyroState callback */
+    uint32_t sensorReadTimestamp;        /* PIOS_DELAY_GetRaw() time of sensor read */
+} StabilizationInnerloopSample;
+
+typedef struct {
+    t_fifo_buffer fifo;        /* whole StabilizationInnerloopSample only, the inner loop is the producer */
+    volatile uint32_t spilled; /* samples dropped because the fifo was full, written by the inner loop only */
+} StabilizationInnerloopCapture;
+
 void stabilizationInnerloopInit();
 
+/**
+ * Start copying each inner loop iteration into capture, NULL stops it.
+ * The consumer may only read the fifo and must not change capture until it is stopped.
+ */
+void stabilizationInnerloopSetCapture(StabilizationInnerloopCapture *capture);
+
 #endif /* INNERLOOP_H */
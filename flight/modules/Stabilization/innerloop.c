@@ -48,6 +48,7 @@
 #include <actuatordesired.h>
 
 #include <stabilization.h>
+#include <innerloop.h>
 #include <virtualflybar.h>
 #include <cruisecontrol.h>
 #include <sanitycheck.h>
@@ -86,10 +87,15 @@ static bool measuredDterm_enabled;
 #if !defined(PIOS_EXCLUDE_ADVANCED_FEATURES)
 static uint32_t systemIdentTimeVal = 0;
 #endif /* !defined(PIOS_EXCLUDE_ADVANCED_FEATURES) */
+static StabilizationInnerloopCapture *volatile capture;
+static uint32_t gyroCallbackTimestamp;
+static uint32_t gyroSensorReadTimestamp;
+static bool gyroSampleNew;
 
 // Private functions
 static void stabilizationInnerloopTask();
 static void GyroStateUpdatedCb(__attribute__((unused)) UAVObjEvent *ev);
+static void captureSample(const ActuatorDesiredData *actuator);
 #ifdef REVOLUTION
 static void AirSpeedUpdatedCb(__attribute__((unused)) UAVObjEvent *ev);
 #endif
@@ -262,6 +268,11 @@ static void stabilizationInnerloopTask()
 
     RateDesiredGet(&rateDesired);
     ActuatorDesiredGet(&actuator);
+    if (gyroSampleNew) {
+        // skip the failsafe runs, they have no new gyro sample
+        gyroSampleNew = false;
+        captureSample(&actuator);
+    }
     StabilizationStatusInnerLoopGet(&enabled);
     FlightStatusControlChainGet(&cchain);
     float *rate = &rateDesired.Roll;
@@ -463,15 +474,49 @@ static void stabilizationInnerloopTask()
 }
 
 
+void stabilizationInnerloopSetCapture(StabilizationInnerloopCapture *newCapture)
+{
+    capture = newCapture;
+}
+
+/**
+ * Copy the gyro the PIDs are about to act on and the actuator desired
+ * it follows to the capture fifo, lock free since the inner loop is the
+ * only producer
+ */
+static void captureSample(const ActuatorDesiredData *actuator)
+{
+    StabilizationInnerloopCapture *c = capture;
+
+    if (!c) {
+        return;
+    }
+    if (fifoBuf_getFree(&c->fifo) < sizeof(StabilizationInnerloopSample)) {
+        c->spilled++;
+        return;
+    }
+    StabilizationInnerloopSample sample = {
+        .y        = { gyro_filtered[0], gyro_filtered[1], gyro_filtered[2] },
+        .u        = { actuator->Roll, actuator->Pitch, actuator->Yaw },
+        .throttle = actuator->Thrust,
+        .gyroStateCallbackTimestamp = gyroCallbackTimestamp,
+        .sensorReadTimestamp        = gyroSensorReadTimestamp,
+    };
+    fifoBuf_putData(&c->fifo, &sample, sizeof(sample));
+}
+
 static void GyroStateUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
 {
     GyroStateData gyroState;
 
+    gyroCallbackTimestamp = PIOS_DELAY_GetRaw();
     GyroStateGet(&gyroState);
 
     gyro_filtered[0] = gyro_filtered[0] * stabSettings.gyro_alpha + gyroState.x * (1 - stabSettings.gyro_alpha);
     gyro_filtered[1] = gyro_filtered[1] * stabSettings.gyro_alpha + gyroState.y * (1 - stabSettings.gyro_alpha);
     gyro_filtered[2] = gyro_filtered[2] * stabSettings.gyro_alpha + gyroState.z * (1 - stabSettings.gyro_alpha);
+    gyroSensorReadTimestamp = gyroState.SensorReadTimestamp;
+    gyroSampleNew = true;
 
     PIOS_CALLBACKSCHEDULER_Dispatch(callbackHandle);
     stabSettings.monitor.gyroupdates++;
@@ -101,6 +101,11 @@
 // Private variables
 static xTaskHandle systemTaskHandle;
 static xQueueHandle objectPersistenceQueue;
+// Objects staged by the GCS for a batched save
+static UAVObjHandle stagedObjs[UAVOBJ_MAX_SAVE_MULTIPLE];
+static uint16_t stagedInstIds[UAVOBJ_MAX_SAVE_MULTIPLE];
+static uint8_t numStaged;
+static bool stagingFailed;
 static enum { STACKOVERFLOW_NONE = 0, STACKOVERFLOW_WARNING = 1, STACKOVERFLOW_CRITICAL = 3 } stackOverflow;
 static bool mallocFailed;
 static HwSettingsData bootHwSettings;
@@ -110,6 +115,7 @@ volatile int initTaskDone = 0;
 
 // Private functions
 static void objectUpdatedCb(UAVObjEvent *ev);
+static void objectPersistenceStageCb(UAVObjEvent *ev);
 static void checkSettingsUpdatedCb(UAVObjEvent *ev);
 #ifdef DIAG_TASKS
 static void taskMonitorForEachCallback(uint16_t task_id, const struct pios_task_info *task_info, void *context);
@@ -215,6 +221,11 @@ static void systemTask(__attribute__((unused)) void *parameters)
     // Register task
     PIOS_TASK_MONITOR_RegisterTask(TASKINFO_RUNNING_SYSTEM, systemTaskHandle);
 
+#ifdef PIOS_INCLUDE_DEBUGLOG
+    // all modules are up, log what their objects, events and callbacks took from the heap
+    pios_mem_report(PIOS_DEBUGLOG_Printf);
+#endif
+
     if (mallocFailed) {
         /* We failed to malloc during task creation,
          * system behaviour is undefined.  Reset and let
@@ -228,6 +239,8 @@ static void systemTask(__attribute__((unused)) void *parameters)
 #endif
     // Listen for SettingPersistance object updates, connect a callback function
     ObjectPersistenceConnectQueue(objectPersistenceQueue);
+    // Staging requests come back to back, record them in the context of the telemetry task
+    UAVObjConnectCallback(ObjectPersistenceHandle(), objectPersistenceStageCb, EV_MASK_ALL_UPDATES, true);
 
     // Load a copy of HwSetting active at boot time
     HwSettingsGet(&bootHwSettings);
@@ -373,6 +386,10 @@ static void objectUpdatedCb(UAVObjEvent *ev)
         if (objper.Operation == OBJECTPERSISTENCE_OPERATION_ERROR || objper.Operation == OBJECTPERSISTENCE_OPERATION_COMPLETED) {
             return;
         }
+        // Staged by objectPersistenceStageCb already
+        if (objper.Operation == OBJECTPERSISTENCE_OPERATION_STAGE) {
+            return;
+        }
 
         // Execute action if disarmed
         if (flightStatus.Armed != FLIGHTSTATUS_ARMED_DISARMED) {
@@ -412,6 +429,13 @@ static void objectUpdatedCb(UAVObjEvent *ev)
                 retval = UAVObjSaveSettings();
             } else if (objper.Selection == OBJECTPERSISTENCE_SELECTION_ALLMETAOBJECTS || objper.Selection == OBJECTPERSISTENCE_SELECTION_ALLOBJECTS) {
                 retval = UAVObjSaveMetaobjects();
+            } else if (objper.Selection == OBJECTPERSISTENCE_SELECTION_STAGEDOBJECTS) {
+                // The GCS tells how many objects it staged, a lost staging request fails the batch
+                if (stagingFailed || objper.InstanceID != numStaged) {
+                    retval = -1;
+                } else {
+                    retval = UAVObjSaveMultiple(stagedObjs, stagedInstIds, numStaged);
+                }
             }
         } else if (objper.Operation == OBJECTPERSISTENCE_OPERATION_DELETE) {
             if (objper.Selection == OBJECTPERSISTENCE_SELECTION_SINGLEOBJECT) {
@@ -434,6 +458,12 @@ static void objectUpdatedCb(UAVObjEvent *ev)
             retval = -1;
 #endif
         }
+        if (objper.Selection == OBJECTPERSISTENCE_SELECTION_STAGEDOBJECTS) {
+            // Start over with the next batch
+            numStaged     = 0;
+            stagingFailed = false;
+        }
+
         switch (retval) {
         case 0:
             objper.Operation = OBJECTPERSISTENCE_OPERATION_COMPLETED;
@@ -449,6 +479,37 @@ static void objectUpdatedCb(UAVObjEvent *ev)
     }
 }
 
+/**
+ * Add an object to the batch of staged objects. Called in the context of the
+ * task unpacking ObjectPersistence, before the update is acknowledged, so the
+ * GCS can send the next request as soon as it gets the ack.
+ */
+static void objectPersistenceStageCb(__attribute__((unused)) UAVObjEvent *ev)
+{
+    ObjectPersistenceData objper;
+
+    ObjectPersistenceGet(&objper);
+    if (objper.Operation != OBJECTPERSISTENCE_OPERATION_STAGE) {
+        return;
+    }
+
+    UAVObjHandle obj = UAVObjGetByID(objper.ObjectID);
+    if (objper.Selection != OBJECTPERSISTENCE_SELECTION_SINGLEOBJECT || obj == 0 || numStaged >= UAVOBJ_MAX_SAVE_MULTIPLE) {
+        stagingFailed = true;
+        return;
+    }
+
+    for (uint8_t i = 0; i < numStaged; i++) {
+        if (stagedObjs[i] == obj && stagedInstIds[i] == objper.InstanceID) {
+            // Staged twice, e.g. on a retransmission
+            return;
+        }
+    }
+    stagedObjs[numStaged]    = obj;
+    stagedInstIds[numStaged] = objper.InstanceID;
+    numStaged++;
+}
+
 /**
  * Called whenever hardware settings changed
  */
@@ -754,6 +815,9 @@ static void updateSystemAlarms()
 void vApplicationIdleHook(void)
 {
     PIOS_TASK_MONITOR_IdleHook();
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+    PIOS_SIMCLOCK_IdleHook();
+#endif
     NotificationOnboardLedsRun();
 #ifdef PIOS_INCLUDE_WS2811
     LedNotificationExtLedsRun();
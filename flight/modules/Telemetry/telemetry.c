@@ -66,6 +66,7 @@
 
 #include "flighttelemetrystats.h"
 #include "gcstelemetrystats.h"
+#include "objectdigest.h"
 #include "hwsettings.h"
 #include "taskinfo.h"
 
@@ -143,6 +144,11 @@ static uint32_t txErrors;
 static uint32_t txRetries;
 static uint32_t timeOfLastObjectUpdate;
 
+// Settings digests, built when a GCS connects and kept current on settings updates
+static ObjectDigestData digest;
+static uint16_t digestInstance;
+static uint8_t digestEntry;
+
 static void telemetryTxTask(void *parameters);
 static void telemetryRxTask(void *parameters);
 static void updateObject(
@@ -162,6 +168,11 @@ static int32_t setLoggingPeriod(
     int32_t updatePeriodMs);
 static void updateTelemetryStats();
 static void gcsTelemetryStatsUpdated();
+static void updateObjectDigests();
+static bool hasObjectDigest(UAVObjHandle obj);
+static void addObjectDigest(UAVObjHandle obj);
+static void flushObjectDigest();
+static void updateObjectDigest(UAVObjHandle obj);
 
 /**
  * Initialise the telemetry module
@@ -284,6 +295,7 @@ int32_t TelemetryInitialize(void)
 
     FlightTelemetryStatsInitialize();
     GCSTelemetryStatsInitialize();
+    ObjectDigestInitialize();
 
     // Initialize vars
     timeOfLastObjectUpdate = 0;
@@ -468,6 +480,11 @@ static void updateObject(
         break;
     }
 
+    // Keep the digest of the settings current, also for updates from the GCS
+    if (hasObjectDigest(obj)) {
+        eventMask |= EV_UPDATED | EV_UNPACKED;
+    }
+
     // note that all setting objects have implicitly IsPriority=true
 #ifdef PIOS_TELEM_PRIORITY_QUEUE
     if (UAVObjIsPriority(obj)) {
@@ -495,7 +512,15 @@ static void processObjEvent(
         updateTelemetryStats();
     } else if (ev->obj == GCSTelemetryStatsHandle()) {
         gcsTelemetryStatsUpdated();
+    } else if (ev->event == EV_UNPACKED) {
+        // Only connected for the digest
+        updateObjectDigest(ev->obj);
+        return;
     } else {
+        if (ev->event == EV_UPDATED && hasObjectDigest(ev->obj)) {
+            updateObjectDigest(ev->obj);
+        }
+
         // Get object metadata
         UAVObjGetMetadata(ev->obj, &metadata);
         updateMode = UAVObjGetTelemetryUpdateMode(&metadata);
@@ -563,14 +588,8 @@ static void processObjEvent(
         if ((ev->event == EV_UPDATED && (updateMode == UPDATEMODE_ONCHANGE || updateMode == UPDATEMODE_THROTTLED))
             || ev->event == EV_LOGGING_MANUAL
             || (ev->event == EV_LOGGING_PERIODIC && updateMode != UPDATEMODE_THROTTLED)) {
-            if (ev->instId == UAVOBJ_ALL_INSTANCES) {
-                success = UAVObjGetNumInstances(ev->obj);
-                for (retries = 0; retries < success; retries++) {
-                    UAVObjInstanceWriteToLog(ev->obj, retries);
-                }
-            } else {
-                UAVObjInstanceWriteToLog(ev->obj, ev->instId);
-            }
+            // takes UAVOBJ_ALL_INSTANCES as well
+            UAVObjInstanceWriteToLog(ev->obj, ev->instId);
         }
         if (updateMode == UPDATEMODE_THROTTLED) {
             // If this is UPDATEMODE_THROTTLED, the event mask changes on every event.
@@ -644,13 +663,17 @@ static void telemetryRxTask(void *parameters)
         uint32_t inputPort = channel->getPort();
 
         if (inputPort) {
-            // Block until data are available
-            uint8_t serial_data[16];
+            // Block until data are available, then parse them in place
+            uint8_t *serial_data;
             uint16_t bytes_to_process;
 
-            bytes_to_process = PIOS_COM_ReceiveBuffer(inputPort, serial_data, sizeof(serial_data), 500);
+            bytes_to_process = PIOS_COM_ReceiveAcquire(inputPort, &serial_data, 500);
             if (bytes_to_process > 0) {
+                if (bytes_to_process > UINT8_MAX) {
+                    bytes_to_process = UINT8_MAX;
+                }
                 UAVTalkProcessInputStream(channel->uavTalkCon, serial_data, bytes_to_process);
+                PIOS_COM_ReceiveCommit(inputPort, bytes_to_process);
             }
         } else {
             vTaskDelay(5);
@@ -882,6 +905,8 @@ static void updateTelemetryStats()
         // Wait for connection request
         if (gcsStats.Status == GCSTELEMETRYSTATS_STATUS_HANDSHAKEREQ) {
             flightStats.Status = FLIGHTTELEMETRYSTATS_STATUS_HANDSHAKEACK;
+            // The GCS requests the digests once connected
+            updateObjectDigests();
         }
     } else if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_HANDSHAKEACK) {
         // Wait for connection
@@ -915,6 +940,82 @@ static void updateTelemetryStats()
     }
 }
 
+/**
+ * Store the CRC32 of every single instance settings object in the ObjectDigest
+ * instances, 16 objects per instance. Instances are created as needed.
+ */
+static void updateObjectDigests()
+{
+    memset(&digest, 0, sizeof(digest));
+    digestInstance = 0;
+    digestEntry    = 0;
+
+    UAVObjIterate(&addObjectDigest);
+
+    if (digestEntry > 0) {
+        flushObjectDigest();
+    }
+}
+
+static bool hasObjectDigest(UAVObjHandle obj)
+{
+    return !UAVObjIsMetaobject(obj) && UAVObjIsSettings(obj) && UAVObjIsSingleInstance(obj);
+}
+
+static void addObjectDigest(UAVObjHandle obj)
+{
+    if (!hasObjectDigest(obj)) {
+        return;
+    }
+
+    digest.ObjectID[digestEntry] = UAVObjGetID(obj);
+    digest.Digest[digestEntry]   = UAVObjUpdateCRC32(obj, 0, 0);
+
+    if (++digestEntry == OBJECTDIGEST_OBJECTID_NUMELEM) {
+        flushObjectDigest();
+    }
+}
+
+static void flushObjectDigest()
+{
+    if (digestInstance >= UAVObjGetNumInstances(ObjectDigestHandle())) {
+        if (ObjectDigestCreateInstance() != digestInstance) {
+            // Out of memory, the GCS requests the objects not listed
+            digestEntry = 0;
+            return;
+        }
+    }
+
+    ObjectDigestInstSet(digestInstance, &digest);
+
+    memset(&digest, 0, sizeof(digest));
+    digestInstance++;
+    digestEntry = 0;
+}
+
+/**
+ * Refresh the digest of one settings object after it changed. Objects not
+ * listed yet are added by the next updateObjectDigests(). The entries are
+ * accessed one at a time, the telemetry stacks are too small for a copy.
+ */
+static void updateObjectDigest(UAVObjHandle obj)
+{
+    uint32_t objId = UAVObjGetID(obj);
+    uint16_t numInstances = UAVObjGetNumInstances(ObjectDigestHandle());
+
+    for (uint16_t instId = 0; instId < numInstances; instId++) {
+        for (uint8_t n = 0; n < OBJECTDIGEST_OBJECTID_NUMELEM; n++) {
+            uint32_t id;
+            UAVObjGetInstanceDataField(ObjectDigestHandle(), instId, &id, offsetof(ObjectDigestData, ObjectID[n]), sizeof(id));
+            if (id == objId) {
+                uint32_t crc = UAVObjUpdateCRC32(obj, 0, 0);
+                UAVObjSetInstanceDataField(ObjectDigestHandle(), instId, &crc, offsetof(ObjectDigestData, Digest[n]), sizeof(crc));
+                return;
+            }
+        }
+    }
+}
+
 /**
  * Update the telemetry settings, called on startup.
  * FIXME: This should be in the TelemetrySettings object. But objects
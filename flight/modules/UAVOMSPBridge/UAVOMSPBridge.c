@@ -65,6 +65,7 @@
 #include "stabilizationsettingsbank3.h"
 #include "magstate.h"
 #include "objectpersistence.h"
+#include "telemetrybridge.h"
 
 #include "pios_sensors.h"
 
@@ -227,8 +228,35 @@ static const char msp_pidnames[] = "ROLL;"
 #define MSP_ANALOG_VOLTAGE (1 << 0)
 #define MSP_ANALOG_CURRENT (1 << 1)
 
+#define MSP_FRAME_HEADER   5 // $M> size cmd
+#define MSP_MAX_PAYLOAD    64
+#define MSP_MAX_CACHED     16 // largest cached reply payload, MSP_RAW_GPS
+
+// Replies to these requests are cached and sent again unchanged until one of
+// the objects they are built from is updated, OSDs poll them at a high rate.
+enum {
+    MSP_STREAM_ATTITUDE,
+    MSP_STREAM_STATUS,
+    MSP_STREAM_ANALOG,
+    MSP_STREAM_RAW_GPS,
+    MSP_STREAM_COMP_GPS,
+    MSP_STREAM_ALTITUDE,
+    MSP_STREAM_COUNT
+};
+
+// all streams are polled, rate 0
+static const struct telemetrybridge_stream msp_streams[MSP_STREAM_COUNT] = { { 0 } };
+
+#define MSP_MAX_WATCHES 16
+
+struct msp_reply {
+    uint8_t len; // 0 if not valid
+    uint8_t frame[MSP_FRAME_HEADER + MSP_MAX_CACHED + 1];
+};
+
 struct msp_bridge {
     uintptr_t    com;
+    struct telemetrybridge *bridge;
 
     uint8_t      sensors;
     uint8_t      analog;
@@ -245,6 +273,10 @@ struct msp_bridge {
         // Specific packed data structures go here.
         msp_pid_t piditems[PID_ITEM_COUNT];
     } cmd_data;
+
+    struct msp_reply *reply; // reply being built is stored here
+    struct msp_reply replies[MSP_STREAM_COUNT];
+    uint8_t tx[MSP_FRAME_HEADER + MSP_MAX_PAYLOAD + 1];
 };
 
 #if defined(PIOS_MSP_STACK_SIZE)
@@ -262,11 +294,14 @@ static bool module_enabled = false;
 static struct msp_bridge *msp;
 static int32_t uavoMSPBridgeInitialize(void);
 static void uavoMSPBridgeTask(void *parameters);
+static void msp_watch_objects(struct msp_bridge *m);
 
 static void msp_send(struct msp_bridge *m, uint8_t cmd, const uint8_t *data, size_t len)
 {
-    uint8_t buf[5];
-    uint8_t cs = (uint8_t)(len) ^ cmd;
+    uint8_t *buf = m->tx;
+    uint8_t cs   = (uint8_t)(len) ^ cmd;
+
+    PIOS_Assert(len <= MSP_MAX_PAYLOAD);
 
     buf[0] = '$';
     buf[1] = 'M';
@@ -274,20 +309,36 @@ static void msp_send(struct msp_bridge *m, uint8_t cmd, const uint8_t *data, siz
     buf[3] = (uint8_t)(len);
     buf[4] = cmd;
 
-    PIOS_COM_SendBuffer(m->com, buf, sizeof(buf));
+    for (unsigned i = 0; i < len; i++) {
+        buf[MSP_FRAME_HEADER + i] = data[i];
+        cs ^= data[i];
+    }
+
+    buf[MSP_FRAME_HEADER + len] = cs;
 
-    if (len > 0) {
-        PIOS_COM_SendBuffer(m->com, data, len);
+    // One frame, queued without blocking. If the port is busy the reply is
+    // dropped, the OSD simply asks again.
+    TelemetryBridgeSend(m->bridge, buf, MSP_FRAME_HEADER + len + 1);
 
-        for (unsigned i = 0; i < len; i++) {
-            cs ^= data[i];
-        }
+    if (m->reply && len <= MSP_MAX_CACHED) {
+        memcpy(m->reply->frame, buf, MSP_FRAME_HEADER + len + 1);
+        m->reply->len = MSP_FRAME_HEADER + len + 1;
     }
+}
+
+static void msp_send_cached(struct msp_bridge *m, uint8_t stream, void (*send)(struct msp_bridge *))
+{
+    struct msp_reply *reply = &m->replies[stream];
 
-    cs    ^= 0;
+    if (reply->len && !TelemetryBridgeChanged(m->bridge, stream)) {
+        TelemetryBridgeSend(m->bridge, reply->frame, reply->len);
+        return;
+    }
 
-    buf[0] = cs;
-    PIOS_COM_SendBuffer(m->com, buf, 1);
+    reply->len = 0;
+    m->reply   = reply;
+    send(m);
+    m->reply   = NULL;
 }
 
 static msp_state msp_state_size(struct msp_bridge *m, uint8_t b)
@@ -843,24 +894,24 @@ static msp_state msp_state_checksum(struct msp_bridge *m, uint8_t b)
     // Respond to interesting things.
     switch (m->cmd_id) {
     case MSP_RAW_GPS:
-        msp_send_raw_gps(m);
+        msp_send_cached(m, MSP_STREAM_RAW_GPS, msp_send_raw_gps);
         break;
 #ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
     case MSP_COMP_GPS:
-        msp_send_comp_gps(m);
+        msp_send_cached(m, MSP_STREAM_COMP_GPS, msp_send_comp_gps);
         break;
     case MSP_ALTITUDE:
-        msp_send_altitude(m);
+        msp_send_cached(m, MSP_STREAM_ALTITUDE, msp_send_altitude);
         break;
 #endif /* PIOS_EXCLUDE_ADVANCED_FEATURES */
     case MSP_ATTITUDE:
-        msp_send_attitude(m);
+        msp_send_cached(m, MSP_STREAM_ATTITUDE, msp_send_attitude);
         break;
     case MSP_STATUS:
-        msp_send_status(m);
+        msp_send_cached(m, MSP_STREAM_STATUS, msp_send_status);
         break;
     case MSP_ANALOG:
-        msp_send_analog(m);
+        msp_send_cached(m, MSP_STREAM_ANALOG, msp_send_analog);
         break;
     case MSP_RC:
         msp_send_channels(m);
@@ -993,6 +1044,8 @@ static int32_t uavoMSPBridgeStart(void)
         return -1;
     }
 
+    msp_watch_objects(msp);
+
     xTaskHandle taskHandle;
 
     xTaskCreate(uavoMSPBridgeTask, "uavoMSPBridge", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &taskHandle);
@@ -1001,6 +1054,36 @@ static int32_t uavoMSPBridgeStart(void)
     return 0;
 }
 
+static void msp_watch_objects(struct msp_bridge *m)
+{
+    // Optional objects that are not present have a NULL handle and are skipped
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ATTITUDE, AttitudeStateHandle());
+
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_STATUS, FlightStatusHandle());
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_STATUS, StabilizationDesiredHandle());
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_STATUS, GPSPositionSensorHandle());
+#ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_STATUS, MagStateHandle());
+
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ANALOG, FlightBatteryStateHandle());
+#endif /* PIOS_EXCLUDE_ADVANCED_FEATURES */
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ANALOG, ManualControlSettingsHandle());
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ANALOG, ReceiverStatusHandle());
+#ifdef PIOS_INCLUDE_OPLINKRCVR
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ANALOG, OPLinkStatusHandle());
+#endif /* PIOS_INCLUDE_OPLINKRCVR */
+
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_RAW_GPS, GPSPositionSensorHandle());
+
+#ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_COMP_GPS, TakeOffLocationHandle());
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_COMP_GPS, PositionStateHandle());
+
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ALTITUDE, PositionStateHandle());
+    TelemetryBridgeWatch(m->bridge, MSP_STREAM_ALTITUDE, VelocityStateHandle());
+#endif /* PIOS_EXCLUDE_ADVANCED_FEATURES */
+}
+
 static uint32_t hwsettings_mspspeed_enum_to_baud(uint8_t baud)
 {
     switch (baud) {
@@ -1040,7 +1123,14 @@ static int32_t uavoMSPBridgeInitialize(void)
         if (msp != NULL) {
             memset(msp, 0x00, sizeof(*msp));
 
-            msp->com = pios_com_msp_id;
+            msp->com    = pios_com_msp_id;
+            // MSP replies to requests, the bridge is never ticked
+            msp->bridge = TelemetryBridgeCreate(pios_com_msp_id, 1, msp_streams, MSP_STREAM_COUNT, MSP_MAX_WATCHES);
+            if (!msp->bridge) {
+                pios_free(msp);
+                msp = NULL;
+                return -1;
+            }
 
             // now figure out enabled features: registered sensors, ADC routing, GPS
 
@@ -55,6 +55,7 @@
 #include "oplinkstatus.h"
 #include "receiverstatus.h"
 #include "manualcontrolsettings.h"
+#include "telemetrybridge.h"
 
 #include "custom_types.h"
 
@@ -81,46 +82,75 @@ static void uavoMavlinkBridgeTask(void *parameters);
 static void mavlink_send_extended_status();
 static void mavlink_send_rc_channels();
 static void mavlink_send_position();
+static void mavlink_send_home();
 static void mavlink_send_extra1();
 static void mavlink_send_extra2();
+static void mavlink_send_heartbeat();
+
+enum {
+    MAV_STREAM_EXTENDED_STATUS,
+    MAV_STREAM_RC_CHANNELS,
+    MAV_STREAM_POSITION,
+    MAV_STREAM_HOME,
+    MAV_STREAM_EXTRA1,
+    MAV_STREAM_EXTRA2,
+    MAV_STREAM_HEARTBEAT,
+};
 
-static const struct {
-    uint8_t rate;
-    void    (*handler)();
-} mav_rates[] = {
-    [MAV_DATA_STREAM_EXTENDED_STATUS] = {
-        .rate    = 2, // Hz
-        .handler = mavlink_send_extended_status,
+// Streams are only sent when one of their objects was updated, see mavlink_watch_objects().
+// keepalive makes sure a newly attached ground station or OSD gets every message eventually.
+static const struct telemetrybridge_stream mav_rates[] = {
+    [MAV_STREAM_EXTENDED_STATUS] = {
+        .rate      = 2, // Hz
+        .keepalive = 4,
+        .handler   = mavlink_send_extended_status,
+    },
+    [MAV_STREAM_RC_CHANNELS] =     {
+        .rate      = 5, // Hz
+        .keepalive = 5,
+        .handler   = mavlink_send_rc_channels,
     },
-    [MAV_DATA_STREAM_RC_CHANNELS] =     {
-        .rate    = 5, // Hz
-        .handler = mavlink_send_rc_channels,
+    [MAV_STREAM_POSITION] =        {
+        .rate      = 2, // Hz
+        .keepalive = 4,
+        .handler   = mavlink_send_position,
     },
-    [MAV_DATA_STREAM_POSITION] =        {
-        .rate    = 2, // Hz
-        .handler = mavlink_send_position,
+    [MAV_STREAM_HOME] =            {
+        .rate      = 1, // Hz
+        .keepalive = 5,
+        .handler   = mavlink_send_home,
     },
-    [MAV_DATA_STREAM_EXTRA1] =          {
-        .rate    = 10, // Hz
-        .handler = mavlink_send_extra1,
+    [MAV_STREAM_EXTRA1] =          {
+        .rate      = 10, // Hz
+        .keepalive = 10,
+        .handler   = mavlink_send_extra1,
     },
-    [MAV_DATA_STREAM_EXTRA2] =          {
-        .rate    = 2, // Hz
-        .handler = mavlink_send_extra2,
+    [MAV_STREAM_EXTRA2] =          {
+        .rate      = 2, // Hz
+        .keepalive = 4,
+        .handler   = mavlink_send_extra2,
+    },
+    [MAV_STREAM_HEARTBEAT] =       {
+        .rate      = 2, // Hz
+        .keepalive = 0, // always sent, ground stations use it for link loss detection
+        .handler   = mavlink_send_heartbeat,
     },
 };
 
 #define MAXSTREAMS NELEMENTS(mav_rates)
+#define MAXWATCHES 24
 
 // ****************
 // Private variables
 
 static bool module_enabled = false;
 
-static uint8_t *stream_ticks;
+static struct telemetrybridge *bridge;
 
 static mavlink_message_t *mav_msg;
 
+static void mavlink_watch_objects();
+
 static void updateSettings();
 
 /**
@@ -131,6 +161,9 @@ static void updateSettings();
 static int32_t uavoMavlinkBridgeStart(void)
 {
     if (module_enabled) {
+        // all modules have registered their objects by now
+        mavlink_watch_objects();
+
         // Start tasks
         xTaskHandle taskHandle;
         xTaskCreate(uavoMavlinkBridgeTask, "uavoMavlinkBridge", STACK_SIZE_BYTES / 4, NULL, TASK_PRIORITY, &taskHandle);
@@ -150,13 +183,9 @@ static int32_t uavoMavlinkBridgeInitialize(void)
         updateSettings();
 
         mav_msg = pios_malloc(sizeof(*mav_msg));
-        stream_ticks = pios_malloc(MAXSTREAMS);
-
-        if (mav_msg && stream_ticks) {
-            for (unsigned x = 0; x < MAXSTREAMS; ++x) {
-                stream_ticks[x] = (TASK_RATE_HZ / mav_rates[x].rate);
-            }
+        bridge  = TelemetryBridgeCreate(PIOS_COM_MAVLINK, TASK_RATE_HZ, mav_rates, MAXSTREAMS, MAXWATCHES);
 
+        if (mav_msg && bridge) {
             module_enabled = true;
         }
     }
@@ -165,25 +194,56 @@ static int32_t uavoMavlinkBridgeInitialize(void)
 }
 MODULE_INITCALL(uavoMavlinkBridgeInitialize, uavoMavlinkBridgeStart);
 
+static void mavlink_watch_objects()
+{
+    // Optional objects that are not present have a NULL handle and are skipped
+#ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTENDED_STATUS, FlightBatteryStateHandle());
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTENDED_STATUS, SystemStatsHandle());
+#endif
+
+    TelemetryBridgeWatch(bridge, MAV_STREAM_RC_CHANNELS, ManualControlCommandHandle());
+    TelemetryBridgeWatch(bridge, MAV_STREAM_RC_CHANNELS, ReceiverStatusHandle());
+#ifdef PIOS_INCLUDE_OPLINKRCVR
+    TelemetryBridgeWatch(bridge, MAV_STREAM_RC_CHANNELS, OPLinkStatusHandle());
+#endif
+
+    TelemetryBridgeWatch(bridge, MAV_STREAM_POSITION, GPSPositionSensorHandle());
+
+#ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
+    TelemetryBridgeWatch(bridge, MAV_STREAM_HOME, HomeLocationHandle());
+#endif
+
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTRA1, AttitudeStateHandle());
+
+#ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTRA2, AirspeedStateHandle());
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTRA2, PositionStateHandle());
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTRA2, VelocityStateHandle());
+#endif
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTRA2, AttitudeStateHandle());
+    TelemetryBridgeWatch(bridge, MAV_STREAM_EXTRA2, ActuatorDesiredHandle());
+}
+
 static void send_message()
 {
     uint16_t msg_length = MAVLINK_NUM_NON_PAYLOAD_BYTES +
                           mav_msg->len;
 
-    PIOS_COM_SendBuffer(PIOS_COM_MAVLINK, &mav_msg->magic, msg_length);
+    TelemetryBridgeSend(bridge, &mav_msg->magic, msg_length);
 }
 
 static void mavlink_send_extended_status()
 {
 #ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
     FlightBatteryStateData batState;
-    SystemStatsData systemStats;
+    uint8_t cpuLoad;
 
     if (FlightBatteryStateHandle() != NULL) {
         FlightBatteryStateGet(&batState);
     }
 
-    SystemStatsGet(&systemStats);
+    SystemStatsCPULoadGet(&cpuLoad);
 
     uint32_t battery_capacity = 0;
     if (FlightBatterySettingsHandle() != NULL) {
@@ -205,7 +265,7 @@ static void mavlink_send_extended_status()
                                 // onboard_control_sensors_health Bitmask showing which onboard controllers and sensors are operational or have an error:  Value of 0: not enabled. Value of 1: enabled. Indices: 0: 3D gyro, 1: 3D acc, 2: 3D mag, 3: absolute pressure, 4: differential pressure, 5: GPS, 6: optical flow, 7: computer vision position, 8: laser based position, 9: external ground-truth (Vicon or Leica). Controllers: 10: 3D angular rate control 11: attitude stabilization, 12: yaw position, 13: z/altitude control, 14: x/y position control, 15: motor outputs / control
                                 0,
                                 // load Maximum usage in percent of the mainloop time, (0%: 0, 100%: 1000) should be always below 1000
-                                (uint16_t)systemStats.CPULoad * 10,
+                                (uint16_t)cpuLoad * 10,
                                 // voltage_battery Battery voltage, in millivolts (1 = 1 millivolt)
                                 lroundf(batState.Voltage * 1000), // No need to check for validity, Voltage reads 0.0 when measurement is not configured,
                                 // current_battery Battery current, in 10*milliamperes (1 = 10 milliampere), -1: autopilot does not measure the current
@@ -231,13 +291,11 @@ static void mavlink_send_extended_status()
 
 static void mavlink_send_rc_channels()
 {
-    ManualControlCommandData manualState;
-    FlightStatusData flightStatus;
-    SystemStatsData systemStats;
+    uint16_t channels[MANUALCONTROLCOMMAND_CHANNEL_NUMELEM];
+    uint32_t flightTime;
 
-    ManualControlCommandGet(&manualState);
-    FlightStatusGet(&flightStatus);
-    SystemStatsGet(&systemStats);
+    ManualControlCommandChannelGet(channels);
+    SystemStatsFlightTimeGet(&flightTime);
 
     uint8_t mavlinkRssi;
 
@@ -269,25 +327,25 @@ static void mavlink_send_rc_channels()
 
     mavlink_msg_rc_channels_raw_pack(0, 200, mav_msg,
                                      // time_boot_ms Timestamp (milliseconds since system boot)
-                                     systemStats.FlightTime,
+                                     flightTime,
                                      // port Servo output port (set of 8 outputs = 1 port). Most MAVs will just use one, but this allows to encode more than 8 servos.
                                      0,
                                      // chan1_raw RC channel 1 value, in microseconds
-                                     manualState.Channel[0],
+                                     channels[0],
                                      // chan2_raw RC channel 2 value, in microseconds
-                                     manualState.Channel[1],
+                                     channels[1],
                                      // chan3_raw RC channel 3 value, in microseconds
-                                     manualState.Channel[2],
+                                     channels[2],
                                      // chan4_raw RC channel 4 value, in microseconds
-                                     manualState.Channel[3],
+                                     channels[3],
                                      // chan5_raw RC channel 5 value, in microseconds
-                                     manualState.Channel[4],
+                                     channels[4],
                                      // chan6_raw RC channel 6 value, in microseconds
-                                     manualState.Channel[5],
+                                     channels[5],
                                      // chan7_raw RC channel 7 value, in microseconds
-                                     manualState.Channel[6],
+                                     channels[6],
                                      // chan8_raw RC channel 8 value, in microseconds
-                                     manualState.Channel[7],
+                                     channels[7],
                                      // rssi Receive signal strength indicator, 0: 0%, 255: 100%
                                      mavlinkRssi);
 
@@ -296,9 +354,9 @@ static void mavlink_send_rc_channels()
 
 static void mavlink_send_position()
 {
-    SystemStatsData systemStats;
+    uint32_t flightTime;
 
-    SystemStatsGet(&systemStats);
+    SystemStatsFlightTimeGet(&flightTime);
 
     if (GPSPositionSensorHandle() != NULL) {
         GPSPositionSensorData gpsPosData;
@@ -323,7 +381,7 @@ static void mavlink_send_position()
 
         mavlink_msg_gps_raw_int_pack(0, 200, mav_msg,
                                      // time_usec Timestamp (microseconds since UNIX epoch or microseconds since system boot)
-                                     (uint64_t)systemStats.FlightTime * 1000,
+                                     (uint64_t)flightTime * 1000,
                                      // fix_type 0-1: no fix, 2: 2D fix, 3: 3D fix. Some applications will not use the value of this field unless it is at least two, so always correctly fill in the fix.
                                      gps_fix_type,
                                      // lat Latitude in 1E7 degrees
@@ -346,6 +404,19 @@ static void mavlink_send_position()
         send_message();
     }
 
+    // TODO add waypoint nav stuff
+    // wp_target_bearing
+    // wp_dist = mavlink_msg_nav_controller_output_get_wp_dist(&msg);
+    // alt_error = mavlink_msg_nav_controller_output_get_alt_error(&msg);
+    // aspd_error = mavlink_msg_nav_controller_output_get_aspd_error(&msg);
+    // xtrack_error = mavlink_msg_nav_controller_output_get_xtrack_error(&msg);
+    // mavlink_msg_nav_controller_output_pack
+    // wp_number
+    // mavlink_msg_mission_current_pack
+}
+
+static void mavlink_send_home()
+{
 #ifndef PIOS_EXCLUDE_ADVANCED_FEATURES
     if (HomeLocationHandle() != NULL) {
         HomeLocationData homeLocation;
@@ -362,29 +433,19 @@ static void mavlink_send_position()
         send_message();
     }
 #endif /* PIOS_EXCLUDE_ADVANCED_FEATURES */
-
-    // TODO add waypoint nav stuff
-    // wp_target_bearing
-    // wp_dist = mavlink_msg_nav_controller_output_get_wp_dist(&msg);
-    // alt_error = mavlink_msg_nav_controller_output_get_alt_error(&msg);
-    // aspd_error = mavlink_msg_nav_controller_output_get_aspd_error(&msg);
-    // xtrack_error = mavlink_msg_nav_controller_output_get_xtrack_error(&msg);
-    // mavlink_msg_nav_controller_output_pack
-    // wp_number
-    // mavlink_msg_mission_current_pack
 }
 
 static void mavlink_send_extra1()
 {
     AttitudeStateData attState;
-    SystemStatsData systemStats;
+    uint32_t flightTime;
 
     AttitudeStateGet(&attState);
-    SystemStatsGet(&systemStats);
+    SystemStatsFlightTimeGet(&flightTime);
 
     mavlink_msg_attitude_pack(0, 200, mav_msg,
                               // time_boot_ms Timestamp (milliseconds since system boot)
-                              systemStats.FlightTime,
+                              flightTime,
                               // roll Roll angle (rad)
                               DEG2RAD(attState.Roll),
                               // pitch Pitch angle (rad)
@@ -463,8 +524,12 @@ static void mavlink_send_extra2()
                              climbrate);
 
     send_message();
+}
 
+static void mavlink_send_heartbeat()
+{
     FlightStatusData flightStatus;
+
     FlightStatusGet(&flightStatus);
 
     StabilizationDesiredStabilizationModeData stabModeData;
@@ -562,24 +627,7 @@ static void uavoMavlinkBridgeTask(__attribute__((unused)) void *parameters)
     while (1) {
         vTaskDelayUntil(&lastSysTime, (1000 / TASK_RATE_HZ) / portTICK_RATE_MS);
 
-        for (unsigned i = 0; i < MAXSTREAMS; ++i) {
-            if (!mav_rates[i].rate || !mav_rates[i].handler) {
-                continue;
-            }
-
-            if (stream_ticks[i] == 0) {
-                // trigger now
-                uint8_t rate = mav_rates[i].rate;
-                if (rate > TASK_RATE_HZ) {
-                    rate = TASK_RATE_HZ;
-                }
-                stream_ticks[i] = TASK_RATE_HZ / rate;
-
-                mav_rates[i].handler();
-            }
-
-            --stream_ticks[i];
-        }
+        TelemetryBridgeTick(bridge);
     }
 }
 
@@ -85,6 +85,15 @@ Preemption is done by the main scheduler thread which attempts to run a tick
 handler at accurate intervals using nanosleep and gettimeofday, which allows
 more accurate high frequency ticks than a timer signal handler.
 
+With configUSE_VIRTUAL_TICK and vPortEnableVirtualTick() called before the
+scheduler starts, the ticks are not paced by the wall clock: the next tick is
+handled as soon as the running task is the idle task, or a task blocked
+outside of the scheduler (see vPortEnterExternalWait()), so simulated time
+runs as fast as the tasks get their work done. A task that never blocks gets
+one tick per real tick period, time never runs slower than real time.
+vApplicationVirtualTickWait() is called before each virtual tick and may
+block to hold time, for lockstep with an external simulator.
+
 All public functions in this port are protected by a safeguard mutex which
 assures priority access on all data objects
 
@@ -137,6 +146,7 @@ typedef struct THREAD_SUSPENSIONS
 	pthread_mutex_t threadSleepMutex;
 	pthread_cond_t threadSleepCond;
     volatile enum {THREAD_SLEEPING,THREAD_RUNNING,THREAD_STARTING,THREAD_YIELDING,THREAD_PREEMPTING,THREAD_WAKING} threadStatus;
+	volatile portBASE_TYPE xExternalWait;
 } xThreadState;
 /*-----------------------------------------------------------*/
 
@@ -160,6 +170,21 @@ static volatile portBASE_TYPE xPendYield = pdFALSE;
 static volatile portLONG lIndexOfLastAddedTask = 0;
 /*-----------------------------------------------------------*/
 
+#ifndef configUSE_VIRTUAL_TICK
+	#define configUSE_VIRTUAL_TICK 0
+#endif
+
+#if ( configUSE_VIRTUAL_TICK == 1 )
+/* real time between two checks of the tasks for the next virtual tick */
+#define portVIRTUAL_TICK_POLL_MICROSECONDS	20
+
+static volatile portBASE_TYPE xVirtualTick = pdFALSE;
+static volatile portTickType xVirtualTickCount = 0;
+
+static void prvVirtualTickLoop( void );
+#endif
+/*-----------------------------------------------------------*/
+
 /*
  * Setup the timer to generate the tick interrupts.
  */
@@ -172,6 +197,7 @@ static xThreadState* prvGetThreadHandleByThread( pthread_t hThread );
 static portLONG prvGetFreeThreadState( void );
 static void prvDeleteThread( void *xThreadId );
 static void prvPortYield();
+static portBASE_TYPE prvSystemTick( void );
 /*-----------------------------------------------------------*/
 
 /*
@@ -235,6 +261,7 @@ portSTACK_TYPE *pxPortInitialiseStack( portSTACK_TYPE *pxTopOfStack, pdTASK_CODE
 
 	pxThreads[ lIndexOfLastAddedTask ].threadStatus = THREAD_STARTING;
 	pxThreads[ lIndexOfLastAddedTask ].uxCriticalNesting = 0;
+	pxThreads[ lIndexOfLastAddedTask ].xExternalWait = pdFALSE;
 
 	/* create the thead */
 	PORT_ASSERT( 0 == pthread_create( &( pxThreads[ lIndexOfLastAddedTask ].hThread ), &xThreadAttributes, prvWaitForStart, (void *)pxThisThreadParams ) );
@@ -291,6 +318,12 @@ portBASE_TYPE xPortStartScheduler( void )
 	/* Start the first task. This gives up the RunningThreadMutex*/
 	vPortStartFirstTask();
 
+#if ( configUSE_VIRTUAL_TICK == 1 )
+	if ( pdTRUE == xVirtualTick ) {
+		prvVirtualTickLoop();
+	}
+#endif
+
 	/**
 	 * Main scheduling loop. Call the tick handler every
 	 * portTICK_RATE_MICROSECONDS
@@ -585,6 +618,15 @@ void vPortClearInterruptMask( portBASE_TYPE xMask )
  * the tick handler is just an ordinary function, called by the supervisor thread periodically
  */
 void vPortSystemTickHandler()
+{
+	(void)prvSystemTick();
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * returns pdFALSE when the tick could not be handled now and is left pending
+ */
+portBASE_TYPE prvSystemTick( void )
 {
 	/**
 	 * the problem with the tick handler is, that it runs outside of the schedulers domain - worse,
@@ -597,14 +639,14 @@ void vPortSystemTickHandler()
 	if ( prvGetThreadHandle(xTaskGetCurrentTaskHandle())->threadStatus!=THREAD_RUNNING ) {
 		xPendYield = pdTRUE;
 		PORT_UNLOCK( xGuardMutex );
-		return;
+		return pdFALSE;
 	}
 
 	/* interrupts MUST be enabled */
 	if ( xInterruptsEnabled != pdTRUE ) {
 		xPendYield = pdTRUE;
 		PORT_UNLOCK( xGuardMutex );
-		return;
+		return pdFALSE;
 	}
 
 	/* this should always be true, but it can't harm to check */
@@ -670,6 +712,7 @@ void vPortSystemTickHandler()
 
 	/* finish up */
 	PORT_UNLOCK( xGuardMutex );
+	return pdTRUE;
 }
 /*-----------------------------------------------------------*/
 
@@ -922,6 +965,7 @@ portLONG lIndex;
 		pxThreads[ lIndex ].hThread = ( pthread_t )NULL;
 		pxThreads[ lIndex ].hTask = ( xTaskHandle )NULL;
 		pxThreads[ lIndex ].uxCriticalNesting = 0;
+		pxThreads[ lIndex ].xExternalWait = pdFALSE;
 		pxThreads[ lIndex ].threadSleepMutex = minit;
 		pxThreads[ lIndex ].threadSleepCond = cinit;
 	}
@@ -1087,3 +1131,96 @@ struct tms xTimes;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_VIRTUAL_TICK == 1 )
+/**
+ * virtual time, must be selected before the scheduler is started
+ */
+void vPortEnableVirtualTick( void )
+{
+	PORT_ASSERT( pdFALSE == xSchedulerStarted );
+	xVirtualTick = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortIsVirtualTick( void )
+{
+	return xVirtualTick;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * ticks handled in virtual time, safe to call from any thread
+ */
+portTickType xPortGetVirtualTickCount( void )
+{
+	return xVirtualTickCount;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * marks the calling task as blocked in a system call (socket, file) rather
+ * than working, virtual time goes on while it waits
+ */
+void vPortEnterExternalWait( void )
+{
+xThreadState *pxThread = prvGetThreadHandleByThread( pthread_self() );
+	if ( pxThread ) pxThread->xExternalWait = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitExternalWait( void )
+{
+xThreadState *pxThread = prvGetThreadHandleByThread( pthread_self() );
+	if ( pxThread ) pxThread->xExternalWait = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * pdTRUE when the running task has nothing to do until the next tick
+ */
+static portBASE_TYPE prvTasksWaiting( void )
+{
+portBASE_TYPE xWaiting;
+xThreadState *pxThread;
+
+	PORT_LOCK( xGuardMutex );
+	pxThread = prvGetThreadHandle( xTaskGetCurrentTaskHandle() );
+	xWaiting = ( xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle() ) || ( pxThread && pdTRUE == pxThread->xExternalWait );
+	PORT_UNLOCK( xGuardMutex );
+	return xWaiting;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * supervisor loop in virtual time, replaces the wall clock paced loop
+ */
+static void prvVirtualTickLoop( void )
+{
+struct timeval xLastTick, xCurrentTime;
+struct timespec xPoll = { 0, 1000 * portVIRTUAL_TICK_POLL_MICROSECONDS };
+portLONG lElapsedTime;
+
+	gettimeofday( &xLastTick, NULL );
+	while ( pdTRUE != xSchedulerEnd )
+	{
+		gettimeofday( &xCurrentTime, NULL );
+		lElapsedTime = 1000000 * ( xCurrentTime.tv_sec - xLastTick.tv_sec ) + ( xCurrentTime.tv_usec - xLastTick.tv_usec );
+
+		if ( pdTRUE != prvTasksWaiting() && lElapsedTime < ( portLONG )portTICK_RATE_MICROSECONDS ) {
+			/* let the running task work */
+			nanosleep( &xPoll, NULL );
+			continue;
+		}
+
+		vApplicationVirtualTickWait();
+
+		/* retry until the running task can be preempted */
+		while ( pdTRUE != xSchedulerEnd && pdTRUE != prvSystemTick() ) {
+			nanosleep( &xPoll, NULL );
+		}
+		xVirtualTickCount++;
+		gettimeofday( &xLastTick, NULL );
+	}
+}
+#endif /* configUSE_VIRTUAL_TICK */
+/*-----------------------------------------------------------*/
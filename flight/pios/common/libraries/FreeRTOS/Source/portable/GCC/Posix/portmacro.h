@@ -161,6 +161,17 @@ extern void vPortAddTaskHandle( void *pxTaskHandle );
 /* Posix Signal definitions that can be changed or read as appropriate. */
 #define SIG_SUSPEND					SIGUSR1
 
+/* Virtual time, see port.c */
+#if ( configUSE_VIRTUAL_TICK == 1 )
+extern void vPortEnableVirtualTick( void );
+extern portBASE_TYPE xPortIsVirtualTick( void );
+extern TickType_t xPortGetVirtualTickCount( void );
+extern void vPortEnterExternalWait( void );
+extern void vPortExitExternalWait( void );
+/* provided by the application, called before each virtual tick, may block */
+extern void vApplicationVirtualTickWait( void );
+#endif
+
 /* Make use of times(man 2) to gather run-time statistics on the tasks. */
 extern void vPortFindTicksPerSecond( void );
 #undef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
@@ -32,10 +32,11 @@
 #include <taskinfo.h>
 
 // Private constants
-#define STACK_SAFETYCOUNT 16
-#define STACK_SIZE        (300 + STACK_SAFETYSIZE)
-#define STACK_SAFETYSIZE  8
-#define MAX_SLEEP         1000
+#define STACK_SAFETYCOUNT   16
+#define STACK_SIZE          (300 + STACK_SAFETYSIZE)
+#define STACK_SAFETYSIZE    8
+#define MAX_SLEEP           1000
+#define CALLBACK_POOL_BLOCK 8
 
 // Private types
 /**
@@ -75,6 +76,9 @@ struct DelayedCallbackInfoStruct {
 static struct DelayedCallbackTaskStruct *schedulerTasks;
 static xSemaphoreHandle mutex;
 static bool schedulerStarted;
+// the scheduler tasks walk their queues all the time, keep them in the fast heap
+static struct pios_mem_pool taskPool     = PIOS_MEM_POOL("callback tasks", struct DelayedCallbackTaskStruct, 2, true);
+static struct pios_mem_pool callbackPool = PIOS_MEM_POOL("callbacks", DelayedCallbackInfo, CALLBACK_POOL_BLOCK, true);
 
 // Private functions
 static void CallbackSchedulerTask(void *task);
@@ -273,7 +277,7 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
     // if given priorityTask does not exist, create it
     if (!task) {
         // allocate memory if possible
-        task = (struct DelayedCallbackTaskStruct *)pios_malloc(sizeof(struct DelayedCallbackTaskStruct));
+        task = (struct DelayedCallbackTaskStruct *)pios_mem_pool_alloc(&taskPool);
         if (!task) {
             xSemaphoreGiveRecursive(mutex);
             return NULL;
@@ -294,6 +298,7 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
         // create the signaling semaphore
         vSemaphoreCreateBinary(task->signal);
         if (!task->signal) {
+            pios_mem_pool_free(&taskPool, task);
             xSemaphoreGiveRecursive(mutex);
             return NULL;
         }
@@ -329,7 +334,7 @@ DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(
     }
 
     // initialize callback scheduling info
-    DelayedCallbackInfo *info = (DelayedCallbackInfo *)pios_malloc(sizeof(DelayedCallbackInfo));
+    DelayedCallbackInfo *info = (DelayedCallbackInfo *)pios_mem_pool_alloc(&callbackPool);
     if (!info) {
         xSemaphoreGiveRecursive(mutex);
         return NULL; // error - not enough memory
@@ -513,7 +518,9 @@ static int32_t runNextCallback(struct DelayedCallbackTaskStruct *task, DelayedCa
                 /* callback gets invoked here - check stack sizes */
                 markStack(current);
 
+                PIOS_EVENTTRACE(PIOS_EVENTTRACE_CALLBACKS, PIOS_EVENTTRACE_CALLBACK_START, priority, current->callbackID);
                 current->cb(); // call the callback
+                PIOS_EVENTTRACE(PIOS_EVENTTRACE_CALLBACKS, PIOS_EVENTTRACE_CALLBACK_STOP, priority, current->callbackID);
 
                 checkStack(current);
 
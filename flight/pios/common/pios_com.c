@@ -102,6 +102,8 @@ static struct pios_com_dev *PIOS_COM_alloc(void)
 
 static uint16_t PIOS_COM_TxOutCallback(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield);
 static uint16_t PIOS_COM_RxInCallback(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield);
+static uint16_t PIOS_COM_RxAcquireCallback(uint32_t context, uint8_t **span);
+static uint16_t PIOS_COM_RxCommitCallback(uint32_t context, uint16_t len, bool *need_yield);
 static void PIOS_COM_UnblockRx(struct pios_com_dev *com_dev, bool *need_yield);
 static void PIOS_COM_UnblockTx(struct pios_com_dev *com_dev, bool *need_yield);
 
@@ -121,7 +123,7 @@ int32_t PIOS_COM_Init(uint32_t *com_id, const struct pios_com_driver *driver, ui
     bool has_tx = (tx_buffer && tx_buffer_len > 0);
 
     PIOS_Assert(driver->bind_tx_cb || !has_tx);
-    PIOS_Assert(driver->bind_rx_cb || !has_rx);
+    PIOS_Assert(driver->bind_rx_cb || driver->bind_rx_span_cb || !has_rx);
 
     struct pios_com_dev *com_dev;
 
@@ -141,7 +143,12 @@ int32_t PIOS_COM_Init(uint32_t *com_id, const struct pios_com_driver *driver, ui
 #if defined(PIOS_INCLUDE_FREERTOS)
         vSemaphoreCreateBinary(com_dev->rx_sem);
 #endif /* PIOS_INCLUDE_FREERTOS */
-        (com_dev->driver->bind_rx_cb)(lower_id, PIOS_COM_RxInCallback, (uint32_t)com_dev);
+        if (com_dev->driver->bind_rx_span_cb) {
+            /* The driver writes straight into the receive buffer */
+            (com_dev->driver->bind_rx_span_cb)(lower_id, PIOS_COM_RxAcquireCallback, PIOS_COM_RxCommitCallback, (uint32_t)com_dev);
+        } else {
+            (com_dev->driver->bind_rx_cb)(lower_id, PIOS_COM_RxInCallback, (uint32_t)com_dev);
+        }
         if (com_dev->driver->rx_start) {
             /* Start the receiver */
             (com_dev->driver->rx_start)(com_dev->lower_id,
@@ -214,12 +221,7 @@ static uint16_t PIOS_COM_RxInCallback(uint32_t context, uint8_t *buf, uint16_t b
 
     PIOS_Assert(valid);
     PIOS_Assert(com_dev->has_rx);
-    uint16_t bytes_into_fifo;
-    if (buf_len == 1) {
-        bytes_into_fifo = fifoBuf_putByte(&com_dev->rx, buf[0]);
-    } else {
-        bytes_into_fifo = fifoBuf_putData(&com_dev->rx, buf, buf_len);
-    }
+    uint16_t bytes_into_fifo = fifoBuf_putData(&com_dev->rx, buf, buf_len);
     if (bytes_into_fifo > 0) {
         /* Data has been added to the buffer */
         PIOS_COM_UnblockRx(com_dev, need_yield);
@@ -232,6 +234,36 @@ static uint16_t PIOS_COM_RxInCallback(uint32_t context, uint8_t *buf, uint16_t b
     return bytes_into_fifo;
 }
 
+static uint16_t PIOS_COM_RxAcquireCallback(uint32_t context, uint8_t **span)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)context;
+
+    bool valid = PIOS_COM_validate(com_dev);
+
+    PIOS_Assert(valid);
+    PIOS_Assert(com_dev->has_rx);
+
+    return fifoBuf_acquireWrite(&com_dev->rx, span);
+}
+
+static uint16_t PIOS_COM_RxCommitCallback(uint32_t context, uint16_t len, bool *need_yield)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)context;
+
+    bool valid = PIOS_COM_validate(com_dev);
+
+    PIOS_Assert(valid);
+    PIOS_Assert(com_dev->has_rx);
+
+    if (len > 0) {
+        fifoBuf_commitWrite(&com_dev->rx, len);
+        /* Data has been added to the buffer */
+        PIOS_COM_UnblockRx(com_dev, need_yield);
+    }
+
+    return fifoBuf_getFree(&com_dev->rx);
+}
+
 static uint16_t PIOS_COM_TxOutCallback(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield)
 {
     struct pios_com_dev *com_dev = (struct pios_com_dev *)context;
@@ -663,28 +695,19 @@ int32_t PIOS_COM_SendFormattedString(uint32_t com_id, const char *format, ...)
 }
 
 /**
- * Transfer bytes from port buffers into another buffer
- * \param[in] port COM port
- * \returns Byte from buffer
+ * Wait until the rx buffer of a port holds data
+ * \param[in] com_dev COM device
+ * \param[in] timeout_ms maximum time to wait
+ * \return number of bytes in the rx buffer, 0 on timeout
  */
-uint16_t PIOS_COM_ReceiveBuffer(uint32_t com_id, uint8_t *buf, uint16_t buf_len, uint32_t timeout_ms)
+static uint16_t PIOS_COM_WaitRx(struct pios_com_dev *com_dev, uint32_t timeout_ms)
 {
-    PIOS_Assert(buf);
-    PIOS_Assert(buf_len);
-    uint16_t bytes_from_fifo;
-
-    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
-
-    if (!PIOS_COM_validate(com_dev)) {
-        /* Undefined COM port for this board (see pios_board.c) */
-        PIOS_Assert(0);
-    }
-    PIOS_Assert(com_dev->has_rx);
+    uint16_t bytes_in_fifo;
 
 check_again:
-    bytes_from_fifo = fifoBuf_getData(&com_dev->rx, buf, buf_len);
+    bytes_in_fifo = fifoBuf_getUsed(&com_dev->rx);
 
-    if (bytes_from_fifo == 0) {
+    if (bytes_in_fifo == 0) {
         /* No more bytes in receive buffer */
         /* Make sure the receiver is running while we wait */
         if (com_dev->driver->rx_start) {
@@ -707,8 +730,79 @@ check_again:
         }
     }
 
-    /* Return received byte */
-    return bytes_from_fifo;
+    return bytes_in_fifo;
+}
+
+/**
+ * Transfer bytes from port buffers into another buffer
+ * \param[in] port COM port
+ * \returns Byte from buffer
+ */
+uint16_t PIOS_COM_ReceiveBuffer(uint32_t com_id, uint8_t *buf, uint16_t buf_len, uint32_t timeout_ms)
+{
+    PIOS_Assert(buf);
+    PIOS_Assert(buf_len);
+
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        PIOS_Assert(0);
+    }
+    PIOS_Assert(com_dev->has_rx);
+
+    if (PIOS_COM_WaitRx(com_dev, timeout_ms) == 0) {
+        return 0;
+    }
+
+    /* Return received bytes */
+    return fifoBuf_getData(&com_dev->rx, buf, buf_len);
+}
+
+/**
+ * Get received bytes in place, without copying them out of the port buffer.
+ * The bytes stay in the buffer until released with PIOS_COM_ReceiveCommit().
+ * Only one task may receive from a port.
+ * \param[in] port COM port
+ * \param[out] span first received byte
+ * \param[in] timeout_ms maximum time to wait for data
+ * \return number of contiguous bytes at span, 0 on timeout
+ */
+uint16_t PIOS_COM_ReceiveAcquire(uint32_t com_id, uint8_t **span, uint32_t timeout_ms)
+{
+    PIOS_Assert(span);
+
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        PIOS_Assert(0);
+    }
+    PIOS_Assert(com_dev->has_rx);
+
+    if (PIOS_COM_WaitRx(com_dev, timeout_ms) == 0) {
+        return 0;
+    }
+
+    return fifoBuf_acquireRead(&com_dev->rx, span);
+}
+
+/**
+ * Release bytes obtained with PIOS_COM_ReceiveAcquire()
+ * \param[in] port COM port
+ * \param[in] len number of bytes processed, at most the acquired length
+ */
+void PIOS_COM_ReceiveCommit(uint32_t com_id, uint16_t len)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        PIOS_Assert(0);
+    }
+    PIOS_Assert(com_dev->has_rx);
+
+    fifoBuf_commitRead(&com_dev->rx, len);
 }
 
 /**
@@ -0,0 +1,248 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_eventtrace.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Timestamped trace of task switches, callbacks, interrupts,
+ *             object accesses and instrumentation markers
+ *                 - Ring of fixed size records in RAM, the oldest are
+ *                   overwritten
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   PIOS_EVENTTRACE Event trace
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "pios.h"
+
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+
+#include "pios_eventtrace_hooks.h"
+
+/* records in the ring, a power of two */
+#ifndef PIOS_EVENTTRACE_RECORDS
+#define PIOS_EVENTTRACE_RECORDS   1024
+#endif
+
+/* tasks told apart, the others are recorded as 0xffff */
+#ifndef PIOS_EVENTTRACE_MAX_TASKS
+#define PIOS_EVENTTRACE_MAX_TASKS 32
+#endif
+
+/* objects told apart, the others are recorded as PIOS_EVENTTRACE_NO_OBJECT */
+#ifndef PIOS_EVENTTRACE_MAX_OBJECTS
+#define PIOS_EVENTTRACE_MAX_OBJECTS 128
+#endif
+
+#if defined(ARCH_POSIX)
+#define PIOS_EVENTTRACE_FREQUENCY 1000000 // PIOS_DELAY_GetRaw() counts microseconds
+#else
+#define PIOS_EVENTTRACE_FREQUENCY PIOS_SYSCLK // DWT cycle counter
+#endif
+
+volatile uint8_t pios_eventtrace_mask;
+
+static struct pios_eventtrace_record ring[PIOS_EVENTTRACE_RECORDS];
+static volatile uint32_t head;
+
+/*
+ * Task control blocks seen by the hooks, their index is recorded. The
+ * kernel calls the hooks with the scheduler locked or interrupts masked,
+ * so the table is only ever extended by one of them at a time.
+ */
+static void *tasks[PIOS_EVENTTRACE_MAX_TASKS];
+static volatile uint8_t task_count;
+
+/* ids of the objects given an index by PIOS_EVENTTRACE_Object(), dumped as they are */
+static uint32_t objects[PIOS_EVENTTRACE_MAX_OBJECTS];
+static uint16_t object_count;
+
+/* state of the dump, taken by PIOS_EVENTTRACE_Stop() */
+static struct pios_eventtrace_header header;
+static char names[PIOS_EVENTTRACE_MAX_TASKS][configMAX_TASK_NAME_LEN];
+
+/**
+ * Clears the trace and starts recording
+ * \param[in] mask PIOS_EVENTTRACE_TASKS, PIOS_EVENTTRACE_CALLBACKS...
+ */
+void PIOS_EVENTTRACE_Start(uint8_t mask)
+{
+    PIOS_STATIC_ASSERT((PIOS_EVENTTRACE_RECORDS & (PIOS_EVENTTRACE_RECORDS - 1)) == 0);
+    PIOS_STATIC_ASSERT(PIOS_EVENTTRACE_MAX_OBJECTS <= PIOS_EVENTTRACE_NO_OBJECT);
+    PIOS_STATIC_ASSERT(PIOS_EVENTTRACE_TASK_IN == 1 && PIOS_EVENTTRACE_TASK_OUT == 2 &&
+                       PIOS_EVENTTRACE_TASK_READY == 3 && PIOS_EVENTTRACE_TASKS == 0x01); // see pios_eventtrace_hooks.h
+
+    pios_eventtrace_mask = 0;
+    head = 0;
+    pios_eventtrace_mask = mask;
+}
+
+/**
+ * Stops recording and prepares the dump
+ */
+void PIOS_EVENTTRACE_Stop(void)
+{
+    pios_eventtrace_mask = 0;
+
+    uint32_t count = head;
+
+    header.magic       = PIOS_EVENTTRACE_MAGIC;
+    header.version     = PIOS_EVENTTRACE_VERSION;
+    header.tasks       = task_count;
+    header.name_length = configMAX_TASK_NAME_LEN;
+    header.records     = (count < PIOS_EVENTTRACE_RECORDS) ? count : PIOS_EVENTTRACE_RECORDS;
+    header.frequency   = PIOS_EVENTTRACE_FREQUENCY;
+    header.lost        = count - header.records;
+    header.objects     = object_count;
+    header.reserved    = 0;
+
+    memset(names, 0, sizeof(names));
+    for (int i = 0; i < header.tasks; i++) {
+        strncpy(names[i], pcTaskGetTaskName((TaskHandle_t)tasks[i]), configMAX_TASK_NAME_LEN);
+    }
+}
+
+/**
+ * Records an event, from tasks or interrupts
+ */
+void PIOS_EVENTTRACE_Record(uint8_t type, uint8_t arg8, uint16_t arg16)
+{
+    uint32_t index = __sync_fetch_and_add(&head, 1);
+    struct pios_eventtrace_record *record = &ring[index & (PIOS_EVENTTRACE_RECORDS - 1)];
+
+    record->timestamp = PIOS_DELAY_GetRaw();
+    record->type  = type;
+    record->arg8  = arg8;
+    record->arg16 = arg16;
+}
+
+/**
+ * Records the entry or exit of the interrupt being handled
+ */
+void PIOS_EVENTTRACE_Isr(uint8_t type)
+{
+#if defined(ARCH_POSIX)
+    PIOS_EVENTTRACE_Record(type, 0, 0);
+#else
+    PIOS_EVENTTRACE_Record(type, 0, (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) - 16);
+#endif
+}
+
+/**
+ * Kernel hooks of pios_eventtrace_hooks.h
+ */
+void PIOS_EVENTTRACE_Task(unsigned char type, void *task)
+{
+    uint8_t count  = task_count;
+    uint16_t index = 0xffff;
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (tasks[i] == task) {
+            index = i;
+            break;
+        }
+    }
+    if (index == 0xffff && count < PIOS_EVENTTRACE_MAX_TASKS) {
+        tasks[count] = task;
+        task_count   = count + 1;
+        index = count;
+    }
+
+    PIOS_EVENTTRACE_Record(type, 0, index);
+}
+
+/**
+ * Gives an object the index its set and get events are recorded with, the
+ * dump maps the index back to the id. Called once per object when it is
+ * registered, under the object manager lock.
+ * \param[in] id the object id
+ * \return the index, PIOS_EVENTTRACE_NO_OBJECT once the table is full
+ */
+uint16_t PIOS_EVENTTRACE_Object(uint32_t id)
+{
+    if (object_count >= PIOS_EVENTTRACE_MAX_OBJECTS) {
+        return PIOS_EVENTTRACE_NO_OBJECT;
+    }
+    objects[object_count] = id;
+    return object_count++;
+}
+
+/**
+ * Size of the dump prepared by the last PIOS_EVENTTRACE_Stop()
+ */
+uint32_t PIOS_EVENTTRACE_DumpSize(void)
+{
+    return sizeof(header) + header.tasks * configMAX_TASK_NAME_LEN + header.objects * sizeof(uint32_t) +
+           header.records * sizeof(struct pios_eventtrace_record);
+}
+
+/**
+ * Reads a part of the dump
+ * \return the number of bytes copied, 0 past the end
+ */
+uint32_t PIOS_EVENTTRACE_Read(uint32_t offset, uint8_t *buffer, uint32_t length)
+{
+    uint32_t names_size = header.tasks * configMAX_TASK_NAME_LEN;
+    uint32_t ids_end    = sizeof(header) + names_size + header.objects * sizeof(uint32_t);
+    uint32_t size   = PIOS_EVENTTRACE_DumpSize();
+    uint32_t copied = 0;
+
+    if (offset >= size) {
+        return 0;
+    }
+    if (length > size - offset) {
+        length = size - offset;
+    }
+
+    while (copied < length) {
+        uint32_t position = offset + copied;
+        const uint8_t *source;
+        uint32_t available;
+
+        if (position < sizeof(header)) {
+            source    = (const uint8_t *)&header + position;
+            available = sizeof(header) - position;
+        } else if (position < sizeof(header) + names_size) {
+            source    = (const uint8_t *)names + (position - sizeof(header));
+            available = sizeof(header) + names_size - position;
+        } else if (position < ids_end) {
+            source    = (const uint8_t *)objects + (position - sizeof(header) - names_size);
+            available = ids_end - position;
+        } else {
+            // records from the oldest, the first one not overwritten
+            uint32_t byte   = position - ids_end;
+            uint32_t record = header.lost + byte / sizeof(struct pios_eventtrace_record);
+            source    = (const uint8_t *)&ring[record & (PIOS_EVENTTRACE_RECORDS - 1)] + byte % sizeof(struct pios_eventtrace_record);
+            available = sizeof(struct pios_eventtrace_record) - byte % sizeof(struct pios_eventtrace_record);
+        }
+
+        if (available > length - copied) {
+            available = length - copied;
+        }
+        memcpy(buffer + copied, source, available);
+        copied += available;
+    }
+
+    return copied;
+}
+
+#endif /* PIOS_INCLUDE_EVENTTRACE */
+
+/**
+ * @}
+ */
@@ -1001,6 +1001,145 @@ out_exit:
     return rc;
 }
 
+/* NOTE: Must be called while holding the flash transaction lock */
+/* Counts the active versions of all the given objects in one pass over the log, and obsoletes them if requested */
+static int8_t logfs_find_objects(struct logfs_state *logfs, const struct PIOS_FLASHFS_ObjEntry *objs, uint16_t num_objs, bool obsolete, uint16_t *num_found)
+{
+    *num_found = 0;
+
+    for (uint16_t slot_id = 1;
+         slot_id < (logfs->cfg->arena_size / logfs->cfg->slot_size);
+         slot_id++) {
+        struct slot_header slot_hdr;
+        uintptr_t slot_addr = logfs_get_addr(logfs, logfs->active_arena_id, slot_id);
+
+        if (logfs->driver->read_data(logfs->flash_id,
+                                     slot_addr,
+                                     (uint8_t *)&slot_hdr,
+                                     sizeof(slot_hdr)) != 0) {
+            return -1;
+        }
+        if (slot_hdr.state == SLOT_STATE_EMPTY) {
+            /* We hit the end of the log */
+            break;
+        }
+        if (slot_hdr.state != SLOT_STATE_ACTIVE) {
+            continue;
+        }
+        for (uint16_t i = 0; i < num_objs; i++) {
+            if (slot_hdr.obj_id == objs[i].obj_id &&
+                slot_hdr.obj_inst_id == objs[i].obj_inst_id) {
+                (*num_found)++;
+                if (!obsolete) {
+                    break;
+                }
+                slot_hdr.state = SLOT_STATE_OBSOLETE;
+                if (logfs->driver->write_data(logfs->flash_id,
+                                              slot_addr,
+                                              (uint8_t *)&slot_hdr,
+                                              sizeof(slot_hdr)) != 0) {
+                    return -2;
+                }
+                logfs->num_active_slots--;
+                break;
+            }
+        }
+#ifdef PIOS_INCLUDE_WDG
+        PIOS_WDG_Clear();
+#endif
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Saves several object instances to the filesystem in one transaction.
+ * The log is searched once for the previous versions of all objects and
+ * garbage collected at most once, which is much faster than saving the
+ * objects one by one. The objects must be distinct.
+ * @param[in] fs_id The filesystem to use for this action
+ * @param[in] objs The objects to save
+ * @param[in] num_objs Number of objects in objs
+ * @return 0 if success or error code
+ * @retval -1 if fs_id is not a valid filesystem instance
+ * @retval -2 if failed to start transaction
+ * @retval -3 if failure to delete any previous versions of the objects
+ * @retval -4 if filesystem is too full for all objects and garbage collection won't help (nothing is changed)
+ * @retval -5 if garbage collection failed
+ * @retval -6 if filesystem is full even after garbage collection should have freed space
+ * @retval -7 if writing one of the new objects to the filesystem failed
+ */
+int32_t PIOS_FLASHFS_ObjSaveMultiple(uintptr_t fs_id, const struct PIOS_FLASHFS_ObjEntry *objs, uint16_t num_objs)
+{
+    int8_t rc;
+
+    struct logfs_state *logfs = (struct logfs_state *)fs_id;
+
+    if (!PIOS_FLASHFS_Logfs_validate(logfs)) {
+        rc = -1;
+        goto out_exit;
+    }
+
+    for (uint16_t i = 0; i < num_objs; i++) {
+        PIOS_Assert(objs[i].obj_size <= (logfs->cfg->slot_size - sizeof(struct slot_header)));
+    }
+
+    if (logfs->driver->start_transaction(logfs->flash_id) != 0) {
+        rc = -2;
+        goto out_exit;
+    }
+
+    /* Check if the arena can hold all objects as active records before any
+     * previous version is obsoleted, a failed save must not lose them. The
+     * previous versions are only counted when the arena is nearly full. */
+    uint16_t max_active = (logfs->cfg->arena_size / logfs->cfg->slot_size) - 1;
+    uint16_t num_found;
+    if (logfs->num_active_slots + num_objs > max_active) {
+        if (logfs_find_objects(logfs, objs, num_objs, false, &num_found) != 0) {
+            rc = -3;
+            goto out_end_trans;
+        }
+        if (logfs->num_active_slots - num_found + num_objs > max_active) {
+            rc = -4;
+            goto out_end_trans;
+        }
+    }
+
+    if (logfs_find_objects(logfs, objs, num_objs, true, &num_found) != 0) {
+        rc = -3;
+        goto out_end_trans;
+    }
+
+    /* Is garbage collection required? */
+    if (logfs->num_free_slots < num_objs) {
+        if (logfs_garbage_collect(logfs) != 0) {
+            rc = -5;
+            goto out_end_trans;
+        }
+        if (logfs->num_free_slots < num_objs) {
+            PIOS_DEBUG_Assert(0);
+            rc = -6;
+            goto out_end_trans;
+        }
+    }
+
+    for (uint16_t i = 0; i < num_objs; i++) {
+        if (logfs_append_to_log(logfs, objs[i].obj_id, objs[i].obj_inst_id, objs[i].obj_data, objs[i].obj_size) != 0) {
+            rc = -7;
+            goto out_end_trans;
+        }
+    }
+
+    /* All objects successfully written to the log */
+    rc = 0;
+
+out_end_trans:
+    logfs->driver->end_transaction(logfs->flash_id);
+
+out_exit:
+    return rc;
+}
+
 /**
  * @brief Load one object instance from the filesystem
  * @param[in] fs_id The filesystem to use for this action
@@ -1072,6 +1211,89 @@ out_exit:
     return rc;
 }
 
+/**
+ * @brief Load every object instance in the filesystem in one pass over the log
+ * @param[in] fs_id The filesystem to use for this action
+ * @param[in] buffer Buffer each instance is read into before it is passed on
+ * @param[in] buffer_size Size of the buffer, larger instances are passed without data
+ * @param[in] cb Called for every instance, see PIOS_FLASHFS_ObjLoadCallback
+ * @param[in] context Passed on to cb
+ * @return number of instances cb took or error code
+ * @retval -1 if fs_id is not a valid filesystem instance
+ * @retval -2 if failed to start transaction
+ * @retval -3 if reading from flash fails
+ */
+int32_t PIOS_FLASHFS_ObjLoadAll(uintptr_t fs_id, uint8_t *buffer, uint16_t buffer_size, PIOS_FLASHFS_ObjLoadCallback cb, void *context)
+{
+    int32_t rc;
+
+    struct logfs_state *logfs = (struct logfs_state *)fs_id;
+
+    if (!PIOS_FLASHFS_Logfs_validate(logfs)) {
+        rc = -1;
+        goto out_exit;
+    }
+
+    if (logfs->driver->start_transaction(logfs->flash_id) != 0) {
+        rc = -2;
+        goto out_exit;
+    }
+
+    /* Walk the log up to the first empty slot, the first slot is the arena header */
+    rc = 0;
+    for (uint16_t slot_id = 1;
+         slot_id < (logfs->cfg->arena_size / logfs->cfg->slot_size);
+         slot_id++) {
+        uintptr_t slot_addr = logfs_get_addr(logfs, logfs->active_arena_id, slot_id);
+        struct slot_header slot_hdr;
+
+        if (logfs->driver->read_data(logfs->flash_id,
+                                     slot_addr,
+                                     (uint8_t *)&slot_hdr,
+                                     sizeof(slot_hdr)) != 0) {
+            rc = -3;
+            goto out_end_trans;
+        }
+        if (slot_hdr.state == SLOT_STATE_EMPTY) {
+            /* We hit the end of the log */
+            break;
+        }
+        if (slot_hdr.state != SLOT_STATE_ACTIVE) {
+            continue;
+        }
+
+        struct PIOS_FLASHFS_ObjEntry obj = {
+            .obj_id      = slot_hdr.obj_id,
+            .obj_inst_id = slot_hdr.obj_inst_id,
+            .obj_size    = slot_hdr.obj_size,
+            .obj_data    = NULL,
+        };
+        if (slot_hdr.obj_size <= buffer_size) {
+            if (slot_hdr.obj_size > 0 &&
+                logfs->driver->read_data(logfs->flash_id,
+                                         slot_addr + sizeof(slot_hdr),
+                                         buffer,
+                                         slot_hdr.obj_size) != 0) {
+                rc = -3;
+                goto out_end_trans;
+            }
+            obj.obj_data = buffer;
+        }
+        if (cb(&obj, context) == 0) {
+            rc++;
+        }
+#ifdef PIOS_INCLUDE_WDG
+        PIOS_WDG_Clear();
+#endif
+    }
+
+out_end_trans:
+    logfs->driver->end_transaction(logfs->flash_id);
+
+out_exit:
+    return rc;
+}
+
 /**
  * @brief Delete one instance of an object from the filesystem
  * @param[in] fs_id The filesystem to use for this action
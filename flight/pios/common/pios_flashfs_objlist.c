@@ -375,6 +375,39 @@ int32_t PIOS_FLASHFS_ObjSave(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst
     return 0;
 }
 
+/**
+ * @brief Saves several object instances, one sector each
+ * @param[in] fs_id The filesystem to use for this action
+ * @param[in] objs The objects to save
+ * @param[in] num_objs Number of objects in objs
+ * @return 0 if success or the error code of the first failed PIOS_FLASHFS_ObjSave()
+ */
+int32_t PIOS_FLASHFS_ObjSaveMultiple(uintptr_t fs_id, const struct PIOS_FLASHFS_ObjEntry *objs, uint16_t num_objs)
+{
+    for (uint16_t i = 0; i < num_objs; i++) {
+        int32_t rc = PIOS_FLASHFS_ObjSave(fs_id, objs[i].obj_id, objs[i].obj_inst_id, objs[i].obj_data, objs[i].obj_size);
+        if (rc != 0) {
+            return rc;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Not supported, load the objects one by one with PIOS_FLASHFS_ObjLoad().
+ * Every object has a sector of its own, there is no log to walk.
+ * @return -1
+ */
+int32_t PIOS_FLASHFS_ObjLoadAll(__attribute__((unused)) uintptr_t fs_id,
+                                __attribute__((unused)) uint8_t *buffer,
+                                __attribute__((unused)) uint16_t buffer_size,
+                                __attribute__((unused)) PIOS_FLASHFS_ObjLoadCallback cb,
+                                __attribute__((unused)) void *context)
+{
+    return -1;
+}
+
 /**
  * @brief Load one object instance per sector
  * @param[in] obj UAVObjHandle the object to save
@@ -59,6 +59,21 @@ pios_counter_t PIOS_Instrumentation_CreateCounter(uint32_t id)
     return counter_handle;
 }
 
+pios_counter_t PIOS_Instrumentation_CreateHistogramCounter(uint32_t id)
+{
+    pios_perf_counter_t *counter = (pios_perf_counter_t *)PIOS_Instrumentation_CreateCounter(id);
+
+    if (!counter->histogram) {
+        pios_perf_histogram_t *histogram = (pios_perf_histogram_t *)pvPortMalloc(sizeof(pios_perf_histogram_t));
+        PIOS_Assert(histogram);
+        memset(histogram, 0, sizeof(pios_perf_histogram_t));
+        histogram->windowMax[0] = INT32_MIN;
+        histogram->windowMax[1] = INT32_MIN;
+        counter->histogram = histogram;
+    }
+    return (pios_counter_t)counter;
+}
+
 pios_counter_t PIOS_Instrumentation_SearchCounter(uint32_t id)
 {
     PIOS_Assert(pios_instrumentation_perf_counters);
@@ -72,6 +87,56 @@ pios_counter_t PIOS_Instrumentation_SearchCounter(uint32_t id)
     return (pios_counter_t)&pios_instrumentation_perf_counters[i];
 }
 
+static int32_t percentile(const uint16_t *buckets, uint32_t rank)
+{
+    uint32_t count = 0;
+
+    for (uint8_t i = 0; i < PIOS_INSTRUMENTATION_BUCKETS; i++) {
+        count += buckets[i];
+        if (count >= rank) {
+            return PIOS_Instrumentation_BucketLimit(i);
+        }
+    }
+    return PIOS_Instrumentation_BucketLimit(PIOS_INSTRUMENTATION_BUCKETS - 1);
+}
+
+void PIOS_Instrumentation_TakePercentiles(pios_counter_t counter_handle, pios_perf_percentiles_t *percentiles)
+{
+    PIOS_Assert(pios_instrumentation_perf_counters && counter_handle && percentiles);
+    pios_perf_histogram_t *histogram = ((pios_perf_counter_t *)counter_handle)->histogram;
+
+    if (!histogram) {
+        memset(percentiles, 0, sizeof(pios_perf_percentiles_t));
+        return;
+    }
+
+    // from here on the writer fills the other bank, this one is ours
+    uint8_t bank = histogram->bank;
+    histogram->bank = bank ^ 1;
+    uint16_t *buckets = histogram->histogram[bank];
+
+    uint32_t samples  = 0;
+    for (uint8_t i = 0; i < PIOS_INSTRUMENTATION_BUCKETS; i++) {
+        samples += buckets[i];
+    }
+    percentiles->samples = samples;
+    if (samples == 0) {
+        percentiles->p50  = 0;
+        percentiles->p99  = 0;
+        percentiles->p999 = 0;
+        percentiles->max  = 0;
+    } else {
+        int32_t max = histogram->windowMax[bank];
+        // ranks rounded up, the p99.9 of less than 1000 samples is the max
+        percentiles->p50  = MIN(percentile(buckets, samples - samples / 2), max);
+        percentiles->p99  = MIN(percentile(buckets, samples - samples / 100), max);
+        percentiles->p999 = MIN(percentile(buckets, samples - samples / 1000), max);
+        percentiles->max  = max;
+    }
+    memset(buckets, 0, sizeof(histogram->histogram[bank]));
+    histogram->windowMax[bank] = INT32_MIN;
+}
+
 void PIOS_Instrumentation_ForEachCounter(InstrumentationCounterCallback callback, void *context)
 {
     PIOS_Assert(pios_instrumentation_perf_counters);
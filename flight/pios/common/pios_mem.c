@@ -96,3 +96,137 @@ void pios_free(void *p)
 }
 
 #endif /* ifdef PIOS_TARGET_PROVIDES_FAST_HEAP */
+
+// pools that took memory from the heap, in the order they did
+static struct pios_mem_pool *pools;
+static struct pios_mem_pool **pools_tail = &pools;
+
+static void *poolHeapAlloc(struct pios_mem_pool *pool, size_t size)
+{
+    void *p = pool->fastheap ? pios_fastheapmalloc(size) : pios_malloc(size);
+
+    if (!p) {
+        return NULL;
+    }
+    if (!pool->heap_bytes) {
+        portENTER_CRITICAL();
+        *pools_tail = pool;
+        pools_tail  = &pool->next;
+        portEXIT_CRITICAL();
+    }
+    pool->heap_bytes += size;
+    return p;
+}
+
+static void *poolCarve(struct pios_mem_pool *pool, size_t size)
+{
+    if (size > pool->block_left) {
+        uint8_t *block = (uint8_t *)poolHeapAlloc(pool, pool->block_size);
+        if (!block) {
+            return NULL;
+        }
+        // the rest of the old block is lost, there is nothing to give it back to
+        pool->block      = block;
+        pool->block_left = pool->block_size;
+        pool->blocks++;
+    }
+    void *p = pool->block;
+    pool->block      += size;
+    pool->block_left -= size;
+    return p;
+}
+
+static void *poolTake(struct pios_mem_pool *pool, void *p, size_t size)
+{
+    pool->count++;
+    pool->used_bytes += size;
+    if (pool->used_bytes > pool->peak_bytes) {
+        pool->peak_bytes = pool->used_bytes;
+    }
+    memset(p, 0, size);
+    return p;
+}
+
+/**
+ * Get a zeroed element from a pool.
+ * \param[in] pool The pool, defined with PIOS_MEM_POOL()
+ * \return The element or NULL if the heap is exhausted
+ */
+void *pios_mem_pool_alloc(struct pios_mem_pool *pool)
+{
+    void *p = pool->free_list;
+
+    if (p) {
+        pool->free_list = *(void **)p;
+    } else {
+        p = poolCarve(pool, pool->elem_size);
+        if (!p) {
+            return NULL;
+        }
+    }
+    return poolTake(pool, p, pool->elem_size);
+}
+
+/**
+ * Give an element back to its pool, the next pios_mem_pool_alloc() reuses it.
+ * \param[in] pool The pool the element came from
+ * \param[in] p The element or NULL
+ */
+void pios_mem_pool_free(struct pios_mem_pool *pool, void *p)
+{
+    if (!p) {
+        return;
+    }
+    *(void **)p     = pool->free_list;
+    pool->free_list = p;
+    pool->count--;
+    pool->used_bytes -= pool->elem_size;
+}
+
+/**
+ * Get zeroed memory from an arena, it is never given back.
+ * \param[in] arena The arena, defined with PIOS_MEM_ARENA()
+ * \param[in] size Number of bytes, rounded up to PIOS_MEM_ALIGNMENT
+ * \return The memory or NULL if the heap is exhausted
+ */
+void *pios_mem_arena_alloc(struct pios_mem_pool *arena, size_t size)
+{
+    void *p;
+
+    size = PIOS_MEM_ALIGN(size);
+    if (size > arena->block_left && (size > arena->block_size || arena->block_left >= arena->block_size / 8)) {
+        // too large for a block, or the current block still has room for smaller ones
+        p = poolHeapAlloc(arena, size);
+    } else {
+        p = poolCarve(arena, size);
+    }
+    if (!p) {
+        return NULL;
+    }
+    return poolTake(arena, p, size);
+}
+
+/**
+ * The pools and arenas that took memory from the heap, linked through next.
+ */
+const struct pios_mem_pool *pios_mem_pools(void)
+{
+    return pools;
+}
+
+/**
+ * Print one line per pool and arena and the total they took from the heap.
+ * \param[in] print printf like function, PIOS_DEBUGLOG_Printf() for instance
+ */
+void pios_mem_report(void (*print)(char *format, ...))
+{
+    uint32_t total = 0;
+
+    for (const struct pios_mem_pool *pool = pools; pool; pool = pool->next) {
+        print("mem %s: %u allocs, %u bytes used, %u peak, %u heap in %u blocks%s",
+              pool->name, (unsigned)pool->count, (unsigned)pool->used_bytes, (unsigned)pool->peak_bytes,
+              (unsigned)pool->heap_bytes, (unsigned)pool->blocks, pool->fastheap ? " (fast)" : "");
+        total += pool->heap_bytes;
+    }
+    print("mem total: %u heap", (unsigned)total);
+}
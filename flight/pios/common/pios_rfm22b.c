@@ -131,6 +131,10 @@
 #define CONNECTED_TIMEOUT (250 / portTICK_RATE_MS) /* ms */
 #define MAX_CHANNELS      32
 
+// Link adaptation header: [next datarate:4 | datarate:4], [corrected:4 | good:4] of the last window
+#define RFM22B_ADAPT_HEADER_BYTES 2
+#define RFM22B_ADAPT_REPORT_SCALE 15
+
 /* Local type definitions */
 
 struct pios_rfm22b_transition {
@@ -205,6 +209,12 @@ static uint8_t rfm22_calcChannel(struct pios_rfm22b_dev *rfm22b_dev, uint8_t ind
 static uint8_t rfm22_calcChannelFromClock(struct pios_rfm22b_dev *rfm22b_dev);
 static bool rfm22_changeChannel(struct pios_rfm22b_dev *rfm22b_dev);
 static void rfm22_clearLEDs();
+static void rfm22_setChannelPlan(struct pios_rfm22b_dev *rfm22b_dev);
+static void rfm22_adaptSetDatarate(struct pios_rfm22b_dev *rfm22b_dev, uint8_t datarate);
+static void rfm22_adaptReceive(struct pios_rfm22b_dev *rfm22b_dev, const uint8_t *header, bool good);
+static bool rfm22_adaptLink(struct pios_rfm22b_dev *rfm22b_dev);
+static uint8_t rfm22_adaptExpected(struct pios_rfm22b_dev *rfm22b_dev);
+static portTickType rfm22_adaptWindowEnd(struct pios_rfm22b_dev *rfm22b_dev, portTickType time);
 
 // Utility functions.
 static uint32_t pios_rfm22_time_difference_ms(portTickType start_time, portTickType end_time);
@@ -415,6 +425,8 @@ int32_t PIOS_RFM22B_Init(uint32_t *rfm22b_id, uint32_t spi_id, uint32_t slave_nu
     rfm22b_dev->tx_power      = RFM22B_DEFAULT_TX_POWER;
     rfm22b_dev->coordinator   = false;
     rfm22b_dev->coordinatorID = 0;
+    rfm22b_dev->adapt_pending = false;
+    rfm22b_dev->adapt_epoch   = 0;
 
     // Initialize the com callbacks.
     rfm22b_dev->rx_in_cb      = NULL;
@@ -629,16 +641,68 @@ void PIOS_RFM22B_SetChannelConfig(uint32_t rfm22b_id, enum rfm22b_datarate datar
     rfm22b_dev->ppm_only_mode = ppm_only;
     if (ppm_only) {
         rfm22b_dev->one_way_link = true;
-        datarate = RFM22B_PPM_ONLY_DATARATE;
         rfm22b_dev->datarate     = RFM22B_PPM_ONLY_DATARATE;
     } else {
         rfm22b_dev->one_way_link = false;
         rfm22b_dev->datarate     = datarate;
     }
+    rfm22b_dev->min_chan = min_chan;
+    rfm22b_dev->max_chan = max_chan;
+    rfm22b_dev->adaptive = false;
+
+    rfm22_setChannelPlan(rfm22b_dev);
+}
+
+/**
+ * Adapt the datarate and packet length to the link quality.
+ * The datarate configured by PIOS_RFM22B_SetChannelConfig() is the maximum, the link
+ * starts and restarts after a timeout at 9600. Only two-way data links are adapted,
+ * both modems have to enable it. Call after PIOS_RFM22B_SetChannelConfig().
+ *
+ * @param[in] rfm22b_id The RFM22B device index.
+ * @param[in] enable Adapt the link?
+ */
+void PIOS_RFM22B_SetLinkAdaptation(uint32_t rfm22b_id, bool enable)
+{
+    struct pios_rfm22b_dev *rfm22b_dev = (struct pios_rfm22b_dev *)rfm22b_id;
+
+    if (!PIOS_RFM22B_Validate(rfm22b_dev)) {
+        return;
+    }
+
+    rfm22b_dev->adaptive = enable && !rfm22b_dev->one_way_link && !rfm22b_dev->ppm_send_mode && !rfm22b_dev->ppm_recv_mode;
+    if (!rfm22b_dev->adaptive) {
+        return;
+    }
+
+    uint8_t num_modes = rfm22b_dev->datarate + 1;
+    for (uint8_t i = 0; i < num_modes; ++i) {
+        rfm22b_dev->datarate = i;
+        rfm22_setChannelPlan(rfm22b_dev);
+        rfm22b_dev->adapt_modes[i].bitrate = data_rate[i];
+        rfm22b_dev->adapt_modes[i].slot_ms = rfm22b_dev->packet_time;
+        rfm22b_dev->adapt_modes[i].max_len = rfm22b_dev->max_packet_len;
+    }
+    LinkAdaptInit(&rfm22b_dev->adapt, rfm22b_dev->adapt_modes, num_modes, RS_ECC_NPARITY, SYNC_BYTES + HEADER_BYTES + LENGTH_BYTES);
+
+    rfm22_adaptSetDatarate(rfm22b_dev, RFM22_datarate_9600);
+}
+
+/**
+ * Calculate the packet time, frequency hopping channels and maximum packet length
+ * for the current datarate.
+ *
+ * @param[in] rfm22b_dev The device structure
+ */
+static void rfm22_setChannelPlan(struct pios_rfm22b_dev *rfm22b_dev)
+{
+    enum rfm22b_datarate datarate = rfm22b_dev->datarate;
+    bool ppm_mode = rfm22b_dev->ppm_send_mode || rfm22b_dev->ppm_recv_mode;
+
     rfm22b_dev->packet_time = (ppm_mode ? packet_time_ppm[datarate] : packet_time[datarate]);
 
     uint8_t num_found = 0;
-    rfm22_gen_channels(rfm22_destinationID(rfm22b_dev), datarate, min_chan, max_chan,
+    rfm22_gen_channels(rfm22_destinationID(rfm22b_dev), datarate, rfm22b_dev->min_chan, rfm22b_dev->max_chan,
                        rfm22b_dev->channels, &num_found);
 
     rfm22b_dev->num_channels = num_found;
@@ -1244,6 +1308,11 @@ static void pios_rfm22_task(void *parameters)
             }
         }
 
+        // Change the datarate at the end of a hop cycle if the link adaptation requests it.
+        if (rfm22_adaptLink(rfm22b_dev)) {
+            rfm22_process_event(rfm22b_dev, RADIO_EVENT_RX_MODE);
+        }
+
         // Change channels if necessary.
         if (rfm22_changeChannel(rfm22b_dev)) {
             rfm22_process_event(rfm22b_dev, RADIO_EVENT_RX_MODE);
@@ -1846,7 +1915,7 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
 {
     uint8_t *p  = radio_dev->tx_packet;
     uint8_t len = 0;
-    uint8_t max_data_len = radio_dev->max_packet_len - (radio_dev->ppm_only_mode ? 0 : RS_ECC_NPARITY);
+    uint8_t max_data_len = (radio_dev->adaptive ? radio_dev->tx_len : radio_dev->max_packet_len) - (radio_dev->ppm_only_mode ? 0 : RS_ECC_NPARITY);
 
     // Don't send if it's not our turn, or if we're receiving a packet.
     if (!rfm22_timeToSend(radio_dev) || !PIOS_RFM22B_InRxWait((uint32_t)radio_dev)) {
@@ -1858,6 +1927,13 @@ static enum pios_radio_event radio_txStart(struct pios_rfm22b_dev *radio_dev)
         return RADIO_EVENT_RX_MODE;
     }
 
+    // Lead with the link adaptation header, this makes both modems send in every slot.
+    if (radio_dev->adaptive) {
+        p[0] = ((radio_dev->adapt_pending ? radio_dev->adapt_next : radio_dev->datarate) << 4) | radio_dev->datarate;
+        p[1] = radio_dev->adapt_report;
+        len  = RFM22B_ADAPT_HEADER_BYTES;
+    }
+
     // Should we append PPM data to the packet?
     if (radio_dev->ppm_send_mode) {
         len = RFM22B_PPM_NUM_CHANNELS + (radio_dev->ppm_only_mode ? 2 : 1);
@@ -2055,6 +2131,19 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
         }
     }
 
+    // Pull the link adaptation header off of the head of the packet.
+    const uint8_t *adapt_header = NULL;
+    if ((good_packet || corrected_packet) && radio_dev->adaptive) {
+        if (data_len < RFM22B_ADAPT_HEADER_BYTES) {
+            good_packet = false;
+            corrected_packet = false;
+        } else {
+            adapt_header = p;
+            p += RFM22B_ADAPT_HEADER_BYTES;
+            data_len -= RFM22B_ADAPT_HEADER_BYTES;
+        }
+    }
+
     // Set the packet status
     if (good_packet) {
         rfm22b_add_rx_status(radio_dev, RADIO_GOOD_RX_PACKET);
@@ -2084,6 +2173,9 @@ static enum pios_radio_event radio_receivePacket(struct pios_rfm22b_dev *radio_d
             radio_dev->rx_destination_id == rfm22_destinationID(radio_dev)) {
             rfm22_synchronizeClock(radio_dev);
         }
+        if (adapt_header && (radio_dev->rx_destination_id == rfm22_destinationID(radio_dev))) {
+            rfm22_adaptReceive(radio_dev, adapt_header, good_packet);
+        }
         radio_dev->stats.link_state     = OPLINKSTATUS_LINKSTATE_CONNECTED;
         radio_dev->last_contact         = xTaskGetTickCount();
         radio_dev->stats.rssi = radio_dev->rssi_dBm;
@@ -2326,7 +2418,7 @@ static void rfm22_synchronizeClock(struct pios_rfm22b_dev *rfm22b_dev)
 static portTickType rfm22_coordinatorTime(struct pios_rfm22b_dev *rfm22b_dev, portTickType ticks)
 {
     if (rfm22_isCoordinator(rfm22b_dev)) {
-        return ticks;
+        return ticks - rfm22b_dev->adapt_epoch;
     }
     return ticks + rfm22b_dev->time_delta;
 }
@@ -2417,6 +2509,179 @@ static bool rfm22_changeChannel(struct pios_rfm22b_dev *rfm22b_dev)
 }
 
 
+/*****************************************************************************
+* Link Adaptation Functions
+*****************************************************************************/
+
+/**
+ * Switch to a datarate and restart the adaptation window.
+ * The radio registers are not written.
+ *
+ * @param[in] rfm22b_dev  The device structure
+ * @param[in] datarate  The new datarate
+ */
+static void rfm22_adaptSetDatarate(struct pios_rfm22b_dev *rfm22b_dev, uint8_t datarate)
+{
+    rfm22b_dev->datarate = datarate;
+    rfm22_setChannelPlan(rfm22b_dev);
+
+    // The coordinator already switched its adaptation state when it decided the change.
+    if (rfm22b_dev->adapt.mode != datarate) {
+        LinkAdaptSetMode(&rfm22b_dev->adapt, datarate);
+    }
+    rfm22b_dev->tx_len = rfm22b_dev->adapt.len;
+
+    // The first window at the new datarate is skipped, the peer still reports the old one.
+    rfm22b_dev->adapt_pending    = false;
+    rfm22b_dev->adapt_settle     = 1;
+    rfm22b_dev->adapt_good       = 0;
+    rfm22b_dev->adapt_corrected  = 0;
+    rfm22b_dev->adapt_report     = 0;
+    rfm22b_dev->adapt_peer.expected = 0;
+    rfm22b_dev->adapt_window_end = rfm22_adaptWindowEnd(rfm22b_dev, rfm22_coordinatorTime(rfm22b_dev, xTaskGetTickCount()));
+}
+
+/**
+ * Account a packet received from the peer and process its link adaptation header.
+ *
+ * @param[in] rfm22b_dev  The device structure
+ * @param[in] header  The link adaptation header of the packet
+ * @param[in] good  Was the packet received without errors?
+ */
+static void rfm22_adaptReceive(struct pios_rfm22b_dev *rfm22b_dev, const uint8_t *header, bool good)
+{
+    if (good) {
+        rfm22b_dev->adapt_good++;
+    } else {
+        rfm22b_dev->adapt_corrected++;
+    }
+
+    uint8_t expected = rfm22_adaptExpected(rfm22b_dev);
+    rfm22b_dev->adapt_peer.expected  = expected;
+    rfm22b_dev->adapt_peer.good      = (header[1] & 0x0f) * expected / RFM22B_ADAPT_REPORT_SCALE;
+    rfm22b_dev->adapt_peer.corrected = (header[1] >> 4) * expected / RFM22B_ADAPT_REPORT_SCALE;
+
+    // Follow a datarate change announced by the coordinator. Both modems switch
+    // at the end of the hop cycle the announcement was sent in.
+    uint8_t next = header[0] >> 4;
+    if (!rfm22_isCoordinator(rfm22b_dev) && !rfm22b_dev->adapt_pending &&
+        (next != rfm22b_dev->datarate) && (next < rfm22b_dev->adapt.num_modes)) {
+        rfm22b_dev->adapt_pending     = true;
+        rfm22b_dev->adapt_next        = next;
+        rfm22b_dev->adapt_switch_time = rfm22_adaptWindowEnd(rfm22b_dev, rfm22_coordinatorTime(rfm22b_dev, rfm22b_dev->packet_start_ticks));
+    }
+}
+
+/**
+ * Run the link adaptation: fall back to the base datarate when the link is lost,
+ * switch the datarate when a change is due and evaluate the reception at the end
+ * of each hop cycle.
+ *
+ * @param[in] rfm22b_dev  The device structure
+ * @return true if the datarate was changed and the receiver has to be restarted
+ */
+static bool rfm22_adaptLink(struct pios_rfm22b_dev *rfm22b_dev)
+{
+    if (!rfm22b_dev->adaptive) {
+        return false;
+    }
+
+    // Registers are only changed between packets.
+    bool idle = PIOS_RFM22B_InRxWait((uint32_t)rfm22b_dev);
+
+    // Both modems fall back to the base datarate where the remote waits for the coordinator.
+    if (rfm22_checkTimeOut(rfm22b_dev)) {
+        if ((rfm22b_dev->datarate != RFM22_datarate_9600) && idle) {
+            rfm22_adaptSetDatarate(rfm22b_dev, RFM22_datarate_9600);
+            pios_rfm22_setDatarate(rfm22b_dev);
+            return true;
+        }
+        return false;
+    }
+
+    portTickType time = rfm22_coordinatorTime(rfm22b_dev, xTaskGetTickCount());
+
+    if (rfm22b_dev->adapt_pending) {
+        if (((int32_t)(time - rfm22b_dev->adapt_switch_time) >= 0) && idle) {
+            // The remote only knows the coordinator time modulo the hop cycle, so both
+            // restart the clock at the switch to hop in step with the new cycle length.
+            if (rfm22_isCoordinator(rfm22b_dev)) {
+                rfm22b_dev->adapt_epoch += rfm22b_dev->adapt_switch_time;
+            } else {
+                rfm22b_dev->time_delta  -= rfm22b_dev->adapt_switch_time;
+            }
+            rfm22_adaptSetDatarate(rfm22b_dev, rfm22b_dev->adapt_next);
+            pios_rfm22_setDatarate(rfm22b_dev);
+            return true;
+        }
+        return false;
+    }
+
+    if ((int32_t)(time - rfm22b_dev->adapt_window_end) < 0) {
+        return false;
+    }
+    rfm22b_dev->adapt_window_end = rfm22_adaptWindowEnd(rfm22b_dev, time);
+
+    // Close the window and prepare the report sent to the peer.
+    uint8_t expected = rfm22_adaptExpected(rfm22b_dev);
+    struct linkadapt_window rx;
+    rx.expected  = expected;
+    rx.good      = (rfm22b_dev->adapt_good < expected) ? rfm22b_dev->adapt_good : expected;
+    rx.corrected = (rfm22b_dev->adapt_corrected < expected - rx.good) ? rfm22b_dev->adapt_corrected : expected - rx.good;
+    rfm22b_dev->adapt_good      = 0;
+    rfm22b_dev->adapt_corrected = 0;
+    rfm22b_dev->adapt_report    = (rx.corrected * RFM22B_ADAPT_REPORT_SCALE / expected) << 4 |
+                                  (rx.good * RFM22B_ADAPT_REPORT_SCALE / expected);
+
+    if (rfm22b_dev->adapt_settle) {
+        rfm22b_dev->adapt_settle--;
+        return false;
+    }
+
+    // Only the coordinator selects the datarate, both adapt their packet length.
+    bool coordinator = rfm22_isCoordinator(rfm22b_dev);
+    uint8_t next     = LinkAdaptUpdate(&rfm22b_dev->adapt, &rx,
+                                       rfm22b_dev->adapt_peer.expected ? &rfm22b_dev->adapt_peer : NULL, coordinator);
+    rfm22b_dev->adapt_peer.expected = 0;
+
+    // A coordinator changing the datarate already has the length for the new one.
+    rfm22b_dev->tx_len = (rfm22b_dev->adapt.len < rfm22b_dev->max_packet_len) ? rfm22b_dev->adapt.len : rfm22b_dev->max_packet_len;
+
+    if (coordinator && (next != rfm22b_dev->datarate)) {
+        rfm22b_dev->adapt_pending     = true;
+        rfm22b_dev->adapt_next        = next;
+        rfm22b_dev->adapt_switch_time = rfm22b_dev->adapt_window_end;
+    }
+
+    return false;
+}
+
+/**
+ * The number of packets each modem sends in a hop cycle.
+ *
+ * @param[in] rfm22b_dev  The device structure
+ */
+static uint8_t rfm22_adaptExpected(struct pios_rfm22b_dev *rfm22b_dev)
+{
+    uint8_t expected = rfm22b_dev->num_channels / 2;
+
+    return expected ? expected : 1;
+}
+
+/**
+ * The end of the hop cycle a coordinator time falls in.
+ *
+ * @param[in] rfm22b_dev  The device structure
+ * @param[in] time  The coordinator time
+ */
+static portTickType rfm22_adaptWindowEnd(struct pios_rfm22b_dev *rfm22b_dev, portTickType time)
+{
+    uint16_t cycle = rfm22b_dev->packet_time * rfm22b_dev->num_channels;
+
+    return (time / cycle + 1) * cycle;
+}
+
+
 /*****************************************************************************
 * Error Handling Functions
 *****************************************************************************/
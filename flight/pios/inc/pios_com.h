@@ -40,6 +40,14 @@ typedef void (*pios_com_callback_ctrl_line)(uint32_t context, uint32_t mask, uin
 typedef void (*pios_com_callback_baud_rate)(uint32_t context, uint32_t baud);
 typedef void (*pios_com_callback_available)(uint32_t context, uint32_t available);
 
+/*
+ * Receiving in place: rx_acquire gives the contiguous free space of the receive
+ * buffer, the driver writes the received bytes there and hands their number to
+ * rx_commit, which returns the free space left. Called from the driver's ISR.
+ */
+typedef uint16_t (*pios_com_callback_rx_acquire)(uint32_t context, uint8_t **span);
+typedef uint16_t (*pios_com_callback_rx_commit)(uint32_t context, uint16_t len, bool *task_woken);
+
 struct pios_com_driver {
     void     (*init)(uint32_t id);
     void     (*set_baud)(uint32_t id, uint32_t baud);
@@ -52,6 +60,8 @@ struct pios_com_driver {
     void     (*bind_baud_rate_cb)(uint32_t id, pios_com_callback_baud_rate baud_rate_cb, uint32_t context);
     uint32_t (*available)(uint32_t id);
     void     (*bind_available_cb)(uint32_t id, pios_com_callback_available available_cb, uint32_t context);
+    /* optional, used instead of bind_rx_cb by drivers that receive in place */
+    void     (*bind_rx_span_cb)(uint32_t id, pios_com_callback_rx_acquire rx_acquire_cb, pios_com_callback_rx_commit rx_commit_cb, uint32_t context);
 };
 
 /* Control line definitions */
@@ -73,6 +83,8 @@ extern int32_t PIOS_COM_SendString(uint32_t com_id, const char *str);
 extern int32_t PIOS_COM_SendFormattedStringNonBlocking(uint32_t com_id, const char *format, ...);
 extern int32_t PIOS_COM_SendFormattedString(uint32_t com_id, const char *format, ...);
 extern uint16_t PIOS_COM_ReceiveBuffer(uint32_t com_id, uint8_t *buf, uint16_t buf_len, uint32_t timeout_ms);
+extern uint16_t PIOS_COM_ReceiveAcquire(uint32_t com_id, uint8_t **span, uint32_t timeout_ms);
+extern void PIOS_COM_ReceiveCommit(uint32_t com_id, uint16_t len);
 extern uint32_t PIOS_COM_Available(uint32_t com_id);
 extern int32_t PIOS_COM_RegisterAvailableCallback(uint32_t com_id, pios_com_callback_available, uint32_t context);
 
@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_eventtrace.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Timestamped trace of task switches, callbacks, interrupts,
+ *             object accesses and instrumentation markers
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef PIOS_EVENTTRACE_H
+#define PIOS_EVENTTRACE_H
+
+/*
+ * Event classes, recorded when set in the mask passed to PIOS_EVENTTRACE_Start()
+ */
+#define PIOS_EVENTTRACE_TASKS     0x01
+#define PIOS_EVENTTRACE_CALLBACKS 0x02
+#define PIOS_EVENTTRACE_ISRS      0x04
+#define PIOS_EVENTTRACE_OBJECTS   0x08
+#define PIOS_EVENTTRACE_MARKERS   0x10
+#define PIOS_EVENTTRACE_ALL       0x1f
+
+/*
+ * Event types, and the meaning of the arguments of their records
+ */
+enum pios_eventtrace_type {
+    PIOS_EVENTTRACE_TASK_IN = 1, // arg16: task index in the dump name table
+    PIOS_EVENTTRACE_TASK_OUT,
+    PIOS_EVENTTRACE_TASK_READY,
+    PIOS_EVENTTRACE_CALLBACK_START, // arg16: callback id, CallbackInfo element or -1
+    PIOS_EVENTTRACE_CALLBACK_STOP,
+    PIOS_EVENTTRACE_ISR_ENTER, // arg16: IRQ number
+    PIOS_EVENTTRACE_ISR_EXIT,
+    PIOS_EVENTTRACE_OBJECT_SET, // arg16: object index in the dump id table, arg8: instance
+    PIOS_EVENTTRACE_OBJECT_GET,
+    PIOS_EVENTTRACE_MARKER_START, // arg16: low half of the counter id
+    PIOS_EVENTTRACE_MARKER_END,
+    PIOS_EVENTTRACE_MARKER_VALUE,
+};
+
+struct pios_eventtrace_record {
+    uint32_t timestamp; // PIOS_DELAY_GetRaw(), the DWT cycle counter on STM32
+    uint8_t  type;
+    uint8_t  arg8;
+    uint16_t arg16;
+};
+
+/*
+ * Object index of the metaobject of the indexed object, and of the objects
+ * past the end of the id table
+ */
+#define PIOS_EVENTTRACE_METAOBJECT 0x8000
+#define PIOS_EVENTTRACE_NO_OBJECT  0x7fff
+
+/*
+ * Dump of the trace, read with PIOS_EVENTTRACE_Read(): this header, the task
+ * names (configMAX_TASK_NAME_LEN bytes each), the object ids (uint32_t each)
+ * then the records, oldest first. All little endian.
+ */
+#define PIOS_EVENTTRACE_MAGIC   0x43525445 // "ETRC"
+#define PIOS_EVENTTRACE_VERSION 2
+
+struct pios_eventtrace_header {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t  tasks;
+    uint8_t  name_length;
+    uint32_t records;
+    uint32_t frequency; // timestamp counts per second
+    uint32_t lost; // records overwritten since the start
+    uint16_t objects;
+    uint16_t reserved;
+};
+
+extern volatile uint8_t pios_eventtrace_mask;
+
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+#define PIOS_EVENTTRACE(class, type, arg8, arg16) \
+    do { \
+        if (pios_eventtrace_mask & (class)) { \
+            PIOS_EVENTTRACE_Record((type), (arg8), (arg16)); } \
+    } \
+    while (0)
+#define PIOS_EVENTTRACE_ISR_ENTER() \
+    do { \
+        if (pios_eventtrace_mask & PIOS_EVENTTRACE_ISRS) { \
+            PIOS_EVENTTRACE_Isr(PIOS_EVENTTRACE_ISR_ENTER); } \
+    } \
+    while (0)
+#define PIOS_EVENTTRACE_ISR_EXIT() \
+    do { \
+        if (pios_eventtrace_mask & PIOS_EVENTTRACE_ISRS) { \
+            PIOS_EVENTTRACE_Isr(PIOS_EVENTTRACE_ISR_EXIT); } \
+    } \
+    while (0)
+#else
+#define PIOS_EVENTTRACE(class, type, arg8, arg16)
+#define PIOS_EVENTTRACE_ISR_ENTER()
+#define PIOS_EVENTTRACE_ISR_EXIT()
+#endif
+
+/* Public Functions */
+extern void PIOS_EVENTTRACE_Start(uint8_t mask);
+extern void PIOS_EVENTTRACE_Stop(void);
+extern void PIOS_EVENTTRACE_Record(uint8_t type, uint8_t arg8, uint16_t arg16);
+extern void PIOS_EVENTTRACE_Isr(uint8_t type);
+extern uint16_t PIOS_EVENTTRACE_Object(uint32_t id);
+extern uint32_t PIOS_EVENTTRACE_DumpSize(void);
+extern uint32_t PIOS_EVENTTRACE_Read(uint32_t offset, uint8_t *buffer, uint32_t length);
+
+#endif /* PIOS_EVENTTRACE_H */
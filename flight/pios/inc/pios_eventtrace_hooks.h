@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_eventtrace_hooks.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      FreeRTOS trace macros feeding PIOS_EVENTTRACE, included at the
+ *             end of FreeRTOSConfig.h of the boards with PIOS_INCLUDE_EVENTTRACE
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef PIOS_EVENTTRACE_HOOKS_H
+#define PIOS_EVENTTRACE_HOOKS_H
+
+/*
+ * The kernel does not include pios.h, only the mask and the hooks are
+ * declared here. The macros are expanded in tasks.c, with the task
+ * control block at hand.
+ */
+extern volatile unsigned char pios_eventtrace_mask;
+extern void PIOS_EVENTTRACE_Task(unsigned char type, void *task);
+
+#define PIOS_EVENTTRACE_HOOK(type, task) \
+    do { \
+        if (pios_eventtrace_mask & 0x01) { \
+            PIOS_EVENTTRACE_Task((type), (void *)(task)); } \
+    } \
+    while (0)
+
+#define traceTASK_SWITCHED_IN()                  PIOS_EVENTTRACE_HOOK(1, pxCurrentTCB)
+#define traceTASK_SWITCHED_OUT()                 PIOS_EVENTTRACE_HOOK(2, pxCurrentTCB)
+/* expanded without a trailing semicolon in prvAddTaskToReadyList() */
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)    PIOS_EVENTTRACE_HOOK(3, pxTCB);
+
+#endif /* PIOS_EVENTTRACE_HOOKS_H */
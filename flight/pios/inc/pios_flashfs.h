@@ -34,12 +34,29 @@ struct PIOS_FLASHFS_Stats {
     uint16_t num_active_slots; /* slots in active state */
 };
 
+/* one object instance of PIOS_FLASHFS_ObjSaveMultiple() */
+struct PIOS_FLASHFS_ObjEntry {
+    uint32_t obj_id;
+    uint16_t obj_inst_id;
+    uint16_t obj_size;
+    uint8_t  *obj_data;
+};
+
+/*
+ * Called by PIOS_FLASHFS_ObjLoadAll() for every object instance in the filesystem,
+ * obj_data is NULL if the instance did not fit the buffer. Returns 0 if it took
+ * the instance. Runs inside the flash transaction, must not use the filesystem.
+ */
+typedef int32_t (*PIOS_FLASHFS_ObjLoadCallback)(const struct PIOS_FLASHFS_ObjEntry *obj, void *context);
+
 // define logfs subdirectory of a yaffs flash device
 #define PIOS_LOGFS_DIR "logfs"
 
 int32_t PIOS_FLASHFS_Format(uintptr_t fs_id);
 int32_t PIOS_FLASHFS_ObjSave(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst_id, uint8_t *obj_data, uint16_t obj_size);
+int32_t PIOS_FLASHFS_ObjSaveMultiple(uintptr_t fs_id, const struct PIOS_FLASHFS_ObjEntry *objs, uint16_t num_objs);
 int32_t PIOS_FLASHFS_ObjLoad(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst_id, uint8_t *obj_data, uint16_t obj_size);
+int32_t PIOS_FLASHFS_ObjLoadAll(uintptr_t fs_id, uint8_t *buffer, uint16_t buffer_size, PIOS_FLASHFS_ObjLoadCallback cb, void *context);
 int32_t PIOS_FLASHFS_ObjDelete(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst_id);
 int32_t PIOS_FLASHFS_GetStats(uintptr_t fs_id, struct PIOS_FLASHFS_Stats *stats);
 #endif /* PIOS_FLASHFS_H */
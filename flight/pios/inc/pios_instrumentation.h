@@ -29,19 +29,112 @@
 #include <pios_debug.h>
 #include <pios_delay.h>
 #include <FreeRTOS.h>
+/*
+ * A counter can keep a log-linear histogram of its values: values below
+ * 2^PIOS_INSTRUMENTATION_SUB_BITS get a bucket each, every power of two above
+ * is split into 2^(PIOS_INSTRUMENTATION_SUB_BITS - 1) buckets, so a bucket is
+ * never wider than 1/4 of its value with the default of 3. Values are clamped
+ * to [0, 2^PIOS_INSTRUMENTATION_MAX_EXPONENT), about one second in microseconds.
+ */
+#ifndef PIOS_INSTRUMENTATION_SUB_BITS
+#define PIOS_INSTRUMENTATION_SUB_BITS 3
+#endif
+#define PIOS_INSTRUMENTATION_MAX_EXPONENT 20
+#define PIOS_INSTRUMENTATION_BUCKETS      ((PIOS_INSTRUMENTATION_MAX_EXPONENT - PIOS_INSTRUMENTATION_SUB_BITS + 2) << (PIOS_INSTRUMENTATION_SUB_BITS - 1))
+
+/*
+ * The writer fills histogram[bank], PIOS_Instrumentation_TakePercentiles()
+ * flips bank and then reads and clears the other one. Each value is recorded
+ * with interrupts disabled, so a writer preempted by the reader never adds it
+ * to the bank being read. 316 bytes of heap with the default buckets, only
+ * counters created with PIOS_Instrumentation_CreateHistogramCounter() have one.
+ */
+typedef struct {
+    volatile uint8_t bank;
+    int32_t  windowMax[2];
+    uint16_t histogram[2][PIOS_INSTRUMENTATION_BUCKETS];
+} pios_perf_histogram_t;
+
 typedef struct {
     uint32_t id;
     int32_t  max;
     int32_t  min;
     int32_t  value;
     uint32_t lastUpdateTS;
+    pios_perf_histogram_t *histogram;
 } pios_perf_counter_t;
 
+typedef struct {
+    uint32_t samples;
+    int32_t  p50;
+    int32_t  p99;
+    int32_t  p999;
+    int32_t  max;
+} pios_perf_percentiles_t;
+
 typedef void *pios_counter_t;
 
 extern pios_perf_counter_t *pios_instrumentation_perf_counters;
 extern int8_t pios_instrumentation_last_used_counter;
 
+/**
+ * Histogram bucket of a value
+ * @param value the value, clamped to the histogram range
+ * @return the bucket index, less than PIOS_INSTRUMENTATION_BUCKETS
+ */
+static inline uint8_t PIOS_Instrumentation_Bucket(int32_t value)
+{
+    if (value < (1 << PIOS_INSTRUMENTATION_SUB_BITS)) {
+        return (value < 0) ? 0 : value;
+    }
+    if (value >= (1 << PIOS_INSTRUMENTATION_MAX_EXPONENT)) {
+        return PIOS_INSTRUMENTATION_BUCKETS - 1;
+    }
+    uint8_t shift = 31 - __builtin_clz(value) - (PIOS_INSTRUMENTATION_SUB_BITS - 1);
+    return ((shift + 1) << (PIOS_INSTRUMENTATION_SUB_BITS - 1)) + (value >> shift) - (1 << (PIOS_INSTRUMENTATION_SUB_BITS - 1));
+}
+
+/**
+ * Highest value falling in a histogram bucket
+ * @param bucket the bucket index
+ * @return the upper bound of the bucket, inclusive
+ */
+static inline int32_t PIOS_Instrumentation_BucketLimit(uint8_t bucket)
+{
+    if (bucket < (1 << PIOS_INSTRUMENTATION_SUB_BITS)) {
+        return bucket;
+    }
+    uint8_t shift = (bucket >> (PIOS_INSTRUMENTATION_SUB_BITS - 1)) - 1;
+    int32_t mantissa = (bucket & ((1 << (PIOS_INSTRUMENTATION_SUB_BITS - 1)) - 1)) + (1 << (PIOS_INSTRUMENTATION_SUB_BITS - 1));
+    return ((mantissa + 1) << shift) - 1;
+}
+
+static inline void PIOS_Instrumentation_recordHistogram(pios_perf_counter_t *counter, int32_t value)
+{
+    pios_perf_histogram_t *histogram = counter->histogram;
+
+    if (!histogram) {
+        return;
+    }
+    uint8_t bucket = PIOS_Instrumentation_Bucket(value);
+
+    PIOS_IRQ_Disable();
+    uint8_t bank   = histogram->bank;
+    uint16_t *slot = &histogram->histogram[bank][bucket];
+    if (*slot < UINT16_MAX) {
+        (*slot)++;
+    }
+    if (value > histogram->windowMax[bank]) {
+        histogram->windowMax[bank] = value;
+    }
+    PIOS_IRQ_Enable();
+}
+
+/*
+ * updateCounter, TimeStart/TimeEnd and TrackPeriod expect a single writer per
+ * counter and take no lock, incrementCounter may be called from several tasks.
+ */
+
 /**
  * Update a counter with a new value
  * @param counter_handle handle of the counter to update @see PIOS_Instrumentation_SearchCounter @see PIOS_Instrumentation_CreateCounter
@@ -50,9 +143,9 @@ extern int8_t pios_instrumentation_last_used_counter;
 static inline void PIOS_Instrumentation_updateCounter(pios_counter_t counter_handle, int32_t newValue)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
     counter->value = newValue;
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_MARKERS, PIOS_EVENTTRACE_MARKER_VALUE, 0, counter->id);
     counter->max--;
     if (counter->value > counter->max) {
         counter->max = counter->value;
@@ -61,8 +154,8 @@ static inline void PIOS_Instrumentation_updateCounter(pios_counter_t counter_han
     if (counter->value < counter->min) {
         counter->min = counter->value;
     }
+    PIOS_Instrumentation_recordHistogram(counter, newValue);
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
 }
 
 /**
@@ -72,11 +165,10 @@ static inline void PIOS_Instrumentation_updateCounter(pios_counter_t counter_han
 static inline void PIOS_Instrumentation_TimeStart(pios_counter_t counter_handle)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_MARKERS, PIOS_EVENTTRACE_MARKER_START, 0, counter->id);
 
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
 }
 
 /**
@@ -86,8 +178,8 @@ static inline void PIOS_Instrumentation_TimeStart(pios_counter_t counter_handle)
 static inline void PIOS_Instrumentation_TimeEnd(pios_counter_t counter_handle)
 {
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
-    vPortEnterCritical();
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_MARKERS, PIOS_EVENTTRACE_MARKER_END, 0, counter->id);
 
     counter->value = PIOS_DELAY_DiffuS(counter->lastUpdateTS);
     counter->max--;
@@ -98,8 +190,8 @@ static inline void PIOS_Instrumentation_TimeEnd(pios_counter_t counter_handle)
     if (counter->value < counter->min) {
         counter->min = counter->value;
     }
+    PIOS_Instrumentation_recordHistogram(counter, counter->value);
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
-    vPortExitCritical();
 }
 
 /**
@@ -111,7 +203,6 @@ static inline void PIOS_Instrumentation_TrackPeriod(pios_counter_t counter_handl
     PIOS_Assert(pios_instrumentation_perf_counters && counter_handle);
     pios_perf_counter_t *counter = (pios_perf_counter_t *)counter_handle;
     if (counter->lastUpdateTS != 0) {
-        vPortEnterCritical();
         uint32_t period = PIOS_DELAY_DiffuS(counter->lastUpdateTS);
         counter->value = (counter->value * 15 + period) / 16;
         counter->max--;
@@ -122,7 +213,7 @@ static inline void PIOS_Instrumentation_TrackPeriod(pios_counter_t counter_handl
         if ((int32_t)period < counter->min) {
             counter->min = period;
         }
-        vPortExitCritical();
+        PIOS_Instrumentation_recordHistogram(counter, period);
     }
     counter->lastUpdateTS = PIOS_DELAY_GetRaw();
 }
@@ -163,6 +254,15 @@ void PIOS_Instrumentation_Init(int8_t maxCounters);
  */
 pios_counter_t PIOS_Instrumentation_CreateCounter(uint32_t id);
 
+/**
+ * Create a new counter that also keeps a histogram of its values for
+ * PIOS_Instrumentation_TakePercentiles(), it costs a pios_perf_histogram_t of heap.
+ * Meant for the timing counters whose tail matters.
+ * @param id the unique id to assign to the counter
+ * @return the counter handle to be used to manage its content
+ */
+pios_counter_t PIOS_Instrumentation_CreateHistogramCounter(uint32_t id);
+
 /**
  * search a counter index by its unique Id
  * @param id the unique id to assign to the counter.
@@ -171,6 +271,14 @@ pios_counter_t PIOS_Instrumentation_CreateCounter(uint32_t id);
  */
 pios_counter_t PIOS_Instrumentation_SearchCounter(uint32_t id);
 
+/**
+ * Percentiles of the values recorded since the previous call, restarts the histogram
+ * @param counter_handle handle of the counter @see PIOS_Instrumentation_SearchCounter @see PIOS_Instrumentation_CreateCounter
+ * @param percentiles receives the sample count and the upper bound of the buckets holding p50/p99/p99.9, max is exact,
+ * no samples for a counter without histogram
+ */
+void PIOS_Instrumentation_TakePercentiles(pios_counter_t counter_handle, pios_perf_percentiles_t *percentiles);
+
 typedef void (*InstrumentationCounterCallback)(const pios_perf_counter_t *counter, const int8_t index, void *context);
 /**
  * Retrieve and execute the passed callback for each counter
@@ -63,6 +63,10 @@
  * PERF_INIT_COUNTER(counterPeriod, 0xA7710003, "ATTITUDE", "Sensor update period", "us");
  * PERF_INIT_COUNTER(counterAccelSamples, 0xA7710004, "ATTITUDE", "Samples for each sensor cycle", "count");</pre>
  *
+ * Timing counters whose tail matters can use PERF_INIT_HISTOGRAM_COUNTER instead, with the same
+ * parameters. Those also keep a histogram of their values and publish its percentiles, at the cost
+ * of a pios_perf_histogram_t of heap (316 bytes) each.
+ *
  * At this point you can start using the counters as in the following samples
  *
  * Track the time spent on a certain function:
@@ -97,6 +101,7 @@
  * this mast be called at some module init code
  */
 #define PERF_INIT_COUNTER(x, id, ...) x = PIOS_Instrumentation_CreateCounter(id)
+#define PERF_INIT_HISTOGRAM_COUNTER(x, id, ...) x = PIOS_Instrumentation_CreateHistogramCounter(id)
 
 /**
  * those are the monitoring macros
@@ -112,6 +117,7 @@
 
 #define PERF_DEFINE_COUNTER(x)
 #define PERF_INIT_COUNTER(x, id, ...)
+#define PERF_INIT_HISTOGRAM_COUNTER(x, id, ...)
 #define PERF_TIMED_SECTION_START(x)
 #define PERF_TIMED_SECTION_END(x)
 #define PERF_MEASURE_PERIOD(x)
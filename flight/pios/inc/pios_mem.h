@@ -27,6 +27,8 @@
 #ifndef PIOS_MEM_H
 #define PIOS_MEM_H
 #include <strings.h>
+#include <stdint.h>
+#include <stdbool.h>
 
 void *pios_fastheapmalloc(size_t size);
 
@@ -36,4 +38,49 @@ void *pios_realloc(void *ptr, size_t size);
 
 void pios_free(void *p);
 
+/*
+ * Pools and arenas carve many small allocations out of a few heap blocks,
+ * a pool hands out elements of one type, an arena allocations of any size.
+ * Blocks come from pios_malloc(), or pios_fastheapmalloc() for structures
+ * walked on every event, and are never given back so heap_1 targets can use
+ * them. Freed pool elements are kept for the next allocation of that pool.
+ * Callers serialize access to a pool, usually with the mutex of their list.
+ */
+#define PIOS_MEM_ALIGNMENT 8
+#define PIOS_MEM_ALIGN(size) (((size) + PIOS_MEM_ALIGNMENT - 1) & ~(PIOS_MEM_ALIGNMENT - 1))
+
+struct pios_mem_pool {
+    const char *name; // subsystem, for the report
+    uint16_t   elem_size; // 0 for an arena
+    uint16_t   block_size;
+    bool fastheap;
+    uint8_t    *block;
+    uint16_t   block_left;
+    void       *free_list;
+    uint16_t   blocks;
+    uint16_t   count; // allocations in use
+    uint32_t   heap_bytes; // taken from the heap, blocks and large arena allocations
+    uint32_t   used_bytes;
+    uint32_t   peak_bytes;
+    struct pios_mem_pool *next;
+};
+
+// a pool of type, per_block elements at a time
+#define PIOS_MEM_POOL(subsystem, type, per_block, fast) \
+    { .name = (subsystem), .elem_size = PIOS_MEM_ALIGN(sizeof(type)), .block_size = (per_block) * PIOS_MEM_ALIGN(sizeof(type)), .fastheap = (fast) }
+
+// an arena taking size bytes at a time, larger allocations get their own block
+#define PIOS_MEM_ARENA(subsystem, size, fast) \
+    { .name = (subsystem), .elem_size = 0, .block_size = (size), .fastheap = (fast) }
+
+void *pios_mem_pool_alloc(struct pios_mem_pool *pool);
+
+void pios_mem_pool_free(struct pios_mem_pool *pool, void *p);
+
+void *pios_mem_arena_alloc(struct pios_mem_pool *arena, size_t size);
+
+const struct pios_mem_pool *pios_mem_pools(void);
+
+void pios_mem_report(void (*print)(char *format, ...));
+
 #endif /* PIOS_MEM_H */
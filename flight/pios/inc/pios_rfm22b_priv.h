@@ -35,6 +35,7 @@
 #include <fifo_buffer.h>
 #include <uavobjectmanager.h>
 #include <oplinkstatus.h>
+#include <linkadapt.h>
 #include "pios_rfm22b.h"
 
 // ************************************
@@ -283,6 +284,34 @@ struct pios_rfm22b_dev {
     // Are we sending / receiving only PPM data?
     bool         ppm_only_mode;
 
+    // The configured channel range.
+    uint8_t      min_chan;
+    uint8_t      max_chan;
+
+    // Is the datarate and packet length adapted to the link quality?
+    bool         adaptive;
+    // The packet length to transmit (including parity) when adaptive.
+    uint8_t      tx_len;
+    // The datarates that can be used, from RFM22_datarate_9600 to the configured one.
+    struct linkadapt_mode adapt_modes[LINKADAPT_MAX_MODES];
+    struct linkadapt adapt;
+    // Packets received from the peer in the current window (one hop cycle).
+    uint8_t      adapt_good;
+    uint8_t      adapt_corrected;
+    // Our reception of the last window, reported to the peer.
+    uint8_t      adapt_report;
+    // The last reception reported by the peer.
+    struct linkadapt_window adapt_peer;
+    // Windows to ignore after a datarate change.
+    uint8_t      adapt_settle;
+    // A datarate change is announced.
+    bool         adapt_pending;
+    uint8_t      adapt_next;
+    portTickType adapt_switch_time;
+    portTickType adapt_window_end;
+    // The coordinator tick count the hop clock counts from.
+    portTickType adapt_epoch;
+
     // The base freq in Hertz
     uint32_t     base_freq;
 
@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_simbridge.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Sensor and actuator exchange with an external simulator
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_SIMBRIDGE_H
+#define PIOS_SIMBRIDGE_H
+
+#include "pios_simbridge_frames.h"
+
+/*
+ * Started by PIOS_SIMCLOCK for SIMPOSIX_CLOCK=bridge[:socket path]: the
+ * simulator drives the lockstep clock, each of its steps carries the sensor
+ * samples of that step. The simulated Sensors module publishes the samples
+ * once their time is reached and hands back the actuator outputs.
+ */
+struct pios_simbridge_sample {
+    uint64_t time_us; // simulated time
+    struct simbridge_sample data;
+};
+
+struct pios_simbridge_stats {
+    uint32_t steps;
+    uint32_t samples;
+    uint32_t dropped; // samples lost to a full queue
+};
+
+/* Public Functions */
+extern int32_t PIOS_SIMBRIDGE_Init(const char *path);
+extern bool PIOS_SIMBRIDGE_IsEnabled(void);
+extern bool PIOS_SIMBRIDGE_GetSample(struct pios_simbridge_sample *sample, uint64_t now);
+extern void PIOS_SIMBRIDGE_SetOutput(const struct simbridge_output *output);
+extern void PIOS_SIMBRIDGE_GetStats(struct pios_simbridge_stats *stats);
+
+#endif /* PIOS_SIMBRIDGE_H */
@@ -0,0 +1,93 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_simbridge_frames.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Frames exchanged by the simposix target and an external simulator,
+ *             shared with the simulators, keep it free of flight includes
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_SIMBRIDGE_FRAMES_H
+#define PIOS_SIMBRIDGE_FRAMES_H
+
+#include <stdint.h>
+
+/*
+ * The simulator connects to the SOCK_SEQPACKET unix socket of the target
+ * and runs the exchange, one message each way per step:
+ *
+ * simulator -> target  struct simbridge_step followed by 'samples' sensor
+ *                      samples covering the next step_us microseconds
+ * target -> simulator  struct simbridge_output, sent once the flight code
+ *                      ran step_us microseconds and all tasks wait
+ *
+ * Frames are in host byte order, both ends run on the same machine.
+ */
+#define SIMBRIDGE_MAGIC          0x424d4953 // "SIMB"
+#define SIMBRIDGE_VERSION        1
+#define SIMBRIDGE_MAX_SAMPLES    256
+#define SIMBRIDGE_MAX_CHANNELS   12
+#define SIMBRIDGE_DEFAULT_SOCKET "/tmp/simposix.sock"
+
+/* valid fields of a sample */
+enum {
+    SIMBRIDGE_GYRO     = 0x01,
+    SIMBRIDGE_ACCEL    = 0x02,
+    SIMBRIDGE_MAG      = 0x04,
+    SIMBRIDGE_BARO     = 0x08,
+    SIMBRIDGE_GPS      = 0x10,
+    SIMBRIDGE_AIRSPEED = 0x20,
+};
+
+/* units are those of the matching UAVObjects */
+struct simbridge_sample {
+    uint32_t time_us; // from the start of the step, in (0, step_us]
+    uint32_t valid;
+    float    gyro[3]; // deg/s, body frame
+    float    accel[3]; // m/s^2, body frame
+    float    mag[3]; // mGa, body frame
+    float    temperature; // deg C
+    float    baro_altitude; // m
+    float    airspeed; // calibrated, m/s
+    int32_t  latitude; // deg * 1e7
+    int32_t  longitude; // deg * 1e7
+    float    altitude; // m
+    float    velocity[3]; // m/s, north east down
+};
+
+struct simbridge_step {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t samples;
+    uint32_t step_us;
+    uint32_t reserved;
+};
+
+struct simbridge_output {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t channels;
+    uint64_t time_us; // simulated time at the end of the step
+    uint32_t armed;
+    float    desired[4]; // ActuatorDesired roll, pitch, yaw, thrust
+    int16_t  channel[SIMBRIDGE_MAX_CHANNELS]; // ActuatorCommand, us
+};
+
+#endif /* PIOS_SIMBRIDGE_FRAMES_H */
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_simclock.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Simulated clock of the posix target
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_SIMCLOCK_H
+#define PIOS_SIMCLOCK_H
+
+/*
+ * Clock modes, selected by the SIMPOSIX_CLOCK environment variable:
+ *
+ * realtime       (default) ticks and PIOS_DELAY follow the wall clock
+ * virtual        ticks are handled as soon as all tasks wait, the
+ *                simulation runs as fast as the host allows. The
+ *                simulated Sensors module paces itself on these ticks.
+ * lockstep[:port] as virtual, but time only advances when an external
+ *                simulator requests it over UDP (default port 9010):
+ *                each datagram holds the microseconds to run (uint32,
+ *                little endian), the reply once they are done and all
+ *                tasks wait is the simulated time (uint64 us, little endian).
+ * bridge[:path]  lockstep driven by a simulator connected to the unix
+ *                socket of PIOS_SIMBRIDGE (default /tmp/simposix.sock),
+ *                each step carries the sensor samples of that step.
+ *
+ * In virtual time PIOS_DELAY_WaituS/WaitmS do not wait, they move the
+ * clock of the caller forward instead.
+ */
+enum pios_simclock_mode {
+    PIOS_SIMCLOCK_REALTIME = 0,
+    PIOS_SIMCLOCK_VIRTUAL,
+    PIOS_SIMCLOCK_LOCKSTEP,
+};
+
+#define PIOS_SIMCLOCK_LOCKSTEP_PORT 9010
+
+/* Public Functions */
+extern int32_t PIOS_SIMCLOCK_Init(void);
+extern enum pios_simclock_mode PIOS_SIMCLOCK_GetMode(void);
+extern bool PIOS_SIMCLOCK_IsVirtual(void);
+extern uint64_t PIOS_SIMCLOCK_GetuS(void);
+extern void PIOS_SIMCLOCK_Skip(uint32_t uS);
+extern uint64_t PIOS_SIMCLOCK_Step(uint32_t uS);
+extern void PIOS_SIMCLOCK_IdleHook(void);
+extern void PIOS_SIMCLOCK_ExternalWaitBegin(void);
+extern void PIOS_SIMCLOCK_ExternalWaitEnd(void);
+
+#endif /* PIOS_SIMCLOCK_H */
@@ -213,9 +213,7 @@ static uint16_t PIOS_COM_RxInCallback(uint32_t context, uint8_t *buf, uint16_t b
     PIOS_Assert(valid);
     PIOS_Assert(com_dev->has_rx);
 
-    PIOS_IRQ_Disable();
     uint16_t bytes_into_fifo = fifoBuf_putData(&com_dev->rx, buf, buf_len);
-    PIOS_IRQ_Enable();
 
     if (bytes_into_fifo > 0) {
         /* Data has been added to the buffer */
@@ -240,9 +238,7 @@ static uint16_t PIOS_COM_TxOutCallback(uint32_t context, uint8_t *buf, uint16_t
     PIOS_Assert(buf_len);
     PIOS_Assert(com_dev->has_tx);
 
-    PIOS_IRQ_Disable();
     uint16_t bytes_from_fifo = fifoBuf_getData(&com_dev->tx, buf, buf_len);
-    PIOS_IRQ_Enable();
 
     if (bytes_from_fifo > 0) {
         /* More space has been made in the buffer */
@@ -288,7 +284,7 @@ int32_t PIOS_COM_ChangeBaud(uint32_t com_id, uint32_t baud)
  * \return -1 if port not available
  * \return -2 if non-blocking mode activated: buffer is full
  *            caller should retry until buffer is free again
- * \return 0 on success
+ * \return number of bytes transmitted on success
  */
 int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, uint16_t len)
 {
@@ -318,7 +314,7 @@ int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, u
         }
     }
 
-    return 0;
+    return bytes_into_fifo;
 }
 
 /**
@@ -328,7 +324,7 @@ int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, u
  * \param[in] buffer character buffer
  * \param[in] len buffer length
  * \return -1 if port not available
- * \return 0 on success
+ * \return number of bytes transmitted on success
  */
 int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len)
 {
@@ -474,10 +470,10 @@ uint16_t PIOS_COM_ReceiveBuffer(uint32_t com_id, uint8_t *buf, uint16_t buf_len,
     }
     PIOS_Assert(com_dev->has_rx);
 
+    uint16_t bytes_from_fifo;
+
 check_again:
-    PIOS_IRQ_Disable();
-    uint16_t bytes_from_fifo = fifoBuf_getData(&com_dev->rx, buf, buf_len);
-    PIOS_IRQ_Enable();
+    bytes_from_fifo = fifoBuf_getData(&com_dev->rx, buf, buf_len);
 
     if (bytes_from_fifo == 0 && timeout_ms > 0) {
         /* No more bytes in receive buffer */
@@ -504,6 +500,69 @@ check_again:
     return bytes_from_fifo;
 }
 
+/**
+ * Get received bytes in place, without copying them out of the port buffer.
+ * The bytes stay in the buffer until released with PIOS_COM_ReceiveCommit().
+ * \param[in] port COM port
+ * \param[out] span first received byte
+ * \param[in] timeout_ms maximum time to wait for data
+ * \return number of contiguous bytes at span, 0 on timeout
+ */
+uint16_t PIOS_COM_ReceiveAcquire(uint32_t com_id, uint8_t **span, uint32_t timeout_ms)
+{
+    PIOS_Assert(span);
+
+    struct pios_com_dev *com_dev = PIOS_COM_find_dev(com_id);
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        PIOS_Assert(0);
+    }
+    PIOS_Assert(com_dev->has_rx);
+
+    uint16_t bytes_from_fifo;
+
+check_again:
+    bytes_from_fifo = fifoBuf_acquireRead(&com_dev->rx, span);
+
+    if (bytes_from_fifo == 0 && timeout_ms > 0) {
+        /* No more bytes in receive buffer */
+        /* Make sure the receiver is running while we wait */
+        if (com_dev->driver->rx_start) {
+            /* Notify the lower layer that there is now room in the rx buffer */
+            (com_dev->driver->rx_start)(com_dev->lower_id,
+                                        fifoBuf_getFree(&com_dev->rx));
+        }
+#if defined(PIOS_INCLUDE_FREERTOS)
+        if (xSemaphoreTake(com_dev->rx_sem, timeout_ms / portTICK_RATE_MS) == pdTRUE) {
+            /* Make sure we don't come back here again */
+            timeout_ms = 0;
+            goto check_again;
+        }
+#else
+        PIOS_DELAY_WaitmS(1);
+        timeout_ms--;
+        goto check_again;
+#endif
+    }
+
+    return bytes_from_fifo;
+}
+
+/**
+ * Release bytes obtained with PIOS_COM_ReceiveAcquire()
+ * \param[in] port COM port
+ * \param[in] len number of bytes processed, at most the acquired length
+ */
+void PIOS_COM_ReceiveCommit(uint32_t com_id, uint16_t len)
+{
+    struct pios_com_dev *com_dev = PIOS_COM_find_dev(com_id);
+
+    PIOS_Assert(PIOS_COM_validate(com_dev));
+
+    fifoBuf_commitRead(&com_dev->rx, len);
+}
+
 /**
  * Query if a com port is available for use.  That can be
  * used to check a link is established even if the device
@@ -80,6 +80,7 @@ extern "C" {
 /* #define PIOS_ENABLE_DEBUG_PINS */
 #include <pios_debug.h>
 #include <pios_debuglog.h>
+#include <pios_eventtrace.h>
 
 /* PIOS common functions */
 #include <pios_crc.h>
@@ -83,11 +83,18 @@ extern void PIOS_LED_Init(void);
 #include <pios_irq.h>
 #include <pios_sdcard.h>
 #include <pios_udp.h>
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+#include <pios_simclock.h>
+#endif
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+#include <pios_simbridge.h>
+#endif
 #include <pios_com.h>
 #include <pios_servo.h>
 #include <pios_wdg.h>
 #include <pios_debug.h>
 #include <pios_debuglog.h>
+#include <pios_eventtrace.h>
 #include <pios_deltatime.h>
 #include <pios_crc.h>
 #include <pios_rcvr.h>
@@ -63,6 +63,13 @@ int32_t PIOS_DELAY_WaituS(uint32_t uS)
 {
     static struct timespec wait, rest;
 
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+    if (PIOS_SIMCLOCK_IsVirtual()) {
+        PIOS_SIMCLOCK_Skip(uS);
+        return 0;
+    }
+#endif
+
     wait.tv_sec  = 0;
     wait.tv_nsec = 1000 * uS;
     while (nanosleep(&wait, &rest) != 0) {
@@ -90,6 +97,13 @@ int32_t PIOS_DELAY_WaitmS(uint32_t mS)
     // PIOS_DELAY_WaituS(1000);
     static struct timespec wait, rest;
 
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+    if (PIOS_SIMCLOCK_IsVirtual()) {
+        PIOS_SIMCLOCK_Skip(mS * 1000);
+        return 0;
+    }
+#endif
+
     wait.tv_sec  = mS / 1000;
     wait.tv_nsec = (mS % 1000) * 1000000;
     while (nanosleep(&wait, &rest) != 0) {
@@ -109,6 +123,11 @@ uint32_t PIOS_DELAY_GetuS()
 {
     static struct timespec current;
 
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+    if (PIOS_SIMCLOCK_IsVirtual()) {
+        return (uint32_t)PIOS_SIMCLOCK_GetuS();
+    }
+#endif
     clock_gettime(CLOCK_REALTIME, &current);
     return (current.tv_sec * 1000000) + (current.tv_nsec / 1000);
 }
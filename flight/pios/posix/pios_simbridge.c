@@ -0,0 +1,272 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_simbridge.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Sensor and actuator exchange with an external simulator
+ *                 - Batched sensor samples over a unix socket, in lockstep
+ *                   with the simulated clock
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   PIOS_SIMBRIDGE Simulator bridge
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/* Project Includes */
+#include "pios.h"
+
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+
+#if !defined(PIOS_INCLUDE_SIMCLOCK)
+#error PIOS_SIMBRIDGE requires PIOS_INCLUDE_SIMCLOCK
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/* samples queued, room for a few steps of the largest size */
+#define PIOS_SIMBRIDGE_QUEUE_LEN     1024
+#define PIOS_SIMBRIDGE_OUTPUT_TRIES  100
+
+static bool enabled;
+
+/*
+ * Samples go from the bridge thread to the Sensors task through a single
+ * producer, single consumer queue. It takes no lock: a task may be suspended
+ * by the scheduler at any point and the bridge thread must never wait for it.
+ */
+static struct pios_simbridge_sample queue[PIOS_SIMBRIDGE_QUEUE_LEN];
+static volatile uint32_t queue_head; // written by the bridge thread
+static volatile uint32_t queue_tail; // written by the Sensors task
+
+/*
+ * Latest actuator outputs, the sequence is odd while they are written.
+ * The reader gives up after a few tries and sends the previous outputs,
+ * the writer may be a task suspended in the middle of an update.
+ */
+static struct simbridge_output output;
+static volatile uint32_t output_sequence;
+
+static struct pios_simbridge_stats stats;
+
+static void *PIOS_SIMBRIDGE_Thread(void *arg);
+
+/**
+ * Opens the socket of the simulator and starts the bridge thread, the
+ * simulated clock must be in lockstep mode
+ * \param[in] path of the unix socket, SIMBRIDGE_DEFAULT_SOCKET if NULL or empty
+ * \return < 0 if the socket could not be opened
+ */
+int32_t PIOS_SIMBRIDGE_Init(const char *path)
+{
+    struct sockaddr_un server;
+    int sock;
+
+    if (!path || !path[0]) {
+        path = SIMBRIDGE_DEFAULT_SOCKET;
+    }
+    if (strlen(path) >= sizeof(server.sun_path)) {
+        printf("PIOS_SIMBRIDGE: socket path too long %s\n", path);
+        return -1;
+    }
+
+    memset(&server, 0, sizeof(server));
+    server.sun_family = AF_UNIX;
+    strcpy(server.sun_path, path);
+    unlink(path);
+
+    sock = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (sock < 0 || bind(sock, (struct sockaddr *)&server, sizeof(server)) < 0 || listen(sock, 1) < 0) {
+        printf("PIOS_SIMBRIDGE: cannot open socket %s\n", path);
+        if (sock >= 0) {
+            close(sock);
+        }
+        return -1;
+    }
+
+    output.magic    = SIMBRIDGE_MAGIC;
+    output.version  = SIMBRIDGE_VERSION;
+    output.channels = SIMBRIDGE_MAX_CHANNELS;
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, PIOS_SIMBRIDGE_Thread, (void *)(intptr_t)sock);
+    pthread_detach(thread);
+
+    enabled = true;
+    printf("PIOS_SIMBRIDGE: waiting for the simulator on %s\n", path);
+
+    return 0;
+}
+
+bool PIOS_SIMBRIDGE_IsEnabled(void)
+{
+    return enabled;
+}
+
+/**
+ * Takes the next sample due, to be called by a single task
+ * \param[out] sample
+ * \param[in] now simulated time, samples after it are left in the queue
+ * \return false if no sample is due
+ */
+bool PIOS_SIMBRIDGE_GetSample(struct pios_simbridge_sample *sample, uint64_t now)
+{
+    uint32_t tail = queue_tail;
+
+    if (tail == queue_head) {
+        return false;
+    }
+    __sync_synchronize();
+
+    const struct pios_simbridge_sample *next = &queue[tail % PIOS_SIMBRIDGE_QUEUE_LEN];
+    if (next->time_us > now) {
+        return false;
+    }
+    *sample = *next;
+
+    __sync_synchronize();
+    queue_tail = tail + 1;
+
+    return true;
+}
+
+/**
+ * Sets the actuator outputs sent to the simulator at the end of each step,
+ * to be called by a single task
+ */
+void PIOS_SIMBRIDGE_SetOutput(const struct simbridge_output *new_output)
+{
+    output_sequence++;
+    __sync_synchronize();
+
+    memcpy(output.desired, new_output->desired, sizeof(output.desired));
+    memcpy(output.channel, new_output->channel, sizeof(output.channel));
+    output.armed = new_output->armed;
+
+    __sync_synchronize();
+    output_sequence++;
+}
+
+void PIOS_SIMBRIDGE_GetStats(struct pios_simbridge_stats *out)
+{
+    *out = stats;
+}
+
+static void PIOS_SIMBRIDGE_PutSample(uint64_t start, const struct simbridge_sample *data)
+{
+    uint32_t head = queue_head;
+
+    if (head - queue_tail >= PIOS_SIMBRIDGE_QUEUE_LEN) {
+        stats.dropped++;
+        return;
+    }
+
+    struct pios_simbridge_sample *sample = &queue[head % PIOS_SIMBRIDGE_QUEUE_LEN];
+    sample->time_us = start + data->time_us;
+    sample->data    = *data;
+
+    __sync_synchronize();
+    queue_head = head + 1;
+    stats.samples++;
+}
+
+static void PIOS_SIMBRIDGE_ReadOutput(struct simbridge_output *out)
+{
+    static struct simbridge_output last;
+
+    for (int i = 0; i < PIOS_SIMBRIDGE_OUTPUT_TRIES; i++) {
+        uint32_t sequence = output_sequence;
+
+        if (!(sequence & 1)) {
+            __sync_synchronize();
+            *out = output;
+            __sync_synchronize();
+            if (sequence == output_sequence) {
+                last = *out;
+                return;
+            }
+        }
+        sched_yield();
+    }
+
+    *out = last;
+}
+
+/**
+ * Runs the steps of the connected simulator, one at a time
+ */
+static void *PIOS_SIMBRIDGE_Thread(void *arg)
+{
+    int server = (int)(intptr_t)arg;
+    static struct {
+        struct simbridge_step   step;
+        struct simbridge_sample sample[SIMBRIDGE_MAX_SAMPLES];
+    } frame;
+
+    while (1) {
+        int client = accept(server, NULL, NULL);
+
+        if (client < 0) {
+            continue;
+        }
+        printf("PIOS_SIMBRIDGE: simulator connected\n");
+
+        ssize_t length;
+        while ((length = recv(client, &frame, sizeof(frame), 0)) > 0) {
+            if ((size_t)length < sizeof(frame.step) ||
+                frame.step.magic != SIMBRIDGE_MAGIC ||
+                frame.step.version != SIMBRIDGE_VERSION ||
+                (size_t)length != sizeof(frame.step) + frame.step.samples * sizeof(struct simbridge_sample)) {
+                printf("PIOS_SIMBRIDGE: invalid frame of %d bytes\n", (int)length);
+                break;
+            }
+
+            uint64_t start = PIOS_SIMCLOCK_GetuS();
+            for (int i = 0; i < frame.step.samples; i++) {
+                PIOS_SIMBRIDGE_PutSample(start, &frame.sample[i]);
+            }
+            stats.steps++;
+
+            uint64_t now = PIOS_SIMCLOCK_Step(frame.step.step_us);
+
+            struct simbridge_output out;
+            PIOS_SIMBRIDGE_ReadOutput(&out);
+            out.time_us  = now;
+            out.magic    = SIMBRIDGE_MAGIC;
+            out.version  = SIMBRIDGE_VERSION;
+            out.channels = SIMBRIDGE_MAX_CHANNELS;
+
+            if (send(client, &out, sizeof(out), MSG_NOSIGNAL) < 0) {
+                break;
+            }
+        }
+
+        close(client);
+        printf("PIOS_SIMBRIDGE: simulator disconnected\n");
+    }
+
+    return NULL;
+}
+
+#endif /* PIOS_INCLUDE_SIMBRIDGE */
+
+/**
+ * @}
+ */
@@ -0,0 +1,263 @@
+/**
+ ******************************************************************************
+ *
+ * @file       pios_simclock.c
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Simulated clock of the posix target
+ *                 - Virtual FreeRTOS ticks, optionally in lockstep with an
+ *                   external simulator over UDP or the simulator bridge
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   PIOS_SIMCLOCK Simulated clock
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/* Project Includes */
+#include "pios.h"
+
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+
+#if !defined(PIOS_INCLUDE_FREERTOS) || (configUSE_VIRTUAL_TICK != 1)
+#error PIOS_SIMCLOCK requires PIOS_INCLUDE_FREERTOS and configUSE_VIRTUAL_TICK
+#endif
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+/* sleep of the idle task in virtual time */
+#define PIOS_SIMCLOCK_IDLE_NAP_US 20
+
+static enum pios_simclock_mode mode = PIOS_SIMCLOCK_REALTIME;
+
+/* time skipped by busy waits, on top of the ticks */
+static volatile uint64_t skipped_us;
+
+/* lockstep: ticks granted by the driver and not handled yet */
+static pthread_mutex_t step_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t step_cond   = PTHREAD_COND_INITIALIZER;
+static uint32_t step_ticks;
+static bool step_waiting;
+
+static void *PIOS_SIMCLOCK_LockstepThread(void *arg);
+
+/**
+ * Selects the clock mode, must be called before the scheduler is started.
+ * The mode only changes once the lockstep or bridge socket is open.
+ * \return < 0 if the lockstep or bridge socket could not be opened, the
+ * clock stays in realtime then
+ */
+int32_t PIOS_SIMCLOCK_Init(void)
+{
+    const char *env    = getenv("SIMPOSIX_CLOCK");
+    const char *bridge = NULL;
+    uint16_t port = PIOS_SIMCLOCK_LOCKSTEP_PORT;
+    enum pios_simclock_mode selected;
+
+    if (!env || !strcmp(env, "realtime")) {
+        mode = PIOS_SIMCLOCK_REALTIME;
+        return 0;
+    } else if (!strcmp(env, "virtual")) {
+        selected = PIOS_SIMCLOCK_VIRTUAL;
+    } else if (!strncmp(env, "lockstep", 8)) {
+        selected = PIOS_SIMCLOCK_LOCKSTEP;
+        if (env[8] == ':') {
+            port = atoi(env + 9);
+        }
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+    } else if (!strncmp(env, "bridge", 6)) {
+        selected = PIOS_SIMCLOCK_LOCKSTEP;
+        bridge   = (env[6] == ':') ? env + 7 : SIMBRIDGE_DEFAULT_SOCKET;
+#endif
+    } else {
+        printf("PIOS_SIMCLOCK: unknown clock mode %s, using realtime\n", env);
+        return 0;
+    }
+
+#if defined(PIOS_INCLUDE_SIMBRIDGE)
+    if (bridge) {
+        /* the bridge steps the clock with the sensor samples */
+        if (PIOS_SIMBRIDGE_Init(bridge) < 0) {
+            return -1;
+        }
+    } else
+#endif
+    if (selected == PIOS_SIMCLOCK_LOCKSTEP) {
+        struct sockaddr_in server;
+        int sock = socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+        memset(&server, 0, sizeof(server));
+        server.sin_family = AF_INET;
+        server.sin_addr.s_addr = htonl(INADDR_ANY);
+        server.sin_port = htons(port);
+        if (sock < 0 || bind(sock, (struct sockaddr *)&server, sizeof(server)) < 0) {
+            printf("PIOS_SIMCLOCK: cannot open lockstep port %u\n", port);
+            if (sock >= 0) {
+                close(sock);
+            }
+            return -1;
+        }
+
+        pthread_t thread;
+        pthread_create(&thread, NULL, PIOS_SIMCLOCK_LockstepThread, (void *)(intptr_t)sock);
+        pthread_detach(thread);
+        printf("PIOS_SIMCLOCK: lockstep on udp port %u\n", port);
+    } else {
+        printf("PIOS_SIMCLOCK: virtual time\n");
+    }
+
+    /* steps requested before this wait for the first virtual tick */
+    mode = selected;
+    vPortEnableVirtualTick();
+
+    return 0;
+}
+
+enum pios_simclock_mode PIOS_SIMCLOCK_GetMode(void)
+{
+    return mode;
+}
+
+bool PIOS_SIMCLOCK_IsVirtual(void)
+{
+    return mode != PIOS_SIMCLOCK_REALTIME;
+}
+
+/**
+ * Simulated time since start, in microseconds
+ */
+uint64_t PIOS_SIMCLOCK_GetuS(void)
+{
+    return (uint64_t)xPortGetVirtualTickCount() * portTICK_RATE_MICROSECONDS + __sync_fetch_and_add(&skipped_us, 0);
+}
+
+/**
+ * Moves the clock forward without waiting, for busy waits in virtual time
+ */
+void PIOS_SIMCLOCK_Skip(uint32_t uS)
+{
+    __sync_fetch_and_add(&skipped_us, uS);
+}
+
+/**
+ * Lockstep: runs the tasks for uS microseconds of simulated time, rounded up
+ * to ticks, and returns when all of them wait for the next tick.
+ * Must be called from outside the scheduler.
+ * \return the simulated time
+ */
+uint64_t PIOS_SIMCLOCK_Step(uint32_t uS)
+{
+    pthread_mutex_lock(&step_mutex);
+    step_ticks  += (uS + portTICK_RATE_MICROSECONDS - 1) / portTICK_RATE_MICROSECONDS;
+    step_waiting = false;
+    pthread_cond_broadcast(&step_cond);
+    while (step_ticks > 0 || !step_waiting) {
+        pthread_cond_wait(&step_cond, &step_mutex);
+    }
+    pthread_mutex_unlock(&step_mutex);
+
+    return PIOS_SIMCLOCK_GetuS();
+}
+
+/**
+ * To be called by the idle task: in virtual time it has nothing to do until
+ * the next tick, sleeping lets the tick come at once instead of after the
+ * host preempts the busy idle thread
+ */
+void PIOS_SIMCLOCK_IdleHook(void)
+{
+    static const struct timespec nap = { 0, 1000 * PIOS_SIMCLOCK_IDLE_NAP_US };
+
+    if (mode != PIOS_SIMCLOCK_REALTIME) {
+        nanosleep(&nap, NULL);
+    }
+}
+
+/**
+ * Tasks blocked in system calls, virtual time goes on while they wait
+ */
+void PIOS_SIMCLOCK_ExternalWaitBegin(void)
+{
+    if (mode != PIOS_SIMCLOCK_REALTIME) {
+        vPortEnterExternalWait();
+    }
+}
+
+void PIOS_SIMCLOCK_ExternalWaitEnd(void)
+{
+    if (mode != PIOS_SIMCLOCK_REALTIME) {
+        vPortExitExternalWait();
+    }
+}
+
+/**
+ * Called by the port before each virtual tick, holds the tick until the
+ * lockstep driver grants time
+ */
+void vApplicationVirtualTickWait(void)
+{
+    if (mode != PIOS_SIMCLOCK_LOCKSTEP) {
+        return;
+    }
+
+    pthread_mutex_lock(&step_mutex);
+    while (step_ticks == 0) {
+        step_waiting = true;
+        pthread_cond_broadcast(&step_cond);
+        pthread_cond_wait(&step_cond, &step_mutex);
+    }
+    step_waiting = false;
+    step_ticks--;
+    pthread_mutex_unlock(&step_mutex);
+}
+
+/**
+ * Lockstep driver, one step per datagram from the simulator
+ */
+static void *PIOS_SIMCLOCK_LockstepThread(void *arg)
+{
+    int sock = (int)(intptr_t)arg;
+
+    while (1) {
+        struct sockaddr_in client;
+        socklen_t length = sizeof(client);
+        uint8_t buffer[8];
+
+        if (recvfrom(sock, buffer, sizeof(buffer), 0, (struct sockaddr *)&client, &length) < 4) {
+            continue;
+        }
+
+        uint32_t step = buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+        uint64_t now  = PIOS_SIMCLOCK_Step(step);
+
+        for (int i = 0; i < 8; i++) {
+            buffer[i] = now >> (8 * i);
+        }
+        sendto(sock, buffer, sizeof(buffer), 0, (struct sockaddr *)&client, length);
+    }
+
+    return NULL;
+}
+
+#endif /* PIOS_INCLUDE_SIMCLOCK */
+
+/**
+ * @}
+ */
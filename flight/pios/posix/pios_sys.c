@@ -53,6 +53,16 @@ void PIOS_SYS_Init(void)
     /* Initialise Basic NVIC */
     NVIC_Configuration();
 
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+    /* Select real or simulated time before the scheduler starts. A simulator
+     * expecting to drive the clock would hang, or drive another instance that
+     * holds the port, so do not go on in realtime. */
+    if (PIOS_SIMCLOCK_Init() < 0) {
+        fprintf(stderr, "PIOS_SYS_Init: cannot start the %s clock, exiting\n", getenv("SIMPOSIX_CLOCK"));
+        exit(1);
+    }
+#endif
+
 #if defined(PIOS_INCLUDE_LED)
     /* Initialise LEDs */
     PIOS_LED_Init();
@@ -88,12 +88,19 @@ void *PIOS_UDP_RxThread(void *udp_dev_n)
          */
         int received;
         udp_dev->clientLength = sizeof(udp_dev->client);
-        if ((received = recvfrom(udp_dev->socket,
-                                 &udp_dev->rx_buffer,
-                                 PIOS_UDP_RX_BUFFER_SIZE,
-                                 0,
-                                 (struct sockaddr *)&udp_dev->client,
-                                 (socklen_t *)&udp_dev->clientLength)) >= 0) {
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+        PIOS_SIMCLOCK_ExternalWaitBegin();
+#endif
+        received = recvfrom(udp_dev->socket,
+                            &udp_dev->rx_buffer,
+                            PIOS_UDP_RX_BUFFER_SIZE,
+                            0,
+                            (struct sockaddr *)&udp_dev->client,
+                            (socklen_t *)&udp_dev->clientLength);
+#if defined(PIOS_INCLUDE_SIMCLOCK)
+        PIOS_SIMCLOCK_ExternalWaitEnd();
+#endif
+        if (received >= 0) {
             /* copy received data to buffer if possible */
             /* we do NOT buffer data locally. If the com buffer can't receive, data is discarded! */
             /* (thats what the USART driver does too!) */
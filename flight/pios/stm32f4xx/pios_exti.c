@@ -190,7 +190,10 @@ int32_t PIOS_EXTI_DeInit(const struct pios_exti_cfg *cfg)
 static bool PIOS_EXTI_generic_irq_handler(uint8_t line_index)
 {
     if (pios_exti_vector[line_index]) {
-        return pios_exti_vector[line_index]();
+        PIOS_EVENTTRACE_ISR_ENTER();
+        bool woken = pios_exti_vector[line_index]();
+        PIOS_EVENTTRACE_ISR_EXIT();
+        return woken;
     }
 
     /* Unconfigured interrupt just fired! */
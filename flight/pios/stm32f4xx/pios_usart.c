@@ -42,17 +42,19 @@
 static void PIOS_USART_ChangeBaud(uint32_t usart_id, uint32_t baud);
 static void PIOS_USART_SetCtrlLine(uint32_t usart_id, uint32_t mask, uint32_t state);
 static void PIOS_USART_RegisterRxCallback(uint32_t usart_id, pios_com_callback rx_in_cb, uint32_t context);
+static void PIOS_USART_RegisterRxSpanCallback(uint32_t usart_id, pios_com_callback_rx_acquire rx_acquire_cb, pios_com_callback_rx_commit rx_commit_cb, uint32_t context);
 static void PIOS_USART_RegisterTxCallback(uint32_t usart_id, pios_com_callback tx_out_cb, uint32_t context);
 static void PIOS_USART_TxStart(uint32_t usart_id, uint16_t tx_bytes_avail);
 static void PIOS_USART_RxStart(uint32_t usart_id, uint16_t rx_bytes_avail);
 
 const struct pios_com_driver pios_usart_com_driver = {
-    .set_baud      = PIOS_USART_ChangeBaud,
-    .set_ctrl_line = PIOS_USART_SetCtrlLine,
-    .tx_start      = PIOS_USART_TxStart,
-    .rx_start      = PIOS_USART_RxStart,
-    .bind_tx_cb    = PIOS_USART_RegisterTxCallback,
-    .bind_rx_cb    = PIOS_USART_RegisterRxCallback,
+    .set_baud        = PIOS_USART_ChangeBaud,
+    .set_ctrl_line   = PIOS_USART_SetCtrlLine,
+    .tx_start        = PIOS_USART_TxStart,
+    .rx_start        = PIOS_USART_RxStart,
+    .bind_tx_cb      = PIOS_USART_RegisterTxCallback,
+    .bind_rx_cb      = PIOS_USART_RegisterRxCallback,
+    .bind_rx_span_cb = PIOS_USART_RegisterRxSpanCallback,
 };
 
 enum pios_usart_dev_magic {
@@ -65,6 +67,9 @@ struct pios_usart_dev {
 
     pios_com_callback rx_in_cb;
     uint32_t rx_in_context;
+    pios_com_callback_rx_acquire rx_acquire_cb;
+    pios_com_callback_rx_commit  rx_commit_cb;
+    uint32_t rx_span_context;
     pios_com_callback tx_out_cb;
     uint32_t tx_out_context;
 };
@@ -312,10 +317,30 @@ static void PIOS_USART_RegisterRxCallback(uint32_t usart_id, pios_com_callback r
      * Order is important in these assignments since ISR uses _cb
      * field to determine if it's ok to dereference _cb and _context
      */
+    usart_dev->rx_commit_cb  = NULL;
     usart_dev->rx_in_context = context;
     usart_dev->rx_in_cb = rx_in_cb;
 }
 
+static void PIOS_USART_RegisterRxSpanCallback(uint32_t usart_id, pios_com_callback_rx_acquire rx_acquire_cb, pios_com_callback_rx_commit rx_commit_cb, uint32_t context)
+{
+    struct pios_usart_dev *usart_dev = (struct pios_usart_dev *)usart_id;
+
+    bool valid = PIOS_USART_validate(usart_dev);
+
+    PIOS_Assert(valid);
+
+    /*
+     * Order is important in these assignments since ISR uses _commit_cb
+     * field to determine if it's ok to dereference the others
+     */
+    usart_dev->rx_in_cb        = NULL;
+    usart_dev->rx_commit_cb    = NULL;
+    usart_dev->rx_span_context = context;
+    usart_dev->rx_acquire_cb   = rx_acquire_cb;
+    usart_dev->rx_commit_cb    = rx_commit_cb;
+}
+
 static void PIOS_USART_RegisterTxCallback(uint32_t usart_id, pios_com_callback tx_out_cb, uint32_t context)
 {
     struct pios_usart_dev *usart_dev = (struct pios_usart_dev *)usart_id;
@@ -334,6 +359,8 @@ static void PIOS_USART_RegisterTxCallback(uint32_t usart_id, pios_com_callback t
 
 static void PIOS_USART_generic_irq_handler(uint32_t usart_id)
 {
+    PIOS_EVENTTRACE_ISR_ENTER();
+
     struct pios_usart_dev *usart_dev = (struct pios_usart_dev *)usart_id;
 
     bool valid = PIOS_USART_validate(usart_dev);
@@ -348,7 +375,14 @@ static void PIOS_USART_generic_irq_handler(uint32_t usart_id)
     bool rx_need_yield   = false;
     if (sr & USART_SR_RXNE) {
         uint8_t byte = dr;
-        if (usart_dev->rx_in_cb) {
+        if (usart_dev->rx_commit_cb) {
+            /* Straight into the receive buffer, dropped when it is full */
+            uint8_t *span;
+            if ((usart_dev->rx_acquire_cb)(usart_dev->rx_span_context, &span) > 0) {
+                *span = byte;
+                (void)(usart_dev->rx_commit_cb)(usart_dev->rx_span_context, 1, &rx_need_yield);
+            }
+        } else if (usart_dev->rx_in_cb) {
             (void)(usart_dev->rx_in_cb)(usart_dev->rx_in_context, &byte, 1, NULL, &rx_need_yield);
         }
     }
@@ -375,6 +409,8 @@ static void PIOS_USART_generic_irq_handler(uint32_t usart_id)
         }
     }
 
+    PIOS_EVENTTRACE_ISR_EXIT();
+
 #if defined(PIOS_INCLUDE_FREERTOS)
     if (rx_need_yield || tx_need_yield) {
         vPortYield();
@@ -40,6 +40,7 @@
 /* Implement COM layer driver API */
 static void PIOS_USB_CDC_RegisterTxCallback(uint32_t usbcdc_id, pios_com_callback tx_out_cb, uint32_t context);
 static void PIOS_USB_CDC_RegisterRxCallback(uint32_t usbcdc_id, pios_com_callback rx_in_cb, uint32_t context);
+static void PIOS_USB_CDC_RegisterRxSpanCallback(uint32_t usbcdc_id, pios_com_callback_rx_acquire rx_acquire_cb, pios_com_callback_rx_commit rx_commit_cb, uint32_t context);
 static void PIOS_USB_CDC_RegisterCtrlLineCallback(uint32_t usbcdc_id, pios_com_callback_ctrl_line ctrl_line_cb, uint32_t context);
 static void PIOS_USB_CDC_RegisterBaudRateCallback(uint32_t usbcdc_id, pios_com_callback_baud_rate baud_rate_cb, uint32_t context);
 static void PIOS_USB_CDC_RegisterAvailableCallback(uint32_t usbcdc_id, pios_com_callback_available baud_rate_cb, uint32_t context);
@@ -53,6 +54,7 @@ const struct pios_com_driver pios_usb_cdc_com_driver = {
     .rx_start   = PIOS_USB_CDC_RxStart,
     .bind_tx_cb = PIOS_USB_CDC_RegisterTxCallback,
     .bind_rx_cb = PIOS_USB_CDC_RegisterRxCallback,
+    .bind_rx_span_cb   = PIOS_USB_CDC_RegisterRxSpanCallback,
     .bind_ctrl_line_cb = PIOS_USB_CDC_RegisterCtrlLineCallback,
     .bind_baud_rate_cb = PIOS_USB_CDC_RegisterBaudRateCallback,
     .available  = PIOS_USB_CDC_Available,
@@ -71,6 +73,9 @@ struct pios_usb_cdc_dev {
 
     pios_com_callback rx_in_cb;
     uint32_t rx_in_context;
+    pios_com_callback_rx_acquire rx_acquire_cb;
+    pios_com_callback_rx_commit  rx_commit_cb;
+    uint32_t rx_span_context;
     pios_com_callback tx_out_cb;
     uint32_t tx_out_context;
     pios_com_callback_ctrl_line ctrl_line_cb;
@@ -84,6 +89,8 @@ struct pios_usb_cdc_dev {
     bool     usb_data_if_enabled;
 
     uint8_t  rx_packet_buffer[PIOS_USB_BOARD_CDC_DATA_LENGTH] __attribute__((aligned(4)));
+    /* Where the armed OUT transfer lands, rx_packet_buffer or the receive span */
+    uint8_t  *rx_buffer;
     volatile bool rx_active;
 
     /*
@@ -257,6 +264,26 @@ static bool PIOS_USB_CDC_SendData(struct pios_usb_cdc_dev *usb_cdc_dev)
     return true;
 }
 
+/*
+ * Arm the OUT endpoint. With a receive span bound the packet goes straight
+ * into the COM receive buffer when a whole packet fits there contiguously,
+ * otherwise (and with a copying rx callback) through rx_packet_buffer.
+ */
+static void PIOS_USB_CDC_ArmRx(struct pios_usb_cdc_dev *usb_cdc_dev)
+{
+    uint8_t *span = usb_cdc_dev->rx_packet_buffer;
+
+    if (usb_cdc_dev->rx_commit_cb &&
+        (usb_cdc_dev->rx_acquire_cb)(usb_cdc_dev->rx_span_context, &span) < sizeof(usb_cdc_dev->rx_packet_buffer)) {
+        span = usb_cdc_dev->rx_packet_buffer;
+    }
+
+    usb_cdc_dev->rx_buffer = span;
+    PIOS_USBHOOK_EndpointRx(usb_cdc_dev->cfg->data_rx_ep,
+                            span,
+                            sizeof(usb_cdc_dev->rx_packet_buffer));
+}
+
 static void PIOS_USB_CDC_RxStart(uint32_t usbcdc_id, uint16_t rx_bytes_avail)
 {
     struct pios_usb_cdc_dev *usb_cdc_dev = (struct pios_usb_cdc_dev *)usbcdc_id;
@@ -276,9 +303,7 @@ static void PIOS_USB_CDC_RxStart(uint32_t usbcdc_id, uint16_t rx_bytes_avail)
 
     // If endpoint was stalled and there is now space make it valid
     if (!usb_cdc_dev->rx_active && (rx_bytes_avail >= PIOS_USB_BOARD_CDC_DATA_LENGTH)) {
-        PIOS_USBHOOK_EndpointRx(usb_cdc_dev->cfg->data_rx_ep,
-                                usb_cdc_dev->rx_packet_buffer,
-                                sizeof(usb_cdc_dev->rx_packet_buffer));
+        PIOS_USB_CDC_ArmRx(usb_cdc_dev);
         usb_cdc_dev->rx_active = true;
     }
 }
@@ -318,10 +343,30 @@ static void PIOS_USB_CDC_RegisterRxCallback(uint32_t usbcdc_id, pios_com_callbac
      * Order is important in these assignments since ISR uses _cb
      * field to determine if it's ok to dereference _cb and _context
      */
+    usb_cdc_dev->rx_commit_cb  = NULL;
     usb_cdc_dev->rx_in_context = context;
     usb_cdc_dev->rx_in_cb = rx_in_cb;
 }
 
+static void PIOS_USB_CDC_RegisterRxSpanCallback(uint32_t usbcdc_id, pios_com_callback_rx_acquire rx_acquire_cb, pios_com_callback_rx_commit rx_commit_cb, uint32_t context)
+{
+    struct pios_usb_cdc_dev *usb_cdc_dev = (struct pios_usb_cdc_dev *)usbcdc_id;
+
+    bool valid = PIOS_USB_CDC_validate(usb_cdc_dev);
+
+    PIOS_Assert(valid);
+
+    /*
+     * Order is important in these assignments since ISR uses _commit_cb
+     * field to determine if it's ok to dereference the others
+     */
+    usb_cdc_dev->rx_in_cb        = NULL;
+    usb_cdc_dev->rx_commit_cb    = NULL;
+    usb_cdc_dev->rx_span_context = context;
+    usb_cdc_dev->rx_acquire_cb   = rx_acquire_cb;
+    usb_cdc_dev->rx_commit_cb    = rx_commit_cb;
+}
+
 static void PIOS_USB_CDC_RegisterTxCallback(uint32_t usbcdc_id, pios_com_callback tx_out_cb, uint32_t context)
 {
     struct pios_usb_cdc_dev *usb_cdc_dev = (struct pios_usb_cdc_dev *)usbcdc_id;
@@ -568,7 +613,7 @@ static bool PIOS_USB_CDC_CTRL_EP_IN_Callback(
         /* Someone is going to providing FC->PC data, advertise an RxCarrier to the host */
         new_uart_state |= 0x1;
     }
-    if (usb_cdc_dev->rx_in_cb) {
+    if (usb_cdc_dev->rx_in_cb || usb_cdc_dev->rx_commit_cb) {
         /* Someone is consuming PC->FC data, advertise a TxCarrier to the host */
         new_uart_state |= 0x2;
     }
@@ -685,21 +730,44 @@ static bool PIOS_USB_CDC_DATA_EP_OUT_Callback(
         len = sizeof(usb_cdc_dev->rx_packet_buffer);
     }
 
-    if (!usb_cdc_dev->rx_in_cb) {
+    uint16_t headroom;
+    bool need_yield = false;
+    uint16_t bytes_rxed;
+    if (usb_cdc_dev->rx_commit_cb) {
+        if (usb_cdc_dev->rx_buffer != usb_cdc_dev->rx_packet_buffer) {
+            /* Received in place, only publish it */
+            headroom   = (usb_cdc_dev->rx_commit_cb)(usb_cdc_dev->rx_span_context, len, &need_yield);
+            bytes_rxed = len;
+        } else {
+            /* The receive buffer wrapped, copy across at most two spans */
+            headroom   = 0;
+            bytes_rxed = 0;
+            while (bytes_rxed < len) {
+                uint8_t *span;
+                uint16_t span_len = (usb_cdc_dev->rx_acquire_cb)(usb_cdc_dev->rx_span_context, &span);
+                if (span_len == 0) {
+                    break;
+                }
+                if (span_len > len - bytes_rxed) {
+                    span_len = len - bytes_rxed;
+                }
+                memcpy(span, usb_cdc_dev->rx_packet_buffer + bytes_rxed, span_len);
+                headroom    = (usb_cdc_dev->rx_commit_cb)(usb_cdc_dev->rx_span_context, span_len, &need_yield);
+                bytes_rxed += span_len;
+            }
+        }
+    } else if (usb_cdc_dev->rx_in_cb) {
+        bytes_rxed = (usb_cdc_dev->rx_in_cb)(usb_cdc_dev->rx_in_context,
+                                             usb_cdc_dev->rx_packet_buffer,
+                                             len,
+                                             &headroom,
+                                             &need_yield);
+    } else {
         /* No Rx call back registered, disable the receiver */
         usb_cdc_dev->rx_active = false;
         return false;
     }
 
-    uint16_t headroom;
-    bool need_yield = false;
-    uint16_t bytes_rxed;
-    bytes_rxed = (usb_cdc_dev->rx_in_cb)(usb_cdc_dev->rx_in_context,
-                                         usb_cdc_dev->rx_packet_buffer,
-                                         len,
-                                         &headroom,
-                                         &need_yield);
-
     if (bytes_rxed < len) {
         /* Lost bytes on rx */
         usb_cdc_dev->rx_dropped += (len - bytes_rxed);
@@ -708,9 +776,7 @@ static bool PIOS_USB_CDC_DATA_EP_OUT_Callback(
     bool rc;
     if (headroom >= sizeof(usb_cdc_dev->rx_packet_buffer)) {
         /* We have room for a maximum length message */
-        PIOS_USBHOOK_EndpointRx(usb_cdc_dev->cfg->data_rx_ep,
-                                usb_cdc_dev->rx_packet_buffer,
-                                sizeof(usb_cdc_dev->rx_packet_buffer));
+        PIOS_USB_CDC_ArmRx(usb_cdc_dev);
         rc = true;
     } else {
         /* Not enough room left for a message, apply backpressure */
@@ -828,6 +828,7 @@ void PIOS_Board_Init(void)
         PIOS_RFM22B_SetCoordinatorID(pios_rfm22b_id, oplinkSettings.CoordID);
         PIOS_RFM22B_SetXtalCap(pios_rfm22b_id, oplinkSettings.RFXtalCap);
         PIOS_RFM22B_SetChannelConfig(pios_rfm22b_id, datarate, oplinkSettings.MinChannel, oplinkSettings.MaxChannel, is_coordinator, data_mode, ppm_mode);
+        PIOS_RFM22B_SetLinkAdaptation(pios_rfm22b_id, oplinkSettings.LinkAdaptation == OPLINKSETTINGS_LINKADAPTATION_ENABLED);
 
         /* Set the PPM callback if we should be receiving PPM. */
         if (ppm_mode || (ppm_only && !is_coordinator)) {
@@ -65,6 +65,7 @@
 #define INCLUDE_xTaskGetCurrentTaskHandle            1
 #define INCLUDE_uxTaskGetStackHighWaterMark          1
 #define INCLUDE_xTaskGetIdleTaskHandle               1
+#define INCLUDE_pcTaskGetTaskName                    1
 
 /* This is the raw value as per the Cortex-M3 NVIC.  Values can be 255
    (lowest) to 1 (highest maskable) to 0 (highest non-maskable). */
@@ -101,4 +102,7 @@
  * @}
  */
 
+/* Task switches for PIOS_EVENTTRACE, needs PIOS_INCLUDE_EVENTTRACE in pios_config.h */
+#include "pios_eventtrace_hooks.h"
+
 #endif /* FREERTOS_CONFIG_H */
@@ -60,6 +60,10 @@
 #define PIOS_INCLUDE_INSTRUMENTATION
 #define PIOS_INSTRUMENTATION_MAX_COUNTERS 10
 
+#define PIOS_INCLUDE_EVENTTRACE
+/* #define PIOS_EVENTTRACE_RECORDS 1024 */
+/* #define PIOS_EVENTTRACE_MAX_OBJECTS 128 */
+
 /* PIOS hardware peripherals */
 #define PIOS_INCLUDE_IRQ
 #define PIOS_INCLUDE_RTC
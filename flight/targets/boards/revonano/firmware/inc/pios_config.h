@@ -58,6 +58,7 @@
 #define PIOS_INCLUDE_TASK_MONITOR
 
 #define PIOS_INCLUDE_INSTRUMENTATION
+/* 24 bytes of heap per counter, the counters with a histogram take 316 more each */
 #define PIOS_INSTRUMENTATION_MAX_COUNTERS 40
 
 /* PIOS hardware peripherals */
@@ -73,6 +73,9 @@
 #define configUSE_CO_ROUTINES                        0
 #define configMAX_CO_ROUTINE_PRIORITIES              (2)
 
+/* Ticks may run on simulated time, see PIOS_SIMCLOCK */
+#define configUSE_VIRTUAL_TICK                       1
+
 /* Set the following definitions to 1 to include the API function, or zero
    to exclude the API function. */
 
@@ -86,6 +89,8 @@
 #define INCLUDE_xTaskGetSchedulerState               1
 #define INCLUDE_xTaskGetCurrentTaskHandle            1
 #define INCLUDE_uxTaskGetStackHighWaterMark          0
+#define INCLUDE_xTaskGetIdleTaskHandle               1
+#define INCLUDE_pcTaskGetTaskName                    1
 
 
 /* This is the raw value as per the Cortex-M3 NVIC.  Values can be 255
@@ -100,4 +105,7 @@
    NVIC value of 255. */
 #define configLIBRARY_KERNEL_INTERRUPT_PRIORITY      15
 
+/* Task switches for PIOS_EVENTTRACE, needs PIOS_INCLUDE_EVENTTRACE in pios_config.h */
+#include "pios_eventtrace_hooks.h"
+
 #endif /* FREERTOS_CONFIG_H */
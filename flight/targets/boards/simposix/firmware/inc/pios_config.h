@@ -60,6 +60,8 @@
 #define PIOS_INCLUDE_RTC
 #define PIOS_INCLUDE_WDG
 #define PIOS_INCLUDE_UDP
+#define PIOS_INCLUDE_SIMCLOCK
+#define PIOS_INCLUDE_SIMBRIDGE
 
 /* Select the sensors to include */
 // #define PIOS_INCLUDE_BMA180
@@ -100,6 +102,8 @@
 // #define PIOS_INCLUDE_FLASH_LOGFS_SETTINGS
 
 #define PIOS_INCLUDE_DEBUGLOG
+#define PIOS_INCLUDE_EVENTTRACE
+#define PIOS_EVENTTRACE_RECORDS 8192
 
 /* Other Interfaces */
 // #define PIOS_INCLUDE_I2C_ESC
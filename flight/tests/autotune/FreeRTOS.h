@@ -0,0 +1,20 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+
+typedef void *xTaskHandle;
+typedef void *xQueueHandle;
+typedef uint32_t portTickType;
+
+#define tskIDLE_PRIORITY 0
+#define portTICK_RATE_MS 1
+
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+
+int32_t xTaskCreate(void (*task)(void *), const char *name, uint16_t stack, void *parameters, uint32_t priority, xTaskHandle *handle);
+void vTaskDelay(portTickType ticks);
+portTickType xTaskGetTickCount(void);
+
+#endif /* FREERTOS_H */
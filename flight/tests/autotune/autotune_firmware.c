@@ -0,0 +1,164 @@
+/*
+ * The AutoTune module as it is built into the firmware, with entry points for
+ * the test to its estimator and PID computation, and the stubs of the object
+ * manager and OS functions it links against. Only the objects the estimator
+ * and the PID computation use hold data, the task itself is never started.
+ */
+
+#include "../../modules/AutoTune/autotune.c"
+
+static const UAVObjMetadata readwrite;
+
+#define UT_OBJECT(name) \
+    int32_t name##Initialize() { return 0; } \
+    UAVObjHandle name##Handle() { return NULL; }
+
+#define UT_DIRECT(obj, type) \
+    static struct { \
+        UAVObjDirect direct; \
+        type data; \
+    } obj##_object = { .direct = { .meta = &readwrite } }; \
+    UAVObjDirect *obj##_direct = &obj##_object.direct;
+
+UT_OBJECT(AccessoryDesired)
+UT_OBJECT(FlightModeSettings)
+UT_OBJECT(FlightStatus)
+UT_OBJECT(HwSettings)
+UT_OBJECT(ManualControlCommand)
+UT_OBJECT(StabilizationBank)
+UT_OBJECT(StabilizationSettingsBank1)
+UT_OBJECT(StabilizationSettingsBank2)
+UT_OBJECT(StabilizationSettingsBank3)
+UT_OBJECT(SystemIdentSettings)
+UT_OBJECT(SystemIdentState)
+
+UT_DIRECT(flightmodesettings, FlightModeSettingsData)
+UT_DIRECT(flightstatus, FlightStatusData)
+UT_DIRECT(hwsettings, HwSettingsData)
+UT_DIRECT(manualcontrolcommand, ManualControlCommandData)
+UT_DIRECT(manualcontrolsettings, ManualControlSettingsData)
+UT_DIRECT(stabilizationbank, StabilizationBankData)
+UT_DIRECT(stabilizationdesired, StabilizationDesiredData)
+UT_DIRECT(stabilizationsettingsbank1, StabilizationSettingsBank1Data)
+UT_DIRECT(stabilizationsettingsbank2, StabilizationSettingsBank2Data)
+UT_DIRECT(stabilizationsettingsbank3, StabilizationSettingsBank3Data)
+UT_DIRECT(systemidentsettings, SystemIdentSettingsData)
+UT_DIRECT(systemidentstate, SystemIdentStateData)
+
+void SystemIdentStateSetDefaults(__attribute__((unused)) UAVObjHandle obj, __attribute__((unused)) uint16_t instId) {}
+void UAVObjDirectUpdated(__attribute__((unused)) UAVObjDirect *direct) {}
+int32_t UAVObjConnectCallback(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) UAVObjEventCallback cb,
+                              __attribute__((unused)) uint8_t eventMask, __attribute__((unused)) bool fast)
+{
+    return 0;
+}
+int32_t UAVObjGetInstanceData(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, __attribute__((unused)) void *dataOut)
+{
+    return -1;
+}
+int32_t UAVObjGetMetadata(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) UAVObjMetadata *dataOut)
+{
+    return -1;
+}
+int32_t UAVObjSetMetadata(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) const UAVObjMetadata *dataIn)
+{
+    return -1;
+}
+int32_t UAVObjSave(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId)
+{
+    return -1;
+}
+int32_t ExtendedAlarmsSet(__attribute__((unused)) SystemAlarmsAlarmElem alarm, __attribute__((unused)) SystemAlarmsAlarmOptions severity,
+                          __attribute__((unused)) uint8_t status, __attribute__((unused)) uint8_t subStatus)
+{
+    return 0;
+}
+void stabilizationInnerloopSetCapture(__attribute__((unused)) StabilizationInnerloopCapture *capture) {}
+
+uint32_t PIOS_DELAY_GetRaw(void)
+{
+    return 0;
+}
+uint32_t PIOS_DELAY_DiffuS2(__attribute__((unused)) uint32_t raw, __attribute__((unused)) uint32_t later)
+{
+    return 0;
+}
+int32_t xTaskCreate(__attribute__((unused)) void (*task)(void *), __attribute__((unused)) const char *name, __attribute__((unused)) uint16_t stack,
+                    __attribute__((unused)) void *parameters, __attribute__((unused)) uint32_t priority, __attribute__((unused)) xTaskHandle *handle)
+{
+    return -1;
+}
+void vTaskDelay(__attribute__((unused)) portTickType ticks) {}
+portTickType xTaskGetTickCount(void)
+{
+    return 0;
+}
+
+/**
+ * AfInit() from the given starting point, what InitSystemIdent() loads from
+ * the SystemIdentState defaults
+ */
+void AutoTuneFirmwareInit(float tau, const float beta[3])
+{
+    u.systemIdentState.Tau = tau;
+    u.systemIdentState.Beta.Roll  = beta[0];
+    u.systemIdentState.Beta.Pitch = beta[1];
+    u.systemIdentState.Beta.Yaw   = beta[2];
+    AfInit(gX, gP);
+}
+
+void AutoTuneFirmwarePredict(const float u_in[3], const float gyro[3], float dT_s, float throttle)
+{
+    AfPredict(gX, gP, u_in, gyro, dT_s, throttle);
+}
+
+/**
+ * The model as the task publishes it at the end of the tune
+ * \return the CheckSettingsRaw() bits
+ */
+uint8_t AutoTuneFirmwareFinish(float readTimeAverage, float *tau, float beta[3], float bias[3])
+{
+    gyroReadTimeAverage = readTimeAverage;
+    UpdateSystemIdentState(gX, NULL, 1.0f / PIOS_SENSOR_RATE, 0, 0, 0.0f);
+
+    *tau = u.systemIdentState.Tau;
+    memcpy(beta, &u.systemIdentState.Beta, sizeof(u.systemIdentState.Beta));
+    memcpy(bias, &u.systemIdentState.Bias, sizeof(u.systemIdentState.Bias));
+    return CheckSettingsRaw();
+}
+
+/**
+ * PIDs of the model left by AutoTuneFirmwareFinish(), as saved to bank 1
+ * \param pids kp, ki, kd of roll, pitch, yaw, then kp and ki of the roll attitude loop
+ */
+void AutoTuneFirmwarePids(float softClamp, float derivativeFactor, float ratioMin, float ratioMax, uint16_t maximumRate,
+                          uint8_t calculateYaw, float damp, float noise, float pids[11])
+{
+    StabilizationSettingsBank1Data bank;
+
+    memset(&bank, 0, sizeof(bank));
+    bank.MaximumRate.Roll  = maximumRate;
+    bank.MaximumRate.Pitch = maximumRate;
+    StabilizationSettingsBank1Set(&bank);
+
+    systemIdentSettings.DestinationPidBank   = 1;
+    systemIdentSettings.OuterLoopKpSoftClamp = softClamp;
+    systemIdentSettings.DerivativeFactor     = derivativeFactor;
+    systemIdentSettings.YawToRollPitchPIDRatioMin = ratioMin;
+    systemIdentSettings.YawToRollPitchPIDRatioMax = ratioMax;
+    systemIdentSettings.CalculateYaw = calculateYaw;
+    ComputeStabilizationAndSetPidsFromDampAndNoise(damp, noise);
+
+    StabilizationSettingsBank1Get(&bank);
+    pids[0]  = bank.RollRatePID.Kp;
+    pids[1]  = bank.RollRatePID.Ki;
+    pids[2]  = bank.RollRatePID.Kd;
+    pids[3]  = bank.PitchRatePID.Kp;
+    pids[4]  = bank.PitchRatePID.Ki;
+    pids[5]  = bank.PitchRatePID.Kd;
+    pids[6]  = bank.YawRatePID.Kp;
+    pids[7]  = bank.YawRatePID.Ki;
+    pids[8]  = bank.YawRatePID.Kd;
+    pids[9]  = bank.RollPI.Kp;
+    pids[10] = bank.RollPI.Ki;
+}
@@ -0,0 +1,9 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <pios.h>
+#include <uavobjectmanager.h>
+#include "alarms.h"
+#include <mathmisc.h>
+
+#endif /* OPENPILOT_H */
@@ -0,0 +1,33 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* PIOS Feature Selection */
+#include "pios_config.h"
+
+#ifdef PIOS_INCLUDE_FREERTOS
+/* FreeRTOS Includes */
+#include "FreeRTOS.h"
+#endif
+#include "pios_mem.h"
+#include <pios_math.h>
+#include <pios_helpers.h>
+#include <pios_eventtrace.h>
+
+#define PIOS_Assert(x) \
+    if (!(x)) { while (1) {; } \
+    }
+#define PIOS_STATIC_ASSERT(test) ((void)sizeof(int[1 - 2 * !(test)]))
+
+uint32_t PIOS_DELAY_GetRaw(void);
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw);
+uint32_t PIOS_DELAY_DiffuS2(uint32_t raw, uint32_t later);
+
+#define PIOS_TASK_MONITOR_RegisterTask(id, handle)
+#define MODULE_INITCALL(ifn, sfn)
+
+#endif /* PIOS_H */
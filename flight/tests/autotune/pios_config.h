@@ -0,0 +1,9 @@
+#ifndef PIOS_CONFIG_H
+#define PIOS_CONFIG_H
+
+#define PIOS_INCLUDE_FREERTOS
+
+/* the sensor rate of revolution */
+#define PIOS_SENSOR_RATE 500.0f
+
+#endif /* PIOS_CONFIG_H */
@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+
+#include <math.h> /* expf */
+#include <stdint.h> /* uint32_t */
+
+#include "systemident.h"
+
+extern "C" {
+// autotune_firmware.c, autotune.c of the firmware
+void AutoTuneFirmwareInit(float tau, const float beta[3]);
+void AutoTuneFirmwarePredict(const float u_in[3], const float gyro[3], float dT_s, float throttle);
+uint8_t AutoTuneFirmwareFinish(float readTimeAverage, float *tau, float beta[3], float bias[3]);
+void AutoTuneFirmwarePids(float softClamp, float derivativeFactor, float ratioMin, float ratioMax, uint16_t maximumRate,
+                          uint8_t calculateYaw, float damp, float noise, float pids[11]);
+}
+
+/*
+ * The offline identification of the GCS (systemident.cpp) must give the PIDs
+ * the board computes from the same samples. Both run the same fixed sample
+ * stream here: a multirotor with a first order motor response, excited with
+ * square waves on each axis the way the SystemIdent flight mode does, and
+ * pseudo random gyro noise.
+ */
+
+#define SAMPLES       (60 * 500) /* the default TuningDuration of 60 s at PIOS_SENSOR_RATE */
+#define SAMPLE_PERIOD (1.0f / 500.0f)
+#define READ_TIME     0.0004f
+
+class AutoTuneTest : public testing::Test {
+protected:
+    static const float tau0;
+    static const float beta0[3];
+
+    SystemIdentSample sample(uint32_t k)
+    {
+        const float tau   = -3.6f;
+        const float beta[3] = { 9.5f, 10.3f, 7.5f };
+        SystemIdentSample s;
+
+        s.throttle = 0.5f;
+        s.dT = SAMPLE_PERIOD;
+        for (int axis = 0; axis < 3; axis++) {
+            s.u[axis] = ((k / (40 + 7 * axis)) & 1) ? 0.02f : -0.02f;
+            torque[axis] = (s.dT * 4 * s.throttle * s.u[axis] + torque[axis] * expf(tau)) / (s.dT + expf(tau));
+            rate[axis]  += s.dT * torque[axis] * expf(beta[axis]);
+            s.y[axis]    = rate[axis] + noise();
+        }
+        return s;
+    }
+
+    // Park-Miller, the same stream on every platform, +-5 deg/s
+    float noise()
+    {
+        seed = (uint32_t)(((uint64_t)seed * 48271) % 2147483647);
+        return (seed / 2147483647.0f - 0.5f) * 10.0f;
+    }
+
+    virtual void SetUp()
+    {
+        seed = 1;
+        for (int axis = 0; axis < 3; axis++) {
+            rate[axis]   = 0.0f;
+            torque[axis] = 0.0f;
+        }
+    }
+
+    uint32_t seed;
+    float rate[3];
+    float torque[3];
+};
+
+// the SystemIdentState defaults
+const float AutoTuneTest::tau0     = -4.0f;
+const float AutoTuneTest::beta0[3] = { 10.0f, 10.0f, 7.0f };
+
+TEST_F(AutoTuneTest, Predict) {
+    SystemIdentFilter filter(tau0, beta0);
+
+    AutoTuneFirmwareInit(tau0, beta0);
+    for (uint32_t k = 0; k < SAMPLES; k++) {
+        SystemIdentSample s = sample(k);
+        filter.predict(s);
+        AutoTuneFirmwarePredict(s.u, s.y, s.dT, s.throttle);
+    }
+
+    float tau, beta[3], bias[3];
+    AutoTuneFirmwareFinish(READ_TIME, &tau, beta, bias);
+    SystemIdentModel model = filter.model();
+
+    EXPECT_EQ((uint32_t)SAMPLES, model.samples);
+    EXPECT_FLOAT_EQ(tau, model.tau);
+    for (int axis = 0; axis < 3; axis++) {
+        EXPECT_FLOAT_EQ(beta[axis], model.beta[axis]);
+        EXPECT_FLOAT_EQ(bias[axis], model.bias[axis]);
+    }
+
+    // the stream identifies the gains, tau converges slowly but toward the plant
+    EXPECT_GT(model.tau, tau0);
+    EXPECT_NEAR(9.5f, model.beta[0], 0.3f);
+    EXPECT_NEAR(10.3f, model.beta[1], 0.3f);
+}
+
+TEST_F(AutoTuneTest, Check) {
+    const float tau[]     = { -4.0f, -1.5f, -5.5f, -4.0f };
+    const float beta[][3] = { { 10.0f, 10.0f, 7.0f }, { 10.0f, 10.0f, 7.0f }, { 10.0f, 10.0f, 7.0f }, { 5.0f, 5.5f, 7.0f } };
+    const float readTime[] = { READ_TIME, READ_TIME, READ_TIME, 0.003f };
+
+    for (int i = 0; i < 4; i++) {
+        float fwTau, fwBeta[3], fwBias[3];
+        AutoTuneFirmwareInit(tau[i], beta[i]);
+        uint8_t expected = AutoTuneFirmwareFinish(readTime[i], &fwTau, fwBeta, fwBias);
+
+        SystemIdentFilter filter(tau[i], beta[i]);
+        EXPECT_EQ(expected, SystemIdentFilter::check(filter.model(), readTime[i], SAMPLE_PERIOD)) << "case " << i;
+    }
+}
+
+TEST_F(AutoTuneTest, Pids) {
+    SystemIdentFilter filter(tau0, beta0);
+
+    AutoTuneFirmwareInit(tau0, beta0);
+    for (uint32_t k = 0; k < SAMPLES; k++) {
+        SystemIdentSample s = sample(k);
+        filter.predict(s);
+        AutoTuneFirmwarePredict(s.u, s.y, s.dT, s.throttle);
+    }
+
+    float tau, beta[3], bias[3];
+    AutoTuneFirmwareFinish(READ_TIME, &tau, beta, bias);
+    SystemIdentModel model = filter.model();
+
+    // the SystemIdentSettings defaults, with each yaw option
+    SystemIdentPidSettings settings;
+    settings.gyroReadTimeAverage  = READ_TIME;
+    settings.outerLoopKpSoftClamp = 6.5f;
+    settings.derivativeFactor     = 1.0f;
+    settings.yawToRollPitchPIDRatioMin = 1.0f;
+    settings.yawToRollPitchPIDRatioMax = 2.5f;
+    settings.maximumRate[0] = 220;
+    settings.maximumRate[1] = 220;
+
+    for (int yaw = SystemIdentPidSettings::YawFalse; yaw <= SystemIdentPidSettings::YawTrueIgnoreLimit; yaw++) {
+        settings.calculateYaw = yaw;
+        for (float damp = 85.0f; damp <= 130.0f; damp += 15.0f) {
+            for (float noise = 8.0f; noise <= 16.0f; noise += 4.0f) {
+                float fw[11];
+                AutoTuneFirmwarePids(settings.outerLoopKpSoftClamp, settings.derivativeFactor,
+                                     settings.yawToRollPitchPIDRatioMin, settings.yawToRollPitchPIDRatioMax,
+                                     settings.maximumRate[0], yaw, damp, noise, fw);
+                SystemIdentPids pids = SystemIdentFilter::computePids(model, settings, damp, noise);
+
+                SCOPED_TRACE(testing::Message() << "yaw " << yaw << " damp " << damp << " noise " << noise);
+                for (int axis = 0; axis < (yaw ? 3 : 2); axis++) {
+                    EXPECT_FLOAT_EQ(fw[3 * axis], pids.kp[axis]);
+                    EXPECT_FLOAT_EQ(fw[3 * axis + 1], pids.ki[axis]);
+                    EXPECT_FLOAT_EQ(fw[3 * axis + 2], pids.kd[axis]);
+                }
+                EXPECT_FLOAT_EQ(fw[9], pids.outerKp);
+                EXPECT_FLOAT_EQ(fw[10], pids.outerKi);
+            }
+        }
+    }
+}
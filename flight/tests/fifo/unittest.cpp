@@ -0,0 +1,247 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memcpy */
+#include <chrono>
+#include <thread>
+
+extern "C" {
+#include "fifo_buffer.h"
+}
+
+#define BUFFER_SIZE 256
+
+class FifoBuffer : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        fifoBuf_init(&fifo, buffer, sizeof(buffer));
+    }
+
+    uint8_t buffer[BUFFER_SIZE];
+    t_fifo_buffer fifo;
+};
+
+TEST_F(FifoBuffer, SpansStopAtTheEnd) {
+    uint8_t *span;
+
+    // the whole buffer except the byte separating wr from rd
+    EXPECT_EQ(BUFFER_SIZE - 1, fifoBuf_acquireWrite(&fifo, &span));
+    EXPECT_EQ(buffer, span);
+    EXPECT_EQ(0, fifoBuf_acquireRead(&fifo, &span));
+
+    fifoBuf_commitWrite(&fifo, 200);
+    fifoBuf_commitRead(&fifo, 150);
+
+    // free space wraps around, the first span ends at the end of the buffer
+    EXPECT_EQ(BUFFER_SIZE - 1 - 50, fifoBuf_getFree(&fifo));
+    EXPECT_EQ(BUFFER_SIZE - 200, fifoBuf_acquireWrite(&fifo, &span));
+    EXPECT_EQ(buffer + 200, span);
+
+    fifoBuf_commitWrite(&fifo, BUFFER_SIZE - 200);
+    EXPECT_EQ(149, fifoBuf_acquireWrite(&fifo, &span));
+    EXPECT_EQ(buffer, span);
+
+    // data wraps around as well
+    fifoBuf_commitWrite(&fifo, 10);
+    EXPECT_EQ(BUFFER_SIZE - 150, fifoBuf_acquireRead(&fifo, &span));
+    EXPECT_EQ(buffer + 150, span);
+    fifoBuf_commitRead(&fifo, BUFFER_SIZE - 150);
+    EXPECT_EQ(10, fifoBuf_acquireRead(&fifo, &span));
+    EXPECT_EQ(buffer, span);
+}
+
+TEST_F(FifoBuffer, CopyAcrossTheEnd) {
+    uint8_t in[BUFFER_SIZE], out[BUFFER_SIZE];
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        in[i] = i;
+    }
+
+    EXPECT_EQ(100, fifoBuf_putData(&fifo, in, 100));
+    EXPECT_EQ(100, fifoBuf_getData(&fifo, out, sizeof(out)));
+
+    // does not fit completely
+    EXPECT_EQ(BUFFER_SIZE - 1, fifoBuf_putData(&fifo, in, sizeof(in)));
+    EXPECT_EQ(0, fifoBuf_putByte(&fifo, 0));
+
+    EXPECT_EQ(0, fifoBuf_getBytePeek(&fifo));
+    EXPECT_EQ(BUFFER_SIZE - 1, fifoBuf_getDataPeek(&fifo, out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(in, out, BUFFER_SIZE - 1));
+
+    fifoBuf_removeData(&fifo, 1);
+    EXPECT_EQ(1, fifoBuf_getByte(&fifo));
+    EXPECT_EQ(BUFFER_SIZE - 3, fifoBuf_getData(&fifo, out, sizeof(out)));
+    EXPECT_EQ(0, memcmp(in + 2, out, BUFFER_SIZE - 3));
+    EXPECT_EQ(-1, fifoBuf_getByte(&fifo));
+    EXPECT_EQ(0, fifoBuf_getUsed(&fifo));
+}
+
+#define STREAM_BYTES (4u * 1024u * 1024u)
+#define CHUNK        61 // not a divider of the buffer size, so the chunks wrap
+
+/*
+ * The copying implementation used before the span API, as the reference
+ * for the throughput comparison.
+ */
+static uint16_t oldGetUsed(t_fifo_buffer *buf)
+{
+    uint16_t rd = buf->rd;
+    uint16_t wr = buf->wr;
+
+    return (wr < rd) ? (buf->buf_size - rd) + wr : wr - rd;
+}
+
+static uint16_t oldPutData(t_fifo_buffer *buf, const void *data, uint16_t len)
+{
+    uint16_t wr = buf->wr;
+    uint16_t num_bytes = buf->buf_size - oldGetUsed(buf) - 1;
+    const uint8_t *p   = (const uint8_t *)data;
+    uint16_t i = 0;
+
+    if (num_bytes > len) {
+        num_bytes = len;
+    }
+    while (num_bytes > 0) {
+        uint16_t block_len = buf->buf_size - wr;
+        if (block_len > num_bytes) {
+            block_len = num_bytes;
+        }
+        memcpy(buf->buf_ptr + wr, p + i, block_len);
+        i  += block_len;
+        num_bytes -= block_len;
+        wr += block_len;
+        if (wr >= buf->buf_size) {
+            wr = 0;
+        }
+    }
+    buf->wr = wr;
+    return i;
+}
+
+static uint16_t oldGetData(t_fifo_buffer *buf, void *data, uint16_t len)
+{
+    uint16_t rd = buf->rd;
+    uint16_t num_bytes = oldGetUsed(buf);
+    uint8_t *p = (uint8_t *)data;
+    uint16_t i = 0;
+
+    if (num_bytes > len) {
+        num_bytes = len;
+    }
+    while (num_bytes > 0) {
+        uint16_t block_len = buf->buf_size - rd;
+        if (block_len > num_bytes) {
+            block_len = num_bytes;
+        }
+        memcpy(p + i, buf->buf_ptr + rd, block_len);
+        i  += block_len;
+        num_bytes -= block_len;
+        rd += block_len;
+        if (rd >= buf->buf_size) {
+            rd = 0;
+        }
+    }
+    buf->rd = rd;
+    return i;
+}
+
+/*
+ * Producer and consumer threads stream a counting byte pattern through the
+ * buffer, as a driver and a task do through a PIOS_COM port. The copy path
+ * stages the data in a local buffer on both sides (driver DMA buffer, task
+ * receive buffer), the span path produces and consumes it in place.
+ */
+static double stream(t_fifo_buffer *fifo, bool spans, uint32_t *errors)
+{
+    *errors = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([fifo, spans]() {
+        uint8_t staging[CHUNK];
+        uint32_t sent = 0;
+
+        while (sent < STREAM_BYTES) {
+            if (spans) {
+                uint8_t *span;
+                uint16_t len = fifoBuf_acquireWrite(fifo, &span);
+                if (len > CHUNK) {
+                    len = CHUNK;
+                }
+                for (uint16_t i = 0; i < len; i++) {
+                    span[i] = (uint8_t)(sent + i);
+                }
+                fifoBuf_commitWrite(fifo, len);
+                sent += len;
+                if (!len) {
+                    std::this_thread::yield();
+                }
+            } else {
+                for (uint16_t i = 0; i < CHUNK; i++) {
+                    staging[i] = (uint8_t)(sent + i);
+                }
+                uint16_t len = 0;
+                while (len < CHUNK) {
+                    uint16_t n = oldPutData(fifo, staging + len, CHUNK - len);
+                    if (!n) {
+                        std::this_thread::yield();
+                    }
+                    len += n;
+                }
+                sent += len;
+            }
+        }
+    });
+
+    std::thread consumer([fifo, spans, errors]() {
+        uint8_t staging[CHUNK];
+        uint32_t received = 0;
+
+        while (received < STREAM_BYTES) {
+            uint8_t *data = staging;
+            uint16_t len;
+
+            if (spans) {
+                len = fifoBuf_acquireRead(fifo, &data);
+            } else {
+                len = oldGetData(fifo, staging, sizeof(staging));
+            }
+            for (uint16_t i = 0; i < len; i++) {
+                if (data[i] != (uint8_t)(received + i)) {
+                    (*errors)++;
+                }
+            }
+            if (spans) {
+                fifoBuf_commitRead(fifo, len);
+            }
+            received += len;
+            if (!len) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return STREAM_BYTES / elapsed.count() / 1e6;
+}
+
+TEST_F(FifoBuffer, ThroughputOldVersusSpans) {
+    uint32_t errors;
+
+    double copy_mbps = stream(&fifo, false, &errors);
+
+    fifoBuf_init(&fifo, buffer, sizeof(buffer));
+    double span_mbps = stream(&fifo, true, &errors);
+
+    printf("%u bytes through %u byte buffer: copy %.1f MB/s, spans %.1f MB/s\n",
+           STREAM_BYTES, BUFFER_SIZE, copy_mbps, span_mbps);
+
+    // the old path has no barriers and is only timed, the span path must
+    // deliver every byte in order without locking
+    EXPECT_EQ(0u, errors);
+}
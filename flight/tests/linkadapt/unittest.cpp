@@ -0,0 +1,253 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <math.h> /* powf */
+
+extern "C" {
+#include "linkadapt.h"
+}
+
+// RFM22B modes as configured by pios_rfm22b.c: 64 byte packets, 4 parity bytes,
+// sync + header + length bytes unprotected.
+#define RS_PARITY       4
+#define FRAME_OVERHEAD  9
+#define WINDOW_PACKETS  16
+#define WINDOWS         1000
+#define WARMUP_WINDOWS  30
+
+static const struct linkadapt_mode rfm22b_modes[] = {
+    { 9600,   80, 64 },
+    { 19200,  40, 64 },
+    { 32000,  25, 64 },
+    { 57600,  15, 64 },
+    { 64000,  13, 63 },
+    { 100000, 10, 64 },
+    { 128000, 8,  64 },
+    { 192000, 6,  64 },
+    { 256000, 5,  64 },
+};
+
+#define NUM_MODES (sizeof(rfm22b_modes) / sizeof(rfm22b_modes[0]))
+
+/*
+ * Simulated channel: noncoherent FSK with an implementation loss growing with
+ * the bitrate (wider receive filter) and a slow random fade (about 1dB), so the
+ * channel does not match the model used by the adaptation exactly.
+ */
+class Channel {
+public:
+    Channel(float ebn0_db_9600) : base_db(ebn0_db_9600), fade_db(0.0f), seed(12345) {}
+
+    void fade()
+    {
+        fade_db = 0.7f * fade_db + 2.0f * uniform() - 1.0f;
+    }
+
+    // Send one packet, returns 0 if lost, 1 if error free, 2 if corrected.
+    int send(uint8_t mode, uint8_t len)
+    {
+        float db   = base_db + fade_db - 0.25f * mode;
+        float ebn0 = powf(10.0f, db / 10.0f) * 9600.0f / rfm22b_modes[mode].bitrate;
+        float p    = 0.5f * expf(-0.5f * ebn0);
+        float q    = 1.0f - powf(1.0f - p, 8.0f);
+        int errors = 0;
+
+        for (int i = 0; i < FRAME_OVERHEAD; i++) {
+            if (uniform() < q) {
+                return 0;
+            }
+        }
+        for (int i = 0; i < len; i++) {
+            if (uniform() < q) {
+                errors++;
+            }
+        }
+        if (errors > RS_PARITY / 2) {
+            return 0;
+        }
+        return errors ? 2 : 1;
+    }
+
+    float base_db;
+
+private:
+    float uniform()
+    {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 8) * (1.0f / 16777216.0f);
+    }
+
+    float fade_db;
+    uint32_t seed;
+};
+
+/*
+ * Run one window in both directions, returns the payload bytes delivered
+ * and fills the reception statistics of both ends.
+ */
+static float runWindow(Channel &ch, uint8_t mode, uint8_t len, struct linkadapt_window *rx, struct linkadapt_window *peer)
+{
+    float bytes = 0.0f;
+    struct linkadapt_window *w[2] = { rx, peer };
+
+    ch.fade();
+    for (int d = 0; d < 2; d++) {
+        w[d]->expected  = WINDOW_PACKETS;
+        w[d]->good      = 0;
+        w[d]->corrected = 0;
+        for (int i = 0; i < WINDOW_PACKETS; i++) {
+            int r = ch.send(mode, len);
+            if (r == 1) {
+                w[d]->good++;
+            } else if (r == 2) {
+                w[d]->corrected++;
+            }
+            if (r) {
+                bytes += len - RS_PARITY;
+            }
+        }
+    }
+    return bytes;
+}
+
+// payload bytes per second and direction, optionally following an Eb/N0 profile over time
+static float staticGoodput(float ebn0_db, uint8_t mode, float (*profile)(float), float duration_ms)
+{
+    Channel ch(ebn0_db);
+    struct linkadapt_window rx, peer;
+    float bytes = 0.0f, ms = 0.0f;
+
+    for (int i = 0; profile ? (ms < duration_ms) : (i < WINDOWS); i++) {
+        if (profile) {
+            ch.base_db = profile(ms);
+        }
+        bytes += runWindow(ch, mode, rfm22b_modes[mode].max_len, &rx, &peer);
+        ms    += 2 * WINDOW_PACKETS * rfm22b_modes[mode].slot_ms;
+    }
+    return bytes * 1000.0f / ms / 2.0f;
+}
+
+/*
+ * Adaptive link: the statistics of a window are used at its end, a mode change
+ * takes one window to announce and the window after the change is not used,
+ * as done by the driver.
+ */
+static float adaptiveGoodput(Channel &ch, float (*profile)(float), float duration_ms, uint8_t *final_mode)
+{
+    struct linkadapt la;
+    struct linkadapt_window rx, peer;
+    float bytes = 0.0f, ms = 0.0f;
+    uint8_t mode = 0, next = 0;
+    int settle   = 0;
+
+    LinkAdaptInit(&la, rfm22b_modes, NUM_MODES, RS_PARITY, FRAME_OVERHEAD);
+
+    for (int i = 0; profile ? (ms < duration_ms) : (i < WINDOWS); i++) {
+        if (profile) {
+            ch.base_db = profile(ms);
+        }
+        float b = runWindow(ch, mode, la.len, &rx, &peer);
+        if (i >= WARMUP_WINDOWS || profile) {
+            bytes += b;
+            ms    += 2 * WINDOW_PACKETS * rfm22b_modes[mode].slot_ms;
+        }
+        if (mode != next) {
+            mode   = next;
+            settle = 1;
+        } else if (settle) {
+            settle--;
+        } else {
+            next = LinkAdaptUpdate(&la, &rx, &peer, true);
+            if (next != mode) {
+                settle = 1;
+            }
+        }
+    }
+    *final_mode = mode;
+    return bytes * 1000.0f / ms / 2.0f;
+}
+
+TEST(LinkAdapt, StartsRobust) {
+    struct linkadapt la;
+
+    LinkAdaptInit(&la, rfm22b_modes, NUM_MODES, RS_PARITY, FRAME_OVERHEAD);
+    EXPECT_EQ(0, la.mode);
+    EXPECT_EQ(64, la.len);
+
+    // no statistics, no change
+    EXPECT_EQ(0, LinkAdaptUpdate(&la, NULL, NULL, true));
+}
+
+TEST(LinkAdapt, StepsDownOnLoss) {
+    struct linkadapt la;
+    struct linkadapt_window bad = { WINDOW_PACKETS, 1, 2 };
+
+    LinkAdaptInit(&la, rfm22b_modes, NUM_MODES, RS_PARITY, FRAME_OVERHEAD);
+    LinkAdaptSetMode(&la, NUM_MODES - 1);
+    EXPECT_LT(LinkAdaptUpdate(&la, &bad, NULL, true), NUM_MODES - 1);
+
+    // the remote end only adapts the packet length
+    uint8_t mode = la.mode;
+    EXPECT_EQ(mode, LinkAdaptUpdate(&la, &bad, NULL, false));
+    EXPECT_LE(la.len, 64);
+}
+
+TEST(LinkAdapt, ProbesUpOneStepAtATime) {
+    struct linkadapt la;
+    struct linkadapt_window clean = { WINDOW_PACKETS, WINDOW_PACKETS, 0 };
+    uint8_t last = 0;
+
+    LinkAdaptInit(&la, rfm22b_modes, NUM_MODES, RS_PARITY, FRAME_OVERHEAD);
+    for (int i = 0; i < 100; i++) {
+        uint8_t mode = LinkAdaptUpdate(&la, &clean, &clean, true);
+        EXPECT_LE(mode, last + 1);
+        last = mode;
+    }
+    EXPECT_EQ(NUM_MODES - 1, last);
+}
+
+TEST(LinkAdapt, GoodputVersusStatic) {
+    printf("Eb/N0@9600  best static (mode)   adaptive (final mode)\n");
+    for (float db = 8.0f; db <= 36.0f; db += 4.0f) {
+        float best = 0.0f;
+        uint8_t best_mode = 0;
+        for (uint8_t m = 0; m < NUM_MODES; m++) {
+            float g = staticGoodput(db, m, NULL, 0.0f);
+            if (g > best) {
+                best = g;
+                best_mode = m;
+            }
+        }
+
+        Channel ch(db);
+        uint8_t final_mode;
+        float adaptive = adaptiveGoodput(ch, NULL, 0.0f, &final_mode);
+
+        printf("%5.1f dB    %7.0f B/s (%u)      %7.0f B/s (%u)\n", db, best, best_mode, adaptive, final_mode);
+
+        EXPECT_GT(adaptive, 0.9f * best) << db << " dB";
+    }
+}
+
+#define FADE_MS 120000.0f
+
+static float fadeProfile(float ms)
+{
+    // 36 dB down to 10 dB and back up
+    float t = fmodf(ms, FADE_MS) / (FADE_MS / 2.0f);
+
+    return (t < 1.0f) ? 36.0f - 26.0f * t : 10.0f + 26.0f * (t - 1.0f);
+}
+
+TEST(LinkAdapt, TracksFade) {
+    Channel ch(0.0f);
+    uint8_t final_mode;
+    float adaptive   = adaptiveGoodput(ch, fadeProfile, FADE_MS, &final_mode);
+    float fixed_slow = staticGoodput(0.0f, 0, fadeProfile, FADE_MS);
+    float fixed_fast = staticGoodput(0.0f, NUM_MODES - 1, fadeProfile, FADE_MS);
+
+    printf("fade: slowest %.0f B/s, fastest %.0f B/s, adaptive %.0f B/s\n", fixed_slow, fixed_fast, adaptive);
+
+    EXPECT_GT(adaptive, fixed_slow);
+    EXPECT_GT(adaptive, fixed_fast);
+}
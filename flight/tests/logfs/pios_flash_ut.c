@@ -15,6 +15,7 @@ struct flash_ut_dev {
     const struct pios_flash_ut_cfg *cfg;
     bool transaction_in_progress;
     FILE *flash_file;
+    struct pios_flash_ut_stats stats;
 };
 
 static struct flash_ut_dev *PIOS_Flash_UT_Alloc(void)
@@ -40,6 +41,7 @@ int32_t PIOS_Flash_UT_Init(uintptr_t *flash_id, const struct pios_flash_ut_cfg *
 
     flash_dev->cfg = cfg;
     flash_dev->transaction_in_progress = false;
+    memset(&flash_dev->stats, 0, sizeof(flash_dev->stats));
 
     flash_dev->flash_file = fopen(FLASH_IMAGE_FILE, "rb+");
     if (flash_dev->flash_file == NULL) {
@@ -75,6 +77,15 @@ int32_t PIOS_Flash_UT_Destroy(uintptr_t flash_id)
 }
 
 
+void PIOS_Flash_UT_GetStats(uintptr_t flash_id, struct pios_flash_ut_stats *stats)
+{
+    struct flash_ut_dev *flash_dev = (struct flash_ut_dev *)flash_id;
+
+    assert(flash_dev->magic == FLASH_UT_MAGIC);
+
+    *stats = flash_dev->stats;
+}
+
 /**********************************
  *
  * Provide a PIOS flash driver API
@@ -89,6 +100,7 @@ static int32_t PIOS_Flash_UT_StartTransaction(uintptr_t flash_id)
     assert(!flash_dev->transaction_in_progress);
 
     flash_dev->transaction_in_progress = true;
+    flash_dev->stats.transactions++;
 
     return 0;
 }
@@ -143,6 +155,7 @@ static int32_t PIOS_Flash_UT_WriteData(uintptr_t flash_id, uint32_t addr, uint8_
     s = fwrite(data, 1, len, flash_dev->flash_file);
 
     assert(s == len);
+    flash_dev->stats.writes++;
 
     return 0;
 }
@@ -164,6 +177,7 @@ static int32_t PIOS_Flash_UT_ReadData(uintptr_t flash_id, uint32_t addr, uint8_t
     s = fread(data, 1, len, flash_dev->flash_file);
 
     assert(s == len);
+    flash_dev->stats.reads++;
 
     return 0;
 }
@@ -5,9 +5,17 @@ struct pios_flash_ut_cfg {
     uint32_t size_of_sector;
 };
 
+/* number of driver calls since init */
+struct pios_flash_ut_stats {
+    uint32_t transactions;
+    uint32_t reads;
+    uint32_t writes;
+};
+
 int32_t PIOS_Flash_UT_Init(uintptr_t *flash_id, const struct pios_flash_ut_cfg *cfg);
 
 int32_t PIOS_Flash_UT_Destroy(uintptr_t flash_id);
+void PIOS_Flash_UT_GetStats(uintptr_t flash_id, struct pios_flash_ut_stats *stats);
 extern const struct pios_flash_driver pios_ut_flash_driver;
 
 #if !defined(FLASH_IMAGE_FILE)
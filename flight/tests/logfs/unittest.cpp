@@ -3,6 +3,7 @@
 #include <stdio.h> /* printf */
 #include <stdlib.h> /* abort */
 #include <string.h> /* memset */
+#include <chrono>
 
 extern "C" {
 #include "pios_flash.h" /* PIOS_FLASH_* API */
@@ -32,6 +33,13 @@ extern struct flashfs_logfs_cfg flashfs_config_partition_b;
 #define OBJ4_ID   0x90901111
 #define OBJ4_SIZE (768) // only fits in partition b slots
 
+#define BATCH_OBJS 16 // settings objects saved at once by the GCS
+
+#define BOOT_OBJS     100 // objects registered at boot
+#define BOOT_SETTINGS 30 // of them settings objects saved to flash
+#define BOOT_META     10 // of them with their metadata saved to flash
+#define BOOT_SIZE     64
+
 // To use a test fixture, derive a class from testing::Test.
 class LogfsTestRaw : public testing::Test {
 protected:
@@ -297,6 +305,268 @@ TEST_F(LogfsTestCooked, WriteManyVerify) {
     EXPECT_EQ(0, memcmp(obj3, obj3_check, sizeof(obj3)));
 }
 
+TEST_F(LogfsTestCooked, WriteMultipleVerify) {
+    /* Old versions that have to be replaced */
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, 0, obj1_alt, sizeof(obj1_alt)));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ2_ID, 0, obj1_alt, sizeof(obj1_alt)));
+
+    struct PIOS_FLASHFS_ObjEntry objs[] = {
+        { OBJ1_ID, 0,   sizeof(obj1), obj1 },
+        { OBJ1_ID, 123, sizeof(obj1), obj1 },
+        { OBJ2_ID, 0,   sizeof(obj2), obj2 },
+        { OBJ3_ID, 0,   sizeof(obj3), obj3 },
+    };
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSaveMultiple(fs_id, objs, sizeof(objs) / sizeof(objs[0])));
+
+    struct PIOS_FLASHFS_Stats stats;
+    EXPECT_EQ(0, PIOS_FLASHFS_GetStats(fs_id, &stats));
+    EXPECT_EQ(4, stats.num_active_slots);
+
+    unsigned char obj1_check[OBJ1_SIZE];
+    memset(obj1_check, 0, sizeof(obj1_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, 0, obj1_check, sizeof(obj1_check)));
+    EXPECT_EQ(0, memcmp(obj1, obj1_check, sizeof(obj1)));
+    memset(obj1_check, 0, sizeof(obj1_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, 123, obj1_check, sizeof(obj1_check)));
+    EXPECT_EQ(0, memcmp(obj1, obj1_check, sizeof(obj1)));
+
+    unsigned char obj2_check[OBJ2_SIZE];
+    memset(obj2_check, 0, sizeof(obj2_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ2_ID, 0, obj2_check, sizeof(obj2_check)));
+    EXPECT_EQ(0, memcmp(obj2, obj2_check, sizeof(obj2)));
+
+    unsigned char obj3_check[OBJ3_SIZE];
+    memset(obj3_check, 0, sizeof(obj3_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ3_ID, 0, obj3_check, sizeof(obj3_check)));
+    EXPECT_EQ(0, memcmp(obj3, obj3_check, sizeof(obj3)));
+}
+
+TEST_F(LogfsTestCooked, WriteMultipleGarbageCollect) {
+    uint16_t num_slots = (flashfs_config_partition_a.arena_size / flashfs_config_partition_a.slot_size) - 1;
+
+    /* Fill up the log with obsolete versions of obj1, leaving one free slot */
+    for (uint16_t i = 0; i < num_slots - 1; i++) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, 0, obj1_alt, sizeof(obj1_alt)));
+    }
+
+    /* Two objects do not fit into the free slot without gc */
+    struct PIOS_FLASHFS_ObjEntry objs[] = {
+        { OBJ1_ID, 0, sizeof(obj1), obj1 },
+        { OBJ2_ID, 0, sizeof(obj2), obj2 },
+    };
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSaveMultiple(fs_id, objs, 2));
+
+    unsigned char obj1_check[OBJ1_SIZE];
+    memset(obj1_check, 0, sizeof(obj1_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, 0, obj1_check, sizeof(obj1_check)));
+    EXPECT_EQ(0, memcmp(obj1, obj1_check, sizeof(obj1)));
+
+    /* More objects than the arena can hold fail without writing anything */
+    struct PIOS_FLASHFS_ObjEntry many[UINT8_MAX];
+    for (uint16_t i = 0; i < num_slots; i++) {
+        many[i].obj_id      = OBJ3_ID;
+        many[i].obj_inst_id = i;
+        many[i].obj_size    = sizeof(obj3);
+        many[i].obj_data    = obj3;
+    }
+    ASSERT_LE(num_slots, UINT8_MAX);
+    EXPECT_EQ(-4, PIOS_FLASHFS_ObjSaveMultiple(fs_id, many, num_slots));
+    EXPECT_EQ(-3, PIOS_FLASHFS_ObjLoad(fs_id, OBJ3_ID, 0, obj3, sizeof(obj3)));
+}
+
+TEST_F(LogfsTestCooked, WriteMultipleFullKeepsPrevious) {
+    uint16_t num_slots = (flashfs_config_partition_a.arena_size / flashfs_config_partition_a.slot_size) - 1;
+
+    /* Fill up the arena with active objects */
+    for (uint16_t i = 0; i < num_slots; i++) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, i, obj1_alt, sizeof(obj1_alt)));
+    }
+
+    /* Replacing objects in a full arena works */
+    struct PIOS_FLASHFS_ObjEntry objs[] = {
+        { OBJ1_ID, 0, sizeof(obj1), obj1 },
+        { OBJ1_ID, 1, sizeof(obj1), obj1 },
+        { OBJ2_ID, 0, sizeof(obj2), obj2 },
+    };
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSaveMultiple(fs_id, objs, 2));
+
+    unsigned char obj1_check[OBJ1_SIZE];
+    memset(obj1_check, 0, sizeof(obj1_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, 1, obj1_check, sizeof(obj1_check)));
+    EXPECT_EQ(0, memcmp(obj1, obj1_check, sizeof(obj1)));
+
+    /* A new object does not fit, the previous versions of the others are kept */
+    objs[0].obj_inst_id = 2;
+    objs[1].obj_inst_id = 3;
+    EXPECT_EQ(-4, PIOS_FLASHFS_ObjSaveMultiple(fs_id, objs, 3));
+
+    struct PIOS_FLASHFS_Stats stats;
+    EXPECT_EQ(0, PIOS_FLASHFS_GetStats(fs_id, &stats));
+    EXPECT_EQ(num_slots, stats.num_active_slots);
+
+    memset(obj1_check, 0, sizeof(obj1_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, 2, obj1_check, sizeof(obj1_check)));
+    EXPECT_EQ(0, memcmp(obj1_alt, obj1_check, sizeof(obj1_alt)));
+    memset(obj1_check, 0, sizeof(obj1_check));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, 3, obj1_check, sizeof(obj1_check)));
+    EXPECT_EQ(0, memcmp(obj1_alt, obj1_check, sizeof(obj1_alt)));
+}
+
+TEST_F(LogfsTestCooked, WriteMultipleVersusSingle) {
+    uint8_t objs_data[BATCH_OBJS][OBJ1_SIZE];
+    struct PIOS_FLASHFS_ObjEntry objs[BATCH_OBJS];
+
+    for (uint16_t i = 0; i < BATCH_OBJS; i++) {
+        memset(objs_data[i], i, sizeof(objs_data[i]));
+        objs[i].obj_id      = OBJ1_ID + i;
+        objs[i].obj_inst_id = 0;
+        objs[i].obj_size    = sizeof(objs_data[i]);
+        objs[i].obj_data    = objs_data[i];
+    }
+
+    /* Settings saved after the setup wizard, first one by one, then in one go */
+    struct pios_flash_ut_stats before, single, multiple;
+    PIOS_Flash_UT_GetStats(flash_id, &before);
+    for (uint16_t i = 0; i < BATCH_OBJS; i++) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, objs[i].obj_id, 0, objs[i].obj_data, objs[i].obj_size));
+    }
+    PIOS_Flash_UT_GetStats(flash_id, &single);
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSaveMultiple(fs_id, objs, BATCH_OBJS));
+    PIOS_Flash_UT_GetStats(flash_id, &multiple);
+
+    uint32_t single_reads   = single.reads - before.reads;
+    uint32_t multiple_reads = multiple.reads - single.reads;
+    printf("%u objects: one by one %u transactions %u reads, batched %u transactions %u reads\n",
+           BATCH_OBJS, single.transactions - before.transactions, single_reads,
+           multiple.transactions - single.transactions, multiple_reads);
+
+    EXPECT_EQ(1u, multiple.transactions - single.transactions);
+    EXPECT_LT(multiple_reads, single_reads);
+}
+
+/* what PIOS_FLASHFS_ObjLoadAll() passed on */
+struct LoadAllSeen {
+    uint32_t obj_id[8];
+    uint16_t obj_inst_id[8];
+    uint8_t  first[8]; // first data byte, 0 without data
+    uint16_t count;
+};
+
+static int32_t loadAllSeen(const struct PIOS_FLASHFS_ObjEntry *obj, void *context)
+{
+    struct LoadAllSeen *seen = (struct LoadAllSeen *)context;
+
+    if (seen->count >= 8) {
+        return -1;
+    }
+    seen->obj_id[seen->count]      = obj->obj_id;
+    seen->obj_inst_id[seen->count] = obj->obj_inst_id;
+    seen->first[seen->count]       = obj->obj_data ? obj->obj_data[0] : 0;
+    seen->count++;
+    return obj->obj_data ? 0 : -1;
+}
+
+TEST_F(LogfsTestCooked, LoadAllActiveSlots) {
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, 0, obj1_alt, sizeof(obj1_alt)));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ2_ID, 0, obj2, sizeof(obj2)));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, 123, obj1, sizeof(obj1)));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ3_ID, 0, obj3, sizeof(obj3)));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, 0, obj1, sizeof(obj1)));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjDelete(fs_id, OBJ2_ID, 0));
+
+    /* Obsolete versions and deleted objects are skipped, obj3 does not fit the buffer */
+    uint8_t buffer[OBJ2_SIZE];
+    struct LoadAllSeen seen;
+    memset(&seen, 0, sizeof(seen));
+    EXPECT_EQ(2, PIOS_FLASHFS_ObjLoadAll(fs_id, buffer, sizeof(buffer), loadAllSeen, &seen));
+    ASSERT_EQ(3, seen.count);
+    EXPECT_EQ((uint32_t)OBJ1_ID, seen.obj_id[0]);
+    EXPECT_EQ(123, seen.obj_inst_id[0]);
+    EXPECT_EQ(obj1[0], seen.first[0]);
+    EXPECT_EQ((uint32_t)OBJ3_ID, seen.obj_id[1]);
+    EXPECT_EQ(0, seen.first[1]);
+    EXPECT_EQ((uint32_t)OBJ1_ID, seen.obj_id[2]);
+    EXPECT_EQ(0, seen.obj_inst_id[2]);
+    EXPECT_EQ(obj1[0], seen.first[2]);
+
+    /* An empty filesystem has nothing to pass on */
+    EXPECT_EQ(0, PIOS_FLASHFS_Format(fs_id));
+    memset(&seen, 0, sizeof(seen));
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoadAll(fs_id, buffer, sizeof(buffer), loadAllSeen, &seen));
+    EXPECT_EQ(0, seen.count);
+}
+
+/* the registered objects of a simulated boot, data and metadata */
+struct BootObjects {
+    uint8_t data[BOOT_OBJS][BOOT_SIZE];
+    uint8_t meta[BOOT_OBJS][BOOT_SIZE];
+};
+
+#define BOOT_OBJ_ID(i) (0x10000000u + 2 * (i))
+
+static int32_t loadBootObject(const struct PIOS_FLASHFS_ObjEntry *obj, void *context)
+{
+    struct BootObjects *objects = (struct BootObjects *)context;
+    uint32_t i = (obj->obj_id - BOOT_OBJ_ID(0)) / 2;
+
+    if (i >= BOOT_OBJS || obj->obj_inst_id != 0 || obj->obj_size != BOOT_SIZE || !obj->obj_data) {
+        return -1;
+    }
+    memcpy((obj->obj_id & 1) ? objects->meta[i] : objects->data[i], obj->obj_data, BOOT_SIZE);
+    return 0;
+}
+
+TEST_F(LogfsTestCooked, LoadAllVersusOneByOne) {
+    static struct BootObjects stored, single, all;
+    uint8_t buffer[256];
+
+    /* Some settings saved, some metadata changed, the rest stays at the defaults */
+    for (uint32_t i = 0; i < BOOT_OBJS; i++) {
+        memset(stored.data[i], i + 1, BOOT_SIZE);
+        memset(stored.meta[i], 0x80 + i, BOOT_SIZE);
+    }
+    for (uint32_t i = 0; i < BOOT_SETTINGS; i++) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, BOOT_OBJ_ID(i), 0, stored.data[i], BOOT_SIZE));
+    }
+    for (uint32_t i = 0; i < BOOT_META; i++) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, BOOT_OBJ_ID(i) + 1, 0, stored.meta[i], BOOT_SIZE));
+    }
+
+    /* What UAVObjRegister() did for every object, then the same in one pass */
+    struct pios_flash_ut_stats before, one_by_one, one_pass;
+    PIOS_Flash_UT_GetStats(flash_id, &before);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < BOOT_OBJS; i++) {
+        PIOS_FLASHFS_ObjLoad(fs_id, BOOT_OBJ_ID(i) + 1, 0, single.meta[i], BOOT_SIZE);
+        if (i < BOOT_SETTINGS + 10) {
+            // settings objects, ten of them never saved
+            PIOS_FLASHFS_ObjLoad(fs_id, BOOT_OBJ_ID(i), 0, single.data[i], BOOT_SIZE);
+        }
+    }
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    PIOS_Flash_UT_GetStats(flash_id, &one_by_one);
+    EXPECT_EQ(BOOT_SETTINGS + BOOT_META, PIOS_FLASHFS_ObjLoadAll(fs_id, buffer, sizeof(buffer), loadBootObject, &all));
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    PIOS_Flash_UT_GetStats(flash_id, &one_pass);
+
+    EXPECT_EQ(0, memcmp(&single, &all, sizeof(all)));
+    EXPECT_EQ(0, memcmp(all.data, stored.data, BOOT_SETTINGS * BOOT_SIZE));
+    EXPECT_EQ(0, memcmp(all.meta, stored.meta, BOOT_META * BOOT_SIZE));
+
+    uint32_t single_reads = one_by_one.reads - before.reads;
+    uint32_t all_reads    = one_pass.reads - one_by_one.reads;
+    printf("boot with %u objects: one by one %u transactions %u reads %ld us, one pass %u transactions %u reads %ld us\n",
+           BOOT_OBJS, one_by_one.transactions - before.transactions, single_reads,
+           (long)std::chrono::duration_cast<std::chrono::microseconds>(middle - start).count(),
+           one_pass.transactions - one_by_one.transactions, all_reads,
+           (long)std::chrono::duration_cast<std::chrono::microseconds>(end - middle).count());
+
+    EXPECT_EQ(1u, one_pass.transactions - one_by_one.transactions);
+    // a header and the data of every slot, and the empty slot ending the log
+    EXPECT_EQ(2u * (BOOT_SETTINGS + BOOT_META) + 1, all_reads);
+    EXPECT_LT(all_reads * 10, single_reads);
+}
+
 class LogfsTestCookedMultiPart : public LogfsTestRaw {
 protected:
     virtual void SetUp()
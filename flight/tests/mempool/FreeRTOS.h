@@ -0,0 +1,5 @@
+#include <stdlib.h>
+#define pvPortMalloc(xSize) (malloc(xSize))
+#define vPortFree(pv)       (free(pv))
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
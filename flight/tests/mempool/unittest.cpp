@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* snprintf */
+#include <stdarg.h> /* va_list */
+#include <string.h> /* memset */
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+}
+
+// same layout as struct ObjectEventEntry
+struct Entry {
+    struct Entry *next;
+    void    *queue;
+    void    *cb;
+    uint8_t eventMask;
+    bool    fast;
+};
+
+// sram and fast heap, everything pios_mem.c took since the start
+static size_t heapBytes[2];
+
+extern "C" void *pios_general_malloc(__attribute__((unused)) void *ptr, size_t size, bool fastheap)
+{
+    heapBytes[fastheap] += size;
+    return malloc(size);
+}
+
+static std::vector<std::string> reportLines;
+
+extern "C" void reportLine(char *format, ...)
+{
+    char line[256];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    reportLines.push_back(line);
+}
+
+static bool isZero(const void *p, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        if (((const uint8_t *)p)[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+class MemPool : public testing::Test {};
+
+TEST_F(MemPool, ElementsAreCarvedFromBlocks) {
+    static struct pios_mem_pool pool = PIOS_MEM_POOL("test entries", struct Entry, 4, false);
+    size_t before = heapBytes[0];
+    uint8_t *e[5];
+
+    for (int i = 0; i < 5; i++) {
+        e[i] = (uint8_t *)pios_mem_pool_alloc(&pool);
+        ASSERT_TRUE(e[i] != NULL);
+        EXPECT_TRUE(isZero(e[i], sizeof(struct Entry)));
+        memset(e[i], 0xa5, sizeof(struct Entry));
+    }
+
+    // the first four share a block, the fifth starts the next one
+    EXPECT_EQ(0u, (uintptr_t)e[0] % PIOS_MEM_ALIGNMENT);
+    for (int i = 1; i < 4; i++) {
+        EXPECT_EQ(e[i - 1] + pool.elem_size, e[i]);
+    }
+    EXPECT_EQ(2, pool.blocks);
+    EXPECT_EQ(2u * 4 * pool.elem_size, heapBytes[0] - before);
+    EXPECT_EQ(heapBytes[0] - before, pool.heap_bytes);
+    EXPECT_EQ(5, pool.count);
+    EXPECT_EQ(5u * pool.elem_size, pool.used_bytes);
+    EXPECT_EQ(pool.used_bytes, pool.peak_bytes);
+}
+
+TEST_F(MemPool, FreedElementsAreReused) {
+    static struct pios_mem_pool pool = PIOS_MEM_POOL("test reuse", struct Entry, 4, false);
+    void *a = pios_mem_pool_alloc(&pool);
+    void *b = pios_mem_pool_alloc(&pool);
+
+    ASSERT_TRUE(a != NULL && b != NULL);
+    memset(a, 0xa5, sizeof(struct Entry));
+    size_t heap = pool.heap_bytes;
+
+    pios_mem_pool_free(&pool, a);
+    pios_mem_pool_free(&pool, NULL);
+    EXPECT_EQ(1, pool.count);
+
+    // comes back zeroed, without touching the heap
+    void *c = pios_mem_pool_alloc(&pool);
+    EXPECT_EQ(a, c);
+    EXPECT_TRUE(isZero(c, sizeof(struct Entry)));
+    EXPECT_EQ(heap, pool.heap_bytes);
+
+    pios_mem_pool_free(&pool, b);
+    pios_mem_pool_free(&pool, c);
+    EXPECT_EQ(0, pool.count);
+    EXPECT_EQ(0u, pool.used_bytes);
+    EXPECT_EQ(2u * pool.elem_size, pool.peak_bytes);
+}
+
+TEST_F(MemPool, FastPoolsUseTheFastHeap) {
+    static struct pios_mem_pool pool = PIOS_MEM_POOL("test fast", struct Entry, 8, true);
+    size_t sram = heapBytes[0];
+    size_t fast = heapBytes[1];
+
+    ASSERT_TRUE(pios_mem_pool_alloc(&pool) != NULL);
+    EXPECT_EQ(sram, heapBytes[0]);
+    EXPECT_EQ(8u * pool.elem_size, heapBytes[1] - fast);
+}
+
+TEST_F(MemPool, ArenaKeepsItsBlockForSmallAllocations) {
+    static struct pios_mem_pool arena = PIOS_MEM_ARENA("test arena", 256, false);
+    uint8_t *p1 = (uint8_t *)pios_mem_arena_alloc(&arena, 3);
+    uint8_t *p2 = (uint8_t *)pios_mem_arena_alloc(&arena, 10);
+
+    ASSERT_TRUE(p1 != NULL && p2 != NULL);
+    EXPECT_EQ(0u, (uintptr_t)p1 % PIOS_MEM_ALIGNMENT);
+    EXPECT_EQ(p1 + 8, p2);
+    EXPECT_EQ(24u, arena.used_bytes);
+
+    // larger than a block, gets its own and the block stays in use
+    uint8_t *big = (uint8_t *)pios_mem_arena_alloc(&arena, 300);
+    ASSERT_TRUE(big != NULL);
+    EXPECT_TRUE(isZero(big, 300));
+    EXPECT_EQ(256u + 304u, arena.heap_bytes);
+    EXPECT_EQ(p2 + 16, (uint8_t *)pios_mem_arena_alloc(&arena, 8));
+
+    // 24 bytes left, less than an eighth of the block, the next one starts a block
+    ASSERT_TRUE(pios_mem_arena_alloc(&arena, 200) != NULL);
+    EXPECT_EQ(1, arena.blocks);
+    ASSERT_TRUE(pios_mem_arena_alloc(&arena, 40) != NULL);
+    EXPECT_EQ(2, arena.blocks);
+
+    // 116 bytes left are worth keeping, 200 goes to the heap on its own
+    ASSERT_TRUE(pios_mem_arena_alloc(&arena, 100) != NULL);
+    size_t heap = arena.heap_bytes;
+    ASSERT_TRUE(pios_mem_arena_alloc(&arena, 200) != NULL);
+    EXPECT_EQ(2, arena.blocks);
+    EXPECT_EQ(heap + 200, arena.heap_bytes);
+    EXPECT_EQ(8, arena.count);
+}
+
+TEST_F(MemPool, ReportAccountsForTheWholeHeap) {
+    static struct pios_mem_pool pool = PIOS_MEM_POOL("test report", struct Entry, 2, true);
+
+    ASSERT_TRUE(pios_mem_pool_alloc(&pool) != NULL);
+
+    reportLines.clear();
+    pios_mem_report(reportLine);
+
+    size_t pools = 0;
+    for (const struct pios_mem_pool *p = pios_mem_pools(); p; p = p->next) {
+        pools++;
+    }
+    ASSERT_EQ(pools + 1, reportLines.size());
+    EXPECT_EQ(0u, reportLines[pools - 1].find("mem test report: 1 allocs"));
+    EXPECT_NE(std::string::npos, reportLines[pools - 1].find("(fast)"));
+
+    // everything in here takes its heap through pools, nothing is missing
+    char total[64];
+    snprintf(total, sizeof(total), "mem total: %u heap", (unsigned)(heapBytes[0] + heapBytes[1]));
+    EXPECT_EQ(total, reportLines[pools]);
+}
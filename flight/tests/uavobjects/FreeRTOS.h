@@ -0,0 +1,33 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef void *xQueueHandle;
+typedef void *xSemaphoreHandle;
+typedef void *xTaskHandle;
+typedef uint32_t portTickType;
+
+#define pdTRUE                   1
+#define pdFALSE                  0
+#define portMAX_DELAY            0xffffffff
+#define portTICK_RATE_MS         1
+#define tskIDLE_PRIORITY         0
+#define configMINIMAL_STACK_SIZE 128
+
+#define pvPortMalloc(xSize) (malloc(xSize))
+#define vPortFree(pv)       (free(pv))
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+
+/* single threaded, the recursive mutex never blocks */
+xSemaphoreHandle xSemaphoreCreateRecursiveMutex(void);
+int32_t xSemaphoreTakeRecursive(xSemaphoreHandle mutex, uint32_t timeout);
+int32_t xSemaphoreGiveRecursive(xSemaphoreHandle mutex);
+xQueueHandle xQueueCreate(uint32_t length, uint32_t itemSize);
+int32_t xQueueSend(xQueueHandle queue, const void *item, uint32_t timeout);
+int32_t xQueueReceive(xQueueHandle queue, void *item, uint32_t timeout);
+portTickType xTaskGetTickCount(void);
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,341 @@
+#include "gtest/gtest.h"
+
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memset */
+#include <vector>
+
+extern "C" {
+#include "openpilot.h"
+#include "inc/uavobjectprivate.h"
+#include "uavobjectsinit.h"
+}
+
+/*
+ * The handle table of the objects under test, the generated code puts one
+ * handle per object in this section the same way.
+ */
+#define TEST_OBJECTS 4
+UAVObjHandle testHandles[TEST_OBJECTS] __attribute__((section("_uavo_handles"), used));
+
+/*
+ * simposix takes its heap from malloc() through heap_3, glibc puts a size word
+ * in front of every chunk and rounds chunks up to 16 bytes, 32 at least.
+ */
+static size_t simposixHeapCost(size_t size)
+{
+    size_t chunk = (size + 8 + 15) & ~(size_t)15;
+
+    return chunk < 32 ? 32 : chunk;
+}
+
+// everything pios_mem.c took from the heap since the start
+static size_t heapCost;
+
+extern "C" void *pios_general_malloc(__attribute__((unused)) void *ptr, size_t size, __attribute__((unused)) bool fastheap)
+{
+    heapCost += simposixHeapCost(size);
+    return malloc(size);
+}
+
+extern "C" xSemaphoreHandle xSemaphoreCreateRecursiveMutex(void)
+{
+    static int mutex;
+
+    return &mutex;
+}
+
+extern "C" int32_t xSemaphoreTakeRecursive(__attribute__((unused)) xSemaphoreHandle mutex, __attribute__((unused)) uint32_t timeout)
+{
+    return pdTRUE;
+}
+
+extern "C" int32_t xSemaphoreGiveRecursive(__attribute__((unused)) xSemaphoreHandle mutex)
+{
+    return pdTRUE;
+}
+
+extern "C" xQueueHandle xQueueCreate(__attribute__((unused)) uint32_t length, __attribute__((unused)) uint32_t itemSize)
+{
+    static int queue;
+
+    return &queue;
+}
+
+extern "C" int32_t xQueueSend(__attribute__((unused)) xQueueHandle queue, __attribute__((unused)) const void *item, __attribute__((unused)) uint32_t timeout)
+{
+    return pdTRUE;
+}
+
+extern "C" int32_t xQueueReceive(__attribute__((unused)) xQueueHandle queue, __attribute__((unused)) void *item, __attribute__((unused)) uint32_t timeout)
+{
+    return pdFALSE;
+}
+
+extern "C" portTickType xTaskGetTickCount(void)
+{
+    return 0;
+}
+
+// the event dispatcher only runs from its callback, which never does here
+extern "C" DelayedCallbackInfo *PIOS_CALLBACKSCHEDULER_Create(__attribute__((unused)) DelayedCallback cb, __attribute__((unused)) DelayedCallbackPriority priority,
+                                                              __attribute__((unused)) DelayedCallbackPriorityTask priorityTask, __attribute__((unused)) int16_t callbackID,
+                                                              __attribute__((unused)) uint32_t stacksize)
+{
+    static int callback;
+
+    return (DelayedCallbackInfo *)&callback;
+}
+
+extern "C" int32_t PIOS_CALLBACKSCHEDULER_Dispatch(__attribute__((unused)) DelayedCallbackInfo *cbinfo)
+{
+    return 1;
+}
+
+extern "C" int32_t PIOS_CALLBACKSCHEDULER_Schedule(__attribute__((unused)) DelayedCallbackInfo *cbinfo, __attribute__((unused)) int32_t milliseconds,
+                                                   __attribute__((unused)) DelayedCallbackUpdateMode updatemode)
+{
+    return 1;
+}
+
+extern "C" uint8_t PIOS_CRC_updateCRC(uint8_t crc, __attribute__((unused)) const uint8_t *data, __attribute__((unused)) int32_t length)
+{
+    return crc;
+}
+
+extern "C" uint32_t PIOS_CRC32_updateCRC(uint32_t crc, __attribute__((unused)) const uint8_t *data, __attribute__((unused)) int32_t length)
+{
+    return crc;
+}
+
+// instance ids and first bytes seen by the iterator
+struct Visit {
+    std::vector<uint16_t> ids;
+    std::vector<uint8_t>  first;
+    uint16_t stopAfter;
+};
+
+static bool visitInstance(__attribute__((unused)) UAVObjHandle obj_handle, uint16_t instId, const void *data, void *context)
+{
+    struct Visit *visit = (struct Visit *)context;
+
+    visit->ids.push_back(instId);
+    visit->first.push_back(*(const uint8_t *)data);
+    return visit->ids.size() < visit->stopAfter;
+}
+
+class UAVObjects : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        ASSERT_EQ(0, UAVObjInitialize());
+    }
+
+    // registers a multi instance object of 5 bytes, its instances are 8 bytes apart in the chunks,
+    // the metaobject takes the next id
+    static struct UAVOData *registerMulti(int slot, uint16_t count)
+    {
+        testHandles[slot] = UAVObjRegister(0x1000 + 2 * slot, false, false, false, 5, NULL);
+        if (!testHandles[slot]) {
+            return NULL;
+        }
+        // create the instances, every byte holds the instance id
+        for (uint16_t instId = 0; instId < count; instId++) {
+            uint8_t data[5];
+            if (instId > 0 && UAVObjCreateInstance(testHandles[slot], NULL) != instId) {
+                return NULL;
+            }
+            memset(data, instId, sizeof(data));
+            if (UAVObjSetInstanceData(testHandles[slot], instId, data) != 0) {
+                return NULL;
+            }
+        }
+        return (struct UAVOData *)testHandles[slot];
+    }
+};
+
+TEST_F(UAVObjects, InstancesFillTheChunksInOrder) {
+    uint16_t count = 3 * UAVOBJ_INSTANCE_CHUNK + 2;
+    struct UAVOData *obj = registerMulti(0, count);
+
+    ASSERT_TRUE(obj != NULL);
+    ASSERT_EQ(count, UAVObjGetNumInstances(obj));
+    EXPECT_EQ(8, ObjMultiInstanceStride(obj));
+    EXPECT_EQ((void *)((struct UAVOMulti *)obj)->instance0, getInstance(obj, 0));
+
+    // neighbours in a chunk are one stride apart, every chunk starts elsewhere
+    for (uint16_t instId = 1; instId < count; instId++) {
+        uint8_t *data = (uint8_t *)getInstance(obj, instId);
+        ASSERT_TRUE(data != NULL);
+        if ((instId - 1) % UAVOBJ_INSTANCE_CHUNK != 0) {
+            EXPECT_EQ((uint8_t *)getInstance(obj, instId - 1) + ObjMultiInstanceStride(obj), data);
+        } else {
+            EXPECT_NE((uint8_t *)getInstance(obj, instId - 1) + ObjMultiInstanceStride(obj), data);
+        }
+        EXPECT_EQ(instId, data[0]);
+        EXPECT_EQ(instId, data[4]);
+    }
+    EXPECT_TRUE(getInstance(obj, count) == NULL);
+    EXPECT_TRUE(getInstance(obj, count + UAVOBJ_INSTANCE_CHUNK) == NULL);
+
+    // 25 instances in chunks, the last one holds a single instance
+    int chunks = 0;
+    for (struct UAVOMultiChunk *chunk = ((struct UAVOMulti *)obj)->chunks; chunk; chunk = chunk->next) {
+        chunks++;
+    }
+    EXPECT_EQ(4, chunks);
+}
+
+TEST_F(UAVObjects, InstanceDataRoundTrips) {
+    uint16_t count = 2 * UAVOBJ_INSTANCE_CHUNK + 1;
+    struct UAVOData *obj = registerMulti(1, count);
+    uint8_t in[5] = { 1, 2, 3, 4, 5 };
+    uint8_t out[5];
+
+    ASSERT_TRUE(obj != NULL);
+    ASSERT_EQ(0, UAVObjSetInstanceData(obj, UAVOBJ_INSTANCE_CHUNK + 1, in));
+    ASSERT_EQ(0, UAVObjGetInstanceData(obj, UAVOBJ_INSTANCE_CHUNK + 1, out));
+    EXPECT_EQ(0, memcmp(in, out, sizeof(in)));
+
+    // the neighbours across the chunk boundary keep their data
+    ASSERT_EQ(0, UAVObjGetInstanceData(obj, UAVOBJ_INSTANCE_CHUNK, out));
+    EXPECT_EQ(UAVOBJ_INSTANCE_CHUNK, out[4]);
+    ASSERT_EQ(0, UAVObjGetInstanceData(obj, UAVOBJ_INSTANCE_CHUNK + 2, out));
+    EXPECT_EQ(UAVOBJ_INSTANCE_CHUNK + 2, out[0]);
+
+    EXPECT_EQ(-1, UAVObjGetInstanceData(obj, count, out));
+    EXPECT_EQ(-1, UAVObjSetInstanceData(obj, count, in));
+}
+
+TEST_F(UAVObjects, IterationVisitsTheInstancesInOrder) {
+    uint16_t count = 2 * UAVOBJ_INSTANCE_CHUNK + 3;
+    struct UAVOData *obj = registerMulti(2, count);
+
+    ASSERT_TRUE(obj != NULL);
+
+    struct Visit all = { std::vector<uint16_t>(), std::vector<uint8_t>(), 0xffff };
+    EXPECT_EQ(count, UAVObjIterateInstances(obj, 0xffff, visitInstance, &all));
+    ASSERT_EQ((size_t)count, all.ids.size());
+    for (uint16_t instId = 0; instId < count; instId++) {
+        EXPECT_EQ(instId, all.ids[instId]);
+        EXPECT_EQ(instId, all.first[instId]);
+    }
+
+    // the count ends the iteration, here on the first instance of the second chunk
+    struct Visit some = { std::vector<uint16_t>(), std::vector<uint8_t>(), 0xffff };
+    EXPECT_EQ(UAVOBJ_INSTANCE_CHUNK + 2, UAVObjIterateInstances(obj, UAVOBJ_INSTANCE_CHUNK + 2, visitInstance, &some));
+    ASSERT_EQ(UAVOBJ_INSTANCE_CHUNK + 2u, some.ids.size());
+    EXPECT_EQ(UAVOBJ_INSTANCE_CHUNK + 1, some.first.back());
+
+    // and so does the iterator
+    struct Visit stopped = { std::vector<uint16_t>(), std::vector<uint8_t>(), 3 };
+    EXPECT_EQ(3, UAVObjIterateInstances(obj, 0xffff, visitInstance, &stopped));
+    EXPECT_EQ(3u, stopped.ids.size());
+}
+
+TEST_F(UAVObjects, SingleInstanceObjectsAreNotIterated) {
+    UAVObjHandle single = UAVObjRegister(0x2000, true, false, false, 12, NULL);
+    struct Visit visit  = { std::vector<uint16_t>(), std::vector<uint8_t>(), 0xffff };
+
+    ASSERT_TRUE(single != NULL);
+    testHandles[3] = single;
+    EXPECT_EQ(0, UAVObjIterateInstances(single, 0xffff, visitInstance, &visit));
+    EXPECT_EQ(0u, visit.ids.size());
+    EXPECT_TRUE(getInstance((struct UAVOData *)single, 1) == NULL);
+}
+
+/*
+ * Boot of the simposix target: the objects of its UAVObjects.inc registered
+ * by UAVObjectsInitializeAll(), then the connections the telemetry makes for
+ * every object and metaobject at its start, through the real object manager
+ * and event dispatcher.
+ */
+static int telemetryQueue;
+
+static void connectTelemetry(UAVObjHandle obj)
+{
+    if (UAVObjIsMetaobject(obj)) {
+        UAVObjConnectQueue(obj, &telemetryQueue, EV_MASK_ALL_UPDATES);
+        return;
+    }
+
+    UAVObjMetadata metadata;
+    UAVObjEvent ev;
+    UAVObjGetMetadata(obj, &metadata);
+    ev.obj    = obj;
+    ev.instId = UAVOBJ_ALL_INSTANCES;
+    ev.event  = EV_UPDATED_PERIODIC;
+    ev.lowPriority = true;
+    EventPeriodicQueueCreate(&ev, &telemetryQueue, UAVObjGetTelemetryUpdateMode(&metadata) == UPDATEMODE_MANUAL ? 0 : metadata.telemetryUpdatePeriod);
+    ev.event  = EV_LOGGING_PERIODIC;
+    EventPeriodicQueueCreate(&ev, &telemetryQueue, UAVObjGetLoggingUpdateMode(&metadata) == UPDATEMODE_MANUAL ? 0 : metadata.loggingUpdatePeriod);
+    UAVObjConnectQueue(obj, &telemetryQueue, EV_MASK_ALL_UPDATES);
+}
+
+// the heap of the objects with one malloc each, the way they were allocated before the arena
+static int bootObjects;
+static size_t bootObjectsHeap;
+
+static void countObject(UAVObjHandle obj)
+{
+    if (UAVObjIsMetaobject(obj)) {
+        return;
+    }
+    size_t header = UAVObjIsSingleInstance(obj) ? sizeof(struct UAVOSingle) : sizeof(struct UAVOMulti);
+    bootObjects++;
+    bootObjectsHeap += simposixHeapCost(header + UAVObjGetNumBytes(obj));
+}
+
+static struct pios_mem_pool *findPool(const char *name)
+{
+    for (struct pios_mem_pool *pool = (struct pios_mem_pool *)pios_mem_pools(); pool; pool = pool->next) {
+        if (!strcmp(pool->name, name)) {
+            return pool;
+        }
+    }
+    return NULL;
+}
+
+TEST(UAVObjectsBoot, SimposixPeakHeap) {
+    ASSERT_EQ(0, UAVObjInitialize());
+    ASSERT_EQ(0, EventDispatcherInitialize());
+
+    // pools are listed from their first allocation on, other tests may have used them
+    struct pios_mem_pool *events   = findPool("uavobject events");
+    struct pios_mem_pool *periodic = findPool("periodic events");
+    size_t before      = heapCost;
+    int eventsBefore   = events ? events->count : 0;
+    int periodicBefore = periodic ? periodic->count : 0;
+
+    UAVObjectsInitializeAll();
+    UAVObjIterate(&connectTelemetry);
+
+    // nothing is freed at boot, the heap taken is the peak
+    size_t peak = heapCost - before;
+    struct pios_mem_pool *objects = findPool("uavobjects");
+    events   = findPool("uavobject events");
+    periodic = findPool("periodic events");
+    ASSERT_TRUE(objects && events && periodic);
+    int newEvents   = events->count - eventsBefore;
+    int newPeriodic = periodic->count - periodicBefore;
+
+    bootObjects     = 0;
+    bootObjectsHeap = 0;
+    UAVObjIterate(&countObject);
+    size_t perMalloc = bootObjectsHeap + newEvents * simposixHeapCost(events->elem_size) + newPeriodic * simposixHeapCost(periodic->elem_size);
+
+    RecordProperty("objects", bootObjects);
+    RecordProperty("event_entries", newEvents);
+    RecordProperty("periodic_entries", newPeriodic);
+    RecordProperty("peak_heap_bytes", (int)peak);
+    RecordProperty("malloc_heap_bytes", (int)perMalloc);
+    EXPECT_EQ(bootObjects * 2, newEvents);
+    EXPECT_EQ(bootObjects * 2, newPeriodic);
+    EXPECT_LT(peak, perMalloc);
+
+    // pools waste at most the rest of their last block
+    EXPECT_LT(events->heap_bytes - events->used_bytes, events->block_size);
+    EXPECT_LT(periodic->heap_bytes - periodic->used_bytes, periodic->block_size);
+
+    // the arena at most an eighth of every block it left and the rest of the last one
+    EXPECT_LE(objects->heap_bytes - objects->used_bytes, (objects->blocks - 1u) * objects->block_size / 8 + objects->block_size);
+}
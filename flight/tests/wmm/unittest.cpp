@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <time.h> /* clock_gettime */
+
+extern "C" {
+#include "WorldMagModel.h"
+
+// wmm_reference.c, the model before its evaluation was cached
+int WMM_Reference_GetMagVector(float Lat, float Lon, float AltEllipsoid, uint16_t Month, uint16_t Day, uint16_t Year, float B[3]);
+}
+
+// WMM_GetMagVector returns the field in nT * 1e-2
+#define epsilon_noaa  0.1f /* 10nT, float evaluation against the double precision NOAA reference */
+#define epsilon_cache 1e-3f
+#define epsilon_ref   1e-3f /* 0.1nT, same float evaluation in a different order */
+
+class WorldMagModelTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        ASSERT_EQ(0, WMM_Initialize());
+    }
+};
+
+/* Test values from the WMM2015 report (WMM2015_TEST_VALUES.txt) */
+struct wmm_test_value {
+    uint16_t year;
+    uint16_t month;
+    uint16_t day;
+    float    alt; // m
+    float    lat;
+    float    lon;
+    float    X; // nT
+    float    Y;
+    float    Z;
+};
+
+static const struct wmm_test_value noaa_values[] = {
+    { 2015, 1, 1, 0.0f,      80.0f,  0.0f,    6627.1f,  -445.9f, 54432.3f  },
+    { 2015, 1, 1, 0.0f,      0.0f,   120.0f,  39518.2f, 392.9f,  -11252.4f },
+    { 2015, 1, 1, 0.0f,      -80.0f, -120.0f, 5797.3f,  15761.1f, -52919.1f },
+    { 2015, 1, 1, 100000.0f, 80.0f,  0.0f,    6314.3f,  -471.6f, 52269.8f  },
+    { 2015, 1, 1, 100000.0f, 0.0f,   120.0f,  37535.6f, 364.4f,  -10773.4f },
+    { 2015, 1, 1, 100000.0f, -80.0f, -120.0f, 5613.1f,  14791.5f, -50378.6f },
+    { 2017, 7, 2, 0.0f,      80.0f,  0.0f,    6599.4f,  -317.1f, 54459.2f  },
+    { 2017, 7, 2, 0.0f,      0.0f,   120.0f,  39571.4f, 222.5f,  -11030.1f },
+    { 2017, 7, 2, 0.0f,      -80.0f, -120.0f, 5873.8f,  15781.4f, -52687.9f },
+    { 2017, 7, 2, 100000.0f, 80.0f,  0.0f,    6290.5f,  -348.5f, 52292.7f  },
+    { 2017, 7, 2, 100000.0f, 0.0f,   120.0f,  37585.5f, 209.7f,  -10564.2f },
+    { 2017, 7, 2, 100000.0f, -80.0f, -120.0f, 5683.5f,  14808.8f, -50163.0f },
+};
+
+#define NOAA_VALUES (sizeof(noaa_values) / sizeof(noaa_values[0]))
+
+static double now_us()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+TEST_F(WorldMagModelTest, NOAATestValues) {
+    float B[3];
+
+    for (uint32_t i = 0; i < NOAA_VALUES; i++) {
+        const struct wmm_test_value *v = &noaa_values[i];
+        ASSERT_EQ(0, WMM_GetMagVector(v->lat, v->lon, v->alt, v->month, v->day, v->year, B));
+        EXPECT_NEAR(v->X * 1e-2f, B[0], epsilon_noaa) << "test value " << i;
+        EXPECT_NEAR(v->Y * 1e-2f, B[1], epsilon_noaa) << "test value " << i;
+        EXPECT_NEAR(v->Z * 1e-2f, B[2], epsilon_noaa) << "test value " << i;
+    }
+}
+
+TEST_F(WorldMagModelTest, RangeCheck) {
+    float B[3];
+
+    EXPECT_EQ(-1, WMM_GetMagVector(-90.1f, 0.0f, 0.0f, 1, 1, 2016, B));
+    EXPECT_EQ(-2, WMM_GetMagVector(90.1f, 0.0f, 0.0f, 1, 1, 2016, B));
+    EXPECT_EQ(-3, WMM_GetMagVector(0.0f, -180.1f, 0.0f, 1, 1, 2016, B));
+    EXPECT_EQ(-4, WMM_GetMagVector(0.0f, 180.1f, 0.0f, 1, 1, 2016, B));
+    EXPECT_EQ(-8, WMM_GetMagVector(0.0f, 0.0f, 0.0f, 2, 30, 2016, B));
+}
+
+// The cached evaluation must match a full evaluation from an empty cache
+TEST_F(WorldMagModelTest, CachedMatchesFull) {
+    float B[3], Bfull[3];
+
+    for (int i = 0; i < 200; i++) {
+        // walk along parallels, meridians and in altitude to hit every cache path
+        float lat  = -85.0f + (float)((i * 37) % 170);
+        float lon  = -180.0f + (float)((i * 53) % 360);
+        float alt  = (float)((i % 7) * 1000);
+        uint16_t month = 1 + (i / 50);
+
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon, alt, month, 15, 2016, B));
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon + 0.5f, alt, month, 15, 2016, B));
+        ASSERT_EQ(0, WMM_Initialize());
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon + 0.5f, alt, month, 15, 2016, Bfull));
+
+        EXPECT_NEAR(Bfull[0], B[0], epsilon_cache);
+        EXPECT_NEAR(Bfull[1], B[1], epsilon_cache);
+        EXPECT_NEAR(Bfull[2], B[2], epsilon_cache);
+    }
+}
+
+// Same results as before the evaluation was cached, over the globe and the model lifetime
+TEST_F(WorldMagModelTest, MatchesReference) {
+    float B[3], Bref[3];
+
+    for (int i = 0; i < 500; i++) {
+        float lat  = -90.0f + (float)((i * 37) % 181);
+        float lon  = -180.0f + (float)((i * 53) % 361) + 0.25f * (i % 3);
+        float alt  = (float)((i % 11) * 2500);
+        uint16_t year  = 2015 + (i % 5);
+        uint16_t month = 1 + (i % 12);
+        uint16_t day   = 1 + (i % 28);
+
+        if (lon > 180.0f) {
+            lon = 180.0f;
+        }
+        ASSERT_EQ(0, WMM_Reference_GetMagVector(lat, lon, alt, month, day, year, Bref));
+        ASSERT_EQ(0, WMM_GetMagVector(lat, lon, alt, month, day, year, B));
+
+        EXPECT_NEAR(Bref[0], B[0], epsilon_ref) << lat << " " << lon << " " << alt;
+        EXPECT_NEAR(Bref[1], B[1], epsilon_ref) << lat << " " << lon << " " << alt;
+        EXPECT_NEAR(Bref[2], B[2], epsilon_ref) << lat << " " << lon << " " << alt;
+    }
+}
+
+// Informational only, timings on a shared host are too noisy to test against
+TEST_F(WorldMagModelTest, Benchmark) {
+    const int runs = 2000;
+    float B[3];
+    double start, reference, full, latitude, longitude;
+
+    start = now_us();
+    for (int i = 0; i < runs; i++) {
+        WMM_Reference_GetMagVector(47.0f + 1e-4f * i, 8.0f + 1e-4f * i, 400.0f, 6, 1, 2016, B);
+    }
+    reference = (now_us() - start) / runs;
+
+    // full evaluation from an empty cache every time
+    start     = now_us();
+    for (int i = 0; i < runs; i++) {
+        WMM_Initialize();
+        WMM_GetMagVector(47.0f + 1e-4f * i, 8.0f + 1e-4f * i, 400.0f, 6, 1, 2016, B);
+    }
+    full  = (now_us() - start) / runs;
+
+    // latitude changes, Legendre functions are recomputed
+    start = now_us();
+    for (int i = 0; i < runs; i++) {
+        WMM_GetMagVector(47.0f + 1e-4f * i, 8.0f, 400.0f, 6, 1, 2016, B);
+    }
+    latitude  = (now_us() - start) / runs;
+
+    // only longitude changes
+    start     = now_us();
+    for (int i = 0; i < runs; i++) {
+        WMM_GetMagVector(47.0f, 8.0f + 1e-4f * i, 400.0f, 6, 1, 2016, B);
+    }
+    longitude = (now_us() - start) / runs;
+
+    RecordProperty("reference_ns", (int)(reference * 1e3));
+    RecordProperty("full_ns", (int)(full * 1e3));
+    RecordProperty("latitude_ns", (int)(latitude * 1e3));
+    RecordProperty("longitude_ns", (int)(longitude * 1e3));
+    printf("WMM before caching %.2fus, full %.2fus, cached latitude change %.2fus, longitude change %.2fus\n",
+           reference, full, latitude, longitude);
+}
@@ -0,0 +1,29 @@
+/*
+ * The World Magnetic Model as it was before its evaluation was cached,
+ * reference/WorldMagModel.c, with its functions renamed so that both can be
+ * linked into the test. The only change to it is that the result is read
+ * before the elements are freed.
+ */
+
+#define WMM_Initialize                        WMM_Reference_Initialize
+#define WMM_GetMagVector                      WMM_Reference_GetMagVector
+#define WMM_AssociatedLegendreFunction        WMM_Reference_AssociatedLegendreFunction
+#define WMM_CalculateGeoMagneticElements      WMM_Reference_CalculateGeoMagneticElements
+#define WMM_CalculateSecularVariation         WMM_Reference_CalculateSecularVariation
+#define WMM_ComputeSphericalHarmonicVariables WMM_Reference_ComputeSphericalHarmonicVariables
+#define WMM_DateToYear                        WMM_Reference_DateToYear
+#define WMM_GeodeticToSpherical               WMM_Reference_GeodeticToSpherical
+#define WMM_Geomag                            WMM_Reference_Geomag
+#define WMM_PcupHigh                          WMM_Reference_PcupHigh
+#define WMM_PcupLow                           WMM_Reference_PcupLow
+#define WMM_RotateMagneticVector              WMM_Reference_RotateMagneticVector
+#define WMM_SecVarSummation                   WMM_Reference_SecVarSummation
+#define WMM_SecVarSummationSpecial            WMM_Reference_SecVarSummationSpecial
+#define WMM_Summation                         WMM_Reference_Summation
+#define WMM_SummationSpecial                  WMM_Reference_SummationSpecial
+#define WMM_get_main_field_coeff_g            WMM_Reference_get_main_field_coeff_g
+#define WMM_get_main_field_coeff_h            WMM_Reference_get_main_field_coeff_h
+#define WMM_get_secular_var_coeff_g           WMM_Reference_get_secular_var_coeff_g
+#define WMM_get_secular_var_coeff_h           WMM_Reference_get_secular_var_coeff_h
+
+#include "reference/WorldMagModel.c"
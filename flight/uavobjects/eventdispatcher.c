@@ -44,6 +44,7 @@
 #define CALLBACK_PRIORITY    CALLBACK_PRIORITY_CRITICAL
 #define TASK_PRIORITY        CALLBACK_TASK_FLIGHTCONTROL
 #define MAX_UPDATE_PERIOD_MS 1000
+#define PERIODIC_POOL_BLOCK  8
 
 // Private types
 
@@ -75,6 +76,8 @@ static xQueueHandle mQueue;
 static DelayedCallbackInfo *eventSchedulerCallback;
 static xSemaphoreHandle mMutex;
 static EventStats mStats;
+// walked on every periodic update, kept together in the fast heap
+static struct pios_mem_pool mObjPool = PIOS_MEM_POOL("periodic events", PeriodicObjectList, PERIODIC_POOL_BLOCK, true);
 
 // Private functions
 static int32_t processPeriodicUpdates();
@@ -228,8 +231,9 @@ static int32_t eventPeriodicCreate(UAVObjEvent *ev, UAVObjEventCallback cb, xQue
         }
     }
     // Create handle
-    objEntry = (PeriodicObjectList *)pios_malloc(sizeof(PeriodicObjectList));
+    objEntry = (PeriodicObjectList *)pios_mem_pool_alloc(&mObjPool);
     if (objEntry == NULL) {
+        xSemaphoreGiveRecursive(mMutex);
         return -1;
     }
     objEntry->evInfo.ev.obj      = ev->obj;
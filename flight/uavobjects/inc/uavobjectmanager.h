@@ -34,6 +34,8 @@
 
 #define UAVOBJ_ALL_INSTANCES                   0xFFFF
 #define UAVOBJ_MAX_INSTANCES                   1000
+#define UAVOBJ_MAX_SAVE_MULTIPLE               16
+#define UAVOBJ_LOAD_ALL_BUFFER                 256 // the data of a 256 byte logfs slot
 
 /*
  * Shifts and masks used to read/write metadata flags.
@@ -172,6 +174,12 @@ typedef void (*UAVObjEventCallback)(UAVObjEvent *ev);
  */
 typedef void (*UAVObjInitializeCallback)(UAVObjHandle obj_handle, uint16_t instId);
 
+/**
+ * Instance iterator, see UAVObjIterateInstances(). Gets the data of the instance in
+ * place, with the object manager locked, and returns false to stop the iteration.
+ */
+typedef bool (*UAVObjInstanceIterator)(UAVObjHandle obj_handle, uint16_t instId, const void *data, void *context);
+
 /**
  * Event manager statistics
  */
@@ -182,6 +190,22 @@ typedef struct {
     uint32_t lastQueueErrorID;
 } UAVObjStats;
 
+/**
+ * Direct access header, kept in front of the data of every single instance object.
+ * The generated accessors of single instance objects use it to read and write the
+ * data in place, without the object manager lock. It is a seqlock: a writer makes
+ * seq odd, copies and makes it even again, all in a critical section, a reader
+ * copies without any lock and starts over if seq was odd or changed meanwhile.
+ */
+typedef struct {
+    volatile uint32_t    seq;
+    volatile uint8_t     events; /** union of the event masks of the connected queues and callbacks */
+    const UAVObjMetadata *meta; /** the linked metadata, for the access check */
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+    uint16_t trace_index; /** index of the object in the event trace, see PIOS_EVENTTRACE_Object() */
+#endif
+} UAVObjDirect;
+
 int32_t UAVObjInitialize();
 void UAVObjGetStats(UAVObjStats *statsOut);
 void UAVObjClearStats();
@@ -199,8 +223,13 @@ bool UAVObjIsPriority(UAVObjHandle obj);
 int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId, const uint8_t *dataIn);
 int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut);
 uint8_t UAVObjUpdateCRC(UAVObjHandle obj_handle, uint16_t instId, uint8_t crc);
+uint32_t UAVObjUpdateCRC32(UAVObjHandle obj_handle, uint16_t instId, uint32_t crc);
 int32_t UAVObjSave(UAVObjHandle obj_handle, uint16_t instId);
+int32_t UAVObjSaveMultiple(const UAVObjHandle *obj_handles, const uint16_t *instIds, uint16_t count);
 int32_t UAVObjLoad(UAVObjHandle obj_handle, uint16_t instId);
+int32_t UAVObjLoadAll();
+void UAVObjBulkLoadBegin();
+int32_t UAVObjBulkLoadEnd();
 int32_t UAVObjDelete(UAVObjHandle obj_handle, uint16_t instId);
 int32_t UAVObjSaveSettings();
 int32_t UAVObjLoadSettings();
@@ -245,7 +274,93 @@ void UAVObjInstanceUpdated(UAVObjHandle obj_handle, uint16_t instId);
 void UAVObjLogging(UAVObjHandle obj);
 void UAVObjInstanceLogging(UAVObjHandle obj_handle, uint16_t instId);
 void UAVObjIterate(void (*iterator)(UAVObjHandle obj));
+uint16_t UAVObjIterateInstances(UAVObjHandle obj_handle, uint16_t count, UAVObjInstanceIterator iterator, void *context);
 void UAVObjInstanceWriteToLog(UAVObjHandle obj_handle, uint16_t instId);
+UAVObjDirect *UAVObjGetDirect(UAVObjHandle obj_handle);
+void UAVObjDirectUpdated(UAVObjDirect *direct);
+
+static inline void *UAVObjDirectData(UAVObjDirect *direct)
+{
+    return (void *)(direct + 1);
+}
+
+static inline uint32_t UAVObjDirectReadBegin(const UAVObjDirect *direct)
+{
+    uint32_t seq = direct->seq;
+
+    READ_MEMORY_BARRIER();
+    return seq;
+}
+
+static inline bool UAVObjDirectReadRetry(const UAVObjDirect *direct, uint32_t seq)
+{
+    READ_MEMORY_BARRIER();
+    return (seq & 1) || direct->seq != seq;
+}
+
+static inline void UAVObjDirectRead(UAVObjDirect *direct, void *dataOut, uint32_t offset, uint32_t size)
+{
+    uint32_t seq;
+
+    do {
+        seq = UAVObjDirectReadBegin(direct);
+        memcpy(dataOut, (uint8_t *)UAVObjDirectData(direct) + offset, size);
+    } while (UAVObjDirectReadRetry(direct, seq));
+}
+
+static inline void UAVObjDirectWrite(UAVObjDirect *direct, const void *dataIn, uint32_t offset, uint32_t size)
+{
+    portENTER_CRITICAL();
+    direct->seq++;
+    WRITE_MEMORY_BARRIER();
+    memcpy((uint8_t *)UAVObjDirectData(direct) + offset, dataIn, size);
+    WRITE_MEMORY_BARRIER();
+    direct->seq++;
+    portEXIT_CRITICAL();
+}
+
+/**
+ * The generated accessors of single instance objects are static inline, except
+ * on F1 targets, where flash is too short to expand them at every call site:
+ * there they are defined once in the object's code file.
+ */
+#if !defined(UAVOBJ_INLINE_ACCESSORS)
+#if defined(STM32F10X)
+#define UAVOBJ_INLINE_ACCESSORS 0
+#else
+#define UAVOBJ_INLINE_ACCESSORS 1
+#endif
+#endif
+
+/**
+ * Get and set for the generated accessors of single instance objects, same
+ * result as UAVObjGetInstanceDataField() and UAVObjSetInstanceDataField() on
+ * instance 0. The object manager is only called into if someone listens for
+ * EV_UPDATED.
+ */
+static inline int32_t UAVObjDirectGet(UAVObjDirect *direct, void *dataOut, uint32_t offset, uint32_t size)
+{
+    PIOS_Assert(direct);
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECTS, PIOS_EVENTTRACE_OBJECT_GET, 0, direct->trace_index);
+
+    UAVObjDirectRead(direct, dataOut, offset, size);
+    return 0;
+}
+
+static inline int32_t UAVObjDirectSet(UAVObjDirect *direct, const void *dataIn, uint32_t offset, uint32_t size)
+{
+    PIOS_Assert(direct);
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECTS, PIOS_EVENTTRACE_OBJECT_SET, 0, direct->trace_index);
+
+    if (((direct->meta->flags >> UAVOBJ_ACCESS_SHIFT) & 1) == ACCESS_READONLY) {
+        return -1;
+    }
+    UAVObjDirectWrite(direct, dataIn, offset, size);
+    if (direct->events & EV_UPDATED) {
+        UAVObjDirectUpdated(direct);
+    }
+    return 0;
+}
 
 #endif // UAVOBJECTMANAGER_H
 
@@ -78,14 +78,35 @@ struct ObjectEventEntry {
 
 /*
    MetaInstance   == [UAVOBase [UAVObjMetadata]]
-   SingleInstance == [UAVOBase [UAVOData [InstanceData]]]
-   MultiInstance  == [UAVOBase [UAVOData [NumInstances [InstanceData0 [next]]]]
-                                                  ____________________/
-   \-->[InstanceData1 [next]]
-                                                  _________...________/
-   \-->[InstanceDataN [next]]
+   SingleInstance == [UAVOBase [UAVOData [UAVObjDirect [InstanceData]]]]
+   MultiInstance  == [UAVOBase [UAVOData [NumInstances [Chunks [InstanceData0]]]]]
+                                                    |
+                                                    \-->[Next [InstanceData1 .. InstanceData8]]
+                                                           |
+                                                           \-->[Next [InstanceData9 .. InstanceData16]]
+                                                                  |
+                                                                  \-->...
  */
 
+/*
+ * Instances 1 and up of a multi instance object are kept in chunks of
+ * UAVOBJ_INSTANCE_CHUNK instances, chained in instance order. A chunk is only
+ * allocated when the previous one is full, so at most UAVOBJ_INSTANCE_CHUNK - 1
+ * instances are allocated ahead, and never moves, as the heap may not be able to
+ * free. A lookup walks one chunk per UAVOBJ_INSTANCE_CHUNK instances.
+ */
+#define UAVOBJ_INSTANCE_CHUNK 8
+
+/*
+ * Objects and instance chunks come from an arena taking UAVOBJ_ARENA_BLOCK bytes
+ * of the heap at a time, event entries from a pool of UAVOBJ_EVENT_POOL_BLOCK
+ * entries at a time in the fast heap, dispatching walks them on every event.
+ */
+#ifndef UAVOBJ_ARENA_BLOCK
+#define UAVOBJ_ARENA_BLOCK      1024
+#endif
+#define UAVOBJ_EVENT_POOL_BLOCK 16
+
 /*
  * UAVO Base Type
  *   - All Types of UAVObjects are of this base type
@@ -120,39 +141,48 @@ struct UAVOData {
      */
     struct UAVOMeta metaObj;
     uint16_t instance_size;
-} __attribute__((packed, aligned(4)));
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+    uint16_t trace_index;
+#endif
+} __attribute__((packed, aligned(sizeof(void *))));
 
-/* Augmented type for Single Instance Data UAVO */
+/*
+ * Augmented type for Single Instance Data UAVO. Not packed, so that direct is
+ * naturally aligned and the data follows it right away (UAVObjDirectData()).
+ * UAVOData is pointer aligned, the arena hands out 8 byte aligned blocks.
+ */
 struct UAVOSingle {
     struct UAVOData uavo;
+    UAVObjDirect    direct;
 
     uint8_t instance0[];
     /*
      * Additional space will be malloc'd here to hold the
      * the data for this instance.
      */
-} __attribute__((packed));
+};
 
-/* Part of a linked list of instances chained off of a multi instance UAVO. */
-struct UAVOMultiInst {
-    struct UAVOMultiInst *next;
-    uint8_t instance[];
+/* Chunk of instances 1 and up of a multi instance object */
+struct UAVOMultiChunk {
+    struct UAVOMultiChunk *next;
+    uint8_t instances[];
     /*
      * Additional space will be malloc'd here to hold the
-     * the data for this instance.
+     * the data for UAVOBJ_INSTANCE_CHUNK instances.
      */
-} __attribute__((packed));
+};
 
-/* Augmented type for Multi Instance Data UAVO */
+/* Augmented type for Multi Instance Data UAVO, not packed for the same reason as UAVOSingle */
 struct UAVOMulti {
     struct UAVOData uavo;
     uint16_t num_instances;
-    struct UAVOMultiInst instance0 __attribute__((aligned(4)));
+    struct UAVOMultiChunk *chunks;
+    uint8_t instance0[];
     /*
      * Additional space will be malloc'd here to hold the
      * the data for instance 0.
      */
-} __attribute__((packed));
+};
 
 /** all information about a metaobject are hardcoded constants **/
 #define MetaNumBytes sizeof(UAVObjMetadata)
@@ -163,7 +193,9 @@ struct UAVOMulti {
 
 /** all information about instances are dependant on object type **/
 #define ObjSingleInstanceDataOffset(obj) ((void *)(&(((struct UAVOSingle *)obj)->instance0)))
-#define InstanceDataOffset(inst)         ((void *)&(((struct UAVOMultiInst *)inst)->instance))
+#define ObjSingleDirect(obj)             (&(((struct UAVOSingle *)obj)->direct))
+#define DirectSingleObject(direct)       ((struct UAVOSingle *)((uint8_t *)(direct) - offsetof(struct UAVOSingle, direct)))
+#define ObjMultiInstanceStride(obj)      (((obj)->instance_size + 3) & ~3)
 #define InstanceData(instance)           ((void *)instance)
 
 // Private functions
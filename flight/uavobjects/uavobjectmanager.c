@@ -40,6 +40,9 @@ static InstanceHandle createInstance(struct UAVOData *obj, uint16_t instId);
 static int32_t connectObj(UAVObjHandle obj_handle, xQueueHandle queue, UAVObjEventCallback cb, uint8_t eventMask, bool fast);
 static int32_t disconnectObj(UAVObjHandle obj_handle, xQueueHandle queue, UAVObjEventCallback cb);
 static void instanceAutoUpdated(UAVObjHandle obj_handle, uint16_t instId);
+static void updateDirectEvents(struct UAVOBase *obj);
+static void readInstance(struct UAVOData *obj, InstanceHandle instEntry, void *dataOut, uint32_t offset, uint32_t size);
+static void writeInstance(struct UAVOData *obj, InstanceHandle instEntry, const void *dataIn, uint32_t offset, uint32_t size);
 
 
 int32_t UAVObjPers_stub(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused))  uint16_t instId)
@@ -49,10 +52,24 @@ int32_t UAVObjPers_stub(__attribute__((unused)) UAVObjHandle obj_handle, __attri
 int32_t UAVObjSave(UAVObjHandle obj_handle, uint16_t instId)  __attribute__((weak, alias("UAVObjPers_stub")));;
 int32_t UAVObjLoad(UAVObjHandle obj_handle, uint16_t instId) __attribute__((weak, alias("UAVObjPers_stub")));
 int32_t UAVObjDelete(UAVObjHandle obj_handle, uint16_t instId) __attribute__((weak, alias("UAVObjPers_stub")));
+int32_t UAVObjSaveMultiple_stub(__attribute__((unused)) const UAVObjHandle *obj_handles, __attribute__((unused)) const uint16_t *instIds, __attribute__((unused)) uint16_t count)
+{
+    // Nothing is saved, the staged objects must not be reported as saved
+    return -1;
+}
+int32_t UAVObjSaveMultiple(const UAVObjHandle *obj_handles, const uint16_t *instIds, uint16_t count) __attribute__((weak, alias("UAVObjSaveMultiple_stub")));
+int32_t UAVObjLoadAll_stub()
+{
+    return 0;
+}
+int32_t UAVObjLoadAll() __attribute__((weak, alias("UAVObjLoadAll_stub")));
 
 
 // Private variables
 static xSemaphoreHandle mutex;
+static bool bulkLoad; // objects are loaded by UAVObjBulkLoadEnd()
+static struct pios_mem_pool objArena  = PIOS_MEM_ARENA("uavobjects", UAVOBJ_ARENA_BLOCK, false);
+static struct pios_mem_pool eventPool = PIOS_MEM_POOL("uavobject events", struct ObjectEventEntry, UAVOBJ_EVENT_POOL_BLOCK, true);
 static const UAVObjMetadata defMetadata = {
     .flags                    = (ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
               ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
@@ -100,6 +117,19 @@ static inline bool IsPriority(UAVObjHandle obj_handle)
     return uavo_base->flags.isPriority;
 }
 
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+/* Index recorded by the event trace, a metaobject is told apart from its object by a flag */
+static inline uint16_t TraceIndex(UAVObjHandle obj_handle)
+{
+    if (IsMetaobject(obj_handle)) {
+        struct UAVOData *uavo_data = container_of((struct UAVOMeta *)obj_handle, struct UAVOData, metaObj);
+
+        return uavo_data->trace_index | PIOS_EVENTTRACE_METAOBJECT;
+    }
+    return ((struct UAVOData *)obj_handle)->trace_index;
+}
+#endif
+
 /**
  * Is this a metaobject?
  * \param[in] obj The object handle
@@ -224,8 +254,8 @@ static struct UAVOData *UAVObjAllocSingle(uint32_t num_bytes)
     /* Compute the complete size of the object, including the data for a single embedded instance */
     uint32_t object_size = sizeof(struct UAVOSingle) + num_bytes;
 
-    /* Allocate the object from the heap */
-    struct UAVOSingle *uavo_single = (struct UAVOSingle *)pios_malloc(object_size);
+    /* Allocate the object from the arena, it comes zeroed */
+    struct UAVOSingle *uavo_single = (struct UAVOSingle *)pios_mem_arena_alloc(&objArena, object_size);
 
     if (!uavo_single) {
         return NULL;
@@ -237,8 +267,11 @@ static struct UAVOData *UAVObjAllocSingle(uint32_t num_bytes)
     uavo_base->flags.isSingle = true;
     uavo_base->next_event     = NULL;
 
-    /* Clear the instance data carried in the UAVO */
-    memset(&(uavo_single->instance0), 0, num_bytes);
+    /* Set up the direct access header, the data follows it */
+    PIOS_STATIC_ASSERT(offsetof(struct UAVOSingle, instance0) == offsetof(struct UAVOSingle, direct) + sizeof(UAVObjDirect));
+    uavo_single->direct.seq    = 0;
+    uavo_single->direct.events = 0;
+    uavo_single->direct.meta   = LinkedMetaDataPtr(&uavo_single->uavo);
 
     /* Give back the generic UAVO part */
     return &(uavo_single->uavo);
@@ -249,8 +282,8 @@ static struct UAVOData *UAVObjAllocMulti(uint32_t num_bytes)
     /* Compute the complete size of the object, including the data for a single embedded instance */
     uint32_t object_size = sizeof(struct UAVOMulti) + num_bytes;
 
-    /* Allocate the object from the heap */
-    struct UAVOMulti *uavo_multi = (struct UAVOMulti *)pios_malloc(object_size);
+    /* Allocate the object from the arena, it comes zeroed */
+    struct UAVOMulti *uavo_multi = (struct UAVOMulti *)pios_mem_arena_alloc(&objArena, object_size);
 
     if (!uavo_multi) {
         return NULL;
@@ -262,11 +295,9 @@ static struct UAVOData *UAVObjAllocMulti(uint32_t num_bytes)
     uavo_base->flags.isSingle = false;
     uavo_base->next_event     = NULL;
 
-    /* Set up the type-specific part of the UAVO */
+    /* Set up the type-specific part of the UAVO, the other instances go to chunks as they are created */
     uavo_multi->num_instances = 1;
-
-    /* Clear the multi instance data carried in the UAVO */
-    memset(&(uavo_multi->instance0), 0, sizeof(struct UAVOMultiInst) + num_bytes);
+    uavo_multi->chunks = NULL;
 
     /* Give back the generic UAVO part */
     return &(uavo_multi->uavo);
@@ -314,6 +345,12 @@ UAVObjHandle UAVObjRegister(uint32_t id,
     /* Fill in the details about this UAVO */
     uavo_data->id = id;
     uavo_data->instance_size = num_bytes;
+#if defined(PIOS_INCLUDE_EVENTTRACE)
+    uavo_data->trace_index = PIOS_EVENTTRACE_Object(id);
+    if (isSingleInstance) {
+        ObjSingleDirect(uavo_data)->trace_index = uavo_data->trace_index;
+    }
+#endif
     if (isSettings) {
         uavo_data->base.flags.isSettings = true;
         // settings defaults to being sent with priority
@@ -329,12 +366,14 @@ UAVObjHandle UAVObjRegister(uint32_t id,
         initCb((UAVObjHandle)uavo_data, 0);
     }
 
-    /* Always try to load the meta object from flash */
-    UAVObjLoad((UAVObjHandle) & (uavo_data->metaObj), 0);
+    if (!bulkLoad) {
+        /* Always try to load the meta object from flash */
+        UAVObjLoad((UAVObjHandle) & (uavo_data->metaObj), 0);
 
-    /* Attempt to load settings object from flash */
-    if (uavo_data->base.flags.isSettings) {
-        UAVObjLoad((UAVObjHandle)uavo_data, 0);
+        /* Attempt to load settings object from flash */
+        if (uavo_data->base.flags.isSettings) {
+            UAVObjLoad((UAVObjHandle)uavo_data, 0);
+        }
     }
 
     // fire events for outer object and its embedded meta object
@@ -346,6 +385,32 @@ unlock_exit:
     return (UAVObjHandle)uavo_data;
 }
 
+/**
+ * Objects registered from now on are not loaded from flash one by one,
+ * UAVObjBulkLoadEnd() loads them all in one pass. Meant for boot, around
+ * the registration of all objects.
+ */
+void UAVObjBulkLoadBegin()
+{
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    bulkLoad = true;
+    xSemaphoreGiveRecursive(mutex);
+}
+
+/**
+ * Load the settings objects and metaobjects registered so far with UAVObjLoadAll(),
+ * objects registered from now on are loaded one by one again.
+ * \return 0 if success or -1 if failure
+ */
+int32_t UAVObjBulkLoadEnd()
+{
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    bulkLoad = false;
+    int32_t rc = UAVObjLoadAll();
+    xSemaphoreGiveRecursive(mutex);
+    return rc;
+}
+
 /**
  * Retrieve an object from the list given its id
  * \param[in] The object ID
@@ -353,7 +418,7 @@ unlock_exit:
  */
 UAVObjHandle UAVObjGetByID(uint32_t id)
 {
-    UAVObjHandle *found_obj = (UAVObjHandle *)NULL;
+    UAVObjHandle found_obj = NULL;
 
     // Get lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
@@ -361,11 +426,11 @@ UAVObjHandle UAVObjGetByID(uint32_t id)
     // Look for object
     UAVO_LIST_ITERATE(tmp_obj)
     if (tmp_obj->id == id) {
-        found_obj = (UAVObjHandle *)tmp_obj;
+        found_obj = (UAVObjHandle)tmp_obj;
         goto unlock_exit;
     }
     if (MetaObjectId(tmp_obj->id) == id) {
-        found_obj = (UAVObjHandle *)&(tmp_obj->metaObj);
+        found_obj = (UAVObjHandle)&(tmp_obj->metaObj);
         goto unlock_exit;
     }
 }
@@ -394,7 +459,7 @@ uint32_t UAVObjGetID(UAVObjHandle obj_handle)
         return MetaObjectId(uavo_data->id);
     } else {
         /* We have a data object, augment our pointer */
-        struct UAVOData *uavo_data = (struct UAVOData *)uavo_base;
+        struct UAVOData *uavo_data = (struct UAVOData *)obj_handle;
 
         return uavo_data->id;
     }
@@ -418,7 +483,7 @@ uint32_t UAVObjGetNumBytes(UAVObjHandle obj)
         instance_size = MetaNumBytes;
     } else {
         /* We have a data object, augment our pointer */
-        struct UAVOData *uavo = (struct UAVOData *)uavo_base;
+        struct UAVOData *uavo = (struct UAVOData *)obj;
 
         instance_size = uavo->instance_size;
     }
@@ -447,7 +512,7 @@ UAVObjHandle UAVObjGetLinkedObj(UAVObjHandle obj_handle)
         return (UAVObjHandle)uavo_data;
     } else {
         /* We have a data object, augment our pointer */
-        struct UAVOData *uavo_data = (struct UAVOData *)uavo_base;
+        struct UAVOData *uavo_data = (struct UAVOData *)obj_handle;
 
         return (UAVObjHandle) & (uavo_data->metaObj);
     }
@@ -550,7 +615,7 @@ int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId, const uint8_t *da
             }
         }
         // Set the data
-        memcpy(InstanceData(instEntry), dataIn, obj->instance_size);
+        writeInstance(obj, instEntry, dataIn, 0, obj->instance_size);
     }
 
     // Fire event
@@ -596,7 +661,7 @@ int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut)
             goto unlock_exit;
         }
         // Pack data
-        memcpy(dataOut, InstanceData(instEntry), obj->instance_size);
+        readInstance(obj, instEntry, dataOut, 0, obj->instance_size);
     }
 
     rc = 0;
@@ -637,8 +702,18 @@ uint8_t UAVObjUpdateCRC(UAVObjHandle obj_handle, uint16_t instId, uint8_t crc)
         if (instEntry == NULL) {
             goto unlock_exit;
         }
-        // Update crc
-        crc = PIOS_CRC_updateCRC(crc, (uint8_t *)InstanceData(instEntry), (int32_t)obj->instance_size);
+        // Update crc, again if a direct write got in between
+        if (IsSingleInstance(obj)) {
+            UAVObjDirect *direct = ObjSingleDirect(obj);
+            uint8_t start = crc;
+            uint32_t seq;
+            do {
+                seq = UAVObjDirectReadBegin(direct);
+                crc = PIOS_CRC_updateCRC(start, (uint8_t *)InstanceData(instEntry), (int32_t)obj->instance_size);
+            } while (UAVObjDirectReadRetry(direct, seq));
+        } else {
+            crc = PIOS_CRC_updateCRC(crc, (uint8_t *)InstanceData(instEntry), (int32_t)obj->instance_size);
+        }
     }
 
 unlock_exit:
@@ -647,11 +722,57 @@ unlock_exit:
 }
 
 /**
- * Actually write the object's data to the logfile
+ * Update a CRC32 with an object data, used where a collision must be unlikely
+ * (e.g. to tell if a cached copy of the object is still valid)
  * \param[in] obj The object handle
- * \param[in] instId The object instance ID
+ * \param[in] instId The instance ID
+ * \param[in] crc The crc to update
+ * \return the updated crc
  */
+uint32_t UAVObjUpdateCRC32(UAVObjHandle obj_handle, uint16_t instId, uint32_t crc)
+{
+    PIOS_Assert(obj_handle);
+
+    // Metaobjects are not supported
+    if (IsMetaobject(obj_handle)) {
+        return crc;
+    }
+
+    // Lock
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+
+    struct UAVOData *obj = (struct UAVOData *)obj_handle;
+    InstanceHandle instEntry = getInstance(obj, instId);
+
+    if (instEntry != NULL && IsSingleInstance(obj)) {
+        // again if a direct write got in between
+        UAVObjDirect *direct = ObjSingleDirect(obj);
+        uint32_t start = crc;
+        uint32_t seq;
+        do {
+            seq = UAVObjDirectReadBegin(direct);
+            crc = PIOS_CRC32_updateCRC(start, (uint8_t *)InstanceData(instEntry), (int32_t)obj->instance_size);
+        } while (UAVObjDirectReadRetry(direct, seq));
+    } else if (instEntry != NULL) {
+        crc = PIOS_CRC32_updateCRC(crc, (uint8_t *)InstanceData(instEntry), (int32_t)obj->instance_size);
+    }
+
+    xSemaphoreGiveRecursive(mutex);
+    return crc;
+}
+
 #ifdef PIOS_INCLUDE_DEBUGLOG
+static bool writeToLogIterator(UAVObjHandle obj_handle, uint16_t instId, const void *data, __attribute__((unused)) void *context)
+{
+    PIOS_DEBUGLOG_UAVObject(UAVObjGetID(obj_handle), instId, ((struct UAVOData *)obj_handle)->instance_size, (uint8_t *)data);
+    return true;
+}
+
+/**
+ * Actually write the object's data to the logfile
+ * \param[in] obj The object handle
+ * \param[in] instId The object instance ID or UAVOBJ_ALL_INSTANCES
+ */
 void UAVObjInstanceWriteToLog(UAVObjHandle obj_handle, uint16_t instId)
 {
     PIOS_Assert(obj_handle);
@@ -659,7 +780,13 @@ void UAVObjInstanceWriteToLog(UAVObjHandle obj_handle, uint16_t instId)
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
 
-    if (IsMetaobject(obj_handle)) {
+    if (instId == UAVOBJ_ALL_INSTANCES && IsSingleInstance(obj_handle)) {
+        instId = 0;
+    }
+
+    if (instId == UAVOBJ_ALL_INSTANCES) {
+        UAVObjIterateInstances(obj_handle, UAVOBJ_ALL_INSTANCES, &writeToLogIterator, NULL);
+    } else if (IsMetaobject(obj_handle)) {
         if (instId != 0) {
             goto unlock_exit;
         }
@@ -912,6 +1039,7 @@ int32_t UAVObjSetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
                               const void *dataIn)
 {
     PIOS_Assert(obj_handle);
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECTS, PIOS_EVENTTRACE_OBJECT_SET, instId, TraceIndex(obj_handle));
 
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
@@ -940,7 +1068,7 @@ int32_t UAVObjSetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
             goto unlock_exit;
         }
         // Set data
-        memcpy(InstanceData(instEntry), dataIn, obj->instance_size);
+        writeInstance(obj, instEntry, dataIn, 0, obj->instance_size);
     }
 
     // Fire event
@@ -962,6 +1090,7 @@ unlock_exit:
 int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn, uint32_t offset, uint32_t size)
 {
     PIOS_Assert(obj_handle);
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECTS, PIOS_EVENTTRACE_OBJECT_SET, instId, TraceIndex(obj_handle));
 
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
@@ -1005,7 +1134,7 @@ int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, con
         }
 
         // Set data
-        memcpy(InstanceData(instEntry) + offset, dataIn, size);
+        writeInstance(obj, instEntry, dataIn, offset, size);
     }
 
 
@@ -1029,6 +1158,7 @@ int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
                               void *dataOut)
 {
     PIOS_Assert(obj_handle);
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECTS, PIOS_EVENTTRACE_OBJECT_GET, instId, TraceIndex(obj_handle));
 
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
@@ -1055,7 +1185,7 @@ int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
             goto unlock_exit;
         }
         // Set data
-        memcpy(dataOut, InstanceData(instEntry), obj->instance_size);
+        readInstance(obj, instEntry, dataOut, 0, obj->instance_size);
     }
 
     rc = 0;
@@ -1075,6 +1205,7 @@ unlock_exit:
 int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, void *dataOut, uint32_t offset, uint32_t size)
 {
     PIOS_Assert(obj_handle);
+    PIOS_EVENTTRACE(PIOS_EVENTTRACE_OBJECTS, PIOS_EVENTTRACE_OBJECT_GET, instId, TraceIndex(obj_handle));
 
     // Lock
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
@@ -1113,7 +1244,7 @@ int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, voi
         }
 
         // Set data
-        memcpy(dataOut, InstanceData(instEntry) + offset, size);
+        readInstance(obj, instEntry, dataOut, offset, size);
     }
 
     rc = 0;
@@ -1123,6 +1254,33 @@ unlock_exit:
     return rc;
 }
 
+/**
+ * Get the direct access header of a single instance object, for its generated accessors
+ * \param[in] obj The object handle
+ * \return The header or NULL if the object is not a single instance data object
+ */
+UAVObjDirect *UAVObjGetDirect(UAVObjHandle obj_handle)
+{
+    PIOS_Assert(obj_handle);
+
+    if (IsMetaobject(obj_handle) || !IsSingleInstance(obj_handle)) {
+        return NULL;
+    }
+    return ObjSingleDirect(obj_handle);
+}
+
+/**
+ * Fire the EV_UPDATED event after a UAVObjDirectSet()
+ * \param[in] direct The direct access header of the object
+ */
+void UAVObjDirectUpdated(UAVObjDirect *direct)
+{
+    // Lock, the listeners may be connected or disconnected meanwhile
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    sendEvent(&(DirectSingleObject(direct)->uavo.base), 0, EV_UPDATED);
+    xSemaphoreGiveRecursive(mutex);
+}
+
 /**
  * Set the object metadata
  * \param[in] obj The object handle
@@ -1523,6 +1681,59 @@ void UAVObjIterate(void (*iterator)(UAVObjHandle obj))
 xSemaphoreGiveRecursive(mutex);
 }
 
+/**
+ * Iterate through the instances of a multi instance object, in order, without
+ * looking each one up. The iterator is called with the object manager locked,
+ * it must be quick and not block.
+ * \param[in] obj_handle The object handle
+ * \param[in] count Number of instances to visit from instance 0, or UAVOBJ_ALL_INSTANCES
+ * \param[in] iterator Called with the data of each instance in place, returns false to stop
+ * \param[in] context Passed to the iterator
+ * \return The number of instances visited, 0 for single instance objects and metaobjects
+ */
+uint16_t UAVObjIterateInstances(UAVObjHandle obj_handle, uint16_t count, UAVObjInstanceIterator iterator, void *context)
+{
+    PIOS_Assert(obj_handle && iterator);
+
+    // Single instance data is written without the lock, there is no stable place to hand out
+    if (IsSingleInstance(obj_handle)) {
+        return 0;
+    }
+
+    // Get lock
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+
+    struct UAVOMulti *uavo_multi = (struct UAVOMulti *)obj_handle;
+    uint32_t stride = ObjMultiInstanceStride(&uavo_multi->uavo);
+    const struct UAVOMultiChunk *chunk = uavo_multi->chunks;
+    const uint8_t *data = uavo_multi->instance0;
+    uint16_t slot    = 0;
+    uint16_t visited = 0;
+
+    if (count > uavo_multi->num_instances) {
+        count = uavo_multi->num_instances;
+    }
+    while (visited < count) {
+        visited++;
+        if (!iterator(obj_handle, visited - 1, data, context) || visited == count) {
+            break;
+        }
+        // step to the next instance, instance 0 is in the object, the others follow each other in the chunks
+        if (visited == 1) {
+            data = chunk->instances;
+        } else if (++slot < UAVOBJ_INSTANCE_CHUNK) {
+            data += stride;
+        } else {
+            chunk = chunk->next;
+            data  = chunk->instances;
+            slot  = 0;
+        }
+    }
+
+    xSemaphoreGiveRecursive(mutex);
+    return visited;
+}
+
 /**
  * Send a triggered event to all event queues registered on the object.
  */
@@ -1536,6 +1747,11 @@ int32_t sendEvent(struct UAVOBase *obj, uint16_t instId, UAVObjEventType trigger
         .lowPriority = false,
     };
 
+    // Single instance objects know if anyone listens for this event
+    if (!IsMetaobject(obj) && IsSingleInstance(obj) && !(ObjSingleDirect(obj)->events & triggered_event)) {
+        return 0;
+    }
+
     // Go through each object and push the event message in the queue (if event is activated for the queue)
     struct ObjectEventEntry *event;
 
@@ -1566,12 +1782,28 @@ int32_t sendEvent(struct UAVOBase *obj, uint16_t instId, UAVObjEventType trigger
     return 0;
 }
 
+/**
+ * Find the chunk link of instance 1 and up of a multi instance object and the slot in that chunk.
+ */
+static inline struct UAVOMultiChunk **instanceChunk(struct UAVOMulti *uavo_multi, uint16_t instId, uint16_t *slot)
+{
+    struct UAVOMultiChunk **link = &uavo_multi->chunks;
+
+    *slot = (instId - 1) % UAVOBJ_INSTANCE_CHUNK;
+    for (uint16_t n = (instId - 1) / UAVOBJ_INSTANCE_CHUNK; n > 0 && *link; --n) {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
 /**
  * Create a new object instance, return the instance info or NULL if failure.
  */
 static InstanceHandle createInstance(struct UAVOData *obj, uint16_t instId)
 {
-    struct UAVOMultiInst *instEntry;
+    struct UAVOMulti *uavo_multi = (struct UAVOMulti *)obj;
+    struct UAVOMultiChunk **chunk;
+    uint16_t slot;
 
     /* Don't allow more than one instance for single instance objects */
     if (IsSingleInstance(&(obj->base))) {
@@ -1596,22 +1828,23 @@ static InstanceHandle createInstance(struct UAVOData *obj, uint16_t instId)
         }
     }
 
-    /* Create the actual instance */
-    uint32_t size = sizeof(struct UAVOMultiInst) + obj->instance_size;
-    instEntry = (struct UAVOMultiInst *)pios_malloc(size);
-    if (!instEntry) {
-        return NULL;
+    /* Start a new chunk if the last one is full, chunks are zeroed when allocated */
+    chunk = instanceChunk(uavo_multi, instId, &slot);
+    if (!*chunk) {
+        uint32_t size = sizeof(struct UAVOMultiChunk) + UAVOBJ_INSTANCE_CHUNK * ObjMultiInstanceStride(obj);
+        *chunk = (struct UAVOMultiChunk *)pios_mem_arena_alloc(&objArena, size);
+        if (!*chunk) {
+            return NULL;
+        }
     }
-    memset(instEntry, 0, size);
-    LL_APPEND(((struct UAVOMulti *)obj)->instance0.next, instEntry);
 
-    ((struct UAVOMulti *)obj)->num_instances++;
+    uavo_multi->num_instances++;
 
     // Fire event
     instanceAutoUpdated((UAVObjHandle)obj, instId);
 
     // Done
-    return InstanceDataOffset(instEntry);
+    return &((*chunk)->instances[slot * ObjMultiInstanceStride(obj)]);
 }
 
 /**
@@ -1646,18 +1879,13 @@ InstanceHandle getInstance(struct UAVOData *obj, uint16_t instId)
         if (instId >= uavo_multi->num_instances) {
             return NULL;
         }
-
-        // Look for specified instance ID
-        uint16_t instance = 0;
-        struct UAVOMultiInst *instEntry;
-        LL_FOREACH(&(uavo_multi->instance0), instEntry) {
-            if (instance++ == instId) {
-                /* Found it */
-                return &(instEntry->instance);
-            }
+        if (instId == 0) {
+            return &(uavo_multi->instance0);
         }
-        /* Instance was not found */
-        return NULL;
+
+        uint16_t slot;
+        struct UAVOMultiChunk *chunk = *instanceChunk(uavo_multi, instId, &slot);
+        return &(chunk->instances[slot * ObjMultiInstanceStride(obj)]);
     }
 }
 
@@ -1682,12 +1910,13 @@ static int32_t connectObj(UAVObjHandle obj_handle, xQueueHandle queue,
             // Already connected, update event mask and return
             event->eventMask = eventMask;
             event->fast = fast;
+            updateDirectEvents(obj);
             return 0;
         }
     }
 
     // Add queue to list
-    event = (struct ObjectEventEntry *)pios_malloc(sizeof(struct ObjectEventEntry));
+    event = (struct ObjectEventEntry *)pios_mem_pool_alloc(&eventPool);
     if (event == NULL) {
         return -1;
     }
@@ -1696,6 +1925,7 @@ static int32_t connectObj(UAVObjHandle obj_handle, xQueueHandle queue,
     event->eventMask = eventMask;
     event->fast      = fast;
     LL_APPEND(obj->next_event, event);
+    updateDirectEvents(obj);
 
     // Done
     return 0;
@@ -1720,7 +1950,8 @@ static int32_t disconnectObj(UAVObjHandle obj_handle, xQueueHandle queue,
         if ((event->queue == queue
              && event->cb == cb)) {
             LL_DELETE(obj->next_event, event);
-            vPortFree(event);
+            pios_mem_pool_free(&eventPool, event);
+            updateDirectEvents(obj);
             return 0;
         }
     }
@@ -1728,3 +1959,44 @@ static int32_t disconnectObj(UAVObjHandle obj_handle, xQueueHandle queue,
     // If this point is reached the queue was not found
     return -1;
 }
+
+/**
+ * Keep the event union of a single instance object up to date, UAVObjDirectSet()
+ * and sendEvent() test it instead of going through the list.
+ * \param[in] obj The object
+ */
+static void updateDirectEvents(struct UAVOBase *obj)
+{
+    struct ObjectEventEntry *event;
+    uint8_t events = 0;
+
+    if (IsMetaobject(obj) || !IsSingleInstance(obj)) {
+        return;
+    }
+    LL_FOREACH(obj->next_event, event) {
+        events |= (event->eventMask == EV_MASK_ALL) ? 0xFF : event->eventMask;
+    }
+    ObjSingleDirect(obj)->events = events;
+}
+
+/**
+ * Copy data out of and into an instance, the data of single instance objects
+ * goes through their seqlock as the generated accessors do not take the mutex.
+ */
+static void readInstance(struct UAVOData *obj, InstanceHandle instEntry, void *dataOut, uint32_t offset, uint32_t size)
+{
+    if (IsSingleInstance(obj)) {
+        UAVObjDirectRead(ObjSingleDirect(obj), dataOut, offset, size);
+    } else {
+        memcpy(dataOut, InstanceData(instEntry) + offset, size);
+    }
+}
+
+static void writeInstance(struct UAVOData *obj, InstanceHandle instEntry, const void *dataIn, uint32_t offset, uint32_t size)
+{
+    if (IsSingleInstance(obj)) {
+        UAVObjDirectWrite(ObjSingleDirect(obj), dataIn, offset, size);
+    } else {
+        memcpy(InstanceData(instEntry) + offset, dataIn, size);
+    }
+}
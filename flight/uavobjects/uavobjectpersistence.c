@@ -27,6 +27,7 @@
 #include "openpilot.h"
 #include "pios_struct_helper.h"
 #include "inc/uavobjectprivate.h"
+#include "uavobjectsinit.h"
 
 extern uintptr_t pios_uavo_settings_fs_id;
 
@@ -70,6 +71,50 @@ int32_t UAVObjSave(UAVObjHandle obj_handle, uint16_t instId)
 }
 
 
+/**
+ * Save several object instances to the file system in one go, see
+ * PIOS_FLASHFS_ObjSaveMultiple().
+ * @param[in] obj_handles The object handles.
+ * @param[in] instIds The instance ID of each object
+ * @param[in] count Number of objects, at most UAVOBJ_MAX_SAVE_MULTIPLE
+ * @return 0 if success or -1 if failure
+ */
+int32_t UAVObjSaveMultiple(const UAVObjHandle *obj_handles, const uint16_t *instIds, uint16_t count)
+{
+    struct PIOS_FLASHFS_ObjEntry entries[UAVOBJ_MAX_SAVE_MULTIPLE];
+
+    if (count > UAVOBJ_MAX_SAVE_MULTIPLE) {
+        return -1;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        PIOS_Assert(obj_handles[i]);
+
+        entries[i].obj_id      = UAVObjGetID(obj_handles[i]);
+        entries[i].obj_inst_id = instIds[i];
+        entries[i].obj_size    = UAVObjGetNumBytes(obj_handles[i]);
+
+        if (UAVObjIsMetaobject(obj_handles[i])) {
+            if (instIds[i] != 0) {
+                return -1;
+            }
+            entries[i].obj_data = (uint8_t *)MetaDataPtr((struct UAVOMeta *)obj_handles[i]);
+        } else {
+            InstanceHandle instEntry = getInstance((struct UAVOData *)obj_handles[i], instIds[i]);
+
+            if (instEntry == NULL || InstanceData(instEntry) == NULL) {
+                return -1;
+            }
+            entries[i].obj_data = InstanceData(instEntry);
+        }
+    }
+
+    if (PIOS_FLASHFS_ObjSaveMultiple(pios_uavo_settings_fs_id, entries, count) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
 /**
  * Load an object from the file system (SD card).
  * A file with the name of the object will be opened.
@@ -94,20 +139,92 @@ int32_t UAVObjLoad(UAVObjHandle obj_handle, uint16_t instId)
             return -1;
         }
     } else {
-        InstanceHandle instEntry = getInstance((struct UAVOData *)obj_handle, instId);
+        // readers of single instance objects do not lock, the data is only
+        // written through the seqlock
+        uint8_t buffer[UAVOBJECTS_LARGEST];
 
-        if (instEntry == NULL) {
+        if (getInstance((struct UAVOData *)obj_handle, instId) == NULL) {
             return -1;
         }
 
-        // Fire event on success
-        if (PIOS_FLASHFS_ObjLoad(pios_uavo_settings_fs_id, UAVObjGetID(obj_handle), instId, InstanceData(instEntry), UAVObjGetNumBytes(obj_handle)) == 0) {
-            sendEvent((struct UAVOBase *)obj_handle, instId, EV_UNPACKED);
-        } else {
+        if (UAVObjGetNumBytes(obj_handle) > sizeof(buffer)) {
+            return -1;
+        }
+
+        if (PIOS_FLASHFS_ObjLoad(pios_uavo_settings_fs_id, UAVObjGetID(obj_handle), instId, buffer, UAVObjGetNumBytes(obj_handle)) != 0) {
+            return -1;
+        }
+
+        // Fires the event
+        return UAVObjUnpack(obj_handle, instId, buffer);
+    }
+
+
+    return 0;
+}
+
+/**
+ * Take one object instance of PIOS_FLASHFS_ObjLoadAll(), see UAVObjLoadAll().
+ */
+static int32_t loadAllInstance(const struct PIOS_FLASHFS_ObjEntry *entry, void *context)
+{
+    UAVObjHandle obj_handle = UAVObjGetByID(entry->obj_id);
+
+    // not registered, or saved by firmware with another version of the object
+    if (!obj_handle || UAVObjGetNumBytes(obj_handle) != entry->obj_size) {
+        return -1;
+    }
+
+    if (!entry->obj_data) {
+        // too large for the buffer, tells UAVObjLoadAll() to load one by one
+        *(bool *)context = true;
+        return -1;
+    }
+
+    if (UAVObjIsMetaobject(obj_handle)) {
+        if (entry->obj_inst_id != 0) {
+            return -1;
+        }
+    } else {
+        // as UAVObjRegister(), data of other objects stays where it is
+        if (!UAVObjIsSettings(obj_handle)) {
+            return -1;
+        }
+
+        // as UAVObjLoad(), instances are not created
+        if (getInstance((struct UAVOData *)obj_handle, entry->obj_inst_id) == NULL) {
             return -1;
         }
     }
 
+    // through the seqlock of single instance objects, fires EV_UNPACKED
+    return UAVObjUnpack(obj_handle, entry->obj_inst_id, entry->obj_data);
+}
+
+/**
+ * Load a metaobject or settings object on its own, UAVObjIterate() passes both.
+ */
+static void loadOneByOne(UAVObjHandle obj_handle)
+{
+    if (UAVObjIsMetaobject(obj_handle) || UAVObjIsSettings(obj_handle)) {
+        UAVObjLoad(obj_handle, 0);
+    }
+}
+
+/**
+ * Load every registered settings object and metaobject found in the file system
+ * in a single pass over it, the others keep their defaults. File systems that
+ * cannot do this load the objects one by one, as UAVObjRegister() does.
+ * @return 0 if success or -1 if failure
+ */
+int32_t UAVObjLoadAll()
+{
+    uint8_t buffer[UAVOBJ_LOAD_ALL_BUFFER];
+    bool incomplete = false;
+
+    if (PIOS_FLASHFS_ObjLoadAll(pios_uavo_settings_fs_id, buffer, sizeof(buffer), loadAllInstance, &incomplete) < 0 || incomplete) {
+        UAVObjIterate(loadOneByOne);
+    }
 
     return 0;
 }
@@ -16,6 +16,7 @@ SOURCES += opmaps.cpp \
     point.cpp \
     size.cpp \
     kibertilecache.cpp \
+    decodedtilecache.cpp \
     diagnostics.cpp
 HEADERS += opmaps.h \
     size.h \
@@ -36,6 +37,7 @@ HEADERS += opmaps.h \
     placemark.h \
     point.h \
     kibertilecache.h \
+    decodedtilecache.h \
     debugheader.h \
     diagnostics.h
 
@@ -0,0 +1,66 @@
+/**
+ ******************************************************************************
+ *
+ * @file       decodedtilecache.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Least recently used cache of decoded map tiles
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "decodedtilecache.h"
+#include "pureimage.h"
+
+namespace core {
+DecodedTileCache::DecodedTileCache()
+{
+    setCapacity(64);
+}
+
+QPixmap DecodedTileCache::GetTile(const RawTile &tile, const QByteArray &data)
+{
+    QPixmap *pic = tiles.object(tile);
+
+    if (pic) {
+        return *pic;
+    }
+    QPixmap decoded = PureImageProxy::FromStream(data);
+    if (!decoded.isNull()) {
+        int cost = qMax(1, decoded.width() * decoded.height() * decoded.depth() / (8 * 1024));
+        tiles.insert(tile, new QPixmap(decoded), cost);
+    }
+    return decoded;
+}
+void DecodedTileCache::Clear()
+{
+    tiles.clear();
+}
+void DecodedTileCache::setCapacity(const int &value)
+{
+    tiles.setMaxCost(value * 1024);
+}
+int DecodedTileCache::Capacity() const
+{
+    return tiles.maxCost() / 1024;
+}
+double DecodedTileCache::Size() const
+{
+    return tiles.totalCost() / 1024.0;
+}
+}
@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ *
+ * @file       decodedtilecache.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Least recently used cache of decoded map tiles
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef DECODEDTILECACHE_H
+#define DECODEDTILECACHE_H
+
+#include "rawtile.h"
+#include <QCache>
+#include <QPixmap>
+#include <QByteArray>
+
+namespace core {
+/**
+ * Decoded tiles by type, zoom and position, so painting the map does not
+ * decode the PNG/JPEG data of every visible tile again.
+ * The least recently painted tiles are dropped above the capacity.
+ * Pixmaps are only usable in the GUI thread, so is this cache.
+ */
+class DecodedTileCache {
+public:
+    DecodedTileCache();
+
+    QPixmap GetTile(const RawTile &tile, const QByteArray &data);
+    void Clear();
+    void setCapacity(const int &value);
+    int Capacity() const;
+    double Size() const;
+private:
+    QCache<RawTile, QPixmap> tiles; // cost in kB
+};
+}
+#endif // DECODEDTILECACHE_H
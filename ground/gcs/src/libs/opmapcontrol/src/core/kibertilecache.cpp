@@ -44,9 +44,9 @@ void KiberTileCache::setMemoryCacheCapacity(const int &value)
 int KiberTileCache::MemoryCacheCapacity()
 {
     kiberCacheLock.lockForRead();
-    return _MemoryCacheCapacity;
-
+    int capacity = _MemoryCacheCapacity;
     kiberCacheLock.unlock();
+    return capacity;
 }
 
 void KiberTileCache::RemoveMemoryOverload()
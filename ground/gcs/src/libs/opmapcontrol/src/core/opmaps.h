@@ -30,6 +30,7 @@
 
 #include "debugheader.h"
 #include "memorycache.h"
+#include "decodedtilecache.h"
 #include "rawtile.h"
 #include "cache.h"
 #include "accessmode.h"
@@ -83,6 +84,7 @@ public: ~OPMaps();
     }
     int RetryLoadTile;
     diagnostics GetDiagnostics();
+    DecodedTileCache DecodedTiles;
 
 private:
     bool useMemoryCache;
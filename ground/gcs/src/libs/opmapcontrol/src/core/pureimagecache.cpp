@@ -53,6 +53,7 @@ void PureImageCache::setGtileCache(const QString &value)
 #endif // DEBUG_PUREIMAGECACHE
             CreateEmptyDB(db);
         }
+        PrepareDB(db);
     }
     lock.unlock();
 }
@@ -61,6 +62,88 @@ QString PureImageCache::GtileCache()
     return gtilecache;
 }
 
+/**
+ * Switches the database to write ahead logging, so the tile loaders keep
+ * reading while the cache queue writes, and indexes the tile lookup.
+ * Both are stored in the database, existing caches are upgraded once.
+ */
+bool PureImageCache::PrepareDB(const QString &file)
+{
+    bool ret = false;
+
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", QLatin1String("PrepareConn"));
+        db.setDatabaseName(file);
+        if (db.open()) {
+            QSqlQuery query(db);
+            ret = query.exec("PRAGMA journal_mode=WAL");
+            ret = query.exec("CREATE INDEX IF NOT EXISTS IndexOfTiles ON Tiles (X, Y, Zoom, Type)") && ret;
+#ifdef DEBUG_PUREIMAGECACHE
+            if (!ret) {
+                qDebug() << "PrepareDB: " << query.lastError().driverText();
+            }
+#endif // DEBUG_PUREIMAGECACHE
+            db.close();
+        }
+    }
+    QSqlDatabase::removeDatabase(QLatin1String("PrepareConn"));
+    return ret;
+}
+
+PureImageCache::Connection::Connection(const QString &file, const QString &name) : file(file), name(name), open(false)
+{
+    db = QSqlDatabase::addDatabase("QSQLITE", name);
+    db.setDatabaseName(file);
+    // no shared cache: it locks whole tables, readers and the writer are
+    // kept apart by the write ahead log instead
+    db.setConnectOptions("QSQLITE_BUSY_TIMEOUT=5000");
+    if (db.open()) {
+        QSqlQuery(db).exec("PRAGMA synchronous=NORMAL");
+        getTile     = QSqlQuery(db);
+        putTile     = QSqlQuery(db);
+        putTileData = QSqlQuery(db);
+        open = getTile.prepare("SELECT Tile FROM TilesData WHERE id = (SELECT id FROM Tiles WHERE X=? AND Y=? AND Zoom=? AND Type=?)")
+               && putTile.prepare("INSERT INTO Tiles(X, Y, Zoom, Type, Date) VALUES(?, ?, ?, ?, ?)")
+               && putTileData.prepare("INSERT INTO TilesData(id, Tile) VALUES((SELECT last_insert_rowid()), ?)");
+#ifdef DEBUG_PUREIMAGECACHE
+        if (!open) {
+            qDebug() << "Connection: " << db.lastError().driverText();
+        }
+#endif // DEBUG_PUREIMAGECACHE
+    }
+}
+
+PureImageCache::Connection::~Connection()
+{
+    // the queries and handle must be gone before the connection is removed
+    getTile     = QSqlQuery();
+    putTile     = QSqlQuery();
+    putTileData = QSqlQuery();
+    db.close();
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(name);
+}
+
+/**
+ * Connection of the calling thread to the current cache, must be called
+ * with the lock held.
+ */
+PureImageCache::Connection *PureImageCache::GetConnection()
+{
+    Connection *cn = connections.localData();
+    QString db     = gtilecache + "Data.qmdb";
+
+    if (!cn || cn->file != db) {
+        Mcounter.lock();
+        qlonglong id = ++ConnCounter;
+        Mcounter.unlock();
+        // replaces, and deletes, the connection to a previous location
+        cn = new Connection(db, QString::number(id));
+        connections.setLocalData(cn);
+    }
+    return cn;
+}
+
 
 bool PureImageCache::CreateEmptyDB(const QString &file)
 {
@@ -159,86 +242,75 @@ bool PureImageCache::CreateEmptyDB(const QString &file)
     return true;
 }
 bool PureImageCache::PutImageToCache(const QByteArray &tile, const MapType::Types &type, const Point &pos, const int &zoom)
+{
+    CacheItemQueue item(type, pos, tile, zoom);
+    QList<CacheItemQueue *> tiles;
+
+    tiles.append(&item);
+    return PutImagesToCache(tiles);
+}
+bool PureImageCache::PutImagesToCache(QList<CacheItemQueue *> &tiles)
 {
     if (gtilecache.isEmpty() | gtilecache.isNull()) {
         return false;
     }
     lock.lockForRead();
 #ifdef DEBUG_PUREIMAGECACHE
-    qDebug() << "PutImageToCache Start:"; // <<pos;
+    qDebug() << "PutImagesToCache Start:" << tiles.count();
 #endif // DEBUG_PUREIMAGECACHE
-    Mcounter.lock();
-    qlonglong id = ++ConnCounter;
-    Mcounter.unlock();
-    {
-        QSqlDatabase cn;
-        cn = QSqlDatabase::addDatabase("QSQLITE", QString::number(id));
-        QString db = gtilecache + "Data.qmdb";
-        cn.setDatabaseName(db);
-        cn.setConnectOptions("QSQLITE_ENABLE_SHARED_CACHE");
-        if (cn.open()) {
-            {
-                QSqlQuery query(cn);
-                query.prepare("INSERT INTO Tiles(X, Y, Zoom, Type,Date) VALUES(?, ?, ?, ?,?)");
-                query.addBindValue(pos.X());
-                query.addBindValue(pos.Y());
-                query.addBindValue(zoom);
-
-                query.addBindValue((int)type);
-                query.addBindValue(QDateTime::currentDateTime().toString());
-                query.exec();
+    Connection *cn = GetConnection();
+    bool ret = cn->open;
+    if (ret) {
+        // one transaction, and one sync, for the whole batch
+        cn->db.transaction();
+        QString date = QDateTime::currentDateTime().toString();
+        foreach(CacheItemQueue * item, tiles) {
+            cn->putTile.bindValue(0, item->GetPosition().X());
+            cn->putTile.bindValue(1, item->GetPosition().Y());
+            cn->putTile.bindValue(2, item->GetZoom());
+            cn->putTile.bindValue(3, (int)item->GetMapType());
+            cn->putTile.bindValue(4, date);
+            if (cn->putTile.exec()) {
+                cn->putTileData.bindValue(0, item->GetImg());
+                ret = cn->putTileData.exec() && ret;
+            } else {
+                ret = false;
             }
-            {
-                QSqlQuery query(cn);
-                query.prepare("INSERT INTO TilesData(id, Tile) VALUES((SELECT last_insert_rowid()), ?)");
-                query.addBindValue(tile);
-                query.exec();
-            }
-            cn.close();
         }
+        ret = cn->db.commit() && ret;
+#ifdef DEBUG_PUREIMAGECACHE
+        if (!ret) {
+            qDebug() << "PutImagesToCache: " << cn->db.lastError().driverText();
+        }
+#endif // DEBUG_PUREIMAGECACHE
     }
-    QSqlDatabase::removeDatabase(QString::number(id));
     lock.unlock();
-    return true;
+    return ret;
 }
 QByteArray PureImageCache::GetImageFromCache(MapType::Types type, Point pos, int zoom)
 {
-    lock.lockForRead();
     QByteArray ar;
+
+    lock.lockForRead();
     if (gtilecache.isEmpty() | gtilecache.isNull()) {
+        lock.unlock();
         return ar;
     }
-    QString dir  = gtilecache;
-    Mcounter.lock();
-    qlonglong id = ++ConnCounter;
-    Mcounter.unlock();
 #ifdef DEBUG_PUREIMAGECACHE
-    qDebug() << "Cache dir=" << dir << " Try to GET:" << pos.X() + "," + pos.Y();
+    qDebug() << "Cache dir=" << gtilecache << " Try to GET:" << pos.X() + "," + pos.Y();
 #endif // DEBUG_PUREIMAGECACHE
-
-    {
-        QString db = dir + "Data.qmdb";
-        {
-            QSqlDatabase cn;
-
-            cn = QSqlDatabase::addDatabase("QSQLITE", QString::number(id));
-
-            cn.setDatabaseName(db);
-            cn.setConnectOptions("QSQLITE_ENABLE_SHARED_CACHE");
-            if (cn.open()) {
-                {
-                    QSqlQuery query(cn);
-                    query.exec(QString("SELECT Tile FROM TilesData WHERE id = (SELECT id FROM Tiles WHERE X=%1 AND Y=%2 AND Zoom=%3 AND Type=%4)").arg(pos.X()).arg(pos.Y()).arg(zoom).arg((int)type));
-                    query.next();
-                    if (query.isValid()) {
-                        ar = query.value(0).toByteArray();
-                    }
-                }
-                cn.close();
-            }
+    Connection *cn = GetConnection();
+    if (cn->open) {
+        cn->getTile.bindValue(0, pos.X());
+        cn->getTile.bindValue(1, pos.Y());
+        cn->getTile.bindValue(2, zoom);
+        cn->getTile.bindValue(3, (int)type);
+        if (cn->getTile.exec() && cn->getTile.next()) {
+            ar = cn->getTile.value(0).toByteArray();
         }
+        // ends the read transaction, it would hold back the log checkpoints
+        cn->getTile.finish();
     }
-    QSqlDatabase::removeDatabase(QString::number(id));
     lock.unlock();
     return ar;
 }
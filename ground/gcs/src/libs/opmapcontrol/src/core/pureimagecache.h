@@ -42,21 +42,45 @@
 #include <QList>
 #include <QMutex>
 #include <QReadWriteLock>
+#include <QThreadStorage>
+#include "cacheitemqueue.h"
 namespace core {
 class PureImageCache {
 public:
     PureImageCache();
     static bool CreateEmptyDB(const QString &file);
     bool PutImageToCache(const QByteArray &tile, const MapType::Types &type, const core::Point &pos, const int &zoom);
+    bool PutImagesToCache(QList<CacheItemQueue *> &tiles);
     QByteArray GetImageFromCache(MapType::Types type, core::Point pos, int zoom);
     QString GtileCache();
     void setGtileCache(const QString &value);
     static bool ExportMapDataToDB(QString sourceFile, QString destFile);
     void deleteOlderTiles(int const & days);
 private:
+    /**
+     * Database connection of one thread with its prepared statements,
+     * opened on first use and closed when the thread exits.
+     */
+    class Connection {
+    public:
+        Connection(const QString &file, const QString &name);
+        ~Connection();
+        QString file;
+        QString name;
+        QSqlDatabase db;
+        QSqlQuery getTile;
+        QSqlQuery putTile;
+        QSqlQuery putTileData;
+        bool open;
+    };
+
+    Connection *GetConnection();
+    static bool PrepareDB(const QString &file);
+
     QString gtilecache;
     QMutex Mcounter;
     QReadWriteLock lock;
+    QThreadStorage<Connection *> connections;
     static qlonglong ConnCounter;
 };
 }
@@ -49,6 +49,8 @@ public:
 protected:
     QQueue<CacheItemQueue *> tileCacheQueue;
 private:
+    // tiles written to the database in one transaction
+    static const int MAX_BATCH = 64;
     void run();
     QMutex mutex;
     QMutex waitmutex;
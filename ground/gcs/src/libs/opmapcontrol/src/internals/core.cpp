@@ -123,6 +123,7 @@ void Core::run()
                                     Moverlays.lock();
                                     {
                                         t->Overlays.append(img);
+                                        t->OverlayTypes.append(tl);
 #ifdef DEBUG_CORE
                                         qDebug() << "Core::run append img:" << img.length() << " to tile:" << t->GetPos().ToString() << " now has " << t->Overlays.count() << " overlays" << " ID=" << debug;
 #endif // DEBUG_CORE
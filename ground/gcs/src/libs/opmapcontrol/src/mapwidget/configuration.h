@@ -152,6 +152,27 @@ public:
         core::OPMaps::Instance()->TilesInMemory.setMemoryCacheCapacity(value);
     }
 
+    /**
+     * @brief  Returns the memory used by the decoded tiles ready to paint
+     *
+     * @return size in Mb
+     */
+    double DecodedTileMemoryUsed() const
+    {
+        return core::OPMaps::Instance()->DecodedTiles.Size();
+    }
+
+    /**
+     * @brief  Sets the size of the memory for the decoded tiles ready to paint
+     *
+     * @param  value size in Mb, the least recently painted tiles are dropped above it
+     * @return
+     */
+    void SetDecodedTileMemorySize(int const & value)
+    {
+        core::OPMaps::Instance()->DecodedTiles.setCapacity(value);
+    }
+
     /**
      * @brief Sets the location for the SQLite Database used for caching and the geocoding cache files
      *
@@ -72,3 +72,34 @@ quint8 Crc::updateCRC(quint8 crc, const quint8 *data, qint32 length)
     }
     return crc;
 }
+
+/*
+ * Width = 32, Poly = 0x04c11db7, XorIn = 0, ReflectIn = False, XorOut = 0,
+ * ReflectOut = False. The table is built on first use.
+ */
+namespace {
+struct Crc32Table {
+    quint32 entries[256];
+
+    Crc32Table()
+    {
+        for (quint32 i = 0; i < 256; i++) {
+            quint32 c = i << 24;
+            for (int bit = 0; bit < 8; bit++) {
+                c = (c & 0x80000000) ? (c << 1) ^ 0x04c11db7 : (c << 1);
+            }
+            entries[i] = c;
+        }
+    }
+};
+}
+
+quint32 Crc::updateCRC32(quint32 crc, const quint8 *data, qint32 length)
+{
+    static const Crc32Table table;
+
+    while (length--) {
+        crc = (crc << 8) ^ table.entries[(crc >> 24) ^ *data++];
+    }
+    return crc;
+}
@@ -4,6 +4,7 @@
 
 LogFile::LogFile(QObject *parent) :
     QIODevice(parent),
+    m_timer(this),
     m_lastTimeStamp(0),
     m_lastPlayed(0),
     m_timeOffset(0),
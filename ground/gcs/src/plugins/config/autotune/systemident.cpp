@@ -0,0 +1,501 @@
+/**
+ ******************************************************************************
+ *
+ * @file       systemident.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Host side port of the AutoTune system identification
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "systemident.h"
+
+#include <math.h>
+#include <string.h>
+
+#define NOISE_ALPHA 0.9997f // 10 second time constant at 300 Hz
+
+/**
+ * Prediction step for EKF on control inputs to quad that
+ * learns the system properties, AfPredict() of autotune.c
+ * @param X the current state estimate which is updated in place
+ * @param P the current covariance matrix, updated in place
+ * @param[in] the current control inputs (roll, pitch, yaw)
+ * @param[in] the gyro measurements
+ */
+static inline void afPredict(float X[SystemIdentFilter::NUMX], float P[SystemIdentFilter::NUMP], const float u_in[3], const float gyro[3], const float dT_s, const float t_in)
+{
+    const float Ts   = dT_s;
+    const float Tsq  = Ts * Ts;
+    const float Tsq3 = Tsq * Ts;
+    const float Tsq4 = Tsq * Tsq;
+
+    // for convenience and clarity code below uses the named versions of
+    // the state variables
+    float w1 = X[0]; // roll rate estimate
+    float w2 = X[1]; // pitch rate estimate
+    float w3 = X[2]; // yaw rate estimate
+    float u1 = X[3]; // scaled roll torque
+    float u2 = X[4]; // scaled pitch torque
+    float u3 = X[5]; // scaled yaw torque
+    const float e_b1   = expf(X[6]);   // roll torque scale
+    const float b1     = X[6];
+    const float e_b2   = expf(X[7]);   // pitch torque scale
+    const float b2     = X[7];
+    const float e_b3   = expf(X[8]);   // yaw torque scale
+    const float b3     = X[8];
+    const float e_tau  = expf(X[9]); // time response of the motors
+    const float tau    = X[9];
+    const float bias1  = X[10];       // bias in the roll torque
+    const float bias2  = X[11];       // bias in the pitch torque
+    const float bias3  = X[12];       // bias in the yaw torque
+
+    // inputs to the system (roll, pitch, yaw)
+    const float u1_in  = 4 * t_in * u_in[0];
+    const float u2_in  = 4 * t_in * u_in[1];
+    const float u3_in  = 4 * t_in * u_in[2];
+
+    // measurements from gyro
+    const float gyro_x = gyro[0];
+    const float gyro_y = gyro[1];
+    const float gyro_z = gyro[2];
+
+    // update named variables because we want to use predicted
+    // values below
+    w1 = X[0] = w1 - Ts * bias1 * e_b1 + Ts * u1 * e_b1;
+    w2 = X[1] = w2 - Ts * bias2 * e_b2 + Ts * u2 * e_b2;
+    w3 = X[2] = w3 - Ts * bias3 * e_b3 + Ts * u3 * e_b3;
+    u1 = X[3] = (Ts * u1_in) / (Ts + e_tau) + (u1 * e_tau) / (Ts + e_tau);
+    u2 = X[4] = (Ts * u2_in) / (Ts + e_tau) + (u2 * e_tau) / (Ts + e_tau);
+    u3 = X[5] = (Ts * u3_in) / (Ts + e_tau) + (u3 * e_tau) / (Ts + e_tau);
+    // X[6] to X[12] unchanged
+
+    /**** filter parameters ****/
+    const float q_w        = 1e-3f;
+    const float q_ud       = 1e-3f;
+    const float q_B        = 1e-6f;
+    const float q_tau      = 1e-6f;
+    const float q_bias     = 1e-19f;
+    const float s_a        = 150.0f; // expected gyro measurment noise
+
+    const float Q[SystemIdentFilter::NUMX] = { q_w, q_w, q_w, q_ud, q_ud, q_ud, q_B, q_B, q_B, q_tau, q_bias, q_bias, q_bias };
+
+    float D[SystemIdentFilter::NUMP];
+    for (uint32_t i = 0; i < SystemIdentFilter::NUMP; i++) {
+        D[i] = P[i];
+    }
+
+    const float e_tau2    = e_tau * e_tau;
+    const float e_tau3    = e_tau * e_tau2;
+    const float e_tau4    = e_tau2 * e_tau2;
+    const float Ts_e_tau2 = (Ts + e_tau) * (Ts + e_tau);
+    const float Ts_e_tau4 = Ts_e_tau2 * Ts_e_tau2;
+
+    // covariance propagation - D is stored copy of covariance
+    P[0] = D[0] + Q[0] + 2 * Ts * e_b1 * (D[3] - D[28] - D[9] * bias1 + D[9] * u1)
+           + Tsq * (e_b1 * e_b1) * (D[4] - 2 * D[29] + D[32] - 2 * D[10] * bias1 + 2 * D[30] * bias1 + 2 * D[10] * u1 - 2 * D[30] * u1
+                                    + D[11] * (bias1 * bias1) + D[11] * (u1 * u1) - 2 * D[11] * bias1 * u1);
+    P[1] = D[1] + Q[1] + 2 * Ts * e_b2 * (D[5] - D[33] - D[12] * bias2 + D[12] * u2)
+           + Tsq * (e_b2 * e_b2) * (D[6] - 2 * D[34] + D[37] - 2 * D[13] * bias2 + 2 * D[35] * bias2 + 2 * D[13] * u2 - 2 * D[35] * u2
+                                    + D[14] * (bias2 * bias2) + D[14] * (u2 * u2) - 2 * D[14] * bias2 * u2);
+    P[2] = D[2] + Q[2] + 2 * Ts * e_b3 * (D[7] - D[38] - D[15] * bias3 + D[15] * u3)
+           + Tsq * (e_b3 * e_b3) * (D[8] - 2 * D[39] + D[42] - 2 * D[16] * bias3 + 2 * D[40] * bias3 + 2 * D[16] * u3 - 2 * D[40] * u3
+                                    + D[17] * (bias3 * bias3) + D[17] * (u3 * u3) - 2 * D[17] * bias3 * u3);
+    P[3] = (D[3] * (e_tau2 + Ts * e_tau) + Ts * e_b1 * e_tau2 * (D[4] - D[29]) + Tsq * e_b1 * e_tau * (D[4] - D[29])
+            + D[18] * Ts * e_tau * (u1 - u1_in) + D[10] * e_b1 * (u1 * (Ts * e_tau2 + Tsq * e_tau) - bias1 * (Ts * e_tau2 + Tsq * e_tau))
+            + D[21] * Tsq * e_b1 * e_tau * (u1 - u1_in) + D[31] * Tsq * e_b1 * e_tau * (u1_in - u1)
+            + D[24] * Tsq * e_b1 * e_tau * (u1 * (u1 - bias1) + u1_in * (bias1 - u1))) / Ts_e_tau2;
+    P[4] = (Q[3] * Tsq4 + e_tau4 * (D[4] + Q[3]) + 2 * Ts * e_tau3 * (D[4] + 2 * Q[3]) + 4 * Q[3] * Tsq3 * e_tau
+            + Tsq * e_tau2 * (D[4] + 6 * Q[3] + u1 * (D[27] * u1 + 2 * D[21]) + u1_in * (D[27] * u1_in - 2 * D[21]))
+            + 2 * D[21] * Ts * e_tau3 * (u1 - u1_in) - 2 * D[27] * Tsq * u1 * u1_in * e_tau2) / Ts_e_tau4;
+    P[5] = (D[5] * (e_tau2 + Ts * e_tau) + Ts * e_b2 * e_tau2 * (D[6] - D[34])
+            + Tsq * e_b2 * e_tau * (D[6] - D[34]) + D[19] * Ts * e_tau * (u2 - u2_in)
+            + D[13] * e_b2 * (u2 * (Ts * e_tau2 + Tsq * e_tau) - bias2 * (Ts * e_tau2 + Tsq * e_tau))
+            + D[22] * Tsq * e_b2 * e_tau * (u2 - u2_in) + D[36] * Tsq * e_b2 * e_tau * (u2_in - u2)
+            + D[25] * Tsq * e_b2 * e_tau * (u2 * (u2 - bias2) + u2_in * (bias2 - u2))) / Ts_e_tau2;
+    P[6] = (Q[4] * Tsq4 + e_tau4 * (D[6] + Q[4]) + 2 * Ts * e_tau3 * (D[6] + 2 * Q[4]) + 4 * Q[4] * Tsq3 * e_tau
+            + Tsq * e_tau2 * (D[6] + 6 * Q[4] + u2 * (D[27] * u2 + 2 * D[22]) + u2_in * (D[27] * u2_in - 2 * D[22]))
+            + 2 * D[22] * Ts * e_tau3 * (u2 - u2_in) - 2 * D[27] * Tsq * u2 * u2_in * e_tau2) / Ts_e_tau4;
+    P[7] = (D[7] * (e_tau2 + Ts * e_tau) + Ts * e_b3 * e_tau2 * (D[8] - D[39])
+            + Tsq * e_b3 * e_tau * (D[8] - D[39]) + D[20] * Ts * e_tau * (u3 - u3_in)
+            + D[16] * e_b3 * (u3 * (Ts * e_tau2 + Tsq * e_tau) - bias3 * (Ts * e_tau2 + Tsq * e_tau))
+            + D[23] * Tsq * e_b3 * e_tau * (u3 - u3_in) + D[41] * Tsq * e_b3 * e_tau * (u3_in - u3)
+            + D[26] * Tsq * e_b3 * e_tau * (u3 * (u3 - bias3) + u3_in * (bias3 - u3))) / Ts_e_tau2;
+    P[8]  = (Q[5] * Tsq4 + e_tau4 * (D[8] + Q[5]) + 2 * Ts * e_tau3 * (D[8] + 2 * Q[5]) + 4 * Q[5] * Tsq3 * e_tau
+             + Tsq * e_tau2 * (D[8] + 6 * Q[5] + u3 * (D[27] * u3 + 2 * D[23]) + u3_in * (D[27] * u3_in - 2 * D[23]))
+             + 2 * D[23] * Ts * e_tau3 * (u3 - u3_in) - 2 * D[27] * Tsq * u3 * u3_in * e_tau2) / Ts_e_tau4;
+    P[9]  = D[9] - Ts * e_b1 * (D[30] - D[10] + D[11] * (bias1 - u1));
+    P[10] = (D[10] * (Ts + e_tau) + D[24] * Ts * (u1 - u1_in)) * (e_tau / Ts_e_tau2);
+    P[11] = D[11] + Q[6];
+    P[12] = D[12] - Ts * e_b2 * (D[35] - D[13] + D[14] * (bias2 - u2));
+    P[13] = (D[13] * (Ts + e_tau) + D[25] * Ts * (u2 - u2_in)) * (e_tau / Ts_e_tau2);
+    P[14] = D[14] + Q[7];
+    P[15] = D[15] - Ts * e_b3 * (D[40] - D[16] + D[17] * (bias3 - u3));
+    P[16] = (D[16] * (Ts + e_tau) + D[26] * Ts * (u3 - u3_in)) * (e_tau / Ts_e_tau2);
+    P[17] = D[17] + Q[8];
+    P[18] = D[18] - Ts * e_b1 * (D[31] - D[21] + D[24] * (bias1 - u1));
+    P[19] = D[19] - Ts * e_b2 * (D[36] - D[22] + D[25] * (bias2 - u2));
+    P[20] = D[20] - Ts * e_b3 * (D[41] - D[23] + D[26] * (bias3 - u3));
+    P[21] = (D[21] * (Ts + e_tau) + D[27] * Ts * (u1 - u1_in)) * (e_tau / Ts_e_tau2);
+    P[22] = (D[22] * (Ts + e_tau) + D[27] * Ts * (u2 - u2_in)) * (e_tau / Ts_e_tau2);
+    P[23] = (D[23] * (Ts + e_tau) + D[27] * Ts * (u3 - u3_in)) * (e_tau / Ts_e_tau2);
+    P[24] = D[24];
+    P[25] = D[25];
+    P[26] = D[26];
+    P[27] = D[27] + Q[9];
+    P[28] = D[28] - Ts * e_b1 * (D[32] - D[29] + D[30] * (bias1 - u1));
+    P[29] = (D[29] * (Ts + e_tau) + D[31] * Ts * (u1 - u1_in)) * (e_tau / Ts_e_tau2);
+    P[30] = D[30];
+    P[31] = D[31];
+    P[32] = D[32] + Q[10];
+    P[33] = D[33] - Ts * e_b2 * (D[37] - D[34] + D[35] * (bias2 - u2));
+    P[34] = (D[34] * (Ts + e_tau) + D[36] * Ts * (u2 - u2_in)) * (e_tau / Ts_e_tau2);
+    P[35] = D[35];
+    P[36] = D[36];
+    P[37] = D[37] + Q[11];
+    P[38] = D[38] - Ts * e_b3 * (D[42] - D[39] + D[40] * (bias3 - u3));
+    P[39] = (D[39] * (Ts + e_tau) + D[41] * Ts * (u3 - u3_in)) * (e_tau / Ts_e_tau2);
+    P[40] = D[40];
+    P[41] = D[41];
+    P[42] = D[42] + Q[12];
+
+    /********* this is the update part of the equation ***********/
+    float S[3] = { P[0] + s_a, P[1] + s_a, P[2] + s_a };
+    X[0]  = w1 + P[0] * ((gyro_x - w1) / S[0]);
+    X[1]  = w2 + P[1] * ((gyro_y - w2) / S[1]);
+    X[2]  = w3 + P[2] * ((gyro_z - w3) / S[2]);
+    X[3]  = u1 + P[3] * ((gyro_x - w1) / S[0]);
+    X[4]  = u2 + P[5] * ((gyro_y - w2) / S[1]);
+    X[5]  = u3 + P[7] * ((gyro_z - w3) / S[2]);
+    X[6]  = b1 + P[9] * ((gyro_x - w1) / S[0]);
+    X[7]  = b2 + P[12] * ((gyro_y - w2) / S[1]);
+    X[8]  = b3 + P[15] * ((gyro_z - w3) / S[2]);
+    X[9]  = tau + P[18] * ((gyro_x - w1) / S[0]) + P[19] * ((gyro_y - w2) / S[1]) + P[20] * ((gyro_z - w3) / S[2]);
+    X[10] = bias1 + P[28] * ((gyro_x - w1) / S[0]);
+    X[11] = bias2 + P[33] * ((gyro_y - w2) / S[1]);
+    X[12] = bias3 + P[38] * ((gyro_z - w3) / S[2]);
+
+    // update the duplicate cache
+    for (uint32_t i = 0; i < SystemIdentFilter::NUMP; i++) {
+        D[i] = P[i];
+    }
+
+    // This is an approximation that removes some cross axis uncertainty but
+    // substantially reduces the number of calculations
+    P[0]  = -D[0] * (D[0] / S[0] - 1);
+    P[1]  = -D[1] * (D[1] / S[1] - 1);
+    P[2]  = -D[2] * (D[2] / S[2] - 1);
+    P[3]  = -D[3] * (D[0] / S[0] - 1);
+    P[4]  = D[4] - D[3] * (D[3] / S[0]);
+    P[5]  = -D[5] * (D[1] / S[1] - 1);
+    P[6]  = D[6] - D[5] * (D[5] / S[1]);
+    P[7]  = -D[7] * (D[2] / S[2] - 1);
+    P[8]  = D[8] - D[7] * (D[7] / S[2]);
+    P[9]  = -D[9] * (D[0] / S[0] - 1);
+    P[10] = D[10] - D[3] * (D[9] / S[0]);
+    P[11] = D[11] - D[9] * (D[9] / S[0]);
+    P[12] = -D[12] * (D[1] / S[1] - 1);
+    P[13] = D[13] - D[5] * (D[12] / S[1]);
+    P[14] = D[14] - D[12] * (D[12] / S[1]);
+    P[15] = -D[15] * (D[2] / S[2] - 1);
+    P[16] = D[16] - D[7] * (D[15] / S[2]);
+    P[17] = D[17] - D[15] * (D[15] / S[2]);
+    P[18] = -D[18] * (D[0] / S[0] - 1);
+    P[19] = -D[19] * (D[1] / S[1] - 1);
+    P[20] = -D[20] * (D[2] / S[2] - 1);
+    P[21] = D[21] - D[3] * (D[18] / S[0]);
+    P[22] = D[22] - D[5] * (D[19] / S[1]);
+    P[23] = D[23] - D[7] * (D[20] / S[2]);
+    P[24] = D[24] - D[9] * (D[18] / S[0]);
+    P[25] = D[25] - D[12] * (D[19] / S[1]);
+    P[26] = D[26] - D[15] * (D[20] / S[2]);
+    P[27] = D[27] - D[18] * (D[18] / S[0]) - D[19] * (D[19] / S[1]) - D[20] * (D[20] / S[2]);
+    P[28] = -D[28] * (D[0] / S[0] - 1);
+    P[29] = D[29] - D[3] * (D[28] / S[0]);
+    P[30] = D[30] - D[9] * (D[28] / S[0]);
+    P[31] = D[31] - D[18] * (D[28] / S[0]);
+    P[32] = D[32] - D[28] * (D[28] / S[0]);
+    P[33] = -D[33] * (D[1] / S[1] - 1);
+    P[34] = D[34] - D[5] * (D[33] / S[1]);
+    P[35] = D[35] - D[12] * (D[33] / S[1]);
+    P[36] = D[36] - D[19] * (D[33] / S[1]);
+    P[37] = D[37] - D[33] * (D[33] / S[1]);
+    P[38] = -D[38] * (D[2] / S[2] - 1);
+    P[39] = D[39] - D[7] * (D[38] / S[2]);
+    P[40] = D[40] - D[15] * (D[38] / S[2]);
+    P[41] = D[41] - D[20] * (D[38] / S[2]);
+    P[42] = D[42] - D[38] * (D[38] / S[2]);
+
+    // apply limits to some of the state variables
+    if (X[9] > -1.5f) {
+        X[9] = -1.5f;
+    } else if (X[9] < -5.5f) { /* 4ms */
+        X[9] = -5.5f;
+    }
+    if (X[10] > 0.5f) {
+        X[10] = 0.5f;
+    } else if (X[10] < -0.5f) {
+        X[10] = -0.5f;
+    }
+    if (X[11] > 0.5f) {
+        X[11] = 0.5f;
+    } else if (X[11] < -0.5f) {
+        X[11] = -0.5f;
+    }
+    if (X[12] > 0.5f) {
+        X[12] = 0.5f;
+    } else if (X[12] < -0.5f) {
+        X[12] = -0.5f;
+    }
+}
+
+/**
+ * Initialize the state variable and covariance matrix, AfInit() of autotune.c
+ */
+SystemIdentFilter::SystemIdentFilter(float tau, const float beta[3]) :
+    m_throttle(0), m_time(0), m_samples(0)
+{
+    static const float qInit[NUMX] = {
+        1.0f,  1.0f,  1.0f,
+        1.0f,  1.0f,  1.0f,
+        0.05f, 0.05f, 0.005f,
+        0.05f,
+        0.05f, 0.05f, 0.05f
+    };
+
+    memset(X, 0, sizeof(X));
+    X[6]  = beta[0];
+    X[7]  = beta[1];
+    X[8]  = beta[2];
+    X[9]  = tau;
+
+    memset(P, 0, sizeof(P));
+    P[0]  = qInit[0];
+    P[1]  = qInit[1];
+    P[2]  = qInit[2];
+    P[4]  = qInit[3];
+    P[6]  = qInit[4];
+    P[8]  = qInit[5];
+    P[11] = qInit[6];
+    P[14] = qInit[7];
+    P[17] = qInit[8];
+    P[27] = qInit[9];
+    P[32] = qInit[10];
+    P[37] = qInit[11];
+    P[42] = qInit[12];
+
+    memset(m_noise, 0, sizeof(m_noise));
+}
+
+void SystemIdentFilter::predict(const SystemIdentSample &sample)
+{
+    afPredict(X, P, sample.u, sample.y, sample.dT, sample.throttle);
+    for (int j = 0; j < 3; j++) {
+        m_noise[j] = NOISE_ALPHA * m_noise[j] + (1 - NOISE_ALPHA) * (sample.y[j] - X[j]) * (sample.y[j] - X[j]);
+    }
+    m_throttle += sample.throttle;
+    m_time     += sample.dT;
+    m_samples++;
+}
+
+void SystemIdentFilter::predict(const SystemIdentSample *samples, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        predict(samples[i]);
+    }
+}
+
+SystemIdentModel SystemIdentFilter::model() const
+{
+    SystemIdentModel model;
+
+    model.tau = X[9];
+    for (int i = 0; i < 3; i++) {
+        model.beta[i]  = X[6 + i];
+        model.bias[i]  = X[10 + i];
+        model.noise[i] = m_noise[i];
+    }
+    model.hoverThrottle = m_samples ? m_throttle / m_samples : 0.0f;
+    model.period  = m_samples ? m_time / m_samples : 0.0f;
+    model.samples = m_samples;
+    return model;
+}
+
+/**
+ * Sanity checks of the identified model, CheckSettingsRaw() of autotune.c
+ * \returns a bit mask of Check
+ */
+uint8_t SystemIdentFilter::check(const SystemIdentModel &model, float gyroReadTimeAverage, float sensorPeriod)
+{
+    uint8_t retVal = 0;
+
+    if (!isfinite(expf(model.tau))) {
+        retVal |= TAU_NAN;
+    }
+    for (int i = 0; i < 3; i++) {
+        if (!isfinite(expf(model.beta[i]))) {
+            retVal |= BETA_NAN;
+        }
+    }
+    if (model.beta[0] < 6) {
+        retVal |= ROLL_BETA_LOW;
+    }
+    if (model.beta[1] < 6) {
+        retVal |= PITCH_BETA_LOW;
+    }
+    if (expf(model.tau) > 0.1f) {
+        retVal |= TAU_TOO_LONG;
+    } else if (expf(model.tau) < 0.008f) {
+        retVal |= TAU_TOO_SHORT;
+    }
+    if (gyroReadTimeAverage > sensorPeriod) {
+        retVal |= CPU_TOO_SLOW;
+    }
+    return retVal;
+}
+
+/**
+ * PIDs for a model at one damping and noise rate,
+ * ComputeStabilizationAndSetPidsFromDampAndNoise() of autotune.c
+ * @param dampRate damping in percent, SystemIdentSettings.DampRate
+ * @param noiseRate high frequency gain in 1/1000, SystemIdentSettings.NoiseRate
+ */
+SystemIdentPids SystemIdentFilter::computePids(const SystemIdentModel &model, const SystemIdentPidSettings &settings, float dampRate, float noiseRate)
+{
+    SystemIdentPids pids;
+
+    memset(&pids, 0, sizeof(pids));
+    pids.damp  = dampRate;
+    pids.noise = noiseRate;
+
+    const float ghf  = noiseRate / 1000.0f;
+    const float damp = dampRate / 100.0f;
+
+    float tau = expf(model.tau) + settings.gyroReadTimeAverage;
+    float exp_beta_roll_times_ghf  = expf(model.beta[0]) * ghf;
+    float exp_beta_pitch_times_ghf = expf(model.beta[1]) * ghf;
+
+    float wn    = 1.0f / tau;
+    float tau_d = 0.0f;
+    for (int i = 0; i < 30; i++) {
+        float tau_d_roll  = (2.0f * damp * tau * wn - 1.0f) / (4.0f * tau * damp * damp * wn * wn - 2.0f * damp * wn - tau * wn * wn + exp_beta_roll_times_ghf);
+        float tau_d_pitch = (2.0f * damp * tau * wn - 1.0f) / (4.0f * tau * damp * damp * wn * wn - 2.0f * damp * wn - tau * wn * wn + exp_beta_pitch_times_ghf);
+        // Select the slowest filter property
+        tau_d = (tau_d_roll > tau_d_pitch) ? tau_d_roll : tau_d_pitch;
+        wn    = (tau + tau_d) / (tau * tau_d) / (2.0f * damp + 2.0f);
+    }
+
+    // Set the real pole position, slow so the integral does not overshoot
+    const float a = ((tau + tau_d) / tau / tau_d - 2.0f * damp * wn) / 20.0f;
+    const float b = ((tau + tau_d) / tau / tau_d - 2.0f * damp * wn - a);
+
+    // Outer loop critically damped around the inner loop as a first order lpf,
+    // softly clamped against slew rate limiting
+    const float zeta_o = 1.3f;
+    float kp_o = 1.0f / 4.0f / (zeta_o * zeta_o) / (1.0f / wn);
+    const uint16_t minRate = settings.maximumRate[0] < settings.maximumRate[1] ? settings.maximumRate[0] : settings.maximumRate[1];
+    const float kp_o_clamp = settings.outerLoopKpSoftClamp * ((float)minRate / 350.0f);
+    if (kp_o > kp_o_clamp) {
+        kp_o = kp_o_clamp - sqrtf(kp_o_clamp) + sqrtf(kp_o);
+    }
+    kp_o *= 0.95f; // Pick up some margin.
+    pids.outerKp = kp_o;
+    pids.outerKi = 0.75f * kp_o / (2.0f * (float)M_PI * tau * 15.0f);
+
+    float kpMax     = 0.0f;
+    float betaMinLn = 1000.0f;
+    int slowest     = 0;
+
+    for (int i = 0; i < ((settings.calculateYaw != SystemIdentPidSettings::YawFalse) ? 3 : 2); i++) {
+        float betaLn = model.beta[i];
+        float beta   = expf(betaLn);
+        float ki;
+        float kp;
+        float kd;
+
+        if (i < 2) {
+            ki = a * b * wn * wn * tau * tau_d / beta;
+            kp = tau * tau_d * ((a + b) * wn * wn + 2.0f * a * b * damp * wn) / beta - ki * tau_d;
+            kd = (tau * tau_d * (a * b + wn * wn + (a + b) * 2.0f * damp * wn) - 1.0f) / beta - kp * tau_d;
+            if (betaMinLn > betaLn) {
+                betaMinLn = betaLn;
+                slowest   = i;
+            }
+        } else {
+            // yaw scales the (already reduced) PIDs of the slowest axis by
+            // (betaMin / betaYaw)^0.6, see autotune.c for the derivation
+            beta = expf(0.6f * (betaMinLn - model.beta[2]));
+            kp   = pids.kp[slowest] * beta;
+            ki   = 0.8f * pids.ki[slowest] * beta;
+            kd   = 0.8f * pids.kd[slowest] * beta;
+        }
+
+        if (i < 2) {
+            if (kpMax < kp) {
+                kpMax = kp;
+            }
+        } else {
+            // limit yaw with the ratio to the largest roll/pitch kp
+            float min = 0.0f;
+            float max = 0.0f;
+            switch (settings.calculateYaw) {
+            case SystemIdentPidSettings::YawTrueLimitToRatio:
+                max = kpMax * settings.yawToRollPitchPIDRatioMax;
+                min = kpMax * settings.yawToRollPitchPIDRatioMin;
+                break;
+            case SystemIdentPidSettings::YawTrueIgnoreLimit:
+            default:
+                max = 1000.0f;
+                min = 0.0f;
+                break;
+            }
+
+            float ratio = 1.0f;
+            if (min > 0.0f && kp < min) {
+                ratio = kp / min;
+            } else if (max > 0.0f && kp > max) {
+                ratio = kp / max;
+            }
+            kp /= ratio;
+            ki /= ratio;
+            kd /= ratio;
+        }
+
+        // reduce kd if so configured, kp and ki follow Ziegler-Nichols from PID toward PI
+        if (i < 2) {
+            const float KP_REDUCTION = .45f / .60f;
+            const float KI_REDUCTION = 1.2f / 2.0f;
+            kp  = kp * KP_REDUCTION + kp * settings.derivativeFactor * (1.0f - KP_REDUCTION);
+            ki  = ki * KI_REDUCTION + ki * settings.derivativeFactor * (1.0f - KI_REDUCTION);
+            kd *= settings.derivativeFactor;
+        }
+
+        pids.kp[i] = kp;
+        pids.ki[i] = ki;
+        pids.kd[i] = kd;
+    }
+
+    return pids;
+}
+
+/**
+ * @}
+ * @}
+ */
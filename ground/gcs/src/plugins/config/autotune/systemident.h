@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ *
+ * @file       systemident.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Host side port of the AutoTune system identification
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SYSTEMIDENT_H
+#define SYSTEMIDENT_H
+
+#include <stdint.h>
+
+/*
+ * This is the estimator of flight/modules/AutoTune/autotune.c, AfInit(),
+ * AfPredict() and ComputeStabilizationAndSetPidsFromDampAndNoise(), in the
+ * same single precision math so a log gives the PIDs the board would have
+ * computed from the same samples. Keep the two in sync, the autotune unit
+ * test of the flight tree compares them.
+ *
+ * Nothing in here depends on Qt, each filter only touches its own state so
+ * segments of a log can be identified in parallel threads.
+ */
+
+// one inner loop iteration, what the board captures in StabilizationInnerloopSample
+struct SystemIdentSample {
+    float y[3]; // filtered gyro, deg/s
+    float u[3]; // actuator desired roll, pitch, yaw
+    float throttle;
+    float dT; // seconds since the previous sample
+};
+
+// the identified model, same units as SystemIdentState
+struct SystemIdentModel {
+    float    tau; // ln(s)
+    float    beta[3]; // ln of the gain
+    float    bias[3];
+    float    noise[3]; // (deg/s)^2
+    float    hoverThrottle;
+    float    period; // mean seconds between samples
+    uint32_t samples;
+};
+
+// the parts of SystemIdentSettings and the PID bank the PID computation uses
+struct SystemIdentPidSettings {
+    enum CalculateYaw { YawFalse = 0, YawTrueLimitToRatio, YawTrueIgnoreLimit };
+
+    float    gyroReadTimeAverage;
+    float    outerLoopKpSoftClamp;
+    float    derivativeFactor;
+    float    yawToRollPitchPIDRatioMin;
+    float    yawToRollPitchPIDRatioMax;
+    uint16_t maximumRate[2]; // roll, pitch
+    int      calculateYaw;
+};
+
+struct SystemIdentPids {
+    float damp;
+    float noise;
+    float kp[3]; // rate loop roll, pitch, yaw
+    float ki[3];
+    float kd[3];
+    float outerKp; // attitude loop roll and pitch
+    float outerKi;
+};
+
+class SystemIdentFilter {
+public:
+    enum { NUMX = 13, NUMP = 43 };
+
+    // sanity check bits, same as autotune.c
+    enum Check {
+        TAU_NAN        = 1,
+        BETA_NAN       = 2,
+        ROLL_BETA_LOW  = 4,
+        PITCH_BETA_LOW = 8,
+        YAW_BETA_LOW   = 16,
+        TAU_TOO_LONG   = 32,
+        TAU_TOO_SHORT  = 64,
+        CPU_TOO_SLOW   = 128,
+    };
+
+    // tau and beta are the starting point, the SystemIdentState defaults
+    SystemIdentFilter(float tau, const float beta[3]);
+
+    void predict(const SystemIdentSample &sample);
+    void predict(const SystemIdentSample *samples, uint32_t count);
+
+    SystemIdentModel model() const;
+
+    static uint8_t check(const SystemIdentModel &model, float gyroReadTimeAverage, float sensorPeriod);
+    static SystemIdentPids computePids(const SystemIdentModel &model, const SystemIdentPidSettings &settings, float dampRate, float noiseRate);
+
+private:
+    float  X[NUMX];
+    float  P[NUMP];
+    float  m_noise[3];
+    double m_throttle;
+    double m_time;
+    uint32_t m_samples;
+};
+
+#endif // SYSTEMIDENT_H
@@ -0,0 +1,252 @@
+/**
+ ******************************************************************************
+ *
+ * @file       systemidentlog.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Inner loop samples of a flight log, for the offline AutoTune
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "systemidentlog.h"
+
+#include "gyrostate.h"
+#include "actuatordesired.h"
+#include <utils/crc.h>
+
+#include <QFile>
+#include <QtEndian>
+#include <qmath.h>
+
+#include <string.h>
+
+// log record: timestamp (4), size (8), then size bytes of UAVTalk packets
+#define RECORD_HEADER_LENGTH     12
+#define RECORD_MAX_LENGTH        (1024 * 1024)
+
+// header: sync (1), type (1), size (2), object id (4), instance id (2)
+#define UAVTALK_SYNC_VAL         0x3C
+#define UAVTALK_TYPE_MASK        0x78
+#define UAVTALK_TYPE_VER         0x20
+#define UAVTALK_TYPE_OBJ         0x20
+#define UAVTALK_TYPE_OBJ_ACK     0x22
+#define UAVTALK_TIMESTAMPED      0x80
+#define UAVTALK_HEADER_LENGTH    10
+#define UAVTALK_TIMESTAMP_LENGTH 2
+#define UAVTALK_CHECKSUM_LENGTH  1
+
+#define SEGMENT_MAX_GAP_MS       100 // longer without gyro ends a segment
+#define SEGMENT_MIN_LENGTH_MS    5000 // the filter takes a few seconds to settle
+#define MIN_TICK_FREQUENCY       1e6 // below this SensorReadTimestamp is not a CPU tick count
+#define INNERLOOP_FAKE_DT        0.0025f // gyro_alpha of stabilization.c
+
+SystemIdentLog::SystemIdentLog() :
+    m_gyroUpdates(0), m_actuatorUpdates(0), m_sensorPeriod(0), m_tickFrequency(0)
+{}
+
+bool SystemIdentLog::load(const QString &fileName, float gyroTau, float minThrottle, QString *error)
+{
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        *error = QString("Cannot open %1").arg(fileName);
+        return false;
+    }
+    m_raw.clear();
+    m_segments.clear();
+    m_tickFrequency = 0;
+    if (!parse(file.readAll(), error)) {
+        return false;
+    }
+
+    int first = -1;
+    for (int i = 0; i <= m_raw.size(); i++) {
+        bool flying = i < m_raw.size() && m_raw.at(i).throttle >= minThrottle;
+        bool gap    = first >= 0 && i < m_raw.size() && m_raw.at(i).ms - m_raw.at(i - 1).ms > SEGMENT_MAX_GAP_MS;
+        if (first >= 0 && (!flying || gap)) {
+            addSegment(first, i - 1, gyroTau);
+            first = -1;
+        }
+        if (first < 0 && flying) {
+            first = i;
+        }
+    }
+    m_raw.clear();
+
+    double samples = 0;
+    double length  = 0;
+    foreach(const SystemIdentSegment &segment, m_segments) {
+        samples += segment.samples.size();
+        length  += segment.length;
+    }
+    m_sensorPeriod = samples > 0 ? length / samples : 0;
+
+    if (m_segments.isEmpty()) {
+        *error = QString("No stretch of at least %1 s flown with GyroState and ActuatorDesired logged at the sensor rate, "
+                         "%2 GyroState and %3 ActuatorDesired updates in the log")
+                 .arg(SEGMENT_MIN_LENGTH_MS / 1000).arg(m_gyroUpdates).arg(m_actuatorUpdates);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Collect the gyro updates, each with the last actuator command before it.
+ */
+bool SystemIdentLog::parse(const QByteArray &log, QString *error)
+{
+    const quint8 *data = (const quint8 *)log.constData();
+    qint64 size = log.size();
+    qint64 pos  = 0;
+    GyroState gyroState;
+    ActuatorDesired actuatorDesired;
+    RawSample current;
+    bool haveActuator = false;
+
+    memset(&current, 0, sizeof(current));
+    m_gyroUpdates     = 0;
+    m_actuatorUpdates = 0;
+
+    while (size - pos >= RECORD_HEADER_LENGTH) {
+        quint32 ms     = qFromLittleEndian<quint32>(&data[pos]);
+        qint64 length  = qFromLittleEndian<qint64>(&data[pos + 4]);
+        if (length < UAVTALK_HEADER_LENGTH + UAVTALK_CHECKSUM_LENGTH || length > RECORD_MAX_LENGTH
+            || length > size - pos - RECORD_HEADER_LENGTH) {
+            // not a record, resynchronize byte by byte
+            pos++;
+            continue;
+        }
+        const quint8 *packet = &data[pos + RECORD_HEADER_LENGTH];
+        const quint8 *end    = packet + length;
+        pos += RECORD_HEADER_LENGTH + length;
+
+        while (end - packet >= UAVTALK_HEADER_LENGTH + UAVTALK_CHECKSUM_LENGTH) {
+            if (packet[0] != UAVTALK_SYNC_VAL || (packet[1] & UAVTALK_TYPE_MASK) != UAVTALK_TYPE_VER) {
+                break;
+            }
+            int headerLength = UAVTALK_HEADER_LENGTH + ((packet[1] & UAVTALK_TIMESTAMPED) ? UAVTALK_TIMESTAMP_LENGTH : 0);
+            int packetLength = qFromLittleEndian<quint16>(&packet[2]);
+            if (packetLength < headerLength || packetLength + UAVTALK_CHECKSUM_LENGTH > end - packet
+                || Utils::Crc::updateCRC(0, packet, packetLength) != packet[packetLength]) {
+                break;
+            }
+            quint8 type  = packet[1] & ~UAVTALK_TIMESTAMPED;
+            quint32 objId = qFromLittleEndian<quint32>(&packet[4]);
+            quint32 dataLength = packetLength - headerLength;
+            if (type == UAVTALK_TYPE_OBJ || type == UAVTALK_TYPE_OBJ_ACK) {
+                if (objId == GyroState::OBJID && dataLength == GyroState::NUMBYTES) {
+                    gyroState.unpack(&packet[headerLength]);
+                    GyroState::DataFields gyro = gyroState.getData();
+                    m_gyroUpdates++;
+                    if (haveActuator) {
+                        current.ms      = ms;
+                        current.ticks   = gyro.SensorReadTimestamp;
+                        current.gyro[0] = gyro.x;
+                        current.gyro[1] = gyro.y;
+                        current.gyro[2] = gyro.z;
+                        m_raw.append(current);
+                    }
+                } else if (objId == ActuatorDesired::OBJID && dataLength == ActuatorDesired::NUMBYTES) {
+                    actuatorDesired.unpack(&packet[headerLength]);
+                    ActuatorDesired::DataFields actuator = actuatorDesired.getData();
+                    m_actuatorUpdates++;
+                    current.u[0]     = actuator.Roll;
+                    current.u[1]     = actuator.Pitch;
+                    current.u[2]     = actuator.Yaw;
+                    current.throttle = actuator.Thrust;
+                    haveActuator     = true;
+                }
+            }
+            packet += packetLength + UAVTALK_CHECKSUM_LENGTH;
+        }
+    }
+
+    if (m_gyroUpdates == 0 || m_actuatorUpdates == 0) {
+        *error = QString("The log needs GyroState and ActuatorDesired, it has %1 and %2 updates of them")
+                 .arg(m_gyroUpdates).arg(m_actuatorUpdates);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Turn the raw samples [first, last] into a segment if it is long enough.
+ */
+void SystemIdentLog::addSegment(int first, int last, float gyroTau)
+{
+    const RawSample *raw = &m_raw.at(first);
+    int count = last - first + 1;
+    quint32 spanMs = raw[count - 1].ms - raw[0].ms;
+
+    if (spanMs < SEGMENT_MIN_LENGTH_MS) {
+        return;
+    }
+
+    // unwrap the tick counter, consecutive samples are far closer than a wrap
+    QVector<double> ticks(count);
+    ticks[0] = 0;
+    for (int i = 1; i < count; i++) {
+        ticks[i] = ticks[i - 1] + (quint32)(raw[i].ticks - raw[i - 1].ticks);
+    }
+    double frequency = ticks[count - 1] * 1000.0 / spanMs;
+    bool useTicks    = frequency >= MIN_TICK_FREQUENCY;
+    float period     = spanMs / 1000.0f / (count - 1);
+    float alpha      = (gyroTau < 0.0001f) ? 0 : qExp(-INNERLOOP_FAKE_DT / gyroTau);
+
+    if (useTicks) {
+        // segments weigh in by their samples
+        double samples = 0;
+        foreach(const SystemIdentSegment &segment, m_segments) {
+            samples += segment.samples.size();
+        }
+        m_tickFrequency = (m_tickFrequency * samples + frequency * count) / (samples + count);
+    }
+
+    SystemIdentSegment segment;
+    segment.start  = (raw[0].ms - m_raw.at(0).ms) / 1000.0;
+    segment.length = spanMs / 1000.0;
+    segment.samples.resize(count);
+
+    float y[3] = { raw[0].gyro[0], raw[0].gyro[1], raw[0].gyro[2] };
+    for (int i = 0; i < count; i++) {
+        SystemIdentSample &sample = segment.samples[i];
+        float dT = period;
+        if (i > 0 && useTicks) {
+            dT = (ticks[i] - ticks[i - 1]) / frequency;
+        }
+        // as AfPredictBlock(), drops count as at most 5 periods
+        if (dT <= 0 || dT > 5.0f * period) {
+            dT = (dT <= 0) ? period : 5.0f * period;
+        }
+        for (int j = 0; j < 3; j++) {
+            y[j] = y[j] * alpha + raw[i].gyro[j] * (1 - alpha);
+            sample.y[j] = y[j];
+            sample.u[j] = raw[i].u[j];
+        }
+        sample.throttle = raw[i].throttle;
+        sample.dT = dT;
+    }
+    m_segments.append(segment);
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,104 @@
+/**
+ ******************************************************************************
+ *
+ * @file       systemidentlog.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Inner loop samples of a flight log, for the offline AutoTune
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SYSTEMIDENTLOG_H
+#define SYSTEMIDENTLOG_H
+
+#include "systemident.h"
+
+#include <QString>
+#include <QVector>
+
+// a stretch of the log flown with the motors running and no gap in the gyro
+struct SystemIdentSegment {
+    double start; // seconds from the first record of the log
+    double length;
+    QVector<SystemIdentSample> samples;
+};
+
+/*
+ * Rebuilds what the inner loop captures for AutoTune from the GyroState and
+ * ActuatorDesired updates of a .opl log: each gyro update is paired with the
+ * last actuator command before it and goes through the same low pass as
+ * gyro_filtered in innerloop.c.
+ *
+ * GyroState has to be logged at the sensor rate, an on board flight log
+ * downloaded with the flight log plugin is, telemetry logs usually are not.
+ * Sample times come from SensorReadTimestamp, in CPU ticks, with the tick
+ * rate measured against the record timestamps of the log.
+ */
+class SystemIdentLog {
+public:
+    SystemIdentLog();
+
+    // gyroTau as StabilizationSettings.GyroTau, a segment needs at least minThrottle
+    bool load(const QString &fileName, float gyroTau, float minThrottle, QString *error);
+
+    const QVector<SystemIdentSegment> &segments() const
+    {
+        return m_segments;
+    }
+    quint32 gyroUpdates() const
+    {
+        return m_gyroUpdates;
+    }
+    quint32 actuatorUpdates() const
+    {
+        return m_actuatorUpdates;
+    }
+    // mean of the segments, seconds
+    float sensorPeriod() const
+    {
+        return m_sensorPeriod;
+    }
+    // Hz, 0 if the log has no usable SensorReadTimestamp
+    double tickFrequency() const
+    {
+        return m_tickFrequency;
+    }
+
+private:
+    struct RawSample {
+        quint32 ms;
+        quint32 ticks;
+        float   gyro[3];
+        float   u[3];
+        float   throttle;
+    };
+
+    bool parse(const QByteArray &log, QString *error);
+    void addSegment(int first, int last, float gyroTau);
+
+    QVector<RawSample> m_raw;
+    QVector<SystemIdentSegment> m_segments;
+    quint32 m_gyroUpdates;
+    quint32 m_actuatorUpdates;
+    float   m_sensorPeriod;
+    double  m_tickFrequency;
+};
+
+#endif // SYSTEMIDENTLOG_H
@@ -2,7 +2,7 @@ TEMPLATE = lib
 TARGET = Config
 DEFINES += CONFIG_LIBRARY
 
-QT += widgets svg opengl qml quick
+QT += widgets svg opengl qml quick concurrent
 
 # silence eigen warnings
 QMAKE_CXXFLAGS_WARN_ON += -Wno-deprecated-declarations
@@ -61,7 +61,10 @@ HEADERS += \
     configoplinkwidget.h \
     configrevonanohwwidget.h \
     configsparky2hwwidget.h \
-    failsafechannelform.h
+    failsafechannelform.h \
+    configautotunewidget.h \
+    autotune/systemident.h \
+    autotune/systemidentlog.h
 
 SOURCES += \
     configplugin.cpp \
@@ -103,7 +106,10 @@ SOURCES += \
     configoplinkwidget.cpp \
     configrevonanohwwidget.cpp \
     configsparky2hwwidget.cpp \
-    failsafechannelform.cpp
+    failsafechannelform.cpp \
+    configautotunewidget.cpp \
+    autotune/systemident.cpp \
+    autotune/systemidentlog.cpp
 
 FORMS += \
     airframe.ui \
@@ -1,173 +1,487 @@
+/**
+ ******************************************************************************
+ *
+ * @file       configautotunewidget.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ *             The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Runs the AutoTune system identification over a flight log
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
 #include "configautotunewidget.h"
 
-#include "ui_autotune.h"
-
-#include "relaytuningsettings.h"
-#include "relaytuning.h"
 #include "stabilizationsettings.h"
-#include "hwsettings.h"
-
-#include <QDebug>
-#include <QStringList>
-#include <QWidget>
-#include <QTextEdit>
-#include <QVBoxLayout>
+#include "systemidentsettings.h"
+#include "systemidentstate.h"
+#include <uavobjectutilmanager.h>
+#include <extensionsystem/pluginmanager.h>
+
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QProgressBar>
 #include <QPushButton>
-#include <QDesktopServices>
-#include <QUrl>
-#include <QList>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+#include <qmath.h>
+
+#include <string.h>
+
+// below this ActuatorDesired.Thrust the motors idle and the log is not used
+#define MIN_THROTTLE 0.1f
+// damping and noise values swept, from min through the default rate to max
+#define SWEEP_STEPS  5
+
+/*
+ * Runs in the thread pool, one filter per segment. The three axes share
+ * tau in the filter so they are identified together, segments are what
+ * runs in parallel.
+ */
+struct IdentifySegment {
+    typedef SystemIdentModel result_type;
+
+    float tau;
+    float beta[3];
+
+    SystemIdentModel operator()(const SystemIdentSegment &segment) const
+    {
+        SystemIdentFilter filter(tau, beta);
+
+        filter.predict(segment.samples.constData(), segment.samples.size());
+        return filter.model();
+    }
+};
+
+static QVector<float> sweepSteps(float min, float center, float max)
+{
+    QVector<float> steps;
+    int half = SWEEP_STEPS / 2;
+
+    for (int i = 0; i < SWEEP_STEPS; i++) {
+        if (i <= half) {
+            steps.append(min + (center - min) * i / half);
+        } else {
+            steps.append(center + (max - center) * (i - half) / (SWEEP_STEPS - 1 - half));
+        }
+    }
+    return steps;
+}
+
+static void setElement(UAVObjectField *field, const QString &element, double value)
+{
+    int index = field->getElementNames().indexOf(element);
+
+    Q_ASSERT(index >= 0);
+    field->setDouble(value, index);
+}
 
 ConfigAutotuneWidget::ConfigAutotuneWidget(QWidget *parent) :
     ConfigTaskWidget(parent)
 {
-    m_autotune = new Ui_AutotuneWidget();
-    m_autotune->setupUi(this);
-
-    // must be done before auto binding !
-    // setWikiURL("");
+    m_openButton  = new QPushButton(tr("Open log..."));
+    m_applyButton = new QPushButton(tr("Apply"));
+    m_saveButton  = new QPushButton(tr("Save"));
+    m_applyButton->setToolTip(tr("Send the selected PIDs to the PID bank AutoTune stores its results in"));
+    m_saveButton->setToolTip(tr("Send the selected PIDs and save them on the board"));
+    connect(m_openButton, SIGNAL(clicked()), this, SLOT(openLog()));
+    connect(m_applyButton, SIGNAL(clicked()), this, SLOT(applyPids()));
+    connect(m_saveButton, SIGNAL(clicked()), this, SLOT(savePids()));
+
+    QHBoxLayout *controls = new QHBoxLayout();
+    controls->addWidget(m_openButton);
+    controls->addStretch();
+    controls->addWidget(m_applyButton);
+    controls->addWidget(m_saveButton);
+
+    m_status   = new QLabel(tr("Open a flight log with GyroState and ActuatorDesired logged at the sensor rate, "
+                               "fly the way AutoTune does or just fly. The PIDs are computed as the board would at the end of an AutoTune."));
+    m_status->setWordWrap(true);
+    m_progress = new QProgressBar();
+    m_progress->setVisible(false);
+
+    m_models   = new QTableWidget(0, 11);
+    m_models->setHorizontalHeaderLabels(QStringList() << tr("Segment") << tr("Length (s)") << tr("Samples") << tr("Tau (ms)")
+                                        << tr("Beta roll") << tr("Beta pitch") << tr("Beta yaw")
+                                        << tr("Noise roll") << tr("Noise pitch") << tr("Noise yaw") << tr("Checks"));
+    m_sweep    = new QTableWidget(0, 13);
+    m_sweep->setHorizontalHeaderLabels(QStringList() << tr("Damp") << tr("Noise")
+                                       << tr("Roll Kp") << tr("Roll Ki") << tr("Roll Kd")
+                                       << tr("Pitch Kp") << tr("Pitch Ki") << tr("Pitch Kd")
+                                       << tr("Yaw Kp") << tr("Yaw Ki") << tr("Yaw Kd")
+                                       << tr("Attitude Kp") << tr("Attitude Ki"));
+    foreach(QTableWidget * table, QList<QTableWidget *>() << m_models << m_sweep) {
+        table->setSelectionBehavior(QAbstractItemView::SelectRows);
+        table->setSelectionMode(QAbstractItemView::SingleSelection);
+        table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        table->verticalHeader()->setVisible(false);
+        table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    }
+    connect(m_models, SIGNAL(itemSelectionChanged()), this, SLOT(modelSelected()));
+    connect(m_sweep, SIGNAL(itemSelectionChanged()), this, SLOT(updateButtons()));
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(controls);
+    layout->addWidget(m_status);
+    layout->addWidget(m_progress);
+    layout->addWidget(new QLabel(tr("Identified models, all segments combined and each segment")));
+    layout->addWidget(m_models, 1);
+    layout->addWidget(new QLabel(tr("PIDs of the selected model over damping and noise, the default of SystemIdentSettings in bold")));
+    layout->addWidget(m_sweep, 2);
+
+    connect(&m_loadWatcher, SIGNAL(finished()), this, SLOT(logLoaded()));
+    connect(&m_identWatcher, SIGNAL(finished()), this, SLOT(segmentsIdentified()));
+    connect(&m_identWatcher, SIGNAL(progressRangeChanged(int, int)), m_progress, SLOT(setRange(int, int)));
+    connect(&m_identWatcher, SIGNAL(progressValueChanged(int)), m_progress, SLOT(setValue(int)));
+    connect(this, SIGNAL(enableControlsChanged(bool)), this, SLOT(updateButtons()));
+
+    updateButtons();
+}
 
-    addAutoBindings();
+ConfigAutotuneWidget::~ConfigAutotuneWidget()
+{
+    m_identWatcher.cancel();
+    m_identWatcher.waitForFinished();
+    m_loadWatcher.waitForFinished();
+}
 
-    disableMouseWheelEvents();
+void ConfigAutotuneWidget::openLog()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Open flight log"), QString(), tr("OpenPilot logs (*.opl)"));
 
-    // Whenever any value changes compute new potential stabilization settings
-    connect(m_autotune->rateTuning, SIGNAL(valueChanged(int)), this, SLOT(recomputeStabilization()));
-    connect(m_autotune->attitudeTuning, SIGNAL(valueChanged(int)), this, SLOT(recomputeStabilization()));
+    if (fileName.isEmpty()) {
+        return;
+    }
+    float gyroTau = StabilizationSettings::GetInstance(getObjectManager())->getData().GyroTau;
+
+    m_results.clear();
+    m_checks.clear();
+    m_pids.clear();
+    m_models->setRowCount(0);
+    m_sweep->setRowCount(0);
+    m_openButton->setEnabled(false);
+    updateButtons();
+    m_status->setText(tr("Reading %1...").arg(fileName));
+    m_elapsed.start();
+    m_loadWatcher.setFuture(QtConcurrent::run(&m_log, &SystemIdentLog::load, fileName, gyroTau, MIN_THROTTLE, &m_loadError));
+}
 
-    addUAVObject("HwSettings");
-    addWidget(m_autotune->enableAutoTune);
+void ConfigAutotuneWidget::logLoaded()
+{
+    if (!m_loadWatcher.result()) {
+        m_status->setText(m_loadError);
+        m_openButton->setEnabled(true);
+        return;
+    }
 
-    RelayTuning *relayTuning = RelayTuning::GetInstance(getObjectManager());
-    Q_ASSERT(relayTuning);
-    if (relayTuning) {
-        connect(relayTuning, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(recomputeStabilization()));
+    // start where the board starts an AutoTune, from the SystemIdentState defaults
+    SystemIdentState defaults;
+    SystemIdentState::DataFields state = defaults.getData();
+    IdentifySegment identify;
+    identify.tau = state.Tau;
+    for (int i = 0; i < 3; i++) {
+        identify.beta[i] = state.Beta[i];
     }
 
-    // Connect the apply button for the stabilization settings
-    connect(m_autotune->useComputedValues, SIGNAL(pressed()), this, SLOT(saveStabilization()));
+    double length = 0;
+    foreach(const SystemIdentSegment &segment, m_log.segments()) {
+        length += segment.length;
+    }
+    m_status->setText(tr("Identifying %1 segments, %2 s of flight...").arg(m_log.segments().size()).arg(length, 0, 'f', 1));
+    m_progress->setVisible(true);
+    m_identWatcher.setFuture(QtConcurrent::mapped(m_log.segments(), identify));
 }
 
-/**
- * Apply the stabilization settings computed
- */
-void ConfigAutotuneWidget::saveStabilization()
+void ConfigAutotuneWidget::segmentsIdentified()
 {
-    StabilizationSettings *stabilizationSettings = StabilizationSettings::GetInstance(getObjectManager());
-
-    Q_ASSERT(stabilizationSettings);
-    if (!stabilizationSettings) {
+    m_progress->setVisible(false);
+    m_openButton->setEnabled(true);
+    if (m_identWatcher.isCanceled()) {
         return;
     }
 
-    // Make sure to recompute in case the other stab settings changed since
-    // the last time
-    recomputeStabilization();
+    QList<SystemIdentModel> models = m_identWatcher.future().results();
+    float gyroReadTimeAverage = SystemIdentSettings::GetInstance(getObjectManager())->getData().GyroReadTimeAverage;
+
+    // the segments that did not diverge weigh in by their samples
+    SystemIdentModel combined;
+    memset(&combined, 0, sizeof(combined));
+    QVector<quint8> checks;
+    foreach(const SystemIdentModel &model, models) {
+        quint8 check = SystemIdentFilter::check(model, gyroReadTimeAverage, m_log.sensorPeriod());
+        checks.append(check);
+        if (check & (SystemIdentFilter::TAU_NAN | SystemIdentFilter::BETA_NAN)) {
+            continue;
+        }
+        float weight = model.samples;
+        combined.tau += model.tau * weight;
+        for (int i = 0; i < 3; i++) {
+            combined.beta[i]  += model.beta[i] * weight;
+            combined.bias[i]  += model.bias[i] * weight;
+            combined.noise[i] += model.noise[i] * weight;
+        }
+        combined.hoverThrottle += model.hoverThrottle * weight;
+        combined.period  += model.period * weight;
+        combined.samples += model.samples;
+    }
+    if (combined.samples > 0) {
+        float weight = combined.samples;
+        combined.tau /= weight;
+        for (int i = 0; i < 3; i++) {
+            combined.beta[i]  /= weight;
+            combined.bias[i]  /= weight;
+            combined.noise[i] /= weight;
+        }
+        combined.hoverThrottle /= weight;
+        combined.period /= weight;
+    } else {
+        combined.tau = NAN;
+    }
+
+    m_results.clear();
+    m_checks.clear();
+    m_results.append(combined);
+    m_checks.append(SystemIdentFilter::check(combined, gyroReadTimeAverage, m_log.sensorPeriod()));
+    for (int i = 0; i < models.size(); i++) {
+        m_results.append(models.at(i));
+        m_checks.append(checks.at(i));
+    }
 
-    // Apply this data to the board
-    stabilizationSettings->setData(stabSettings);
-    stabilizationSettings->updated();
+    m_models->setRowCount(m_results.size());
+    showModel(0, tr("All"), m_results.at(0), m_checks.at(0));
+    for (int i = 0; i < models.size(); i++) {
+        const SystemIdentSegment &segment = m_log.segments().at(i);
+        showModel(i + 1, tr("%1 s").arg(segment.start, 0, 'f', 1), m_results.at(i + 1), m_checks.at(i + 1));
+    }
+
+    QString clock = m_log.tickFrequency() > 0 ? tr(", CPU clock %1 MHz").arg(m_log.tickFrequency() / 1e6, 0, 'f', 1) : QString();
+    m_status->setText(tr("%1 segments, gyro at %2 Hz%3, identified in %4 ms")
+                      .arg(models.size()).arg(m_log.sensorPeriod() > 0 ? 1.0f / m_log.sensorPeriod() : 0, 0, 'f', 0)
+                      .arg(clock).arg(m_elapsed.elapsed()));
+    m_models->selectRow(0);
 }
 
-/**
- * Called whenever the gain ratios or measured values
- * are changed
- */
-void ConfigAutotuneWidget::recomputeStabilization()
+void ConfigAutotuneWidget::showModel(int row, const QString &name, const SystemIdentModel &model, quint8 checks)
 {
-    RelayTuningSettings *relayTuningSettings = RelayTuningSettings::GetInstance(getObjectManager());
+    QStringList columns;
 
-    Q_ASSERT(relayTuningSettings);
-    if (!relayTuningSettings) {
-        return;
+    columns << name << QString::number(model.samples * model.period, 'f', 1) << QString::number(model.samples)
+            << QString::number(qExp(model.tau) * 1000, 'f', 1);
+    for (int i = 0; i < 3; i++) {
+        columns << QString::number(model.beta[i], 'f', 2);
+    }
+    for (int i = 0; i < 3; i++) {
+        columns << QString::number(model.noise[i], 'f', 0);
+    }
+    columns << checkNames(checks);
+    for (int i = 0; i < columns.size(); i++) {
+        m_models->setItem(row, i, new QTableWidgetItem(columns.at(i)));
     }
+}
 
-    RelayTuning *relayTuning = RelayTuning::GetInstance(getObjectManager());
-    Q_ASSERT(relayTuning);
-    if (!relayTuning) {
-        return;
+QString ConfigAutotuneWidget::checkNames(quint8 checks) const
+{
+    QStringList names;
+
+    if (checks & SystemIdentFilter::TAU_NAN) {
+        names << tr("tau not a number");
+    }
+    if (checks & SystemIdentFilter::BETA_NAN) {
+        names << tr("beta not a number");
+    }
+    if (checks & SystemIdentFilter::ROLL_BETA_LOW) {
+        names << tr("roll gain low");
     }
+    if (checks & SystemIdentFilter::PITCH_BETA_LOW) {
+        names << tr("pitch gain low");
+    }
+    if (checks & SystemIdentFilter::TAU_TOO_LONG) {
+        names << tr("response slow");
+    }
+    if (checks & SystemIdentFilter::TAU_TOO_SHORT) {
+        names << tr("response fast");
+    }
+    if (checks & SystemIdentFilter::CPU_TOO_SLOW) {
+        names << tr("gyro read time above the gyro period");
+    }
+    return names.isEmpty() ? tr("OK") : names.join(", ");
+}
+
+void ConfigAutotuneWidget::modelSelected()
+{
+    int row = m_models->currentRow();
 
-    StabilizationSettings *stabilizationSettings = StabilizationSettings::GetInstance(getObjectManager());
-    Q_ASSERT(stabilizationSettings);
-    if (!stabilizationSettings) {
+    m_pids.clear();
+    m_sweep->setRowCount(0);
+    if (row < 0 || row >= m_results.size()) {
+        updateButtons();
         return;
     }
 
-    RelayTuning::DataFields relayTuningData = relayTuning->getData();
-    RelayTuningSettings::DataFields tuningSettingsData = relayTuningSettings->getData();
-    stabSettings = stabilizationSettings->getData();
-
-    // Need to divide these by 100 because that is what the .ui file does
-    // to get the UAVO
-    const double gain_ratio_r = m_autotune->rateTuning->value() / 100.0;
-    const double zero_ratio_r = m_autotune->rateTuning->value() / 100.0;
-    const double gain_ratio_p = m_autotune->attitudeTuning->value() / 100.0;
-    const double zero_ratio_p = m_autotune->attitudeTuning->value() / 100.0;
+    SystemIdentSettings::DataFields ident = SystemIdentSettings::GetInstance(getObjectManager())->getData();
+    SystemIdentPidSettings settings = pidSettings();
+    QVector<float> damps  = sweepSteps(ident.DampMin, ident.DampRate, ident.DampMax);
+    QVector<float> noises = sweepSteps(ident.NoiseMin, ident.NoiseRate, ident.NoiseMax);
+    foreach(float damp, damps) {
+        foreach(float noise, noises) {
+            m_pids.append(SystemIdentFilter::computePids(m_results.at(row), settings, damp, noise));
+        }
+    }
 
-    // For now just run over roll and pitch
-    for (int i = 0; i < 2; i++) {
-        if (relayTuningData.Period[i] == 0 || relayTuningData.Gain[i] == 0) {
-            continue;
+    bool yaw = settings.calculateYaw != SystemIdentPidSettings::YawFalse;
+    int defaultRow = 0;
+    m_sweep->setRowCount(m_pids.size());
+    for (int i = 0; i < m_pids.size(); i++) {
+        const SystemIdentPids &pids = m_pids.at(i);
+        QStringList columns;
+        columns << QString::number(pids.damp, 'f', 0) << QString::number(pids.noise, 'f', 1);
+        for (int axis = 0; axis < 3; axis++) {
+            bool shown = axis < 2 || yaw;
+            columns << (shown ? QString::number(pids.kp[axis], 'f', 5) : QString("-"))
+                    << (shown ? QString::number(pids.ki[axis], 'f', 5) : QString("-"))
+                    << (shown ? QString::number(pids.kd[axis], 'f', 6) : QString("-"));
         }
+        columns << QString::number(pids.outerKp, 'f', 2) << QString::number(pids.outerKi, 'f', 2);
 
-        double wu  = 1000.0 * 2 * M_PI / relayTuningData.Period[i]; // ultimate freq = output osc freq (rad/s)
-
-        double wc  = wu * gain_ratio_r;      // target openloop crossover frequency (rad/s)
-        double zc  = wc * zero_ratio_r;      // controller zero location (rad/s)
-        double kpu = 4.0f / M_PI / relayTuningData.Gain[i]; // ultimate gain, i.e. the proportional gain for instablity
-        double kp  = kpu * gain_ratio_r;     // proportional gain
-        double ki  = zc * kp;                // integral gain
-
-        // Now calculate gains for the next loop out knowing it is the integral of
-        // the inner loop -- the plant is position/velocity = scale*1/s
-        double wc2 = wc * gain_ratio_p; // crossover of the attitude loop
-        double kp2 = wc2; // kp of attitude
-        double ki2 = wc2 * zero_ratio_p * kp2; // ki of attitude
-
-        switch (i) {
-        case 0: // Roll
-
-            stabSettings.RollRatePID[StabilizationSettings::ROLLRATEPID_KP] = kp;
-            stabSettings.RollRatePID[StabilizationSettings::ROLLRATEPID_KI] = ki;
-            stabSettings.RollPI[StabilizationSettings::ROLLPI_KP] = kp2;
-            stabSettings.RollPI[StabilizationSettings::ROLLPI_KI] = ki2;
-            break;
-        case 1: // Pitch
-            stabSettings.PitchRatePID[StabilizationSettings::PITCHRATEPID_KP] = kp;
-            stabSettings.PitchRatePID[StabilizationSettings::PITCHRATEPID_KI] = ki;
-            stabSettings.PitchPI[StabilizationSettings::PITCHPI_KP] = kp2;
-            stabSettings.PitchPI[StabilizationSettings::PITCHPI_KI] = ki2;
-            break;
+        bool isDefault = qFuzzyCompare(pids.damp, (float)ident.DampRate) && qFuzzyCompare(pids.noise, (float)ident.NoiseRate);
+        if (isDefault) {
+            defaultRow = i;
+        }
+        for (int column = 0; column < columns.size(); column++) {
+            QTableWidgetItem *item = new QTableWidgetItem(columns.at(column));
+            if (isDefault) {
+                QFont font = item->font();
+                font.setBold(true);
+                item->setFont(font);
+            }
+            m_sweep->setItem(i, column, item);
         }
     }
+    m_sweep->selectRow(defaultRow);
+    updateButtons();
+}
 
-    // Display these computed settings
-    m_autotune->rollRateKp->setText(QString().number(stabSettings.RollRatePID[StabilizationSettings::ROLLRATEPID_KP]));
-    m_autotune->rollRateKi->setText(QString().number(stabSettings.RollRatePID[StabilizationSettings::ROLLRATEPID_KI]));
-    m_autotune->rollAttitudeKp->setText(QString().number(stabSettings.RollPI[StabilizationSettings::ROLLPI_KP]));
-    m_autotune->rollAttitudeKi->setText(QString().number(stabSettings.RollPI[StabilizationSettings::ROLLPI_KI]));
-    m_autotune->pitchRateKp->setText(QString().number(stabSettings.PitchRatePID[StabilizationSettings::PITCHRATEPID_KP]));
-    m_autotune->pitchRateKi->setText(QString().number(stabSettings.PitchRatePID[StabilizationSettings::PITCHRATEPID_KI]));
-    m_autotune->pitchAttitudeKp->setText(QString().number(stabSettings.PitchPI[StabilizationSettings::PITCHPI_KP]));
-    m_autotune->pitchAttitudeKi->setText(QString().number(stabSettings.PitchPI[StabilizationSettings::PITCHPI_KI]));
+SystemIdentPidSettings ConfigAutotuneWidget::pidSettings()
+{
+    SystemIdentSettings::DataFields ident = SystemIdentSettings::GetInstance(getObjectManager())->getData();
+    SystemIdentPidSettings settings;
+
+    settings.gyroReadTimeAverage  = ident.GyroReadTimeAverage;
+    settings.outerLoopKpSoftClamp = ident.OuterLoopKpSoftClamp;
+    settings.derivativeFactor     = ident.DerivativeFactor;
+    settings.yawToRollPitchPIDRatioMin = ident.YawToRollPitchPIDRatioMin;
+    settings.yawToRollPitchPIDRatioMax = ident.YawToRollPitchPIDRatioMax;
+    // the options are in the same order
+    settings.calculateYaw = ident.CalculateYaw;
+
+    UAVObjectField *maximumRate = getObject(QString("StabilizationSettingsBank%1").arg(destinationBank()))->getField("MaximumRate");
+    settings.maximumRate[0] = maximumRate->getValue(0).toUInt();
+    settings.maximumRate[1] = maximumRate->getValue(1).toUInt();
+    return settings;
 }
 
-void ConfigAutotuneWidget::refreshWidgetsValuesImpl(UAVObject *obj)
+int ConfigAutotuneWidget::destinationBank()
 {
-    HwSettings *hwSettings = HwSettings::GetInstance(getObjectManager());
+    return qBound(1, (int)SystemIdentSettings::GetInstance(getObjectManager())->getData().DestinationPidBank, 3);
+}
 
-    if (obj == hwSettings) {
-        bool enabled = (hwSettings->getOptionalModules(HwSettings::OPTIONALMODULES_AUTOTUNE) == HwSettings::OPTIONALMODULES_ENABLED);
-        m_autotune->enableAutoTune->setChecked(enabled);
-    }
+void ConfigAutotuneWidget::updateButtons()
+{
+    int model = m_models->currentRow();
+    bool valid = m_sweep->currentRow() >= 0 && m_sweep->currentRow() < m_pids.size()
+                 && model >= 0 && model < m_checks.size()
+                 && !(m_checks.at(model) & (SystemIdentFilter::TAU_NAN | SystemIdentFilter::BETA_NAN));
+
+    m_applyButton->setText(tr("Apply to bank %1").arg(destinationBank()));
+    m_saveButton->setText(tr("Save to bank %1").arg(destinationBank()));
+    m_applyButton->setEnabled(valid && isConnected());
+    m_saveButton->setEnabled(valid && isConnected());
 }
 
-void ConfigAutotuneWidget::updateObjectsFromWidgetsImpl()
+void ConfigAutotuneWidget::applyPids()
 {
-    HwSettings *hwSettings = HwSettings::GetInstance(getObjectManager());
+    writePids(false);
+}
 
-    quint8 enableModule    = (m_autotune->enableAutoTune->isChecked()) ? HwSettings::OPTIONALMODULES_ENABLED : HwSettings::OPTIONALMODULES_DISABLED;
+void ConfigAutotuneWidget::savePids()
+{
+    writePids(true);
+}
 
-    hwSettings->setOptionalModules(HwSettings::OPTIONALMODULES_AUTOTUNE, enableModule);
-    ;
+/**
+ * Send the selected PIDs to the destination bank, and the model to
+ * SystemIdentSettings so the smooth/quick selection in flight starts from it.
+ */
+bool ConfigAutotuneWidget::writePids(bool save)
+{
+    int model = m_models->currentRow();
+    int row   = m_sweep->currentRow();
+
+    if (model < 0 || model >= m_results.size() || row < 0 || row >= m_pids.size()) {
+        return false;
+    }
+    const SystemIdentPids &pids = m_pids.at(row);
+
+    SystemIdentSettings *identSettings   = SystemIdentSettings::GetInstance(getObjectManager());
+    SystemIdentSettings::DataFields ident = identSettings->getData();
+    UAVObject *bank = getObject(QString("StabilizationSettingsBank%1").arg(destinationBank()));
+
+    static const char *rateFields[] = { "RollRatePID", "PitchRatePID", "YawRatePID" };
+    int axes = (ident.CalculateYaw != SystemIdentSettings::CALCULATEYAW_FALSE) ? 3 : 2;
+    for (int i = 0; i < axes; i++) {
+        UAVObjectField *field = bank->getField(rateFields[i]);
+        setElement(field, "Kp", pids.kp[i]);
+        setElement(field, "Ki", pids.ki[i]);
+        setElement(field, "Kd", pids.kd[i]);
+    }
+    static const char *attitudeFields[] = { "RollPI", "PitchPI" };
+    for (int i = 0; i < 2; i++) {
+        UAVObjectField *field = bank->getField(attitudeFields[i]);
+        setElement(field, "Kp", pids.outerKp);
+        setElement(field, "Ki", pids.outerKi);
+    }
+
+    const SystemIdentModel &result = m_results.at(model);
+    ident.Tau = result.tau;
+    for (int i = 0; i < 3; i++) {
+        ident.Beta[i] = result.beta[i];
+    }
+    ident.Complete = m_checks.at(model) ? SystemIdentSettings::COMPLETE_FALSE : SystemIdentSettings::COMPLETE_TRUE;
+    identSettings->setData(ident);
+
+    bank->updated();
+    identSettings->updated();
+    if (save) {
+        UAVObjectUtilManager *utilMngr = ExtensionSystem::PluginManager::instance()->getObject<UAVObjectUtilManager>();
+        utilMngr->saveObjectToSD(bank);
+        utilMngr->saveObjectToSD(identSettings);
+    }
+    m_status->setText(tr("PIDs for damp %1 and noise %2 %3 bank %4")
+                      .arg(pids.damp, 0, 'f', 0).arg(pids.noise, 0, 'f', 1)
+                      .arg(save ? tr("saved to") : tr("sent to")).arg(destinationBank()));
+    return true;
 }
+
+/**
+ * @}
+ * @}
+ */
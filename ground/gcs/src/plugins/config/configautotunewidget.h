@@ -2,12 +2,13 @@
  ******************************************************************************
  *
  * @file       configautotunewidget.h
- * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ *             The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
  * @addtogroup GCSPlugins GCS Plugins
  * @{
  * @addtogroup ConfigPlugin Config Plugin
  * @{
- * @brief The Configuration Gadget used to adjust or recalculate autotuning
+ * @brief Runs the AutoTune system identification over a flight log
  *****************************************************************************/
 /*
  * This program is free software; you can redistribute it and/or modify
@@ -27,36 +28,61 @@
 #ifndef CONFIGAUTOTUNE_H
 #define CONFIGAUTOTUNE_H
 
-#include "../uavobjectwidgetutils/configtaskwidget.h"
-#include "extensionsystem/pluginmanager.h"
-#include "uavobjectmanager.h"
-#include "uavobject.h"
+#include "configtaskwidget.h"
+#include "autotune/systemident.h"
+#include "autotune/systemidentlog.h"
 
-#include "stabilizationsettings.h"
-#include "relaytuningsettings.h"
-#include "relaytuning.h"
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QVector>
 
-#include <QWidget>
-#include <QTimer>
-
-class Ui_AutotuneWidget;
+class QLabel;
+class QProgressBar;
+class QPushButton;
+class QTableWidget;
 
 class ConfigAutotuneWidget : public ConfigTaskWidget {
     Q_OBJECT
+
 public:
     explicit ConfigAutotuneWidget(QWidget *parent = 0);
+    ~ConfigAutotuneWidget();
+
+private slots:
+    void openLog();
+    void logLoaded();
+    void segmentsIdentified();
+    void modelSelected();
+    void applyPids();
+    void savePids();
+    void updateButtons();
 
 private:
-    Ui_AutotuneWidget *m_autotune;
-    StabilizationSettings::DataFields stabSettings;
+    SystemIdentPidSettings pidSettings();
+    int destinationBank();
+    bool writePids(bool save);
+    void showModel(int row, const QString &name, const SystemIdentModel &model, quint8 checks);
+    QString checkNames(quint8 checks) const;
 
-protected:
-    virtual void refreshWidgetsValuesImpl(UAVObject *obj);
-    virtual void updateObjectsFromWidgetsImpl();
+    QPushButton *m_openButton;
+    QPushButton *m_applyButton;
+    QPushButton *m_saveButton;
+    QLabel *m_status;
+    QProgressBar *m_progress;
+    QTableWidget *m_models;
+    QTableWidget *m_sweep;
 
-private slots:
-    void recomputeStabilization();
-    void saveStabilization();
+    // m_log is filled in a worker thread, only touch it when m_loadWatcher is done
+    SystemIdentLog m_log;
+    QString m_loadError;
+    QFutureWatcher<bool> m_loadWatcher;
+    QFutureWatcher<SystemIdentModel> m_identWatcher;
+    QElapsedTimer m_elapsed;
+
+    // row 0 is all segments combined, then one row per segment
+    QVector<SystemIdentModel> m_results;
+    QVector<quint8> m_checks;
+    QVector<SystemIdentPids> m_pids;
 };
 
 #endif // CONFIGAUTOTUNE_H
@@ -35,6 +35,7 @@
 #include "configstabilizationwidget.h"
 #include "configcamerastabilizationwidget.h"
 #include "configtxpidwidget.h"
+#include "configautotunewidget.h"
 #include "configrevohwwidget.h"
 #include "config_cc_hw_widget.h"
 #include "configoplinkwidget.h"
@@ -129,6 +130,13 @@ ConfigGadgetWidget::ConfigGadgetWidget(QWidget *parent) : QWidget(parent)
     static_cast<ConfigTaskWidget *>(widget)->bind();
     stackWidget->insertTab(ConfigGadgetWidget::TxPid, widget, *icon, QString("TxPID"));
 
+    icon   = new QIcon();
+    icon->addFile(":/configgadget/images/autotune_normal.png", QSize(), QIcon::Normal, QIcon::Off);
+    icon->addFile(":/configgadget/images/autotune_selected.png", QSize(), QIcon::Selected, QIcon::Off);
+    widget = new ConfigAutotuneWidget(this);
+    static_cast<ConfigTaskWidget *>(widget)->bind();
+    stackWidget->insertTab(ConfigGadgetWidget::AutoTune, widget, *icon, QString("AutoTune"));
+
     icon   = new QIcon();
     icon->addFile(":/configgadget/images/pipx-normal.png", QSize(), QIcon::Normal, QIcon::Off);
     icon->addFile(":/configgadget/images/pipx-selected.png", QSize(), QIcon::Selected, QIcon::Off);
@@ -80,6 +80,7 @@ ConfigOPLinkWidget::ConfigOPLinkWidget(QWidget *parent) : ConfigTaskWidget(paren
     addWidgetBinding("OPLinkSettings", "MaxChannel", m_oplink->MaximumChannel);
     addWidgetBinding("OPLinkSettings", "MaxRFPower", m_oplink->MaxRFTxPower);
     addWidgetBinding("OPLinkSettings", "ComSpeed", m_oplink->ComSpeed);
+    addWidgetBinding("OPLinkSettings", "LinkAdaptation", m_oplink->LinkAdaptation);
     addWidgetBinding("OPLinkSettings", "MainPort", m_oplink->MainPort);
     addWidgetBinding("OPLinkSettings", "FlexiPort", m_oplink->FlexiPort);
     addWidgetBinding("OPLinkSettings", "VCPPort", m_oplink->VCPPort);
@@ -260,6 +261,7 @@ void ConfigOPLinkWidget::updateSettings()
     bool is_bound = (m_oplink->CoordID->text() != "");
 
     m_oplink->ComSpeed->setEnabled(is_enabled && !is_ppm_only && !is_openlrs);
+    m_oplink->LinkAdaptation->setEnabled(is_enabled && !is_ppm_only && !is_openlrs);
     m_oplink->CoordID->setEnabled(is_enabled && is_receiver);
     m_oplink->UnbindButton->setEnabled(is_enabled && is_bound && !is_coordinator);
     m_oplink->CustomDeviceID->setEnabled(is_coordinator);
@@ -0,0 +1,28 @@
+TEMPLATE = lib
+TARGET = EventTraceGadget
+
+QT += widgets
+
+include(../../plugin.pri)
+include(../../plugins/coreplugin/coreplugin.pri)
+include(eventtrace_dependencies.pri)
+
+HEADERS += \
+    eventtraceplugin.h \
+    eventtracegadget.h \
+    eventtracegadgetwidget.h \
+    eventtracegadgetfactory.h \
+    eventtracedecoder.h \
+    eventtracetimeline.h \
+    eventtracehistogram.h
+
+SOURCES += \
+    eventtraceplugin.cpp \
+    eventtracegadget.cpp \
+    eventtracegadgetfactory.cpp \
+    eventtracegadgetwidget.cpp \
+    eventtracedecoder.cpp \
+    eventtracetimeline.cpp \
+    eventtracehistogram.cpp
+
+OTHER_FILES += EventTraceGadget.pluginspec
@@ -0,0 +1,234 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracedecoder.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Turns an event trace dump into timeline lanes
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "eventtracedecoder.h"
+
+#include <QObject>
+#include <QtEndian>
+
+#define TRACE_MAGIC       0x43525445 // "ETRC"
+#define TRACE_VERSION     2
+#define TRACE_HEADER_SIZE 24
+#define TRACE_RECORD_SIZE 8
+#define TRACE_NO_TASK     0xffff
+#define TRACE_METAOBJECT  0x8000
+
+EventTraceDecoder::EventTraceDecoder() :
+    m_duration(0), m_frequency(0), m_records(0), m_lost(0)
+{}
+
+bool EventTraceDecoder::decode(const QByteArray &dump, QString *error)
+{
+    const uchar *data = (const uchar *)dump.constData();
+
+    m_lanes.clear();
+    m_marks.clear();
+    m_laneIndex.clear();
+    m_openSince.clear();
+    m_depth.clear();
+    m_duration = 0;
+
+    if (dump.size() < TRACE_HEADER_SIZE ||
+        qFromLittleEndian<quint32>(data) != TRACE_MAGIC ||
+        qFromLittleEndian<quint16>(data + 4) != TRACE_VERSION) {
+        *error = QObject::tr("Not an event trace");
+        return false;
+    }
+
+    int tasks      = data[6];
+    int nameLength = data[7];
+    m_records   = qFromLittleEndian<quint32>(data + 8);
+    m_frequency = qFromLittleEndian<quint32>(data + 12);
+    m_lost = qFromLittleEndian<quint32>(data + 16);
+    int objects = qFromLittleEndian<quint16>(data + 20);
+
+    int objectsOffset = TRACE_HEADER_SIZE + tasks * nameLength;
+    int recordsOffset = objectsOffset + objects * 4;
+    if (m_frequency == 0 || dump.size() < recordsOffset + (qint64)m_records * TRACE_RECORD_SIZE) {
+        *error = QObject::tr("Truncated event trace");
+        return false;
+    }
+
+    // task lanes first, in the order of the name table
+    for (int i = 0; i < tasks; i++) {
+        const char *name = (const char *)data + TRACE_HEADER_SIZE + i * nameLength;
+        lane(EventTraceLane::Task, i, QString::fromLatin1(name, qstrnlen(name, nameLength)));
+    }
+
+    QVector<double> readySince(tasks, -1);
+    qint64 ticks = 0;
+    quint32 previous = 0;
+
+    for (quint32 i = 0; i < m_records; i++) {
+        const uchar *record = data + recordsOffset + i * TRACE_RECORD_SIZE;
+        quint32 timestamp   = qFromLittleEndian<quint32>(record);
+        quint8 type   = record[4];
+        quint8 arg8   = record[5];
+        quint16 arg16 = qFromLittleEndian<quint16>(record + 6);
+
+        // signed so that records stored slightly out of order step back
+        if (i > 0) {
+            ticks += (qint32)(timestamp - previous);
+        }
+        previous = timestamp;
+        double time = ticks * 1e6 / m_frequency;
+        m_duration = qMax(m_duration, time);
+
+        switch (type) {
+        case TASK_IN:
+        case TASK_OUT:
+        case TASK_READY:
+        {
+            int index = (arg16 == TRACE_NO_TASK) ? lane(EventTraceLane::Task, arg16, QObject::tr("Other tasks")) : arg16;
+            if (arg16 != TRACE_NO_TASK && arg16 >= tasks) {
+                break;
+            }
+            if (type == TASK_IN) {
+                open(index, time);
+                if (arg16 < tasks && readySince[arg16] >= 0) {
+                    m_lanes[index].latencies.append(time - readySince[arg16]);
+                    readySince[arg16] = -1;
+                }
+            } else if (type == TASK_OUT) {
+                close(index, time);
+            } else if (arg16 < tasks && readySince[arg16] < 0) {
+                readySince[arg16] = time;
+            }
+            break;
+        }
+        case CALLBACK_START:
+        case CALLBACK_STOP:
+        {
+            QString name = (arg16 < m_callbackNames.size()) ? m_callbackNames.at(arg16) :
+                           (arg16 == 0xffff) ? QObject::tr("Callback (unnamed)") : QObject::tr("Callback %1").arg(arg16);
+            int index    = lane(EventTraceLane::Callback, arg16, name);
+            if (type == CALLBACK_START) {
+                open(index, time);
+            } else {
+                close(index, time);
+            }
+            break;
+        }
+        case ISR_ENTER:
+        case ISR_EXIT:
+        case MARKER_START:
+        case MARKER_END:
+        {
+            bool isr     = (type == ISR_ENTER || type == ISR_EXIT);
+            QString name = isr ? QObject::tr("IRQ %1").arg((qint16)arg16) :
+                           QObject::tr("Marker 0x%1").arg(arg16, 4, 16, QChar('0'));
+            int index    = lane(isr ? EventTraceLane::Isr : EventTraceLane::Marker, arg16, name);
+            if (type == ISR_ENTER || type == MARKER_START) {
+                if (m_depth[index]++ == 0) {
+                    open(index, time);
+                }
+            } else if (m_depth[index] > 0) {
+                if (--m_depth[index] == 0) {
+                    close(index, time);
+                }
+            } else {
+                // entered before the trace started
+                close(index, time);
+            }
+            break;
+        }
+        case OBJECT_SET:
+        case OBJECT_GET:
+        case MARKER_VALUE:
+        {
+            EventTraceMark mark = { time, type, arg8, arg16, 0 };
+            // a metaobject takes the id of its object plus one
+            int object = arg16 & ~TRACE_METAOBJECT;
+            if (type != MARKER_VALUE && object < objects) {
+                mark.object = qFromLittleEndian<quint32>(data + objectsOffset + object * 4) + ((arg16 & TRACE_METAOBJECT) ? 1 : 0);
+            }
+            m_marks.append(mark);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // whatever runs at the end of the trace runs to the end
+    for (int i = 0; i < m_lanes.size(); i++) {
+        if (m_openSince[i] >= 0) {
+            close(i, m_duration);
+        }
+    }
+
+    return true;
+}
+
+int EventTraceDecoder::lane(EventTraceLane::Kind kind, quint16 id, const QString &name)
+{
+    quint32 key = ((quint32)kind << 16) | id;
+
+    if (!m_laneIndex.contains(key)) {
+        EventTraceLane lane;
+        lane.kind = kind;
+        lane.id   = id;
+        lane.name = name;
+        lane.busy = 0;
+        m_laneIndex.insert(key, m_lanes.size());
+        m_lanes.append(lane);
+        m_openSince.append(-1);
+        m_depth.append(0);
+    }
+    return m_laneIndex.value(key);
+}
+
+void EventTraceDecoder::open(int lane, double time)
+{
+    if (m_openSince[lane] < 0) {
+        m_openSince[lane] = time;
+    }
+}
+
+void EventTraceDecoder::close(int lane, double time)
+{
+    EventTraceLane &l = m_lanes[lane];
+    double start;
+
+    if (m_openSince[lane] >= 0) {
+        start = m_openSince[lane];
+    } else if (l.intervals.isEmpty()) {
+        // already running when the trace started
+        start = 0;
+    } else {
+        return;
+    }
+    EventTraceInterval interval = { start, time };
+    l.intervals.append(interval);
+    l.busy += time - start;
+    m_openSince[lane] = -1;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracedecoder.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Turns an event trace dump into timeline lanes
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACEDECODER_H
+#define EVENTTRACEDECODER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// a span of a lane, microseconds from the first record
+struct EventTraceInterval {
+    double start;
+    double end;
+};
+
+// an instantaneous event, object accesses and marker values
+struct EventTraceMark {
+    double  time;
+    quint8  type;
+    quint8  arg8;
+    quint16 arg16;
+    quint32 object; // object accesses: the id, from the object table of the dump, 0 if unknown
+};
+
+struct EventTraceLane {
+    enum Kind { Task, Callback, Isr, Marker };
+
+    Kind    kind;
+    quint16 id;
+    QString name;
+    QVector<EventTraceInterval> intervals;
+    QVector<double> latencies; // tasks: ready to switched in, microseconds
+    double  busy; // microseconds spent in the intervals
+};
+
+/*
+ * Decoder of the dump of PIOS_EVENTTRACE, see flight/pios/inc/pios_eventtrace.h
+ * for the layout. Timestamps are 32 bit counters, they are unwrapped record
+ * to record so traces longer than a counter period are fine as long as
+ * consecutive records are closer than half of it.
+ */
+class EventTraceDecoder {
+public:
+    enum Type {
+        TASK_IN = 1,
+        TASK_OUT,
+        TASK_READY,
+        CALLBACK_START,
+        CALLBACK_STOP,
+        ISR_ENTER,
+        ISR_EXIT,
+        OBJECT_SET,
+        OBJECT_GET,
+        MARKER_START,
+        MARKER_END,
+        MARKER_VALUE,
+    };
+
+    EventTraceDecoder();
+
+    bool decode(const QByteArray &dump, QString *error);
+
+    // optional names of the callbacks, by id
+    void setCallbackNames(const QStringList &names)
+    {
+        m_callbackNames = names;
+    }
+
+    const QVector<EventTraceLane> &lanes() const
+    {
+        return m_lanes;
+    }
+    const QVector<EventTraceMark> &marks() const
+    {
+        return m_marks;
+    }
+    double duration() const
+    {
+        return m_duration;
+    }
+    quint32 frequency() const
+    {
+        return m_frequency;
+    }
+    quint32 records() const
+    {
+        return m_records;
+    }
+    quint32 lost() const
+    {
+        return m_lost;
+    }
+
+private:
+    int lane(EventTraceLane::Kind kind, quint16 id, const QString &name);
+    void open(int lane, double time);
+    void close(int lane, double time);
+
+    QStringList m_callbackNames;
+
+    QVector<EventTraceLane> m_lanes;
+    QVector<EventTraceMark> m_marks;
+    QHash<quint32, int> m_laneIndex; // kind << 16 | id
+    QVector<double> m_openSince; // per lane, < 0 when closed
+    QVector<int> m_depth; // per lane, nested interrupts and markers
+    double  m_duration;
+    quint32 m_frequency;
+    quint32 m_records;
+    quint32 m_lost;
+};
+
+#endif // EVENTTRACEDECODER_H
@@ -0,0 +1,316 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracegadgetwidget.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Event trace gadget, timeline of the on board event trace
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "eventtracegadgetwidget.h"
+#include "eventtracehistogram.h"
+#include "eventtracetimeline.h"
+
+#include "eventtracecontrol.h"
+#include "eventtracedata.h"
+#include "uavobjectmanager.h"
+#include "uavobjectfield.h"
+#include <extensionsystem/pluginmanager.h>
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QFile>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QScrollArea>
+#include <QSplitter>
+#include <QVBoxLayout>
+
+// time without a chunk before a dump is given up
+#define DUMP_TIMEOUT_MS 2000
+#define DUMP_PERIOD_MS  10
+
+EventTraceGadgetWidget::EventTraceGadgetWidget(QWidget *parent) : QWidget(parent),
+    m_chunkCount(0)
+{
+    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+
+    m_objectManager = pm->getObject<UAVObjectManager>();
+    Q_ASSERT(m_objectManager);
+    m_control = EventTraceControl::GetInstance(m_objectManager);
+    Q_ASSERT(m_control);
+    m_data    = EventTraceData::GetInstance(m_objectManager);
+    Q_ASSERT(m_data);
+
+    // the chunks come faster than the GUI thread would see each update
+    connect(m_data, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(chunkReceived(UAVObject *)), Qt::DirectConnection);
+
+    m_dumpTimer.setSingleShot(true);
+    connect(&m_dumpTimer, SIGNAL(timeout()), this, SLOT(dumpTimeout()));
+
+    QHBoxLayout *controls = new QHBoxLayout();
+    QStringList classes   = QStringList() << tr("Tasks") << tr("Callbacks") << tr("Interrupts") << tr("Objects") << tr("Markers");
+    foreach(QString name, classes) {
+        QCheckBox *box = new QCheckBox(name);
+
+        box->setChecked(name != tr("Objects"));
+        m_mask.append(box);
+        controls->addWidget(box);
+    }
+    controls->addStretch();
+
+    QPushButton *start = new QPushButton(tr("Start"));
+    QPushButton *stop  = new QPushButton(tr("Stop"));
+    QPushButton *dump  = new QPushButton(tr("Dump"));
+    QPushButton *open  = new QPushButton(tr("Open..."));
+    m_saveButton = new QPushButton(tr("Save..."));
+    m_saveButton->setEnabled(false);
+    connect(start, SIGNAL(clicked()), this, SLOT(startTrace()));
+    connect(stop, SIGNAL(clicked()), this, SLOT(stopTrace()));
+    connect(dump, SIGNAL(clicked()), this, SLOT(dumpTrace()));
+    connect(open, SIGNAL(clicked()), this, SLOT(openTrace()));
+    connect(m_saveButton, SIGNAL(clicked()), this, SLOT(saveTrace()));
+    controls->addWidget(start);
+    controls->addWidget(stop);
+    controls->addWidget(dump);
+    controls->addWidget(open);
+    controls->addWidget(m_saveButton);
+
+    m_status   = new QLabel(tr("Start a trace on the board, then dump it"));
+
+    m_timeline = new EventTraceTimeline();
+    QScrollArea *scroll = new QScrollArea();
+    scroll->setWidget(m_timeline);
+    scroll->setWidgetResizable(true);
+    scroll->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+
+    m_tasks     = new QComboBox();
+    connect(m_tasks, SIGNAL(currentIndexChanged(int)), this, SLOT(taskSelected(int)));
+    m_histogram = new EventTraceHistogram();
+
+    QWidget *latency = new QWidget();
+    QVBoxLayout *latencyLayout = new QVBoxLayout(latency);
+    latencyLayout->setContentsMargins(0, 0, 0, 0);
+    latencyLayout->addWidget(m_tasks);
+    latencyLayout->addWidget(m_histogram);
+
+    QSplitter *splitter = new QSplitter(Qt::Vertical);
+    splitter->addWidget(scroll);
+    splitter->addWidget(latency);
+    splitter->setStretchFactor(0, 3);
+    splitter->setStretchFactor(1, 1);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(controls);
+    layout->addWidget(m_status);
+    layout->addWidget(splitter);
+}
+
+EventTraceGadgetWidget::~EventTraceGadgetWidget()
+{
+    disconnect(m_data, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(chunkReceived(UAVObject *)));
+}
+
+void EventTraceGadgetWidget::sendOperation(quint8 operation)
+{
+    quint8 mask = 0;
+
+    for (int i = 0; i < m_mask.size(); i++) {
+        if (m_mask.at(i)->isChecked()) {
+            mask |= 1 << i;
+        }
+    }
+    m_control->setOperation(operation);
+    m_control->setMask(mask);
+    m_control->setPeriod(DUMP_PERIOD_MS);
+    m_control->updated();
+}
+
+void EventTraceGadgetWidget::startTrace()
+{
+    sendOperation(EventTraceControl::OPERATION_START);
+    m_status->setText(tr("Tracing"));
+}
+
+void EventTraceGadgetWidget::stopTrace()
+{
+    sendOperation(EventTraceControl::OPERATION_STOP);
+    m_status->setText(tr("Stopped, dump the trace to see it"));
+}
+
+void EventTraceGadgetWidget::dumpTrace()
+{
+    {
+        QMutexLocker locker(&m_chunkMutex);
+        m_chunks.clear();
+        m_chunkCount = 0;
+    }
+    m_dumpTimer.start(DUMP_TIMEOUT_MS);
+    sendOperation(EventTraceControl::OPERATION_DUMP);
+    m_status->setText(tr("Dumping..."));
+}
+
+/**
+ * Called in the telemetry thread for each EventTraceData received.
+ */
+void EventTraceGadgetWidget::chunkReceived(UAVObject *object)
+{
+    Q_UNUSED(object);
+
+    EventTraceData::DataFields data = m_data->getData();
+    {
+        QMutexLocker locker(&m_chunkMutex);
+        m_chunkCount = data.Chunks;
+        m_chunks.insert(data.Chunk, QByteArray((const char *)data.Data, qMin((int)data.Size, (int)sizeof(data.Data))));
+    }
+    QMetaObject::invokeMethod(this, "chunksChanged", Qt::QueuedConnection);
+}
+
+void EventTraceGadgetWidget::chunksChanged()
+{
+    QByteArray dump;
+    {
+        QMutexLocker locker(&m_chunkMutex);
+        if (!m_dumpTimer.isActive()) {
+            // late chunks of a dump given up
+            return;
+        }
+        if (m_chunks.size() < m_chunkCount) {
+            m_status->setText(tr("Dumping, %1 of %2 chunks").arg(m_chunks.size()).arg(m_chunkCount));
+            m_dumpTimer.start(DUMP_TIMEOUT_MS);
+            return;
+        }
+        foreach(const QByteArray &chunk, m_chunks) {
+            dump.append(chunk);
+        }
+    }
+    m_dumpTimer.stop();
+    showTrace(dump);
+}
+
+void EventTraceGadgetWidget::dumpTimeout()
+{
+    QMutexLocker locker(&m_chunkMutex);
+
+    if (m_chunkCount == 0) {
+        m_status->setText(tr("No answer from the board, is the event trace built in?"));
+    } else {
+        m_status->setText(tr("%1 of %2 chunks missing, stop the trace and dump it again")
+                          .arg(m_chunkCount - m_chunks.size()).arg(m_chunkCount));
+    }
+}
+
+void EventTraceGadgetWidget::openTrace()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Open event trace"), QString(), tr("Event traces (*.trace)"));
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_status->setText(tr("Cannot open %1").arg(fileName));
+        return;
+    }
+    showTrace(file.readAll());
+}
+
+void EventTraceGadgetWidget::saveTrace()
+{
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Save event trace"), QString(), tr("Event traces (*.trace)"));
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+    if (!fileName.endsWith(".trace")) {
+        fileName.append(".trace");
+    }
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(m_dump) != m_dump.size()) {
+        m_status->setText(tr("Cannot write %1").arg(fileName));
+    }
+}
+
+QStringList EventTraceGadgetWidget::callbackNames()
+{
+    // callback ids are the elements of CallbackInfo, see PIOS_CALLBACKSCHEDULER_Create()
+    UAVObject *info = m_objectManager->getObject(QString("CallbackInfo"));
+    UAVObjectField *field = info ? info->getField(QString("RunningTime")) : NULL;
+
+    return field ? field->getElementNames() : QStringList();
+}
+
+QHash<quint32, QString> EventTraceGadgetWidget::objectNames()
+{
+    QHash<quint32, QString> names;
+
+    // the metaobjects are in the list too, named after their object
+    foreach(const QList<UAVObject *> &instances, m_objectManager->getObjects()) {
+        if (!instances.isEmpty()) {
+            names.insert(instances.first()->getObjID(), instances.first()->getName());
+        }
+    }
+    return names;
+}
+
+void EventTraceGadgetWidget::showTrace(const QByteArray &dump)
+{
+    QString error;
+
+    m_decoder.setCallbackNames(callbackNames());
+    if (!m_decoder.decode(dump, &error)) {
+        m_status->setText(error);
+        return;
+    }
+    m_dump = dump;
+    m_saveButton->setEnabled(true);
+
+    m_timeline->setObjectNames(objectNames());
+    m_timeline->setTrace(m_decoder.lanes(), m_decoder.marks(), m_decoder.duration());
+
+    m_tasks->clear();
+    for (int i = 0; i < m_decoder.lanes().size(); i++) {
+        const EventTraceLane &lane = m_decoder.lanes().at(i);
+        if (lane.kind == EventTraceLane::Task && !lane.latencies.isEmpty()) {
+            m_tasks->addItem(lane.name, i);
+        }
+    }
+
+    m_status->setText(tr("%1 records over %2 ms, %3 lost before them. Wheel zooms, drag pans, right click shows all, "
+                         "hovering an object access names the object.")
+                      .arg(m_decoder.records()).arg(m_decoder.duration() / 1000, 0, 'f', 3).arg(m_decoder.lost()));
+}
+
+void EventTraceGadgetWidget::taskSelected(int index)
+{
+    if (index < 0) {
+        m_histogram->setLatencies(QVector<double>());
+        return;
+    }
+    m_histogram->setLatencies(m_decoder.lanes().at(m_tasks->itemData(index).toInt()).latencies);
+}
+
+/**
+ * @}
+ * @}
+ */
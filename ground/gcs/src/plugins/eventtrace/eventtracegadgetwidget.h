@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracegadgetwidget.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Event trace gadget, timeline of the on board event trace
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACEGADGETWIDGET_H_
+#define EVENTTRACEGADGETWIDGET_H_
+
+#include "eventtracedecoder.h"
+
+#include <QMap>
+#include <QMutex>
+#include <QTimer>
+#include <QWidget>
+
+class QCheckBox;
+class QComboBox;
+class QLabel;
+class QPushButton;
+class EventTraceControl;
+class EventTraceData;
+class EventTraceHistogram;
+class EventTraceTimeline;
+class UAVObject;
+class UAVObjectManager;
+
+class EventTraceGadgetWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    EventTraceGadgetWidget(QWidget *parent = 0);
+    ~EventTraceGadgetWidget();
+
+private slots:
+    void startTrace();
+    void stopTrace();
+    void dumpTrace();
+    void openTrace();
+    void saveTrace();
+    void chunkReceived(UAVObject *object);
+    void chunksChanged();
+    void dumpTimeout();
+    void taskSelected(int index);
+
+private:
+    void sendOperation(quint8 operation);
+    void showTrace(const QByteArray &dump);
+    QStringList callbackNames();
+    QHash<quint32, QString> objectNames();
+
+    UAVObjectManager *m_objectManager;
+    EventTraceControl *m_control;
+    EventTraceData *m_data;
+
+    QList<QCheckBox *> m_mask;
+    QPushButton *m_saveButton;
+    QLabel *m_status;
+    EventTraceTimeline *m_timeline;
+    QComboBox *m_tasks;
+    EventTraceHistogram *m_histogram;
+
+    // chunks of the dump in progress, filled in the telemetry thread
+    QMutex m_chunkMutex;
+    QMap<int, QByteArray> m_chunks;
+    int m_chunkCount;
+    QTimer m_dumpTimer;
+
+    QByteArray m_dump;
+    EventTraceDecoder m_decoder;
+};
+
+#endif /* EVENTTRACEGADGETWIDGET_H_ */
@@ -0,0 +1,104 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracehistogram.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Histogram of the task scheduling latencies
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "eventtracehistogram.h"
+
+#include <QPainter>
+#include <qmath.h>
+
+#define BUCKETS       20 // up to 2^20 us, longer ones count in the last bucket
+#define MARGIN        20
+#define MAX_BAR_WIDTH 40
+
+EventTraceHistogram::EventTraceHistogram(QWidget *parent) : QWidget(parent),
+    m_buckets(BUCKETS, 0), m_count(0), m_max(0), m_mean(0)
+{
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
+}
+
+void EventTraceHistogram::setLatencies(const QVector<double> &latencies)
+{
+    m_buckets.fill(0);
+    m_count = latencies.size();
+    m_max   = 0;
+    m_mean  = 0;
+    foreach(double latency, latencies) {
+        int bucket = (latency < 1) ? 0 : qMin((int)log2(latency), BUCKETS - 1);
+        m_buckets[bucket]++;
+        m_max   = qMax(m_max, latency);
+        m_mean += latency;
+    }
+    if (m_count) {
+        m_mean /= m_count;
+    }
+    update();
+}
+
+QSize EventTraceHistogram::sizeHint() const
+{
+    return QSize(400, 160);
+}
+
+void EventTraceHistogram::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+    painter.setPen(palette().color(QPalette::Text));
+
+    if (!m_count) {
+        painter.drawText(rect(), Qt::AlignCenter, tr("No scheduling latencies, select a task of a trace"));
+        return;
+    }
+    painter.drawText(QRect(MARGIN, 0, width() - 2 * MARGIN, MARGIN), Qt::AlignVCenter | Qt::AlignLeft,
+                     tr("%1 wakeups, mean %2 us, max %3 us").arg(m_count).arg(m_mean, 0, 'f', 1).arg(m_max, 0, 'f', 1));
+
+    int most = 1;
+    foreach(int count, m_buckets) {
+        most = qMax(most, count);
+    }
+
+    int plotHeight = qMax(height() - 3 * MARGIN, 1);
+    int barWidth   = qMin((width() - 2 * MARGIN) / BUCKETS, MAX_BAR_WIDTH);
+    for (int i = 0; i < BUCKETS; i++) {
+        int x = MARGIN + i * barWidth;
+        int h = m_buckets[i] * plotHeight / most;
+        painter.fillRect(x + 1, height() - 2 * MARGIN - h, barWidth - 2, h, QColor(60, 120, 200));
+        if (i % 2 == 0) {
+            // lower bound of the bucket
+            painter.drawText(QRect(x, height() - 2 * MARGIN, 2 * barWidth, MARGIN), Qt::AlignCenter,
+                             (i < 10) ? QString::number(1 << i) : QString("%1k").arg((1 << i) / 1024));
+        }
+    }
+    painter.drawText(QRect(MARGIN, height() - MARGIN, width() - 2 * MARGIN, MARGIN), Qt::AlignCenter, tr("us, ready to running"));
+}
+
+/**
+ * @}
+ * @}
+ */
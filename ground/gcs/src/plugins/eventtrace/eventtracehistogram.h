@@ -0,0 +1,58 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracehistogram.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Histogram of the task scheduling latencies
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACEHISTOGRAM_H
+#define EVENTTRACEHISTOGRAM_H
+
+#include <QVector>
+#include <QWidget>
+
+/*
+ * Counts of the latencies in buckets of powers of two microseconds,
+ * the time a task waits from ready to running.
+ */
+class EventTraceHistogram : public QWidget {
+    Q_OBJECT
+
+public:
+    EventTraceHistogram(QWidget *parent = 0);
+
+    void setLatencies(const QVector<double> &latencies);
+
+    QSize sizeHint() const;
+
+protected:
+    void paintEvent(QPaintEvent *event);
+
+private:
+    QVector<int> m_buckets;
+    int m_count;
+    double m_max;
+    double m_mean;
+};
+
+#endif // EVENTTRACEHISTOGRAM_H
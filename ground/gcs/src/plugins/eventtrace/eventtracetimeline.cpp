@@ -0,0 +1,266 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracetimeline.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Zoomable timeline of the event trace lanes
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "eventtracetimeline.h"
+
+#include <QHelpEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QToolTip>
+#include <QWheelEvent>
+#include <qmath.h>
+
+#define LABEL_WIDTH    150
+#define AXIS_HEIGHT    20
+#define ROW_HEIGHT     16
+#define MIN_TICK_PIXELS 80
+#define MIN_SPAN_US    1.0
+#define MARK_PIXELS    3 // distance to a tick that still shows its tool tip
+
+EventTraceTimeline::EventTraceTimeline(QWidget *parent) : QWidget(parent),
+    m_duration(0), m_viewStart(0), m_viewSpan(1), m_dragX(0), m_dragStart(0)
+{
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
+}
+
+void EventTraceTimeline::setTrace(const QVector<EventTraceLane> &lanes, const QVector<EventTraceMark> &marks, double duration)
+{
+    m_lanes    = lanes;
+    m_marks    = marks;
+    m_duration = duration;
+    setMinimumHeight(sizeHint().height());
+    updateGeometry();
+    zoomAll();
+}
+
+void EventTraceTimeline::setObjectNames(const QHash<quint32, QString> &names)
+{
+    m_objectNames = names;
+}
+
+QSize EventTraceTimeline::sizeHint() const
+{
+    return QSize(600, AXIS_HEIGHT + (m_lanes.size() + 1) * ROW_HEIGHT + 2);
+}
+
+void EventTraceTimeline::zoomAll()
+{
+    m_viewStart = 0;
+    m_viewSpan  = qMax(m_duration, MIN_SPAN_US);
+    update();
+}
+
+int EventTraceTimeline::plotWidth() const
+{
+    return qMax(width() - LABEL_WIDTH, 1);
+}
+
+double EventTraceTimeline::timeAt(int x) const
+{
+    return m_viewStart + (x - LABEL_WIDTH) * m_viewSpan / plotWidth();
+}
+
+int EventTraceTimeline::xAt(double time) const
+{
+    return LABEL_WIDTH + qRound((time - m_viewStart) * plotWidth() / m_viewSpan);
+}
+
+void EventTraceTimeline::clampView()
+{
+    m_viewSpan  = qBound(MIN_SPAN_US, m_viewSpan, qMax(m_duration, MIN_SPAN_US));
+    m_viewStart = qBound(0.0, m_viewStart, qMax(m_duration - m_viewSpan, 0.0));
+}
+
+// the visible tick closest to pos on the row of the marks, -1 if none is close enough
+int EventTraceTimeline::markAt(const QPoint &pos) const
+{
+    int y        = AXIS_HEIGHT + m_lanes.size() * ROW_HEIGHT;
+    int closest  = -1;
+    int distance = MARK_PIXELS + 1;
+
+    if (pos.y() < y || pos.y() >= y + ROW_HEIGHT || pos.x() < LABEL_WIDTH) {
+        return -1;
+    }
+    for (int i = 0; i < m_marks.size(); i++) {
+        const EventTraceMark &mark = m_marks.at(i);
+        if (mark.time < m_viewStart || mark.time > m_viewStart + m_viewSpan) {
+            continue;
+        }
+        int d = qAbs(xAt(mark.time) - pos.x());
+        if (d < distance) {
+            closest  = i;
+            distance = d;
+        }
+    }
+    return closest;
+}
+
+QString EventTraceTimeline::markText(const EventTraceMark &mark) const
+{
+    QString time = tr("%1 us").arg(mark.time, 0, 'f', 1);
+
+    if (mark.type == EventTraceDecoder::MARKER_VALUE) {
+        return tr("Marker 0x%1 at %2").arg(mark.arg16, 4, 16, QChar('0')).arg(time);
+    }
+    QString name = m_objectNames.value(mark.object);
+    if (name.isEmpty()) {
+        name = mark.object ? tr("Object 0x%1").arg(mark.object, 8, 16, QChar('0')) : tr("Object not in the trace table");
+    }
+    return tr("%1 %2, instance %3 at %4").arg(name)
+           .arg(mark.type == EventTraceDecoder::OBJECT_SET ? tr("set") : tr("get"))
+           .arg(mark.arg8).arg(time);
+}
+
+bool EventTraceTimeline::event(QEvent *event)
+{
+    if (event->type() == QEvent::ToolTip) {
+        QHelpEvent *help = static_cast<QHelpEvent *>(event);
+        int index = markAt(help->pos());
+        if (index >= 0) {
+            QToolTip::showText(help->globalPos(), markText(m_marks.at(index)), this);
+        } else {
+            QToolTip::hideText();
+            event->ignore();
+        }
+        return true;
+    }
+    return QWidget::event(event);
+}
+
+void EventTraceTimeline::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+
+    // time axis, steps of 1, 2 or 5 times a power of ten
+    double step = qPow(10, qFloor(log10(m_viewSpan * MIN_TICK_PIXELS / plotWidth())));
+    if (step * 2 * plotWidth() / m_viewSpan >= MIN_TICK_PIXELS) {
+        step *= 2;
+    } else if (step * 5 * plotWidth() / m_viewSpan >= MIN_TICK_PIXELS) {
+        step *= 5;
+    } else {
+        step *= 10;
+    }
+    QString unit  = (step < 1e3) ? tr("us") : (step < 1e6) ? tr("ms") : tr("s");
+    double scale  = (step < 1e3) ? 1 : (step < 1e6) ? 1e3 : 1e6;
+    painter.setPen(palette().color(QPalette::Mid));
+    for (double t = qCeil(m_viewStart / step) * step; t <= m_viewStart + m_viewSpan; t += step) {
+        int x = xAt(t);
+        painter.drawLine(x, AXIS_HEIGHT - 4, x, height());
+        painter.drawText(x + 2, AXIS_HEIGHT - 6, QString("%1 %2").arg(t / scale).arg(unit));
+    }
+
+    static const QColor colors[] = { QColor(60, 120, 200), QColor(60, 170, 80), QColor(210, 70, 60), QColor(220, 150, 40) };
+
+    painter.setClipRect(0, AXIS_HEIGHT, width(), height() - AXIS_HEIGHT);
+    for (int i = 0; i < m_lanes.size(); i++) {
+        const EventTraceLane &lane = m_lanes.at(i);
+        int y = AXIS_HEIGHT + i * ROW_HEIGHT;
+
+        if (i % 2) {
+            painter.fillRect(0, y, width(), ROW_HEIGHT, palette().alternateBase());
+        }
+        painter.setPen(palette().color(QPalette::Text));
+        painter.drawText(QRect(4, y, LABEL_WIDTH - 8, ROW_HEIGHT), Qt::AlignVCenter | Qt::AlignLeft,
+                         QString("%1 %2%").arg(lane.name).arg(m_duration > 0 ? lane.busy * 100 / m_duration : 0, 0, 'f', 1));
+
+        // intervals narrower than a pixel still show, as one pixel
+        painter.save();
+        painter.setClipRect(LABEL_WIDTH, AXIS_HEIGHT, plotWidth(), height() - AXIS_HEIGHT);
+        QColor color = colors[lane.kind];
+        int lastX    = -1;
+        foreach(const EventTraceInterval &interval, lane.intervals) {
+            if (interval.end < m_viewStart || interval.start > m_viewStart + m_viewSpan) {
+                continue;
+            }
+            int x0 = xAt(interval.start);
+            int x1 = qMax(xAt(interval.end), x0 + 1);
+            if (x1 <= lastX) {
+                continue;
+            }
+            painter.fillRect(qMax(x0, lastX), y + 2, x1 - qMax(x0, lastX), ROW_HEIGHT - 4, color);
+            lastX = x1;
+        }
+        painter.restore();
+    }
+
+    // object accesses and marker values
+    int y = AXIS_HEIGHT + m_lanes.size() * ROW_HEIGHT;
+    painter.setPen(palette().color(QPalette::Text));
+    painter.drawText(QRect(4, y, LABEL_WIDTH - 8, ROW_HEIGHT), Qt::AlignVCenter | Qt::AlignLeft, tr("Objects, values"));
+    painter.setClipRect(LABEL_WIDTH, y, plotWidth(), ROW_HEIGHT);
+    foreach(const EventTraceMark &mark, m_marks) {
+        if (mark.time < m_viewStart || mark.time > m_viewStart + m_viewSpan) {
+            continue;
+        }
+        painter.setPen(mark.type == EventTraceDecoder::OBJECT_SET ? colors[0] :
+                       mark.type == EventTraceDecoder::OBJECT_GET ? palette().color(QPalette::Mid) : colors[3]);
+        int x = xAt(mark.time);
+        painter.drawLine(x, y + 2, x, y + ROW_HEIGHT - 2);
+    }
+}
+
+void EventTraceTimeline::wheelEvent(QWheelEvent *event)
+{
+    if (event->x() < LABEL_WIDTH) {
+        event->ignore();
+        return;
+    }
+    double anchor = timeAt(event->x());
+    double factor = qPow(1.25, -event->angleDelta().y() / 120.0);
+    m_viewSpan  *= factor;
+    m_viewStart  = anchor - (anchor - m_viewStart) * factor;
+    clampView();
+    update();
+    event->accept();
+}
+
+void EventTraceTimeline::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton) {
+        m_dragX     = event->x();
+        m_dragStart = m_viewStart;
+    } else if (event->button() == Qt::RightButton) {
+        zoomAll();
+    }
+}
+
+void EventTraceTimeline::mouseMoveEvent(QMouseEvent *event)
+{
+    if (event->buttons() & Qt::LeftButton) {
+        m_viewStart = m_dragStart - (event->x() - m_dragX) * m_viewSpan / plotWidth();
+        clampView();
+        update();
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,80 @@
+/**
+ ******************************************************************************
+ *
+ * @file       eventtracetimeline.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup EventTracePlugin Event Trace Plugin
+ * @{
+ * @brief Zoomable timeline of the event trace lanes
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTTRACETIMELINE_H
+#define EVENTTRACETIMELINE_H
+
+#include "eventtracedecoder.h"
+
+#include <QHash>
+#include <QWidget>
+
+/*
+ * One row per lane, the wheel zooms around the cursor and dragging pans.
+ * Object accesses and marker values are ticks on the last row, their tool
+ * tip names the object.
+ */
+class EventTraceTimeline : public QWidget {
+    Q_OBJECT
+
+public:
+    EventTraceTimeline(QWidget *parent = 0);
+
+    void setTrace(const QVector<EventTraceLane> &lanes, const QVector<EventTraceMark> &marks, double duration);
+    void setObjectNames(const QHash<quint32, QString> &names);
+
+    QSize sizeHint() const;
+
+public slots:
+    void zoomAll();
+
+protected:
+    bool event(QEvent *event);
+    void paintEvent(QPaintEvent *event);
+    void wheelEvent(QWheelEvent *event);
+    void mousePressEvent(QMouseEvent *event);
+    void mouseMoveEvent(QMouseEvent *event);
+
+private:
+    double timeAt(int x) const;
+    int xAt(double time) const;
+    int plotWidth() const;
+    void clampView();
+    int markAt(const QPoint &pos) const;
+    QString markText(const EventTraceMark &mark) const;
+
+    QVector<EventTraceLane> m_lanes;
+    QVector<EventTraceMark> m_marks;
+    QHash<quint32, QString> m_objectNames;
+    double m_duration;
+    double m_viewStart; // microseconds
+    double m_viewSpan;
+    int m_dragX;
+    double m_dragStart;
+};
+
+#endif // EVENTTRACETIMELINE_H
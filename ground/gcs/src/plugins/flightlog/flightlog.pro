@@ -11,11 +11,15 @@ include(../../plugins/uavtalk/uavtalk.pri)
 
 HEADERS += \
     flightlogplugin.h \
-    flightlogmanager.h
+    flightlogmanager.h \
+    flightlogstore.h \
+    flightlogexporter.h
 
 SOURCES += \
     flightlogplugin.cpp \
-    flightlogmanager.cpp
+    flightlogmanager.cpp \
+    flightlogstore.cpp \
+    flightlogexporter.cpp
 
 OTHER_FILES += \
     Flightlog.pluginspec \
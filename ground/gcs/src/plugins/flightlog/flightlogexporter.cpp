@@ -0,0 +1,446 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogexporter.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Exports downloaded log entries to OPL, CSV and XML files
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightlogexporter.h"
+
+#include <QRunnable>
+#include <QtEndian>
+#include <utils/crc.h>
+
+#include "uavobjectfield.h"
+
+// UAVTalk framing, see UAVTalk::transmitSingleObject()
+static const quint8 UAVTALK_SYNC_VAL      = 0x3C;
+static const quint8 UAVTALK_TYPE_OBJ      = 0x20;
+static const int UAVTALK_HEADER_LENGTH    = 10;
+static const int UAVTALK_CHECKSUM_LENGTH  = 1;
+
+static bool isObjectRecord(const FlightLogStore::Record &record)
+{
+    return record.type == DebugLogEntry::TYPE_UAVOBJECT || record.type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS;
+}
+
+static QString recordText(const FlightLogStore::Record &record)
+{
+    return QString::fromUtf8((const char *)record.data, qstrnlen((const char *)record.data, record.size));
+}
+
+/**
+ * Formats one chunk in a pool thread and hands it to run().
+ */
+class FlightLogExporter::FormatTask : public QRunnable {
+public:
+    FormatTask(FlightLogExporter *exporter, int chunk) : m_exporter(exporter), m_chunk(chunk)
+    {}
+
+    void run()
+    {
+        Chunk chunk;
+
+        if (!m_exporter->m_cancel.load()) {
+            m_exporter->formatChunk(m_chunk, chunk);
+        }
+        QMutexLocker locker(&m_exporter->m_mutex);
+        m_exporter->m_done.insert(m_chunk, chunk);
+        m_exporter->m_chunkDone.wakeAll();
+    }
+
+private:
+    FlightLogExporter *m_exporter;
+    int m_chunk;
+};
+
+FlightLogExporter::FlightLogExporter(const FlightLogStore *store, UAVObjectManager *objectManager, Format format,
+                                     const QString &fileName, bool adjustTimestamps) : QObject(),
+    m_store(store), m_objectManager(objectManager), m_format(format), m_fileName(fileName),
+    m_adjustTimestamps(adjustTimestamps), m_succeeded(false), m_cancel(0)
+{}
+
+FlightLogExporter::~FlightLogExporter()
+{
+    m_pool.waitForDone();
+    qDeleteAll(m_files);
+}
+
+/**
+ * Export the whole store, emits finished() when done.
+ * The store must not be modified until then.
+ */
+void FlightLogExporter::run()
+{
+    int count  = m_store->count();
+    int chunks = (count + CHUNK_RECORDS - 1) / CHUNK_RECORDS;
+    // enough chunks queued to keep every pool thread busy while one is written
+    int window = 2 * qMax(m_pool.maxThreadCount(), 1);
+    int queued = 0;
+    bool ok    = true;
+
+    for (int i = 0; i < count; i++) {
+        FlightLogStore::Record record = m_store->at(i);
+        if (!m_baseTimes.contains(record.flight)) {
+            m_baseTimes.insert(record.flight, record.flightTime);
+        }
+    }
+
+    if (m_format == FORMAT_CSV) {
+        QFile *file = openFile(m_fileName, 0);
+        ok = file && file->write("Flight\tFlight Time\tEntry\tData\n") > 0;
+    } else if (m_format == FORMAT_XML) {
+        QByteArray header;
+        {
+            QXmlStreamWriter xmlWriter(&header);
+            xmlWriter.setAutoFormatting(true);
+            xmlWriter.setAutoFormattingIndent(4);
+            xmlWriter.writeStartDocument("1.0", true);
+            xmlWriter.writeStartElement("logs");
+            xmlWriter.writeComment("This file was created by the flight log export in OpenPilot GCS.");
+        }
+        QFile *file = openFile(m_fileName, 0);
+        ok = file && file->write(header) == header.size();
+    }
+
+    for (int chunk = 0; ok && chunk < chunks; chunk++) {
+        while (queued < chunks && queued < chunk + window) {
+            m_pool.start(new FormatTask(this, queued++));
+        }
+        Chunk done;
+        {
+            QMutexLocker locker(&m_mutex);
+            while (!m_done.contains(chunk)) {
+                m_chunkDone.wait(&m_mutex);
+            }
+            done = m_done.take(chunk);
+        }
+        ok = !m_cancel.load() && writeChunk(done);
+    }
+
+    // the tasks still queued skip their chunk
+    if (!ok) {
+        m_cancel.store(1);
+    }
+    m_pool.waitForDone();
+    m_done.clear();
+
+    if (ok && m_format == FORMAT_XML) {
+        ok = m_files.value(m_fileName)->write("\n</logs>\n") > 0;
+    }
+    foreach(QFile * file, m_files) {
+        ok = file->flush() && ok;
+        file->close();
+    }
+    qDeleteAll(m_files);
+    m_files.clear();
+
+    m_succeeded = ok;
+    emit finished();
+}
+
+/**
+ * Stop the export, may be called from any thread.
+ */
+void FlightLogExporter::cancel()
+{
+    m_cancel.store(1);
+}
+
+/**
+ * Format the records of a chunk, called in a pool thread. Each call uses
+ * its own object clones, shared state is only read.
+ */
+void FlightLogExporter::formatChunk(int chunk, Chunk &out)
+{
+    ObjectCache objects;
+    int first = chunk * CHUNK_RECORDS;
+    int last  = qMin(first + CHUNK_RECORDS, m_store->count());
+
+    switch (m_format) {
+    case FORMAT_OPL:
+        for (int i = first; i < last; i++) {
+            FlightLogStore::Record record = m_store->at(i);
+            if (!isObjectRecord(record)) {
+                continue;
+            }
+            QString fileName = oplFileName(record.flight);
+            if (out.isEmpty() || out.last().fileName != fileName) {
+                Segment segment = { fileName, 0, QByteArray() };
+                out.append(segment);
+            }
+            formatOPL(record, out.last().data);
+        }
+        break;
+
+    case FORMAT_CSV:
+    {
+        Segment segment = { m_fileName, 0, QByteArray() };
+        for (int i = first; i < last; i++) {
+            formatCSV(m_store->at(i), objects, segment.data);
+        }
+        out.append(segment);
+        break;
+    }
+
+    case FORMAT_CSV_COLUMNS:
+    {
+        QHash<quint32, int> segments;
+        for (int i = first; i < last; i++) {
+            FlightLogStore::Record record = m_store->at(i);
+            UAVDataObject *object = isObjectRecord(record) ? unpack(record, objects) : 0;
+            if (!object) {
+                continue;
+            }
+            QHash<quint32, int>::const_iterator it = segments.constFind(record.objectId);
+            if (it == segments.constEnd()) {
+                Segment segment = { columnsFileName(record.objectId), record.objectId, QByteArray() };
+                it = segments.insert(record.objectId, out.size());
+                out.append(segment);
+            }
+            formatColumns(record, object, out[it.value()].data);
+        }
+        break;
+    }
+
+    case FORMAT_XML:
+    {
+        QByteArray data;
+        int start;
+        {
+            // nested in a dummy element so that the entries get the indentation
+            // they have in the file, the start tag is closed by the first entry
+            QXmlStreamWriter xmlWriter(&data);
+            xmlWriter.setAutoFormatting(true);
+            xmlWriter.setAutoFormattingIndent(4);
+            xmlWriter.writeStartElement("logs");
+            start = data.size() + 1;
+            for (int i = first; i < last; i++) {
+                formatXML(m_store->at(i), objects, xmlWriter);
+            }
+        }
+        Segment segment = { m_fileName, 0, data.mid(start) };
+        out.append(segment);
+        break;
+    }
+    }
+
+    qDeleteAll(objects);
+}
+
+/**
+ * A LogFile record holding the UAVTalk packet of the object, as
+ * UAVTalk::sendObject() writes it.
+ */
+void FlightLogExporter::formatOPL(const FlightLogStore::Record &record, QByteArray &out)
+{
+    UAVObject *object = m_objectManager->getObject(record.objectId);
+
+    if (!object) {
+        return;
+    }
+    qint32 length     = object->getNumBytes();
+    qint64 dataSize   = UAVTALK_HEADER_LENGTH + length + UAVTALK_CHECKSUM_LENGTH;
+    quint32 timeStamp = flightTime(record);
+
+    out.append((const char *)&timeStamp, sizeof(timeStamp));
+    out.append((const char *)&dataSize, sizeof(dataSize));
+
+    int start = out.size();
+    out.resize(start + dataSize);
+    quint8 *packet = (quint8 *)out.data() + start;
+    memset(packet, 0, dataSize);
+    packet[0] = UAVTALK_SYNC_VAL;
+    packet[1] = UAVTALK_TYPE_OBJ;
+    qToLittleEndian<quint16>(UAVTALK_HEADER_LENGTH + length, &packet[2]);
+    qToLittleEndian<quint32>(record.objectId, &packet[4]);
+    qToLittleEndian<quint16>(record.instanceId, &packet[8]);
+    memcpy(&packet[UAVTALK_HEADER_LENGTH], record.data, qMin<qint32>(record.size, length));
+    packet[UAVTALK_HEADER_LENGTH + length] = Utils::Crc::updateCRC(0, packet, UAVTALK_HEADER_LENGTH + length);
+}
+
+void FlightLogExporter::formatCSV(const FlightLogStore::Record &record, ObjectCache &objects, QByteArray &out)
+{
+    QString data;
+
+    if (record.type == DebugLogEntry::TYPE_TEXT) {
+        data = recordText(record);
+    } else if (isObjectRecord(record)) {
+        UAVDataObject *object = unpack(record, objects);
+        if (object) {
+            data = object->toString().replace("\n", "").replace("\t", "");
+        }
+    }
+    out.append(QString("%1\t%2\t%3\t%4\n").arg(record.flight + 1).arg(flightTime(record)).arg(record.entry).arg(data).toUtf8());
+}
+
+void FlightLogExporter::formatColumns(const FlightLogStore::Record &record, UAVDataObject *object, QByteArray &out)
+{
+    QStringList values;
+
+    values << QString::number(record.flight + 1) << QString::number(flightTime(record)) << QString::number(record.instanceId);
+    foreach(UAVObjectField * field, object->getFields()) {
+        quint32 elements = (field->getType() == UAVObjectField::STRING) ? 1 : field->getNumElements();
+        for (quint32 i = 0; i < elements; i++) {
+            values << field->getValue(i).toString();
+        }
+    }
+    out.append(values.join('\t').toUtf8());
+    out.append('\n');
+}
+
+void FlightLogExporter::formatXML(const FlightLogStore::Record &record, ObjectCache &objects, QXmlStreamWriter &xmlWriter)
+{
+    xmlWriter.writeStartElement("entry");
+    xmlWriter.writeAttribute("flight", QString::number(record.flight + 1));
+    xmlWriter.writeAttribute("flighttime", QString::number(flightTime(record)));
+    xmlWriter.writeAttribute("entry", QString::number(record.entry));
+    if (record.type == DebugLogEntry::TYPE_TEXT) {
+        xmlWriter.writeAttribute("type", "text");
+        xmlWriter.writeTextElement("message", recordText(record));
+    } else if (isObjectRecord(record)) {
+        xmlWriter.writeAttribute("type", "uavobject");
+        UAVDataObject *object = unpack(record, objects);
+        if (object) {
+            object->toXML(&xmlWriter);
+        }
+    }
+    xmlWriter.writeEndElement(); // entry
+}
+
+/**
+ * Unpack a record into a clone of its object, kept for the next records
+ * of the chunk. Data shorter than the object, as logged by older
+ * firmware, is zero padded.
+ * @return the clone or NULL if the object is not known
+ */
+UAVDataObject *FlightLogExporter::unpack(const FlightLogStore::Record &record, ObjectCache &objects)
+{
+    QPair<quint32, quint16> key(record.objectId, record.instanceId);
+    UAVDataObject *object = objects.value(key);
+
+    if (!object) {
+        UAVDataObject *type = qobject_cast<UAVDataObject *>(m_objectManager->getObject(record.objectId));
+        if (!type) {
+            return NULL;
+        }
+        object = type->clone(record.instanceId);
+        objects.insert(key, object);
+    }
+
+    if (record.size >= object->getNumBytes()) {
+        object->unpack(record.data);
+    } else {
+        QByteArray data((const char *)record.data, record.size);
+        data.append(QByteArray(object->getNumBytes() - record.size, 0));
+        object->unpack((const quint8 *)data.constData());
+    }
+    return object;
+}
+
+quint32 FlightLogExporter::flightTime(const FlightLogStore::Record &record) const
+{
+    return m_adjustTimestamps ? record.flightTime - m_baseTimes.value(record.flight) : record.flightTime;
+}
+
+bool FlightLogExporter::writeChunk(const Chunk &chunk)
+{
+    foreach(const Segment &segment, chunk) {
+        if (segment.data.isEmpty()) {
+            continue;
+        }
+        QFile *file = openFile(segment.fileName, segment.objectId);
+        if (!file || file->write(segment.data) != segment.data.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * The open file of that name, created on first use.
+ */
+QFile *FlightLogExporter::openFile(const QString &fileName, quint32 objectId)
+{
+    QFile *file = m_files.value(fileName);
+
+    if (file) {
+        return file;
+    }
+    file = new QFile(fileName);
+    if (!file->open(QFile::WriteOnly | QFile::Truncate)) {
+        delete file;
+        return NULL;
+    }
+    if (m_format == FORMAT_CSV_COLUMNS && file->write(columnsHeader(objectId)) < 0) {
+        delete file;
+        return NULL;
+    }
+    m_files.insert(fileName, file);
+    m_fileNames << fileName;
+    return file;
+}
+
+QByteArray FlightLogExporter::columnsHeader(quint32 objectId)
+{
+    UAVObject *object = m_objectManager->getObject(objectId);
+    QStringList columns;
+
+    columns << "Flight" << "Flight Time" << "Instance";
+    foreach(UAVObjectField * field, object->getFields()) {
+        if (field->getNumElements() == 1 || field->getType() == UAVObjectField::STRING) {
+            columns << field->getName();
+        } else {
+            foreach(const QString &element, field->getElementNames()) {
+                columns << field->getName() + "." + element;
+            }
+        }
+    }
+    return (columns.join('\t') + '\n').toUtf8();
+}
+
+/**
+ * name.opl becomes name_flight-<n>.opl
+ */
+QString FlightLogExporter::oplFileName(quint16 flight) const
+{
+    QString fileName(m_fileName);
+
+    return fileName.replace(QString(".opl"), QString("_flight-%1.opl").arg(flight + 1));
+}
+
+/**
+ * name.csv becomes name_<object>.csv
+ */
+QString FlightLogExporter::columnsFileName(quint32 objectId) const
+{
+    QString fileName(m_fileName);
+    UAVObject *object = m_objectManager->getObject(objectId);
+
+    return fileName.replace(QString(".csv"), QString("_%1.csv").arg(object->getName()));
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,140 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogexporter.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Exports downloaded log entries to OPL, CSV and XML files
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTLOGEXPORTER_H
+#define FLIGHTLOGEXPORTER_H
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThreadPool>
+#include <QAtomicInt>
+#include <QStringList>
+#include <QXmlStreamWriter>
+
+#include "flightlogstore.h"
+#include "uavobjectmanager.h"
+#include "uavdataobject.h"
+
+/**
+ * Writes the records of a FlightLogStore to files.
+ *
+ * The records are cut in chunks formatted by a thread pool, each task with
+ * its own object clones. The chunks are written in order by the thread
+ * calling run(), no more than a few of them are held in memory at once.
+ *
+ * Formats:
+ * - OPL, one UAVTalk log per flight, the packets are built from the raw data
+ * - CSV, one line per record, as the object browser shows them
+ * - CSV_COLUMNS, one file per object with one column per field element
+ * - XML
+ */
+class FlightLogExporter : public QObject {
+    Q_OBJECT
+
+public:
+    enum Format { FORMAT_OPL, FORMAT_CSV, FORMAT_CSV_COLUMNS, FORMAT_XML };
+
+    FlightLogExporter(const FlightLogStore *store, UAVObjectManager *objectManager, Format format,
+                      const QString &fileName, bool adjustTimestamps);
+    ~FlightLogExporter();
+
+    bool succeeded() const
+    {
+        return m_succeeded;
+    }
+
+    QStringList fileNames() const
+    {
+        return m_fileNames;
+    }
+
+public slots:
+    void run();
+    void cancel();
+
+signals:
+    void finished();
+
+private:
+    // formatted data of a chunk going to one file
+    struct Segment {
+        QString fileName;
+        quint32 objectId; // CSV_COLUMNS only, for the header of a new file
+        QByteArray data;
+    };
+    typedef QList<Segment> Chunk;
+    typedef QHash<QPair<quint32, quint16>, UAVDataObject *> ObjectCache;
+
+    class FormatTask;
+
+    static const int CHUNK_RECORDS = 1024;
+
+    const FlightLogStore *m_store;
+    UAVObjectManager *m_objectManager;
+    Format m_format;
+    QString m_fileName;
+    bool m_adjustTimestamps;
+    bool m_succeeded;
+    QAtomicInt m_cancel;
+    QHash<quint16, quint32> m_baseTimes; // first flight time of each flight
+    QThreadPool m_pool;
+
+    // chunks formatted and not written yet, shared with the pool threads
+    QMutex m_mutex;
+    QWaitCondition m_chunkDone;
+    QHash<int, Chunk> m_done;
+
+    // used by run() only
+    QHash<QString, QFile *> m_files;
+    QStringList m_fileNames;
+
+    void formatChunk(int chunk, Chunk &out);
+    void formatOPL(const FlightLogStore::Record &record, QByteArray &out);
+    void formatCSV(const FlightLogStore::Record &record, ObjectCache &objects, QByteArray &out);
+    void formatColumns(const FlightLogStore::Record &record, UAVDataObject *object, QByteArray &out);
+    void formatXML(const FlightLogStore::Record &record, ObjectCache &objects, QXmlStreamWriter &xmlWriter);
+    UAVDataObject *unpack(const FlightLogStore::Record &record, ObjectCache &objects);
+    quint32 flightTime(const FlightLogStore::Record &record) const;
+
+    bool writeChunk(const Chunk &chunk);
+    QFile *openFile(const QString &fileName, quint32 objectId);
+    QByteArray columnsHeader(quint32 objectId);
+    QString oplFileName(quint16 flight) const;
+    QString columnsFileName(quint32 objectId) const;
+};
+
+#endif // FLIGHTLOGEXPORTER_H
+
+/**
+ * @}
+ * @}
+ */
@@ -31,18 +31,22 @@
 #include <QApplication>
 #include <QFileDialog>
 #include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 #include <QMessageBox>
 #include <QDebug>
+#include <QEventLoop>
+#include <QElapsedTimer>
+#include <QTimer>
 
 #include "debuglogcontrol.h"
 #include "uavobjecthelper.h"
-#include "uavtalk/uavtalk.h"
-#include "utils/logfile.h"
 #include "uavdataobject.h"
 #include <uavobjectutil/uavobjectutilmanager.h>
 
 FlightLogManager::FlightLogManager(QObject *parent) :
-    QObject(parent), m_disableControls(false),
+    QObject(parent),
+    m_exporter(0), m_streamParser(0), m_streamFlight(0), m_streamEnd(-1), m_streamWindowLast(0),
+    m_streamWindowDone(false), m_streamBytes(0), m_disableControls(false),
     m_disableExport(true), m_cancelDownload(false),
     m_adjustExportedTimestamps(true)
 {
@@ -88,9 +92,7 @@ FlightLogManager::FlightLogManager(QObject *parent) :
 
 FlightLogManager::~FlightLogManager()
 {
-    while (!m_logEntries.isEmpty()) {
-        delete m_logEntries.takeFirst();
-    }
+    qDeleteAll(m_logEntryObjects);
     while (!m_uavoEntries.isEmpty()) {
         delete m_uavoEntries.takeFirst();
     }
@@ -104,22 +106,39 @@ void addLogEntries(QQmlListProperty<ExtendedDebugLogEntry> *list, ExtendedDebugL
 
 int countLogEntries(QQmlListProperty<ExtendedDebugLogEntry> *list)
 {
-    return static_cast< QList<ExtendedDebugLogEntry *> *>(list->data)->size();
+    return static_cast<FlightLogManager *>(list->data)->logEntriesCount();
 }
 
 ExtendedDebugLogEntry *logEntryAt(QQmlListProperty<ExtendedDebugLogEntry> *list, int index)
 {
-    return static_cast< QList<ExtendedDebugLogEntry *> *>(list->data)->at(index);
+    return static_cast<FlightLogManager *>(list->data)->logEntry(index);
 }
 
 void clearLogEntries(QQmlListProperty<ExtendedDebugLogEntry> *list)
 {
-    return static_cast< QList<ExtendedDebugLogEntry *> *>(list->data)->clear();
+    Q_UNUSED(list);
 }
 
 QQmlListProperty<ExtendedDebugLogEntry> FlightLogManager::logEntries()
 {
-    return QQmlListProperty<ExtendedDebugLogEntry>(this, &m_logEntries, &addLogEntries, &countLogEntries, &logEntryAt, &clearLogEntries);
+    return QQmlListProperty<ExtendedDebugLogEntry>(this, this, &addLogEntries, &countLogEntries, &logEntryAt, &clearLogEntries);
+}
+
+/**
+ * The entry object of a record, created when the view first asks for it.
+ */
+ExtendedDebugLogEntry *FlightLogManager::logEntry(int index)
+{
+    ExtendedDebugLogEntry *entry = m_logEntryObjects.value(index);
+
+    if (!entry && index >= 0 && index < m_logStore.count()) {
+        DebugLogEntry::DataFields fields;
+        m_logStore.at(index).toFields(fields);
+        entry = new ExtendedDebugLogEntry();
+        entry->setData(fields, m_objectManager);
+        m_logEntryObjects.insert(index, entry);
+    }
+    return entry;
 }
 
 void addUAVOEntries(QQmlListProperty<UAVOLogSettingsWrapper> *list, UAVOLogSettingsWrapper *entry)
@@ -175,15 +194,15 @@ void FlightLogManager::clearAllLogs()
 
 void FlightLogManager::clearLogList()
 {
-    QList<ExtendedDebugLogEntry *> tmpList(m_logEntries);
-    m_logEntries.clear();
+    QHash<int, ExtendedDebugLogEntry *> tmpObjects;
+
+    tmpObjects.swap(m_logEntryObjects);
+    m_logStore.clear();
 
     emit logEntriesChanged();
     setDisableExport(true);
 
-    while (!tmpList.isEmpty()) {
-        delete tmpList.takeFirst();
-    }
+    qDeleteAll(tmpObjects);
 }
 
 void FlightLogManager::retrieveLogs(int flightToRetrieve)
@@ -191,8 +210,6 @@ void FlightLogManager::retrieveLogs(int flightToRetrieve)
     setDisableControls(true);
     QApplication::setOverrideCursor(Qt::WaitCursor);
     m_cancelDownload = false;
-    UAVObjectUpdaterHelper updateHelper;
-    UAVObjectRequestHelper requestHelper;
 
     clearLogList();
 
@@ -200,181 +217,216 @@ void FlightLogManager::retrieveLogs(int flightToRetrieve)
     int startFlight = (flightToRetrieve == -1) ? 0 : flightToRetrieve;
     int endFlight   = (flightToRetrieve == -1) ? m_flightLogStatus->getFlight() : flightToRetrieve;
 
-    // Prepare to send request for event retrieval
-    m_flightLogControl->setOperation(DebugLogControl::OPERATION_RETRIEVE);
-    for (int flight = startFlight; flight <= endFlight; flight++) {
-        m_flightLogControl->setFlight(flight);
-        bool gotLast = false;
-        int slot     = 0;
-        while (!gotLast) {
-            // Send request for loading flight entry on flight side and wait for ack/nack
-            m_flightLogControl->setEntry(slot);
-
-            if (updateHelper.doObjectAndWait(m_flightLogControl, UAVTALK_TIMEOUT) == UAVObjectUpdaterHelper::SUCCESS &&
-                requestHelper.doObjectAndWait(m_flightLogEntry, UAVTALK_TIMEOUT) == UAVObjectUpdaterHelper::SUCCESS) {
-                if (m_flightLogEntry->getType() != DebugLogEntry::TYPE_EMPTY) {
-                    // Ok, we retrieved the entry, and it was the correct one. clone it and add it to the list
-                    ExtendedDebugLogEntry *logEntry = new ExtendedDebugLogEntry();
-
-                    logEntry->setData(m_flightLogEntry->getData(), m_objectManager);
-                    m_logEntries << logEntry;
-                    if (logEntry->getData().Type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-                        const quint32 total_len  = sizeof(DebugLogEntry::DataFields);
-                        const quint32 data_len   = sizeof(((DebugLogEntry::DataFields *)0)->Data);
-                        const quint32 header_len = total_len - data_len;
-
-                        DebugLogEntry::DataFields fields;
-                        quint32 start = logEntry->getData().Size;
-
-                        // cycle until there is space for another object
-                        while (start + header_len + 1 < data_len) {
-                            memset(&fields, 0xFF, total_len);
-                            memcpy(&fields, &logEntry->getData().Data[start], header_len);
-                            // check wether a packed object is found
-                            // note that empty data blocks are set as 0xFF in flight side to minimize flash wearing
-                            // thus as soon as this read outside of used area, the test will fail as lenght would be 0xFFFF
-                            quint32 toread = header_len + fields.Size;
-                            if (!(toread + start > data_len)) {
-                                memcpy(&fields, &logEntry->getData().Data[start], toread);
-                                ExtendedDebugLogEntry *subEntry = new ExtendedDebugLogEntry();
-                                subEntry->setData(fields, m_objectManager);
-                                m_logEntries << subEntry;
-                            }
-                            start += toread;
-                        }
-                    }
+    // The entries are parsed in a worker thread while the next ones are downloaded
+    QThread parserThread;
+    FlightLogParser *parser = new FlightLogParser();
+    parser->moveToThread(&parserThread);
+    parserThread.start();
 
-                    // Increment to get next entry from flight side
-                    slot++;
-                } else {
-                    // We are done, not more entries on this flight
-                    gotLast = true;
-                }
-            } else {
-                // We failed for some reason
-                break;
-            }
-            if (m_cancelDownload) {
-                break;
-            }
-        }
-        if (m_cancelDownload) {
+    {
+        QMutexLocker locker(&m_streamMutex);
+        m_streamParser = parser;
+        m_streamBytes  = 0;
+    }
+    // direct, the entries are copied in the telemetry thread as soon as they are unpacked
+    connect(m_flightLogEntry, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(logEntryReceived(UAVObject *)), Qt::DirectConnection);
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+    int period = STREAM_START_PERIOD_MS;
+    for (int flight = startFlight; flight <= endFlight && !m_cancelDownload; flight++) {
+        if (!retrieveFlight(flight, &period)) {
+            // We failed for some reason
             break;
         }
     }
 
+    disconnect(m_flightLogEntry, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(logEntryReceived(UAVObject *)));
+    quint64 bytes;
+    {
+        QMutexLocker locker(&m_streamMutex);
+        m_streamParser = 0;
+        bytes = m_streamBytes;
+    }
+
+    QMetaObject::invokeMethod(parser, "finish", Qt::BlockingQueuedConnection);
+    m_logStore = parser->takeStore();
+    parserThread.quit();
+    parserThread.wait();
+    delete parser;
+
+    qint64 ms = qMax<qint64>(elapsed.elapsed(), 1);
+    qDebug() << "FlightLogManager: retrieved" << m_logStore.count() << "records," << bytes << "bytes in"
+             << ms << "ms," << bytes * 1000 / ms << "bytes/s, final period" << period << "ms,"
+             << m_logStore.memoryUsed() << "bytes stored";
+
     if (m_cancelDownload) {
         clearLogList();
         m_cancelDownload = false;
     }
 
     emit logEntriesChanged();
-    setDisableExport(m_logEntries.count() == 0);
+    setDisableExport(m_logStore.isEmpty());
 
     QApplication::restoreOverrideCursor();
     setDisableControls(false);
 }
 
-void FlightLogManager::exportToOPL(QString fileName)
+/**
+ * Download the entries of a flight in windows. The board pushes the entries of
+ * a window without waiting for acks, requesting the next window acknowledges
+ * the previous one and the entries that were missed are requested again.
+ * The push period follows the link: doubled when entries were lost, reduced
+ * slowly while none are.
+ * @return false if the board stopped answering
+ */
+bool FlightLogManager::retrieveFlight(quint16 flight, int *period)
 {
-    // Fix the file name
-    fileName.replace(QString(".opl"), QString("%1.opl"));
+    UAVObjectUpdaterHelper updateHelper;
+    int base    = 0;
+    int retries = 0;
+
+    {
+        QMutexLocker locker(&m_streamMutex);
+        m_streamFlight = flight;
+        m_streamReceived.clear();
+        m_streamEnd    = -1;
+    }
 
-    // Loop and create a new file for each flight.
-    int currentEntry  = 0;
-    int currentFlight = 0;
-    quint32 adjustedBaseTime = 0;
-    // Continue until all entries are exported
-    while (currentEntry < m_logEntries.count()) {
-        if (m_adjustExportedTimestamps) {
-            adjustedBaseTime = m_logEntries[currentEntry]->getFlightTime();
+    while (!m_cancelDownload) {
+        int count;
+        {
+            QMutexLocker locker(&m_streamMutex);
+            while (m_streamReceived.contains(base)) {
+                base++;
+            }
+            if (m_streamEnd >= 0 && base >= m_streamEnd) {
+                return true;
+            }
+            // stop the window at the next entry already received
+            count = STREAM_WINDOW;
+            for (int i = 1; i < count; i++) {
+                if ((m_streamEnd >= 0 && base + i >= m_streamEnd) || m_streamReceived.contains(base + i)) {
+                    count = i;
+                    break;
+                }
+            }
+            m_streamWindowLast = base + count - 1;
+            m_streamWindowDone = false;
         }
 
-        // Get current flight
-        currentFlight = m_logEntries[currentEntry]->getFlight();
-
-        LogFile logFile;
-        logFile.useProvidedTimeStamp(true);
+        QEventLoop loop;
+        QTimer timeout;
+        timeout.setSingleShot(true);
+        connect(&timeout, SIGNAL(timeout()), &loop, SLOT(quit()));
+        connect(this, SIGNAL(streamWindowDone()), &loop, SLOT(quit()));
 
-        // Set the file name to contain flight number
-        logFile.setFileName(fileName.arg(tr("_flight-%1").arg(currentFlight + 1)));
-        logFile.open(QIODevice::WriteOnly);
-        UAVTalk uavTalk(&logFile, m_objectManager);
-
-        // Export entries until no more available or flight changes
-        while (currentEntry < m_logEntries.count() && m_logEntries[currentEntry]->getFlight() == currentFlight) {
-            ExtendedDebugLogEntry *entry = m_logEntries[currentEntry];
+        m_flightLogControl->setOperation(DebugLogControl::OPERATION_STREAM);
+        m_flightLogControl->setFlight(flight);
+        m_flightLogControl->setEntry(base);
+        m_flightLogControl->setCount(count);
+        m_flightLogControl->setPeriod(*period);
+        if (updateHelper.doObjectAndWait(m_flightLogControl, UAVTALK_TIMEOUT) != UAVObjectUpdaterHelper::SUCCESS) {
+            return false;
+        }
 
-            // Only log uavobjects
-            if (entry->getType() == ExtendedDebugLogEntry::TYPE_UAVOBJECT || entry->getType() == ExtendedDebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-                // Set timestamp that should be logged for this entry
-                logFile.setNextTimeStamp(entry->getFlightTime() - adjustedBaseTime);
+        bool done;
+        {
+            QMutexLocker locker(&m_streamMutex);
+            done = m_streamWindowDone;
+        }
+        if (!done) {
+            timeout.start(count * *period + STREAM_WINDOW_TIMEOUT);
+            loop.exec();
+        }
 
-                // Use UAVTalk to log complete message to file
-                uavTalk.sendObject(entry->uavObject(), false, false);
-                qDebug() << entry->getFlightTime() - adjustedBaseTime << "=" << entry->toStringBrief();
+        int missing = 0;
+        {
+            QMutexLocker locker(&m_streamMutex);
+            for (int i = base; i < base + count && (m_streamEnd < 0 || i < m_streamEnd); i++) {
+                if (!m_streamReceived.contains(i)) {
+                    missing++;
+                }
+            }
+            if (m_streamEnd == base) {
+                // the flight has no more entries
+                return true;
             }
-            currentEntry++;
         }
 
-        logFile.close();
+        if (missing) {
+            *period = qMin(*period * 2, (int)STREAM_MAX_PERIOD_MS);
+            if (missing == count && ++retries > STREAM_RETRIES) {
+                return false;
+            }
+        } else {
+            *period = qMax(*period - qMax(*period / 8, 1), (int)STREAM_MIN_PERIOD_MS);
+            retries = 0;
+        }
     }
+    return false;
 }
 
-void FlightLogManager::exportToCSV(QString fileName)
+/**
+ * Called in the telemetry thread for each DebugLogEntry received.
+ */
+void FlightLogManager::logEntryReceived(UAVObject *object)
 {
-    QFile csvFile(fileName);
+    Q_UNUSED(object);
 
-    if (csvFile.open(QFile::WriteOnly | QFile::Truncate)) {
-        QTextStream csvStream(&csvFile);
-        quint32 baseTime = 0;
-        quint32 currentFlight = 0;
-        csvStream << "Flight" << '\t' << "Flight Time" << '\t' << "Entry" << '\t' << "Data" << '\n';
-        foreach(ExtendedDebugLogEntry * entry, m_logEntries) {
-            if (m_adjustExportedTimestamps && entry->getFlight() != currentFlight) {
-                currentFlight = entry->getFlight();
-                baseTime = entry->getFlightTime();
-            }
-            entry->toCSV(&csvStream, baseTime);
+    DebugLogEntry::DataFields data = m_flightLogEntry->getData();
+    QMutexLocker locker(&m_streamMutex);
+
+    if (!m_streamParser || data.Flight != m_streamFlight) {
+        return;
+    }
+    if (data.Type == DebugLogEntry::TYPE_EMPTY) {
+        if (m_streamEnd < 0 || data.Entry < m_streamEnd) {
+            m_streamEnd = data.Entry;
         }
-        csvStream.flush();
-        csvFile.flush();
-        csvFile.close();
+    } else if (!m_streamReceived.contains(data.Entry)) {
+        m_streamReceived.insert(data.Entry);
+        m_streamBytes += sizeof(data);
+        QMetaObject::invokeMethod(m_streamParser, "parse", Qt::QueuedConnection,
+                                  Q_ARG(QByteArray, QByteArray((const char *)&data, sizeof(data))));
+    }
+    if (!m_streamWindowDone && (data.Type == DebugLogEntry::TYPE_EMPTY || data.Entry >= m_streamWindowLast)) {
+        m_streamWindowDone = true;
+        emit streamWindowDone();
     }
 }
 
-void FlightLogManager::exportToXML(QString fileName)
+/**
+ * Run an export in a worker thread, the GUI stays responsive meanwhile.
+ * @return false if the export failed or was canceled
+ */
+bool FlightLogManager::exportToFile(FlightLogExporter::Format format, const QString &fileName)
 {
-    QFile xmlFile(fileName);
+    QThread exportThread;
+    QEventLoop loop;
+    QElapsedTimer elapsed;
+    FlightLogExporter exporter(&m_logStore, m_objectManager, format, fileName, m_adjustExportedTimestamps);
 
-    if (xmlFile.open(QFile::WriteOnly | QFile::Truncate)) {
-        QXmlStreamWriter xmlWriter(&xmlFile);
-        xmlWriter.setAutoFormatting(true);
-        xmlWriter.setAutoFormattingIndent(4);
+    exporter.moveToThread(&exportThread);
+    connect(&exportThread, SIGNAL(started()), &exporter, SLOT(run()));
+    connect(&exporter, SIGNAL(finished()), &loop, SLOT(quit()));
 
-        xmlWriter.writeStartDocument("1.0", true);
-        xmlWriter.writeStartElement("logs");
-        xmlWriter.writeComment("This file was created by the flight log export in OpenPilot GCS.");
+    elapsed.start();
+    m_exporter = &exporter;
+    exportThread.start();
+    loop.exec();
+    exportThread.quit();
+    exportThread.wait();
+    m_exporter = 0;
 
-        quint32 baseTime = 0;
-        quint32 currentFlight = 0;
-        foreach(ExtendedDebugLogEntry * entry, m_logEntries) {
-            if (m_adjustExportedTimestamps && entry->getFlight() != currentFlight) {
-                currentFlight = entry->getFlight();
-                baseTime = entry->getFlightTime();
-            }
-            entry->toXML(&xmlWriter, baseTime);
-        }
-        xmlWriter.writeEndElement();
-        xmlWriter.writeEndDocument();
-        xmlFile.flush();
-        xmlFile.close();
-    }
+    qDebug() << "FlightLogManager: exported" << m_logStore.count() << "records to" << exporter.fileNames().count()
+             << "files in" << elapsed.elapsed() << "ms";
+    return exporter.succeeded();
 }
 
 void FlightLogManager::exportLogs()
 {
-    if (m_logEntries.isEmpty()) {
+    if (m_logStore.isEmpty()) {
         return;
     }
 
@@ -383,29 +435,41 @@ void FlightLogManager::exportLogs()
 
     QString oplFilter = tr("OpenPilot Log file %1").arg("(*.opl)");
     QString csvFilter = tr("Text file %1").arg("(*.csv)");
+    QString columnsFilter = tr("Text file per object %1").arg("(*.csv)");
     QString xmlFilter = tr("XML file %1").arg("(*.xml)");
 
     QString selectedFilter = csvFilter;
 
     QString fileName = QFileDialog::getSaveFileName(NULL, tr("Save Log Entries"), QDir::homePath(),
-                                                    QString("%1;;%2;;%3").arg(oplFilter, csvFilter, xmlFilter), &selectedFilter);
+                                                    QString("%1;;%2;;%3;;%4").arg(oplFilter, csvFilter, columnsFilter, xmlFilter), &selectedFilter);
     if (!fileName.isEmpty()) {
+        m_cancelDownload = false;
+        bool ok = true;
         if (selectedFilter == oplFilter) {
             if (!fileName.endsWith(".opl")) {
                 fileName.append(".opl");
             }
-            exportToOPL(fileName);
+            ok = exportToFile(FlightLogExporter::FORMAT_OPL, fileName);
         } else if (selectedFilter == csvFilter) {
             if (!fileName.endsWith(".csv")) {
                 fileName.append(".csv");
             }
-            exportToCSV(fileName);
+            ok = exportToFile(FlightLogExporter::FORMAT_CSV, fileName);
+        } else if (selectedFilter == columnsFilter) {
+            if (!fileName.endsWith(".csv")) {
+                fileName.append(".csv");
+            }
+            ok = exportToFile(FlightLogExporter::FORMAT_CSV_COLUMNS, fileName);
         } else if (selectedFilter == xmlFilter) {
             if (!fileName.endsWith(".xml")) {
                 fileName.append(".xml");
             }
-            exportToXML(fileName);
+            ok = exportToFile(FlightLogExporter::FORMAT_XML, fileName);
+        }
+        if (!ok && !m_cancelDownload) {
+            QMessageBox::warning(NULL, tr("Export failed"), tr("The log entries could not be written to %1.").arg(fileName), QMessageBox::Ok);
         }
+        m_cancelDownload = false;
     }
 
     QApplication::restoreOverrideCursor();
@@ -415,6 +479,9 @@ void FlightLogManager::exportLogs()
 void FlightLogManager::cancelExportLogs()
 {
     m_cancelDownload = true;
+    if (m_exporter) {
+        m_exporter->cancel();
+    }
 }
 
 void FlightLogManager::loadSettings()
@@ -648,34 +715,6 @@ QString ExtendedDebugLogEntry::getLogString()
     }
 }
 
-void ExtendedDebugLogEntry::toXML(QXmlStreamWriter *xmlWriter, quint32 baseTime)
-{
-    xmlWriter->writeStartElement("entry");
-    xmlWriter->writeAttribute("flight", QString::number(getFlight() + 1));
-    xmlWriter->writeAttribute("flighttime", QString::number(getFlightTime() - baseTime));
-    xmlWriter->writeAttribute("entry", QString::number(getEntry()));
-    if (getType() == DebugLogEntry::TYPE_TEXT) {
-        xmlWriter->writeAttribute("type", "text");
-        xmlWriter->writeTextElement("message", QString((const char *)getData().Data));
-    } else if (getType() == DebugLogEntry::TYPE_UAVOBJECT || getType() == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-        xmlWriter->writeAttribute("type", "uavobject");
-        m_object->toXML(xmlWriter);
-    }
-    xmlWriter->writeEndElement(); // entry
-}
-
-void ExtendedDebugLogEntry::toCSV(QTextStream *csvStream, quint32 baseTime)
-{
-    QString data;
-
-    if (getType() == DebugLogEntry::TYPE_TEXT) {
-        data = QString((const char *)getData().Data);
-    } else if (getType() == DebugLogEntry::TYPE_UAVOBJECT || getType() == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-        data = m_object->toString().replace("\n", "").replace("\t", "");
-    }
-    *csvStream << QString::number(getFlight() + 1) << '\t' << QString::number(getFlightTime() - baseTime) << '\t' << QString::number(getEntry()) << '\t' << data << '\n';
-}
-
 void ExtendedDebugLogEntry::setData(const DebugLogEntry::DataFields &data, UAVObjectManager *objectManager)
 {
     DebugLogEntry::setData(data);
@@ -688,6 +727,73 @@ void ExtendedDebugLogEntry::setData(const DebugLogEntry::DataFields &data, UAVOb
     }
 }
 
+FlightLogParser::FlightLogParser() : QObject()
+{}
+
+FlightLogParser::~FlightLogParser()
+{}
+
+/**
+ * Parse a raw DebugLogEntry::DataFields, splitting the entries holding
+ * several objects.
+ */
+void FlightLogParser::parse(QByteArray entry)
+{
+    DebugLogEntry::DataFields data;
+
+    Q_ASSERT(entry.size() == sizeof(data));
+    memcpy(&data, entry.constData(), sizeof(data));
+
+    FlightLogStore &records = m_entries[((quint32)data.Flight << 16) | data.Entry];
+    records.append(data);
+
+    if (data.Type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
+        const quint32 total_len  = sizeof(DebugLogEntry::DataFields);
+        const quint32 data_len   = sizeof(((DebugLogEntry::DataFields *)0)->Data);
+        const quint32 header_len = total_len - data_len;
+
+        DebugLogEntry::DataFields fields;
+        quint32 start = data.Size;
+
+        // cycle until there is space for another object
+        while (start + header_len + 1 < data_len) {
+            memset(&fields, 0xFF, total_len);
+            memcpy(&fields, &data.Data[start], header_len);
+            // check wether a packed object is found
+            // note that empty data blocks are set as 0xFF in flight side to minimize flash wearing
+            // thus as soon as this read outside of used area, the test will fail as lenght would be 0xFFFF
+            quint32 toread = header_len + fields.Size;
+            if (!(toread + start > data_len)) {
+                memcpy(&fields, &data.Data[start], toread);
+                records.append(fields);
+            }
+            start += toread;
+        }
+    }
+}
+
+/**
+ * Put the records in flight and entry order, called once all the entries
+ * queued are parsed.
+ */
+void FlightLogParser::finish()
+{
+    foreach(const FlightLogStore &records, m_entries) {
+        m_store.append(records);
+    }
+    m_entries.clear();
+}
+
+/**
+ * The parsed records, call after finish().
+ */
+FlightLogStore FlightLogParser::takeStore()
+{
+    FlightLogStore store(m_store);
+
+    m_store.clear();
+    return store;
+}
 
 UAVOLogSettingsWrapper::UAVOLogSettingsWrapper() : QObject()
 {}
@@ -31,10 +31,12 @@
 #include <QObject>
 #include <QList>
 #include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QMutex>
+#include <QThread>
 #include <QQmlListProperty>
 #include <QSemaphore>
-#include <QXmlStreamWriter>
-#include <QTextStream>
 
 #include "uavobjectmanager.h"
 #include "uavobjectutilmanager.h"
@@ -44,6 +46,8 @@
 #include "debuglogcontrol.h"
 #include "objectpersistence.h"
 #include "uavtalk/telemetrymanager.h"
+#include "flightlogstore.h"
+#include "flightlogexporter.h"
 
 class UAVOLogSettingsWrapper : public QObject {
     Q_OBJECT Q_PROPERTY(UAVDataObject *object READ object NOTIFY objectChanged)
@@ -145,8 +149,6 @@ public:
     ~ExtendedDebugLogEntry();
 
     QString getLogString();
-    void toXML(QXmlStreamWriter *xmlWriter, quint32 baseTime);
-    void toCSV(QTextStream *csvStream, quint32 baseTime);
     UAVDataObject *uavObject()
     {
         return m_object;
@@ -167,6 +169,29 @@ private:
     UAVDataObject *m_object;
 };
 
+/**
+ * Splits the raw entries received during a download into store records,
+ * in a worker thread. Entries may arrive in any order, they are kept sorted
+ * by flight and entry number.
+ */
+class FlightLogParser : public QObject {
+    Q_OBJECT
+
+public:
+    FlightLogParser();
+    ~FlightLogParser();
+
+    FlightLogStore takeStore();
+
+public slots:
+    void parse(QByteArray entry);
+    void finish();
+
+private:
+    QMap<quint32, FlightLogStore> m_entries;
+    FlightLogStore m_store;
+};
+
 class FlightLogManager : public QObject {
     Q_OBJECT Q_PROPERTY(DebugLogStatus *flightLogStatus READ flightLogStatus)
     Q_PROPERTY(DebugLogControl * flightLogControl READ flightLogControl)
@@ -246,8 +271,10 @@ public:
     }
     int logEntriesCount()
     {
-        return m_logEntries.count();
+        return m_logStore.count();
     }
+
+    ExtendedDebugLogEntry *logEntry(int index);
 signals:
     void logEntriesChanged();
     void flightEntriesChanged();
@@ -261,6 +288,8 @@ signals:
     void logStatusesChanged(QStringList arg);
     void loggingEnabledChanged(int arg);
 
+    void streamWindowDone();
+
 public slots:
     void clearAllLogs();
     void retrieveLogs(int flightToRetrieve = -1);
@@ -319,6 +348,7 @@ private slots:
     void setupLogStatuses();
     void connectionStatusChanged();
     bool updateLogWrapper(QString name, int level, int period);
+    void logEntryReceived(UAVObject *object);
 
 private:
     UAVObjectManager *m_objectManager;
@@ -330,7 +360,10 @@ private:
     DebugLogSettings *m_flightLogSettings;
     ObjectPersistence *m_objectPersistence;
 
-    QList<ExtendedDebugLogEntry *> m_logEntries;
+    // downloaded records, entry objects are only created for the ones displayed
+    FlightLogStore m_logStore;
+    QHash<int, ExtendedDebugLogEntry *> m_logEntryObjects;
+    FlightLogExporter *m_exporter;
     QStringList m_flightEntries;
     QStringList m_logSettings;
     QStringList m_logStatuses;
@@ -338,11 +371,27 @@ private:
     QList<UAVOLogSettingsWrapper *> m_uavoEntries;
     QHash<QString, UAVOLogSettingsWrapper *> m_uavoEntriesHash;
 
-    void exportToOPL(QString fileName);
-    void exportToCSV(QString fileName);
-    void exportToXML(QString fileName);
+    // state of a streamed download, shared with the telemetry thread
+    QMutex m_streamMutex;
+    FlightLogParser *m_streamParser;
+    quint16 m_streamFlight;
+    QSet<int> m_streamReceived;
+    int m_streamEnd; // first entry that does not exist, -1 if not known yet
+    int m_streamWindowLast;
+    bool m_streamWindowDone;
+    quint64 m_streamBytes;
+
+    bool retrieveFlight(quint16 flight, int *period);
+
+    bool exportToFile(FlightLogExporter::Format format, const QString &fileName);
 
     static const int UAVTALK_TIMEOUT = 4000;
+    static const int STREAM_WINDOW   = 32;
+    static const int STREAM_WINDOW_TIMEOUT = 1000;
+    static const int STREAM_RETRIES  = 3;
+    static const int STREAM_START_PERIOD_MS = 20;
+    static const int STREAM_MIN_PERIOD_MS   = 2;
+    static const int STREAM_MAX_PERIOD_MS   = 200;
     static const int LOG_SETTINGS_FILE_VERSION = 1;
     bool m_disableControls;
     bool m_disableExport;
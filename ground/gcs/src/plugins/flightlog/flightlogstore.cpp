@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogstore.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Compact in memory storage of downloaded log entries
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightlogstore.h"
+
+#include <string.h>
+
+FlightLogStore::FlightLogStore()
+{}
+
+/**
+ * Append a record, only the used part of the data is kept.
+ */
+void FlightLogStore::append(const DebugLogEntry::DataFields &fields)
+{
+    Header header;
+    quint16 size = fields.Size;
+
+    header.flightTime = fields.FlightTime;
+    header.objectId   = fields.ObjectID;
+    header.flight     = fields.Flight;
+    header.entry      = fields.Entry;
+    header.instanceId = fields.InstanceID;
+    header.size       = qMin<quint16>(size, sizeof(fields.Data));
+    header.type       = fields.Type;
+
+    m_offsets.append(m_arena.size());
+    m_arena.append((const char *)&header, sizeof(header));
+    m_arena.append((const char *)fields.Data, header.size);
+}
+
+void FlightLogStore::append(const FlightLogStore &other)
+{
+    quint32 base = m_arena.size();
+
+    m_offsets.reserve(m_offsets.size() + other.m_offsets.size());
+    foreach(quint32 offset, other.m_offsets) {
+        m_offsets.append(base + offset);
+    }
+    m_arena.append(other.m_arena);
+}
+
+void FlightLogStore::clear()
+{
+    m_arena.clear();
+    m_offsets.clear();
+}
+
+FlightLogStore::Record FlightLogStore::at(int index) const
+{
+    Header header;
+    Record record;
+    const char *start = m_arena.constData() + m_offsets.at(index);
+
+    memcpy(&header, start, sizeof(header));
+    record.flight     = header.flight;
+    record.entry      = header.entry;
+    record.flightTime = header.flightTime;
+    record.objectId   = header.objectId;
+    record.instanceId = header.instanceId;
+    record.size       = header.size;
+    record.type       = header.type;
+    record.data       = (const quint8 *)start + sizeof(header);
+    return record;
+}
+
+/**
+ * Bytes held by the store.
+ */
+qint64 FlightLogStore::memoryUsed() const
+{
+    return m_arena.capacity() + m_offsets.capacity() * sizeof(quint32);
+}
+
+/**
+ * Rebuild the entry the record came from, the unused data is zeroed.
+ */
+void FlightLogStore::Record::toFields(DebugLogEntry::DataFields &fields) const
+{
+    memset(&fields, 0, sizeof(fields));
+    fields.Flight     = flight;
+    fields.FlightTime = flightTime;
+    fields.Entry      = entry;
+    fields.Type       = type;
+    fields.ObjectID   = objectId;
+    fields.InstanceID = instanceId;
+    fields.Size       = size;
+    memcpy(fields.Data, data, size);
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ *
+ * @file       flightlogstore.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup FlightLogManager
+ * @{
+ * @brief Compact in memory storage of downloaded log entries
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FLIGHTLOGSTORE_H
+#define FLIGHTLOGSTORE_H
+
+#include <QByteArray>
+#include <QVector>
+
+#include "debuglogentry.h"
+
+/**
+ * Holds the records of a downloaded log one after the other in a single
+ * buffer: a small header followed by the used part of the data. A record is
+ * one object (entries holding several objects are split) or one text.
+ *
+ * Records are read only, they are not QObjects. Anything that needs an object
+ * (display, export) unpacks the data into a clone when it gets to it.
+ */
+class FlightLogStore {
+public:
+    struct Record {
+        quint16 flight;
+        quint16 entry;
+        quint32 flightTime;
+        quint32 objectId;
+        quint16 instanceId;
+        quint16 size;
+        quint8  type;
+        const quint8 *data; // valid until the store is modified
+
+        void toFields(DebugLogEntry::DataFields &fields) const;
+    };
+
+    FlightLogStore();
+
+    void append(const DebugLogEntry::DataFields &fields);
+    void append(const FlightLogStore &other);
+    void clear();
+
+    int count() const
+    {
+        return m_offsets.size();
+    }
+
+    bool isEmpty() const
+    {
+        return m_offsets.isEmpty();
+    }
+
+    Record at(int index) const;
+    qint64 memoryUsed() const;
+
+private:
+    struct Header {
+        quint32 flightTime;
+        quint32 objectId;
+        quint16 flight;
+        quint16 entry;
+        quint16 instanceId;
+        quint16 size;
+        quint8  type;
+    } __attribute__((packed));
+
+    QByteArray m_arena;
+    QVector<quint32> m_offsets;
+};
+
+#endif // FLIGHTLOGSTORE_H
+
+/**
+ * @}
+ * @}
+ */
@@ -75,10 +75,12 @@ void IPConnection::onOpenDevice(QString HostName, int Port, bool UseTCP)
     const int Timeout = 5 * 1000;
 
     ipConMutex.lock();
+    // No parent, the telemetry moves the socket to its reader thread and
+    // QObject::moveToThread() refuses objects with a parent
     if (UseTCP) {
-        ipSocket = new QTcpSocket(this);
+        ipSocket = new QTcpSocket();
     } else {
-        ipSocket = new QUdpSocket(this);
+        ipSocket = new QUdpSocket();
     }
 
     // do sanity check on hostname and port...
@@ -98,6 +100,7 @@ void IPConnection::onOpenDevice(QString HostName, int Port, bool UseTCP)
         // tell user something went wrong
         errorMsg = ipSocket->errorString();
     }
+    delete ipSocket;
     /* BUGBUG TODO - returning null here leads to segfault because some caller still calls disconnect without checking our return value properly
      * someone needs to debug this, I got lost in the calling chain.*/
     ret = NULL;
@@ -33,6 +33,7 @@
 #include <extensionsystem/pluginmanager.h>
 #include <coreplugin/icore.h>
 #include <uavtalk/telemetrymanager.h>
+#include "uavobjectnotificationhub.h"
 
 #include <iostream>
 
@@ -176,11 +177,12 @@ void SoundNotifyPlugin::updateNotificationList(QList<NotificationItem *> list)
 
 void SoundNotifyPlugin::connectNotifications()
 {
-    foreach(UAVDataObject * obj, lstNotifiedUAVObjects) {
-        if (obj != NULL) {
-            disconnect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(on_arrived_Notification(UAVObject *)));
-        }
-    }
+    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+    UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
+    UAVObjectNotificationHub *notificationHub = pm->getObject<UAVObjectNotificationHub>();
+
+    notificationHub->unsubscribe(this);
+
     if (phonon.mo != NULL) {
         delete phonon.mo;
         phonon.mo = NULL;
@@ -190,9 +192,6 @@ void SoundNotifyPlugin::connectNotifications()
         return;
     }
 
-    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
-    UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
-
     lstNotifiedUAVObjects.clear();
     _pendingNotifications.clear();
     _notificationList.append(_toRemoveNotifications);
@@ -217,9 +216,8 @@ void SoundNotifyPlugin::connectNotifications()
             if (!lstNotifiedUAVObjects.contains(obj)) {
                 lstNotifiedUAVObjects.append(obj);
 
-                connect(obj, SIGNAL(objectUpdated(UAVObject *)),
-                        this, SLOT(on_arrived_Notification(UAVObject *)),
-                        Qt::QueuedConnection);
+                // the rules only need the latest value
+                notificationHub->subscribe(obj, this, SLOT(on_arrived_Notification(UAVObject *)), MAX_UPDATE_RATE);
             }
         } else {
             qNotifyDebug() << "Error: Object is unknown (" << notify->getDataObject() << ").";
@@ -270,8 +268,6 @@ void SoundNotifyPlugin::on_arrived_Notification(UAVObject *object)
 
         checkNotificationRule(ntf, object);
     }
-    connect(object, SIGNAL(objectUpdated(UAVObject *)),
-            this, SLOT(on_arrived_Notification(UAVObject *)), Qt::UniqueConnection);
 }
 
 
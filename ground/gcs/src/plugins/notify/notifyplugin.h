@@ -98,6 +98,9 @@ private slots:
     void stateChanged(QMediaPlayer::State newstate);
 
 private:
+    // rate the notification rules are checked at (Hz)
+    static const int MAX_UPDATE_RATE = 10;
+
     bool enableSound;
 
     QList<UAVDataObject *> lstNotifiedUAVObjects;
@@ -49,6 +49,13 @@ plugin_uavtalk.subdir = uavtalk
 plugin_uavtalk.depends = plugin_uavobjects
 plugin_uavtalk.depends += plugin_coreplugin
 
+# UAVTalk tests, built with the debug GCS as WITH_TESTS in gcs.pri
+CONFIG(debug, debug|release) {
+    SUBDIRS += plugin_uavtalk_tests
+    plugin_uavtalk_tests.subdir = uavtalk/tests
+    plugin_uavtalk_tests.depends = plugin_uavtalk
+}
+
 # Telemetry plugin
 SUBDIRS += plugin_telemetry
 plugin_telemetry.subdir = telemetry
@@ -117,6 +124,13 @@ plugin_systemhealth.depends += plugin_uavobjects
 plugin_systemhealth.depends += plugin_uavtalk
 SUBDIRS += plugin_systemhealth
 
+# Event Trace gadget
+plugin_eventtrace.subdir = eventtrace
+plugin_eventtrace.depends = plugin_coreplugin
+plugin_eventtrace.depends += plugin_uavobjects
+plugin_eventtrace.depends += plugin_uavtalk
+SUBDIRS += plugin_eventtrace
+
 # Config gadget
 plugin_config.subdir = config
 plugin_config.depends = plugin_coreplugin
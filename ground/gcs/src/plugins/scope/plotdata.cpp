@@ -64,6 +64,9 @@ PlotData::PlotData(UAVObject *object, UAVObjectField *field, int element,
     m_plotCurve->setPen(m_pen);
     m_plotCurve->setSamples(m_xDataEntries, m_yDataEntries);
     m_isEnumPlot = m_field->getType() == UAVObjectField::ENUM;
+    if (m_isEnumPlot) {
+        m_enumOptions = m_field->getOptions();
+    }
 }
 
 PlotData::~PlotData()
@@ -175,6 +178,17 @@ void PlotData::calcMathFunction(double currentValue)
     }
 }
 
+/**
+ * Current option of an enum field, read without going through a QVariant.
+ * Invalid values map to the first option, as UAVObjectField::getValue() does.
+ */
+QString PlotData::enumOption()
+{
+    int index = (int)m_field->getRawValue(m_element);
+
+    return m_enumOptions.value(index, m_enumOptions.value(0));
+}
+
 QwtPlotMarker *PlotData::createMarker(QString value)
 {
     QwtPlotMarker *marker = new QwtPlotMarker(value);
@@ -207,7 +221,7 @@ bool SequentialPlotData::append(UAVObject *obj)
 
     if (m_object == obj && m_field) {
         if (!m_isEnumPlot) {
-            double currentValue = m_field->getValue(m_element).toDouble() * pow(10, m_scalePower);
+            double currentValue = m_field->getRawValue(m_element) * pow(10, m_scalePower);
 
             // Perform scope math, if necessary
             if (m_mathFunction == "Boxcar average" || m_mathFunction == "Standard deviation") {
@@ -226,7 +240,7 @@ bool SequentialPlotData::append(UAVObject *obj)
             return true;
         } else {
             // Enum markers
-            QString value = m_field->getValue(m_element).toString();
+            QString value = enumOption();
 
             QwtPlotMarker *marker = m_enumMarkerList.isEmpty() ? NULL : m_enumMarkerList.last();
             if (!marker || marker->title() != value) {
@@ -256,7 +270,7 @@ bool ChronoPlotData::append(UAVObject *obj)
 
         double xValue = NOW.toTime_t() + NOW.time().msec() / 1000.0;
         if (!m_isEnumPlot) {
-            double currentValue = m_field->getValue(m_element).toDouble() * pow(10, m_scalePower);
+            double currentValue = m_field->getRawValue(m_element) * pow(10, m_scalePower);
 
             // Perform scope math, if necessary
             if (m_mathFunction == "Boxcar average" || m_mathFunction == "Standard deviation") {
@@ -268,7 +282,7 @@ bool ChronoPlotData::append(UAVObject *obj)
             m_xDataEntries.append(xValue);
         } else {
             // Enum markers
-            QString value = m_field->getValue(m_element).toString();
+            QString value = enumOption();
 
             QwtPlotMarker *marker = m_enumMarkerList.isEmpty() ? NULL : m_enumMarkerList.last();
             if (!marker || marker->title() != value) {
@@ -127,8 +127,10 @@ protected:
     bool m_isVisible;
     QPen m_pen;
     bool m_isEnumPlot;
+    QStringList m_enumOptions;
     virtual void calcMathFunction(double currentValue);
     QwtPlotMarker *createMarker(QString value);
+    QString enumOption();
 };
 
 /*!
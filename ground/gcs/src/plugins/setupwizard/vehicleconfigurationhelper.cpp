@@ -1103,31 +1103,17 @@ bool VehicleConfigurationHelper::saveChangesToController(bool save)
                 innerTimeoutTimer.stop();
             }
             disconnect(obj, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(uAVOTransactionCompleted(UAVObject *, bool)));
+            m_currentTransactionObjectID = -1;
             if (m_transactionOK) {
                 qDebug() << "Object " << obj->getName() << " was successfully updated.";
                 if (save) {
-                    m_transactionOK = false;
-                    m_currentTransactionObjectID = obj->getObjID();
-                    // Try to save until success or timeout
-                    while (!m_transactionOK && !m_transactionTimeout) {
-                        // Allow the transaction to take some time
-                        innerTimeoutTimer.start(INNER_TIMEOUT);
-
-                        // Persist object in controller
-                        utilMngr->saveObjectToSD(obj);
-                        if (!m_transactionOK) {
-                            m_eventLoop.exec();
-                        }
-                        innerTimeoutTimer.stop();
-                    }
-                    m_currentTransactionObjectID = -1;
+                    // Persist object in controller while uploading the next ones,
+                    // the util manager saves the queued objects at once
+                    m_pendingSaves.insert(obj->getObjID(), obj);
+                    utilMngr->saveObjectToSD(obj);
                 }
-            }
-
-            if (!m_transactionOK) {
-                qDebug() << "Transaction timed out when trying to save: " << obj->getName();
             } else {
-                qDebug() << "Object " << obj->getName() << " was successfully saved.";
+                qDebug() << "Transaction timed out when trying to upload: " << obj->getName();
             }
         } else {
             qDebug() << "Trying to save a UAVDataObject that is read only or is not a settings object.";
@@ -1138,6 +1124,16 @@ bool VehicleConfigurationHelper::saveChangesToController(bool save)
         }
     }
 
+    // Wait for the queued saves, failed ones are retried until the timeout
+    while (!m_pendingSaves.isEmpty() && !m_transactionTimeout) {
+        m_eventLoop.exec();
+    }
+    if (!m_pendingSaves.isEmpty()) {
+        qDebug() << "Transaction timed out when trying to save " << m_pendingSaves.count() << " objects.";
+        m_pendingSaves.clear();
+        m_transactionOK = false;
+    }
+
     outerTimeoutTimer.stop();
     disconnect(&outerTimeoutTimer, SIGNAL(timeout()), this, SLOT(saveChangesTimeout()));
     disconnect(&innerTimeoutTimer, SIGNAL(timeout()), &m_eventLoop, SLOT(quit()));
@@ -1150,7 +1146,18 @@ bool VehicleConfigurationHelper::saveChangesToController(bool save)
 
 void VehicleConfigurationHelper::uAVOTransactionCompleted(int oid, bool success)
 {
-    if (oid == m_currentTransactionObjectID) {
+    if (m_pendingSaves.contains(oid) && oid != m_currentTransactionObjectID) {
+        if (success) {
+            qDebug() << "Object " << m_pendingSaves.value(oid)->getName() << " was successfully saved.";
+            m_pendingSaves.remove(oid);
+            if (m_pendingSaves.isEmpty() && m_currentTransactionObjectID == -1) {
+                m_eventLoop.quit();
+            }
+        } else if (!m_transactionTimeout) {
+            ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+            pm->getObject<UAVObjectUtilManager>()->saveObjectToSD(m_pendingSaves.value(oid));
+        }
+    } else if (oid == m_currentTransactionObjectID) {
         m_transactionOK = success;
         m_eventLoop.quit();
     }
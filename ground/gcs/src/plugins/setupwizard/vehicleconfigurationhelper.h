@@ -35,6 +35,7 @@
 #include "systemsettings.h"
 #include "actuatorsettings.h"
 
+#include <QHash>
 #include <QList>
 #include <QPair>
 #include <QEventLoop>
@@ -104,6 +105,7 @@ private:
     bool m_transactionOK;
     bool m_transactionTimeout;
     int m_currentTransactionObjectID;
+    QHash<int, UAVObject *> m_pendingSaves;
     int m_progress;
 
     void resetVehicleConfig();
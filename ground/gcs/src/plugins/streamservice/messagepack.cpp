@@ -0,0 +1,190 @@
+/**
+ ******************************************************************************
+ *
+ * @file       messagepack.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup StreamServicePlugin Plugin
+ * @{
+ * @brief Minimal MessagePack encoder for the stream service
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "messagepack.h"
+
+#include <string.h>
+
+void MessagePackWriter::writeMap(quint32 size)
+{
+    writeHeader(0x80, 15, 0xde, 0xdf, size);
+}
+
+void MessagePackWriter::writeArray(quint32 size)
+{
+    writeHeader(0x90, 15, 0xdc, 0xdd, size);
+}
+
+void MessagePackWriter::writeString(const QString &str)
+{
+    QByteArray utf8 = str.toUtf8();
+
+    if (utf8.size() <= 31) {
+        m_out.append((char)(0xa0 | utf8.size()));
+    } else if (utf8.size() <= 0xff) {
+        m_out.append((char)0xd9);
+        writeBigEndian(utf8.size(), 1);
+    } else {
+        writeHeader(0, 0, 0xda, 0xdb, utf8.size());
+    }
+    m_out.append(utf8);
+}
+
+void MessagePackWriter::writeInt(qint64 value)
+{
+    if (value >= 0) {
+        writeUInt(value);
+    } else if (value >= -32) {
+        m_out.append((char)value);
+    } else if (value >= -128) {
+        m_out.append((char)0xd0);
+        writeBigEndian(value, 1);
+    } else if (value >= -32768) {
+        m_out.append((char)0xd1);
+        writeBigEndian(value, 2);
+    } else if (value >= -2147483647LL - 1) {
+        m_out.append((char)0xd2);
+        writeBigEndian(value, 4);
+    } else {
+        m_out.append((char)0xd3);
+        writeBigEndian(value, 8);
+    }
+}
+
+void MessagePackWriter::writeUInt(quint64 value)
+{
+    if (value <= 0x7f) {
+        m_out.append((char)value);
+    } else if (value <= 0xff) {
+        m_out.append((char)0xcc);
+        writeBigEndian(value, 1);
+    } else if (value <= 0xffff) {
+        m_out.append((char)0xcd);
+        writeBigEndian(value, 2);
+    } else if (value <= 0xffffffff) {
+        m_out.append((char)0xce);
+        writeBigEndian(value, 4);
+    } else {
+        m_out.append((char)0xcf);
+        writeBigEndian(value, 8);
+    }
+}
+
+void MessagePackWriter::writeFloat(float value)
+{
+    quint32 bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    m_out.append((char)0xca);
+    writeBigEndian(bits, 4);
+}
+
+void MessagePackWriter::writeDouble(double value)
+{
+    quint64 bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    m_out.append((char)0xcb);
+    writeBigEndian(bits, 8);
+}
+
+void MessagePackWriter::writeBool(bool value)
+{
+    m_out.append((char)(value ? 0xc3 : 0xc2));
+}
+
+void MessagePackWriter::writeNil()
+{
+    m_out.append((char)0xc0);
+}
+
+/**
+ * Write a value as returned by UAVObjectField::getValue().
+ */
+void MessagePackWriter::writeVariant(const QVariant &value)
+{
+    switch ((int)value.type()) {
+    case QMetaType::Bool:
+        writeBool(value.toBool());
+        break;
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::Short:
+    case QMetaType::Int:
+    case QMetaType::Long:
+    case QMetaType::LongLong:
+        writeInt(value.toLongLong());
+        break;
+    case QMetaType::UChar:
+    case QMetaType::UShort:
+    case QMetaType::UInt:
+    case QMetaType::ULong:
+    case QMetaType::ULongLong:
+        writeUInt(value.toULongLong());
+        break;
+    case QMetaType::Float:
+        writeFloat(value.toFloat());
+        break;
+    case QMetaType::Double:
+        writeDouble(value.toDouble());
+        break;
+    case QMetaType::QString:
+        writeString(value.toString());
+        break;
+    default:
+        if (value.isValid()) {
+            writeString(value.toString());
+        } else {
+            writeNil();
+        }
+        break;
+    }
+}
+
+void MessagePackWriter::writeHeader(quint8 fixType, quint32 fixMax, quint8 type16, quint8 type32, quint32 size)
+{
+    if (fixType && size <= fixMax) {
+        m_out.append((char)(fixType | size));
+    } else if (size <= 0xffff) {
+        m_out.append((char)type16);
+        writeBigEndian(size, 2);
+    } else {
+        m_out.append((char)type32);
+        writeBigEndian(size, 4);
+    }
+}
+
+void MessagePackWriter::writeBigEndian(quint64 value, int bytes)
+{
+    for (int i = bytes - 1; i >= 0; --i) {
+        m_out.append((char)(value >> (8 * i)));
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
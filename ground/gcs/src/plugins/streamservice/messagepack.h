@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ *
+ * @file       messagepack.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup StreamServicePlugin Plugin
+ * @{
+ * @brief Minimal MessagePack encoder for the stream service
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef MESSAGEPACK_H
+#define MESSAGEPACK_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVariant>
+
+/**
+ * Appends MessagePack (http://msgpack.org) encoded values to a byte array.
+ * Only what the stream service sends is supported: maps, arrays, strings,
+ * integers, float32 and float64, bool and nil.
+ */
+class MessagePackWriter {
+public:
+    MessagePackWriter(QByteArray &out) : m_out(out) {}
+
+    void writeMap(quint32 size);
+    void writeArray(quint32 size);
+    void writeString(const QString &str);
+    void writeInt(qint64 value);
+    void writeUInt(quint64 value);
+    void writeFloat(float value);
+    void writeDouble(double value);
+    void writeBool(bool value);
+    void writeNil();
+    void writeVariant(const QVariant &value);
+
+private:
+    QByteArray &m_out;
+
+    void writeHeader(quint8 fixType, quint32 fixMax, quint8 type16, quint8 type32, quint32 size);
+    void writeBigEndian(quint64 value, int bytes);
+};
+
+#endif // MESSAGEPACK_H
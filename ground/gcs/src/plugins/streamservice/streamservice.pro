@@ -8,9 +8,11 @@ include(../../plugins/coreplugin/coreplugin.pri)
 include(../../plugins/uavtalk/uavtalk.pri)
 include(../../plugins/uavobjects/uavobjects.pri)
 
-SOURCES += streamserviceplugin.cpp
+SOURCES += streamserviceplugin.cpp \
+    messagepack.cpp
 
-HEADERS += streamserviceplugin.h
+HEADERS += streamserviceplugin.h \
+    messagepack.h
 
 OTHER_FILES +=
 
@@ -25,6 +25,7 @@
  * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
  */
 #include "streamserviceplugin.h"
+#include "messagepack.h"
 
 #include <QJsonObject>
 #include <QJsonDocument>
@@ -32,14 +33,26 @@
 #include <QDateTime>
 #include <QTcpServer>
 #include <QTcpSocket>
+#include <QtEndian>
+#include <QDebug>
 
 #include "extensionsystem/pluginmanager.h"
 #include "../uavobjects/uavobjectmanager.h"
 #include "../uavobjects/uavdataobject.h"
+#include "../uavobjects/uavobjectfield.h"
+#include <utils/crc.h>
+
+// UAVTalk object packet: sync(1), type (1), size(2), object ID(4), instance ID(2), data, crc(1)
+#define UAVTALK_SYNC_VAL      0x3C
+#define UAVTALK_TYPE_OBJ      0x20
+#define UAVTALK_HEADER_LENGTH 10
 
 StreamServicePlugin::StreamServicePlugin() :
     port(7891),
-    isSubscribed(false) {}
+    isSubscribed(false)
+{
+    clock.start();
+}
 
 StreamServicePlugin::~StreamServicePlugin()
 {
@@ -47,15 +60,16 @@ StreamServicePlugin::~StreamServicePlugin()
         return;
     }
     if (pServer->isListening()) {
-        foreach(QTcpSocket * client, activeClients) {
+        foreach(Client * client, activeClients) {
             /* Disconnect the client discarding pending
              * bytes */
-            if (client->isOpen()) {
-                client->close();
+            if (client->socket->isOpen()) {
+                client->socket->close();
             }
         }
         pServer->close();
     }
+    qDeleteAll(activeClients);
 }
 
 bool StreamServicePlugin::initialize(const QStringList &arguments, QString *errorString)
@@ -90,29 +104,42 @@ void StreamServicePlugin::shutdown()
         pServer->pauseAccepting();
     }
 
-    foreach(QTcpSocket * pClient, activeClients) {
-        pClient->disconnectFromHost();
+    foreach(Client * client, activeClients) {
+        client->socket->disconnectFromHost();
     }
 }
 
 void StreamServicePlugin::objectUpdated(UAVObject *pObj)
 {
-    QJsonObject qtjson;
-
-    pObj->toJson(qtjson);
+    // each format is encoded once per update, when the first client needs it
+    QByteArray messages[FORMAT_COUNT];
+    qint64 timestamp = 0;
+    qint64 now = clock.elapsed();
 
-    // Adds timestamp: Milliseconds from epoch
-    qtjson.insert("gcs_timestamp_ms", QJsonValue(QDateTime::currentMSecsSinceEpoch()));
+    foreach(Client * client, activeClients) {
+        if (!client->socket->isOpen() || !isDue(client, pObj, now)) {
+            continue;
+        }
 
-    QJsonDocument jsonDoc(qtjson);
-    QString strJson = QString(jsonDoc.toJson(QJsonDocument::Compact)) + "\n";
+        QByteArray &message = messages[client->format];
+        if (message.isEmpty()) {
+            if (!timestamp) {
+                timestamp = QDateTime::currentMSecsSinceEpoch();
+            }
+            message = encode(pObj, client->format, timestamp);
+        }
 
-    foreach(QTcpSocket * pClient, activeClients) {
-        if (pClient->isOpen()) {
-            if (pClient->write(strJson.toUtf8().constData(), strJson.length())) {
-                pClient->flush();
+        // the socket sends from the event loop, a client that does not keep
+        // up loses updates instead of growing the buffer without limit
+        if (client->socket->bytesToWrite() + message.size() > MAX_CLIENT_BACKLOG) {
+            if (client->dropped++ % 1000 == 0) {
+                qWarning() << "StreamService: client" << client->socket->peerAddress().toString()
+                           << "too slow," << client->dropped << "updates dropped";
             }
+            continue;
         }
+        client->socket->write(message);
+        client->lastSent[pObj] = now;
     }
 }
 
@@ -125,14 +152,176 @@ void StreamServicePlugin::clientConnected()
     }
     makeSureIsSubscribed();
 
+    pending->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
+    Client *client = new Client();
+    client->socket  = pending;
+    client->format  = FORMAT_JSON;
+    client->subscriptions.insert("*", 0);
+    client->dropped = 0;
+
     connect(pending, &QTcpSocket::disconnected, this, &StreamServicePlugin::clientDisconnected);
-    activeClients.append(pending);
+    connect(pending, &QTcpSocket::readyRead, this, &StreamServicePlugin::clientReadyRead);
+    activeClients.append(client);
 }
 
 void StreamServicePlugin::clientDisconnected()
 {
-    disconnect(sender());
-    activeClients.removeAll((QTcpSocket *)sender());
+    QTcpSocket *socket = (QTcpSocket *)sender();
+    Client *client     = findClient(socket);
+
+    disconnect(socket);
+    if (client) {
+        activeClients.removeAll(client);
+        delete client;
+    }
+    socket->deleteLater();
+}
+
+void StreamServicePlugin::clientReadyRead()
+{
+    QTcpSocket *socket = (QTcpSocket *)sender();
+    Client *client     = findClient(socket);
+
+    while (client && socket->canReadLine()) {
+        processCommand(client, QString::fromUtf8(socket->readLine()).trimmed());
+    }
+}
+
+StreamServicePlugin::Client *StreamServicePlugin::findClient(QTcpSocket *socket)
+{
+    foreach(Client * client, activeClients) {
+        if (client->socket == socket) {
+            return client;
+        }
+    }
+    return Q_NULLPTR;
+}
+
+/**
+ * Whether the client subscribed to the object and its rate allows an update now.
+ */
+bool StreamServicePlugin::isDue(Client *client, UAVObject *pObj, qint64 now)
+{
+    QHash<QString, qint64>::const_iterator subscription = client->subscriptions.constFind(pObj->getName());
+
+    if (subscription == client->subscriptions.constEnd()) {
+        subscription = client->subscriptions.constFind("*");
+        if (subscription == client->subscriptions.constEnd()) {
+            return false;
+        }
+    }
+    if (*subscription > 0) {
+        QHash<UAVObject *, qint64>::const_iterator last = client->lastSent.constFind(pObj);
+        if (last != client->lastSent.constEnd() && now - *last < *subscription) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Commands are sent by the clients one per line:
+ *   format json|uavtalk|msgpack      encoding of the updates, json by default
+ *   subscribe <object> [max rate]    send updates of the object, at most max rate per second
+ *   unsubscribe <object>             stop sending updates of the object
+ * The object name * stands for all objects without a subscription of their own.
+ * Clients start subscribed to *, "unsubscribe *" limits the feed to the named objects.
+ */
+void StreamServicePlugin::processCommand(Client *client, const QString &line)
+{
+    QStringList args = line.split(' ', QString::SkipEmptyParts);
+
+    if (args.isEmpty()) {
+        return;
+    }
+
+    QString command = args.at(0).toLower();
+    if (command == "format" && args.size() == 2) {
+        QString format = args.at(1).toLower();
+        if (format == "json") {
+            client->format = FORMAT_JSON;
+        } else if (format == "uavtalk") {
+            client->format = FORMAT_UAVTALK;
+        } else if (format == "msgpack") {
+            client->format = FORMAT_MSGPACK;
+        } else {
+            qWarning() << "StreamService: unknown format" << format;
+        }
+    } else if (command == "subscribe" && (args.size() == 2 || args.size() == 3)) {
+        double rate = (args.size() == 3) ? args.at(2).toDouble() : 0.0;
+        client->subscriptions.insert(args.at(1), (rate > 0.0) ? (qint64)(1000.0 / rate) : 0);
+    } else if (command == "unsubscribe" && args.size() == 2) {
+        client->subscriptions.remove(args.at(1));
+    } else {
+        qWarning() << "StreamService: invalid command" << line;
+    }
+}
+
+QByteArray StreamServicePlugin::encode(UAVObject *pObj, Format format, qint64 timestamp)
+{
+    QByteArray message;
+
+    switch (format) {
+    case FORMAT_JSON:
+    {
+        QJsonObject qtjson;
+
+        pObj->toJson(qtjson);
+
+        // Adds timestamp: Milliseconds from epoch
+        qtjson.insert("gcs_timestamp_ms", QJsonValue(timestamp));
+
+        message = QJsonDocument(qtjson).toJson(QJsonDocument::Compact);
+        message.append('\n');
+        break;
+    }
+    case FORMAT_UAVTALK:
+    {
+        quint32 length = pObj->getNumBytes();
+
+        message.resize(UAVTALK_HEADER_LENGTH + length + 1);
+        quint8 *packet = (quint8 *)message.data();
+        packet[0] = UAVTALK_SYNC_VAL;
+        packet[1] = UAVTALK_TYPE_OBJ;
+        qToLittleEndian<quint16>(UAVTALK_HEADER_LENGTH + length, &packet[2]);
+        qToLittleEndian<quint32>(pObj->getObjID(), &packet[4]);
+        qToLittleEndian<quint16>(pObj->getInstID(), &packet[8]);
+        pObj->pack(&packet[UAVTALK_HEADER_LENGTH]);
+        packet[UAVTALK_HEADER_LENGTH + length] = Utils::Crc::updateCRC(0, packet, UAVTALK_HEADER_LENGTH + length);
+        break;
+    }
+    case FORMAT_MSGPACK:
+    {
+        MessagePackWriter writer(message);
+        QList<UAVObjectField *> fields = pObj->getFields();
+
+        writer.writeMap(4);
+        writer.writeString("name");
+        writer.writeString(pObj->getName());
+        writer.writeString("instance");
+        writer.writeUInt(pObj->getInstID());
+        writer.writeString("gcs_timestamp_ms");
+        writer.writeInt(timestamp);
+        writer.writeString("fields");
+        writer.writeMap(fields.size());
+        foreach(UAVObjectField * field, fields) {
+            writer.writeString(field->getName());
+            if (field->getNumElements() == 1 || field->getType() == UAVObjectField::STRING) {
+                writer.writeVariant(field->getValue(0));
+            } else {
+                writer.writeArray(field->getNumElements());
+                for (quint32 i = 0; i < field->getNumElements(); ++i) {
+                    writer.writeVariant(field->getValue(i));
+                }
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return message;
 }
 
 inline void StreamServicePlugin::makeSureIsSubscribed()
@@ -31,6 +31,8 @@
 #include "../uavobjects/uavobject.h"
 
 #include <QtPlugin>
+#include <QHash>
+#include <QElapsedTimer>
 
 class QTcpServer;
 class QTcpSocket;
@@ -53,15 +55,41 @@ public slots:
 private slots:
     void clientConnected();
     void clientDisconnected();
+    void clientReadyRead();
 
 private:
+    // Encoding of the updates sent to a client
+    enum Format {
+        FORMAT_JSON, // one compact JSON document per line, the default
+        FORMAT_UAVTALK, // UAVTalk object packets, as received from the flight controller
+        FORMAT_MSGPACK, // one MessagePack map per update
+        FORMAT_COUNT
+    };
+
+    struct Client {
+        QTcpSocket *socket;
+        Format format;
+        // object name to minimum interval between updates in ms, all objects if empty
+        QHash<QString, qint64> subscriptions;
+        QHash<UAVObject *, qint64> lastSent;
+        quint32 dropped;
+    };
+
+    // Updates are dropped while this much data is waiting to be sent to a client
+    static const qint64 MAX_CLIENT_BACKLOG = 64 * 1024;
+
     quint16 port;
 
     QTcpServer *pServer;
-    QList<QTcpSocket *> activeClients;
+    QList<Client *> activeClients;
     bool isSubscribed;
+    QElapsedTimer clock;
 
     inline void makeSureIsSubscribed();
+    Client *findClient(QTcpSocket *socket);
+    bool isDue(Client *client, UAVObject *pObj, qint64 now);
+    void processCommand(Client *client, const QString &line);
+    QByteArray encode(UAVObject *pObj, Format format, qint64 timestamp);
 };
 
 #endif // STREAMSERVICEPLUGIN_H
@@ -26,6 +26,7 @@
  */
 
 #include "systemalarms.h"
+#include "perfcounterpercentiles.h"
 #include "systemhealthgadgetwidget.h"
 
 #include "utils/stylehelper.h"
@@ -334,9 +335,47 @@ void SystemHealthGadgetWidget::showAllAlarmDescriptions(const QPoint & location)
             }
         }
 
+        alarmsText.append(perfCounterDescriptions());
+
         // Show alarms text if we have any
         if (alarmsText.length() > 0) {
             QWhatsThis::showText(location, alarmsText);
         }
     }
 }
+
+/**
+ * Tail latencies of the on board performance counters, empty when the
+ * firmware publishes none
+ */
+QString SystemHealthGadgetWidget::perfCounterDescriptions()
+{
+    ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
+    UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
+    QString rows;
+
+    foreach(UAVObject * object, objManager->getObjectInstances(PerfCounterPercentiles::OBJID)) {
+        PerfCounterPercentiles *counter = dynamic_cast<PerfCounterPercentiles *>(object);
+
+        if (!counter) {
+            continue;
+        }
+        PerfCounterPercentiles::DataFields data = counter->getData();
+        if (data.Samples == 0) {
+            continue;
+        }
+        rows.append(QString("<tr><td>%1</td><td align=\"right\">%2</td><td align=\"right\">%3</td>"
+                            "<td align=\"right\">%4</td><td align=\"right\">%5</td><td align=\"right\">%6</td></tr>")
+                    .arg(data.Id, 8, 16, QChar('0')).arg(data.Samples)
+                    .arg(data.Percentile[PerfCounterPercentiles::PERCENTILE_P50])
+                    .arg(data.Percentile[PerfCounterPercentiles::PERCENTILE_P99])
+                    .arg(data.Percentile[PerfCounterPercentiles::PERCENTILE_P999])
+                    .arg(data.Percentile[PerfCounterPercentiles::PERCENTILE_MAX]));
+    }
+    if (rows.isEmpty()) {
+        return rows;
+    }
+    return tr("<h3>Performance counters</h3><table cellspacing=\"4\">"
+              "<tr><th>Id</th><th>Samples</th><th>p50</th><th>p99</th><th>p99.9</th><th>Max</th></tr>%1</table>"
+              "<p>Over the last publishing period, times are in microseconds.</p>").arg(rows);
+}
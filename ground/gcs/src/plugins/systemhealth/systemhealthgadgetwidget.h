@@ -75,5 +75,6 @@ private:
 
     void showAlarmDescriptionForItemId(const QString itemId, const QPoint & location);
     void showAllAlarmDescriptions(const QPoint &location);
+    QString perfCounterDescriptions();
 };
 #endif /* SYSTEMHEALTHGADGETWIDGET_H_ */
@@ -31,6 +31,7 @@
 #include "uavdataobject.h"
 #include "uavmetaobject.h"
 #include "uavobjectfield.h"
+#include "uavobjectnotificationhub.h"
 #include "extensionsystem/pluginmanager.h"
 #include <QColor>
 #include <QtCore/QTimer>
@@ -51,6 +52,8 @@ UAVObjectTreeModel::UAVObjectTreeModel(QObject *parent, bool categorize, bool sh
     UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
 
     Q_ASSERT(objManager);
+    m_notificationHub = pm->getObject<UAVObjectNotificationHub>();
+    Q_ASSERT(m_notificationHub);
 
     // Create highlight manager, let it run every 300 ms.
     m_highlightManager = new HighLightManager(300);
@@ -156,7 +159,7 @@ TreeItem *UAVObjectTreeModel::createCategoryItems(QStringList categoryPath, Tree
 
 MetaObjectTreeItem *UAVObjectTreeModel::addMetaObject(UAVMetaObject *obj, TreeItem *parent)
 {
-    connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(highlightUpdatedObject(UAVObject *)));
+    m_notificationHub->subscribe(obj, this, SLOT(highlightUpdatedObject(UAVObject *)), MAX_UPDATE_RATE);
     MetaObjectTreeItem *meta = new MetaObjectTreeItem(obj, tr("Meta Data"));
 
     meta->setHighlightManager(m_highlightManager);
@@ -174,7 +177,7 @@ MetaObjectTreeItem *UAVObjectTreeModel::addMetaObject(UAVMetaObject *obj, TreeIt
 
 void UAVObjectTreeModel::addInstance(UAVObject *obj, TreeItem *parent)
 {
-    connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(highlightUpdatedObject(UAVObject *)));
+    m_notificationHub->subscribe(obj, this, SLOT(highlightUpdatedObject(UAVObject *)), MAX_UPDATE_RATE);
     connect(obj, SIGNAL(isKnownChanged(UAVObject *, bool)), this, SLOT(isKnownChanged(UAVObject *, bool)));
     TreeItem *item;
     if (obj->isSingleInstance()) {
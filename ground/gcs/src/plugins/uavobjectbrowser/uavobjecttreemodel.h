@@ -42,6 +42,7 @@ class UAVDataObject;
 class UAVMetaObject;
 class UAVObjectField;
 class UAVObjectManager;
+class UAVObjectNotificationHub;
 class QSignalMapper;
 class QTimer;
 
@@ -128,6 +129,10 @@ private:
 
     // Highlight manager to handle highlighting of tree items.
     HighLightManager *m_highlightManager;
+
+    // Object updates are shown at most at this rate (Hz)
+    static const int MAX_UPDATE_RATE = 10;
+    UAVObjectNotificationHub *m_notificationHub;
 };
 
 #endif // UAVOBJECTTREEMODEL_H
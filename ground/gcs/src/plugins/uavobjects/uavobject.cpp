@@ -36,6 +36,8 @@
 #include <QJsonObject>
 #include <QJsonArray>
 
+#include <atomic>
+
 using namespace Utils;
 
 // Constants
@@ -67,6 +69,7 @@ UAVObject::UAVObject(quint32 objID, bool isSingleInst, const QString & name)
     this->numBytes     = 0;
     this->mutex        = new QMutex(QMutex::Recursive);
     m_isKnown = false;
+    m_writeDepth = 0;
 }
 
 /**
@@ -96,6 +99,7 @@ void UAVObject::initializeFields(QList<UAVObjectField *> & fields, quint8 *data,
     quint32 offset = 0;
     for (int n = 0; n < fields.length(); ++n) {
         fields[n]->initialize(data, offset, this);
+        fieldsByName.insert(fields[n]->getName(), fields[n]);
         offset += fields[n]->getNumBytes();
         connect(fields[n], SIGNAL(fieldUpdated(UAVObjectField *)), this, SLOT(fieldUpdated(UAVObjectField *)));
     }
@@ -282,18 +286,85 @@ QList<UAVObjectField *> UAVObject::getFields()
  */
 UAVObjectField *UAVObject::getField(const QString & name)
 {
-    QMutexLocker locker(mutex);
+    // The field list does not change after initializeFields(), no need to lock
+    UAVObjectField *field = fieldsByName.value(name);
 
-    // Look for field
-    for (int n = 0; n < fields.length(); ++n) {
-        if (name.compare(fields[n]->getName()) == 0) {
-            return fields[n];
+    if (!field) {
+        qWarning() << "UAVObject::getField Non existant field" << name << "requested."
+                   << "This indicates a bug. Make sure you also have null checking for non-debug code.";
+    }
+    return field;
+}
+
+/**
+ * Get a field by its position in the object, as given by the generated
+ * <FIELD>_FIELDINDEX constants. Avoids the name lookup for code that
+ * resolves fields on each update.
+ * @param index Field index
+ * @returns The field or NULL if out of range
+ */
+UAVObjectField *UAVObject::getField(int index)
+{
+    return fields.value(index, NULL);
+}
+
+/**
+ * Copy part of the object data without taking the object mutex.
+ * Writers increment a sequence number before and after changing the data,
+ * the copy is retried until no write happened while it was taken. This lets
+ * the UI read values while the telemetry thread unpacks updates.
+ * @param dataOut Destination
+ * @param offset Offset of the first byte in the object data
+ * @param size Number of bytes to copy
+ */
+void UAVObject::readSnapshot(void *dataOut, quint32 offset, quint32 size) const
+{
+    Q_ASSERT(offset + size <= numBytes);
+
+    for (;;) {
+        int sequence = m_writeSequence.loadAcquire();
+        if (sequence & 1) {
+            continue;
         }
+        memcpy(dataOut, &data[offset], size);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_writeSequence.load() == sequence) {
+            return;
+        }
+    }
+}
+
+/**
+ * Number of changes of the object data so far. Notifications are queued to
+ * the GUI thread while the telemetry thread keeps unpacking, a receiver that
+ * remembers the sequence it handled can skip the notifications of values
+ * that were replaced already.
+ */
+quint32 UAVObject::getUpdateSequence() const
+{
+    return (quint32)m_writeSequence.loadAcquire() / 2;
+}
+
+/**
+ * Mark the start of a change of the object data, see readSnapshot().
+ * Must be called with the object mutex held, calls may nest.
+ */
+void UAVObject::beginWrite()
+{
+    if (m_writeDepth++ == 0) {
+        m_writeSequence.store(m_writeSequence.load() + 1);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+}
+
+/**
+ * Mark the end of a change of the object data.
+ */
+void UAVObject::endWrite()
+{
+    if (--m_writeDepth == 0) {
+        m_writeSequence.storeRelease(m_writeSequence.load() + 1);
     }
-    // If this point is reached then the field was not found
-    qWarning() << "UAVObject::getField Non existant field" << name << "requested."
-               << "This indicates a bug. Make sure you also have null checking for non-debug code.";
-    return NULL;
 }
 
 /**
@@ -321,10 +392,12 @@ qint32 UAVObject::unpack(const quint8 *dataIn)
     QMutexLocker locker(mutex);
     qint32 offset = 0;
 
+    beginWrite();
     for (int n = 0; n < fields.length(); ++n) {
         fields[n]->unpack(&dataIn[offset]);
         offset += fields[n]->getNumBytes();
     }
+    endWrite();
     emit objectUnpacked(this); // trigger object updated event
     emit objectUpdated(this);
 
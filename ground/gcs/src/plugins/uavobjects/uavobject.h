@@ -35,7 +35,9 @@
 #include <QMutexLocker>
 #include <QString>
 #include <QList>
+#include <QHash>
 #include <QFile>
+#include <QAtomicInt>
 #include <stdint.h>
 
 #include "uavobjectfield.h"
@@ -113,7 +115,7 @@ public:
     QString getDescription();
     quint32 getNumBytes();
     qint32 pack(quint8 *dataOut);
-    qint32 unpack(const quint8 *dataIn);
+    virtual qint32 unpack(const quint8 *dataIn);
     quint8 updateCRC(quint8 crc = 0);
     bool save();
     bool save(QFile & file);
@@ -129,6 +131,9 @@ public:
     qint32 getNumFields();
     QList<UAVObjectField *> getFields();
     UAVObjectField *getField(const QString & name);
+    UAVObjectField *getField(int index);
+    void readSnapshot(void *dataOut, quint32 offset, quint32 size) const;
+    quint32 getUpdateSequence() const;
     QString toString();
     QString toStringBrief();
     QString toStringData();
@@ -194,13 +199,21 @@ protected:
     QMutex *mutex;
     quint8 *data;
     QList<UAVObjectField *> fields;
+    QHash<QString, UAVObjectField *> fieldsByName;
 
     void initializeFields(QList<UAVObjectField *> & fields, quint8 *data, quint32 numBytes);
     void setDescription(const QString & description);
     void setCategory(const QString & category);
+    void beginWrite();
+    void endWrite();
 
 private:
     bool m_isKnown;
+    // odd while the data is being written, see readSnapshot()
+    QAtomicInt m_writeSequence;
+    int m_writeDepth;
+
+    friend class UAVObjectField;
 
 private slots:
     void fieldUpdated(UAVObjectField *field);
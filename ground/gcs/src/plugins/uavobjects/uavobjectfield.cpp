@@ -641,6 +641,7 @@ void UAVObjectField::clear()
 {
     QMutexLocker locker(obj->getMutex());
 
+    obj->beginWrite();
     switch (type) {
     case BITFIELD:
         memset(&data[offset], 0, numBytesPerElement * ((quint32)(1 + (numElements - 1) / 8)));
@@ -649,6 +650,7 @@ void UAVObjectField::clear()
         memset(&data[offset], 0, numBytesPerElement * numElements);
         break;
     }
+    obj->endWrite();
 }
 
 QString UAVObjectField::getName()
@@ -841,6 +843,7 @@ qint32 UAVObjectField::unpack(const quint8 *dataIn)
 {
     QMutexLocker locker(obj->getMutex());
 
+    obj->beginWrite();
     // Unpack each element from input buffer
     switch (type) {
     case INT8:
@@ -900,6 +903,7 @@ qint32 UAVObjectField::unpack(const quint8 *dataIn)
         memcpy(&data[offset], dataIn, numElements);
         break;
     }
+    obj->endWrite();
     // Done
     return getNumBytes();
 }
@@ -1106,6 +1110,7 @@ void UAVObjectField::setValue(const QVariant & value, quint32 index)
     UAVObject::Metadata mdata = obj->getMetadata();
     // Update value if the access mode permits
     if (UAVObject::GetGcsAccess(mdata) == UAVObject::ACCESS_READWRITE) {
+        obj->beginWrite();
         switch (type) {
         case INT8:
         {
@@ -1179,6 +1184,7 @@ void UAVObjectField::setValue(const QVariant & value, quint32 index)
             break;
         }
         }
+        obj->endWrite();
     }
 }
 
@@ -1187,6 +1193,73 @@ double UAVObjectField::getDouble(quint32 index)
     return getValue(index).toDouble();
 }
 
+/**
+ * Get an element as a number without going through a QVariant and without
+ * taking the object mutex, for code reading values on every update.
+ * Enums return the option index, bitfields the bit and strings 0.
+ */
+double UAVObjectField::getRawValue(quint32 index)
+{
+    if (index >= numElements) {
+        return 0.0;
+    }
+
+    switch (type) {
+    case INT8:
+    {
+        qint8 tmpint8;
+        obj->readSnapshot(&tmpint8, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpint8;
+    }
+    case INT16:
+    {
+        qint16 tmpint16;
+        obj->readSnapshot(&tmpint16, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpint16;
+    }
+    case INT32:
+    {
+        qint32 tmpint32;
+        obj->readSnapshot(&tmpint32, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpint32;
+    }
+    case UINT8:
+    case ENUM:
+    {
+        quint8 tmpuint8;
+        obj->readSnapshot(&tmpuint8, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpuint8;
+    }
+    case UINT16:
+    {
+        quint16 tmpuint16;
+        obj->readSnapshot(&tmpuint16, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpuint16;
+    }
+    case UINT32:
+    {
+        quint32 tmpuint32;
+        obj->readSnapshot(&tmpuint32, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpuint32;
+    }
+    case FLOAT32:
+    {
+        float tmpfloat;
+        obj->readSnapshot(&tmpfloat, offset + numBytesPerElement * index, numBytesPerElement);
+        return tmpfloat;
+    }
+    case BITFIELD:
+    {
+        quint8 tmpbitfield;
+        obj->readSnapshot(&tmpbitfield, offset + numBytesPerElement * ((quint32)(index / 8)), numBytesPerElement);
+        return (tmpbitfield >> (index % 8)) & 1;
+    }
+    case STRING:
+        break;
+    }
+    return 0.0;
+}
+
 void UAVObjectField::setDouble(double value, quint32 index)
 {
     setValue(QVariant(value), index);
@@ -0,0 +1,296 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectnotificationhub.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Coalesced, rate limited object update notifications
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "uavobjectnotificationhub.h"
+
+#include <QDebug>
+
+UAVObjectNotificationHub::UAVObjectNotificationHub(QObject *parent) : QObject(parent),
+    m_lastHeartbeat(0), m_lastLog(0), m_logMaxLagMs(0), m_flushQueued(false), m_statsStart(0)
+{
+    m_stats    = Statistics();
+    m_logStats = Statistics();
+    m_clock.start();
+
+    m_flushTimer.setSingleShot(true);
+    connect(&m_flushTimer, SIGNAL(timeout()), this, SLOT(flush()));
+
+    m_heartbeatTimer.setInterval(HEARTBEAT_PERIOD_MS);
+    connect(&m_heartbeatTimer, SIGNAL(timeout()), this, SLOT(heartbeat()));
+    m_heartbeatTimer.start();
+}
+
+UAVObjectNotificationHub::~UAVObjectNotificationHub()
+{}
+
+/**
+ * Subscribe to coalesced updates of an object.
+ * @param obj The object
+ * @param receiver Object the slot is called on, in the GUI thread
+ * @param slot Slot taking a UAVObject *, as given by SLOT()
+ * @param maxRate Maximum number of calls per second, 0 for once per event loop iteration
+ * @returns false if the receiver has no such slot
+ */
+bool UAVObjectNotificationHub::subscribe(UAVObject *obj, QObject *receiver, const char *slot, int maxRate)
+{
+    Q_ASSERT(obj && receiver && slot);
+
+    // skip the code added by the SLOT() macro
+    if (*slot == '1' || *slot == '2') {
+        ++slot;
+    }
+    QByteArray signature = QMetaObject::normalizedSignature(slot);
+    int index = receiver->metaObject()->indexOfMethod(signature.constData());
+    if (index < 0) {
+        qWarning() << "UAVObjectNotificationHub::subscribe no such slot" << signature << "in" << receiver->metaObject()->className();
+        return false;
+    }
+
+    removeSubscriptions(obj, receiver);
+
+    Subscription subscription;
+    subscription.receiver = receiver;
+    subscription.method   = receiver->metaObject()->method(index);
+    subscription.interval = (maxRate > 0) ? 1000 / maxRate : 0;
+    subscription.lastCall = -subscription.interval;
+    subscription.pending  = false;
+
+    QList<Subscription> &subscriptions = m_subscriptions[obj];
+    if (subscriptions.isEmpty()) {
+        // direct: the object may be updated from another thread, only the flag is set there
+        connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectUpdated(UAVObject *)), Qt::DirectConnection);
+    }
+    subscriptions.append(subscription);
+
+    connect(receiver, SIGNAL(destroyed(QObject *)), this, SLOT(receiverDestroyed(QObject *)), Qt::UniqueConnection);
+    return true;
+}
+
+/**
+ * Stop the notifications of an object to a receiver.
+ */
+void UAVObjectNotificationHub::unsubscribe(UAVObject *obj, QObject *receiver)
+{
+    removeSubscriptions(obj, receiver);
+}
+
+/**
+ * Stop all notifications to a receiver.
+ */
+void UAVObjectNotificationHub::unsubscribe(QObject *receiver)
+{
+    removeSubscriptions(NULL, receiver);
+}
+
+/**
+ * Statistics since the last reset.
+ */
+UAVObjectNotificationHub::Statistics UAVObjectNotificationHub::getStatistics()
+{
+    QMutexLocker locker(&m_mutex);
+    Statistics stats = m_stats;
+
+    stats.elapsedMs = m_clock.elapsed() - m_statsStart;
+    return stats;
+}
+
+void UAVObjectNotificationHub::resetStatistics()
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_stats      = Statistics();
+    m_logStats   = Statistics();
+    m_statsStart = m_clock.elapsed();
+}
+
+/**
+ * Called in the thread updating the object, records the update and
+ * schedules a flush for the next event loop iteration of the GUI thread.
+ */
+void UAVObjectNotificationHub::objectUpdated(UAVObject *obj)
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_stats.updates++;
+    m_updated.insert(obj);
+    if (!m_flushQueued) {
+        m_flushQueued = true;
+        QMetaObject::invokeMethod(this, "flush", Qt::QueuedConnection);
+    }
+}
+
+/**
+ * Call the subscribers of the objects updated since the last flush that
+ * are due, and arm the timer for the ones that were rate limited.
+ */
+void UAVObjectNotificationHub::flush()
+{
+    QSet<UAVObject *> updated;
+    {
+        QMutexLocker locker(&m_mutex);
+        updated.swap(m_updated);
+        m_flushQueued = false;
+    }
+
+    foreach(UAVObject * obj, updated) {
+        QHash<UAVObject *, QList<Subscription> >::iterator it = m_subscriptions.find(obj);
+        if (it != m_subscriptions.end()) {
+            for (int i = 0; i < it->size(); ++i) {
+                (*it)[i].pending = true;
+            }
+        }
+    }
+    updated.unite(m_deferred);
+    m_deferred.clear();
+
+    struct Call {
+        UAVObject *obj;
+        QPointer<QObject> receiver;
+        QMetaMethod method;
+    };
+    QList<Call> calls;
+    qint64 now     = m_clock.elapsed();
+    qint64 nextDue = -1;
+
+    foreach(UAVObject * obj, updated) {
+        QHash<UAVObject *, QList<Subscription> >::iterator it = m_subscriptions.find(obj);
+        if (it == m_subscriptions.end()) {
+            continue;
+        }
+        for (int i = 0; i < it->size(); ++i) {
+            Subscription &subscription = (*it)[i];
+            qint64 due = subscription.lastCall + subscription.interval;
+            if (!subscription.pending) {
+                continue;
+            } else if (due <= now) {
+                Call call = { obj, subscription.receiver, subscription.method };
+                calls.append(call);
+                subscription.lastCall = now;
+                subscription.pending  = false;
+            } else {
+                m_deferred.insert(obj);
+                if (nextDue < 0 || due < nextDue) {
+                    nextDue = due;
+                }
+            }
+        }
+    }
+
+    // slots may subscribe or unsubscribe, the calls are made after the walk
+    QElapsedTimer slotTime;
+    slotTime.start();
+    foreach(const Call &call, calls) {
+        if (call.receiver) {
+            call.method.invoke(call.receiver, Qt::DirectConnection, Q_ARG(UAVObject *, call.obj));
+        }
+    }
+
+    if (nextDue >= 0 && (!m_flushTimer.isActive() || m_flushTimer.remainingTime() > nextDue - now)) {
+        m_flushTimer.start((int)qMax<qint64>(nextDue - now, 1));
+    }
+
+    if (!calls.isEmpty()) {
+        QMutexLocker locker(&m_mutex);
+        m_stats.notifications += calls.size();
+        m_stats.frames++;
+        m_stats.slotTimeUs    += slotTime.nsecsElapsed() / 1000;
+    }
+}
+
+/**
+ * Measures how late the event loop runs this timer and logs the statistics
+ * when the GUI thread was overloaded.
+ */
+void UAVObjectNotificationHub::heartbeat()
+{
+    qint64 now = m_clock.elapsed();
+
+    if (m_lastHeartbeat) {
+        qint64 lag = now - m_lastHeartbeat - HEARTBEAT_PERIOD_MS;
+        QMutexLocker locker(&m_mutex);
+        if (lag > m_stats.maxLagMs) {
+            m_stats.maxLagMs = lag;
+        }
+        if (lag > m_logMaxLagMs) {
+            m_logMaxLagMs = lag;
+        }
+    }
+    m_lastHeartbeat = now;
+
+    if (now - m_lastLog < LOG_PERIOD_MS) {
+        return;
+    }
+
+    Statistics stats = getStatistics();
+    if (m_logMaxLagMs > OVERLOAD_LAG_MS) {
+        qint64 period = now - m_lastLog;
+        qDebug() << "UAVObjectNotificationHub: GUI thread lagging up to" << m_logMaxLagMs << "ms,"
+                 << (stats.updates - m_logStats.updates) * 1000 / period << "updates/s,"
+                 << (stats.notifications - m_logStats.notifications) * 1000 / period << "notifications/s,"
+                 << (stats.slotTimeUs - m_logStats.slotTimeUs) / (10 * period) << "% in notification slots";
+    }
+    m_lastLog     = now;
+    m_logMaxLagMs = 0;
+    m_logStats    = stats;
+}
+
+void UAVObjectNotificationHub::receiverDestroyed(QObject *receiver)
+{
+    removeSubscriptions(NULL, receiver);
+}
+
+/**
+ * Remove the subscriptions of a receiver, to one object or to all if obj is NULL.
+ */
+void UAVObjectNotificationHub::removeSubscriptions(UAVObject *obj, QObject *receiver)
+{
+    QHash<UAVObject *, QList<Subscription> >::iterator it = m_subscriptions.begin();
+
+    while (it != m_subscriptions.end()) {
+        if (obj && it.key() != obj) {
+            ++it;
+            continue;
+        }
+        for (int i = it->size() - 1; i >= 0; --i) {
+            if (it->at(i).receiver == receiver) {
+                it->removeAt(i);
+            }
+        }
+        if (it->isEmpty()) {
+            disconnect(it.key(), SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectUpdated(UAVObject *)));
+            m_deferred.remove(it.key());
+            it = m_subscriptions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/**
+ * @}
+ * @}
+ */
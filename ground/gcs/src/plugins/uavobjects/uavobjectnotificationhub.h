@@ -0,0 +1,121 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectnotificationhub.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      Coalesced, rate limited object update notifications
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef UAVOBJECTNOTIFICATIONHUB_H
+#define UAVOBJECTNOTIFICATIONHUB_H
+
+#include "uavobjects_global.h"
+#include "uavobject.h"
+#include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QList>
+#include <QMutex>
+#include <QTimer>
+#include <QPointer>
+#include <QMetaMethod>
+#include <QElapsedTimer>
+
+/**
+ * Delivers object updates to display code at the rate it can use.
+ *
+ * objectUpdated is emitted for every packet received. Views (object browser,
+ * notifications, instruments) only need the latest value, at most a few
+ * times per second. A subscriber of the hub gets one call per event loop
+ * iteration for all the updates received in between, and not more often than
+ * the rate it asked for. The slot reads the current object data.
+ *
+ * Code that needs every update (logging, streaming, scope samples) keeps
+ * connecting to UAVObject::objectUpdated directly.
+ *
+ * The hub also measures the load of the GUI thread: the time spent in the
+ * subscriber slots and how late the event loop runs a periodic timer.
+ */
+class UAVOBJECTS_EXPORT UAVObjectNotificationHub : public QObject {
+    Q_OBJECT
+
+public:
+    typedef struct {
+        quint32 updates; // objectUpdated signals received
+        quint32 notifications; // slot calls made
+        quint32 frames; // event loop iterations that delivered notifications
+        qint64  slotTimeUs; // time spent in the subscriber slots
+        qint64  maxLagMs; // worst event loop lag
+        qint64  elapsedMs; // time covered by the statistics
+    } Statistics;
+
+    UAVObjectNotificationHub(QObject *parent = 0);
+    ~UAVObjectNotificationHub();
+
+    bool subscribe(UAVObject *obj, QObject *receiver, const char *slot, int maxRate);
+    void unsubscribe(UAVObject *obj, QObject *receiver);
+    void unsubscribe(QObject *receiver);
+
+    Statistics getStatistics();
+    void resetStatistics();
+
+private slots:
+    void objectUpdated(UAVObject *obj);
+    void flush();
+    void heartbeat();
+    void receiverDestroyed(QObject *receiver);
+
+private:
+    struct Subscription {
+        QObject    *receiver;
+        QMetaMethod method;
+        qint64      interval; // ms between calls
+        qint64      lastCall; // ms
+        bool pending;
+    };
+
+    static const int HEARTBEAT_PERIOD_MS = 100;
+    static const int LOG_PERIOD_MS       = 10000;
+    static const int OVERLOAD_LAG_MS     = 100;
+
+    // GUI thread only
+    QHash<UAVObject *, QList<Subscription> > m_subscriptions;
+    QSet<UAVObject *> m_deferred; // objects with rate limited notifications pending
+    QTimer m_flushTimer;
+    QTimer m_heartbeatTimer;
+    QElapsedTimer m_clock;
+    qint64 m_lastHeartbeat;
+    qint64 m_lastLog;
+    qint64 m_logMaxLagMs; // worst lag since the last log
+    Statistics m_logStats; // statistics at the last log
+
+    // shared with the threads emitting objectUpdated
+    QMutex m_mutex;
+    QSet<UAVObject *> m_updated;
+    bool m_flushQueued;
+    Statistics m_stats;
+    qint64 m_statsStart;
+
+    void removeSubscriptions(UAVObject *obj, QObject *receiver);
+};
+
+#endif // UAVOBJECTNOTIFICATIONHUB_H
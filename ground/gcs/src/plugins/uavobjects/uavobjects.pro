@@ -16,7 +16,8 @@ HEADERS += \
     uavdataobject.h \
     uavobjectfield.h \
     uavobjectsinit.h \
-    uavobjectsplugin.h
+    uavobjectsplugin.h \
+    uavobjectnotificationhub.h
 
 SOURCES += \
     uavobject.cpp \
@@ -24,7 +25,8 @@ SOURCES += \
     uavobjectmanager.cpp \
     uavdataobject.cpp \
     uavobjectfield.cpp \
-    uavobjectsplugin.cpp
+    uavobjectsplugin.cpp \
+    uavobjectnotificationhub.cpp
 
 OTHER_FILES += UAVObjects.pluginspec
 
@@ -69,6 +71,8 @@ UAVOBJS = \
     $${UAVOBJ_XML_DIR}/debuglogstatus.xml \
     $${UAVOBJ_XML_DIR}/ekfconfiguration.xml \
     $${UAVOBJ_XML_DIR}/ekfstatevariance.xml \
+    $${UAVOBJ_XML_DIR}/eventtracecontrol.xml \
+    $${UAVOBJ_XML_DIR}/eventtracedata.xml \
     $${UAVOBJ_XML_DIR}/faultsettings.xml \
     $${UAVOBJ_XML_DIR}/firmwareiapobj.xml \
     $${UAVOBJ_XML_DIR}/fixedwingpathfollowersettings.xml \
@@ -104,6 +108,7 @@ UAVOBJS = \
     $${UAVOBJ_XML_DIR}/mixerstatus.xml \
     $${UAVOBJ_XML_DIR}/mpugyroaccelsettings.xml \
     $${UAVOBJ_XML_DIR}/nedaccel.xml \
+    $${UAVOBJ_XML_DIR}/objectdigest.xml \
     $${UAVOBJ_XML_DIR}/objectpersistence.xml \
     $${UAVOBJ_XML_DIR}/oplinkreceiver.xml \
     $${UAVOBJ_XML_DIR}/oplinksettings.xml \
@@ -117,6 +122,7 @@ UAVOBJS = \
     $${UAVOBJ_XML_DIR}/pathstatus.xml \
     $${UAVOBJ_XML_DIR}/pathsummary.xml \
     $${UAVOBJ_XML_DIR}/perfcounter.xml \
+    $${UAVOBJ_XML_DIR}/perfcounterpercentiles.xml \
     $${UAVOBJ_XML_DIR}/pidstatus.xml \
     $${UAVOBJ_XML_DIR}/poilearnsettings.xml \
     $${UAVOBJ_XML_DIR}/poilocation.xml \
@@ -28,6 +28,7 @@
 #include "uavobjectsplugin.h"
 #include "uavobjectsinit.h"
 #include "uavobjectmanager.h"
+#include "uavobjectnotificationhub.h"
 
 UAVObjectsPlugin::UAVObjectsPlugin()
 {}
@@ -46,6 +47,8 @@ bool UAVObjectsPlugin::initialize(const QStringList & arguments, QString *errorS
     addAutoReleasedObject(objMngr);
     // Initialize UAVObjects
     UAVObjectsInitialize(objMngr);
+    // Coalesced update notifications for the views
+    addAutoReleasedObject(new UAVObjectNotificationHub());
     // Done
     Q_UNUSED(arguments);
     Q_UNUSED(errorString);
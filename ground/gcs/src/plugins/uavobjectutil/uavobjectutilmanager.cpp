@@ -47,10 +47,14 @@ UAVObjectUtilManager::UAVObjectUtilManager()
 {
     mutex     = new QMutex(QMutex::Recursive);
     saveState = IDLE;
+    staged    = 0;
+    singleSaves      = 0;
+    batchUnsupported = false;
+    batchUnsupportedFirmwareCRC = 0;
     failureTimer.stop();
     failureTimer.setSingleShot(true);
     failureTimer.setInterval(1000);
-    connect(&failureTimer, SIGNAL(timeout()), this, SLOT(objectPersistenceOperationFailed()));
+    connect(&failureTimer, SIGNAL(timeout()), this, SLOT(objectPersistenceOperationTimeout()));
 
     pm   = NULL;
     obm  = NULL;
@@ -97,39 +101,68 @@ void UAVObjectUtilManager::saveObjectToSD(UAVObject *obj)
     queue.enqueue(obj);
     qDebug() << "Enqueue object: " << obj->getName();
 
-
-    // If queue length is one, then start sending (call sendNextObject)
-    // Otherwise, do nothing, it's sending anyway
-    if (queue.length() == 1) {
-        saveNextObject();
+    // Start sending once the caller queued all objects it saves at once,
+    // if not sending anyway
+    if (saveState == IDLE) {
+        QTimer::singleShot(0, this, SLOT(saveNextObject()));
     }
 }
 
+/*
+   Save the next objects of the queue. Boards supporting it get up to
+   MAX_BATCH_OBJECTS objects staged and written in one flash transaction,
+   otherwise the objects are saved one by one.
+ */
 void UAVObjectUtilManager::saveNextObject()
 {
-    if (queue.isEmpty()) {
+    if (queue.isEmpty() || saveState != IDLE) {
+        return;
+    }
+
+    ObjectPersistence *objper = ObjectPersistence::GetInstance(getObjectManager());
+    connect(objper, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(objectPersistenceTransactionCompleted(UAVObject *, bool)));
+    connect(objper, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectPersistenceUpdated(UAVObject *)));
+    saveTime.start();
+
+    batch.clear();
+    if (singleSaves == 0 && !(batchUnsupported && getFirmwareCRC() == batchUnsupportedFirmwareCRC)) {
+        foreach(UAVObject * obj, queue) {
+            if (batch.size() == MAX_BATCH_OBJECTS) {
+                break;
+            }
+            // Saved twice, the second save goes into the next batch
+            bool duplicate = false;
+            foreach(UAVObject * batched, batch) {
+                duplicate |= (batched->getObjID() == obj->getObjID() && batched->getInstID() == obj->getInstID());
+            }
+            if (duplicate) {
+                break;
+            }
+            batch.append(obj);
+        }
+    }
+
+    if (batch.size() > 1) {
+        qDebug() << "Send staged save request of" << batch.size() << "objects to board";
+        staged    = 0;
+        saveState = STAGING;
+        sendObjectPersistence(ObjectPersistence::OPERATION_STAGE, ObjectPersistence::SELECTION_SINGLEOBJECT,
+                              batch.at(0)->getObjID(), batch.at(0)->getInstID());
         return;
     }
 
-    Q_ASSERT(saveState == IDLE);
+    batch.clear();
+    if (singleSaves > 0) {
+        singleSaves--;
+    }
 
     // Get next object from the queue
     UAVObject *obj = queue.head();
     qDebug() << "Send save object request to board " << obj->getName();
 
-    ObjectPersistence *objper = dynamic_cast<ObjectPersistence *>(getObjectManager()->getObject(ObjectPersistence::NAME));
-    connect(objper, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(objectPersistenceTransactionCompleted(UAVObject *, bool)));
-    connect(objper, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectPersistenceUpdated(UAVObject *)));
     saveState = AWAITING_ACK;
-    if (obj != NULL) {
-        ObjectPersistence::DataFields data;
-        data.Operation  = ObjectPersistence::OPERATION_SAVE;
-        data.Selection  = ObjectPersistence::SELECTION_SINGLEOBJECT;
-        data.ObjectID   = obj->getObjID();
-        data.InstanceID = obj->getInstID();
-        objper->setData(data);
-        objper->updated();
-    }
+    sendObjectPersistence(ObjectPersistence::OPERATION_SAVE, ObjectPersistence::SELECTION_SINGLEOBJECT,
+                          obj->getObjID(), obj->getInstID());
     // Now: we are going to get two "objectUpdated" messages (one coming from GCS, one coming from Flight, which
     // will confirm the object was properly received by both sides) and then one "transactionCompleted" indicating
     // that the Flight side did not only receive the object but it did receive it without error. Last we will get
@@ -137,6 +170,19 @@ void UAVObjectUtilManager::saveNextObject()
     // operation we asked for (saved, other).
 }
 
+void UAVObjectUtilManager::sendObjectPersistence(quint8 operation, quint8 selection, quint32 objectID, quint32 instanceID)
+{
+    ObjectPersistence *objper = ObjectPersistence::GetInstance(getObjectManager());
+    ObjectPersistence::DataFields data;
+
+    data.Operation  = operation;
+    data.Selection  = selection;
+    data.ObjectID   = objectID;
+    data.InstanceID = instanceID;
+    objper->setData(data);
+    objper->updated();
+}
+
 /**
  * @brief Process the transactionCompleted message from Telemetry indicating request sent successfully
  * @param[in] The object just transsacted.  Must be ObjectPersistance
@@ -144,25 +190,43 @@ void UAVObjectUtilManager::saveNextObject()
  *
  * After a failed transaction (usually timeout) resends the save request.  After a succesful
  * transaction will then wait for a save completed update from the autopilot.
+ * While staging a batch, the next object is staged as soon as the board acknowledged
+ * the previous one and the batch is saved once all objects are staged.
  */
 void UAVObjectUtilManager::objectPersistenceTransactionCompleted(UAVObject *obj, bool success)
 {
-    if (success) {
+    if (success && saveState == STAGING) {
+        if (++staged < batch.size()) {
+            sendObjectPersistence(ObjectPersistence::OPERATION_STAGE, ObjectPersistence::SELECTION_SINGLEOBJECT,
+                                  batch.at(staged)->getObjID(), batch.at(staged)->getInstID());
+        } else {
+            saveState = AWAITING_ACK;
+            sendObjectPersistence(ObjectPersistence::OPERATION_SAVE, ObjectPersistence::SELECTION_STAGEDOBJECTS,
+                                  0, batch.size());
+        }
+    } else if (success) {
         Q_ASSERT(obj->getName().compare("ObjectPersistence") == 0);
         Q_ASSERT(saveState == AWAITING_ACK);
         // Two things can happen:
         // Either the Object Save Request did actually go through, and then we should get in
         // "AWAITING_COMPLETED" mode, or the Object Save Request did _not_ go through, for example
         // because the object does not exist and then we will never get a subsequent update.
-        // For this reason, we will arm a 1 second timer to make provision for this and not block
-        // the queue:
+        // For this reason, we will arm a timer to make provision for this and not block
+        // the queue. Writing a batch takes longer.
         saveState = AWAITING_COMPLETED;
         disconnect(obj, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(objectPersistenceTransactionCompleted(UAVObject *, bool)));
-        failureTimer.start(2000); // Create a timeout
+        failureTimer.start(2000 + BATCH_OBJECT_TIMEOUT_MS * batch.size()); // Create a timeout
+    } else if (!batch.isEmpty()) {
+        // Can be caused by timeout errors on sending. Save the objects one by one.
+        qDebug() << "objectPersistenceTranscationCompleted (error) while saving" << batch.size() << "objects";
+        obj->disconnect(this);
+        saveState   = IDLE;
+        singleSaves = batch.size();
+        batch.clear();
+        saveNextObject();
     } else {
         // Can be caused by timeout errors on sending.  Forget it and send next.
         qDebug() << "objectPersistenceTranscationCompleted (error)";
-        UAVObject *obj = getObjectManager()->getObject(ObjectPersistence::NAME);
         obj->disconnect(this);
         queue.dequeue(); // We can now remove the object, it failed anyway.
         saveState = IDLE;
@@ -171,6 +235,20 @@ void UAVObjectUtilManager::objectPersistenceTransactionCompleted(UAVObject *obj,
     }
 }
 
+/**
+ * @brief No reply from the board to a save request. Firmware without batched
+ * saves does not reply to them, save one by one until other firmware is flashed.
+ */
+void UAVObjectUtilManager::objectPersistenceOperationTimeout()
+{
+    if (saveState == AWAITING_COMPLETED && !batch.isEmpty()) {
+        qDebug() << "Board does not support batched saves";
+        batchUnsupported = true;
+        batchUnsupportedFirmwareCRC = getFirmwareCRC();
+    }
+    objectPersistenceOperationFailed();
+}
+
 /**
  * @brief Object persistence operation failed, i.e. we never got an update
  * from the board saying "completed".
@@ -185,13 +263,20 @@ void UAVObjectUtilManager::objectPersistenceOperationFailed()
         ObjectPersistence *objectPersistence = ObjectPersistence::GetInstance(getObjectManager());
         Q_ASSERT(objectPersistence);
 
-        UAVObject *obj = queue.dequeue(); // We can now remove the object, it failed anyway.
-        Q_ASSERT(obj);
-
         objectPersistence->disconnect(this);
-
         saveState = IDLE;
-        emit saveCompleted(obj->getObjID(), false);
+
+        if (!batch.isEmpty()) {
+            // Retry the objects one by one, to fail only those that cannot be saved
+            qDebug() << "Save of" << batch.size() << "objects failed after" << saveTime.elapsed() << "ms, saving them one by one";
+            singleSaves = batch.size();
+            batch.clear();
+        } else {
+            UAVObject *obj = queue.dequeue(); // We can now remove the object, it failed anyway.
+            Q_ASSERT(obj);
+
+            emit saveCompleted(obj->getObjID(), false);
+        }
 
         saveNextObject();
     }
@@ -215,6 +300,31 @@ void UAVObjectUtilManager::objectPersistenceUpdated(UAVObject *obj)
     } else if (saveState == AWAITING_COMPLETED &&
                objectPersistence.Operation == ObjectPersistence::OPERATION_COMPLETED) {
         failureTimer.stop();
+        if (!batch.isEmpty()) {
+            // Check the batch was saved
+            if (objectPersistence.Selection != ObjectPersistence::SELECTION_STAGEDOBJECTS ||
+                objectPersistence.InstanceID != (quint32)batch.size()) {
+                objectPersistenceOperationFailed();
+                return;
+            }
+
+            obj->disconnect(this);
+            saveState = IDLE;
+            qDebug() << "Saved" << batch.size() << "objects in" << saveTime.elapsed() << "ms";
+
+            // The batch was taken from the head of the queue
+            QList<UAVObject *> saved = batch;
+            batch.clear();
+            for (int i = 0; i < saved.size(); i++) {
+                queue.dequeue();
+            }
+            foreach(UAVObject * savedObj, saved) {
+                emit saveCompleted(savedObj->getObjID(), true);
+            }
+            saveNextObject();
+            return;
+        }
+
         // Check right object saved
         UAVObject *savingObj = queue.head();
         if (objectPersistence.ObjectID != savingObj->getObjID()) {
@@ -225,6 +335,7 @@ void UAVObjectUtilManager::objectPersistenceUpdated(UAVObject *obj)
         obj->disconnect(this);
         queue.dequeue(); // We can now remove the object, it's done.
         saveState = IDLE;
+        qDebug() << "Saved" << savingObj->getName() << "in" << saveTime.elapsed() << "ms";
 
         emit saveCompleted(objectPersistence.ObjectID, true);
         saveNextObject();
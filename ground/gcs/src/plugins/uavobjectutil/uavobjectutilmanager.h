@@ -45,6 +45,7 @@
 #include <QMutex>
 #include <QQueue>
 #include <QDateTime>
+#include <QElapsedTimer>
 
 class UAVOBJECTUTIL_EXPORT UAVObjectUtilManager : public QObject {
     Q_OBJECT
@@ -75,11 +76,22 @@ signals:
     void saveCompleted(int objectID, bool status);
 
 private:
+    // Objects saved at once, UAVOBJ_MAX_SAVE_MULTIPLE on the board
+    static const int MAX_BATCH_OBJECTS = 16;
+    // Additional time allowed per object of a batch
+    static const int BATCH_OBJECT_TIMEOUT_MS = 250;
+
     QMutex *mutex;
     QQueue<UAVObject *> queue;
-    enum { IDLE, AWAITING_ACK, AWAITING_COMPLETED } saveState;
-    void saveNextObject();
+    enum { IDLE, STAGING, AWAITING_ACK, AWAITING_COMPLETED } saveState;
+    void sendObjectPersistence(quint8 operation, quint8 selection, quint32 objectID, quint32 instanceID);
     QTimer failureTimer;
+    QElapsedTimer saveTime;
+    QList<UAVObject *> batch; // head of the queue being saved at once
+    int staged; // objects of the batch staged on the board
+    int singleSaves; // objects at the head of the queue to save one by one
+    bool batchUnsupported;
+    quint32 batchUnsupportedFirmwareCRC;
 
     ExtensionSystem::PluginManager *pm;
     UAVObjectManager *obm;
@@ -89,7 +101,9 @@ private slots:
     // void transactionCompleted(UAVObject *obj, bool success);
     void objectPersistenceTransactionCompleted(UAVObject *obj, bool success);
     void objectPersistenceUpdated(UAVObject *obj);
+    void objectPersistenceOperationTimeout();
     void objectPersistenceOperationFailed();
+    void saveNextObject();
 };
 
 
@@ -0,0 +1,93 @@
+/**
+ ******************************************************************************
+ *
+ * @file       objectdigestcache.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief The UAVTalk protocol plugin
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "objectdigestcache.h"
+#include <utils/crc.h>
+
+ObjectDigestCache::ObjectDigestCache() :
+    numHits(0)
+{}
+
+/**
+ * Forget the data and digests of the previously connected board
+ */
+void ObjectDigestCache::clear()
+{
+    stored.clear();
+    current.clear();
+    digests.clear();
+    numHits = 0;
+}
+
+/**
+ * Set the data as read from the cache file of the board
+ */
+void ObjectDigestCache::setStored(const QMap<quint32, QByteArray> &data)
+{
+    stored = data;
+}
+
+/**
+ * Set the digest the board reported for an object
+ */
+void ObjectDigestCache::setDigest(quint32 objId, quint32 digest)
+{
+    digests.insert(objId, digest);
+}
+
+/**
+ * Get the cached data of an object if it is the same as on the board.
+ * \param[in] objId The object ID
+ * \param[in] size The size of the object data
+ * \param[out] data The cached data
+ * \return true on a hit, false if the object has to be requested
+ */
+bool ObjectDigestCache::take(quint32 objId, int size, QByteArray &data)
+{
+    if (!digests.contains(objId)) {
+        return false;
+    }
+
+    const QByteArray cached = stored.value(objId);
+    if (cached.size() != size ||
+        Utils::Crc::updateCRC32(0, (const quint8 *)cached.constData(), cached.size()) != digests.value(objId)) {
+        return false;
+    }
+
+    data = cached;
+    current.insert(objId, cached);
+    numHits++;
+    return true;
+}
+
+/**
+ * Keep the data of an object retrieved from the board
+ */
+void ObjectDigestCache::update(quint32 objId, const QByteArray &data)
+{
+    current.insert(objId, data);
+}
@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ *
+ * @file       objectdigestcache.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief The UAVTalk protocol plugin
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OBJECTDIGESTCACHE_H
+#define OBJECTDIGESTCACHE_H
+
+#include <QMap>
+#include <QHash>
+#include <QByteArray>
+
+/**
+ * Settings data of one board by object ID. Cached data is only used when its
+ * CRC32 matches the digest the board reports for the object, so settings
+ * changed on the board since they were cached are requested again.
+ */
+class ObjectDigestCache {
+public:
+    ObjectDigestCache();
+
+    void clear();
+    void setStored(const QMap<quint32, QByteArray> &data);
+    void setDigest(quint32 objId, quint32 digest);
+    bool take(quint32 objId, int size, QByteArray &data);
+    void update(quint32 objId, const QByteArray &data);
+
+    /**
+     * Data to store for the next connection, the objects taken from the
+     * cache and the ones retrieved from the board. Objects not seen during
+     * this connection are dropped.
+     */
+    const QMap<quint32, QByteArray> &toStore() const
+    {
+        return current;
+    }
+
+    int hits() const
+    {
+        return numHits;
+    }
+
+private:
+    QMap<quint32, QByteArray> stored;
+    QMap<quint32, QByteArray> current;
+    QHash<quint32, quint32> digests;
+    int numHits;
+};
+
+#endif // OBJECTDIGESTCACHE_H
@@ -0,0 +1,68 @@
+/**
+ ******************************************************************************
+ *
+ * @file       requestwindow.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief The UAVTalk protocol plugin
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef REQUESTWINDOW_H
+#define REQUESTWINDOW_H
+
+#include <QtGlobal>
+
+/**
+ * Number of object requests in flight. The window grows by one on each
+ * completed request and is halved on each timeout (AIMD).
+ */
+class RequestWindow {
+public:
+    RequestWindow(int min, int max) : min(min), max(max), current(min)
+    {}
+
+    void reset()
+    {
+        current = min;
+    }
+
+    void completed()
+    {
+        current = qMin(current + 1, max);
+    }
+
+    void timedOut()
+    {
+        current = qMax(current / 2, min);
+    }
+
+    int size() const
+    {
+        return current;
+    }
+
+private:
+    int min;
+    int max;
+    int current;
+};
+
+#endif // REQUESTWINDOW_H
@@ -79,10 +79,11 @@ public:
     void resetStats();
     void transactionTimeout(ObjectTransactionInfo *info);
 
-private:
     // Constants
     static const int REQ_TIMEOUT_MS = 250;
     static const int MAX_RETRIES    = 2;
+
+private:
     static const int MAX_UPDATE_PERIOD_MS = 1000;
     static const int MIN_UPDATE_PERIOD_MS = 1;
     static const int MAX_QUEUE_SIZE = 20;
@@ -44,6 +44,8 @@ TelemetryManager::TelemetryManager() : QObject(), m_connectionState(TELEMETRY_DI
     // connect to start stop signals
     connect(this, SIGNAL(myStart()), this, SLOT(onStart()), Qt::QueuedConnection);
     connect(this, SIGNAL(myStop()), this, SLOT(onStop()), Qt::QueuedConnection);
+    // direct, called in the reader thread before it exits
+    connect(&m_telemetryReaderThread, SIGNAL(finished()), this, SLOT(onReaderThreadFinished()), Qt::DirectConnection);
 }
 
 TelemetryManager::~TelemetryManager()
@@ -77,26 +79,19 @@ void TelemetryManager::start(QIODevice *dev)
 void TelemetryManager::onStart()
 {
     m_uavTalk = new UAVTalk(m_telemetryDevice, m_uavobjectManager);
-    if (false) {
-        // UAVTalk must be thread safe and for that:
-        // 1- all public methods must lock a mutex
-        // 2- the reader thread must lock that mutex too
-        // The reader thread locks the mutex once a packet is read and decoded.
-        // It is assumed that the UAVObjectManager is thread safe
-
-        // Create the reader and move it to the reader thread
-        IODeviceReader *reader = new IODeviceReader(m_uavTalk);
-        reader->moveToThread(&m_telemetryReaderThread);
-        // The reader will be deleted (later) when the thread finishes
-        connect(&m_telemetryReaderThread, &QThread::finished, reader, &QObject::deleteLater);
-        // Connect IO device to reader
-        connect(m_telemetryDevice, SIGNAL(readyRead()), reader, SLOT(read()));
-        // start the reader thread
-        m_telemetryReaderThread.start();
-    } else {
-        // Connect IO device to reader
-        connect(m_telemetryDevice, SIGNAL(readyRead()), m_uavTalk, SLOT(processInputStream()));
-    }
+
+    // Read and decode on a dedicated thread, so that a burst of packets or a busy
+    // real time thread (shared with the network and simulator plugins) does not
+    // delay the reception. The device is accessed from that thread only, UAVTalk
+    // queues the packets sent from the other threads to it.
+    // UAVTalk is thread safe: all public methods and the decoding of a received
+    // packet lock its mutex. It is assumed that the UAVObjectManager is thread safe.
+    m_uavTalk->moveToThread(&m_telemetryReaderThread);
+    m_telemetryDevice->moveToThread(&m_telemetryReaderThread);
+    connect(m_telemetryDevice, SIGNAL(readyRead()), m_uavTalk, SLOT(processInputStream()));
+    m_telemetryReaderThread.start(QThread::TimeCriticalPriority);
+    // the device may have data buffered already
+    QMetaObject::invokeMethod(m_uavTalk, "processInputStream", Qt::QueuedConnection);
 
     m_telemetry = new Telemetry(m_uavTalk, m_uavobjectManager);
     m_telemetryMonitor = new TelemetryMonitor(m_uavobjectManager, m_telemetry);
@@ -111,11 +106,6 @@ void TelemetryManager::stop()
     m_connectionState = TELEMETRY_DISCONNECTING;
     emit disconnecting();
     emit myStop();
-
-    if (false) {
-        m_telemetryReaderThread.quit();
-        m_telemetryReaderThread.wait();
-    }
 }
 
 void TelemetryManager::onStop()
@@ -123,10 +113,24 @@ void TelemetryManager::onStop()
     m_telemetryMonitor->disconnect(this);
     delete m_telemetryMonitor;
     delete m_telemetry;
+    m_telemetryReaderThread.quit();
+    m_telemetryReaderThread.wait();
     delete m_uavTalk;
     onDisconnect();
 }
 
+/**
+ * Give the device and UAVTalk back to the thread of the manager, the device is
+ * closed and deleted by the connection plugin after the telemetry stopped.
+ */
+void TelemetryManager::onReaderThreadFinished()
+{
+    m_uavTalk->moveToThread(thread());
+    if (m_telemetryDevice) {
+        m_telemetryDevice->moveToThread(thread());
+    }
+}
+
 void TelemetryManager::onConnect()
 {
     m_connectionState = TELEMETRY_CONNECTED;
@@ -143,11 +147,3 @@ void TelemetryManager::onTelemetryUpdate(double txRate, double rxRate)
 {
     emit telemetryUpdated(txRate, rxRate);
 }
-
-IODeviceReader::IODeviceReader(UAVTalk *uavTalk) : m_uavTalk(uavTalk)
-{}
-
-void IODeviceReader::read()
-{
-    m_uavTalk->processInputStream();
-}
@@ -34,6 +34,8 @@
 #include "uavobjectmanager.h"
 #include <QIODevice>
 #include <QObject>
+#include <QPointer>
+#include <QThread>
 
 class Telemetry;
 class TelemetryMonitor;
@@ -72,27 +74,16 @@ private slots:
     void onTelemetryUpdate(double txRate, double rxRate);
     void onStart();
     void onStop();
+    void onReaderThreadFinished();
 
 private:
     UAVObjectManager *m_uavobjectManager;
     UAVTalk *m_uavTalk;
     Telemetry *m_telemetry;
     TelemetryMonitor *m_telemetryMonitor;
-    QIODevice *m_telemetryDevice;
+    QPointer<QIODevice> m_telemetryDevice;
     ConnectionState m_connectionState;
     QThread m_telemetryReaderThread;
 };
 
-
-class IODeviceReader : public QObject {
-    Q_OBJECT
-public:
-    IODeviceReader(UAVTalk *uavTalk);
-
-    UAVTalk *m_uavTalk;
-
-public slots:
-    void read();
-};
-
 #endif // TELEMETRY_MANAGER_H
@@ -27,8 +27,15 @@
  */
 
 #include "telemetrymonitor.h"
+#include "objectdigest.h"
 #include "coreplugin/connectionmanager.h"
 #include "coreplugin/icore.h"
+#include <utils/pathutils.h>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDataStream>
 
 /**
  * Constructor
@@ -40,9 +47,11 @@ TelemetryMonitor::TelemetryMonitor(UAVObjectManager *objMngr, Telemetry *tel) :
     flightStatsObj(FlightTelemetryStats::GetInstance(objMngr)),
     firmwareIAPObj(FirmwareIAPObj::GetInstance(objMngr)),
     statsTimer(new QTimer(this)),
-    objPending(NULL),
     mutex(new QMutex(QMutex::Recursive)),
-    connectionTimer(new QTime())
+    connectionTimer(new QTime()),
+    window(MIN_PENDING_REQUESTS, MAX_PENDING_REQUESTS),
+    digestsPending(false),
+    digestsValid(false)
 {
     // Listen for flight stats updates
     connect(flightStatsObj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(flightStatsUpdated(UAVObject *)));
@@ -64,11 +73,18 @@ TelemetryMonitor::~TelemetryMonitor()
 
 /**
  * Initiate object retrieval, initialize queue with objects to be retrieved.
+ * The board UID and the settings digests are requested first, the settings
+ * found unchanged in the cache of that board are not requested.
  */
 void TelemetryMonitor::startRetrievingObjects()
 {
     // Clear object queue
     queue.clear();
+    pending.clear();
+    retried.clear();
+    cache.clear();
+    window.reset();
+    retrievalTime.start();
     // Get all objects, add metaobjects, settings and data objects with OnChange update mode to the queue
     QList< QList<UAVObject *> > objs = objMngr->getObjects();
     for (int n = 0; n < objs.length(); ++n) {
@@ -76,6 +92,10 @@ void TelemetryMonitor::startRetrievingObjects()
         UAVMetaObject *mobj = dynamic_cast<UAVMetaObject *>(obj);
         UAVDataObject *dobj = dynamic_cast<UAVDataObject *>(obj);
         UAVObject::Metadata mdata = obj->getMetadata();
+        if (obj == firmwareIAPObj) {
+            // requested below
+            continue;
+        }
         if (mobj != NULL) {
             queue.enqueue(obj);
         } else if (dobj != NULL) {
@@ -90,7 +110,15 @@ void TelemetryMonitor::startRetrievingObjects()
     }
     // Start retrieving
     qDebug() << "TelemetryMonitor::startRetrievingObjects - retrieving" << queue.length() << "objects";
-    retrieveNextObject();
+    // Forget the digests of the previously connected board
+    foreach(UAVObject * inst, objMngr->getObjectInstances(ObjectDigest::OBJID)) {
+        QByteArray zeros(inst->getNumBytes(), 0);
+        inst->unpack((const quint8 *)zeros.constData());
+    }
+    digestsPending = true;
+    digestsValid   = false;
+    requestObject(firmwareIAPObj, false);
+    requestObject(ObjectDigest::GetInstance(objMngr), true);
 }
 
 /**
@@ -100,34 +128,53 @@ void TelemetryMonitor::stopRetrievingObjects()
 {
     qDebug() << "TelemetryMonitor::stopRetrievingObjects - object retrieval has been cancelled";
     queue.clear();
+    foreach(UAVObject * obj, pending.keys()) {
+        obj->disconnect(this);
+    }
+    pending.clear();
+    digestsPending = false;
 }
 
 /**
- * Retrieve the next object in the queue
+ * Request an object and wait for its transactionCompleted
  */
-void TelemetryMonitor::retrieveNextObject()
+void TelemetryMonitor::requestObject(UAVObject *obj, bool allInstances)
 {
-    // If queue is empty return
-    if (queue.isEmpty()) {
-        qDebug() << "TelemetryMonitor::retrieveNextObject - object retrieval completed";
-        if (firmwareIAPObj->getBoardType()) {
-            emit connected();
-        } else {
-            connect(firmwareIAPObj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(firmwareIAPUpdated(UAVObject *)));
-        }
-        return;
-    }
-
-    // Get next object from the queue
-    UAVObject *obj = queue.dequeue();
-    // qDebug( tr("Retrieving object: %1").arg(obj->getName()) );
-
     // Connect to object
     connect(obj, SIGNAL(transactionCompleted(UAVObject *, bool)), this, SLOT(transactionCompleted(UAVObject *, bool)));
 
+    pending.insert(obj, QTime::currentTime());
+
     // Request update
-    obj->requestUpdate();
-    objPending = obj;
+    if (allInstances) {
+        obj->requestUpdateAll();
+    } else {
+        obj->requestUpdate();
+    }
+}
+
+/**
+ * Keep requesting objects from the queue until the window is full
+ */
+void TelemetryMonitor::retrieveNextObjects()
+{
+    while (pending.size() < window.size() && !queue.isEmpty()) {
+        requestObject(queue.dequeue(), false);
+    }
+
+    // Done when the queue is empty and all requests completed
+    if (!queue.isEmpty() || !pending.isEmpty()) {
+        return;
+    }
+
+    qDebug() << "TelemetryMonitor::retrieveNextObjects - object retrieval completed in" << retrievalTime.elapsed()
+             << "ms," << cache.hits() << "settings objects from the cache";
+    saveObjectCache();
+    if (firmwareIAPObj->getBoardType()) {
+        emit connected();
+    } else {
+        connect(firmwareIAPObj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(firmwareIAPUpdated(UAVObject *)));
+    }
 }
 
 /**
@@ -135,24 +182,121 @@ void TelemetryMonitor::retrieveNextObject()
  */
 void TelemetryMonitor::transactionCompleted(UAVObject *obj, bool success)
 {
-    Q_UNUSED(success);
     QMutexLocker locker(mutex);
 
-    if (obj == objPending) {
-        // Disconnect from sending object
-        obj->disconnect(this);
-        objPending = NULL;
+    if (!pending.contains(obj)) {
+        qCritical() << "TelemetryMonitor::transactionCompleted - unexpected object" << obj;
+        return;
+    }
 
-        // Process next object if telemetry is still available
-        GCSTelemetryStats::DataFields gcsStats = gcsStatsObj->getData();
-        if (gcsStats.Status == GCSTelemetryStats::STATUS_CONNECTED) {
-            retrieveNextObject();
+    // Disconnect from sending object
+    obj->disconnect(this);
+    int elapsed = pending.take(obj).msecsTo(QTime::currentTime());
+
+    UAVDataObject *dobj = dynamic_cast<UAVDataObject *>(obj);
+    if (success) {
+        window.completed();
+        if (obj->getObjID() == ObjectDigest::OBJID) {
+            digestsValid = true;
+        }
+        if (dobj && dobj->isSettingsObject() && dobj->isSingleInstance()) {
+            QByteArray data(obj->getNumBytes(), 0);
+            obj->pack((quint8 *)data.data());
+            cache.update(obj->getObjID(), data);
+        }
+    } else if (elapsed >= Telemetry::REQ_TIMEOUT_MS * (Telemetry::MAX_RETRIES + 1)) {
+        // Timed out, too many requests for the link. A quick failure is
+        // a NACK for an object the board does not have and is not retried.
+        window.timedOut();
+        if (!digestsPending && !retried.contains(obj)) {
+            retried.insert(obj);
+            queue.enqueue(obj);
+        }
+    }
+
+    // Process next objects if telemetry is still available
+    GCSTelemetryStats::DataFields gcsStats = gcsStatsObj->getData();
+    if (gcsStats.Status != GCSTelemetryStats::STATUS_CONNECTED) {
+        stopRetrievingObjects();
+        return;
+    }
+
+    if (digestsPending) {
+        if (!pending.isEmpty()) {
+            return;
+        }
+        digestsPending = false;
+        applyObjectCache();
+    }
+    retrieveNextObjects();
+}
+
+/**
+ * Take the queued settings objects whose digest reported by the board matches
+ * the cached data out of the queue and load them from the cache. Boards without
+ * ObjectDigest or with a blank serial number get all objects requested.
+ */
+void TelemetryMonitor::applyObjectCache()
+{
+    FirmwareIAPObj::DataFields iapData = firmwareIAPObj->getData();
+    QByteArray serial((const char *)iapData.CPUSerial, FirmwareIAPObj::CPUSERIAL_NUMELEM);
+
+    cacheFile.clear();
+    if (!digestsValid || serial.count('\0') == serial.size()) {
+        return;
+    }
+    cacheFile = Utils::GetStoragePath() + "uavocache" + QDir::separator() + QString(serial.toHex()) + ".dat";
+
+    QMap<quint32, QByteArray> stored;
+    QFile file(cacheFile);
+    if (file.open(QIODevice::ReadOnly)) {
+        QDataStream in(&file);
+        in >> stored;
+    }
+    cache.setStored(stored);
+
+    foreach(UAVObject * inst, objMngr->getObjectInstances(ObjectDigest::OBJID)) {
+        ObjectDigest::DataFields digestData = static_cast<ObjectDigest *>(inst)->getData();
+
+        for (quint32 i = 0; i < ObjectDigest::OBJECTID_NUMELEM; i++) {
+            if (digestData.ObjectID[i]) {
+                cache.setDigest(digestData.ObjectID[i], digestData.Digest[i]);
+            }
+        }
+    }
+
+    QQueue<UAVObject *> remaining;
+    foreach(UAVObject * obj, queue) {
+        QByteArray data;
+
+        if (cache.take(obj->getObjID(), obj->getNumBytes(), data)) {
+            // Same as on the board
+            obj->unpack((const quint8 *)data.constData());
+            obj->setIsKnown(true);
         } else {
-            stopRetrievingObjects();
+            remaining.enqueue(obj);
         }
-    } else {
-        qCritical() << "TelemetryMonitor::retrieveNextObject - unexpected object" << obj;
     }
+    queue = remaining;
+}
+
+/**
+ * Write the settings of the board to its cache file
+ */
+void TelemetryMonitor::saveObjectCache()
+{
+    if (cacheFile.isEmpty() || cache.toStore().isEmpty()) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(cacheFile).absolutePath());
+    QFile file(cacheFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "TelemetryMonitor::saveObjectCache - could not write" << cacheFile;
+        return;
+    }
+    QDataStream out(&file);
+    out << cache.toStore();
 }
 
 /**
@@ -30,6 +30,10 @@
 
 #include <QObject>
 #include <QQueue>
+#include <QSet>
+#include <QHash>
+#include <QMap>
+#include <QByteArray>
 #include <QTimer>
 #include <QTime>
 #include <QMutex>
@@ -40,6 +44,8 @@
 #include "firmwareiapobj.h"
 #include "systemstats.h"
 #include "telemetry.h"
+#include "objectdigestcache.h"
+#include "requestwindow.h"
 
 class TelemetryMonitor : public QObject {
     Q_OBJECT
@@ -63,6 +69,9 @@ private:
     static const int STATS_UPDATE_PERIOD_MS  = 4000;
     static const int STATS_CONNECT_PERIOD_MS = 2000;
     static const int CONNECTION_TIMEOUT_MS   = 8000;
+    // Object requests in flight during the retrieval, see RequestWindow
+    static const int MIN_PENDING_REQUESTS    = 1;
+    static const int MAX_PENDING_REQUESTS    = 16;
 
     UAVObjectManager *objMngr;
     Telemetry *tel;
@@ -71,13 +80,24 @@ private:
     FlightTelemetryStats *flightStatsObj;
     FirmwareIAPObj *firmwareIAPObj;
     QTimer *statsTimer;
-    UAVObject *objPending;
     QMutex *mutex;
     QTime *connectionTimer;
+    QHash<UAVObject *, QTime> pending;
+    QSet<UAVObject *> retried;
+    RequestWindow window;
+    bool digestsPending;
+    bool digestsValid;
+    QTime retrievalTime;
+    // Settings data of the connected board, see applyObjectCache()
+    ObjectDigestCache cache;
+    QString cacheFile;
 
     void startRetrievingObjects();
-    void retrieveNextObject();
+    void requestObject(UAVObject *obj, bool allInstances);
+    void retrieveNextObjects();
     void stopRetrievingObjects();
+    void applyObjectCache();
+    void saveObjectCache();
 };
 
 #endif // TELEMETRYMONITOR_H
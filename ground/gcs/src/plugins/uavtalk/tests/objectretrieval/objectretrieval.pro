@@ -0,0 +1,27 @@
+# -------------------------------------------------
+# Unit tests of the settings cache and the request window of the
+# TelemetryMonitor, needs the Utils library of a built GCS tree.
+# -------------------------------------------------
+TEMPLATE = app
+TARGET = tst_objectretrieval
+QT += testlib
+QT -= gui
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+include(../../../../../gcs.pri)
+include(../../../../libs/utils/utils.pri)
+
+INCLUDEPATH += ../..
+
+linux-* {
+    QMAKE_RPATHDIR += $$GCS_LIBRARY_PATH
+}
+
+HEADERS += \
+    ../../objectdigestcache.h \
+    ../../requestwindow.h
+
+SOURCES += \
+    tst_objectretrieval.cpp \
+    ../../objectdigestcache.cpp
@@ -0,0 +1,237 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_objectretrieval.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief Tests of the settings cache and the request window used by the
+ *        TelemetryMonitor to retrieve the objects on connect.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "objectdigestcache.h"
+#include "requestwindow.h"
+#include <utils/crc.h>
+
+#include <QtCore/QObject>
+#include <QtTest/QtTest>
+
+static const quint32 OBJID_A = 0x12345678;
+static const quint32 OBJID_B = 0x9ABCDEF0;
+
+class tst_ObjectRetrieval : public QObject {
+    Q_OBJECT
+
+private slots:
+    void init();
+    void crc32();
+    void cacheHit();
+    void cacheMissWithoutDigest();
+    void cacheMissChangedOnBoard();
+    void cacheMissSizeChanged();
+    void cacheInvalidation();
+    void cacheClear();
+    void windowGrows();
+    void windowHalvesOnTimeout();
+    void windowReset();
+
+private:
+    QMap<quint32, QByteArray> stored;
+
+    static quint32 digest(const QByteArray &data)
+    {
+        return Utils::Crc::updateCRC32(0, (const quint8 *)data.constData(), data.size());
+    }
+};
+
+void tst_ObjectRetrieval::init()
+{
+    stored.clear();
+    stored.insert(OBJID_A, QByteArray("settings a"));
+    stored.insert(OBJID_B, QByteArray("settings b"));
+}
+
+/**
+ * Same result as PIOS_CRC32_updateCRC() on the flight side
+ */
+void tst_ObjectRetrieval::crc32()
+{
+    QCOMPARE(digest(QByteArray()), (quint32)0);
+    QCOMPARE(digest(QByteArray("123456789")), (quint32)0x89A1897F);
+}
+
+void tst_ObjectRetrieval::cacheHit()
+{
+    ObjectDigestCache cache;
+    QByteArray data;
+
+    cache.setStored(stored);
+    cache.setDigest(OBJID_A, digest(stored.value(OBJID_A)));
+
+    QVERIFY(cache.take(OBJID_A, stored.value(OBJID_A).size(), data));
+    QCOMPARE(data, stored.value(OBJID_A));
+    QCOMPARE(cache.hits(), 1);
+    QCOMPARE(cache.toStore().value(OBJID_A), stored.value(OBJID_A));
+}
+
+/**
+ * Objects the board has no digest for, e.g. firmware without ObjectDigest
+ */
+void tst_ObjectRetrieval::cacheMissWithoutDigest()
+{
+    ObjectDigestCache cache;
+    QByteArray data;
+
+    cache.setStored(stored);
+
+    QVERIFY(!cache.take(OBJID_A, stored.value(OBJID_A).size(), data));
+    QVERIFY(data.isEmpty());
+    QCOMPARE(cache.hits(), 0);
+    QVERIFY(cache.toStore().isEmpty());
+}
+
+/**
+ * Settings changed on the board since they were cached, e.g. by another GCS
+ */
+void tst_ObjectRetrieval::cacheMissChangedOnBoard()
+{
+    ObjectDigestCache cache;
+    QByteArray data;
+
+    cache.setStored(stored);
+    cache.setDigest(OBJID_A, digest(QByteArray("settings A")));
+
+    QVERIFY(!cache.take(OBJID_A, stored.value(OBJID_A).size(), data));
+    QCOMPARE(cache.hits(), 0);
+}
+
+/**
+ * Object definition changed by a firmware upgrade
+ */
+void tst_ObjectRetrieval::cacheMissSizeChanged()
+{
+    ObjectDigestCache cache;
+    QByteArray data;
+
+    cache.setStored(stored);
+    cache.setDigest(OBJID_A, digest(stored.value(OBJID_A)));
+
+    QVERIFY(!cache.take(OBJID_A, stored.value(OBJID_A).size() + 4, data));
+    QCOMPARE(cache.hits(), 0);
+}
+
+/**
+ * The data retrieved on a miss replaces the stale data, objects not seen
+ * during the connection are not stored again
+ */
+void tst_ObjectRetrieval::cacheInvalidation()
+{
+    ObjectDigestCache cache;
+    QByteArray data;
+    const QByteArray board("settings A");
+
+    cache.setStored(stored);
+    cache.setDigest(OBJID_A, digest(board));
+
+    QVERIFY(!cache.take(OBJID_A, board.size(), data));
+    cache.update(OBJID_A, board);
+
+    QCOMPARE(cache.toStore().size(), 1);
+    QCOMPARE(cache.toStore().value(OBJID_A), board);
+
+    // Next connection, the board still has the same settings
+    ObjectDigestCache next;
+    next.setStored(cache.toStore());
+    next.setDigest(OBJID_A, digest(board));
+    next.setDigest(OBJID_B, digest(stored.value(OBJID_B)));
+
+    QVERIFY(next.take(OBJID_A, board.size(), data));
+    QCOMPARE(data, board);
+    QVERIFY(!next.take(OBJID_B, stored.value(OBJID_B).size(), data));
+    QCOMPARE(next.hits(), 1);
+}
+
+/**
+ * Nothing of the previously connected board is used for the next one
+ */
+void tst_ObjectRetrieval::cacheClear()
+{
+    ObjectDigestCache cache;
+    QByteArray data;
+
+    cache.setStored(stored);
+    cache.setDigest(OBJID_A, digest(stored.value(OBJID_A)));
+    QVERIFY(cache.take(OBJID_A, stored.value(OBJID_A).size(), data));
+
+    cache.clear();
+    QCOMPARE(cache.hits(), 0);
+    QVERIFY(cache.toStore().isEmpty());
+
+    cache.setStored(stored);
+    QVERIFY(!cache.take(OBJID_A, stored.value(OBJID_A).size(), data));
+}
+
+void tst_ObjectRetrieval::windowGrows()
+{
+    RequestWindow window(1, 16);
+
+    QCOMPARE(window.size(), 1);
+    for (int i = 2; i <= 16; i++) {
+        window.completed();
+        QCOMPARE(window.size(), i);
+    }
+    window.completed();
+    QCOMPARE(window.size(), 16);
+}
+
+void tst_ObjectRetrieval::windowHalvesOnTimeout()
+{
+    RequestWindow window(1, 16);
+
+    for (int i = 0; i < 15; i++) {
+        window.completed();
+    }
+    window.timedOut();
+    QCOMPARE(window.size(), 8);
+    window.timedOut();
+    QCOMPARE(window.size(), 4);
+    window.completed();
+    QCOMPARE(window.size(), 5);
+    window.timedOut();
+    QCOMPARE(window.size(), 2);
+    window.timedOut();
+    QCOMPARE(window.size(), 1);
+    window.timedOut();
+    QCOMPARE(window.size(), 1);
+}
+
+void tst_ObjectRetrieval::windowReset()
+{
+    RequestWindow window(1, 16);
+
+    window.completed();
+    window.completed();
+    window.reset();
+    QCOMPARE(window.size(), 1);
+}
+
+QTEST_APPLESS_MAIN(tst_ObjectRetrieval)
+
+#include "tst_objectretrieval.moc"
@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ *
+ * @file       main.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVTalkPlugin UAVTalk Plugin
+ * @{
+ * @brief      Replays a log through UAVTalk on a reader thread, as the
+ *             TelemetryManager does, and reports the frames the GUI thread
+ *             missed or got late.
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "uavtalk.h"
+#include "uavobjectmanager.h"
+#include "uavobjectsinit.h"
+#include <utils/logfile.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QThread>
+#include <QTimer>
+#include <QHash>
+#include <QMutex>
+#include <QTextStream>
+
+/**
+ * Follows every object from the reader thread (unpacks) and from the GUI
+ * thread (queued objectUpdated notifications).
+ *
+ * A notification carrying a sequence number already seen is stale: the value
+ * was delivered by an earlier one and skipped, as the generated objects do.
+ * A jump of the sequence number by more than one means values were replaced
+ * before the GUI thread got to them (dropped). A value delivered later than
+ * the budget after it was unpacked is late.
+ */
+class ReplayMonitor : public QObject {
+    Q_OBJECT
+
+public:
+    ReplayMonitor(qint64 budgetMs) : m_budgetNs(budgetMs * 1000000), m_unpacked(0), m_delivered(0),
+        m_stale(0), m_dropped(0), m_late(0), m_maxLatencyNs(0)
+    {
+        m_clock.start();
+    }
+
+    void watch(UAVObject *obj)
+    {
+        // direct, runs in the reader thread right after the data changed
+        connect(obj, SIGNAL(objectUnpacked(UAVObject *)), this, SLOT(unpacked(UAVObject *)), Qt::DirectConnection);
+        connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updated(UAVObject *)), Qt::QueuedConnection);
+    }
+
+    void report(QTextStream &out, const UAVTalk::ComStats &stats, qint64 elapsedMs)
+    {
+        QMutexLocker locker(&m_mutex);
+
+        out << "replayed " << stats.rxBytes << " bytes in " << elapsedMs << " ms" << endl;
+        out << "rx objects " << stats.rxObjects << ", errors " << stats.rxErrors
+            << ", crc errors " << stats.rxCrcErrors << ", sync errors " << stats.rxSyncErrors << endl;
+        out << "decoded frames    " << m_unpacked << endl;
+        out << "delivered to GUI  " << m_delivered << endl;
+        out << "stale, skipped    " << m_stale << endl;
+        out << "dropped           " << m_dropped << " (replaced before the GUI thread saw them)" << endl;
+        out << "late              " << m_late << " (over " << m_budgetNs / 1000000 << " ms), worst "
+            << m_maxLatencyNs / 1000000.0 << " ms" << endl;
+    }
+
+public slots:
+    void unpacked(UAVObject *obj)
+    {
+        QMutexLocker locker(&m_mutex);
+        Entry &entry = m_entries[obj];
+
+        m_unpacked++;
+        if (!entry.pendingSinceNs) {
+            entry.pendingSinceNs = m_clock.nsecsElapsed();
+        }
+    }
+
+    void updated(UAVObject *obj)
+    {
+        quint32 sequence = obj->getUpdateSequence();
+        QMutexLocker locker(&m_mutex);
+        Entry &entry = m_entries[obj];
+
+        if (entry.seen && sequence == entry.sequence) {
+            m_stale++;
+            return;
+        }
+        if (entry.seen && sequence - entry.sequence > 1) {
+            m_dropped += sequence - entry.sequence - 1;
+        }
+        entry.seen     = true;
+        entry.sequence = sequence;
+        m_delivered++;
+
+        if (entry.pendingSinceNs) {
+            qint64 latency = m_clock.nsecsElapsed() - entry.pendingSinceNs;
+            if (latency > m_budgetNs) {
+                m_late++;
+            }
+            m_maxLatencyNs = qMax(m_maxLatencyNs, latency);
+            entry.pendingSinceNs = 0;
+        }
+    }
+
+    void newInstance(UAVObject *obj)
+    {
+        watch(obj);
+    }
+
+private:
+    struct Entry {
+        Entry() : seen(false), sequence(0), pendingSinceNs(0) {}
+        bool    seen;
+        quint32 sequence;
+        qint64  pendingSinceNs; // oldest unpack not yet delivered
+    };
+
+    QElapsedTimer m_clock;
+    qint64 m_budgetNs;
+    QMutex m_mutex;
+    QHash<UAVObject *, Entry> m_entries;
+    quint32 m_unpacked;
+    quint32 m_delivered;
+    quint32 m_stale;
+    quint32 m_dropped;
+    quint32 m_late;
+    qint64 m_maxLatencyNs;
+};
+
+/**
+ * Keeps the GUI thread busy for a given time in every 20 ms frame,
+ * as widgets and instruments being repainted would.
+ */
+class GuiLoad : public QObject {
+    Q_OBJECT
+
+public:
+    GuiLoad(int loadMs) : m_loadMs(loadMs)
+    {
+        connect(&m_timer, SIGNAL(timeout()), this, SLOT(frame()));
+        if (m_loadMs > 0) {
+            m_timer.start(FRAME_MS);
+        }
+    }
+
+private slots:
+    void frame()
+    {
+        QElapsedTimer busy;
+
+        busy.start();
+        while (busy.elapsed() < m_loadMs) {
+            ;
+        }
+    }
+
+private:
+    static const int FRAME_MS = 20;
+    QTimer m_timer;
+    int m_loadMs;
+};
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QTextStream out(stdout);
+    QStringList args = a.arguments();
+
+    if (args.size() < 2) {
+        out << "usage: uavtalkreplay <file.opl> [speed=10] [gui load ms per 20 ms frame=5] [latency budget ms=50]" << endl;
+        return 1;
+    }
+    double speed  = (args.size() > 2) ? args.at(2).toDouble() : 10.0;
+    int loadMs    = (args.size() > 3) ? args.at(3).toInt() : 5;
+    int budgetMs  = (args.size() > 4) ? args.at(4).toInt() : 50;
+
+    UAVObjectManager *objMngr = new UAVObjectManager();
+    UAVObjectsInitialize(objMngr);
+
+    ReplayMonitor monitor(budgetMs);
+    foreach(QList<UAVObject *> instances, objMngr->getObjects()) {
+        foreach(UAVObject * obj, instances) {
+            monitor.watch(obj);
+        }
+    }
+    // instances are created by the reader thread
+    QObject::connect(objMngr, SIGNAL(newInstance(UAVObject *)), &monitor, SLOT(newInstance(UAVObject *)), Qt::DirectConnection);
+
+    LogFile *logFile = new LogFile();
+    logFile->setFileName(args.at(1));
+    if (!logFile->open(QIODevice::ReadOnly)) {
+        out << "cannot open " << args.at(1) << endl;
+        return 1;
+    }
+    logFile->setReplaySpeed(speed);
+
+    // same setup as TelemetryManager::onStart()
+    QThread readerThread;
+    UAVTalk *uavTalk = new UAVTalk(logFile, objMngr);
+    uavTalk->moveToThread(&readerThread);
+    logFile->moveToThread(&readerThread);
+    QObject::connect(logFile, SIGNAL(readyRead()), uavTalk, SLOT(processInputStream()));
+    readerThread.start(QThread::TimeCriticalPriority);
+
+    GuiLoad guiLoad(loadMs);
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    // leave the queued notifications time to drain before reporting
+    QObject::connect(logFile, &LogFile::replayFinished, &a, [&]() {
+        QTimer::singleShot(500, &a, SLOT(quit()));
+    }, Qt::QueuedConnection);
+    QTimer::singleShot(0, logFile, [logFile]() {
+        logFile->startReplay();
+    });
+
+    a.exec();
+
+    readerThread.quit();
+    readerThread.wait();
+    monitor.report(out, uavTalk->getStats(), elapsed.elapsed());
+
+    delete uavTalk;
+    delete logFile;
+    return 0;
+}
+
+#include "main.moc"
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,23 @@
+# -------------------------------------------------
+# UAVTalk replay stress test, built with the debug GCS, see plugins.pro.
+# usage: uavtalkreplay <file.opl> [speed] [gui load ms] [latency budget ms]
+# -------------------------------------------------
+TEMPLATE = app
+TARGET = uavtalkreplay
+QT += network
+QT -= gui
+CONFIG += console
+CONFIG -= app_bundle
+
+include(../../../../../gcs.pri)
+include(../../uavtalk.pri)
+include(../../../uavobjects/uavobjects.pri)
+
+INCLUDEPATH += ../.. $$GCS_SOURCE_TREE/src/libs $$GCS_SOURCE_TREE/src/plugins
+LIBS += -L$$GCS_PLUGIN_PATH/$$ORG_BIG_NAME
+
+linux-* {
+    QMAKE_RPATHDIR += $$GCS_LIBRARY_PATH $$GCS_PLUGIN_PATH/$$ORG_BIG_NAME
+}
+
+SOURCES += main.cpp
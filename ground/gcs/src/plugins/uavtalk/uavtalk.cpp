@@ -57,8 +57,8 @@ UAVTalk::UAVTalk(QIODevice *iodev, UAVObjectManager *objMngr) : io(iodev), objMn
     memset(&stats, 0, sizeof(ComStats));
 
     ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
-    Core::Internal::GeneralSettings *settings = pm->getObject<Core::Internal::GeneralSettings>();
-    useUDPMirror = settings->useUDPMirror();
+    Core::Internal::GeneralSettings *settings = pm ? pm->getObject<Core::Internal::GeneralSettings>() : NULL;
+    useUDPMirror = settings && settings->useUDPMirror();
     if (useUDPMirror) {
         qDebug() << "UAVTalk::UAVTalk -*** UDP mirror is enabled ***";
     }
@@ -210,30 +210,28 @@ bool UAVTalk::objectTransaction(quint8 type, quint32 objId, quint16 instId, UAVO
  */
 void UAVTalk::processInputStream()
 {
-    quint8 tmp;
-
     if (io && io->isReadable()) {
-        while (io->bytesAvailable() > 0) {
-            int ret = io->read((char *)&tmp, 1);
-            if (ret != -1) {
-                processInputByte(tmp);
-            } else {
-                // TODOD
-            }
-            if (rxState == STATE_COMPLETE) {
-                mutex.lock();
-                if (receiveObject(rxType, rxObjId, rxInstId, rxBuffer, rxLength)) {
-                    stats.rxObjectBytes += rxLength;
-                    stats.rxObjects++;
-                } else {
-                    // TODO...
-                }
-                mutex.unlock();
-
-                if (useUDPMirror) {
-                    // it is safe to do this outside of the above critical section as the rxDataArray is
-                    // accessed from this thread only
-                    udpSocketTx->writeDatagram(rxDataArray, QHostAddress::LocalHost, udpSocketRx->localPort());
+        // drain the device in chunks, a byte per read() is a function call
+        // chain through the device (and a lock for the serial port) per byte
+        qint64 count;
+        while ((count = io->read((char *)rxReadBuffer, sizeof(rxReadBuffer))) > 0) {
+            for (qint64 i = 0; i < count; ++i) {
+                processInputByte(rxReadBuffer[i]);
+                if (rxState == STATE_COMPLETE) {
+                    mutex.lock();
+                    if (receiveObject(rxType, rxObjId, rxInstId, rxBuffer, rxLength)) {
+                        stats.rxObjectBytes += rxLength;
+                        stats.rxObjects++;
+                    } else {
+                        // TODO...
+                    }
+                    mutex.unlock();
+
+                    if (useUDPMirror) {
+                        // it is safe to do this outside of the above critical section as the rxDataArray is
+                        // accessed from this thread only
+                        udpSocketTx->writeDatagram(rxDataArray, QHostAddress::LocalHost, udpSocketRx->localPort());
+                    }
                 }
             }
         }
@@ -621,6 +619,8 @@ UAVObject *UAVTalk::updateObject(quint32 objId, quint16 instId, quint8 *data)
         }
         // Create a new instance, unpack and register
         UAVDataObject *instObj = dataObj->clone(instId);
+        // created in the decoding thread, the instance belongs with its type
+        instObj->moveToThread(dataObj->thread());
         if (!objMngr->registerObject(instObj)) {
             qWarning() << "UAVTalk - failed to register object " << instObj->toStringBrief();
             return NULL;
@@ -788,11 +788,18 @@ bool UAVTalk::transmitSingleObject(quint8 type, quint32 objId, quint16 instId, U
     txBuffer[HEADER_LENGTH + length] = Crc::updateCRC(0, txBuffer, HEADER_LENGTH + length);
 
     // Send buffer, check that the transmit backlog does not grow above limit
+    qint32 packetLength = HEADER_LENGTH + length + CHECKSUM_LENGTH;
     if (!io.isNull() && io->isWritable()) {
-        if (io->bytesToWrite() < TX_BUFFER_SIZE) {
-            io->write((const char *)txBuffer, HEADER_LENGTH + length + CHECKSUM_LENGTH);
-            if (useUDPMirror) {
-                udpSocketRx->writeDatagram((const char *)txBuffer, HEADER_LENGTH + length + CHECKSUM_LENGTH, QHostAddress::LocalHost, udpSocketTx->localPort());
+        bool ioThread = (QThread::currentThread() == io->thread());
+        qint64 backlog = txQueued.load() + (ioThread ? io->bytesToWrite() : 0);
+        if (backlog < TX_BUFFER_SIZE) {
+            if (ioThread) {
+                writePacket(QByteArray::fromRawData((const char *)txBuffer, packetLength));
+            } else {
+                // the device is only accessed from the decoding thread, hand the packet over
+                txQueued.fetchAndAddOrdered(packetLength);
+                QMetaObject::invokeMethod(this, "writeQueuedPacket", Qt::QueuedConnection,
+                                          Q_ARG(QByteArray, QByteArray((const char *)txBuffer, packetLength)));
             }
         } else {
             qWarning() << "UAVTalk - error transmitting : io device full";
@@ -814,6 +821,29 @@ bool UAVTalk::transmitSingleObject(quint8 type, quint32 objId, quint16 instId, U
     return true;
 }
 
+/**
+ * Write a packet to the device, in the thread of the device.
+ */
+void UAVTalk::writePacket(const QByteArray &packet)
+{
+    if (io.isNull()) {
+        return;
+    }
+    io->write(packet);
+    if (useUDPMirror) {
+        udpSocketRx->writeDatagram(packet, QHostAddress::LocalHost, udpSocketTx->localPort());
+    }
+}
+
+/**
+ * Write a packet queued by transmitSingleObject() from another thread.
+ */
+void UAVTalk::writeQueuedPacket(QByteArray packet)
+{
+    txQueued.fetchAndAddOrdered(-packet.size());
+    writePacket(packet);
+}
+
 UAVTalk::Transaction *UAVTalk::findTransaction(quint32 objId, quint16 instId)
 {
     // Lookup the transaction in the transaction map
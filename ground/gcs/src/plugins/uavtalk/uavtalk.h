@@ -41,8 +41,6 @@
 class UAVTALK_EXPORT UAVTalk : public QObject {
     Q_OBJECT
 
-    friend class IODeviceReader;
-
 public:
     static const quint16 ALL_INSTANCES = 0xFFFF;
 
@@ -76,6 +74,7 @@ signals:
 private slots:
     void processInputStream();
     void dummyUDPRead();
+    void writeQueuedPacket(QByteArray packet);
 
 private:
 
@@ -105,6 +104,8 @@ private:
 
     static const int TX_BUFFER_SIZE     = 2 * 1024;
 
+    static const int RX_READ_SIZE       = 1024;
+
     // Types
     typedef enum {
         STATE_SYNC, STATE_TYPE, STATE_SIZE, STATE_OBJID, STATE_INSTID, STATE_DATA, STATE_CS, STATE_COMPLETE, STATE_ERROR
@@ -125,6 +126,11 @@ private:
 
     quint8 txBuffer[MAX_PACKET_LENGTH];
 
+    quint8 rxReadBuffer[RX_READ_SIZE];
+
+    // bytes sent from other threads and not yet written to the device
+    QAtomicInt txQueued;
+
     // Variables used by the receive state machine
     // state machine variables
     qint32 rxCount;
@@ -154,6 +160,7 @@ private:
     void updateNack(quint32 objId, quint16 instId, UAVObject *obj);
     bool transmitObject(quint8 type, quint32 objId, quint16 instId, UAVObject *obj);
     bool transmitSingleObject(quint8 type, quint32 objId, quint16 instId, UAVObject *obj);
+    void writePacket(const QByteArray &packet);
 
     Transaction *findTransaction(quint32 objId, quint16 instId);
     void openTransaction(quint8 type, quint32 objId, quint16 instId);
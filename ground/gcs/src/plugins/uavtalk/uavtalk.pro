@@ -16,6 +16,8 @@ HEADERS += \
     uavtalk.h \
     telemetry.h \
     telemetrymonitor.h \
+    objectdigestcache.h \
+    requestwindow.h \
     telemetrymanager.h \
     oplinkmanager.h \
     uavtalkplugin.h
@@ -24,6 +26,7 @@ SOURCES += \
     uavtalk.cpp \
     telemetry.cpp \
     telemetrymonitor.cpp \
+    objectdigestcache.cpp \
     telemetrymanager.cpp \
     oplinkmanager.cpp \
     uavtalkplugin.cpp
@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ *
+ * @file       columnwriter.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Writes the decoded objects to one set of files per object
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "columnwriter.h"
+
+#include <errno.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+ColumnWriter::ColumnWriter(const std::string &outputDir, unsigned outputs) :
+    m_outputDir(outputDir), m_outputs(outputs), m_bytesWritten(0), m_filesWritten(0), m_ok(true)
+{}
+
+ColumnWriter::~ColumnWriter()
+{
+    close();
+}
+
+bool ColumnWriter::makeDir(const std::string &path)
+{
+#ifdef _WIN32
+    int res = _mkdir(path.c_str());
+#else
+    int res = mkdir(path.c_str(), 0755);
+#endif
+    return res == 0 || errno == EEXIST;
+}
+
+/**
+ * Append the rows decoded for an object.
+ */
+bool ColumnWriter::write(const ObjectSchema *schema, const ObjectColumns &columns)
+{
+    ObjectFiles *files = open(schema);
+
+    if (!files) {
+        return false;
+    }
+    if (files->csv) {
+        m_ok = writeData(files->csv, columns.csv) && m_ok;
+    }
+    for (size_t n = 0; n < files->columns.size() && n < columns.columns.size(); n++) {
+        m_ok = writeData(files->columns[n], columns.columns[n]) && m_ok;
+    }
+    return m_ok;
+}
+
+/**
+ * Flush and close all files.
+ * @return false if anything could not be written
+ */
+bool ColumnWriter::close()
+{
+    for (std::map<uint32_t, ObjectFiles>::iterator it = m_files.begin(); it != m_files.end(); ++it) {
+        if (it->second.csv && fclose(it->second.csv)) {
+            m_ok = false;
+        }
+        for (size_t n = 0; n < it->second.columns.size(); n++) {
+            if (it->second.columns[n] && fclose(it->second.columns[n])) {
+                m_ok = false;
+            }
+        }
+    }
+    m_files.clear();
+    return m_ok;
+}
+
+ColumnWriter::ObjectFiles *ColumnWriter::open(const ObjectSchema *schema)
+{
+    std::map<uint32_t, ObjectFiles>::iterator it = m_files.find(schema->id);
+
+    if (it != m_files.end()) {
+        return &it->second;
+    }
+
+    ObjectFiles files;
+    std::vector<std::string> names = SchemaIndex::columnNames(schema);
+    std::string base = m_outputDir + "/" + schema->name;
+
+    files.csv = NULL;
+    if (m_outputs & OUTPUT_CSV) {
+        std::string header;
+        for (size_t n = 0; n < names.size(); n++) {
+            header += (n ? "," : "") + names[n];
+        }
+        header += '\n';
+        files.csv = openFile(base + ".csv");
+        if (!files.csv || !writeData(files.csv, header)) {
+            m_ok = false;
+        }
+    }
+    if (m_outputs & OUTPUT_BINARY) {
+        if (!makeDir(base)) {
+            fprintf(stderr, "cannot create %s\n", base.c_str());
+            m_ok = false;
+        }
+        std::vector<const char *> types;
+        types.push_back("uint32");
+        types.push_back("uint16");
+        for (int n = 0; n < schema->numFields; n++) {
+            for (int i = 0; i < schema->fields[n].numElements; i++) {
+                types.push_back(SchemaIndex::typeName(schema->fields[n].type));
+            }
+        }
+        for (size_t n = 0; n < names.size(); n++) {
+            FILE *file = openFile(base + "/" + names[n] + "." + types[n]);
+            if (!file) {
+                m_ok = false;
+            }
+            files.columns.push_back(file);
+        }
+    }
+    if (!m_ok) {
+        for (size_t n = 0; n < files.columns.size(); n++) {
+            if (files.columns[n]) {
+                fclose(files.columns[n]);
+            }
+        }
+        if (files.csv) {
+            fclose(files.csv);
+        }
+        return NULL;
+    }
+    return &(m_files[schema->id] = files);
+}
+
+FILE *ColumnWriter::openFile(const std::string &name)
+{
+    FILE *file = fopen(name.c_str(), "wb");
+
+    if (!file) {
+        fprintf(stderr, "cannot create %s\n", name.c_str());
+        return NULL;
+    }
+    setvbuf(file, NULL, _IOFBF, FILE_BUFFER_SIZE);
+    m_filesWritten++;
+    return file;
+}
+
+bool ColumnWriter::writeData(FILE *file, const std::string &data)
+{
+    if (data.empty()) {
+        return true;
+    }
+    m_bytesWritten += data.size();
+    return fwrite(data.data(), 1, data.size(), file) == data.size();
+}
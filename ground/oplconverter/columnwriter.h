@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ *
+ * @file       columnwriter.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Writes the decoded objects to one set of files per object
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef COLUMNWRITER_H
+#define COLUMNWRITER_H
+
+#include "opldecoder.h"
+
+#include <stdio.h>
+
+/**
+ * Output layout, for an object Name:
+ * - <dir>/Name.csv, header line then one line per packet
+ * - <dir>/Name/<column>.<type>, one raw little endian array per column,
+ *   e.g. timestamp.uint32 or Roll.float32, readable with numpy.fromfile()
+ * Files are created when the first packet of the object is written.
+ */
+class ColumnWriter {
+public:
+    ColumnWriter(const std::string &outputDir, unsigned outputs);
+    ~ColumnWriter();
+
+    bool write(const ObjectSchema *schema, const ObjectColumns &columns);
+    bool close();
+
+    uint64_t bytesWritten() const
+    {
+        return m_bytesWritten;
+    }
+
+    int filesWritten() const
+    {
+        return m_filesWritten;
+    }
+
+    static bool makeDir(const std::string &path);
+
+private:
+    struct ObjectFiles {
+        FILE *csv;
+        std::vector<FILE *> columns;
+    };
+
+    static const size_t FILE_BUFFER_SIZE = 256 * 1024;
+
+    std::string m_outputDir;
+    unsigned m_outputs;
+    std::map<uint32_t, ObjectFiles> m_files;
+    uint64_t m_bytesWritten;
+    int m_filesWritten;
+    bool m_ok;
+
+    ObjectFiles *open(const ObjectSchema *schema);
+    FILE *openFile(const std::string &name);
+    bool writeData(FILE *file, const std::string &data);
+};
+
+#endif // COLUMNWRITER_H
@@ -0,0 +1,387 @@
+/**
+ ******************************************************************************
+ *
+ * @file       main.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Converts .opl logs to per object columnar files
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ * The log is memory mapped and cut in chunks decoded in parallel, each
+ * chunk finding its first record on its own (see OplDecoder). The chunks are
+ * written in file order, a few ahead of the writer at most, so the output
+ * is the same whatever the number of threads and the memory used does not
+ * grow with the size of the log.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "opldecoder.h"
+#include "columnwriter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define RETURN_OK        0
+#define RETURN_ERR_USAGE 1
+#define RETURN_ERR_FILE  2
+
+// input bytes per decoding task
+#define CHUNK_SIZE       (4 * 1024 * 1024)
+
+using namespace std;
+
+static void usage()
+{
+    printf("Usage: oplconverter [-j threads] [-f csv|binary|all] [-o output_dir] log.opl\n");
+    printf("       oplconverter -s log.opl megabytes\n");
+    printf("\t-j threads      decoding threads, default: number of cores\n");
+    printf("\t-f format       csv: <dir>/<Object>.csv\n");
+    printf("\t                binary: <dir>/<Object>/<column>.<type> raw arrays\n");
+    printf("\t                all: both, default csv\n");
+    printf("\t-o output_dir   default: log name without .opl\n");
+    printf("\t-s              write a synthetic log of all the objects, for benchmarks\n");
+}
+
+/**
+ * Read only view of a whole file.
+ */
+class MappedFile {
+public:
+    MappedFile() : m_data(NULL), m_size(0)
+    {}
+
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (m_data && m_size) {
+            munmap((void *)m_data, m_size);
+        }
+#endif
+    }
+
+    bool open(const char *name)
+    {
+#ifdef _WIN32
+        // no mmap, the log is read in memory
+        ifstream file(name, ios::binary | ios::ate);
+        if (!file) {
+            return false;
+        }
+        m_buffer.resize(file.tellg());
+        file.seekg(0);
+        file.read((char *)m_buffer.data(), m_buffer.size());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return !file.fail();
+#else
+        int fd = ::open(name, O_RDONLY);
+        struct stat st;
+        if (fd < 0) {
+            return false;
+        }
+        if (fstat(fd, &st) < 0) {
+            ::close(fd);
+            return false;
+        }
+        m_size = st.st_size;
+        if (m_size) {
+            void *data = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                m_size = 0;
+                return false;
+            }
+            m_data = (const uint8_t *)data;
+            madvise(data, m_size, MADV_WILLNEED);
+        }
+        ::close(fd);
+        return true;
+#endif
+    }
+
+    const uint8_t *data() const
+    {
+        return m_data;
+    }
+
+    uint64_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    const uint8_t *m_data;
+    uint64_t m_size;
+#ifdef _WIN32
+    vector<uint8_t> m_buffer;
+#endif
+};
+
+/**
+ * Decoded chunks waiting to be written, in order.
+ */
+class ChunkQueue {
+public:
+    ChunkQueue(int chunks, int window) : m_decoders(chunks), m_nextChunk(0), m_written(0), m_window(window)
+    {}
+
+    // next chunk to decode, -1 when all are taken
+    int take()
+    {
+        unique_lock<mutex> lock(m_mutex);
+
+        m_cond.wait(lock, [this] {
+            return m_nextChunk >= (int)m_decoders.size() || m_nextChunk < m_written + m_window;
+        });
+        return (m_nextChunk < (int)m_decoders.size()) ? m_nextChunk++ : -1;
+    }
+
+    void done(int chunk, OplDecoder *decoder)
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        m_decoders[chunk].reset(decoder);
+        m_cond.notify_all();
+    }
+
+    // wait for a chunk, the previous ones must have been released
+    unique_ptr<OplDecoder> wait(int chunk)
+    {
+        unique_lock<mutex> lock(m_mutex);
+
+        m_cond.wait(lock, [this, chunk] {
+            return m_decoders[chunk] != NULL;
+        });
+        m_written = chunk + 1;
+        m_cond.notify_all();
+        return move(m_decoders[chunk]);
+    }
+
+private:
+    mutex m_mutex;
+    condition_variable m_cond;
+    vector<unique_ptr<OplDecoder> > m_decoders;
+    int m_nextChunk;
+    int m_written;
+    int m_window;
+};
+
+static int convert(const char *logName, const string &outputDir, unsigned outputs, int threads)
+{
+    MappedFile log;
+    SchemaIndex schemas;
+
+    if (!log.open(logName)) {
+        fprintf(stderr, "cannot open %s\n", logName);
+        return RETURN_ERR_FILE;
+    }
+    if (!ColumnWriter::makeDir(outputDir)) {
+        fprintf(stderr, "cannot create %s\n", outputDir.c_str());
+        return RETURN_ERR_FILE;
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int chunks = (int)((log.size() + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    ChunkQueue queue(chunks, 2 * threads);
+    vector<thread> workers;
+
+    for (int n = 0; n < threads; n++) {
+        workers.push_back(thread([&] {
+            int chunk;
+            while ((chunk = queue.take()) >= 0) {
+                OplDecoder *decoder = new OplDecoder(log.data(), log.size(), schemas, outputs);
+                uint64_t from = (uint64_t)chunk * CHUNK_SIZE;
+                decoder->decode(from, min<uint64_t>(from + CHUNK_SIZE, log.size()));
+                queue.done(chunk, decoder);
+            }
+        }));
+    }
+
+    ColumnWriter writer(outputDir, outputs);
+    DecodeStats stats;
+    uint64_t end = 0;
+    bool ok = true;
+    for (int chunk = 0; chunk < chunks; chunk++) {
+        unique_ptr<OplDecoder> decoder = queue.wait(chunk);
+        if (decoder->first() > end) {
+            stats.skippedBytes += decoder->first() - end;
+        }
+        end = max(end, decoder->end());
+        for (map<uint32_t, ObjectColumns>::const_iterator it = decoder->objects().begin(); it != decoder->objects().end(); ++it) {
+            ok = writer.write(schemas.find(it->first), it->second) && ok;
+        }
+        stats.add(decoder->stats());
+    }
+    stats.skippedBytes += log.size() - min(end, log.size());
+    for (size_t n = 0; n < workers.size(); n++) {
+        workers[n].join();
+    }
+    ok = writer.close() && ok;
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("%s: %llu records, %llu object packets, %llu other packets\n", logName,
+           (unsigned long long)stats.records, (unsigned long long)stats.packets, (unsigned long long)stats.otherPackets);
+    printf("skipped %llu bytes, %llu packets of unknown objects, %llu packets with a wrong size\n",
+           (unsigned long long)stats.skippedBytes, (unsigned long long)stats.unknownObjects, (unsigned long long)stats.sizeErrors);
+    printf("wrote %llu bytes to %d files in %s\n", (unsigned long long)writer.bytesWritten(), writer.filesWritten(), outputDir.c_str());
+    printf("%.2f s, %.1f MB/s with %d threads\n", seconds, log.size() / 1048576.0 / max(seconds, 1e-6), threads);
+
+    return ok ? RETURN_OK : RETURN_ERR_FILE;
+}
+
+/**
+ * Write a log of random but valid updates of all the objects, one packet per
+ * record as the GCS logs them, a record every millisecond.
+ */
+static int synthesize(const char *logName, uint64_t megabytes)
+{
+    FILE *file = fopen(logName, "wb");
+
+    if (!file) {
+        fprintf(stderr, "cannot create %s\n", logName);
+        return RETURN_ERR_FILE;
+    }
+
+    mt19937 random(1);
+    uniform_real_distribution<float> floats(-1000.0f, 1000.0f);
+    uint64_t size = megabytes * 1024 * 1024;
+    uint64_t written   = 0;
+    uint32_t timestamp = 0;
+    vector<uint8_t> record;
+    bool ok = true;
+
+    setvbuf(file, NULL, _IOFBF, 1024 * 1024);
+    while (ok && written < size) {
+        const ObjectSchema *schema = &uavObjectSchemas[random() % uavObjectSchemaCount];
+        int64_t length = OplDecoder::UAVTALK_HEADER_LENGTH + schema->numBytes + OplDecoder::UAVTALK_CHECKSUM_LENGTH;
+        uint16_t instance = schema->isSingleInst ? 0 : random() % 4;
+
+        record.resize(OplDecoder::RECORD_HEADER_LENGTH + length);
+        uint8_t *packet = &record[OplDecoder::RECORD_HEADER_LENGTH];
+        memcpy(&record[0], &timestamp, sizeof(timestamp));
+        memcpy(&record[4], &length, sizeof(length));
+        packet[0] = OplDecoder::UAVTALK_SYNC_VAL;
+        packet[1] = OplDecoder::UAVTALK_TYPE_OBJ;
+        packet[2] = (uint8_t)(length - 1);
+        packet[3] = (uint8_t)((length - 1) >> 8);
+        for (int n = 0; n < 4; n++) {
+            packet[4 + n] = (uint8_t)(schema->id >> (8 * n));
+        }
+        packet[8] = (uint8_t)instance;
+        packet[9] = (uint8_t)(instance >> 8);
+
+        uint8_t *data = &packet[OplDecoder::UAVTALK_HEADER_LENGTH];
+        for (int n = 0; n < schema->numFields; n++) {
+            const FieldSchema &field = schema->fields[n];
+            int typeSize = SchemaIndex::typeSize(field.type);
+            for (int i = 0; i < field.numElements; i++, data += typeSize) {
+                if (field.type == FIELD_FLOAT32) {
+                    float value = floats(random);
+                    memcpy(data, &value, sizeof(value));
+                } else if (field.type == FIELD_ENUM) {
+                    data[0] = field.numOptions ? random() % field.numOptions : 0;
+                } else {
+                    uint32_t value = random();
+                    memcpy(data, &value, typeSize);
+                }
+            }
+        }
+        packet[length - 1] = OplDecoder::crc8(0, packet, length - 1);
+
+        ok = fwrite(record.data(), 1, record.size(), file) == record.size();
+        written += record.size();
+        timestamp++;
+    }
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        fprintf(stderr, "cannot write %s\n", logName);
+        return RETURN_ERR_FILE;
+    }
+    printf("wrote %llu bytes, %u records to %s\n", (unsigned long long)written, timestamp, logName);
+    return RETURN_OK;
+}
+
+int main(int argc, char *argv[])
+{
+    int threads      = thread::hardware_concurrency();
+    unsigned outputs = OUTPUT_CSV;
+    string outputDir;
+    vector<string> args;
+
+    for (int n = 1; n < argc; n++) {
+        string arg(argv[n]);
+        if (arg == "-h" || arg == "--help") {
+            usage();
+            return RETURN_OK;
+        } else if (arg == "-s") {
+            if (argc != n + 3) {
+                usage();
+                return RETURN_ERR_USAGE;
+            }
+            return synthesize(argv[n + 1], strtoull(argv[n + 2], NULL, 10));
+        } else if (arg == "-j" && n + 1 < argc) {
+            threads = atoi(argv[++n]);
+        } else if (arg == "-o" && n + 1 < argc) {
+            outputDir = argv[++n];
+        } else if (arg == "-f" && n + 1 < argc) {
+            string format(argv[++n]);
+            if (format == "csv") {
+                outputs = OUTPUT_CSV;
+            } else if (format == "binary") {
+                outputs = OUTPUT_BINARY;
+            } else if (format == "all") {
+                outputs = OUTPUT_CSV | OUTPUT_BINARY;
+            } else {
+                usage();
+                return RETURN_ERR_USAGE;
+            }
+        } else {
+            args.push_back(arg);
+        }
+    }
+    if (args.size() != 1) {
+        usage();
+        return RETURN_ERR_USAGE;
+    }
+    if (outputDir.empty()) {
+        outputDir = args[0];
+        if (outputDir.size() > 4 && outputDir.compare(outputDir.size() - 4, 4, ".opl") == 0) {
+            outputDir.resize(outputDir.size() - 4);
+        } else {
+            outputDir += "_columns";
+        }
+    }
+
+    return convert(args[0].c_str(), outputDir, outputs, max(threads, 1));
+}
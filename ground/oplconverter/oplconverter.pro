@@ -0,0 +1,31 @@
+#
+# Qmake project for the opl log converter.
+# Copyright (c) 2016, The LibrePilot Project, http://www.librepilot.org
+#
+# The object schemas are generated by uavobjgenerator -oplconverter,
+# use 'make oplconverter' from the top directory.
+#
+
+QT -= core gui
+CONFIG -= qt app_bundle
+CONFIG += console c++11
+
+# use ccache when available
+QMAKE_CC = $$(CCACHE) $$QMAKE_CC
+QMAKE_CXX = $$(CCACHE) $$QMAKE_CXX
+
+isEmpty(UAVOBJ_SYNTH_DIR):UAVOBJ_SYNTH_DIR = $$OUT_PWD/../uavobject-synthetics/oplconverter
+
+TARGET = oplconverter
+TEMPLATE = app
+DESTDIR = $$OUT_PWD # Set a consistent output dir on windows
+INCLUDEPATH += $$PWD
+SOURCES += main.cpp \
+    opldecoder.cpp \
+    columnwriter.cpp \
+    $$UAVOBJ_SYNTH_DIR/uavobjectschema.cpp
+HEADERS += uavobjectschema.h \
+    opldecoder.h \
+    columnwriter.h
+OTHER_FILES += uavobjectschema.cpp.template
+unix:LIBS += -lpthread
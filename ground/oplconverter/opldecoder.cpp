@@ -0,0 +1,396 @@
+/**
+ ******************************************************************************
+ *
+ * @file       opldecoder.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Decodes the UAVTalk packets of a part of an .opl log
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "opldecoder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// same limit as the LogFile replay
+#define MAX_RECORD_LENGTH (1024 * 1024)
+
+// CRC-8, polynomial 0x07, as used by UAVTalk
+static const uint8_t crc_table[256] = {
+    0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+    0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65, 0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
+    0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5, 0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
+    0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85, 0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
+    0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2, 0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
+    0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2, 0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
+    0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32, 0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
+    0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42, 0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
+    0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c, 0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
+    0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec, 0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
+    0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c, 0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
+    0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c, 0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
+    0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b, 0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
+    0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b, 0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
+    0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb, 0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
+    0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3
+};
+
+static inline uint16_t le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void appendUInt(std::string &out, uint32_t value)
+{
+    char buf[10];
+    int n = 0;
+
+    do {
+        buf[n++] = '0' + value % 10;
+        value   /= 10;
+    } while (value);
+    while (n) {
+        out += buf[--n];
+    }
+}
+
+static void appendInt(std::string &out, int32_t value)
+{
+    if (value < 0) {
+        out += '-';
+        appendUInt(out, (uint32_t)(-(int64_t)value));
+    } else {
+        appendUInt(out, (uint32_t)value);
+    }
+}
+
+static void appendFloat(std::string &out, float value)
+{
+    char buf[32];
+    // 9 significant digits give the float back when read again
+    int n = snprintf(buf, sizeof(buf), "%.9g", value);
+
+    out.append(buf, n);
+}
+
+SchemaIndex::SchemaIndex()
+{
+    m_schemas.reserve(uavObjectSchemaCount);
+    for (int n = 0; n < uavObjectSchemaCount; n++) {
+        m_schemas[uavObjectSchemas[n].id] = &uavObjectSchemas[n];
+    }
+}
+
+int SchemaIndex::typeSize(FieldType type)
+{
+    switch (type) {
+    case FIELD_INT16:
+    case FIELD_UINT16:
+        return 2;
+
+    case FIELD_INT32:
+    case FIELD_UINT32:
+    case FIELD_FLOAT32:
+        return 4;
+
+    default:
+        return 1;
+    }
+}
+
+/**
+ * Name of the type as numpy spells it, used as extension of the binary columns.
+ */
+const char *SchemaIndex::typeName(FieldType type)
+{
+    static const char *const names[] = { "int8", "int16", "int32", "uint8", "uint16", "uint32", "float32", "uint8" };
+
+    return names[type];
+}
+
+/**
+ * Timestamp, instance and one column per field element.
+ */
+int SchemaIndex::numColumns(const ObjectSchema *schema)
+{
+    int columns = 2;
+
+    for (int n = 0; n < schema->numFields; n++) {
+        columns += schema->fields[n].numElements;
+    }
+    return columns;
+}
+
+std::vector<std::string> SchemaIndex::columnNames(const ObjectSchema *schema)
+{
+    std::vector<std::string> names;
+
+    names.push_back("timestamp");
+    names.push_back("instance");
+    for (int n = 0; n < schema->numFields; n++) {
+        const FieldSchema &field = schema->fields[n];
+        if (field.numElements == 1) {
+            names.push_back(field.name);
+            continue;
+        }
+        for (int i = 0; i < field.numElements; i++) {
+            char index[12];
+            snprintf(index, sizeof(index), "%d", i);
+            names.push_back(std::string(field.name) + "." + (field.elementNames ? field.elementNames[i] : index));
+        }
+    }
+    return names;
+}
+
+DecodeStats::DecodeStats() : records(0), packets(0), otherPackets(0), skippedBytes(0), unknownObjects(0), sizeErrors(0)
+{}
+
+void DecodeStats::add(const DecodeStats &other)
+{
+    records        += other.records;
+    packets        += other.packets;
+    otherPackets   += other.otherPackets;
+    skippedBytes   += other.skippedBytes;
+    unknownObjects += other.unknownObjects;
+    sizeErrors     += other.sizeErrors;
+}
+
+OplDecoder::OplDecoder(const uint8_t *data, uint64_t size, const SchemaIndex &schemas, unsigned outputs) :
+    m_data(data), m_size(size), m_schemas(schemas), m_outputs(outputs), m_first(0), m_end(0)
+{}
+
+uint8_t OplDecoder::crc8(uint8_t crc, const uint8_t *data, size_t length)
+{
+    while (length--) {
+        crc = crc_table[crc ^ *data++];
+    }
+    return crc;
+}
+
+/**
+ * Decode the records starting in [from, to). The bytes before the first
+ * record are not counted as skipped, they may belong to the last record of
+ * the previous range, see first().
+ */
+void OplDecoder::decode(uint64_t from, uint64_t to)
+{
+    uint64_t pos = findRecord(from, to);
+
+    m_first = pos;
+    while (pos < to) {
+        uint64_t length;
+        if (!recordLength(pos, &length)) {
+            uint64_t next = findRecord(pos + 1, to);
+            m_stats.skippedBytes += next - pos;
+            pos = next;
+            continue;
+        }
+        uint32_t timestamp;
+        memcpy(&timestamp, &m_data[pos], sizeof(timestamp));
+        decodeRecord(timestamp, &m_data[pos + RECORD_HEADER_LENGTH], length);
+        m_stats.records++;
+        pos += RECORD_HEADER_LENGTH + length;
+    }
+    m_end = pos;
+}
+
+/**
+ * Check the record at pos, its header and first packet.
+ * @param length Set to the length of the data of the record
+ */
+bool OplDecoder::recordLength(uint64_t pos, uint64_t *length) const
+{
+    int64_t size;
+    int packet;
+
+    if (m_size - pos < (uint64_t)RECORD_HEADER_LENGTH) {
+        return false;
+    }
+    // host order, as written by LogFile
+    memcpy(&size, &m_data[pos + 4], sizeof(size));
+    if (size < UAVTALK_HEADER_LENGTH + UAVTALK_CHECKSUM_LENGTH || size > MAX_RECORD_LENGTH
+        || (uint64_t)size > m_size - pos - RECORD_HEADER_LENGTH) {
+        return false;
+    }
+    if (!packetLength(&m_data[pos + RECORD_HEADER_LENGTH], size, &packet)) {
+        return false;
+    }
+    *length = size;
+    return true;
+}
+
+/**
+ * First position in [from, to) holding a valid record followed by another
+ * valid record or by the end of the file, to if there is none.
+ */
+uint64_t OplDecoder::findRecord(uint64_t from, uint64_t to) const
+{
+    for (uint64_t pos = from; pos < to; pos++) {
+        uint64_t length, next;
+        if (!recordLength(pos, &length)) {
+            continue;
+        }
+        next = pos + RECORD_HEADER_LENGTH + length;
+        if (next == m_size || recordLength(next, &length)) {
+            return pos;
+        }
+    }
+    return to;
+}
+
+/**
+ * Check a UAVTalk packet.
+ * @param length Set to the length of the packet, checksum included
+ */
+bool OplDecoder::packetLength(const uint8_t *packet, uint64_t available, int *length)
+{
+    if (available < (uint64_t)(UAVTALK_HEADER_LENGTH + UAVTALK_CHECKSUM_LENGTH)
+        || packet[0] != UAVTALK_SYNC_VAL || (packet[1] & UAVTALK_TYPE_MASK) != UAVTALK_TYPE_VER) {
+        return false;
+    }
+    int headerLength = UAVTALK_HEADER_LENGTH + ((packet[1] & UAVTALK_TIMESTAMPED) ? UAVTALK_TIMESTAMP_LENGTH : 0);
+    int packetSize   = le16(&packet[2]);
+    if (packetSize < headerLength || (uint64_t)packetSize + UAVTALK_CHECKSUM_LENGTH > available) {
+        return false;
+    }
+    if (crc8(0, packet, packetSize) != packet[packetSize]) {
+        return false;
+    }
+    *length = packetSize + UAVTALK_CHECKSUM_LENGTH;
+    return true;
+}
+
+void OplDecoder::decodeRecord(uint32_t timestamp, const uint8_t *payload, uint64_t length)
+{
+    uint64_t pos = 0;
+
+    while (pos < length) {
+        int packet;
+        if (!packetLength(&payload[pos], length - pos, &packet)) {
+            m_stats.skippedBytes += length - pos;
+            return;
+        }
+        decodePacket(timestamp, &payload[pos], packet);
+        pos += packet;
+    }
+}
+
+void OplDecoder::decodePacket(uint32_t timestamp, const uint8_t *packet, int length)
+{
+    uint8_t type = packet[1] & ~UAVTALK_TIMESTAMPED;
+
+    if (type != UAVTALK_TYPE_OBJ && type != UAVTALK_TYPE_OBJ_ACK) {
+        m_stats.otherPackets++;
+        return;
+    }
+
+    int headerLength = UAVTALK_HEADER_LENGTH + ((packet[1] & UAVTALK_TIMESTAMPED) ? UAVTALK_TIMESTAMP_LENGTH : 0);
+    const ObjectSchema *schema = m_schemas.find(le32(&packet[4]));
+    if (!schema) {
+        m_stats.unknownObjects++;
+        return;
+    }
+    if (length - headerLength - UAVTALK_CHECKSUM_LENGTH != schema->numBytes) {
+        m_stats.sizeErrors++;
+        return;
+    }
+    appendRow(schema, timestamp, le16(&packet[8]), &packet[headerLength]);
+    m_stats.packets++;
+}
+
+void OplDecoder::appendRow(const ObjectSchema *schema, uint32_t timestamp, uint16_t instance, const uint8_t *data)
+{
+    ObjectColumns &object = m_objects[schema->id];
+    bool csv    = m_outputs & OUTPUT_CSV;
+    bool binary = m_outputs & OUTPUT_BINARY;
+    int column  = 2;
+
+    if (binary && object.columns.empty()) {
+        object.columns.resize(SchemaIndex::numColumns(schema));
+    }
+    if (csv) {
+        appendUInt(object.csv, timestamp);
+        object.csv += ',';
+        appendUInt(object.csv, instance);
+    }
+    if (binary) {
+        // data is little endian, as the hosts the logs are converted on
+        object.columns[0].append((const char *)&timestamp, sizeof(timestamp));
+        object.columns[1].append((const char *)&instance, sizeof(instance));
+    }
+
+    for (int n = 0; n < schema->numFields; n++) {
+        const FieldSchema &field = schema->fields[n];
+        int size = SchemaIndex::typeSize(field.type);
+        for (int i = 0; i < field.numElements; i++, data += size, column++) {
+            if (binary) {
+                object.columns[column].append((const char *)data, size);
+            }
+            if (!csv) {
+                continue;
+            }
+            object.csv += ',';
+            switch (field.type) {
+            case FIELD_INT8:
+                appendInt(object.csv, (int8_t)data[0]);
+                break;
+            case FIELD_INT16:
+                appendInt(object.csv, (int16_t)le16(data));
+                break;
+            case FIELD_INT32:
+                appendInt(object.csv, (int32_t)le32(data));
+                break;
+            case FIELD_UINT8:
+                appendUInt(object.csv, data[0]);
+                break;
+            case FIELD_UINT16:
+                appendUInt(object.csv, le16(data));
+                break;
+            case FIELD_UINT32:
+                appendUInt(object.csv, le32(data));
+                break;
+            case FIELD_FLOAT32:
+            {
+                uint32_t bits = le32(data);
+                float value;
+                memcpy(&value, &bits, sizeof(value));
+                appendFloat(object.csv, value);
+                break;
+            }
+            case FIELD_ENUM:
+                if (data[0] < field.numOptions) {
+                    object.csv += field.options[data[0]];
+                } else {
+                    appendUInt(object.csv, data[0]);
+                }
+                break;
+            }
+        }
+    }
+    if (csv) {
+        object.csv += '\n';
+    }
+    object.rows++;
+}
@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ *
+ * @file       opldecoder.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Decodes the UAVTalk packets of a part of an .opl log
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OPLDECODER_H
+#define OPLDECODER_H
+
+#include "uavobjectschema.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+enum {
+    OUTPUT_CSV    = 0x01,
+    OUTPUT_BINARY = 0x02
+};
+
+/**
+ * Object schemas by id, built once and shared by the decoders.
+ */
+class SchemaIndex {
+public:
+    SchemaIndex();
+
+    const ObjectSchema *find(uint32_t id) const
+    {
+        std::unordered_map<uint32_t, const ObjectSchema *>::const_iterator it = m_schemas.find(id);
+
+        return (it != m_schemas.end()) ? it->second : NULL;
+    }
+
+    static int typeSize(FieldType type);
+    static const char *typeName(FieldType type);
+    static int numColumns(const ObjectSchema *schema);
+    static std::vector<std::string> columnNames(const ObjectSchema *schema);
+
+private:
+    std::unordered_map<uint32_t, const ObjectSchema *> m_schemas;
+};
+
+struct DecodeStats {
+    uint64_t records; // log file records
+    uint64_t packets; // object packets decoded
+    uint64_t otherPackets; // requests, acks
+    uint64_t skippedBytes; // not part of a valid record or packet, inside the range decoded
+    uint64_t unknownObjects; // packets of objects not in the schemas
+    uint64_t sizeErrors; // packets not matching the size of their object
+
+    DecodeStats();
+    void add(const DecodeStats &other);
+};
+
+/**
+ * Decoded packets of one object, formatted for the output.
+ */
+struct ObjectColumns {
+    uint64_t    rows;
+    std::string csv; // one line per packet, without header
+    std::vector<std::string> columns; // raw little endian arrays: timestamp, instance, then one per field element
+
+    ObjectColumns() : rows(0) {}
+};
+
+/**
+ * Decodes the records of an .opl file starting in [from, to).
+ *
+ * A log file record is a timestamp (uint32, ms), a size (int64) and that
+ * many bytes of UAVTalk stream, as written by the GCS LogFile: one or more
+ * complete packets. A record is only accepted when its first packet has a
+ * valid checksum; the start of a range, or the data after a corrupted
+ * record, is found by scanning for a record followed by another valid one.
+ * Ranges decoded independently therefore split the file at the same
+ * records a sequential decoder would.
+ */
+class OplDecoder {
+public:
+    OplDecoder(const uint8_t *data, uint64_t size, const SchemaIndex &schemas, unsigned outputs);
+
+    void decode(uint64_t from, uint64_t to);
+
+    const std::map<uint32_t, ObjectColumns> &objects() const
+    {
+        return m_objects;
+    }
+
+    const DecodeStats &stats() const
+    {
+        return m_stats;
+    }
+
+    // start of the first record decoded and end of the last one
+    uint64_t first() const
+    {
+        return m_first;
+    }
+
+    uint64_t end() const
+    {
+        return m_end;
+    }
+
+    static uint8_t crc8(uint8_t crc, const uint8_t *data, size_t length);
+
+    static const int RECORD_HEADER_LENGTH = 12;
+    static const uint8_t UAVTALK_SYNC_VAL = 0x3C;
+    static const uint8_t UAVTALK_TYPE_MASK    = 0x78;
+    static const uint8_t UAVTALK_TYPE_VER     = 0x20;
+    static const uint8_t UAVTALK_TIMESTAMPED  = 0x80;
+    static const uint8_t UAVTALK_TYPE_OBJ     = 0x20;
+    static const uint8_t UAVTALK_TYPE_OBJ_ACK = 0x22;
+    static const int UAVTALK_HEADER_LENGTH    = 10;
+    static const int UAVTALK_TIMESTAMP_LENGTH = 2;
+    static const int UAVTALK_CHECKSUM_LENGTH  = 1;
+
+private:
+    const uint8_t *m_data;
+    uint64_t m_size;
+    const SchemaIndex &m_schemas;
+    unsigned m_outputs;
+    std::map<uint32_t, ObjectColumns> m_objects;
+    DecodeStats m_stats;
+    uint64_t m_first;
+    uint64_t m_end;
+
+    bool recordLength(uint64_t pos, uint64_t *length) const;
+    uint64_t findRecord(uint64_t from, uint64_t to) const;
+    static bool packetLength(const uint8_t *packet, uint64_t available, int *length);
+    void decodeRecord(uint32_t timestamp, const uint8_t *payload, uint64_t length);
+    void decodePacket(uint32_t timestamp, const uint8_t *packet, int length);
+    void appendRow(const ObjectSchema *schema, uint32_t timestamp, uint16_t instance, const uint8_t *data);
+};
+
+#endif // OPLDECODER_H
@@ -0,0 +1,69 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectschema.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Layout of the UAVObjects, generated from the XML definitions
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef UAVOBJECTSCHEMA_H
+#define UAVOBJECTSCHEMA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum {
+    FIELD_INT8 = 0,
+    FIELD_INT16,
+    FIELD_INT32,
+    FIELD_UINT8,
+    FIELD_UINT16,
+    FIELD_UINT32,
+    FIELD_FLOAT32,
+    FIELD_ENUM
+} FieldType;
+
+typedef struct {
+    const char *name;
+    FieldType  type;
+    int numElements;
+    const char *const *elementNames; // NULL when the elements are numbered
+    int numOptions;
+    const char *const *options; // enums only
+} FieldSchema;
+
+/**
+ * Fields are listed in wire order, largest type first, as packed by the
+ * flight and GCS code.
+ */
+typedef struct {
+    uint32_t id;
+    const char *name;
+    bool isSingleInst;
+    int  numBytes;
+    int  numFields;
+    const FieldSchema *fields;
+} ObjectSchema;
+
+extern const ObjectSchema uavObjectSchemas[];
+extern const int uavObjectSchemaCount;
+
+#endif // UAVOBJECTSCHEMA_H
@@ -0,0 +1,223 @@
+/**
+ ******************************************************************************
+ *
+ * @file       main.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Headless physics for the simposix target, steps the flight code
+ *             in lockstep through the simulator bridge
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "quadmodel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define RETURN_OK        0
+#define RETURN_ERR_USAGE 1
+#define RETURN_ERR_BRIDGE 2
+
+// rates of the slow sensors, the gyros and accels go at the IMU rate
+#define MAG_PERIOD_US    10000
+#define BARO_PERIOD_US   20000
+#define GPS_PERIOD_US    100000
+
+// how long to wait for the flight code to open its socket
+#define CONNECT_TIMEOUT_S 10
+
+using namespace std;
+
+static void usage()
+{
+    printf("Usage: simphysics [-s socket] [-t seconds] [-p step_ms] [-r imu_rate] [-v]\n");
+    printf("\t-s socket       bridge of the flight code, default %s\n", SIMBRIDGE_DEFAULT_SOCKET);
+    printf("\t                run it with SIMPOSIX_CLOCK=bridge[:socket]\n");
+    printf("\t-t seconds      simulated time to run, default 60\n");
+    printf("\t-p step_ms      simulated time per exchange, default 10\n");
+    printf("\t-r imu_rate     gyro and accel samples per second, default 1000\n");
+    printf("\t-v              print the state every simulated second\n");
+}
+
+static int connectBridge(const char *path)
+{
+    struct sockaddr_un server;
+
+    if (strlen(path) >= sizeof(server.sun_path)) {
+        return -1;
+    }
+    memset(&server, 0, sizeof(server));
+    server.sun_family = AF_UNIX;
+    strcpy(server.sun_path, path);
+
+    for (int i = 0; i < CONNECT_TIMEOUT_S * 10; i++) {
+        int sock = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        if (sock < 0) {
+            return -1;
+        }
+        if (connect(sock, (struct sockaddr *)&server, sizeof(server)) == 0) {
+            return sock;
+        }
+        close(sock);
+        this_thread::sleep_for(chrono::milliseconds(100));
+    }
+
+    return -1;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = SIMBRIDGE_DEFAULT_SOCKET;
+    double seconds   = 60;
+    uint32_t stepUs  = 10000;
+    uint32_t imuRate = 1000;
+    bool verbose     = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:t:p:r:vh")) != -1) {
+        switch (opt) {
+        case 's':
+            path = optarg;
+            break;
+        case 't':
+            seconds = atof(optarg);
+            break;
+        case 'p':
+            stepUs = atoi(optarg) * 1000;
+            break;
+        case 'r':
+            imuRate = atoi(optarg);
+            break;
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            usage();
+            return RETURN_ERR_USAGE;
+        }
+    }
+
+    if (optind != argc || seconds <= 0 || stepUs == 0 || imuRate == 0 || imuRate > 1000000) {
+        usage();
+        return RETURN_ERR_USAGE;
+    }
+    uint32_t periodUs = 1000000 / imuRate;
+    if ((stepUs + periodUs - 1) / periodUs > SIMBRIDGE_MAX_SAMPLES) {
+        printf("simphysics: more than %d samples per step\n", SIMBRIDGE_MAX_SAMPLES);
+        return RETURN_ERR_USAGE;
+    }
+
+    int sock = connectBridge(path);
+    if (sock < 0) {
+        printf("simphysics: cannot connect to %s\n", path);
+        return RETURN_ERR_BRIDGE;
+    }
+
+    struct {
+        simbridge_step   step;
+        simbridge_sample sample[SIMBRIDGE_MAX_SAMPLES];
+    } frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.step.magic   = SIMBRIDGE_MAGIC;
+    frame.step.version = SIMBRIDGE_VERSION;
+    frame.step.step_us = stepUs;
+
+    QuadModel model(1);
+    uint64_t duration   = seconds * 1e6;
+    uint64_t nextSample = 0;
+    uint64_t steps      = 0;
+    uint64_t samples    = 0;
+    uint64_t flightTime = 0;
+    double exchangeMax  = 0;
+    double exchangeSum  = 0;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (uint64_t time = 0; time < duration; time += stepUs) {
+        // samples of the step, the model runs at the IMU rate
+        int count = 0;
+        while (nextSample + periodUs <= time + stepUs) {
+            uint32_t valid = SIMBRIDGE_GYRO | SIMBRIDGE_ACCEL;
+            if (nextSample % MAG_PERIOD_US < periodUs) {
+                valid |= SIMBRIDGE_MAG;
+            }
+            if (nextSample % BARO_PERIOD_US < periodUs) {
+                valid |= SIMBRIDGE_BARO;
+            }
+            if (nextSample % GPS_PERIOD_US < periodUs) {
+                valid |= SIMBRIDGE_GPS;
+            }
+            // the state at the end of the period
+            nextSample += periodUs;
+            model.step(periodUs / 1e6);
+            model.sample(&frame.sample[count], valid);
+            frame.sample[count].time_us = nextSample - time;
+            count++;
+        }
+        frame.step.samples = count;
+
+        chrono::steady_clock::time_point sent = chrono::steady_clock::now();
+
+        simbridge_output output;
+        size_t length = sizeof(frame.step) + count * sizeof(simbridge_sample);
+        if (send(sock, &frame, length, MSG_NOSIGNAL) != (ssize_t)length ||
+            recv(sock, &output, sizeof(output), 0) != (ssize_t)sizeof(output) ||
+            output.magic != SIMBRIDGE_MAGIC || output.version != SIMBRIDGE_VERSION) {
+            printf("simphysics: bridge closed after %.3f s\n", time / 1e6);
+            close(sock);
+            return RETURN_ERR_BRIDGE;
+        }
+
+        double exchange = chrono::duration<double, micro>(chrono::steady_clock::now() - sent).count();
+        exchangeSum += exchange;
+        exchangeMax  = max(exchangeMax, exchange);
+        steps++;
+        samples     += count;
+        flightTime   = output.time_us;
+
+        model.setOutput(output);
+
+        if (verbose && (time + stepUs) / 1000000 != time / 1000000) {
+            const double *pos = model.position();
+            const double *q   = model.attitude();
+            printf("%7.2f s  flight %7.2f s  %s thrust %5.2f  pos %7.2f %7.2f %7.2f  q %6.3f %6.3f %6.3f %6.3f\n",
+                   (time + stepUs) / 1e6, output.time_us / 1e6, output.armed ? "armed   " : "disarmed",
+                   output.desired[3], pos[0], pos[1], pos[2], q[0], q[1], q[2], q[3]);
+        }
+    }
+
+    double real = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    close(sock);
+
+    printf("simphysics: %.1f s simulated in %.2f s, %.1fx real time\n", duration / 1e6, real, duration / 1e6 / real);
+    printf("simphysics: %llu steps of %u us, %llu samples, %.0f samples/s\n",
+           (unsigned long long)steps, stepUs, (unsigned long long)samples, samples / real);
+    printf("simphysics: step exchange %.0f us average, %.0f us max, flight code at %.3f s\n",
+           exchangeSum / steps, exchangeMax, flightTime / 1e6);
+
+    return RETURN_OK;
+}
@@ -0,0 +1,191 @@
+/**
+ ******************************************************************************
+ *
+ * @file       quadmodel.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Rigid body multirotor model producing the sensor samples
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "quadmodel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+const double GRAV = 9.81;
+const double EARTH_RADIUS = 6378137.0;
+const double MAX_THRUST   = 2 * GRAV; // m/s^2 at full thrust
+const double K_TORQUE[3]  = { 60, 60, 15 }; // rad/s^2 at full roll, pitch, yaw
+const double K_ROTATIONAL_DRAG = 2; // 1/s
+const double K_DRAG = 0.5; // 1/s
+
+// earth magnetic field, mGa, north east down
+const double MAG_FIELD[3] = { 215, 5, 425 };
+
+const float GYRO_NOISE  = 0.2f; // deg/s
+const float ACCEL_NOISE = 0.05f; // m/s^2
+const float MAG_NOISE   = 2.0f; // mGa
+const float BARO_NOISE  = 0.1f; // m
+const float GPS_NOISE   = 0.5f; // m
+const float GPS_VELOCITY_NOISE = 0.05f; // m/s
+}
+
+QuadModel::QuadModel(unsigned seed) :
+    m_armed(false), m_random(seed), m_noise(0.0f, 1.0f), m_baroDrift(0)
+{
+    memset(m_pos, 0, sizeof(m_pos));
+    memset(m_vel, 0, sizeof(m_vel));
+    memset(m_rate, 0, sizeof(m_rate));
+    memset(m_desired, 0, sizeof(m_desired));
+    m_q[0] = 1;
+    m_q[1] = m_q[2] = m_q[3] = 0;
+    m_specificForce[0] = m_specificForce[1] = 0;
+    m_specificForce[2] = -GRAV;
+}
+
+void QuadModel::setOutput(const simbridge_output &output)
+{
+    m_armed = output.armed;
+    for (int i = 0; i < 4; i++) {
+        m_desired[i] = output.desired[i];
+    }
+}
+
+/**
+ * Earth to body rotation, as Quaternion2R() of the flight code
+ */
+void QuadModel::rotation(double Rbe[3][3]) const
+{
+    const double *q = m_q;
+    const double q0s = q[0] * q[0], q1s = q[1] * q[1], q2s = q[2] * q[2], q3s = q[3] * q[3];
+
+    Rbe[0][0] = q0s + q1s - q2s - q3s;
+    Rbe[0][1] = 2 * (q[1] * q[2] + q[0] * q[3]);
+    Rbe[0][2] = 2 * (q[1] * q[3] - q[0] * q[2]);
+    Rbe[1][0] = 2 * (q[1] * q[2] - q[0] * q[3]);
+    Rbe[1][1] = q0s - q1s + q2s - q3s;
+    Rbe[1][2] = 2 * (q[2] * q[3] + q[0] * q[1]);
+    Rbe[2][0] = 2 * (q[1] * q[3] + q[0] * q[2]);
+    Rbe[2][1] = 2 * (q[2] * q[3] - q[0] * q[1]);
+    Rbe[2][2] = q0s - q1s - q2s + q3s;
+}
+
+void QuadModel::step(double dT)
+{
+    double thrust = 0;
+
+    // rates, first order response to the torques
+    for (int i = 0; i < 3; i++) {
+        double torque = m_armed ? K_TORQUE[i] * std::max(-1.0, std::min(1.0, m_desired[i])) : 0;
+        m_rate[i] += (torque - K_ROTATIONAL_DRAG * m_rate[i]) * dT;
+    }
+    if (m_armed) {
+        thrust = MAX_THRUST * std::max(0.0, std::min(1.0, m_desired[3]));
+    }
+
+    // attitude, qdot = q * (0, rate) / 2
+    double *q = m_q;
+    double qdot[4];
+    qdot[0] = (-q[1] * m_rate[0] - q[2] * m_rate[1] - q[3] * m_rate[2]) / 2;
+    qdot[1] = (q[0] * m_rate[0] - q[3] * m_rate[1] + q[2] * m_rate[2]) / 2;
+    qdot[2] = (q[3] * m_rate[0] + q[0] * m_rate[1] - q[1] * m_rate[2]) / 2;
+    qdot[3] = (-q[2] * m_rate[0] + q[1] * m_rate[1] + q[0] * m_rate[2]) / 2;
+    double norm = 0;
+    for (int i = 0; i < 4; i++) {
+        q[i] += qdot[i] * dT;
+        norm += q[i] * q[i];
+    }
+    norm = sqrt(norm);
+    for (int i = 0; i < 4; i++) {
+        q[i] /= norm;
+    }
+
+    // thrust along -z of the body, gravity and drag in the earth frame
+    double Rbe[3][3];
+    rotation(Rbe);
+    double accel[3];
+    for (int i = 0; i < 3; i++) {
+        accel[i] = -thrust * Rbe[2][i] - K_DRAG * m_vel[i];
+    }
+    accel[2] += GRAV;
+
+    for (int i = 0; i < 3; i++) {
+        m_vel[i] += accel[i] * dT;
+        m_pos[i] += m_vel[i] * dT;
+    }
+
+    // resting on the ground
+    if (m_pos[2] >= 0) {
+        m_pos[2] = 0;
+        if (m_vel[2] > 0) {
+            m_vel[2] = 0;
+        }
+        if (accel[2] > 0) {
+            accel[2] = 0;
+            m_vel[0] = m_vel[1] = 0;
+            accel[0] = accel[1] = 0;
+            m_rate[0] = m_rate[1] = m_rate[2] = 0;
+        }
+    }
+
+    // what the accels feel is everything but gravity
+    accel[2] -= GRAV;
+    for (int i = 0; i < 3; i++) {
+        m_specificForce[i] = Rbe[i][0] * accel[0] + Rbe[i][1] * accel[1] + Rbe[i][2] * accel[2];
+    }
+
+    m_baroDrift += noise(0.001f);
+}
+
+float QuadModel::noise(float sigma)
+{
+    return sigma * m_noise(m_random);
+}
+
+/**
+ * Sensor readings of the current state
+ */
+void QuadModel::sample(simbridge_sample *sample, uint32_t valid)
+{
+    double Rbe[3][3];
+
+    rotation(Rbe);
+
+    sample->valid = valid;
+    sample->temperature = 30;
+    for (int i = 0; i < 3; i++) {
+        sample->gyro[i]  = m_rate[i] * 180 / M_PI + noise(GYRO_NOISE);
+        sample->accel[i] = m_specificForce[i] + noise(ACCEL_NOISE);
+        sample->mag[i]   = Rbe[i][0] * MAG_FIELD[0] + Rbe[i][1] * MAG_FIELD[1] + Rbe[i][2] * MAG_FIELD[2] + noise(MAG_NOISE);
+    }
+
+    sample->baro_altitude = -m_pos[2] + m_baroDrift + noise(BARO_NOISE);
+    sample->airspeed = 0;
+
+    double latitude = HOME_LATITUDE / 1e7 * M_PI / 180;
+    sample->latitude  = HOME_LATITUDE + lround((m_pos[0] + noise(GPS_NOISE)) / EARTH_RADIUS * 180 / M_PI * 1e7);
+    sample->longitude = HOME_LONGITUDE + lround((m_pos[1] + noise(GPS_NOISE)) / (EARTH_RADIUS * cos(latitude)) * 180 / M_PI * 1e7);
+    sample->altitude  = HOME_ALTITUDE - m_pos[2] + noise(GPS_NOISE);
+    for (int i = 0; i < 3; i++) {
+        sample->velocity[i] = m_vel[i] + noise(GPS_VELOCITY_NOISE);
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ ******************************************************************************
+ *
+ * @file       quadmodel.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      Rigid body multirotor model producing the sensor samples
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef QUADMODEL_H
+#define QUADMODEL_H
+
+#include "pios_simbridge_frames.h"
+
+#include <random>
+
+/**
+ * Multirotor driven by the ActuatorDesired outputs of the flight code:
+ * roll, pitch and yaw set the torques, thrust the lift along the body z
+ * axis. Linear drag, flat ground at the home altitude. Good enough to
+ * close the loop of the stabilization and benchmark the exchange, not
+ * meant to be a flight model.
+ */
+class QuadModel {
+public:
+    QuadModel(unsigned seed);
+
+    void setOutput(const simbridge_output &output);
+    void step(double dT);
+    void sample(simbridge_sample *sample, uint32_t valid);
+
+    const double *position() const
+    {
+        return m_pos;
+    }
+
+    const double *attitude() const
+    {
+        return m_q;
+    }
+
+    static const int32_t HOME_LATITUDE  = 473928650; // deg * 1e7
+    static const int32_t HOME_LONGITUDE = 85415520;
+    static const int HOME_ALTITUDE = 450; // m
+
+private:
+    double m_pos[3]; // m, north east down from home
+    double m_vel[3]; // m/s
+    double m_q[4]; // attitude, body to earth
+    double m_rate[3]; // rad/s, body
+    double m_specificForce[3]; // m/s^2, body, what the accels feel
+    bool m_armed;
+    double m_desired[4];
+
+    std::mt19937 m_random;
+    std::normal_distribution<float> m_noise;
+    double m_baroDrift;
+
+    void rotation(double Rbe[3][3]) const;
+    float noise(float sigma);
+};
+
+#endif // QUADMODEL_H
@@ -0,0 +1,25 @@
+#
+# Qmake project for the headless simposix physics.
+# Copyright (c) 2016, The LibrePilot Project, http://www.librepilot.org
+#
+# Steps a simposix firmware started with SIMPOSIX_CLOCK=bridge, use
+# 'make simphysics' or 'make simphysics_bench' from the top directory.
+#
+
+QT -= core gui
+CONFIG -= qt app_bundle
+CONFIG += console c++11
+
+# use ccache when available
+QMAKE_CC = $$(CCACHE) $$QMAKE_CC
+QMAKE_CXX = $$(CCACHE) $$QMAKE_CXX
+
+TARGET = simphysics
+TEMPLATE = app
+DESTDIR = $$OUT_PWD # Set a consistent output dir on windows
+INCLUDEPATH += $$PWD \
+    $$PWD/../../flight/pios/inc
+SOURCES += main.cpp \
+    quadmodel.cpp
+HEADERS += quadmodel.h \
+    ../../flight/pios/inc/pios_simbridge_frames.h
@@ -98,6 +98,47 @@ bool UAVObjectGeneratorFlight::generate(UAVObjectParser *parser, QString templat
 }
 
 
+/**
+ * Append the Set/Get accessors of a field. Single instance objects go through
+ * UAVObjDirect, their accessors are put inline in the include file and, for
+ * targets without UAVOBJ_INLINE_ACCESSORS, in the code file and declared in the
+ * include file as well. Others get them in the code file and declared in the
+ * include file.
+ **/
+void UAVObjectGeneratorFlight::appendFieldAccessors(ObjectInfo *info, const QString &type, const QString &field,
+                                                    const QString &suffix, const QString &size, QString &code, QString &include,
+                                                    QString &inlineInclude)
+{
+    if (info->isSingleInst) {
+        const char *ops[] = { "Set", "Get" };
+        for (int i = 0; i < 2; ++i) {
+            QString accessor = QString("void %1%2%3%4(%5 *New%2)\n{\n"
+                                       "    UAVObjDirect%4(%6_direct, (void *)New%2, offsetof(%1Data, %2), %7);\n}\n")
+                               .arg(info->name).arg(field).arg(suffix).arg(ops[i]).arg(type)
+                               .arg(info->namelc).arg(size);
+            inlineInclude.append(QString("static inline ") + accessor);
+            code.append(accessor);
+            include.append(QString("extern void %1%2%3%4(%5 *New%2);\n")
+                           .arg(info->name).arg(field).arg(suffix).arg(ops[i]).arg(type));
+        }
+        return;
+    }
+
+    /* SET */
+    code.append(QString("void %1%2%3Set(%4 *New%2)\n{\n"
+                        "    UAVObjSetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), %5);\n}\n")
+                .arg(info->name).arg(field).arg(suffix).arg(type).arg(size));
+    include.append(QString("extern void %1%2%3Set(%4 *New%2);\n")
+                   .arg(info->name).arg(field).arg(suffix).arg(type));
+
+    /* GET */
+    code.append(QString("void %1%2%3Get(%4 *New%2)\n{\n"
+                        "    UAVObjGetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), %5);\n}\n")
+                .arg(info->name).arg(field).arg(suffix).arg(type).arg(size));
+    include.append(QString("extern void %1%2%3Get(%4 *New%2);\n")
+                   .arg(info->name).arg(field).arg(suffix).arg(type));
+}
+
 /**
  * Generate the Flight object files
  **/
@@ -265,144 +306,35 @@ bool UAVObjectGeneratorFlight::process_object(ObjectInfo *info)
     }
     outCode.replace(QString("$(INITFIELDS)"), initfields);
 
-    // Replace the $(SETGETFIELDS) tag
+    // Replace the $(SETGETFIELDS) and $(SETGETFIELDSEXTERN) tags
     QString setgetfields;
-    for (int n = 0; n < info->fields.length(); ++n) {
-        // if (!info->fields[n]->defaultValues.isEmpty() )
-        {
-            // For non-array fields
-            if (info->fields[n]->numElements == 1) {
-                /* Set */
-                setgetfields.append(QString("void %2%3Set(%1 *New%3)\n")
-                                    .arg(typeList[n])
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name));
-                setgetfields.append(QString("{\n"));
-                setgetfields.append(QString("    UAVObjSetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), sizeof(%3));\n")
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name)
-                                    .arg(typeList[n]));
-                setgetfields.append(QString("}\n"));
-
-                /* GET */
-                setgetfields.append(QString("void %2%3Get(%1 *New%3)\n")
-                                    .arg(typeList[n])
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name));
-                setgetfields.append(QString("{\n"));
-                setgetfields.append(QString("    UAVObjGetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), sizeof(%3));\n")
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name)
-                                    .arg(typeList[n]));
-                setgetfields.append(QString("}\n"));
-            } else {
-                // When no struct accessor is available for a field array accessor is the default.
-                QString suffix = QString("");
-
-                if (info->fields[n]->elementNames[0].compare(QString("0")) != 0) {
-                    // struct based field accessor
-                    QString structTypeName = QString("%1%2Data").arg(info->name).arg(info->fields[n]->name);
-                    /* SET */
-                    setgetfields.append(QString("void %2%3Set( %1 *New%3 )\n")
-                                        .arg(structTypeName)
-                                        .arg(info->name)
-                                        .arg(info->fields[n]->name));
-                    setgetfields.append(QString("{\n"));
-                    setgetfields.append(QString("    UAVObjSetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), %3*sizeof(%4));\n")
-                                        .arg(info->name)
-                                        .arg(info->fields[n]->name)
-                                        .arg(info->fields[n]->numElements)
-                                        .arg(typeList[n]));
-                    setgetfields.append(QString("}\n"));
-
-                    /* GET */
-                    setgetfields.append(QString("void %2%3Get( %1 *New%3 )\n")
-                                        .arg(structTypeName)
-                                        .arg(info->name)
-                                        .arg(info->fields[n]->name));
-                    setgetfields.append(QString("{\n"));
-                    setgetfields.append(QString("    UAVObjGetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), %3*sizeof(%4));\n")
-                                        .arg(info->name)
-                                        .arg(info->fields[n]->name)
-                                        .arg(info->fields[n]->numElements)
-                                        .arg(typeList[n]));
-                    setgetfields.append(QString("}\n"));
-
-                    // Append array suffix to array accessors
-                    suffix = QString("Array");
-                }
-
-                // array based field accessor
-                /* SET */
-                setgetfields.append(QString("void %2%3%4Set( %1 *New%3 )\n")
-                                    .arg(typeList[n])
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name)
-                                    .arg(suffix));
-                setgetfields.append(QString("{\n"));
-                setgetfields.append(QString("    UAVObjSetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), %3*sizeof(%4));\n")
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name)
-                                    .arg(info->fields[n]->numElements)
-                                    .arg(typeList[n]));
-                setgetfields.append(QString("}\n"));
-
-                /* GET */
-                setgetfields.append(QString("void %2%3%4Get( %1 *New%3 )\n")
-                                    .arg(typeList[n])
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name)
-                                    .arg(suffix));
-                setgetfields.append(QString("{\n"));
-                setgetfields.append(QString("    UAVObjGetDataField(%1Handle(), (void *)New%2, offsetof(%1Data, %2), %3*sizeof(%4));\n")
-                                    .arg(info->name)
-                                    .arg(info->fields[n]->name)
-                                    .arg(info->fields[n]->numElements)
-                                    .arg(typeList[n]));
-                setgetfields.append(QString("}\n"));
-            }
-        }
-    }
-    outCode.replace(QString("$(SETGETFIELDS)"), setgetfields);
-
-    // Replace the $(SETGETFIELDSEXTERN) tag
     QString setgetfieldsextern;
+    QString setgetfieldsinline;
     for (int n = 0; n < info->fields.length(); ++n) {
-        // if (!info->fields[n]->defaultValues.isEmpty() )
-        {
-            QString suffix = QString("");
+        // When no struct accessor is available for a field array accessor is the default.
+        QString suffix = QString("");
+        QString size   = QString("sizeof(%1)").arg(typeList[n]);
+
+        if (info->fields[n]->numElements > 1) {
+            size = QString("%1*sizeof(%2)").arg(info->fields[n]->numElements).arg(typeList[n]);
             if (info->fields[n]->elementNames[0].compare(QString("0")) != 0) {
                 // struct based field accessor
                 QString structTypeName = QString("%1%2Data").arg(info->name).arg(info->fields[n]->name);
+                appendFieldAccessors(info, structTypeName, info->fields[n]->name, suffix, size, setgetfields, setgetfieldsextern, setgetfieldsinline);
 
-                /* SET */
-                setgetfieldsextern.append(QString("extern void %2%3Set(%1 *New%3);\n")
-                                          .arg(structTypeName)
-                                          .arg(info->name)
-                                          .arg(info->fields[n]->name));
-
-                /* GET */
-                setgetfieldsextern.append(QString("extern void %2%3Get(%1 *New%3);\n")
-                                          .arg(structTypeName)
-                                          .arg(info->name)
-                                          .arg(info->fields[n]->name));
+                // Append array suffix to array accessors
                 suffix = QString("Array");
             }
-            /* SET */
-            setgetfieldsextern.append(QString("extern void %2%3%4Set(%1 *New%3);\n")
-                                      .arg(typeList[n])
-                                      .arg(info->name)
-                                      .arg(info->fields[n]->name)
-                                      .arg(suffix));
-
-            /* GET */
-            setgetfieldsextern.append(QString("extern void %2%3%4Get(%1 *New%3);\n")
-                                      .arg(typeList[n])
-                                      .arg(info->name)
-                                      .arg(info->fields[n]->name)
-                                      .arg(suffix));
         }
+        // array based field accessor, or the plain one of a single element field
+        appendFieldAccessors(info, typeList[n], info->fields[n]->name, suffix, size, setgetfields, setgetfieldsextern, setgetfieldsinline);
+    }
+    if (info->isSingleInst) {
+        setgetfields = QString("#if !UAVOBJ_INLINE_ACCESSORS\n") + setgetfields + QString("#endif\n");
+        setgetfieldsextern = QString("#if UAVOBJ_INLINE_ACCESSORS\n") + setgetfieldsinline
+                             + QString("#else\n") + setgetfieldsextern + QString("#endif\n");
     }
+    outCode.replace(QString("$(SETGETFIELDS)"), setgetfields);
     outInclude.replace(QString("$(SETGETFIELDSEXTERN)"), setgetfieldsextern);
 
     // Write the flight code
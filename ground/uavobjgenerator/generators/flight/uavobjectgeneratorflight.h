@@ -41,6 +41,9 @@ public:
 
 private:
     bool process_object(ObjectInfo *info);
+    void appendFieldAccessors(ObjectInfo *info, const QString &type, const QString &field,
+                              const QString &suffix, const QString &size, QString &code, QString &include,
+                              QString &inlineInclude);
 };
 
 #endif
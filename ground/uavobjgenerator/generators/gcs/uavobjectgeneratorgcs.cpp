@@ -75,6 +75,7 @@ struct Context {
 struct FieldContext {
     FieldInfo *field;
     // field
+    int       fieldIndex;
     QString   fieldName;
     QString   fieldType;
     // property
@@ -233,6 +234,11 @@ void generateFieldInfo(Context &ctxt, FieldContext &fieldCtxt)
 {
     ctxt.fieldsInfo += generate(ctxt, fieldCtxt, "    // :fieldName\n");
 
+    // Position in getFields(), for UAVObject::getField(int)
+    ctxt.fieldsInfo += QString("    static const int %1_FIELDINDEX = %2;\n")
+                       .arg(fieldCtxt.field->name.toUpper())
+                       .arg(fieldCtxt.fieldIndex);
+
     if (fieldCtxt.field->type == FIELDTYPE_ENUM) {
         QStringList options = fieldCtxt.field->options;
         ctxt.fieldsInfo += "    typedef enum { ";
@@ -376,7 +382,18 @@ void generateBaseProperty(Context &ctxt, FieldContext &fieldCtxt)
     ctxt.properties        += generate(ctxt, fieldCtxt,
                                        "    Q_PROPERTY(:propType :propName READ :propName WRITE set:PropName NOTIFY :propNameChanged)\n");
 
-    ctxt.getters           += generate(ctxt, fieldCtxt, "    :propType :propName() const;\n");
+    if (fieldCtxt.field->numElements == 1) {
+        // typed lock-free read, see UAVObject::readSnapshot()
+        ctxt.getters += generate(ctxt, fieldCtxt,
+                                 "    :propType :propName() const\n"
+                                 "    {\n"
+                                 "        :fieldType value;\n"
+                                 "        readSnapshot(&value, offsetof(DataFields, :fieldName), sizeof(value));\n"
+                                 "        return static_cast<:propType>(value);\n"
+                                 "    }\n");
+    } else {
+        ctxt.getters += generate(ctxt, fieldCtxt, "    :propType :propName() const;\n");
+    }
     ctxt.setters           += generate(ctxt, fieldCtxt, "    void set:PropName(const :propRefType value);\n");
 
     ctxt.notifications     += generate(ctxt, fieldCtxt, "    void :propNameChanged(const :propRefType value);\n");
@@ -414,14 +431,6 @@ void generateSimpleProperty(Context &ctxt, FieldContext &fieldCtxt)
 
     generateBaseProperty(ctxt, fieldCtxt);
 
-    // getter implementation
-    ctxt.propertiesImpl += generate(ctxt, fieldCtxt,
-                                    ":propType :ClassName:::propName() const\n"
-                                    "{\n"
-                                    "   QMutexLocker locker(mutex);\n"
-                                    "   return static_cast<:propType>(data_.:fieldName);\n"
-                                    "}\n");
-
     // emitters
     QString emitters = generate(ctxt, fieldCtxt, "emit :propNameChanged(value);");
 
@@ -436,7 +445,9 @@ void generateSimpleProperty(Context &ctxt, FieldContext &fieldCtxt)
                                     "{\n"
                                     "   mutex->lock();\n"
                                     "   bool changed = (data_.:fieldName != static_cast<:fieldType>(value));\n"
+                                    "   beginWrite();\n"
                                     "   data_.:fieldName = static_cast<:fieldType>(value);\n"
+                                    "   endWrite();\n"
                                     "   mutex->unlock();\n"
                                     "   if (changed) { %1 }\n"
                                     "}\n\n").arg(emitters);
@@ -449,17 +460,15 @@ void generateIndexedProperty(Context &ctxt, FieldContext &fieldCtxt)
     }
 
     // indexed getter/setter
-    ctxt.getters += generate(ctxt, fieldCtxt, "    Q_INVOKABLE :propType :propName(quint32 index) const;\n");
+    ctxt.getters += generate(ctxt, fieldCtxt,
+                             "    Q_INVOKABLE :propType :propName(quint32 index) const\n"
+                             "    {\n"
+                             "        :fieldType value;\n"
+                             "        readSnapshot(&value, offsetof(DataFields, :fieldName) + index * sizeof(value), sizeof(value));\n"
+                             "        return static_cast<:propType>(value);\n"
+                             "    }\n");
     ctxt.setters += generate(ctxt, fieldCtxt, "    Q_INVOKABLE void set:PropName(quint32 index, const :propRefType value);\n");
 
-    // getter implementation
-    ctxt.propertiesImpl += generate(ctxt, fieldCtxt,
-                                    ":propType :ClassName:::propName(quint32 index) const\n"
-                                    "{\n"
-                                    "   QMutexLocker locker(mutex);\n"
-                                    "   return static_cast<:propType>(data_.:fieldName[index]);\n"
-                                    "}\n");
-
     // emitters
     QString emitters = generate(ctxt, fieldCtxt, "emit :propNameChanged(index, value);");
 
@@ -474,7 +483,9 @@ void generateIndexedProperty(Context &ctxt, FieldContext &fieldCtxt)
                                     "{\n"
                                     "   mutex->lock();\n"
                                     "   bool changed = (data_.:fieldName[index] != static_cast<:fieldType>(value));\n"
+                                    "   beginWrite();\n"
                                     "   data_.:fieldName[index] = static_cast<:fieldType>(value);\n"
+                                    "   endWrite();\n"
                                     "   mutex->unlock();\n"
                                     "   if (changed) { %1 }\n"
                                     "}\n\n").arg(emitters);
@@ -509,6 +520,7 @@ void generateIndexedProperty(Context &ctxt, FieldContext &fieldCtxt)
 
         FieldContext elementCtxt;
         elementCtxt.field       = fieldCtxt.field;
+        elementCtxt.fieldIndex  = fieldCtxt.fieldIndex;
         elementCtxt.fieldName   = fieldCtxt.fieldName + "_" + elementName;
         elementCtxt.fieldType   = fieldCtxt.fieldType;
         elementCtxt.propName    = fieldCtxt.propName + sep + elementName;
@@ -636,6 +648,7 @@ bool UAVObjectGeneratorGCS::process_object(ObjectInfo *object)
         // field context
         FieldContext fieldCtxt;
         fieldCtxt.field      = field;
+        fieldCtxt.fieldIndex = n;
 
         // field properties
         fieldCtxt.fieldName  = field->name;
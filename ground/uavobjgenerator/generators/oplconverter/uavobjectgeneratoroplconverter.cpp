@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectgeneratoroplconverter.cpp
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      produce the object schema table of the opl converter
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "uavobjectgeneratoroplconverter.h"
+
+using namespace std;
+
+bool UAVObjectGeneratorOplConverter::generate(UAVObjectParser *parser, QString templatepath, QString outputpath)
+{
+    fieldTypeStrSchema << "FIELD_INT8" << "FIELD_INT16" << "FIELD_INT32"
+                       << "FIELD_UINT8" << "FIELD_UINT16" << "FIELD_UINT32" << "FIELD_FLOAT32" << "FIELD_ENUM";
+
+    QDir templatePath     = QDir(templatepath + QString(OPLCONVERTER_CODE_DIR));
+    QDir outputPath       = QDir(outputpath);
+    outputPath.mkpath(outputPath.absolutePath());
+
+    QString schemaTemplate = readFile(templatePath.absoluteFilePath("uavobjectschema.cpp.template"));
+
+    if (schemaTemplate.isEmpty()) {
+        std::cerr << "Problem reading opl converter templates" << endl;
+        return false;
+    }
+
+    for (int objidx = 0; objidx < parser->getNumObjects(); ++objidx) {
+        ObjectInfo *info = parser->getObjectByIndex(objidx);
+        int numBytes     = parser->getNumBytes(objidx);
+        process_object(info, numBytes);
+    }
+
+    schemaTemplate.replace(QString("$(FIELDTABLES)"), fieldTablesCode);
+    schemaTemplate.replace(QString("$(OBJECTTABLE)"), objectTableCode);
+    schemaTemplate.replace(QString("$(NUMOBJECTS)"), QString::number(parser->getNumObjects()));
+    replaceCommonTags(schemaTemplate);
+
+    bool res = writeFileIfDifferent(outputPath.absolutePath() + "/uavobjectschema.cpp", schemaTemplate);
+    if (!res) {
+        cout << "Error: Could not write output files" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Generate the field table of an object and its entry in the object table
+ */
+bool UAVObjectGeneratorOplConverter::process_object(ObjectInfo *info, int numBytes)
+{
+    if (info == NULL) {
+        return false;
+    }
+
+    QString fieldTable;
+    for (int n = 0; n < info->fields.length(); ++n) {
+        FieldInfo *field     = info->fields[n];
+        QString prefix       = info->name + "_" + field->name;
+        QString elementNames = "NULL";
+        QString options      = "NULL";
+
+        if (!field->defaultElementNames) {
+            fieldTablesCode.append(stringArray(prefix + "_elements", field->elementNames));
+            elementNames = prefix + "_elements";
+        }
+        if (field->type == FIELDTYPE_ENUM) {
+            fieldTablesCode.append(stringArray(prefix + "_options", field->options));
+            options = prefix + "_options";
+        }
+        fieldTable.append(QString("    { \"%1\", %2, %3, %4, %5, %6 },\n")
+                          .arg(field->name)
+                          .arg(fieldTypeStrSchema[field->type])
+                          .arg(field->numElements)
+                          .arg(elementNames)
+                          .arg(field->type == FIELDTYPE_ENUM ? field->options.length() : 0)
+                          .arg(options));
+    }
+    fieldTablesCode.append("static const FieldSchema " + info->name + "_fields[] = {\n" + fieldTable + "};\n\n");
+
+    objectTableCode.append(QString("    { 0x%1, \"%2\", %3, %4, %5, %6_fields },\n")
+                           .arg(info->id, 8, 16, QChar('0'))
+                           .arg(info->name)
+                           .arg(info->isSingleInst ? "true" : "false")
+                           .arg(numBytes)
+                           .arg(info->fields.length())
+                           .arg(info->name));
+    return true;
+}
+
+QString UAVObjectGeneratorOplConverter::stringArray(const QString &name, const QStringList &strings)
+{
+    QString code = "static const char *const " + name + "[] = {";
+
+    for (int n = 0; n < strings.length(); ++n) {
+        code.append((n ? ", \"" : " \"") + QString(strings[n]).replace("\\", "\\\\").replace("\"", "\\\"") + "\"");
+    }
+    code.append(" };\n");
+    return code;
+}
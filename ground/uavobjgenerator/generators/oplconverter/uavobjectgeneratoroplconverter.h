@@ -0,0 +1,46 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectgeneratoroplconverter.h
+ * @author     The LibrePilot Project, http://www.librepilot.org Copyright (C) 2016.
+ * @brief      produce the object schema table of the opl converter
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef UAVOBJECTGENERATOROPLCONVERTER_H
+#define UAVOBJECTGENERATOROPLCONVERTER_H
+
+#define OPLCONVERTER_CODE_DIR "ground/oplconverter"
+
+#include "../generator_common.h"
+
+class UAVObjectGeneratorOplConverter {
+public:
+    bool generate(UAVObjectParser *gen, QString templatepath, QString outputpath);
+
+private:
+    bool process_object(ObjectInfo *info, int numBytes);
+    QString stringArray(const QString &name, const QStringList &strings);
+    QString fieldTablesCode;
+    QString objectTableCode;
+    QStringList fieldTypeStrSchema;
+};
+
+#endif // ifndef UAVOBJECTGENERATOROPLCONVERTER_H
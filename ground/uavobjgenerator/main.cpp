@@ -36,6 +36,7 @@
 #include "generators/matlab/uavobjectgeneratormatlab.h"
 #include "generators/python/uavobjectgeneratorpython.h"
 #include "generators/wireshark/uavobjectgeneratorwireshark.h"
+#include "generators/oplconverter/uavobjectgeneratoroplconverter.h"
 
 #define RETURN_ERR_USAGE 1
 #define RETURN_ERR_XML   2
@@ -56,6 +57,7 @@ void usage()
     cout << "\t-python        build python code" << endl;
     cout << "\t-matlab        build matlab code" << endl;
     cout << "\t-wireshark     build wireshark plugin" << endl;
+    cout << "\t-oplconverter  build the object schemas of the opl converter" << endl;
     cout << "\tIf no language is specified none are built - just parse xmls." << endl;
     cout << "Misc: " << endl;
     cout << "\t-h or --help   this help" << endl;
@@ -102,13 +104,14 @@ int main(int argc, char *argv[])
         return RETURN_OK;
     }
 
-    bool verbose       = (arguments_stringlist.removeAll("-v") > 0);
-    bool do_gcs        = (arguments_stringlist.removeAll("-gcs") > 0);
-    bool do_flight     = (arguments_stringlist.removeAll("-flight") > 0);
-    bool do_java       = (arguments_stringlist.removeAll("-java") > 0);
-    bool do_python     = (arguments_stringlist.removeAll("-python") > 0);
-    bool do_matlab     = (arguments_stringlist.removeAll("-matlab") > 0);
-    bool do_wireshark  = (arguments_stringlist.removeAll("-wireshark") > 0);
+    bool verbose         = (arguments_stringlist.removeAll("-v") > 0);
+    bool do_gcs          = (arguments_stringlist.removeAll("-gcs") > 0);
+    bool do_flight       = (arguments_stringlist.removeAll("-flight") > 0);
+    bool do_java         = (arguments_stringlist.removeAll("-java") > 0);
+    bool do_python       = (arguments_stringlist.removeAll("-python") > 0);
+    bool do_matlab       = (arguments_stringlist.removeAll("-matlab") > 0);
+    bool do_wireshark    = (arguments_stringlist.removeAll("-wireshark") > 0);
+    bool do_oplconverter = (arguments_stringlist.removeAll("-oplconverter") > 0);
 
     bool do_allObjects = true;
 
@@ -233,6 +236,11 @@ int main(int argc, char *argv[])
         cout << "generating wireshark code" << endl;
         UAVObjectGeneratorWireshark wiresharkgen;
         wiresharkgen.generate(parser, templatepath, outputpath);
+    } else if (do_oplconverter) {
+        // generate opl converter object schemas if wanted
+        cout << "generating opl converter code" << endl;
+        UAVObjectGeneratorOplConverter oplconvertergen;
+        oplconvertergen.generate(parser, templatepath, outputpath);
     }
 
     return RETURN_OK;
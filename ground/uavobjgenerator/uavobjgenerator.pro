@@ -31,6 +31,7 @@ SOURCES += main.cpp \
     generators/matlab/uavobjectgeneratormatlab.cpp \
     generators/python/uavobjectgeneratorpython.cpp \
     generators/wireshark/uavobjectgeneratorwireshark.cpp \
+    generators/oplconverter/uavobjectgeneratoroplconverter.cpp \
     generators/generator_common.cpp
 HEADERS += uavobjectparser.h \
     generators/generator_io.h \
@@ -39,4 +40,5 @@ HEADERS += uavobjectparser.h \
     generators/matlab/uavobjectgeneratormatlab.h \
     generators/python/uavobjectgeneratorpython.h \
     generators/wireshark/uavobjectgeneratorwireshark.h \
+    generators/oplconverter/uavobjectgeneratoroplconverter.h \
     generators/generator_common.h